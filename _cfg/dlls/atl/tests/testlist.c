@@ -0,0 +1,19 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_atl_ax(void);
+extern void func_module(void);
+extern void func_registrar(void);
+
+const struct test winetest_testlist[] =
+{
+    { "atl_ax", func_atl_ax },
+    { "module", func_module },
+    { "registrar", func_registrar },
+    { 0, 0 }
+};
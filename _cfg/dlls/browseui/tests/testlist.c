@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_autocomplete(void);
+extern void func_progressdlg(void);
+
+const struct test winetest_testlist[] =
+{
+    { "autocomplete", func_autocomplete },
+    { "progressdlg", func_progressdlg },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_extract(void);
+extern void func_fdi(void);
+
+const struct test winetest_testlist[] =
+{
+    { "extract", func_extract },
+    { "fdi", func_fdi },
+    { 0, 0 }
+};
@@ -0,0 +1,71 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_animate(void);
+extern void func_button(void);
+extern void func_combo(void);
+extern void func_datetime(void);
+extern void func_dpa(void);
+extern void func_edit(void);
+extern void func_header(void);
+extern void func_imagelist(void);
+extern void func_ipaddress(void);
+extern void func_listbox(void);
+extern void func_listview(void);
+extern void func_misc(void);
+extern void func_monthcal(void);
+extern void func_mru(void);
+extern void func_pager(void);
+extern void func_progress(void);
+extern void func_propsheet(void);
+extern void func_rebar(void);
+extern void func_static(void);
+extern void func_status(void);
+extern void func_subclass(void);
+extern void func_syslink(void);
+extern void func_tab(void);
+extern void func_taskdialog(void);
+extern void func_toolbar(void);
+extern void func_tooltips(void);
+extern void func_trackbar(void);
+extern void func_treeview(void);
+extern void func_updown(void);
+
+const struct test winetest_testlist[] =
+{
+    { "animate", func_animate },
+    { "button", func_button },
+    { "combo", func_combo },
+    { "datetime", func_datetime },
+    { "dpa", func_dpa },
+    { "edit", func_edit },
+    { "header", func_header },
+    { "imagelist", func_imagelist },
+    { "ipaddress", func_ipaddress },
+    { "listbox", func_listbox },
+    { "listview", func_listview },
+    { "misc", func_misc },
+    { "monthcal", func_monthcal },
+    { "mru", func_mru },
+    { "pager", func_pager },
+    { "progress", func_progress },
+    { "propsheet", func_propsheet },
+    { "rebar", func_rebar },
+    { "static", func_static },
+    { "status", func_status },
+    { "subclass", func_subclass },
+    { "syslink", func_syslink },
+    { "tab", func_tab },
+    { "taskdialog", func_taskdialog },
+    { "toolbar", func_toolbar },
+    { "tooltips", func_tooltips },
+    { "trackbar", func_trackbar },
+    { "treeview", func_treeview },
+    { "updown", func_updown },
+    { 0, 0 }
+};
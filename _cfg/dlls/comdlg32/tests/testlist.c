@@ -0,0 +1,23 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_filedlg(void);
+extern void func_finddlg(void);
+extern void func_fontdlg(void);
+extern void func_itemdlg(void);
+extern void func_printdlg(void);
+
+const struct test winetest_testlist[] =
+{
+    { "filedlg", func_filedlg },
+    { "finddlg", func_finddlg },
+    { "fontdlg", func_fontdlg },
+    { "itemdlg", func_itemdlg },
+    { "printdlg", func_printdlg },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_comsvcs(void);
+extern void func_property(void);
+
+const struct test winetest_testlist[] =
+{
+    { "comsvcs", func_comsvcs },
+    { "property", func_property },
+    { 0, 0 }
+};
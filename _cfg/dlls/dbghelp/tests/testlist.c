@@ -0,0 +1,19 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_dbghelp(void);
+extern void func_minidump(void);
+extern void func_path(void);
+
+const struct test winetest_testlist[] =
+{
+    { "dbghelp", func_dbghelp },
+    { "minidump", func_minidump },
+    { "path", func_path },
+    { 0, 0 }
+};
@@ -0,0 +1,27 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_capture(void);
+extern void func_ds3d(void);
+extern void func_ds3d8(void);
+extern void func_dsound(void);
+extern void func_dsound8(void);
+extern void func_duplex(void);
+extern void func_propset(void);
+
+const struct test winetest_testlist[] =
+{
+    { "capture", func_capture },
+    { "ds3d", func_ds3d },
+    { "ds3d8", func_ds3d8 },
+    { "dsound", func_dsound },
+    { "dsound8", func_dsound8 },
+    { "duplex", func_duplex },
+    { "propset", func_propset },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_mimeintl(void);
+extern void func_mimeole(void);
+
+const struct test winetest_testlist[] =
+{
+    { "mimeintl", func_mimeintl },
+    { "mimeole", func_mimeole },
+    { 0, 0 }
+};
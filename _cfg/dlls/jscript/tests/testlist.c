@@ -0,0 +1,21 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_activex(void);
+extern void func_caller(void);
+extern void func_jscript(void);
+extern void func_run(void);
+
+const struct test winetest_testlist[] =
+{
+    { "activex", func_activex },
+    { "caller", func_caller },
+    { "jscript", func_jscript },
+    { "run", func_run },
+    { 0, 0 }
+};
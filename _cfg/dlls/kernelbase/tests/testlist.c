@@ -0,0 +1,25 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_file(void);
+extern void func_memory(void);
+extern void func_path(void);
+extern void func_process(void);
+extern void func_security(void);
+extern void func_sync(void);
+
+const struct test winetest_testlist[] =
+{
+    { "file", func_file },
+    { "memory", func_memory },
+    { "path", func_path },
+    { "process", func_process },
+    { "security", func_security },
+    { "sync", func_sync },
+    { 0, 0 }
+};
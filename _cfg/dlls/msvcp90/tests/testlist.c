@@ -0,0 +1,19 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_ios(void);
+extern void func_misc(void);
+extern void func_string(void);
+
+const struct test winetest_testlist[] =
+{
+    { "ios", func_ios },
+    { "misc", func_misc },
+    { "string", func_string },
+    { 0, 0 }
+};
@@ -0,0 +1,15 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_psapi_main(void);
+
+const struct test winetest_testlist[] =
+{
+    { "psapi_main", func_psapi_main },
+    { 0, 0 }
+};
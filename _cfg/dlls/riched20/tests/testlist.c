@@ -0,0 +1,19 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_editor(void);
+extern void func_richole(void);
+extern void func_txtsrv(void);
+
+const struct test winetest_testlist[] =
+{
+    { "editor", func_editor },
+    { "richole", func_richole },
+    { "txtsrv", func_txtsrv },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_dictionary(void);
+extern void func_filesystem(void);
+
+const struct test winetest_testlist[] =
+{
+    { "dictionary", func_dictionary },
+    { "filesystem", func_filesystem },
+    { 0, 0 }
+};
@@ -0,0 +1,51 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_appbar(void);
+extern void func_assoc(void);
+extern void func_autocomplete(void);
+extern void func_brsfolder(void);
+extern void func_ebrowser(void);
+extern void func_generated(void);
+extern void func_progman_dde(void);
+extern void func_recyclebin(void);
+extern void func_shelldispatch(void);
+extern void func_shelllink(void);
+extern void func_shellole(void);
+extern void func_shellpath(void);
+extern void func_shfldr_special(void);
+extern void func_shlexec(void);
+extern void func_shlfileop(void);
+extern void func_shlfolder(void);
+extern void func_shlview(void);
+extern void func_string(void);
+extern void func_systray(void);
+
+const struct test winetest_testlist[] =
+{
+    { "appbar", func_appbar },
+    { "assoc", func_assoc },
+    { "autocomplete", func_autocomplete },
+    { "brsfolder", func_brsfolder },
+    { "ebrowser", func_ebrowser },
+    { "generated", func_generated },
+    { "progman_dde", func_progman_dde },
+    { "recyclebin", func_recyclebin },
+    { "shelldispatch", func_shelldispatch },
+    { "shelllink", func_shelllink },
+    { "shellole", func_shellole },
+    { "shellpath", func_shellpath },
+    { "shfldr_special", func_shfldr_special },
+    { "shlexec", func_shlexec },
+    { "shlfileop", func_shlfileop },
+    { "shlfolder", func_shlfolder },
+    { "shlview", func_shlview },
+    { "string", func_string },
+    { "systray", func_systray },
+    { 0, 0 }
+};
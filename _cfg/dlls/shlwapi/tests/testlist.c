@@ -0,0 +1,35 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_assoc(void);
+extern void func_clist(void);
+extern void func_clsid(void);
+extern void func_generated(void);
+extern void func_istream(void);
+extern void func_ordinal(void);
+extern void func_path(void);
+extern void func_shreg(void);
+extern void func_string(void);
+extern void func_thread(void);
+extern void func_url(void);
+
+const struct test winetest_testlist[] =
+{
+    { "assoc", func_assoc },
+    { "clist", func_clist },
+    { "clsid", func_clsid },
+    { "generated", func_generated },
+    { "istream", func_istream },
+    { "ordinal", func_ordinal },
+    { "path", func_path },
+    { "shreg", func_shreg },
+    { "string", func_string },
+    { "thread", func_thread },
+    { "url", func_url },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_query(void);
+extern void func_services(void);
+
+const struct test winetest_testlist[] =
+{
+    { "query", func_query },
+    { "services", func_services },
+    { 0, 0 }
+};
@@ -0,0 +1,43 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_bitmap(void);
+extern void func_bmpformat(void);
+extern void func_converter(void);
+extern void func_ddsformat(void);
+extern void func_gifformat(void);
+extern void func_icoformat(void);
+extern void func_info(void);
+extern void func_jpegformat(void);
+extern void func_metadata(void);
+extern void func_palette(void);
+extern void func_pngformat(void);
+extern void func_propertybag(void);
+extern void func_stream(void);
+extern void func_tiffformat(void);
+extern void func_wmpformat(void);
+
+const struct test winetest_testlist[] =
+{
+    { "bitmap", func_bitmap },
+    { "bmpformat", func_bmpformat },
+    { "converter", func_converter },
+    { "ddsformat", func_ddsformat },
+    { "gifformat", func_gifformat },
+    { "icoformat", func_icoformat },
+    { "info", func_info },
+    { "jpegformat", func_jpegformat },
+    { "metadata", func_metadata },
+    { "palette", func_palette },
+    { "pngformat", func_pngformat },
+    { "propertybag", func_propertybag },
+    { "stream", func_stream },
+    { "tiffformat", func_tiffformat },
+    { "wmpformat", func_wmpformat },
+    { 0, 0 }
+};
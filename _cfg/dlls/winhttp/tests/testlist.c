@@ -0,0 +1,19 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_notification(void);
+extern void func_url(void);
+extern void func_winhttp(void);
+
+const struct test winetest_testlist[] =
+{
+    { "notification", func_notification },
+    { "url", func_url },
+    { "winhttp", func_winhttp },
+    { 0, 0 }
+};
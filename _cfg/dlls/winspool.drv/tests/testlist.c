@@ -0,0 +1,15 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_info(void);
+
+const struct test winetest_testlist[] =
+{
+    { "info", func_info },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_ber(void);
+extern void func_parse(void);
+
+const struct test winetest_testlist[] =
+{
+    { "ber", func_ber },
+    { "parse", func_parse },
+    { 0, 0 }
+};
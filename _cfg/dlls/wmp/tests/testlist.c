@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_media(void);
+extern void func_oleobj(void);
+
+const struct test winetest_testlist[] =
+{
+    { "media", func_media },
+    { "oleobj", func_oleobj },
+    { 0, 0 }
+};
@@ -0,0 +1,17 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_reader(void);
+extern void func_writer(void);
+
+const struct test winetest_testlist[] =
+{
+    { "reader", func_reader },
+    { "writer", func_writer },
+    { 0, 0 }
+};
@@ -0,0 +1,852 @@
+/* include/config.h.  Generated from config.h.in by configure.  */
+/* include/config.h.in.  Generated from configure.ac by autoheader.  */
+
+#ifndef __WINE_CONFIG_H
+#define __WINE_CONFIG_H
+
+/* Define to the file extension for executables. */
+#define EXEEXT ""
+
+/* Define to 1 if you have the <arpa/inet.h> header file. */
+#define HAVE_ARPA_INET_H 1
+
+/* Define to 1 if you have the <arpa/nameser.h> header file. */
+#define HAVE_ARPA_NAMESER_H 1
+
+/* Define to 1 if you have the <asm/termbits.h> header file. */
+#define HAVE_ASM_TERMBITS_H 1
+
+/* Define to 1 if you have the <asm/types.h> header file. */
+#define HAVE_ASM_TYPES_H 1
+
+/* Define to 1 if you have the <asm/user.h> header file. */
+/* #undef HAVE_ASM_USER_H */
+
+/* Define to 1 if you have the <bluetooth/bluetooth.h> header file. */
+/* #undef HAVE_BLUETOOTH_BLUETOOTH_H */
+
+/* Define to 1 if you have the <bluetooth/rfcomm.h> header file. */
+/* #undef HAVE_BLUETOOTH_RFCOMM_H */
+
+/* Define to 1 if you have the <capi20.h> header file. */
+/* #undef HAVE_CAPI20_H */
+
+/* Define to 1 if you have the 'clock_gettime' function. */
+#define HAVE_CLOCK_GETTIME 1
+
+/* Define to 1 if you have the <CL/cl.h> header file. */
+/* #undef HAVE_CL_CL_H */
+
+/* Define to 1 if you have the <cups/cups.h> header file. */
+/* #undef HAVE_CUPS_CUPS_H */
+
+/* Define to 1 if you have the <cups/ppd.h> header file. */
+/* #undef HAVE_CUPS_PPD_H */
+
+/* Define to 1 if you have the 'dladdr1' function. */
+#define HAVE_DLADDR1 1
+
+/* Define to 1 if you have the 'dlinfo' function. */
+#define HAVE_DLINFO 1
+
+/* Define to 1 if you have the <elf.h> header file. */
+#define HAVE_ELF_H 1
+
+/* Define to 1 if you have the 'epoll_create' function. */
+#define HAVE_EPOLL_CREATE 1
+
+/* Define to 1 if you have the 'epoll_pwait2' function. */
+#define HAVE_EPOLL_PWAIT2 1
+
+/* Define to 1 if you have the FFmpeg libraries. */
+/* #undef HAVE_FFMPEG */
+
+/* Define if FreeType 2 is installed */
+/* #undef HAVE_FREETYPE */
+
+/* Define to 1 if you have the 'fstatfs' function. */
+#define HAVE_FSTATFS 1
+
+/* Define to 1 if you have the <ft2build.h> header file. */
+/* #undef HAVE_FT2BUILD_H */
+
+/* Define to 1 if the system has the type 'FT_TrueTypeEngineType'. */
+/* #undef HAVE_FT_TRUETYPEENGINETYPE */
+
+/* Define to 1 if you have the 'futimens' function. */
+#define HAVE_FUTIMENS 1
+
+/* Define to 1 if you have the 'futimes' function. */
+#define HAVE_FUTIMES 1
+
+/* Define to 1 if you have the 'futimesat' function. */
+#define HAVE_FUTIMESAT 1
+
+/* Define to 1 if you have the 'getaddrinfo' function. */
+#define HAVE_GETADDRINFO 1
+
+/* Define to 1 if you have the 'getattrlist' function. */
+/* #undef HAVE_GETATTRLIST */
+
+/* Define to 1 if you have the 'getauxval' function. */
+#define HAVE_GETAUXVAL 1
+
+/* Define to 1 if you have the 'getifaddrs' function. */
+#define HAVE_GETIFADDRS 1
+
+/* Define to 1 if you have the 'getrandom' function. */
+#define HAVE_GETRANDOM 1
+
+/* Define to 1 if you have the <gettext-po.h> header file. */
+/* #undef HAVE_GETTEXT_PO_H */
+
+/* Define to 1 if you have the 'gnutls_cipher_init' function. */
+#define HAVE_GNUTLS_CIPHER_INIT 1
+
+/* Define if we have the libgphoto2_port development environment */
+/* #undef HAVE_GPHOTO2_PORT */
+
+/* Define to 1 if you have the <gssapi/gssapi_ext.h> header file. */
+/* #undef HAVE_GSSAPI_GSSAPI_EXT_H */
+
+/* Define to 1 if you have the <gssapi/gssapi.h> header file. */
+/* #undef HAVE_GSSAPI_GSSAPI_H */
+
+/* Define to 1 if you have the <ifaddrs.h> header file. */
+#define HAVE_IFADDRS_H 1
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+
+/* Define to 1 if you have the 'kqueue' function. */
+/* #undef HAVE_KQUEUE */
+
+/* Define to 1 if you have the <krb5/krb5.h> header file. */
+/* #undef HAVE_KRB5_KRB5_H */
+
+/* Define to 1 if you have the <libavcodec/avcodec.h> header file. */
+/* #undef HAVE_LIBAVCODEC_AVCODEC_H */
+
+/* Define to 1 if you have the <libavcodec/bsf.h> header file. */
+/* #undef HAVE_LIBAVCODEC_BSF_H */
+
+/* Define to 1 if you have the <libavformat/avformat.h> header file. */
+/* #undef HAVE_LIBAVFORMAT_AVFORMAT_H */
+
+/* Define to 1 if you have the <libavutil/avutil.h> header file. */
+/* #undef HAVE_LIBAVUTIL_AVUTIL_H */
+
+/* Define to 1 if you have the 'gettextpo' library (-lgettextpo). */
+/* #undef HAVE_LIBGETTEXTPO */
+
+/* Define to 1 if you have the 'procstat' library (-lprocstat). */
+/* #undef HAVE_LIBPROCSTAT */
+
+/* Define to 1 if you have the <libprocstat.h> header file. */
+/* #undef HAVE_LIBPROCSTAT_H */
+
+/* Define to 1 if you have the <libudev.h> header file. */
+/* #undef HAVE_LIBUDEV_H */
+
+/* Define to 1 if you have the 'unwind' library (-lunwind). */
+/* #undef HAVE_LIBUNWIND */
+
+/* Define if we have the wayland-egl development environment */
+/* #undef HAVE_LIBWAYLAND_EGL */
+
+/* Define if you have the X Shape extension */
+/* #undef HAVE_LIBXSHAPE */
+
+/* Define if you have the X Shm extension */
+/* #undef HAVE_LIBXXSHM */
+
+/* Define to 1 if you have the <link.h> header file. */
+#define HAVE_LINK_H 1
+
+/* Define to 1 if you have the <linux/capi.h> header file. */
+#define HAVE_LINUX_CAPI_H 1
+
+/* Define to 1 if you have the <linux/cdrom.h> header file. */
+#define HAVE_LINUX_CDROM_H 1
+
+/* Define to 1 if you have the <linux/filter.h> header file. */
+#define HAVE_LINUX_FILTER_H 1
+
+/* Define to 1 if you have the <linux/fs.h> header file. */
+#define HAVE_LINUX_FS_H 1
+
+/* Define if Linux-style gethostbyname_r and gethostbyaddr_r are available */
+#define HAVE_LINUX_GETHOSTBYNAME_R_6 1
+
+/* Define to 1 if you have the <linux/hdreg.h> header file. */
+#define HAVE_LINUX_HDREG_H 1
+
+/* Define to 1 if you have the <linux/hidraw.h> header file. */
+#define HAVE_LINUX_HIDRAW_H 1
+
+/* Define to 1 if you have the <linux/input.h> header file. */
+#define HAVE_LINUX_INPUT_H 1
+
+/* Define to 1 if you have the <linux/ioctl.h> header file. */
+#define HAVE_LINUX_IOCTL_H 1
+
+/* Define to 1 if you have the <linux/ipx.h> header file. */
+/* #undef HAVE_LINUX_IPX_H */
+
+/* Define to 1 if you have the <linux/irda.h> header file. */
+/* #undef HAVE_LINUX_IRDA_H */
+
+/* Define to 1 if you have the <linux/major.h> header file. */
+#define HAVE_LINUX_MAJOR_H 1
+
+/* Define to 1 if you have the <linux/param.h> header file. */
+#define HAVE_LINUX_PARAM_H 1
+
+/* Define to 1 if you have the <linux/rtnetlink.h> header file. */
+#define HAVE_LINUX_RTNETLINK_H 1
+
+/* Define to 1 if you have the <linux/serial.h> header file. */
+#define HAVE_LINUX_SERIAL_H 1
+
+/* Define to 1 if you have the <linux/types.h> header file. */
+#define HAVE_LINUX_TYPES_H 1
+
+/* Define to 1 if you have the <linux/ucdrom.h> header file. */
+/* #undef HAVE_LINUX_UCDROM_H */
+
+/* Define to 1 if you have the <linux/userfaultfd.h> header file. */
+#define HAVE_LINUX_USERFAULTFD_H 1
+
+/* Define to 1 if you have the <linux/videodev2.h> header file. */
+#define HAVE_LINUX_VIDEODEV2_H 1
+
+/* Define to 1 if you have the <linux/wireless.h> header file. */
+#define HAVE_LINUX_WIRELESS_H 1
+
+/* Define to 1 if you have the <lwp.h> header file. */
+/* #undef HAVE_LWP_H */
+
+/* Define to 1 if you have the <machine/cpu.h> header file. */
+/* #undef HAVE_MACHINE_CPU_H */
+
+/* Define to 1 if you have the <machine/sysarch.h> header file. */
+/* #undef HAVE_MACHINE_SYSARCH_H */
+
+/* Define to 1 if you have the <mach/mach.h> header file. */
+/* #undef HAVE_MACH_MACH_H */
+
+/* Define to 1 if you have the <mach-o/loader.h> header file. */
+/* #undef HAVE_MACH_O_LOADER_H */
+
+/* Define to 1 if you have the <mntent.h> header file. */
+#define HAVE_MNTENT_H 1
+
+/* Define if MTLDevice protocol has registryID property. */
+/* #undef HAVE_MTLDEVICE_REGISTRYID */
+
+/* Define to 1 if you have the <netdb.h> header file. */
+#define HAVE_NETDB_H 1
+
+/* Define to 1 if you have the <netinet6/ip6_var.h> header file. */
+/* #undef HAVE_NETINET6_IP6_VAR_H */
+
+/* Define to 1 if you have the <netinet/icmp6.h> header file. */
+#define HAVE_NETINET_ICMP6_H 1
+
+/* Define to 1 if you have the <netinet/icmp_var.h> header file. */
+/* #undef HAVE_NETINET_ICMP_VAR_H */
+
+/* Define to 1 if you have the <netinet/if_ether.h> header file. */
+#define HAVE_NETINET_IF_ETHER_H 1
+
+/* Define to 1 if you have the <netinet/in.h> header file. */
+#define HAVE_NETINET_IN_H 1
+
+/* Define to 1 if you have the <netinet/in_pcb.h> header file. */
+/* #undef HAVE_NETINET_IN_PCB_H */
+
+/* Define to 1 if you have the <netinet/in_systm.h> header file. */
+#define HAVE_NETINET_IN_SYSTM_H 1
+
+/* Define to 1 if you have the <netinet/ip.h> header file. */
+#define HAVE_NETINET_IP_H 1
+
+/* Define to 1 if you have the <netinet/ip_icmp.h> header file. */
+#define HAVE_NETINET_IP_ICMP_H 1
+
+/* Define to 1 if you have the <netinet/ip_var.h> header file. */
+/* #undef HAVE_NETINET_IP_VAR_H */
+
+/* Define to 1 if you have the <netinet/tcp_fsm.h> header file. */
+/* #undef HAVE_NETINET_TCP_FSM_H */
+
+/* Define to 1 if you have the <netinet/tcp.h> header file. */
+#define HAVE_NETINET_TCP_H 1
+
+/* Define to 1 if you have the <netinet/tcp_var.h> header file. */
+/* #undef HAVE_NETINET_TCP_VAR_H */
+
+/* Define to 1 if you have the <netinet/udp.h> header file. */
+#define HAVE_NETINET_UDP_H 1
+
+/* Define to 1 if you have the <netinet/udp_var.h> header file. */
+/* #undef HAVE_NETINET_UDP_VAR_H */
+
+/* Define to 1 if you have the <netipx/ipx.h> header file. */
+#define HAVE_NETIPX_IPX_H 1
+
+/* Define to 1 if you have the <net/if_arp.h> header file. */
+#define HAVE_NET_IF_ARP_H 1
+
+/* Define to 1 if you have the <net/if_dl.h> header file. */
+/* #undef HAVE_NET_IF_DL_H */
+
+/* Define to 1 if you have the <net/if.h> header file. */
+#define HAVE_NET_IF_H 1
+
+/* Define to 1 if you have the <net/if_types.h> header file. */
+/* #undef HAVE_NET_IF_TYPES_H */
+
+/* Define to 1 if you have the <net/route.h> header file. */
+#define HAVE_NET_ROUTE_H 1
+
+/* Define to 1 if you have the <OpenCL/opencl.h> header file. */
+/* #undef HAVE_OPENCL_OPENCL_H */
+
+/* Define to 1 if 'numaudioengines' is a member of 'oss_sysinfo'. */
+/* #undef HAVE_OSS_SYSINFO_NUMAUDIOENGINES */
+
+/* Define to 1 if you have the <pcap/pcap.h> header file. */
+/* #undef HAVE_PCAP_PCAP_H */
+
+/* Define to 1 if you have the 'pipe2' function. */
+#define HAVE_PIPE2 1
+
+/* Define to 1 if you have the 'port_create' function. */
+/* #undef HAVE_PORT_CREATE */
+
+/* Define to 1 if you have the <port.h> header file. */
+/* #undef HAVE_PORT_H */
+
+/* Define to 1 if you have the 'posix_fadvise' function. */
+#define HAVE_POSIX_FADVISE 1
+
+/* Define to 1 if you have the 'posix_fallocate' function. */
+#define HAVE_POSIX_FALLOCATE 1
+
+/* Define to 1 if you have the 'prctl' function. */
+#define HAVE_PRCTL 1
+
+/* Define to 1 if you have the 'preadv' function. */
+/* #undef HAVE_PREADV */
+
+/* Define to 1 if you have the 'pthread_getthreadid_np' function. */
+/* #undef HAVE_PTHREAD_GETTHREADID_NP */
+
+/* Define to 1 if you have the <pthread_np.h> header file. */
+/* #undef HAVE_PTHREAD_NP_H */
+
+/* Define to 1 if you have the <pwd.h> header file. */
+#define HAVE_PWD_H 1
+
+/* Define to 1 if you have the 'pwritev' function. */
+/* #undef HAVE_PWRITEV */
+
+/* Define to 1 if the system has the type 'request_sense'. */
+/* #undef HAVE_REQUEST_SENSE */
+
+/* Define if you have the resolver library and header */
+#define HAVE_RESOLV 1
+
+/* Define to 1 if you have the <resolv.h> header file. */
+#define HAVE_RESOLV_H 1
+
+/* Define to 1 if you have the 'res_getservers' function. */
+/* #undef HAVE_RES_GETSERVERS */
+
+/* Define to 1 if you have the 'sched_getcpu' function. */
+#define HAVE_SCHED_GETCPU 1
+
+/* Define to 1 if you have the <sched.h> header file. */
+#define HAVE_SCHED_H 1
+
+/* Define to 1 if you have the 'sched_setaffinity' function. */
+#define HAVE_SCHED_SETAFFINITY 1
+
+/* Define to 1 if you have the 'sched_yield' function. */
+#define HAVE_SCHED_YIELD 1
+
+/* Define to 1 if 'cmd' is a member of 'scsireq_t'. */
+/* #undef HAVE_SCSIREQ_T_CMD */
+
+/* Define to 1 if you have the <scsi/scsi.h> header file. */
+#define HAVE_SCSI_SCSI_H 1
+
+/* Define to 1 if you have the <scsi/scsi_ioctl.h> header file. */
+#define HAVE_SCSI_SCSI_IOCTL_H 1
+
+/* Define to 1 if you have the <scsi/sg.h> header file. */
+#define HAVE_SCSI_SG_H 1
+
+/* Define to 1 if you have the <SDL.h> header file. */
+/* #undef HAVE_SDL_H */
+
+/* Define to 1 if you have the 'setproctitle' function. */
+/* #undef HAVE_SETPROCTITLE */
+
+/* Define to 1 if you have the 'setprogname' function. */
+/* #undef HAVE_SETPROGNAME */
+
+/* Define to 1 if 'interface_id' is a member of 'sg_io_hdr_t'. */
+#define HAVE_SG_IO_HDR_T_INTERFACE_ID 1
+
+/* Define to 1 if 'si_fd' is a member of 'siginfo_t'. */
+#define HAVE_SIGINFO_T_SI_FD 1
+
+/* Define to 1 if you have the 'sigprocmask' function. */
+#define HAVE_SIGPROCMASK 1
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdio.h> header file. */
+#define HAVE_STDIO_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if 'icp6s_error' is a member of 'struct icmp6stat'. */
+/* #undef HAVE_STRUCT_ICMP6STAT_ICP6S_ERROR */
+
+/* Define to 1 if 'icps_error' is a member of 'struct icmpstat'. */
+/* #undef HAVE_STRUCT_ICMPSTAT_ICPS_ERROR */
+
+/* Define to 1 if 'ifr_hwaddr' is a member of 'struct ifreq'. */
+#define HAVE_STRUCT_IFREQ_IFR_HWADDR 1
+
+/* Define to 1 if 'ipi6_addr' is a member of 'struct in6_pktinfo'. */
+#define HAVE_STRUCT_IN6_PKTINFO_IPI6_ADDR 1
+
+/* Define to 1 if 'ip6s_total' is a member of 'struct ip6stat'. */
+/* #undef HAVE_STRUCT_IP6STAT_IP6S_TOTAL */
+
+/* Define to 1 if 'ips_total' is a member of 'struct ipstat'. */
+/* #undef HAVE_STRUCT_IPSTAT_IPS_TOTAL */
+
+/* Define to 1 if 'ips_total' is a member of 'struct ip_stats'. */
+/* #undef HAVE_STRUCT_IP_STATS_IPS_TOTAL */
+
+/* Define to 1 if 'mt_blkno' is a member of 'struct mtget'. */
+#define HAVE_STRUCT_MTGET_MT_BLKNO 1
+
+/* Define to 1 if 'mt_blksiz' is a member of 'struct mtget'. */
+/* #undef HAVE_STRUCT_MTGET_MT_BLKSIZ */
+
+/* Define to 1 if 'mt_gstat' is a member of 'struct mtget'. */
+#define HAVE_STRUCT_MTGET_MT_GSTAT 1
+
+/* Define to 1 if 'sin6_scope_id' is a member of 'struct sockaddr_in6'. */
+#define HAVE_STRUCT_SOCKADDR_IN6_SIN6_SCOPE_ID 1
+
+/* Define to 1 if 'sun_len' is a member of 'struct sockaddr_un'. */
+/* #undef HAVE_STRUCT_SOCKADDR_UN_SUN_LEN */
+
+/* Define to 1 if 'st_atim' is a member of 'struct stat'. */
+#define HAVE_STRUCT_STAT_ST_ATIM 1
+
+/* Define to 1 if 'st_atimespec' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT_ST_ATIMESPEC */
+
+/* Define to 1 if 'st_birthtim' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT_ST_BIRTHTIM */
+
+/* Define to 1 if 'st_birthtime' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT_ST_BIRTHTIME */
+
+/* Define to 1 if 'st_birthtimespec' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT_ST_BIRTHTIMESPEC */
+
+/* Define to 1 if 'st_ctim' is a member of 'struct stat'. */
+#define HAVE_STRUCT_STAT_ST_CTIM 1
+
+/* Define to 1 if 'st_ctimespec' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT_ST_CTIMESPEC */
+
+/* Define to 1 if 'st_mtim' is a member of 'struct stat'. */
+#define HAVE_STRUCT_STAT_ST_MTIM 1
+
+/* Define to 1 if 'st_mtimespec' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT_ST_MTIMESPEC */
+
+/* Define to 1 if '__st_birthtim' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT___ST_BIRTHTIM */
+
+/* Define to 1 if '__st_birthtime' is a member of 'struct stat'. */
+/* #undef HAVE_STRUCT_STAT___ST_BIRTHTIME */
+
+/* Define to 1 if 'mem_unit' is a member of 'struct sysinfo'. */
+#define HAVE_STRUCT_SYSINFO_MEM_UNIT 1
+
+/* Define to 1 if 'totalram' is a member of 'struct sysinfo'. */
+#define HAVE_STRUCT_SYSINFO_TOTALRAM 1
+
+/* Define to 1 if 'tcps_connattempt' is a member of 'struct tcpstat'. */
+/* #undef HAVE_STRUCT_TCPSTAT_TCPS_CONNATTEMPT */
+
+/* Define to 1 if 'tcps_connattempt' is a member of 'struct tcp_stats'. */
+/* #undef HAVE_STRUCT_TCP_STATS_TCPS_CONNATTEMPT */
+
+/* Define to 1 if 'udps_ipackets' is a member of 'struct udpstat'. */
+/* #undef HAVE_STRUCT_UDPSTAT_UDPS_IPACKETS */
+
+/* Define to 1 if '_u._ext.nscount6' is a member of 'struct __res_state'. */
+#define HAVE_STRUCT___RES_STATE__U__EXT_NSCOUNT6 1
+
+/* Define to 1 if you have the <syscall.h> header file. */
+#define HAVE_SYSCALL_H 1
+
+/* Define to 1 if you have the 'sysinfo' function. */
+#define HAVE_SYSINFO 1
+
+/* Define to 1 if you have the <sys/attr.h> header file. */
+/* #undef HAVE_SYS_ATTR_H */
+
+/* Define to 1 if you have the <sys/auxv.h> header file. */
+#define HAVE_SYS_AUXV_H 1
+
+/* Define to 1 if you have the <sys/cdio.h> header file. */
+/* #undef HAVE_SYS_CDIO_H */
+
+/* Define to 1 if you have the <sys/conf.h> header file. */
+/* #undef HAVE_SYS_CONF_H */
+
+/* Define to 1 if you have the <sys/epoll.h> header file. */
+#define HAVE_SYS_EPOLL_H 1
+
+/* Define to 1 if you have the <sys/event.h> header file. */
+/* #undef HAVE_SYS_EVENT_H */
+
+/* Define to 1 if you have the <sys/extattr.h> header file. */
+/* #undef HAVE_SYS_EXTATTR_H */
+
+/* Define to 1 if you have the <sys/filio.h> header file. */
+/* #undef HAVE_SYS_FILIO_H */
+
+/* Define to 1 if you have the <sys/inotify.h> header file. */
+#define HAVE_SYS_INOTIFY_H 1
+
+/* Define to 1 if you have the <sys/ipc.h> header file. */
+#define HAVE_SYS_IPC_H 1
+
+/* Define to 1 if you have the <sys/link.h> header file. */
+/* #undef HAVE_SYS_LINK_H */
+
+/* Define to 1 if you have the <sys/modem.h> header file. */
+/* #undef HAVE_SYS_MODEM_H */
+
+/* Define to 1 if you have the <sys/mount.h> header file. */
+#define HAVE_SYS_MOUNT_H 1
+
+/* Define to 1 if you have the <sys/mtio.h> header file. */
+#define HAVE_SYS_MTIO_H 1
+
+/* Define to 1 if you have the <sys/param.h> header file. */
+#define HAVE_SYS_PARAM_H 1
+
+/* Define to 1 if you have the <sys/prctl.h> header file. */
+#define HAVE_SYS_PRCTL_H 1
+
+/* Define to 1 if you have the <sys/ptrace.h> header file. */
+#define HAVE_SYS_PTRACE_H 1
+
+/* Define to 1 if you have the <sys/queue.h> header file. */
+#define HAVE_SYS_QUEUE_H 1
+
+/* Define to 1 if you have the <sys/random.h> header file. */
+#define HAVE_SYS_RANDOM_H 1
+
+/* Define to 1 if you have the <sys/resource.h> header file. */
+#define HAVE_SYS_RESOURCE_H 1
+
+/* Define to 1 if you have the <sys/scsiio.h> header file. */
+/* #undef HAVE_SYS_SCSIIO_H */
+
+/* Define to 1 if you have the <sys/shm.h> header file. */
+#define HAVE_SYS_SHM_H 1
+
+/* Define to 1 if you have the <sys/signal.h> header file. */
+#define HAVE_SYS_SIGNAL_H 1
+
+/* Define to 1 if you have the <sys/socketvar.h> header file. */
+#define HAVE_SYS_SOCKETVAR_H 1
+
+/* Define to 1 if you have the <sys/sockio.h> header file. */
+/* #undef HAVE_SYS_SOCKIO_H */
+
+/* Define to 1 if you have the <sys/statfs.h> header file. */
+#define HAVE_SYS_STATFS_H 1
+
+/* Define to 1 if you have the <sys/statvfs.h> header file. */
+#define HAVE_SYS_STATVFS_H 1
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/strtio.h> header file. */
+/* #undef HAVE_SYS_STRTIO_H */
+
+/* Define to 1 if you have the <sys/syscall.h> header file. */
+#define HAVE_SYS_SYSCALL_H 1
+
+/* Define to 1 if you have the <sys/sysctl.h> header file. */
+/* #undef HAVE_SYS_SYSCTL_H */
+
+/* Define to 1 if you have the <sys/sysinfo.h> header file. */
+#define HAVE_SYS_SYSINFO_H 1
+
+/* Define to 1 if you have the <sys/thr.h> header file. */
+/* #undef HAVE_SYS_THR_H */
+
+/* Define to 1 if you have the <sys/times.h> header file. */
+#define HAVE_SYS_TIMES_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <sys/ucontext.h> header file. */
+#define HAVE_SYS_UCONTEXT_H 1
+
+/* Define to 1 if you have the <sys/uio.h> header file. */
+#define HAVE_SYS_UIO_H 1
+
+/* Define to 1 if you have the <sys/un.h> header file. */
+#define HAVE_SYS_UN_H 1
+
+/* Define to 1 if you have the <sys/user.h> header file. */
+#define HAVE_SYS_USER_H 1
+
+/* Define to 1 if you have the <sys/utsname.h> header file. */
+#define HAVE_SYS_UTSNAME_H 1
+
+/* Define to 1 if you have the <sys/vfs.h> header file. */
+#define HAVE_SYS_VFS_H 1
+
+/* Define to 1 if you have the <sys/vnode.h> header file. */
+/* #undef HAVE_SYS_VNODE_H */
+
+/* Define to 1 if you have the <sys/xattr.h> header file. */
+#define HAVE_SYS_XATTR_H 1
+
+/* Define to 1 if you have the 'tcdrain' function. */
+#define HAVE_TCDRAIN 1
+
+/* Define to 1 if you have the 'thr_kill2' function. */
+/* #undef HAVE_THR_KILL2 */
+
+/* Define to 1 if you have the 'udev' library (-ludev). */
+/* #undef HAVE_UDEV */
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define to 1 if you have the <utime.h> header file. */
+#define HAVE_UTIME_H 1
+
+/* Define to 1 if you have the <valgrind/memcheck.h> header file. */
+/* #undef HAVE_VALGRIND_MEMCHECK_H */
+
+/* Define to 1 if you have the <valgrind/valgrind.h> header file. */
+/* #undef HAVE_VALGRIND_VALGRIND_H */
+
+/* Define to 1 if the Wine preloader is being used. */
+#define HAVE_WINE_PRELOADER 1
+
+/* Define to 1 if you have the <X11/extensions/shape.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_SHAPE_H */
+
+/* Define to 1 if you have the <X11/extensions/xf86vmode.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XF86VMODE_H */
+
+/* Define to 1 if you have the <X11/extensions/xf86vmproto.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XF86VMPROTO_H */
+
+/* Define to 1 if you have the <X11/extensions/Xfixes.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XFIXES_H */
+
+/* Define to 1 if you have the <X11/extensions/Xinerama.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XINERAMA_H */
+
+/* Define to 1 if you have the <X11/extensions/XInput2.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XINPUT2_H */
+
+/* Define to 1 if you have the <X11/extensions/Xrandr.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XRANDR_H */
+
+/* Define to 1 if you have the <X11/extensions/Xrender.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XRENDER_H */
+
+/* Define to 1 if you have the <X11/extensions/XShm.h> header file. */
+/* #undef HAVE_X11_EXTENSIONS_XSHM_H */
+
+/* Define to 1 if 'xcookie' is a member of 'XEvent'. */
+/* #undef HAVE_XEVENT_XCOOKIE */
+
+/* Define to 1 if 'callback' is a member of 'XICCallback'. */
+/* #undef HAVE_XICCALLBACK_CALLBACK */
+
+/* Define to 1 if you have the <xkbcommon/xkbcommon.h> header file. */
+/* #undef HAVE_XKBCOMMON_XKBCOMMON_H */
+
+/* Define to 1 if you have the <xkbcommon/xkbregistry.h> header file. */
+/* #undef HAVE_XKBCOMMON_XKBREGISTRY_H */
+
+/* Define if Xrender has the XRenderCreateLinearGradient function */
+/* #undef HAVE_XRENDERCREATELINEARGRADIENT */
+
+/* Define if Xrender has the XRenderSetPictureTransform function */
+/* #undef HAVE_XRENDERSETPICTURETRANSFORM */
+
+/* Define if Xrandr has the XRRGetProviderResources function */
+/* #undef HAVE_XRRGETPROVIDERRESOURCES */
+
+/* Define to 1 if you have the '__builtin_popcount' built-in function. */
+#define HAVE___BUILTIN_POPCOUNT 1
+
+/* Define to 1 if you have the '__clear_cache' (potentially built-in)
+   function. */
+#define HAVE___CLEAR_CACHE 1
+
+/* Define to 1 if 'major', 'minor', and 'makedev' are declared in <mkdev.h>.
+   */
+/* #undef MAJOR_IN_MKDEV */
+
+/* Define to 1 if 'major', 'minor', and 'makedev' are declared in
+   <sysmacros.h>. */
+#define MAJOR_IN_SYSMACROS 1
+
+/* Define to the address where bug reports for this package should be sent. */
+#define PACKAGE_BUGREPORT "wine-devel@winehq.org"
+
+/* Define to the full name of this package. */
+#define PACKAGE_NAME "Wine"
+
+/* Define to the full name and version of this package. */
+#define PACKAGE_STRING "Wine 10.10"
+
+/* Define to the one symbol short name of this package. */
+#define PACKAGE_TARNAME "wine"
+
+/* Define to the home page for this package. */
+#define PACKAGE_URL "https://www.winehq.org"
+
+/* Define to the version of this package. */
+#define PACKAGE_VERSION "10.10"
+
+/* Define to the soname of the libcups library. */
+/* #undef SONAME_LIBCUPS */
+
+/* Define to the soname of the libdbus-1 library. */
+/* #undef SONAME_LIBDBUS_1 */
+
+/* Define to the soname of the libEGL library. */
+#define SONAME_LIBEGL "libEGL.so.1"
+
+/* Define to the soname of the libfontconfig library. */
+#define SONAME_LIBFONTCONFIG "libfontconfig.so.1"
+
+/* Define to the soname of the libfreetype library. */
+/* #undef SONAME_LIBFREETYPE */
+
+/* Define to the soname of the libGL library. */
+/* #undef SONAME_LIBGL */
+
+/* Define to the soname of the libGLESv2 library. */
+/* #undef SONAME_LIBGLESV2 */
+
+/* Define to the soname of the libgnutls library. */
+#define SONAME_LIBGNUTLS "libgnutls.so.30"
+
+/* Define to the soname of the libgssapi_krb5 library. */
+/* #undef SONAME_LIBGSSAPI_KRB5 */
+
+/* Define to the soname of the libkrb5 library. */
+/* #undef SONAME_LIBKRB5 */
+
+/* Define to the soname of the libMoltenVK library. */
+/* #undef SONAME_LIBMOLTENVK */
+
+/* Define to the soname of the libnetapi library. */
+#define SONAME_LIBNETAPI "libnetapi.so"
+
+/* Define to the soname of the libodbc library. */
+#define SONAME_LIBODBC "libodbc.so"
+
+/* Define to the soname of the libSDL2 library. */
+/* #undef SONAME_LIBSDL2 */
+
+/* Define to the soname of the libv4l2 library. */
+/* #undef SONAME_LIBV4L2 */
+
+/* Define to the soname of the libvulkan library. */
+/* #undef SONAME_LIBVULKAN */
+
+/* Define to the soname of the libX11 library. */
+/* #undef SONAME_LIBX11 */
+
+/* Define to the soname of the libXcomposite library. */
+/* #undef SONAME_LIBXCOMPOSITE */
+
+/* Define to the soname of the libXcursor library. */
+/* #undef SONAME_LIBXCURSOR */
+
+/* Define to the soname of the libXext library. */
+/* #undef SONAME_LIBXEXT */
+
+/* Define to the soname of the libXfixes library. */
+/* #undef SONAME_LIBXFIXES */
+
+/* Define to the soname of the libXi library. */
+/* #undef SONAME_LIBXI */
+
+/* Define to the soname of the libXinerama library. */
+/* #undef SONAME_LIBXINERAMA */
+
+/* Define to the soname of the libXrandr library. */
+/* #undef SONAME_LIBXRANDR */
+
+/* Define to the soname of the libXrender library. */
+/* #undef SONAME_LIBXRENDER */
+
+/* Define to the soname of the libXxf86vm library. */
+/* #undef SONAME_LIBXXF86VM */
+
+/* Define to 1 if all of the C89 standard headers exist (not just the ones
+   required in a freestanding environment). This macro is provided for
+   backward compatibility; new code need not use it. */
+#define STDC_HEADERS 1
+
+/* Define if xattr functions take additional arguments (macOS) */
+/* #undef XATTR_ADDITIONAL_OPTIONS */
+
+/* Number of bits in a file offset, on hosts where this is settable. */
+/* #undef _FILE_OFFSET_BITS */
+
+/* Define to 1 to enable GNU extensions on Linux */
+#define _GNU_SOURCE 1
+
+/* Define to 1 on platforms where this makes off_t a 64-bit type. */
+/* #undef _LARGE_FILES */
+
+/* Number of bits in time_t, on hosts where this is settable. */
+/* #undef _TIME_BITS */
+
+/* Define to 1 on platforms where this makes time_t a 64-bit type. */
+/* #undef __MINGW_USE_VC2005_COMPAT */
+
+#endif /* __WINE_CONFIG_H */
@@ -0,0 +1,25 @@
+/* Automatically generated by make depend; DO NOT EDIT!! */
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#define STANDALONE
+#include "wine/test.h"
+
+extern void func_add(void);
+extern void func_copy(void);
+extern void func_delete(void);
+extern void func_export(void);
+extern void func_import(void);
+extern void func_query(void);
+
+const struct test winetest_testlist[] =
+{
+    { "add", func_add },
+    { "copy", func_copy },
+    { "delete", func_delete },
+    { "export", func_export },
+    { "import", func_import },
+    { "query", func_query },
+    { 0, 0 }
+};
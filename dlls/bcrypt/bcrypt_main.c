@@ -36,6 +36,8 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(bcrypt);
 
+BOOL WINAPI ProcessPrng(BYTE *data, SIZE_T size);
+
 #define UNIX_CALL( func, params ) WINE_UNIX_CALL( unix_ ## func, params )
 
 
@@ -343,7 +345,7 @@ NTSTATUS WINAPI BCryptGenRandom( BCRYPT_ALG_HANDLE handle, UCHAR *buffer, ULONG
 
     if (alg || (flags & BCRYPT_USE_SYSTEM_PREFERRED_RNG))
     {
-        if (RtlGenRandom(buffer, count)) return STATUS_SUCCESS;
+        if (ProcessPrng(buffer, count)) return STATUS_SUCCESS;
     }
 
     FIXME("called with unsupported parameters, returning error\n");
@@ -432,6 +434,436 @@ NTSTATUS WINAPI BCryptGetFipsAlgorithmMode(BOOLEAN *enabled)
     return STATUS_SUCCESS;
 }
 
+#if defined(__x86_64__) && defined(__GNUC__)
+
+#include <intrin.h>
+
+/* SHA-1/SHA-256 block functions using the Intel SHA extensions, following the
+ * schedule from Intel's white paper.  They run on the libtomcrypt hash state,
+ * so init/done and the padding path stay with the generic code. */
+
+static struct ltc_hash_descriptor sha1_ni_desc, sha256_ni_desc;
+
+__attribute__((target("sha,ssse3,sse4.1")))
+static void sha1_ni_transform( ulong32 *state, const unsigned char *data, unsigned long blocks )
+{
+    const __m128i mask = _mm_set_epi64x( 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL );
+    __m128i abcd, abcd_save, e0, e0_save, e1;
+    __m128i msg0, msg1, msg2, msg3;
+
+    abcd = _mm_loadu_si128( (const __m128i *)state );
+    e0   = _mm_set_epi32( state[4], 0, 0, 0 );
+    abcd = _mm_shuffle_epi32( abcd, 0x1b );
+
+    while (blocks--)
+    {
+        abcd_save = abcd;
+        e0_save   = e0;
+
+        /* rounds 0-3 */
+        msg0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)data ), mask );
+        e0   = _mm_add_epi32( e0, msg0 );
+        e1   = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 0 );
+
+        /* rounds 4-7 */
+        msg1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)(data + 16) ), mask );
+        e1   = _mm_sha1nexte_epu32( e1, msg1 );
+        e0   = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 0 );
+        msg0 = _mm_sha1msg1_epu32( msg0, msg1 );
+
+        /* rounds 8-11 */
+        msg2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)(data + 32) ), mask );
+        e0   = _mm_sha1nexte_epu32( e0, msg2 );
+        e1   = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 0 );
+        msg1 = _mm_sha1msg1_epu32( msg1, msg2 );
+        msg0 = _mm_xor_si128( msg0, msg2 );
+
+        /* rounds 12-15 */
+        msg3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)(data + 48) ), mask );
+        e1   = _mm_sha1nexte_epu32( e1, msg3 );
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32( msg0, msg3 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 0 );
+        msg2 = _mm_sha1msg1_epu32( msg2, msg3 );
+        msg1 = _mm_xor_si128( msg1, msg3 );
+
+        /* rounds 16-19 */
+        e0   = _mm_sha1nexte_epu32( e0, msg0 );
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32( msg1, msg0 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 0 );
+        msg3 = _mm_sha1msg1_epu32( msg3, msg0 );
+        msg2 = _mm_xor_si128( msg2, msg0 );
+
+        /* rounds 20-23 */
+        e1   = _mm_sha1nexte_epu32( e1, msg1 );
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32( msg2, msg1 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 1 );
+        msg0 = _mm_sha1msg1_epu32( msg0, msg1 );
+        msg3 = _mm_xor_si128( msg3, msg1 );
+
+        /* rounds 24-27 */
+        e0   = _mm_sha1nexte_epu32( e0, msg2 );
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32( msg3, msg2 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 1 );
+        msg1 = _mm_sha1msg1_epu32( msg1, msg2 );
+        msg0 = _mm_xor_si128( msg0, msg2 );
+
+        /* rounds 28-31 */
+        e1   = _mm_sha1nexte_epu32( e1, msg3 );
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32( msg0, msg3 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 1 );
+        msg2 = _mm_sha1msg1_epu32( msg2, msg3 );
+        msg1 = _mm_xor_si128( msg1, msg3 );
+
+        /* rounds 32-35 */
+        e0   = _mm_sha1nexte_epu32( e0, msg0 );
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32( msg1, msg0 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 1 );
+        msg3 = _mm_sha1msg1_epu32( msg3, msg0 );
+        msg2 = _mm_xor_si128( msg2, msg0 );
+
+        /* rounds 36-39 */
+        e1   = _mm_sha1nexte_epu32( e1, msg1 );
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32( msg2, msg1 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 1 );
+        msg0 = _mm_sha1msg1_epu32( msg0, msg1 );
+        msg3 = _mm_xor_si128( msg3, msg1 );
+
+        /* rounds 40-43 */
+        e0   = _mm_sha1nexte_epu32( e0, msg2 );
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32( msg3, msg2 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 2 );
+        msg1 = _mm_sha1msg1_epu32( msg1, msg2 );
+        msg0 = _mm_xor_si128( msg0, msg2 );
+
+        /* rounds 44-47 */
+        e1   = _mm_sha1nexte_epu32( e1, msg3 );
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32( msg0, msg3 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 2 );
+        msg2 = _mm_sha1msg1_epu32( msg2, msg3 );
+        msg1 = _mm_xor_si128( msg1, msg3 );
+
+        /* rounds 48-51 */
+        e0   = _mm_sha1nexte_epu32( e0, msg0 );
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32( msg1, msg0 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 2 );
+        msg3 = _mm_sha1msg1_epu32( msg3, msg0 );
+        msg2 = _mm_xor_si128( msg2, msg0 );
+
+        /* rounds 52-55 */
+        e1   = _mm_sha1nexte_epu32( e1, msg1 );
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32( msg2, msg1 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 2 );
+        msg0 = _mm_sha1msg1_epu32( msg0, msg1 );
+        msg3 = _mm_xor_si128( msg3, msg1 );
+
+        /* rounds 56-59 */
+        e0   = _mm_sha1nexte_epu32( e0, msg2 );
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32( msg3, msg2 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 2 );
+        msg1 = _mm_sha1msg1_epu32( msg1, msg2 );
+        msg0 = _mm_xor_si128( msg0, msg2 );
+
+        /* rounds 60-63 */
+        e1   = _mm_sha1nexte_epu32( e1, msg3 );
+        e0   = abcd;
+        msg0 = _mm_sha1msg2_epu32( msg0, msg3 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 3 );
+        msg2 = _mm_sha1msg1_epu32( msg2, msg3 );
+        msg1 = _mm_xor_si128( msg1, msg3 );
+
+        /* rounds 64-67 */
+        e0   = _mm_sha1nexte_epu32( e0, msg0 );
+        e1   = abcd;
+        msg1 = _mm_sha1msg2_epu32( msg1, msg0 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 3 );
+        msg3 = _mm_sha1msg1_epu32( msg3, msg0 );
+        msg2 = _mm_xor_si128( msg2, msg0 );
+
+        /* rounds 68-71 */
+        e1   = _mm_sha1nexte_epu32( e1, msg1 );
+        e0   = abcd;
+        msg2 = _mm_sha1msg2_epu32( msg2, msg1 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 3 );
+        msg3 = _mm_xor_si128( msg3, msg1 );
+
+        /* rounds 72-75 */
+        e0   = _mm_sha1nexte_epu32( e0, msg2 );
+        e1   = abcd;
+        msg3 = _mm_sha1msg2_epu32( msg3, msg2 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 3 );
+
+        /* rounds 76-79 */
+        e1   = _mm_sha1nexte_epu32( e1, msg3 );
+        e0   = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 3 );
+
+        e0   = _mm_sha1nexte_epu32( e0, e0_save );
+        abcd = _mm_add_epi32( abcd, abcd_save );
+
+        data += 64;
+    }
+
+    abcd = _mm_shuffle_epi32( abcd, 0x1b );
+    _mm_storeu_si128( (__m128i *)state, abcd );
+    state[4] = _mm_extract_epi32( e0, 3 );
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+static void sha256_ni_transform( ulong32 *digest, const unsigned char *data, unsigned long blocks )
+{
+    const __m128i mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+    __m128i state0, state1, abef_save, cdgh_save, msg, tmp;
+    __m128i msg0, msg1, msg2, msg3;
+
+    /* shuffle the state into the ABEF/CDGH order sha256rnds2 expects */
+    tmp    = _mm_loadu_si128( (const __m128i *)digest );        /* DCBA */
+    state1 = _mm_loadu_si128( (const __m128i *)(digest + 4) );  /* HGFE */
+    tmp    = _mm_shuffle_epi32( tmp, 0xb1 );                    /* CDAB */
+    state1 = _mm_shuffle_epi32( state1, 0x1b );                 /* EFGH */
+    state0 = _mm_alignr_epi8( tmp, state1, 8 );                 /* ABEF */
+    state1 = _mm_blend_epi16( state1, tmp, 0xf0 );              /* CDGH */
+
+    while (blocks--)
+    {
+        abef_save = state0;
+        cdgh_save = state1;
+
+        /* rounds 0-3 */
+        msg0   = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)data ), mask );
+        msg    = _mm_add_epi32( msg0, _mm_set_epi64x( 0xe9b5dba5b5c0fbcfULL, 0x71374491428a2f98ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+
+        /* rounds 4-7 */
+        msg1   = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)(data + 16) ), mask );
+        msg    = _mm_add_epi32( msg1, _mm_set_epi64x( 0xab1c5ed5923f82a4ULL, 0x59f111f13956c25bULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg0   = _mm_sha256msg1_epu32( msg0, msg1 );
+
+        /* rounds 8-11 */
+        msg2   = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)(data + 32) ), mask );
+        msg    = _mm_add_epi32( msg2, _mm_set_epi64x( 0x550c7dc3243185beULL, 0x12835b01d807aa98ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg1   = _mm_sha256msg1_epu32( msg1, msg2 );
+
+        /* rounds 12-15 */
+        msg3   = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)(data + 48) ), mask );
+        msg    = _mm_add_epi32( msg3, _mm_set_epi64x( 0xc19bf1749bdc06a7ULL, 0x80deb1fe72be5d74ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg3, msg2, 4 );
+        msg0   = _mm_add_epi32( msg0, tmp );
+        msg0   = _mm_sha256msg2_epu32( msg0, msg3 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg2   = _mm_sha256msg1_epu32( msg2, msg3 );
+
+        /* rounds 16-19 */
+        msg    = _mm_add_epi32( msg0, _mm_set_epi64x( 0x240ca1cc0fc19dc6ULL, 0xefbe4786e49b69c1ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg0, msg3, 4 );
+        msg1   = _mm_add_epi32( msg1, tmp );
+        msg1   = _mm_sha256msg2_epu32( msg1, msg0 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg3   = _mm_sha256msg1_epu32( msg3, msg0 );
+
+        /* rounds 20-23 */
+        msg    = _mm_add_epi32( msg1, _mm_set_epi64x( 0x76f988da5cb0a9dcULL, 0x4a7484aa2de92c6fULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg1, msg0, 4 );
+        msg2   = _mm_add_epi32( msg2, tmp );
+        msg2   = _mm_sha256msg2_epu32( msg2, msg1 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg0   = _mm_sha256msg1_epu32( msg0, msg1 );
+
+        /* rounds 24-27 */
+        msg    = _mm_add_epi32( msg2, _mm_set_epi64x( 0xbf597fc7b00327c8ULL, 0xa831c66d983e5152ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg2, msg1, 4 );
+        msg3   = _mm_add_epi32( msg3, tmp );
+        msg3   = _mm_sha256msg2_epu32( msg3, msg2 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg1   = _mm_sha256msg1_epu32( msg1, msg2 );
+
+        /* rounds 28-31 */
+        msg    = _mm_add_epi32( msg3, _mm_set_epi64x( 0x1429296706ca6351ULL, 0xd5a79147c6e00bf3ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg3, msg2, 4 );
+        msg0   = _mm_add_epi32( msg0, tmp );
+        msg0   = _mm_sha256msg2_epu32( msg0, msg3 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg2   = _mm_sha256msg1_epu32( msg2, msg3 );
+
+        /* rounds 32-35 */
+        msg    = _mm_add_epi32( msg0, _mm_set_epi64x( 0x53380d134d2c6dfcULL, 0x2e1b213827b70a85ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg0, msg3, 4 );
+        msg1   = _mm_add_epi32( msg1, tmp );
+        msg1   = _mm_sha256msg2_epu32( msg1, msg0 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg3   = _mm_sha256msg1_epu32( msg3, msg0 );
+
+        /* rounds 36-39 */
+        msg    = _mm_add_epi32( msg1, _mm_set_epi64x( 0x92722c8581c2c92eULL, 0x766a0abb650a7354ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg1, msg0, 4 );
+        msg2   = _mm_add_epi32( msg2, tmp );
+        msg2   = _mm_sha256msg2_epu32( msg2, msg1 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg0   = _mm_sha256msg1_epu32( msg0, msg1 );
+
+        /* rounds 40-43 */
+        msg    = _mm_add_epi32( msg2, _mm_set_epi64x( 0xc76c51a3c24b8b70ULL, 0xa81a664ba2bfe8a1ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg2, msg1, 4 );
+        msg3   = _mm_add_epi32( msg3, tmp );
+        msg3   = _mm_sha256msg2_epu32( msg3, msg2 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg1   = _mm_sha256msg1_epu32( msg1, msg2 );
+
+        /* rounds 44-47 */
+        msg    = _mm_add_epi32( msg3, _mm_set_epi64x( 0x106aa070f40e3585ULL, 0xd6990624d192e819ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg3, msg2, 4 );
+        msg0   = _mm_add_epi32( msg0, tmp );
+        msg0   = _mm_sha256msg2_epu32( msg0, msg3 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg2   = _mm_sha256msg1_epu32( msg2, msg3 );
+
+        /* rounds 48-51 */
+        msg    = _mm_add_epi32( msg0, _mm_set_epi64x( 0x34b0bcb52748774cULL, 0x1e376c0819a4c116ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg0, msg3, 4 );
+        msg1   = _mm_add_epi32( msg1, tmp );
+        msg1   = _mm_sha256msg2_epu32( msg1, msg0 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+        msg3   = _mm_sha256msg1_epu32( msg3, msg0 );
+
+        /* rounds 52-55 */
+        msg    = _mm_add_epi32( msg1, _mm_set_epi64x( 0x682e6ff35b9cca4fULL, 0x4ed8aa4a391c0cb3ULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg1, msg0, 4 );
+        msg2   = _mm_add_epi32( msg2, tmp );
+        msg2   = _mm_sha256msg2_epu32( msg2, msg1 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+
+        /* rounds 56-59 */
+        msg    = _mm_add_epi32( msg2, _mm_set_epi64x( 0x8cc7020884c87814ULL, 0x78a5636f748f82eeULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        tmp    = _mm_alignr_epi8( msg2, msg1, 4 );
+        msg3   = _mm_add_epi32( msg3, tmp );
+        msg3   = _mm_sha256msg2_epu32( msg3, msg2 );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+
+        /* rounds 60-63 */
+        msg    = _mm_add_epi32( msg3, _mm_set_epi64x( 0xc67178f2bef9a3f7ULL, 0xa4506ceb90befffaULL ) );
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );
+        msg    = _mm_shuffle_epi32( msg, 0x0e );
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );
+
+        state0 = _mm_add_epi32( state0, abef_save );
+        state1 = _mm_add_epi32( state1, cdgh_save );
+
+        data += 64;
+    }
+
+    tmp    = _mm_shuffle_epi32( state0, 0x1b );                 /* FEBA */
+    state1 = _mm_shuffle_epi32( state1, 0xb1 );                 /* DCHG */
+    state0 = _mm_blend_epi16( tmp, state1, 0xf0 );              /* DCBA */
+    state1 = _mm_alignr_epi8( state1, tmp, 8 );                 /* HGFE */
+
+    _mm_storeu_si128( (__m128i *)digest, state0 );
+    _mm_storeu_si128( (__m128i *)(digest + 4), state1 );
+}
+
+/* same buffering as libtomcrypt's HASH_PROCESS, but full blocks go to the
+ * block function in a single call */
+#define HASH_PROCESS_NI(func_name, transform, state_var, block_size)         \
+static int func_name( hash_state *md, const unsigned char *in, unsigned long inlen ) \
+{                                                                            \
+    unsigned long n;                                                         \
+    if (md->state_var.curlen > sizeof(md->state_var.buf)) return CRYPT_INVALID_ARG; \
+    if ((md->state_var.length + inlen) < md->state_var.length) return CRYPT_HASH_OVERFLOW; \
+    while (inlen > 0)                                                        \
+    {                                                                        \
+        if (md->state_var.curlen == 0 && inlen >= block_size)                \
+        {                                                                    \
+            n = inlen / block_size;                                          \
+            transform( md->state_var.state, in, n );                         \
+            md->state_var.length += n * block_size * 8;                      \
+            in    += n * block_size;                                         \
+            inlen -= n * block_size;                                         \
+        }                                                                    \
+        else                                                                 \
+        {                                                                    \
+            n = MIN( inlen, block_size - md->state_var.curlen );             \
+            memcpy( md->state_var.buf + md->state_var.curlen, in, n );       \
+            md->state_var.curlen += n;                                       \
+            in    += n;                                                      \
+            inlen -= n;                                                      \
+            if (md->state_var.curlen == block_size)                          \
+            {                                                                \
+                transform( md->state_var.state, md->state_var.buf, 1 );      \
+                md->state_var.length += block_size * 8;                      \
+                md->state_var.curlen = 0;                                    \
+            }                                                                \
+        }                                                                    \
+    }                                                                        \
+    return CRYPT_OK;                                                         \
+}
+
+HASH_PROCESS_NI( sha1_ni_process, sha1_ni_transform, sha1, 64 )
+HASH_PROCESS_NI( sha256_ni_process, sha256_ni_transform, sha256, 64 )
+
+static void init_sha_dispatch(void)
+{
+    int regs[4];
+
+    __cpuid( regs, 0 );
+    if (regs[0] < 7) return;
+    __cpuid( regs, 1 );
+    if (!(regs[2] & (1 << 9)) || !(regs[2] & (1 << 19))) return; /* SSSE3, SSE4.1 */
+    __cpuidex( regs, 7, 0 );
+    if (!(regs[1] & (1 << 29))) return; /* SHA */
+
+    sha1_ni_desc = sha1_desc;
+    sha1_ni_desc.process = sha1_ni_process;
+    sha256_ni_desc = sha256_desc;
+    sha256_ni_desc.process = sha256_ni_process;
+}
+
+#endif  /* __x86_64__ && __GNUC__ */
+
 static const struct ltc_hash_descriptor *get_hash_descriptor( enum alg_id alg_id )
 {
     switch (alg_id)
@@ -439,8 +871,13 @@ static const struct ltc_hash_descriptor *get_hash_descriptor( enum alg_id alg_id
     case ALG_ID_MD2: return &md2_desc;
     case ALG_ID_MD4: return &md4_desc;
     case ALG_ID_MD5: return &md5_desc;
+#if defined(__x86_64__) && defined(__GNUC__)
+    case ALG_ID_SHA1: return sha1_ni_desc.process ? &sha1_ni_desc : &sha1_desc;
+    case ALG_ID_SHA256: return sha256_ni_desc.process ? &sha256_ni_desc : &sha256_desc;
+#else
     case ALG_ID_SHA1: return &sha1_desc;
     case ALG_ID_SHA256: return &sha256_desc;
+#endif
     case ALG_ID_SHA384: return &sha384_desc;
     case ALG_ID_SHA512: return &sha512_desc;
     default:
@@ -2752,6 +3189,9 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
     {
     case DLL_PROCESS_ATTACH:
         DisableThreadLibraryCalls( hinst );
+#if defined(__x86_64__) && defined(__GNUC__)
+        init_sha_dispatch();
+#endif
         if (!__wine_init_unix_call())
         {
             if (UNIX_CALL( process_attach, NULL)) __wine_unixlib_handle = 0;
@@ -17,11 +17,171 @@
  */
 
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include "windef.h"
 #include "winbase.h"
 #include "ntsecapi.h"
 
+/* Pseudorandom generator with fast key erasure, in the style of arc4random().
+ *
+ * Each thread keeps a ChaCha20 key seeded from the system generator.  The
+ * keystream refills a buffer whose first bytes immediately replace the key,
+ * so compromising the current state never reveals previously returned bytes,
+ * and output is handed out from the buffer and wiped as it is consumed.
+ * Fresh system entropy is mixed in again after PRNG_RESEED_LIMIT bytes. */
+
+#define PRNG_BUFFER_SIZE  1024
+#define PRNG_RESEED_LIMIT (16 * 1024 * 1024)
+
+struct prng
+{
+    UINT   key[8];                 /* erased and replaced on every refill */
+    BYTE   buf[PRNG_BUFFER_SIZE];  /* pending output, wiped as it is consumed */
+    UINT64 counter;
+    UINT   pos;
+    UINT   until_reseed;
+};
+
+static DWORD prng_tls = TLS_OUT_OF_INDEXES;
+
+static inline UINT rotl32( UINT x, int n )
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+#define QUARTERROUND(a, b, c, d) \
+    do { \
+        x[a] += x[b]; x[d] = rotl32( x[d] ^ x[a], 16 ); \
+        x[c] += x[d]; x[b] = rotl32( x[b] ^ x[c], 12 ); \
+        x[a] += x[b]; x[d] = rotl32( x[d] ^ x[a], 8 ); \
+        x[c] += x[d]; x[b] = rotl32( x[b] ^ x[c], 7 ); \
+    } while (0)
+
+static void chacha20_block( const UINT key[8], UINT64 counter, BYTE *out )
+{
+    UINT x[16], input[16];
+    unsigned int i;
+
+    input[0] = 0x61707865;
+    input[1] = 0x3320646e;
+    input[2] = 0x79622d32;
+    input[3] = 0x6b206574;
+    for (i = 0; i < 8; i++) input[4 + i] = key[i];
+    input[12] = (UINT)counter;
+    input[13] = (UINT)(counter >> 32);
+    input[14] = 0;
+    input[15] = 0;
+
+    memcpy( x, input, sizeof(x) );
+    for (i = 0; i < 10; i++)
+    {
+        QUARTERROUND( 0, 4, 8, 12 );
+        QUARTERROUND( 1, 5, 9, 13 );
+        QUARTERROUND( 2, 6, 10, 14 );
+        QUARTERROUND( 3, 7, 11, 15 );
+        QUARTERROUND( 0, 5, 10, 15 );
+        QUARTERROUND( 1, 6, 11, 12 );
+        QUARTERROUND( 2, 7, 8, 13 );
+        QUARTERROUND( 3, 4, 9, 14 );
+    }
+    for (i = 0; i < 16; i++) x[i] += input[i];
+    memcpy( out, x, sizeof(x) );
+
+    SecureZeroMemory( x, sizeof(x) );
+    SecureZeroMemory( input, sizeof(input) );
+}
+
+static BOOL prng_refill( struct prng *prng )
+{
+    unsigned int i;
+
+    if (prng->until_reseed < sizeof(prng->buf))
+    {
+        if (!RtlGenRandom( prng->key, sizeof(prng->key) )) return FALSE;
+        prng->counter = 0;
+        prng->until_reseed = PRNG_RESEED_LIMIT;
+    }
+
+    for (i = 0; i < sizeof(prng->buf); i += 64)
+        chacha20_block( prng->key, prng->counter++, prng->buf + i );
+
+    /* fast key erasure, the start of the keystream becomes the next key */
+    memcpy( prng->key, prng->buf, sizeof(prng->key) );
+    SecureZeroMemory( prng->buf, sizeof(prng->key) );
+    prng->counter = 0;
+    prng->pos = sizeof(prng->key);
+    prng->until_reseed -= sizeof(prng->buf);
+    return TRUE;
+}
+
+static struct prng *get_prng(void)
+{
+    struct prng *prng;
+
+    if (prng_tls == TLS_OUT_OF_INDEXES) return NULL;
+    if ((prng = TlsGetValue( prng_tls ))) return prng;
+
+    if (!(prng = malloc( sizeof(*prng) ))) return NULL;
+    prng->pos = sizeof(prng->buf);
+    prng->until_reseed = 0;
+    if (!TlsSetValue( prng_tls, prng ))
+    {
+        free( prng );
+        return NULL;
+    }
+    return prng;
+}
+
+static void free_prng(void)
+{
+    struct prng *prng;
+
+    if (prng_tls == TLS_OUT_OF_INDEXES) return;
+    if (!(prng = TlsGetValue( prng_tls ))) return;
+    SecureZeroMemory( prng, sizeof(*prng) );
+    free( prng );
+    TlsSetValue( prng_tls, NULL );
+}
+
 BOOL WINAPI ProcessPrng(BYTE *data, SIZE_T size)
 {
-    return RtlGenRandom(data, size);
+    struct prng *prng;
+
+    if (!(prng = get_prng())) return RtlGenRandom( data, size );
+
+    while (size)
+    {
+        SIZE_T len;
+
+        if (prng->pos == sizeof(prng->buf) && !prng_refill( prng ))
+            return RtlGenRandom( data, size );
+        len = min( size, sizeof(prng->buf) - prng->pos );
+        memcpy( data, prng->buf + prng->pos, len );
+        SecureZeroMemory( prng->buf + prng->pos, len );
+        prng->pos += len;
+        data += len;
+        size -= len;
+    }
+    return TRUE;
+}
+
+BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, void *reserved )
+{
+    switch (reason)
+    {
+    case DLL_PROCESS_ATTACH:
+        prng_tls = TlsAlloc();
+        break;
+    case DLL_THREAD_DETACH:
+        free_prng();
+        break;
+    case DLL_PROCESS_DETACH:
+        if (reserved) break;
+        free_prng();
+        TlsFree( prng_tls );
+        prng_tls = TLS_OUT_OF_INDEXES;
+        break;
+    }
+    return TRUE;
 }
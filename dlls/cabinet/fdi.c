@@ -1124,7 +1124,13 @@ static cab_LONG fdi_Zipinflate_codes(const struct Ziphuft *tl, const struct Ziph
         e = ZIPWSIZE - max(d, w);
         e = min(e, n);
         n -= e;
-        do
+        if (w >= d + e || d >= w + e)  /* no overlap: copy the run in one go */
+        {
+          memcpy(CAB(outbuf) + w, CAB(outbuf) + d, e);
+          w += e;
+          d += e;
+        }
+        else do
         {
           CAB(outbuf)[w++] = CAB(outbuf)[d++];
         } while (--e);
@@ -1537,7 +1543,10 @@ static int QTMfdi_decomp(int inlen, int outlen, fdi_decomp_state *decomp_state)
       window_posn += match_length;
 
       /* copy match data - no worries about destination wraps */
-      while (match_length-- > 0) *rundest++ = *runsrc++;
+      if (runsrc + match_length <= rundest || rundest + match_length <= runsrc)
+        memcpy(rundest, runsrc, match_length);
+      else
+        while (match_length-- > 0) *rundest++ = *runsrc++;
     }
   } /* while (togo > 0) */
 
@@ -1775,7 +1784,10 @@ static int LZXfdi_decomp(int inlen, int outlen, fdi_decomp_state *decomp_state)
             window_posn += match_length;
 
             /* copy match data - no worries about destination wraps */
-            while (match_length-- > 0) *rundest++ = *runsrc++;
+            if (runsrc + match_length <= rundest || rundest + match_length <= runsrc)
+              memcpy(rundest, runsrc, match_length);
+            else
+              while (match_length-- > 0) *rundest++ = *runsrc++;
           }
         }
         break;
@@ -1864,7 +1876,10 @@ static int LZXfdi_decomp(int inlen, int outlen, fdi_decomp_state *decomp_state)
             window_posn += match_length;
 
             /* copy match data - no worries about destination wraps */
-            while (match_length-- > 0) *rundest++ = *runsrc++;
+            if (runsrc + match_length <= rundest || rundest + match_length <= runsrc)
+              memcpy(rundest, runsrc, match_length);
+            else
+              while (match_length-- > 0) *rundest++ = *runsrc++;
           }
         }
         break;
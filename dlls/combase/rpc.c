@@ -1226,26 +1226,29 @@ static HRESULT WINAPI ClientRpcChannelBuffer_GetBuffer(LPRPCCHANNELBUFFER iface,
                                   &message_state->params.iface);
     if (hr == S_OK)
     {
-        /* stub, chan, iface and iid are unneeded in multi-threaded case as we go
-         * via the RPC runtime */
-        if (apt->multi_threaded)
+        HWND window = NULL;
+
+        if (!apt->multi_threaded && !(window = apartment_getwindow(apt)))
+            ERR("window for apartment %s is NULL\n", wine_dbgstr_longlong(apt->oxid));
+
+        if (apt->multi_threaded || window)
+        {
+            /* dispatch in-process calls directly: through the apartment window
+             * for STAs, on a worker thread that joins the MTA otherwise */
+            message_state->params.bypass_rpcrt = TRUE;
+            message_state->target_hwnd = window;
+            message_state->target_tid = apt->tid;
+        }
+        else
         {
+            /* stub, chan, iface and iid are unneeded when we go via the RPC
+             * runtime */
             IRpcStubBuffer_Release(message_state->params.stub);
             message_state->params.stub = NULL;
             IRpcChannelBuffer_Release(message_state->params.chan);
             message_state->params.chan = NULL;
             message_state->params.iface = NULL;
         }
-        else
-        {
-            message_state->params.bypass_rpcrt = TRUE;
-            message_state->target_hwnd = apartment_getwindow(apt);
-            message_state->target_tid = apt->tid;
-            /* we assume later on that this being non-NULL is the indicator that
-             * means call directly instead of going through RPC runtime */
-            if (!message_state->target_hwnd)
-                ERR("window for apartment %s is NULL\n", wine_dbgstr_longlong(apt->oxid));
-        }
     }
     if (apt) apartment_release(apt);
     message_state->params.handle = ClientRpcChannelBuffer_GetEventHandle(This);
@@ -1253,7 +1256,7 @@ static HRESULT WINAPI ClientRpcChannelBuffer_GetBuffer(LPRPCCHANNELBUFFER iface,
      * ClientRpcChannelBuffer_SendReceive */
 
     /* shortcut the RPC runtime */
-    if (message_state->target_hwnd)
+    if (message_state->params.bypass_rpcrt)
     {
         msg->Buffer = malloc(msg->BufferLength);
         if (msg->Buffer)
@@ -1344,6 +1347,28 @@ static DWORD WINAPI rpc_sendreceive_thread(LPVOID param)
     return 0;
 }
 
+/* this thread runs an incoming RPC to a multi-threaded apartment in the same
+ * process without involving the RPC runtime, like dispatch_rpc does for calls
+ * arriving from other processes */
+static DWORD WINAPI rpc_mta_dispatch_thread(LPVOID param)
+{
+    struct dispatch_params *params = param;
+    struct tlsdata *tlsdata;
+    BOOL joined = FALSE;
+
+    com_get_tlsdata(&tlsdata);
+    if (!tlsdata->apt)
+    {
+        enter_apartment(tlsdata, COINIT_MULTITHREADED);
+        joined = TRUE;
+    }
+    rpc_execute_call(params);
+    if (joined)
+        leave_apartment(tlsdata);
+
+    return 0;
+}
+
 static inline HRESULT ClientRpcChannelBuffer_IsCorrectApartment(ClientRpcChannelBuffer *This, const struct apartment *apt)
 {
     if (!apt)
@@ -1410,7 +1435,7 @@ static HRESULT WINAPI ClientRpcChannelBuffer_SendReceive(LPRPCCHANNELBUFFER ifac
      * from DllMain */
 
     message_state->params.msg = olemsg;
-    if (message_state->params.bypass_rpcrt)
+    if (message_state->params.bypass_rpcrt && message_state->target_hwnd)
     {
         TRACE("Calling apartment thread %#lx...\n", message_state->target_tid);
 
@@ -1427,6 +1452,18 @@ static HRESULT WINAPI ClientRpcChannelBuffer_SendReceive(LPRPCCHANNELBUFFER ifac
             hr = HRESULT_FROM_WIN32(GetLastError());
         }
     }
+    else if (message_state->params.bypass_rpcrt)
+    {
+        TRACE("Dispatching to multi-threaded apartment...\n");
+
+        msg->ProcNum &= ~RPC_FLAGS_VALID_BIT;
+
+        if (!QueueUserWorkItem(rpc_mta_dispatch_thread, &message_state->params, WT_EXECUTEDEFAULT))
+        {
+            ERR("QueueUserWorkItem failed with error %lu\n", GetLastError());
+            hr = E_UNEXPECTED;
+        }
+    }
     else
     {
         /* we use a separate thread here because we need to be able to
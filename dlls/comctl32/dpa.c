@@ -748,7 +748,7 @@ BOOL WINAPI DPA_DeleteAllPtrs (HDPA hdpa)
 /**************************************************************************
  * DPA_QuickSort [Internal]
  *
- * Ordinary quicksort (used by DPA_Sort).
+ * Stable merge sort (used by DPA_Sort).
  *
  * PARAMS
  *     lpPtrs     [I] pointer to the pointer array
@@ -756,12 +756,13 @@ BOOL WINAPI DPA_DeleteAllPtrs (HDPA hdpa)
  *     r          [I] index of the "right border" of the partition
  *     pfnCompare [I] pointer to the compare function
  *     lParam     [I] user defined value (3rd parameter in compare function)
+ *     scratch    [I] merge buffer of at least r - l + 1 entries, may be NULL
  *
  * RETURNS
  *     NONE
  */
 static VOID DPA_QuickSort (LPVOID *lpPtrs, INT l, INT r,
-                           PFNDPACOMPARE pfnCompare, LPARAM lParam)
+                           PFNDPACOMPARE pfnCompare, LPARAM lParam, LPVOID *scratch)
 {
     INT m;
     LPVOID t;
@@ -772,15 +773,32 @@ static VOID DPA_QuickSort (LPVOID *lpPtrs, INT l, INT r,
         return;
     if (r<l)     /* oops, got it in the wrong order */
         {
-        DPA_QuickSort(lpPtrs, r, l, pfnCompare, lParam);
+        DPA_QuickSort(lpPtrs, r, l, pfnCompare, lParam, scratch);
         return;
         }
     m = (l+r)/2; /* divide by two */
-    DPA_QuickSort(lpPtrs, l, m, pfnCompare, lParam);
-    DPA_QuickSort(lpPtrs, m+1, r, pfnCompare, lParam);
+    DPA_QuickSort(lpPtrs, l, m, pfnCompare, lParam, scratch);
+    DPA_QuickSort(lpPtrs, m+1, r, pfnCompare, lParam, scratch);
+
+    /* already ordered sides need no joining at all */
+    if (pfnCompare(lpPtrs[m], lpPtrs[m+1], lParam) <= 0)
+        return;
 
     /* join the two sides */
-    while( (l<=m) && (m<r) )
+    if (scratch)
+    {
+        INT i = l, j = m + 1, k = 0;
+
+        while (i <= m && j <= r)
+        {
+            if (pfnCompare(lpPtrs[i], lpPtrs[j], lParam) <= 0) scratch[k++] = lpPtrs[i++];
+            else scratch[k++] = lpPtrs[j++];
+        }
+        while (i <= m) scratch[k++] = lpPtrs[i++];
+        /* the remaining right side entries are already in place */
+        memcpy(&lpPtrs[l], scratch, k * sizeof(*lpPtrs));
+    }
+    else while( (l<=m) && (m<r) )
     {
         if(pfnCompare(lpPtrs[l],lpPtrs[m+1],lParam)>0)
         {
@@ -817,8 +835,12 @@ BOOL WINAPI DPA_Sort (HDPA hdpa, PFNDPACOMPARE pfnCompare, LPARAM lParam)
     TRACE("%p, %p, %#Ix\n", hdpa, pfnCompare, lParam);
 
     if ((hdpa->nItemCount > 1) && (hdpa->ptrs))
+    {
+        LPVOID *scratch = HeapAlloc (hdpa->hHeap, 0, hdpa->nItemCount * sizeof(*scratch));
         DPA_QuickSort (hdpa->ptrs, 0, hdpa->nItemCount - 1,
-                       pfnCompare, lParam);
+                       pfnCompare, lParam, scratch);
+        if (scratch) HeapFree (hdpa->hHeap, 0, scratch);
+    }
 
     return TRUE;
 }
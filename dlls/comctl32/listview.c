@@ -3232,6 +3232,19 @@ static inline BOOL ranges_contain(RANGES ranges, INT nItem)
     return DPA_Search(ranges->hdpa, &srchrng, 0, ranges_cmp, 0, DPAS_SORTED) != -1;
 }
 
+/* finds the first item at or after nItem contained in the ranges, or -1 */
+static INT ranges_nextitem(RANGES ranges, INT nItem)
+{
+    INT i;
+
+    for (i = 0; i < DPA_GetPtrCount(ranges->hdpa); i++)
+    {
+	RANGE *sel = DPA_GetPtr(ranges->hdpa, i);
+	if (nItem < sel->upper) return max(nItem, sel->lower);
+    }
+    return -1;
+}
+
 static INT ranges_itemcount(RANGES ranges)
 {
     INT i, count = 0;
@@ -7517,6 +7530,10 @@ static INT LISTVIEW_GetNextItem(const LISTVIEW_INFO *infoPtr, INT nItem, UINT uF
     {
       nItem++;
 
+      /* selection is kept in the ranges, jump to the next selected item */
+      if (uMask == LVIS_SELECTED && !(infoPtr->uCallbackMask & LVIS_SELECTED))
+        return ranges_nextitem(infoPtr->selectionRanges, nItem);
+
       /* search by index */
       for (i = nItem; i < infoPtr->nItemCount; i++)
       {
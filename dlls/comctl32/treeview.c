@@ -922,6 +922,7 @@ static void
 TREEVIEW_RecalculateVisibleOrder(TREEVIEW_INFO *infoPtr, TREEVIEW_ITEM *start)
 {
     TREEVIEW_ITEM *item;
+    LONG first_order = infoPtr->firstVisible ? infoPtr->firstVisible->visibleOrder : -1;
     int order;
 
     if (!start)
@@ -943,7 +944,12 @@ TREEVIEW_RecalculateVisibleOrder(TREEVIEW_INFO *infoPtr, TREEVIEW_ITEM *start)
 
     infoPtr->maxVisibleOrder = order;
 
-    for (item = infoPtr->root->firstChild; item != NULL;
+    /* the rects of the unchanged items before start only depend on the first
+     * visible item's order, so they can be kept when that hasn't changed */
+    if (!infoPtr->firstVisible || infoPtr->firstVisible->visibleOrder != first_order)
+	start = infoPtr->root->firstChild;
+
+    for (item = start; item != NULL;
 	 item = TREEVIEW_GetNextListItem(infoPtr, item))
     {
 	TREEVIEW_ComputeItemRect(infoPtr, item);
@@ -1396,8 +1402,8 @@ TREEVIEW_InsertItemT(TREEVIEW_INFO *infoPtr, const TVINSERTSTRUCTW *ptdi, BOOL i
     if (parentItem == infoPtr->root ||
         (ISVISIBLE(parentItem) && parentItem->state & TVIS_EXPANDED))
     {
-       TREEVIEW_ITEM *item;
        TREEVIEW_ITEM *prev = TREEVIEW_GetPrevListItem(infoPtr, newItem);
+       RECT rc;
 
        TREEVIEW_RecalculateVisibleOrder(infoPtr, prev);
        TREEVIEW_ComputeItemInternalMetrics(infoPtr, newItem);
@@ -1409,12 +1415,12 @@ TREEVIEW_InsertItemT(TREEVIEW_INFO *infoPtr, const TVINSERTSTRUCTW *ptdi, BOOL i
        TREEVIEW_UpdateScrollBars(infoPtr);
     /*
      * if the item was inserted in a visible part of the tree,
-     * invalidate it, as well as those after it
+     * invalidate it, as well as the client area below it, since
+     * all the following items shifted down
      */
-       for (item = newItem;
-            item != NULL;
-	    item = TREEVIEW_GetNextListItem(infoPtr, item))
-          TREEVIEW_Invalidate(infoPtr, item);
+       rc = newItem->rect;
+       rc.bottom = max(rc.bottom, infoPtr->clientHeight);
+       InvalidateRect(infoPtr->hwnd, &rc, TRUE);
     }
     else
     {
@@ -197,11 +197,183 @@ static CertificateChainEngine *get_chain_engine(HCERTCHAINENGINE handle, BOOL al
     return (CertificateChainEngine*)handle;
 }
 
+/* cache of built chain contexts, keyed by engine, end certificate and the
+ * parameters that affect the result.  Entries are only trusted for a short
+ * time so that store changes and revocation updates get picked up.
+ */
+
+struct cached_chain
+{
+    struct list             entry;
+    CertificateChainEngine *engine;
+    BYTE                    hash[20]; /* SHA1 of the end certificate */
+    DWORD                   flags;
+    BYTE                   *para;     /* serialized relevant chain parameters */
+    DWORD                   para_len;
+    FILETIME                time;     /* verification time the chain was built for */
+    ULONGLONG               created;  /* tick count when the entry was added */
+    PCCERT_CHAIN_CONTEXT    chain;
+};
+
+#define CHAIN_CACHE_MAX_ENTRIES 32
+#define CHAIN_CACHE_LIFETIME_MS 30000
+
+static struct list chain_cache = LIST_INIT(chain_cache);
+static unsigned int chain_cache_count;
+
+static CRITICAL_SECTION chain_cache_cs;
+static CRITICAL_SECTION_DEBUG chain_cache_cs_debug =
+{
+    0, 0, &chain_cache_cs,
+    { &chain_cache_cs_debug.ProcessLocksList, &chain_cache_cs_debug.ProcessLocksList },
+    0, 0, { (DWORD_PTR)(__FILE__ ": chain_cache_cs") }
+};
+static CRITICAL_SECTION chain_cache_cs = { &chain_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static void free_cached_chain(struct cached_chain *cache)
+{
+    list_remove(&cache->entry);
+    CertFreeCertificateChain(cache->chain);
+    CryptMemFree(cache->para);
+    CryptMemFree(cache);
+    chain_cache_count--;
+}
+
+static BOOL CRYPT_ChainParaCacheable(const CERT_CHAIN_PARA *para)
+{
+    /* issuance policy matching is rare enough not to be worth keying on */
+    if (para->cbSize >= sizeof(CERT_CHAIN_PARA) &&
+     para->RequestedIssuancePolicy.Usage.cUsageIdentifier)
+        return FALSE;
+    return TRUE;
+}
+
+/* flatten the requested usage for use as a cache key */
+static BYTE *CRYPT_SerializeChainPara(const CERT_CHAIN_PARA *para, DWORD *ret_len)
+{
+    const CERT_USAGE_MATCH *usage = &para->RequestedUsage;
+    DWORD i, len = sizeof(usage->dwType);
+    BYTE *buf, *p;
+
+    for (i = 0; i < usage->Usage.cUsageIdentifier; i++)
+        len += strlen(usage->Usage.rgpszUsageIdentifier[i]) + 1;
+    if ((buf = CryptMemAlloc(len)))
+    {
+        memcpy(buf, &usage->dwType, sizeof(usage->dwType));
+        p = buf + sizeof(usage->dwType);
+        for (i = 0; i < usage->Usage.cUsageIdentifier; i++)
+        {
+            len = strlen(usage->Usage.rgpszUsageIdentifier[i]) + 1;
+            memcpy(p, usage->Usage.rgpszUsageIdentifier[i], len);
+            p += len;
+        }
+        *ret_len = p - buf;
+    }
+    return buf;
+}
+
+/* how long a cached chain may be reused for a given request */
+static ULONGLONG CRYPT_ChainCacheLifetime(const CERT_CHAIN_PARA *para)
+{
+    ULONGLONG lifetime = CHAIN_CACHE_LIFETIME_MS;
+
+    if (para->cbSize >= sizeof(CERT_CHAIN_PARA) && para->fCheckRevocationFreshnessTime &&
+     para->dwRevocationFreshnessTime)
+        lifetime = min(lifetime, (ULONGLONG)para->dwRevocationFreshnessTime * 1000);
+    return lifetime;
+}
+
+static inline ULONGLONG filetime_to_ull(const FILETIME *ft)
+{
+    return ((ULONGLONG)ft->dwHighDateTime << 32) | ft->dwLowDateTime;
+}
+
+static PCCERT_CHAIN_CONTEXT CRYPT_FindCachedChain(CertificateChainEngine *engine,
+ PCCERT_CONTEXT cert, const FILETIME *time, const CERT_CHAIN_PARA *para, DWORD flags)
+{
+    PCCERT_CHAIN_CONTEXT ret = NULL;
+    struct cached_chain *cache, *next;
+    ULONGLONG now = GetTickCount64(), time_diff;
+    BYTE hash[20], *blob;
+    DWORD size = sizeof(hash), blob_len;
+
+    if (!CRYPT_ChainParaCacheable(para)) return NULL;
+    if (!CertGetCertificateContextProperty(cert, CERT_HASH_PROP_ID, hash, &size)) return NULL;
+    if (!(blob = CRYPT_SerializeChainPara(para, &blob_len))) return NULL;
+
+    EnterCriticalSection(&chain_cache_cs);
+    LIST_FOR_EACH_ENTRY_SAFE(cache, next, &chain_cache, struct cached_chain, entry)
+    {
+        if (now - cache->created > CHAIN_CACHE_LIFETIME_MS)
+        {
+            free_cached_chain(cache);
+            continue;
+        }
+        if (cache->engine != engine || cache->flags != flags) continue;
+        if (memcmp(cache->hash, hash, sizeof(hash))) continue;
+        if (cache->para_len != blob_len || memcmp(cache->para, blob, blob_len)) continue;
+        if (now - cache->created > CRYPT_ChainCacheLifetime(para)) continue;
+        /* only reuse a chain built for (nearly) the same verification time */
+        time_diff = filetime_to_ull(time) > filetime_to_ull(&cache->time) ?
+         filetime_to_ull(time) - filetime_to_ull(&cache->time) :
+         filetime_to_ull(&cache->time) - filetime_to_ull(time);
+        if (time_diff > (ULONGLONG)CHAIN_CACHE_LIFETIME_MS * 10000) continue;
+        ret = CertDuplicateCertificateChain(cache->chain);
+        list_remove(&cache->entry);
+        list_add_head(&chain_cache, &cache->entry);
+        break;
+    }
+    LeaveCriticalSection(&chain_cache_cs);
+    CryptMemFree(blob);
+    return ret;
+}
+
+static void CRYPT_CacheChain(CertificateChainEngine *engine, PCCERT_CONTEXT cert,
+ const FILETIME *time, const CERT_CHAIN_PARA *para, DWORD flags, PCCERT_CHAIN_CONTEXT chain)
+{
+    struct cached_chain *cache;
+    BYTE hash[20];
+    DWORD size = sizeof(hash);
+
+    if (!CRYPT_ChainParaCacheable(para)) return;
+    if (!CertGetCertificateContextProperty(cert, CERT_HASH_PROP_ID, hash, &size)) return;
+    if (!(cache = CryptMemAlloc(sizeof(*cache)))) return;
+    if (!(cache->para = CRYPT_SerializeChainPara(para, &cache->para_len)))
+    {
+        CryptMemFree(cache);
+        return;
+    }
+    cache->engine = engine;
+    memcpy(cache->hash, hash, sizeof(hash));
+    cache->flags = flags;
+    cache->time = *time;
+    cache->created = GetTickCount64();
+    cache->chain = CertDuplicateCertificateChain(chain);
+
+    EnterCriticalSection(&chain_cache_cs);
+    list_add_head(&chain_cache, &cache->entry);
+    if (++chain_cache_count > CHAIN_CACHE_MAX_ENTRIES)
+        free_cached_chain(LIST_ENTRY(list_tail(&chain_cache), struct cached_chain, entry));
+    LeaveCriticalSection(&chain_cache_cs);
+}
+
+/* remove cached chains built with the given engine, or all of them if NULL */
+static void CRYPT_RemoveCachedChains(const CertificateChainEngine *engine)
+{
+    struct cached_chain *cache, *next;
+
+    EnterCriticalSection(&chain_cache_cs);
+    LIST_FOR_EACH_ENTRY_SAFE(cache, next, &chain_cache, struct cached_chain, entry)
+        if (!engine || cache->engine == engine) free_cached_chain(cache);
+    LeaveCriticalSection(&chain_cache_cs);
+}
+
 static void free_chain_engine(CertificateChainEngine *engine)
 {
     if(!engine || InterlockedDecrement(&engine->ref))
         return;
 
+    CRYPT_RemoveCachedChains(engine);
     CertCloseStore(engine->hWorld, 0);
     CertCloseStore(engine->hRoot, 0);
     CryptMemFree(engine);
@@ -253,6 +425,7 @@ void WINAPI CertFreeCertificateChainEngine(HCERTCHAINENGINE hChainEngine)
 
 void default_chain_engine_free(void)
 {
+    CRYPT_RemoveCachedChains(NULL);
     free_chain_engine(default_cu_engine);
     free_chain_engine(default_lm_engine);
 }
@@ -2878,6 +3051,8 @@ BOOL WINAPI CertGetCertificateChain(HCERTCHAINENGINE hChainEngine,
     CertificateChainEngine *engine;
     BOOL ret;
     CertificateChain *chain = NULL;
+    PCCERT_CHAIN_CONTEXT cached;
+    FILETIME time;
 
     TRACE("(%p, %p, %s, %p, %p, %08lx, %p, %p)\n", hChainEngine, pCertContext,
      debugstr_filetime(pTime), hAdditionalStore, pChainPara, dwFlags,
@@ -2902,6 +3077,24 @@ BOOL WINAPI CertGetCertificateChain(HCERTCHAINENGINE hChainEngine,
 
     if (TRACE_ON(chain))
         dump_chain_para(pChainPara);
+
+    if (pTime)
+        time = *pTime;
+    else
+        GetSystemTimeAsFileTime(&time);
+    /* an additional store may hold anything, don't cache chains built with one */
+    if (!hAdditionalStore &&
+     (cached = CRYPT_FindCachedChain(engine, pCertContext, &time, pChainPara, dwFlags)))
+    {
+        TRACE_(chain)("cached, error status: %08lx\n",
+         cached->TrustStatus.dwErrorStatus);
+        if (ppChainContext)
+            *ppChainContext = cached;
+        else
+            CertFreeCertificateChain(cached);
+        return TRUE;
+    }
+
     /* FIXME: what about HCCE_LOCAL_MACHINE? */
     ret = CRYPT_BuildCandidateChainFromCert(engine, pCertContext, pTime,
      hAdditionalStore, dwFlags, &chain);
@@ -2930,6 +3123,9 @@ BOOL WINAPI CertGetCertificateChain(HCERTCHAINENGINE hChainEngine,
         CRYPT_CheckUsages(pChain, pChainPara);
         TRACE_(chain)("error status: %08lx\n",
          pChain->TrustStatus.dwErrorStatus);
+        if (!hAdditionalStore)
+            CRYPT_CacheChain(engine, pCertContext, &time, pChainPara, dwFlags,
+             pChain);
         if (ppChainContext)
             *ppChainContext = pChain;
         else
@@ -36,6 +36,7 @@
 #include "shlobj.h"
 
 #include "wine/debug.h"
+#include "wine/list.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(cryptnet);
 
@@ -1538,31 +1539,12 @@ static const char revocation_cache_signature[] = "Wine cached revocation";
 
 #define CACHED_CERT_HASH_SIZE 20
 
-static FILE *open_cached_revocation_file(const CERT_CONTEXT *cert, const CERT_REVOCATION_PARA *params,
-        const WCHAR *mode, int sharing)
+static void hash_cert_and_issuer(const CERT_CONTEXT *cert, const CERT_REVOCATION_PARA *params,
+        BYTE *hash_data)
 {
-    BYTE hash_data[CACHED_CERT_HASH_SIZE];
-    WCHAR path[MAX_PATH];
-    WCHAR *appdata_path;
-    DWORD len, i, size;
     HCRYPTPROV prov;
     HCRYPTHASH hash;
-    HRESULT hr;
-
-    if (FAILED(hr = SHGetKnownFolderPath(&FOLDERID_LocalAppDataLow, 0, NULL, &appdata_path)))
-    {
-        ERR("Failed to get LocalAppDataLow path, hr %#lx.\n", hr);
-        return NULL;
-    }
-
-    len = swprintf(path, ARRAY_SIZE(path), L"%s\\Microsoft\\CryptnetUrlCache\\Content\\", appdata_path);
-    CoTaskMemFree(appdata_path);
-
-    if (len + CACHED_CERT_HASH_SIZE * 2 * sizeof(WCHAR) > ARRAY_SIZE(path) - 1)
-    {
-        WARN("Hash length exceeds static buffer; not caching.\n");
-        return NULL;
-    }
+    DWORD size;
 
     CryptAcquireContextW(&prov, NULL, NULL, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT);
     CryptCreateHash(prov, CALG_SHA1, 0, 0, &hash);
@@ -1577,10 +1559,33 @@ static FILE *open_cached_revocation_file(const CERT_CONTEXT *cert, const CERT_RE
         size = 0;
         CryptHashData(hash, (BYTE *)&size, sizeof(size), 0);
     }
-    size = sizeof(hash_data);
+    size = CACHED_CERT_HASH_SIZE;
     CryptGetHashParam(hash, HP_HASHVAL, hash_data, &size, 0);
     CryptDestroyHash(hash);
     CryptReleaseContext(prov, 0);
+}
+
+static FILE *open_cached_revocation_file(const BYTE *hash_data, const WCHAR *mode, int sharing)
+{
+    WCHAR path[MAX_PATH];
+    WCHAR *appdata_path;
+    DWORD len, i;
+    HRESULT hr;
+
+    if (FAILED(hr = SHGetKnownFolderPath(&FOLDERID_LocalAppDataLow, 0, NULL, &appdata_path)))
+    {
+        ERR("Failed to get LocalAppDataLow path, hr %#lx.\n", hr);
+        return NULL;
+    }
+
+    len = swprintf(path, ARRAY_SIZE(path), L"%s\\Microsoft\\CryptnetUrlCache\\Content\\", appdata_path);
+    CoTaskMemFree(appdata_path);
+
+    if (len + CACHED_CERT_HASH_SIZE * 2 * sizeof(WCHAR) > ARRAY_SIZE(path) - 1)
+    {
+        WARN("Hash length exceeds static buffer; not caching.\n");
+        return NULL;
+    }
 
     SHCreateDirectoryExW(NULL, path, NULL);
 
@@ -1593,15 +1598,95 @@ static FILE *open_cached_revocation_file(const CERT_CONTEXT *cert, const CERT_RE
     return _wfsopen(path, mode, sharing);
 }
 
+/* In-memory copy of the on-disk cache, so that repeated chain builds in the
+ * same process don't go through CreateFile() for every certificate. */
+struct cached_revocation_status
+{
+    struct list entry;
+    BYTE hash[CACHED_CERT_HASH_SIZE];
+    FILETIME update_time;
+    DWORD error;
+    DWORD reason;
+};
+
+static struct list cached_revocation_statuses = LIST_INIT(cached_revocation_statuses);
+
+static CRITICAL_SECTION revocation_cache_cs;
+static CRITICAL_SECTION_DEBUG revocation_cache_cs_debug =
+{
+    0, 0, &revocation_cache_cs,
+    { &revocation_cache_cs_debug.ProcessLocksList, &revocation_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": revocation_cache_cs") }
+};
+static CRITICAL_SECTION revocation_cache_cs = { &revocation_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static BOOL find_cached_revocation_status_mem(const BYTE *hash, const FILETIME *time,
+        CERT_REVOCATION_STATUS *status)
+{
+    struct cached_revocation_status *cached;
+    BOOL ret = FALSE;
+
+    EnterCriticalSection(&revocation_cache_cs);
+    LIST_FOR_EACH_ENTRY(cached, &cached_revocation_statuses, struct cached_revocation_status, entry)
+    {
+        if (memcmp(cached->hash, hash, CACHED_CERT_HASH_SIZE)) continue;
+        if (CompareFileTime(time, &cached->update_time) <= 0)
+        {
+            status->dwError = cached->error;
+            if (cached->error == CERT_E_REVOKED)
+                status->dwReason = cached->reason;
+            TRACE("Using in-memory cached status %#lx, reason %#lx.\n", cached->error, cached->reason);
+            ret = TRUE;
+        }
+        break;
+    }
+    LeaveCriticalSection(&revocation_cache_cs);
+    return ret;
+}
+
+static void cache_revocation_status_mem(const BYTE *hash, const FILETIME *update_time,
+        const CERT_REVOCATION_STATUS *status)
+{
+    struct cached_revocation_status *cached;
+
+    EnterCriticalSection(&revocation_cache_cs);
+    LIST_FOR_EACH_ENTRY(cached, &cached_revocation_statuses, struct cached_revocation_status, entry)
+    {
+        if (!memcmp(cached->hash, hash, CACHED_CERT_HASH_SIZE))
+        {
+            cached->update_time = *update_time;
+            cached->error = status->dwError;
+            cached->reason = status->dwReason;
+            LeaveCriticalSection(&revocation_cache_cs);
+            return;
+        }
+    }
+    if ((cached = malloc(sizeof(*cached))))
+    {
+        memcpy(cached->hash, hash, CACHED_CERT_HASH_SIZE);
+        cached->update_time = *update_time;
+        cached->error = status->dwError;
+        cached->reason = status->dwReason;
+        list_add_head(&cached_revocation_statuses, &cached->entry);
+    }
+    LeaveCriticalSection(&revocation_cache_cs);
+}
+
 static BOOL find_cached_revocation_status(const CERT_CONTEXT *cert, const CERT_REVOCATION_PARA *params,
         const FILETIME *time, CERT_REVOCATION_STATUS *status)
 {
     char buffer[sizeof(revocation_cache_signature)];
+    BYTE hash[CACHED_CERT_HASH_SIZE];
     FILETIME update_time;
     FILE *file;
     int len;
 
-    if (!(file = open_cached_revocation_file(cert, params, L"rb", _SH_DENYWR)))
+    hash_cert_and_issuer(cert, params, hash);
+
+    if (find_cached_revocation_status_mem(hash, time, status))
+        return TRUE;
+
+    if (!(file = open_cached_revocation_file(hash, L"rb", _SH_DENYWR)))
         return FALSE;
 
     if ((len = fread(buffer, 1, sizeof(buffer), file)) != sizeof(buffer)
@@ -1639,6 +1724,9 @@ static BOOL find_cached_revocation_status(const CERT_CONTEXT *cert, const CERT_R
         fclose(file);
         return FALSE;
     }
+    fclose(file);
+
+    cache_revocation_status_mem(hash, &update_time, status);
 
     TRACE("Using cached status %#lx, reason %#lx.\n", status->dwError, status->dwReason);
     return TRUE;
@@ -1647,9 +1735,13 @@ static BOOL find_cached_revocation_status(const CERT_CONTEXT *cert, const CERT_R
 static void cache_revocation_status(const CERT_CONTEXT *cert, const CERT_REVOCATION_PARA *params,
         const FILETIME *time, const CERT_REVOCATION_STATUS *status)
 {
+    BYTE hash[CACHED_CERT_HASH_SIZE];
     FILE *file;
 
-    if (!(file = open_cached_revocation_file(cert, params, L"wb", _SH_DENYRW)))
+    hash_cert_and_issuer(cert, params, hash);
+    cache_revocation_status_mem(hash, time, status);
+
+    if (!(file = open_cached_revocation_file(hash, L"wb", _SH_DENYRW)))
         return;
     fwrite(revocation_cache_signature, 1, sizeof(revocation_cache_signature), file);
     fwrite(time, sizeof(*time), 1, file);
@@ -2184,6 +2276,41 @@ static DWORD verify_cert_revocation_from_aia_ext(const CRYPT_DATA_BLOB *value, c
     return error;
 }
 
+/* Check an OCSP response attached to the certificate context, as done with a
+ * response stapled to a TLS handshake.  This doesn't hit the network, so it is
+ * tried before the AIA and CRL distribution point URLs. */
+static DWORD verify_cert_revocation_from_stapled_response(const CERT_CONTEXT *cert, FILETIME *time,
+        const CERT_REVOCATION_PARA *params, FILETIME *next_update)
+{
+    DWORD size, error;
+    BYTE *response;
+
+    if (!params || !params->pIssuerCert) return CRYPT_E_NO_REVOCATION_CHECK;
+    if (!CertGetCertificateContextProperty(cert, CERT_OCSP_RESPONSE_PROP_ID, NULL, &size))
+        return CRYPT_E_NO_REVOCATION_CHECK;
+    if (!(response = CryptMemAlloc(size))) return ERROR_OUTOFMEMORY;
+    if (!CertGetCertificateContextProperty(cert, CERT_OCSP_RESPONSE_PROP_ID, response, &size))
+    {
+        CryptMemFree(response);
+        return CRYPT_E_NO_REVOCATION_CHECK;
+    }
+
+    TRACE("found a stapled OCSP response, size %lu\n", size);
+    error = handle_ocsp_response(cert->pCertInfo, params->pIssuerCert->pCertInfo, response, size, next_update);
+    CryptMemFree(response);
+
+    /* The stapled response may have been obtained a while ago; don't use it
+     * past its nextUpdate time. */
+    if ((error == ERROR_SUCCESS || error == CRYPT_E_REVOKED)
+        && (next_update->dwLowDateTime || next_update->dwHighDateTime)
+        && CompareFileTime(time, next_update) > 0)
+    {
+        TRACE("stapled response is out of date\n");
+        return CRYPT_E_NO_REVOCATION_CHECK;
+    }
+    return error;
+}
+
 static DWORD verify_cert_revocation_with_crl_offline(PCCERT_CONTEXT cert,
         const CRL_CONTEXT *crl, FILETIME *pTime, CERT_REVOCATION_STATUS *pRevStatus)
 {
@@ -2227,6 +2354,10 @@ static DWORD verify_cert_revocation(const CERT_CONTEXT *cert, FILETIME *pTime,
         }
     }
 
+    error = verify_cert_revocation_from_stapled_response(cert, pTime, pRevPara, &next_update);
+    TRACE("verify_cert_revocation_from_stapled_response() returned %08lx\n", error);
+    if (error == ERROR_SUCCESS || error == CRYPT_E_REVOKED) goto done;
+
     if ((ext = CertFindExtension(szOID_AUTHORITY_INFO_ACCESS, cert->pCertInfo->cExtension, cert->pCertInfo->rgExtension)))
     {
         error = verify_cert_revocation_from_aia_ext(&ext->Value, cert, pTime, dwFlags, pRevPara, pRevStatus,
@@ -221,6 +221,9 @@ struct d2d_device_context
     struct d2d_clip_stack clip_stack;
 
     struct d2d_indexed_objects vertex_buffers;
+
+    struct list glyph_run_cache;
+    size_t glyph_run_cache_size;
 };
 
 HRESULT d2d_d3d_create_render_target(struct d2d_device *device, IDXGISurface *surface, IUnknown *outer_unknown,
@@ -498,6 +501,21 @@ struct d2d_curve_outline_vertex
     D2D1_POINT_2F prev, next;
 };
 
+enum d2d_geometry_buffer
+{
+    D2D_GEOMETRY_BUFFER_FILL_IB,
+    D2D_GEOMETRY_BUFFER_FILL_VB,
+    D2D_GEOMETRY_BUFFER_FILL_BEZIER_VB,
+    D2D_GEOMETRY_BUFFER_FILL_ARC_VB,
+    D2D_GEOMETRY_BUFFER_OUTLINE_IB,
+    D2D_GEOMETRY_BUFFER_OUTLINE_VB,
+    D2D_GEOMETRY_BUFFER_OUTLINE_BEZIER_IB,
+    D2D_GEOMETRY_BUFFER_OUTLINE_BEZIER_VB,
+    D2D_GEOMETRY_BUFFER_OUTLINE_ARC_IB,
+    D2D_GEOMETRY_BUFFER_OUTLINE_ARC_VB,
+    D2D_GEOMETRY_BUFFER_COUNT,
+};
+
 struct d2d_geometry
 {
     ID2D1Geometry ID2D1Geometry_iface;
@@ -507,6 +525,12 @@ struct d2d_geometry
 
     D2D_MATRIX_3X2_F transform;
 
+    struct
+    {
+        ID3D11Device1 *device;     /* kept alive by the buffers, not referenced */
+        ID3D11Buffer *buffers[D2D_GEOMETRY_BUFFER_COUNT];
+    } buffer_cache;
+
     struct
     {
         D2D1_POINT_2F *vertices;
@@ -605,6 +629,9 @@ void d2d_transformed_geometry_init(struct d2d_geometry *geometry, ID2D1Factory *
         ID2D1Geometry *src_geometry, const D2D_MATRIX_3X2_F *transform);
 HRESULT d2d_geometry_group_init(struct d2d_geometry *geometry, ID2D1Factory *factory,
         D2D1_FILL_MODE fill_mode, ID2D1Geometry **src_geometries, unsigned int geometry_count);
+HRESULT d2d_geometry_get_buffer(struct d2d_geometry *geometry, ID3D11Device1 *device,
+        enum d2d_geometry_buffer buffer_idx, const void *data, unsigned int byte_width,
+        UINT bind_flags, ID3D11Buffer **buffer);
 struct d2d_geometry *unsafe_impl_from_ID2D1Geometry(ID2D1Geometry *iface);
 
 struct d2d_device
@@ -116,6 +116,186 @@ static void d2d_clip_stack_pop(struct d2d_clip_stack *stack)
     --stack->count;
 }
 
+/* Rasterizing a glyph run through IDWriteGlyphRunAnalysis and uploading the
+ * resulting alpha values dominates the cost of drawing text, and interactive
+ * applications tend to redraw the same runs every frame. Rasterized runs are
+ * cached on the device context, keyed by everything that affects the
+ * generated texture, with LRU eviction once the cache exceeds a fixed
+ * budget. */
+#define D2D_GLYPH_RUN_CACHE_LIMIT (4u << 20)
+
+struct d2d_glyph_run_cache_entry
+{
+    struct list entry;
+    size_t size;
+
+    IDWriteFontFace *font_face;
+    float font_em_size;
+    unsigned int glyph_count;
+    UINT16 *glyph_indices;
+    float *glyph_advances;
+    DWRITE_GLYPH_OFFSET *glyph_offsets;
+    BOOL is_sideways;
+    unsigned int bidi_level;
+    DWRITE_RENDERING_MODE rendering_mode;
+    DWRITE_MEASURING_MODE measuring_mode;
+    DWRITE_TEXT_ANTIALIAS_MODE antialias_mode;
+    D2D1_MATRIX_3X2_F m;
+    D2D1_POINT_2F baseline_origin;
+
+    RECT bounds;
+    ID2D1Bitmap *bitmap;        /* NULL if the run has no visible pixels. */
+};
+
+static void d2d_glyph_run_cache_entry_destroy(struct d2d_glyph_run_cache_entry *entry)
+{
+    if (entry->bitmap)
+        ID2D1Bitmap_Release(entry->bitmap);
+    IDWriteFontFace_Release(entry->font_face);
+    free(entry->glyph_offsets);
+    free(entry->glyph_advances);
+    free(entry->glyph_indices);
+    free(entry);
+}
+
+static void d2d_device_context_clear_glyph_run_cache(struct d2d_device_context *context)
+{
+    struct d2d_glyph_run_cache_entry *cache_entry, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE(cache_entry, next, &context->glyph_run_cache,
+            struct d2d_glyph_run_cache_entry, entry)
+    {
+        list_remove(&cache_entry->entry);
+        d2d_glyph_run_cache_entry_destroy(cache_entry);
+    }
+    context->glyph_run_cache_size = 0;
+}
+
+static BOOL d2d_glyph_run_cache_entry_matches(const struct d2d_glyph_run_cache_entry *cache_entry,
+        D2D1_POINT_2F baseline_origin, const DWRITE_GLYPH_RUN *glyph_run,
+        DWRITE_RENDERING_MODE rendering_mode, DWRITE_MEASURING_MODE measuring_mode,
+        DWRITE_TEXT_ANTIALIAS_MODE antialias_mode, const D2D1_MATRIX_3X2_F *m)
+{
+    if (cache_entry->font_face != glyph_run->fontFace
+            || cache_entry->font_em_size != glyph_run->fontEmSize
+            || cache_entry->glyph_count != glyph_run->glyphCount
+            || cache_entry->is_sideways != glyph_run->isSideways
+            || cache_entry->bidi_level != glyph_run->bidiLevel
+            || cache_entry->rendering_mode != rendering_mode
+            || cache_entry->measuring_mode != measuring_mode
+            || cache_entry->antialias_mode != antialias_mode)
+        return FALSE;
+
+    if (memcmp(&cache_entry->m, m, sizeof(*m))
+            || memcmp(&cache_entry->baseline_origin, &baseline_origin, sizeof(baseline_origin)))
+        return FALSE;
+
+    if (memcmp(cache_entry->glyph_indices, glyph_run->glyphIndices,
+            glyph_run->glyphCount * sizeof(*glyph_run->glyphIndices)))
+        return FALSE;
+    if (!cache_entry->glyph_advances != !glyph_run->glyphAdvances)
+        return FALSE;
+    if (glyph_run->glyphAdvances && memcmp(cache_entry->glyph_advances, glyph_run->glyphAdvances,
+            glyph_run->glyphCount * sizeof(*glyph_run->glyphAdvances)))
+        return FALSE;
+    if (!cache_entry->glyph_offsets != !glyph_run->glyphOffsets)
+        return FALSE;
+    if (glyph_run->glyphOffsets && memcmp(cache_entry->glyph_offsets, glyph_run->glyphOffsets,
+            glyph_run->glyphCount * sizeof(*glyph_run->glyphOffsets)))
+        return FALSE;
+
+    return TRUE;
+}
+
+static struct d2d_glyph_run_cache_entry *d2d_device_context_find_glyph_run(struct d2d_device_context *context,
+        D2D1_POINT_2F baseline_origin, const DWRITE_GLYPH_RUN *glyph_run,
+        DWRITE_RENDERING_MODE rendering_mode, DWRITE_MEASURING_MODE measuring_mode,
+        DWRITE_TEXT_ANTIALIAS_MODE antialias_mode, const D2D1_MATRIX_3X2_F *m)
+{
+    struct d2d_glyph_run_cache_entry *cache_entry;
+
+    LIST_FOR_EACH_ENTRY(cache_entry, &context->glyph_run_cache, struct d2d_glyph_run_cache_entry, entry)
+    {
+        if (d2d_glyph_run_cache_entry_matches(cache_entry, baseline_origin, glyph_run,
+                rendering_mode, measuring_mode, antialias_mode, m))
+        {
+            list_remove(&cache_entry->entry);
+            list_add_head(&context->glyph_run_cache, &cache_entry->entry);
+            return cache_entry;
+        }
+    }
+
+    return NULL;
+}
+
+static void d2d_device_context_cache_glyph_run(struct d2d_device_context *context,
+        D2D1_POINT_2F baseline_origin, const DWRITE_GLYPH_RUN *glyph_run,
+        DWRITE_RENDERING_MODE rendering_mode, DWRITE_MEASURING_MODE measuring_mode,
+        DWRITE_TEXT_ANTIALIAS_MODE antialias_mode, const D2D1_MATRIX_3X2_F *m,
+        const RECT *bounds, ID2D1Bitmap *bitmap, size_t texture_size)
+{
+    struct d2d_glyph_run_cache_entry *cache_entry;
+
+    if (!(cache_entry = calloc(1, sizeof(*cache_entry))))
+        return;
+
+    if (!(cache_entry->glyph_indices = malloc(glyph_run->glyphCount * sizeof(*cache_entry->glyph_indices))))
+        goto error;
+    memcpy(cache_entry->glyph_indices, glyph_run->glyphIndices,
+            glyph_run->glyphCount * sizeof(*cache_entry->glyph_indices));
+    if (glyph_run->glyphAdvances)
+    {
+        if (!(cache_entry->glyph_advances = malloc(glyph_run->glyphCount * sizeof(*cache_entry->glyph_advances))))
+            goto error;
+        memcpy(cache_entry->glyph_advances, glyph_run->glyphAdvances,
+                glyph_run->glyphCount * sizeof(*cache_entry->glyph_advances));
+    }
+    if (glyph_run->glyphOffsets)
+    {
+        if (!(cache_entry->glyph_offsets = malloc(glyph_run->glyphCount * sizeof(*cache_entry->glyph_offsets))))
+            goto error;
+        memcpy(cache_entry->glyph_offsets, glyph_run->glyphOffsets,
+                glyph_run->glyphCount * sizeof(*cache_entry->glyph_offsets));
+    }
+
+    cache_entry->font_face = glyph_run->fontFace;
+    IDWriteFontFace_AddRef(cache_entry->font_face);
+    cache_entry->font_em_size = glyph_run->fontEmSize;
+    cache_entry->glyph_count = glyph_run->glyphCount;
+    cache_entry->is_sideways = glyph_run->isSideways;
+    cache_entry->bidi_level = glyph_run->bidiLevel;
+    cache_entry->rendering_mode = rendering_mode;
+    cache_entry->measuring_mode = measuring_mode;
+    cache_entry->antialias_mode = antialias_mode;
+    cache_entry->m = *m;
+    cache_entry->baseline_origin = baseline_origin;
+    cache_entry->bounds = *bounds;
+    if ((cache_entry->bitmap = bitmap))
+        ID2D1Bitmap_AddRef(cache_entry->bitmap);
+    cache_entry->size = sizeof(*cache_entry) + texture_size + glyph_run->glyphCount
+            * (sizeof(*cache_entry->glyph_indices) + sizeof(*cache_entry->glyph_advances)
+            + sizeof(*cache_entry->glyph_offsets));
+
+    list_add_head(&context->glyph_run_cache, &cache_entry->entry);
+    context->glyph_run_cache_size += cache_entry->size;
+
+    while (context->glyph_run_cache_size > D2D_GLYPH_RUN_CACHE_LIMIT
+            && list_tail(&context->glyph_run_cache) != list_head(&context->glyph_run_cache))
+    {
+        cache_entry = LIST_ENTRY(list_tail(&context->glyph_run_cache),
+                struct d2d_glyph_run_cache_entry, entry);
+        list_remove(&cache_entry->entry);
+        context->glyph_run_cache_size -= cache_entry->size;
+        d2d_glyph_run_cache_entry_destroy(cache_entry);
+    }
+    return;
+
+error:
+    free(cache_entry->glyph_advances);
+    free(cache_entry->glyph_indices);
+    free(cache_entry);
+}
+
 static void d2d_device_context_draw(struct d2d_device_context *render_target, enum d2d_shape_type shape_type,
         ID3D11Buffer *ib, unsigned int index_count, ID3D11Buffer *vb, unsigned int vb_stride,
         struct d2d_brush *brush, struct d2d_brush *opacity_brush)
@@ -269,6 +449,7 @@ static ULONG STDMETHODCALLTYPE d2d_device_context_inner_Release(IUnknown *iface)
     {
         unsigned int i, j, k;
 
+        d2d_device_context_clear_glyph_run_cache(context);
         d2d_clip_stack_cleanup(&context->clip_stack);
         IDWriteRenderingParams_Release(context->default_text_rendering_params);
         if (context->text_rendering_params)
@@ -851,10 +1032,8 @@ static HRESULT d2d_device_context_update_vs_cb(struct d2d_device_context *contex
 }
 
 static void d2d_device_context_draw_geometry(struct d2d_device_context *render_target,
-        const struct d2d_geometry *geometry, struct d2d_brush *brush, float stroke_width)
+        struct d2d_geometry *geometry, struct d2d_brush *brush, float stroke_width)
 {
-    D3D11_SUBRESOURCE_DATA buffer_data;
-    D3D11_BUFFER_DESC buffer_desc;
     ID3D11Buffer *ib, *vb;
     HRESULT hr;
 
@@ -870,94 +1049,70 @@ static void d2d_device_context_draw_geometry(struct d2d_device_context *render_t
         return;
     }
 
-    buffer_desc.Usage = D3D11_USAGE_DEFAULT;
-    buffer_desc.CPUAccessFlags = 0;
-    buffer_desc.MiscFlags = 0;
-
-    buffer_data.SysMemPitch = 0;
-    buffer_data.SysMemSlicePitch = 0;
-
     if (geometry->outline.face_count)
     {
-        buffer_desc.ByteWidth = geometry->outline.face_count * sizeof(*geometry->outline.faces);
-        buffer_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-        buffer_data.pSysMem = geometry->outline.faces;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &ib)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device, D2D_GEOMETRY_BUFFER_OUTLINE_IB,
+                geometry->outline.faces, geometry->outline.face_count * sizeof(*geometry->outline.faces),
+                D3D11_BIND_INDEX_BUFFER, &ib)))
         {
             WARN("Failed to create index buffer, hr %#lx.\n", hr);
             return;
         }
 
-        buffer_desc.ByteWidth = geometry->outline.vertex_count * sizeof(*geometry->outline.vertices);
-        buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        buffer_data.pSysMem = geometry->outline.vertices;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &vb)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device, D2D_GEOMETRY_BUFFER_OUTLINE_VB,
+                geometry->outline.vertices, geometry->outline.vertex_count * sizeof(*geometry->outline.vertices),
+                D3D11_BIND_VERTEX_BUFFER, &vb)))
         {
             ERR("Failed to create vertex buffer, hr %#lx.\n", hr);
-            ID3D11Buffer_Release(ib);
             return;
         }
 
         d2d_device_context_draw(render_target, D2D_SHAPE_TYPE_OUTLINE, ib, 3 * geometry->outline.face_count, vb,
                 sizeof(*geometry->outline.vertices), brush, NULL);
-
-        ID3D11Buffer_Release(vb);
-        ID3D11Buffer_Release(ib);
     }
 
     if (geometry->outline.bezier_face_count)
     {
-        buffer_desc.ByteWidth = geometry->outline.bezier_face_count * sizeof(*geometry->outline.bezier_faces);
-        buffer_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-        buffer_data.pSysMem = geometry->outline.bezier_faces;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &ib)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device,
+                D2D_GEOMETRY_BUFFER_OUTLINE_BEZIER_IB, geometry->outline.bezier_faces,
+                geometry->outline.bezier_face_count * sizeof(*geometry->outline.bezier_faces),
+                D3D11_BIND_INDEX_BUFFER, &ib)))
         {
             WARN("Failed to create curves index buffer, hr %#lx.\n", hr);
             return;
         }
 
-        buffer_desc.ByteWidth = geometry->outline.bezier_count * sizeof(*geometry->outline.beziers);
-        buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        buffer_data.pSysMem = geometry->outline.beziers;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &vb)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device,
+                D2D_GEOMETRY_BUFFER_OUTLINE_BEZIER_VB, geometry->outline.beziers,
+                geometry->outline.bezier_count * sizeof(*geometry->outline.beziers),
+                D3D11_BIND_VERTEX_BUFFER, &vb)))
         {
             ERR("Failed to create curves vertex buffer, hr %#lx.\n", hr);
-            ID3D11Buffer_Release(ib);
             return;
         }
 
         d2d_device_context_draw(render_target, D2D_SHAPE_TYPE_BEZIER_OUTLINE, ib,
                 3 * geometry->outline.bezier_face_count, vb,
                 sizeof(*geometry->outline.beziers), brush, NULL);
-
-        ID3D11Buffer_Release(vb);
-        ID3D11Buffer_Release(ib);
     }
 
     if (geometry->outline.arc_face_count)
     {
-        buffer_desc.ByteWidth = geometry->outline.arc_face_count * sizeof(*geometry->outline.arc_faces);
-        buffer_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-        buffer_data.pSysMem = geometry->outline.arc_faces;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &ib)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device,
+                D2D_GEOMETRY_BUFFER_OUTLINE_ARC_IB, geometry->outline.arc_faces,
+                geometry->outline.arc_face_count * sizeof(*geometry->outline.arc_faces),
+                D3D11_BIND_INDEX_BUFFER, &ib)))
         {
             WARN("Failed to create arcs index buffer, hr %#lx.\n", hr);
             return;
         }
 
-        buffer_desc.ByteWidth = geometry->outline.arc_count * sizeof(*geometry->outline.arcs);
-        buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        buffer_data.pSysMem = geometry->outline.arcs;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &vb)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device,
+                D2D_GEOMETRY_BUFFER_OUTLINE_ARC_VB, geometry->outline.arcs,
+                geometry->outline.arc_count * sizeof(*geometry->outline.arcs),
+                D3D11_BIND_VERTEX_BUFFER, &vb)))
         {
             ERR("Failed to create arcs vertex buffer, hr %#lx.\n", hr);
-            ID3D11Buffer_Release(ib);
             return;
         }
 
@@ -965,16 +1120,13 @@ static void d2d_device_context_draw_geometry(struct d2d_device_context *render_t
             d2d_device_context_draw(render_target, D2D_SHAPE_TYPE_ARC_OUTLINE, ib,
                     3 * geometry->outline.arc_face_count, vb,
                     sizeof(*geometry->outline.arcs), brush, NULL);
-
-        ID3D11Buffer_Release(vb);
-        ID3D11Buffer_Release(ib);
     }
 }
 
 static void STDMETHODCALLTYPE d2d_device_context_DrawGeometry(ID2D1DeviceContext6 *iface,
         ID2D1Geometry *geometry, ID2D1Brush *brush, float stroke_width, ID2D1StrokeStyle *stroke_style)
 {
-    const struct d2d_geometry *geometry_impl = unsafe_impl_from_ID2D1Geometry(geometry);
+    struct d2d_geometry *geometry_impl = unsafe_impl_from_ID2D1Geometry(geometry);
     struct d2d_device_context *context = impl_from_ID2D1DeviceContext(iface);
     struct d2d_brush *brush_impl = unsafe_impl_from_ID2D1Brush(brush);
     struct d2d_stroke_style *stroke_style_impl = unsafe_impl_from_ID2D1StrokeStyle(stroke_style);
@@ -1011,20 +1163,11 @@ static void STDMETHODCALLTYPE d2d_device_context_DrawGeometry(ID2D1DeviceContext
 }
 
 static void d2d_device_context_fill_geometry(struct d2d_device_context *render_target,
-        const struct d2d_geometry *geometry, struct d2d_brush *brush, struct d2d_brush *opacity_brush)
+        struct d2d_geometry *geometry, struct d2d_brush *brush, struct d2d_brush *opacity_brush)
 {
-    D3D11_SUBRESOURCE_DATA buffer_data;
-    D3D11_BUFFER_DESC buffer_desc;
     ID3D11Buffer *ib, *vb;
     HRESULT hr;
 
-    buffer_desc.Usage = D3D11_USAGE_DEFAULT;
-    buffer_desc.CPUAccessFlags = 0;
-    buffer_desc.MiscFlags = 0;
-
-    buffer_data.SysMemPitch = 0;
-    buffer_data.SysMemSlicePitch = 0;
-
     if (FAILED(hr = d2d_device_context_update_vs_cb(render_target, &geometry->transform, 0.0f)))
     {
         WARN("Failed to update vs constant buffer, hr %#lx.\n", hr);
@@ -1039,41 +1182,32 @@ static void d2d_device_context_fill_geometry(struct d2d_device_context *render_t
 
     if (geometry->fill.face_count)
     {
-        buffer_desc.ByteWidth = geometry->fill.face_count * sizeof(*geometry->fill.faces);
-        buffer_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-        buffer_data.pSysMem = geometry->fill.faces;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &ib)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device, D2D_GEOMETRY_BUFFER_FILL_IB,
+                geometry->fill.faces, geometry->fill.face_count * sizeof(*geometry->fill.faces),
+                D3D11_BIND_INDEX_BUFFER, &ib)))
         {
             WARN("Failed to create index buffer, hr %#lx.\n", hr);
             return;
         }
 
-        buffer_desc.ByteWidth = geometry->fill.vertex_count * sizeof(*geometry->fill.vertices);
-        buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        buffer_data.pSysMem = geometry->fill.vertices;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &vb)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device, D2D_GEOMETRY_BUFFER_FILL_VB,
+                geometry->fill.vertices, geometry->fill.vertex_count * sizeof(*geometry->fill.vertices),
+                D3D11_BIND_VERTEX_BUFFER, &vb)))
         {
             ERR("Failed to create vertex buffer, hr %#lx.\n", hr);
-            ID3D11Buffer_Release(ib);
             return;
         }
 
         d2d_device_context_draw(render_target, D2D_SHAPE_TYPE_TRIANGLE, ib, 3 * geometry->fill.face_count, vb,
                 sizeof(*geometry->fill.vertices), brush, opacity_brush);
-
-        ID3D11Buffer_Release(vb);
-        ID3D11Buffer_Release(ib);
     }
 
     if (geometry->fill.bezier_vertex_count)
     {
-        buffer_desc.ByteWidth = geometry->fill.bezier_vertex_count * sizeof(*geometry->fill.bezier_vertices);
-        buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        buffer_data.pSysMem = geometry->fill.bezier_vertices;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &vb)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device,
+                D2D_GEOMETRY_BUFFER_FILL_BEZIER_VB, geometry->fill.bezier_vertices,
+                geometry->fill.bezier_vertex_count * sizeof(*geometry->fill.bezier_vertices),
+                D3D11_BIND_VERTEX_BUFFER, &vb)))
         {
             ERR("Failed to create curves vertex buffer, hr %#lx.\n", hr);
             return;
@@ -1081,17 +1215,14 @@ static void d2d_device_context_fill_geometry(struct d2d_device_context *render_t
 
         d2d_device_context_draw(render_target, D2D_SHAPE_TYPE_CURVE, NULL, geometry->fill.bezier_vertex_count, vb,
                 sizeof(*geometry->fill.bezier_vertices), brush, opacity_brush);
-
-        ID3D11Buffer_Release(vb);
     }
 
     if (geometry->fill.arc_vertex_count)
     {
-        buffer_desc.ByteWidth = geometry->fill.arc_vertex_count * sizeof(*geometry->fill.arc_vertices);
-        buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-        buffer_data.pSysMem = geometry->fill.arc_vertices;
-
-        if (FAILED(hr = ID3D11Device1_CreateBuffer(render_target->d3d_device, &buffer_desc, &buffer_data, &vb)))
+        if (FAILED(hr = d2d_geometry_get_buffer(geometry, render_target->d3d_device,
+                D2D_GEOMETRY_BUFFER_FILL_ARC_VB, geometry->fill.arc_vertices,
+                geometry->fill.arc_vertex_count * sizeof(*geometry->fill.arc_vertices),
+                D3D11_BIND_VERTEX_BUFFER, &vb)))
         {
             ERR("Failed to create arc vertex buffer, hr %#lx.\n", hr);
             return;
@@ -1100,15 +1231,13 @@ static void d2d_device_context_fill_geometry(struct d2d_device_context *render_t
         if (SUCCEEDED(d2d_device_context_update_ps_cb(render_target, brush, opacity_brush, FALSE, TRUE)))
             d2d_device_context_draw(render_target, D2D_SHAPE_TYPE_CURVE, NULL, geometry->fill.arc_vertex_count, vb,
                     sizeof(*geometry->fill.arc_vertices), brush, opacity_brush);
-
-        ID3D11Buffer_Release(vb);
     }
 }
 
 static void STDMETHODCALLTYPE d2d_device_context_FillGeometry(ID2D1DeviceContext6 *iface,
         ID2D1Geometry *geometry, ID2D1Brush *brush, ID2D1Brush *opacity_brush)
 {
-    const struct d2d_geometry *geometry_impl = unsafe_impl_from_ID2D1Geometry(geometry);
+    struct d2d_geometry *geometry_impl = unsafe_impl_from_ID2D1Geometry(geometry);
     struct d2d_brush *opacity_brush_impl = unsafe_impl_from_ID2D1Brush(opacity_brush);
     struct d2d_device_context *context = impl_from_ID2D1DeviceContext(iface);
     struct d2d_brush *brush_impl = unsafe_impl_from_ID2D1Brush(brush);
@@ -1399,55 +1528,38 @@ static void d2d_device_context_draw_glyph_run_outline(struct d2d_device_context
     ID2D1PathGeometry_Release(geometry);
 }
 
-static void d2d_device_context_draw_glyph_run_bitmap(struct d2d_device_context *context,
-        D2D1_POINT_2F baseline_origin, const DWRITE_GLYPH_RUN *glyph_run, ID2D1Brush *brush,
+static HRESULT d2d_device_context_rasterize_glyph_run(struct d2d_device_context *context,
+        D2D1_POINT_2F baseline_origin, const DWRITE_GLYPH_RUN *glyph_run,
         DWRITE_RENDERING_MODE rendering_mode, DWRITE_MEASURING_MODE measuring_mode,
-        DWRITE_TEXT_ANTIALIAS_MODE antialias_mode)
+        DWRITE_TEXT_ANTIALIAS_MODE antialias_mode, const D2D1_MATRIX_3X2_F *m,
+        RECT *bounds, ID2D1Bitmap **bitmap)
 {
-    ID2D1RectangleGeometry *geometry = NULL;
-    ID2D1BitmapBrush *opacity_brush = NULL;
     D2D1_BITMAP_PROPERTIES bitmap_desc;
-    ID2D1Bitmap *opacity_bitmap = NULL;
     IDWriteGlyphRunAnalysis *analysis;
     DWRITE_TEXTURE_TYPE texture_type;
-    D2D1_BRUSH_PROPERTIES brush_desc;
     IDWriteFactory2 *dwrite_factory;
-    D2D1_MATRIX_3X2_F *transform, m;
     void *opacity_values = NULL;
     size_t opacity_values_size;
     D2D1_SIZE_U bitmap_size;
-    float scale_x, scale_y;
-    D2D1_RECT_F run_rect;
-    RECT bounds;
     HRESULT hr;
 
+    *bitmap = NULL;
+
     if (FAILED(hr = DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED,
             &IID_IDWriteFactory2, (IUnknown **)&dwrite_factory)))
     {
         ERR("Failed to create dwrite factory, hr %#lx.\n", hr);
-        return;
+        return hr;
     }
 
-    transform = &context->drawing_state.transform;
-
-    scale_x = context->desc.dpiX / 96.0f;
-    m._11 = transform->_11 * scale_x;
-    m._21 = transform->_21 * scale_x;
-    m._31 = transform->_31 * scale_x;
-
-    scale_y = context->desc.dpiY / 96.0f;
-    m._12 = transform->_12 * scale_y;
-    m._22 = transform->_22 * scale_y;
-    m._32 = transform->_32 * scale_y;
-
-    hr = IDWriteFactory2_CreateGlyphRunAnalysis(dwrite_factory, glyph_run, (DWRITE_MATRIX *)&m,
+    hr = IDWriteFactory2_CreateGlyphRunAnalysis(dwrite_factory, glyph_run, (DWRITE_MATRIX *)m,
             rendering_mode, measuring_mode, DWRITE_GRID_FIT_MODE_DEFAULT, antialias_mode,
             baseline_origin.x, baseline_origin.y, &analysis);
     IDWriteFactory2_Release(dwrite_factory);
     if (FAILED(hr))
     {
         ERR("Failed to create glyph run analysis, hr %#lx.\n", hr);
-        return;
+        return hr;
     }
 
     if (rendering_mode == DWRITE_RENDERING_MODE_ALIASED || antialias_mode == DWRITE_TEXT_ANTIALIAS_MODE_GRAYSCALE)
@@ -1455,16 +1567,18 @@ static void d2d_device_context_draw_glyph_run_bitmap(struct d2d_device_context *
     else
         texture_type = DWRITE_TEXTURE_CLEARTYPE_3x1;
 
-    if (FAILED(hr = IDWriteGlyphRunAnalysis_GetAlphaTextureBounds(analysis, texture_type, &bounds)))
+    if (FAILED(hr = IDWriteGlyphRunAnalysis_GetAlphaTextureBounds(analysis, texture_type, bounds)))
     {
         ERR("Failed to get alpha texture bounds, hr %#lx.\n", hr);
         goto done;
     }
 
-    d2d_size_set(&bitmap_size, bounds.right - bounds.left, bounds.bottom - bounds.top);
+    d2d_size_set(&bitmap_size, bounds->right - bounds->left, bounds->bottom - bounds->top);
     if (!bitmap_size.width || !bitmap_size.height)
     {
         /* Empty run, nothing to do. */
+        d2d_device_context_cache_glyph_run(context, baseline_origin, glyph_run,
+                rendering_mode, measuring_mode, antialias_mode, m, bounds, NULL, 0);
         goto done;
     }
 
@@ -1473,12 +1587,13 @@ static void d2d_device_context_draw_glyph_run_bitmap(struct d2d_device_context *
     if (!(opacity_values = calloc(bitmap_size.height, bitmap_size.width)))
     {
         ERR("Failed to allocate opacity values.\n");
+        hr = E_OUTOFMEMORY;
         goto done;
     }
     opacity_values_size = bitmap_size.height * bitmap_size.width;
 
     if (FAILED(hr = IDWriteGlyphRunAnalysis_CreateAlphaTexture(analysis,
-            texture_type, &bounds, opacity_values, opacity_values_size)))
+            texture_type, bounds, opacity_values, opacity_values_size)))
     {
         ERR("Failed to create alpha texture, hr %#lx.\n", hr);
         goto done;
@@ -1491,12 +1606,68 @@ static void d2d_device_context_draw_glyph_run_bitmap(struct d2d_device_context *
         bitmap_desc.dpiX *= 3.0f;
     bitmap_desc.dpiY = context->desc.dpiY;
     if (FAILED(hr = d2d_device_context_CreateBitmap(&context->ID2D1DeviceContext6_iface,
-            bitmap_size, opacity_values, bitmap_size.width, &bitmap_desc, &opacity_bitmap)))
+            bitmap_size, opacity_values, bitmap_size.width, &bitmap_desc, bitmap)))
     {
         ERR("Failed to create opacity bitmap, hr %#lx.\n", hr);
         goto done;
     }
 
+    d2d_device_context_cache_glyph_run(context, baseline_origin, glyph_run,
+            rendering_mode, measuring_mode, antialias_mode, m, bounds, *bitmap, opacity_values_size);
+
+done:
+    free(opacity_values);
+    IDWriteGlyphRunAnalysis_Release(analysis);
+    return hr;
+}
+
+static void d2d_device_context_draw_glyph_run_bitmap(struct d2d_device_context *context,
+        D2D1_POINT_2F baseline_origin, const DWRITE_GLYPH_RUN *glyph_run, ID2D1Brush *brush,
+        DWRITE_RENDERING_MODE rendering_mode, DWRITE_MEASURING_MODE measuring_mode,
+        DWRITE_TEXT_ANTIALIAS_MODE antialias_mode)
+{
+    struct d2d_glyph_run_cache_entry *cache_entry;
+    ID2D1RectangleGeometry *geometry = NULL;
+    ID2D1BitmapBrush *opacity_brush = NULL;
+    ID2D1Bitmap *opacity_bitmap = NULL;
+    D2D1_BRUSH_PROPERTIES brush_desc;
+    D2D1_MATRIX_3X2_F *transform, m;
+    float scale_x, scale_y;
+    D2D1_RECT_F run_rect;
+    RECT bounds;
+    HRESULT hr;
+
+    transform = &context->drawing_state.transform;
+
+    scale_x = context->desc.dpiX / 96.0f;
+    m._11 = transform->_11 * scale_x;
+    m._21 = transform->_21 * scale_x;
+    m._31 = transform->_31 * scale_x;
+
+    scale_y = context->desc.dpiY / 96.0f;
+    m._12 = transform->_12 * scale_y;
+    m._22 = transform->_22 * scale_y;
+    m._32 = transform->_32 * scale_y;
+
+    if ((cache_entry = d2d_device_context_find_glyph_run(context, baseline_origin, glyph_run,
+            rendering_mode, measuring_mode, antialias_mode, &m)))
+    {
+        bounds = cache_entry->bounds;
+        if ((opacity_bitmap = cache_entry->bitmap))
+            ID2D1Bitmap_AddRef(opacity_bitmap);
+    }
+    else if (FAILED(d2d_device_context_rasterize_glyph_run(context, baseline_origin, glyph_run,
+            rendering_mode, measuring_mode, antialias_mode, &m, &bounds, &opacity_bitmap)))
+    {
+        return;
+    }
+
+    if (!opacity_bitmap)
+    {
+        /* Empty run, nothing to do. */
+        return;
+    }
+
     d2d_rect_set(&run_rect, bounds.left / scale_x, bounds.top / scale_y,
             bounds.right / scale_x, bounds.bottom / scale_y);
 
@@ -1531,10 +1702,7 @@ done:
         ID2D1RectangleGeometry_Release(geometry);
     if (opacity_brush)
         ID2D1BitmapBrush_Release(opacity_brush);
-    if (opacity_bitmap)
-        ID2D1Bitmap_Release(opacity_bitmap);
-    free(opacity_values);
-    IDWriteGlyphRunAnalysis_Release(analysis);
+    ID2D1Bitmap_Release(opacity_bitmap);
 }
 
 static void d2d_device_context_draw_glyph_run(struct d2d_device_context *context,
@@ -4055,6 +4223,7 @@ static HRESULT d2d_device_context_init(struct d2d_device_context *render_target,
     render_target->IDWriteTextRenderer_iface.lpVtbl = &d2d_text_renderer_vtbl;
     render_target->IUnknown_iface.lpVtbl = &d2d_device_context_inner_unknown_vtbl;
     render_target->refcount = 1;
+    list_init(&render_target->glyph_run_cache);
     ID2D1Device1_GetFactory((ID2D1Device1 *)&device->ID2D1Device6_iface, &render_target->factory);
     render_target->device = device;
     ID2D1Device6_AddRef(&render_target->device->ID2D1Device6_iface);
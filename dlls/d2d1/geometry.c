@@ -2716,8 +2716,59 @@ static BOOL d2d_geometry_fill_add_arc_triangle(struct d2d_geometry *geometry,
     return TRUE;
 }
 
+/* The tessellation data in a geometry is immutable once the geometry has been
+ * created, so the d3d buffers for it are cached here and repeated draws of the
+ * same geometry don't upload it again. The cache holds buffers for a single
+ * device; the buffers keep that device alive. */
+HRESULT d2d_geometry_get_buffer(struct d2d_geometry *geometry, ID3D11Device1 *device,
+        enum d2d_geometry_buffer buffer_idx, const void *data, unsigned int byte_width,
+        UINT bind_flags, ID3D11Buffer **buffer)
+{
+    D3D11_SUBRESOURCE_DATA buffer_data = {.pSysMem = data};
+    D3D11_BUFFER_DESC buffer_desc;
+    unsigned int i;
+    HRESULT hr;
+
+    if (geometry->buffer_cache.device != device)
+    {
+        for (i = 0; i < D2D_GEOMETRY_BUFFER_COUNT; ++i)
+        {
+            if (geometry->buffer_cache.buffers[i])
+            {
+                ID3D11Buffer_Release(geometry->buffer_cache.buffers[i]);
+                geometry->buffer_cache.buffers[i] = NULL;
+            }
+        }
+        geometry->buffer_cache.device = device;
+    }
+
+    if (!geometry->buffer_cache.buffers[buffer_idx])
+    {
+        buffer_desc.ByteWidth = byte_width;
+        buffer_desc.Usage = D3D11_USAGE_DEFAULT;
+        buffer_desc.BindFlags = bind_flags;
+        buffer_desc.CPUAccessFlags = 0;
+        buffer_desc.MiscFlags = 0;
+        buffer_desc.StructureByteStride = 0;
+
+        if (FAILED(hr = ID3D11Device1_CreateBuffer(device, &buffer_desc, &buffer_data,
+                &geometry->buffer_cache.buffers[buffer_idx])))
+            return hr;
+    }
+
+    *buffer = geometry->buffer_cache.buffers[buffer_idx];
+    return S_OK;
+}
+
 static void d2d_geometry_cleanup(struct d2d_geometry *geometry)
 {
+    unsigned int i;
+
+    for (i = 0; i < D2D_GEOMETRY_BUFFER_COUNT; ++i)
+    {
+        if (geometry->buffer_cache.buffers[i])
+            ID3D11Buffer_Release(geometry->buffer_cache.buffers[i]);
+    }
     free(geometry->outline.arc_faces);
     free(geometry->outline.arcs);
     free(geometry->outline.bezier_faces);
@@ -2589,6 +2589,21 @@ static void convert_argb_pixel(const uint8_t *src_ptr, const struct pixel_format
     }
 }
 
+/*
+ * Direct pixel copies only match the masked conversion when every bit of the
+ * pixel belongs to a channel; formats with undefined bits (e.g. X8R8G8B8)
+ * get those bits cleared by the conversion path.
+ */
+static BOOL format_direct_copyable(const struct pixel_format_desc *src_format,
+        const struct pixel_format_desc *dst_format)
+{
+    return src_format->format == dst_format->format
+            && !is_index_format(src_format) && !is_packed_format(src_format)
+            && src_format->bytes_per_pixel <= 4
+            && src_format->bits[0] + src_format->bits[1] + src_format->bits[2] + src_format->bits[3]
+            == src_format->bytes_per_pixel * 8;
+}
+
 /************************************************************
  * convert_argb_pixels
  *
@@ -2605,6 +2620,7 @@ static void convert_argb_pixels(const BYTE *src, UINT src_row_pitch, UINT src_sl
     const struct pixel_format_desc *ck_format = color_key ? get_format_info(D3DFMT_A8R8G8B8) : NULL;
     struct argb_conversion_info conv_info, ck_conv_info;
     UINT min_width, min_height, min_depth;
+    BOOL direct_copy;
     UINT x, y, z;
 
     TRACE("src %p, src_row_pitch %u, src_slice_pitch %u, src_size %p, src_format %p, dst %p, "
@@ -2621,6 +2637,8 @@ static void convert_argb_pixels(const BYTE *src, UINT src_row_pitch, UINT src_sl
     if (color_key)
         init_argb_conversion_info(src_format, ck_format, &ck_conv_info);
 
+    direct_copy = !color_key && format_direct_copyable(src_format, dst_format);
+
     for (z = 0; z < min_depth; z++) {
         const BYTE *src_slice_ptr = src + z * src_slice_pitch;
         BYTE *dst_slice_ptr = dst + z * dst_slice_pitch;
@@ -2629,7 +2647,12 @@ static void convert_argb_pixels(const BYTE *src, UINT src_row_pitch, UINT src_sl
             const BYTE *src_ptr = src_slice_ptr + y * src_row_pitch;
             BYTE *dst_ptr = dst_slice_ptr + y * dst_row_pitch;
 
-            for (x = 0; x < min_width; x++) {
+            if (direct_copy)
+            {
+                memcpy(dst_ptr, src_ptr, min_width * dst_format->bytes_per_pixel);
+                dst_ptr += min_width * dst_format->bytes_per_pixel;
+            }
+            else for (x = 0; x < min_width; x++) {
                 convert_argb_pixel(src_ptr, src_format, dst_ptr, dst_format, palette,
                         &conv_info, color_key, ck_format, &ck_conv_info);
 
@@ -2663,6 +2686,7 @@ static void point_filter_argb_pixels(const BYTE *src, UINT src_row_pitch, UINT s
     /* Color keys are always represented in D3DFMT_A8R8G8B8 format. */
     const struct pixel_format_desc *ck_format = color_key ? get_format_info(D3DFMT_A8R8G8B8) : NULL;
     struct argb_conversion_info conv_info, ck_conv_info;
+    BOOL direct_copy;
     UINT x, y, z;
 
     TRACE("src %p, src_row_pitch %u, src_slice_pitch %u, src_size %p, src_format %p, dst %p, "
@@ -2675,6 +2699,8 @@ static void point_filter_argb_pixels(const BYTE *src, UINT src_row_pitch, UINT s
     if (color_key)
         init_argb_conversion_info(src_format, ck_format, &ck_conv_info);
 
+    direct_copy = !color_key && format_direct_copyable(src_format, dst_format);
+
     for (z = 0; z < dst_size->depth; z++)
     {
         BYTE *dst_slice_ptr = dst + z * dst_slice_pitch;
@@ -2685,6 +2711,21 @@ static void point_filter_argb_pixels(const BYTE *src, UINT src_row_pitch, UINT s
             BYTE *dst_ptr = dst_slice_ptr + y * dst_row_pitch;
             const BYTE *src_row_ptr = src_slice_ptr + src_row_pitch * (y * src_size->height / dst_size->height);
 
+            if (direct_copy)
+            {
+                const UINT bpp = dst_format->bytes_per_pixel;
+
+                if (src_size->width == dst_size->width)
+                    memcpy(dst_ptr, src_row_ptr, dst_size->width * bpp);
+                else if (bpp == 4)
+                    for (x = 0; x < dst_size->width; x++)
+                        memcpy(dst_ptr + x * 4, src_row_ptr + (x * src_size->width / dst_size->width) * 4, 4);
+                else
+                    for (x = 0; x < dst_size->width; x++)
+                        memcpy(dst_ptr + x * bpp, src_row_ptr + (x * src_size->width / dst_size->width) * bpp, bpp);
+                continue;
+            }
+
             for (x = 0; x < dst_size->width; x++)
             {
                 const BYTE *src_ptr = src_row_ptr + (x * src_size->width / dst_size->width) * src_format->bytes_per_pixel;
@@ -349,6 +349,23 @@ static void storedxtencodedblock( GLubyte *blkaddr, GLubyte srccolors[4][4][4],
    }
 }
 
+static GLboolean issolidcolorblock( GLubyte srccolors[4][4][4], GLint numxpixels, GLint numypixels,
+                         GLboolean checkAlpha )
+{
+   GLint i, j;
+
+   for (j = 0; j < numypixels; j++) {
+      for (i = 0; i < numxpixels; i++) {
+         if (srccolors[j][i][0] != srccolors[0][0][0] ||
+             srccolors[j][i][1] != srccolors[0][0][1] ||
+             srccolors[j][i][2] != srccolors[0][0][2] ||
+             (checkAlpha && srccolors[j][i][3] != srccolors[0][0][3]))
+            return GL_FALSE;
+      }
+   }
+   return GL_TRUE;
+}
+
 static void encodedxtcolorblockfaster( GLubyte *blkaddr, GLubyte srccolors[4][4][4],
                          GLint numxpixels, GLint numypixels, GLuint type )
 {
@@ -366,6 +383,32 @@ static void encodedxtcolorblockfaster( GLubyte *blkaddr, GLubyte srccolors[4][4]
    GLuint lowcv, highcv, testcv;
    GLboolean haveAlpha = GL_FALSE;
 
+   /* Uniform blocks (flat textures, padded borders) are very common and don't
+      need the base color search: both base colors collapse to the same 565
+      value, and index 0 decodes to color0 with the 3-color and the 4-color
+      encoding alike. */
+   if (issolidcolorblock(srccolors, numxpixels, numypixels,
+                         type == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT)) {
+      GLushort color = (srccolors[0][0][0] & 0xf8) << 8 | (srccolors[0][0][1] & 0xfc) << 3 |
+                       srccolors[0][0][2] >> 3;
+      GLuint bits = 0;
+
+      if ((type == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT) && (srccolors[0][0][3] <= ALPHACUT)) {
+         /* with color0 == color1 index 3 decodes to transparent black */
+         color = 0;
+         bits = 0xffffffff;
+      }
+      *blkaddr++ = color & 0xff;
+      *blkaddr++ = color >> 8;
+      *blkaddr++ = color & 0xff;
+      *blkaddr++ = color >> 8;
+      *blkaddr++ = bits & 0xff;
+      *blkaddr++ = (bits >> 8) & 0xff;
+      *blkaddr++ = (bits >> 16) & 0xff;
+      *blkaddr = bits >> 24;
+      return;
+   }
+
    lowcv = highcv = srccolors[0][0][0] * srccolors[0][0][0] * REDWEIGHT +
                           srccolors[0][0][1] * srccolors[0][0][1] * GREENWEIGHT +
                           srccolors[0][0][2] * srccolors[0][0][2] * BLUEWEIGHT;
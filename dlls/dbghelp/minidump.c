@@ -777,6 +777,37 @@ static  unsigned        dump_threads_names(struct dump_context* dc)
     return sz;
 }
 
+/******************************************************************
+ *		dump_memory_chunks
+ *
+ * copies a range of the debuggee's memory to the current file position,
+ * using the supplied transfer buffer.  Reading a page at a time would mean
+ * one server round-trip per page, which dominates the dump time for large
+ * processes; when a large read fails (the range may be only partially
+ * accessible), fall back to small reads so that unreadable pages are
+ * skipped with the same granularity as before.
+ */
+static void dump_memory_chunks(struct dump_context* dc, char* buffer, unsigned buf_size,
+                               ULONG64 base, ULONG64 size)
+{
+    DWORD       written;
+    ULONG64     pos;
+    unsigned    len, slen, sub;
+
+    for (pos = 0; pos < size; pos += len)
+    {
+        len = min(size - pos, (ULONG64)buf_size);
+        if (read_process_memory(dc->process, base + pos, buffer, len))
+            WriteFile(dc->hFile, buffer, len, &written, NULL);
+        else for (sub = 0; sub < len; sub += 1024)
+        {
+            slen = min(len - sub, 1024);
+            if (read_process_memory(dc->process, base + pos + sub, buffer, slen))
+                WriteFile(dc->hFile, buffer, slen, &written, NULL);
+        }
+    }
+}
+
 /******************************************************************
  *		dump_memory_info
  *
@@ -786,10 +817,17 @@ static unsigned         dump_memory_info(struct dump_context* dc)
 {
     MINIDUMP_MEMORY_LIST        mdMemList;
     MINIDUMP_MEMORY_DESCRIPTOR  mdMem;
-    DWORD                       written;
-    unsigned                    i, pos, len, sz;
+    unsigned                    i, sz;
     RVA                         rva_base;
     char                        tmp[1024];
+    char*                       buffer;
+    unsigned                    buf_size = 1024 * 1024;
+
+    if (!(buffer = HeapAlloc(GetProcessHeap(), 0, buf_size)))
+    {
+        buffer = tmp;
+        buf_size = sizeof(tmp);
+    }
 
     mdMemList.NumberOfMemoryRanges = dc->num_mem;
     append(dc, &mdMemList.NumberOfMemoryRanges,
@@ -805,12 +843,7 @@ static unsigned         dump_memory_info(struct dump_context* dc)
         mdMem.Memory.Rva = dc->rva;
         mdMem.Memory.DataSize = dc->mem[i].size;
         SetFilePointer(dc->hFile, dc->rva, NULL, FILE_BEGIN);
-        for (pos = 0; pos < dc->mem[i].size; pos += sizeof(tmp))
-        {
-            len = min(dc->mem[i].size - pos, sizeof(tmp));
-            if (read_process_memory(dc->process, dc->mem[i].base + pos, tmp, len))
-                WriteFile(dc->hFile, tmp, len, &written, NULL);
-        }
+        dump_memory_chunks(dc, buffer, buf_size, dc->mem[i].base, dc->mem[i].size);
         dc->rva += mdMem.Memory.DataSize;
         writeat(dc, rva_base + i * sizeof(mdMem), &mdMem, sizeof(mdMem));
         if (dc->mem[i].rva)
@@ -819,6 +852,7 @@ static unsigned         dump_memory_info(struct dump_context* dc)
         }
     }
 
+    if (buffer != tmp) HeapFree(GetProcessHeap(), 0, buffer);
     return sz;
 }
 
@@ -831,13 +865,19 @@ static unsigned         dump_memory64_info(struct dump_context* dc)
 {
     MINIDUMP_MEMORY64_LIST          mdMem64List;
     MINIDUMP_MEMORY_DESCRIPTOR64    mdMem64;
-    DWORD                           written;
-    unsigned                        i, len, sz;
+    unsigned                        i, sz;
     RVA                             rva_base;
     char                            tmp[1024];
-    ULONG64                         pos;
+    char*                           buffer;
+    unsigned                        buf_size = 1024 * 1024;
     LARGE_INTEGER                   filepos;
 
+    if (!(buffer = HeapAlloc(GetProcessHeap(), 0, buf_size)))
+    {
+        buffer = tmp;
+        buf_size = sizeof(tmp);
+    }
+
     sz = sizeof(mdMem64List.NumberOfMemoryRanges) +
             sizeof(mdMem64List.BaseRva) +
             dc->num_mem64 * sizeof(mdMem64);
@@ -861,16 +901,12 @@ static unsigned         dump_memory64_info(struct dump_context* dc)
         mdMem64.StartOfMemoryRange = dc->mem64[i].base;
         mdMem64.DataSize = dc->mem64[i].size;
         SetFilePointerEx(dc->hFile, filepos, NULL, FILE_BEGIN);
-        for (pos = 0; pos < dc->mem64[i].size; pos += sizeof(tmp))
-        {
-            len = min(dc->mem64[i].size - pos, sizeof(tmp));
-            if (read_process_memory(dc->process, dc->mem64[i].base + pos, tmp, len))
-                WriteFile(dc->hFile, tmp, len, &written, NULL);
-        }
+        dump_memory_chunks(dc, buffer, buf_size, dc->mem64[i].base, dc->mem64[i].size);
         filepos.QuadPart += mdMem64.DataSize;
         writeat(dc, rva_base + i * sizeof(mdMem64), &mdMem64, sizeof(mdMem64));
     }
 
+    if (buffer != tmp) HeapFree(GetProcessHeap(), 0, buffer);
     return sz;
 }
 
@@ -335,9 +335,51 @@ void hash_table_destroy(struct hash_table* ht)
 #endif
 }
 
+/* Rehash into a larger bucket array once the chains get long, so that lookups
+ * in modules with millions of symbols don't degenerate into linear searches.
+ * The old bucket array stays in the pool, but with geometric growth the waste
+ * is bounded by a fraction of the final array.
+ * Walking the old buckets in order keeps elements of same name in insertion
+ * order, which hash_table_add guarantees.
+ */
+static void hash_table_grow(struct hash_table* ht)
+{
+    struct hash_table_bucket*   new_buckets;
+    struct hash_table_elt*      elt;
+    struct hash_table_elt*      next;
+    unsigned                    num_buckets = ht->num_buckets * 4;
+    unsigned                    i, hash;
+
+    new_buckets = pool_alloc(ht->pool, num_buckets * sizeof(struct hash_table_bucket));
+    if (!new_buckets) return;
+    memset(new_buckets, 0, num_buckets * sizeof(struct hash_table_bucket));
+
+    for (i = 0; i < ht->num_buckets; i++)
+    {
+        for (elt = ht->buckets[i].first; elt; elt = next)
+        {
+            next = elt->next;
+            hash = hash_table_hash(elt->name, num_buckets);
+            if (!new_buckets[hash].first)
+                new_buckets[hash].first = elt;
+            else
+                new_buckets[hash].last->next = elt;
+            new_buckets[hash].last = elt;
+            elt->next = NULL;
+        }
+    }
+    ht->buckets = new_buckets;
+    ht->num_buckets = num_buckets;
+}
+
 void hash_table_add(struct hash_table* ht, struct hash_table_elt* elt)
 {
-    unsigned                    hash = hash_table_hash(elt->name, ht->num_buckets);
+    unsigned                    hash;
+
+    if (ht->buckets && ht->num_elts >= 4 * ht->num_buckets)
+        hash_table_grow(ht);
+
+    hash = hash_table_hash(elt->name, ht->num_buckets);
 
     if (!ht->buckets)
     {
@@ -454,14 +454,14 @@ void queue_event( IDirectInputDevice8W *iface, int index, DWORD data, DWORD time
     if (!This->queue_len || This->overflow || !user_obj->dwType) return;
 
     next_pos = (This->queue_head + 1) % This->queue_len;
-    if (next_pos == This->queue_tail)
+    if (next_pos == ReadAcquire( &This->queue_tail ))
     {
         TRACE(" queue overflowed\n");
         This->overflow = TRUE;
         return;
     }
 
-    TRACE( " queueing %lu at offset %lu (queue head %u / size %u)\n", data, user_obj->dwOfs, This->queue_head, This->queue_len );
+    TRACE( " queueing %lu at offset %lu (queue head %ld / size %u)\n", data, user_obj->dwOfs, This->queue_head, This->queue_len );
 
     This->data_queue[This->queue_head].dwOfs       = user_obj->dwOfs;
     This->data_queue[This->queue_head].dwData      = data;
@@ -469,7 +469,8 @@ void queue_event( IDirectInputDevice8W *iface, int index, DWORD data, DWORD time
     This->data_queue[This->queue_head].dwSequence  = seq;
     This->data_queue[This->queue_head].uAppData    = properties->app_data;
 
-    This->queue_head = next_pos;
+    /* make sure the entry is filled in before the new head becomes visible */
+    WriteRelease( &This->queue_head, next_pos );
     /* Send event if asked */
 }
 
@@ -643,6 +644,7 @@ void dinput_device_internal_release( struct dinput_device *impl )
         dinput_device_release_user_format( impl );
 
         dinput_internal_release( impl->dinput );
+        DeleteCriticalSection( &impl->queue_crit );
         impl->crit.DebugInfo->Spare[0] = 0;
         DeleteCriticalSection( &impl->crit );
 
@@ -1337,11 +1339,15 @@ static HRESULT dinput_device_set_property( IDirectInputDevice8W *iface, const GU
         TRACE( "buffersize %lu\n", value->dwData );
 
         impl->buffersize = value->dwData;
+
+        /* lock out GetDeviceData while the queue is replaced */
+        EnterCriticalSection( &impl->queue_crit );
         impl->queue_len = min( impl->buffersize, 1024 );
         free( impl->data_queue );
 
         impl->data_queue = impl->queue_len ? malloc( impl->queue_len * sizeof(DIDEVICEOBJECTDATA) ) : NULL;
         impl->queue_head = impl->queue_tail = impl->overflow = 0;
+        LeaveCriticalSection( &impl->queue_crit );
         return DI_OK;
     }
     case (DWORD_PTR)DIPROP_APPDATA:
@@ -1523,9 +1529,9 @@ static HRESULT WINAPI dinput_device_GetDeviceData( IDirectInputDevice8W *iface,
     if (size < sizeof(DIDEVICEOBJECTDATA_DX3)) return DIERR_INVALIDPARAM;
 
     IDirectInputDevice2_Poll(iface);
-    EnterCriticalSection(&This->crit);
+    EnterCriticalSection(&This->queue_crit);
 
-    len = This->queue_head - This->queue_tail;
+    len = ReadAcquire( &This->queue_head ) - This->queue_tail;
     if (len < 0) len += This->queue_len;
 
     if ((*count != INFINITE) && (len > *count)) len = *count;
@@ -1547,11 +1553,11 @@ static HRESULT WINAPI dinput_device_GetDeviceData( IDirectInputDevice8W *iface,
     if (!(flags & DIGDD_PEEK))
     {
         /* Advance reading position */
-        This->queue_tail = (This->queue_tail + len) % This->queue_len;
+        WriteRelease( &This->queue_tail, (This->queue_tail + len) % This->queue_len );
         This->overflow = FALSE;
     }
 
-    LeaveCriticalSection(&This->crit);
+    LeaveCriticalSection(&This->queue_crit);
 
     TRACE( "Returning %lu events queued\n", *count );
     return ret;
@@ -2156,6 +2162,7 @@ void dinput_device_init( struct dinput_device *device, const struct dinput_devic
     device->autocenter = DIPROPAUTOCENTER_ON;
     device->force_feedback_state = DIGFFS_STOPPED | DIGFFS_EMPTY;
     InitializeCriticalSectionEx( &device->crit, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO );
+    InitializeCriticalSectionEx( &device->queue_crit, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO );
     dinput_internal_addref( (device->dinput = dinput) );
     device->vtbl = vtbl;
 
@@ -99,11 +99,16 @@ struct dinput_device
     BOOL                        use_raw_input; /* use raw input instead of low-level messages */
     HHOOK                       cbt_hook;    /* CBT hook to track foreground changes */
 
+    /* The event queue is a single-producer single-consumer ring: the input thread
+     * queues events under 'crit' while 'GetDeviceData' only takes 'queue_crit', so
+     * reading buffered data doesn't contend with the input thread. Head and tail
+     * are published with release semantics and read with acquire semantics. */
     LPDIDEVICEOBJECTDATA        data_queue;  /* buffer for 'GetDeviceData'.                 */
     int                         queue_len;   /* valid size of the queue                     */
-    int                         queue_head;  /* position to write new event into queue      */
-    int                         queue_tail;  /* next event to read from queue               */
-    BOOL                        overflow;    /* return DI_BUFFEROVERFLOW in 'GetDeviceData' */
+    LONG                        queue_head;  /* position to write new event into queue      */
+    LONG                        queue_tail;  /* next event to read from queue               */
+    LONG                        overflow;    /* return DI_BUFFEROVERFLOW in 'GetDeviceData' */
+    CRITICAL_SECTION            queue_crit;  /* serializes queue consumers and resizes      */
     DWORD                       buffersize;  /* size of the queue - set in 'SetProperty'    */
 
     DIDATAFORMAT device_format;
@@ -11,6 +11,7 @@
 @ stub DnsAsyncRegisterHostAddrs_W
 @ stub DnsAsyncRegisterInit
 @ stub DnsAsyncRegisterTerm
+@ stdcall DnsCancelQuery(ptr)
 @ stub DnsCheckNameCollision_A
 @ stub DnsCheckNameCollision_UTF8
 @ stub DnsCheckNameCollision_W
@@ -32,12 +32,143 @@
 #include "ip2string.h"
 
 #include "wine/debug.h"
+#include "wine/list.h"
 #include "dnsapi.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(dnsapi);
 
 #define DEFAULT_TTL  1200
 
+/* In-process query cache. Positive results are kept until the smallest TTL
+ * in the record set expires, name errors for NEGATIVE_CACHE_TTL seconds. */
+#define CACHE_MAX_ENTRIES   512
+#define NEGATIVE_CACHE_TTL  60
+
+struct cache_entry
+{
+    struct list entry;
+    char *name;
+    WORD type;
+    DNS_STATUS status;    /* ERROR_SUCCESS or the cached negative result */
+    DNS_RECORDA *records;
+    ULONGLONG inserted;   /* tick count when the entry was added */
+    ULONGLONG expiry;     /* tick count at which the entry lapses */
+};
+
+static struct list query_cache = LIST_INIT( query_cache );
+static unsigned int cache_entries;
+
+static CRITICAL_SECTION cache_cs;
+static CRITICAL_SECTION_DEBUG cache_cs_debug =
+{
+    0, 0, &cache_cs,
+    { &cache_cs_debug.ProcessLocksList, &cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": cache_cs") }
+};
+static CRITICAL_SECTION cache_cs = { &cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static void cache_entry_free( struct cache_entry *cache )
+{
+    DnsRecordListFree( (DNS_RECORD *)cache->records, DnsFreeRecordList );
+    free( cache->name );
+    free( cache );
+}
+
+static BOOL cache_get( const char *name, WORD type, DNS_STATUS *status, DNS_RECORDA **result )
+{
+    ULONGLONG now = GetTickCount64();
+    struct cache_entry *cache;
+    BOOL found = FALSE;
+
+    EnterCriticalSection( &cache_cs );
+    LIST_FOR_EACH_ENTRY( cache, &query_cache, struct cache_entry, entry )
+    {
+        if (cache->type != type || lstrcmpiA( cache->name, name )) continue;
+        if (cache->expiry <= now)
+        {
+            list_remove( &cache->entry );
+            cache_entries--;
+            cache_entry_free( cache );
+        }
+        else if (!cache->status)
+        {
+            DNS_RECORDA *rec, *copy = (DNS_RECORDA *)DnsRecordSetCopyEx( (DNS_RECORD *)cache->records,
+                                                                         DnsCharSetUtf8, DnsCharSetUtf8 );
+            if (copy)
+            {
+                ULONG elapsed = (now - cache->inserted) / 1000;
+
+                for (rec = copy; rec; rec = rec->pNext) rec->dwTtl -= min( rec->dwTtl, elapsed );
+                *result = copy;
+                *status = ERROR_SUCCESS;
+                found = TRUE;
+                list_remove( &cache->entry );
+                list_add_head( &query_cache, &cache->entry );
+            }
+        }
+        else
+        {
+            *status = cache->status;
+            found = TRUE;
+        }
+        break;
+    }
+    LeaveCriticalSection( &cache_cs );
+    return found;
+}
+
+static void cache_put( const char *name, WORD type, DNS_STATUS status, DNS_RECORDA *records )
+{
+    ULONG ttl = NEGATIVE_CACHE_TTL;
+    struct cache_entry *cache, *iter;
+    const DNS_RECORDA *rec;
+
+    if (!(cache = calloc( 1, sizeof(*cache) ))) return;
+    if (!(cache->name = strdup( name )))
+    {
+        free( cache );
+        return;
+    }
+    cache->type = type;
+    cache->status = status;
+    if (!status)
+    {
+        if (!(cache->records = (DNS_RECORDA *)DnsRecordSetCopyEx( (DNS_RECORD *)records,
+                                                                  DnsCharSetUtf8, DnsCharSetUtf8 )))
+        {
+            free( cache->name );
+            free( cache );
+            return;
+        }
+        ttl = ~0u;
+        for (rec = cache->records; rec; rec = rec->pNext) ttl = min( ttl, rec->dwTtl );
+    }
+    cache->inserted = GetTickCount64();
+    cache->expiry = cache->inserted + (ULONGLONG)ttl * 1000;
+
+    EnterCriticalSection( &cache_cs );
+    LIST_FOR_EACH_ENTRY( iter, &query_cache, struct cache_entry, entry )
+    {
+        if (iter->type == type && !lstrcmpiA( iter->name, name ))
+        {
+            list_remove( &iter->entry );
+            cache_entries--;
+            cache_entry_free( iter );
+            break;
+        }
+    }
+    if (cache_entries == CACHE_MAX_ENTRIES)
+    {
+        iter = LIST_ENTRY( list_tail( &query_cache ), struct cache_entry, entry );
+        list_remove( &iter->entry );
+        cache_entries--;
+        cache_entry_free( iter );
+    }
+    list_add_head( &query_cache, &cache->entry );
+    cache_entries++;
+    LeaveCriticalSection( &cache_cs );
+}
+
 static DNS_STATUS do_query_netbios( PCSTR name, DNS_RECORDA **recp )
 {
     NCB ncb;
@@ -118,14 +249,118 @@ static const char *debugstr_query_request(const DNS_QUERY_REQUEST *req)
             req->pQueryCompletionCallback, req->pQueryContext);
 }
 
+struct async_query
+{
+    LONG ref;
+    LONG cancelled;
+    WCHAR *name;
+    WORD type;
+    ULONG64 options;
+    DNS_QUERY_RESULT *result;
+    PDNS_QUERY_COMPLETION_ROUTINE callback;
+    void *context;
+};
+
+static void async_query_release( struct async_query *query )
+{
+    if (InterlockedDecrement( &query->ref )) return;
+    free( query->name );
+    free( query );
+}
+
+static void CALLBACK async_query_proc( TP_CALLBACK_INSTANCE *instance, void *ctx )
+{
+    struct async_query *query = ctx;
+    DNS_QUERY_RESULT *result = query->result;
+
+    result->pQueryRecords = NULL;
+    result->QueryStatus = DnsQuery_W( query->name, query->type, query->options, NULL,
+                                      (DNS_RECORDW **)&result->pQueryRecords, NULL );
+    if (InterlockedCompareExchange( &query->cancelled, 0, 0 ))
+    {
+        DnsRecordListFree( result->pQueryRecords, DnsFreeRecordList );
+        result->pQueryRecords = NULL;
+        result->QueryStatus = ERROR_CANCELLED;
+    }
+    query->callback( query->context, result );
+    async_query_release( query );
+}
+
 /******************************************************************************
  * DnsQueryEx           [DNSAPI.@]
  *
  */
 DNS_STATUS WINAPI DnsQueryEx(DNS_QUERY_REQUEST *request, DNS_QUERY_RESULT *result, DNS_QUERY_CANCEL *cancel)
 {
-    FIXME("(%s, %p, %p)\n", debugstr_query_request(request), result, cancel);
-    return DNS_ERROR_RCODE_NOT_IMPLEMENTED;
+    struct async_query *query;
+
+    TRACE("(%s, %p, %p)\n", debugstr_query_request(request), result, cancel);
+
+    if (!request || !result) return ERROR_INVALID_PARAMETER;
+    if (request->Version != DNS_QUERY_REQUEST_VERSION1 || result->Version != DNS_QUERY_RESULTS_VERSION1)
+        return ERROR_INVALID_PARAMETER;
+    if (!request->QueryName)
+    {
+        FIXME("local name queries not supported\n");
+        return DNS_ERROR_RCODE_NOT_IMPLEMENTED;
+    }
+    if (request->pDnsServerList) FIXME("custom server list ignored\n");
+    if (request->InterfaceIndex) FIXME("interface index %lu ignored\n", request->InterfaceIndex);
+
+    result->pQueryRecords = NULL;
+
+    if (!request->pQueryCompletionCallback)
+    {
+        result->QueryStatus = DnsQuery_W( request->QueryName, request->QueryType, request->QueryOptions,
+                                          NULL, (DNS_RECORDW **)&result->pQueryRecords, NULL );
+        return result->QueryStatus;
+    }
+
+    if (!(query = calloc( 1, sizeof(*query) ))) return ERROR_NOT_ENOUGH_MEMORY;
+    query->ref      = cancel ? 2 : 1;
+    query->name     = wcsdup( request->QueryName );
+    query->type     = request->QueryType;
+    query->options  = request->QueryOptions;
+    query->result   = result;
+    query->callback = request->pQueryCompletionCallback;
+    query->context  = request->pQueryContext;
+    if (!query->name)
+    {
+        free( query );
+        return ERROR_NOT_ENOUGH_MEMORY;
+    }
+
+    if (cancel) *(struct async_query **)cancel->Reserved = query;
+
+    if (!TrySubmitThreadpoolCallback( async_query_proc, query, NULL ))
+    {
+        DNS_STATUS ret = GetLastError();
+
+        if (cancel) *(struct async_query **)cancel->Reserved = NULL;
+        free( query->name );
+        free( query );
+        return ret;
+    }
+    return DNS_REQUEST_PENDING;
+}
+
+/******************************************************************************
+ * DnsCancelQuery           [DNSAPI.@]
+ *
+ */
+DNS_STATUS WINAPI DnsCancelQuery(DNS_QUERY_CANCEL *cancel)
+{
+    struct async_query *query;
+
+    TRACE("(%p)\n", cancel);
+
+    if (!cancel || !(query = *(struct async_query **)cancel->Reserved))
+        return ERROR_INVALID_PARAMETER;
+
+    *(struct async_query **)cancel->Reserved = NULL;
+    InterlockedExchange( &query->cancelled, TRUE );
+    async_query_release( query );
+    return ERROR_SUCCESS;
 }
 
 /******************************************************************************
@@ -175,6 +410,7 @@ DNS_STATUS WINAPI DnsQuery_UTF8( const char *name, WORD type, DWORD options, voi
     DWORD len = sizeof(answer);
     struct query_params query_params = { name, type, options, answer, &len };
     const char *end;
+    BOOL cacheable;
 
     TRACE( "(%s, %s, %#lx, %p, %p, %p)\n", debugstr_a(name), debugstr_type( type ),
            options, servers, result, reserved );
@@ -182,6 +418,8 @@ DNS_STATUS WINAPI DnsQuery_UTF8( const char *name, WORD type, DWORD options, voi
     if (!name || !result)
         return ERROR_INVALID_PARAMETER;
 
+    cacheable = !servers && !(options & (DNS_QUERY_BYPASS_CACHE | DNS_QUERY_WIRE_ONLY));
+
     if (type == DNS_TYPE_A)
     {
         struct in_addr addr;
@@ -219,6 +457,9 @@ DNS_STATUS WINAPI DnsQuery_UTF8( const char *name, WORD type, DWORD options, voi
         }
     }
 
+    if (cacheable && cache_get( name, type, &ret, result )) return ret;
+    if (options & DNS_QUERY_NO_WIRE_QUERY) return DNS_ERROR_RECORD_DOES_NOT_EXIST;
+
     if ((ret = RESOLV_CALL( set_serverlist, servers ))) return ret;
 
     ret = RESOLV_CALL( query, &query_params );
@@ -252,6 +493,9 @@ DNS_STATUS WINAPI DnsQuery_UTF8( const char *name, WORD type, DWORD options, voi
         ret = do_query_netbios( name, result );
     }
 
+    if (cacheable && (ret == ERROR_SUCCESS || ret == DNS_ERROR_RCODE_NAME_ERROR))
+        cache_put( name, type, ret, ret ? NULL : *result );
+
     return ret;
 }
 
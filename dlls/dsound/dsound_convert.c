@@ -328,6 +328,44 @@ void mixieee32(float *src, float *dst, unsigned samples)
         *(dst++) += *(src++);
 }
 
+/* Convert a contiguous run of interleaved samples to float in a single
+ * format-specific loop the compiler can vectorize, instead of one indirect
+ * get call per sample.  Only valid when no channel conversion is involved,
+ * i.e. when the buffer uses the plain format accessor.
+ */
+void convertieee32(const IDirectSoundBufferImpl *dsb, const BYTE *src, float *dst, unsigned samples)
+{
+    unsigned i;
+
+    if (dsb->get_aux == getieee32)
+        memcpy(dst, src, samples * sizeof(float));
+    else if (dsb->get_aux == get16)
+    {
+        const SHORT *sbuf = (const SHORT *)src;
+        for (i = 0; i < samples; i++)
+            dst[i] = (SHORT)le16(sbuf[i]) / (float)0x8000;
+    }
+    else if (dsb->get_aux == get8)
+    {
+        for (i = 0; i < samples; i++)
+            dst[i] = (src[i] - 0x80) / (float)0x80;
+    }
+    else if (dsb->get_aux == get32)
+    {
+        const LONG *sbuf = (const LONG *)src;
+        for (i = 0; i < samples; i++)
+            dst[i] = (LONG)le32(sbuf[i]) / (float)0x80000000U;
+    }
+    else /* get24 */
+    {
+        for (i = 0; i < samples; i++)
+        {
+            LONG sample = (src[3 * i] << 8) | (src[3 * i + 1] << 16) | (src[3 * i + 2] << 24);
+            dst[i] = sample / (float)0x80000000U;
+        }
+    }
+}
+
 static void norm8(float *src, unsigned char *dst, unsigned samples)
 {
     TRACE("%p - %p %d\n", src, dst, samples);
@@ -285,6 +285,55 @@ static inline float get_current_sample(const IDirectSoundBufferImpl *dsb,
     return dsb->get(dsb, buffer + (mixpos % buflen), channel);
 }
 
+/* Fast path for the common case where no channel conversion is needed:
+ * convert whole contiguous runs of frames with one flat loop per format
+ * instead of an indirect get/put call per sample.  Returns FALSE when the
+ * buffer needs the generic path.
+ */
+static BOOL cp_fields_noresample_flat(IDirectSoundBufferImpl *dsb, UINT count)
+{
+    UINT istride = dsb->pwfx->nBlockAlign;
+    UINT channels = dsb->device->pwfx->nChannels;
+    float *out = dsb->device->tmp_buffer;
+    UINT i = 0;
+
+    if (dsb->get != dsb->get_aux || dsb->put != putieee32)
+        return FALSE;
+    if (dsb->mix_channels != channels || dsb->buflen % istride)
+        return FALSE;
+
+    if (dsb->use_committed)
+    {
+        UINT committed_samples = (dsb->writelead - dsb->committed_mixpos) / istride;
+
+        i = min(committed_samples, count);
+        convertieee32(dsb, dsb->committedbuff + dsb->committed_mixpos, out, i * channels);
+    }
+
+    while (i < count)
+    {
+        DWORD mixpos = dsb->sec_mixpos + i * istride;
+        UINT chunk;
+
+        if (mixpos >= dsb->buflen)
+        {
+            if (!(dsb->playflags & DSBPLAY_LOOPING))
+            {
+                memset(out + i * channels, 0, (count - i) * channels * sizeof(float));
+                break;
+            }
+            mixpos %= dsb->buflen;
+        }
+        /* a misaligned mix position would make the chunk empty, use the generic path */
+        if (!(chunk = min(count - i, (dsb->buflen - mixpos) / istride)))
+            return FALSE;
+        convertieee32(dsb, dsb->buffer->memory + mixpos, out + i * channels, chunk * channels);
+        i += chunk;
+    }
+
+    return TRUE;
+}
+
 static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
 {
     UINT istride = dsb->pwfx->nBlockAlign;
@@ -295,6 +344,9 @@ static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
     if (!secondarybuffer_is_audible(dsb))
         return count;
 
+    if (cp_fields_noresample_flat(dsb, count))
+        return count;
+
     if(dsb->use_committed) {
         committed_samples = (dsb->writelead - dsb->committed_mixpos) / istride;
         committed_samples = committed_samples <= count ? committed_samples : count;
@@ -33,7 +33,6 @@ extern const unsigned short wine_scripts_table[];
 extern const unsigned short bidi_direction_table[];
 
 /* Number of characters needed for LOCALE_SNATIVEDIGITS */
-#define NATIVE_DIGITS_LEN 11
 
 struct dwritescript_properties
 {
@@ -1530,6 +1529,7 @@ static HRESULT WINAPI dwritetextanalyzer_GetGlyphs(IDWriteTextAnalyzer2 *iface,
 {
     const struct dwritescript_properties *scriptprops;
     struct scriptshaping_context context = { 0 };
+    struct shaped_run_desc run_desc;
     struct dwrite_fontface *font_obj;
     WCHAR digits[NATIVE_DIGITS_LEN];
     unsigned int glyph_count;
@@ -1546,8 +1546,27 @@ static HRESULT WINAPI dwritetextanalyzer_GetGlyphs(IDWriteTextAnalyzer2 *iface,
     font_obj = unsafe_impl_from_IDWriteFontFace(fontface);
     glyph_count = max(max_glyph_count, length);
 
+    run_desc.text = text;
+    run_desc.length = length;
+    run_desc.script = analysis->script > Script_LastId ? Script_Unknown : analysis->script;
+    run_desc.language_tag = get_opentype_language(locale);
+    run_desc.is_rtl = is_rtl;
+    run_desc.is_sideways = is_sideways;
+    run_desc.digits = digits;
+
+    *actual_glyph_count = 0;
+
+    /* User features are rare enough to not bother including them in the cache key. */
+    if (!features)
+    {
+        hr = fontface_get_shaped_run(font_obj, &run_desc, max_glyph_count, clustermap, text_props,
+                glyphs, glyph_props, actual_glyph_count);
+        if (hr != S_FALSE)
+            return hr;
+    }
+
     context.cache = fontface_get_shaping_cache(font_obj);
-    context.script = analysis->script > Script_LastId ? Script_Unknown : analysis->script;
+    context.script = run_desc.script;
     context.text = text;
     context.length = length;
     context.is_rtl = is_rtl;
@@ -1559,15 +1578,13 @@ static HRESULT WINAPI dwritetextanalyzer_GetGlyphs(IDWriteTextAnalyzer2 *iface,
     context.u.subst.max_glyph_count = max_glyph_count;
     context.u.subst.capacity = glyph_count;
     context.u.subst.digits = digits;
-    context.language_tag = get_opentype_language(locale);
+    context.language_tag = run_desc.language_tag;
     context.user_features.features = features;
     context.user_features.range_lengths = feature_range_lengths;
     context.user_features.range_count = feature_ranges;
     context.glyph_infos = calloc(glyph_count, sizeof(*context.glyph_infos));
     context.table = &context.cache->gsub;
 
-    *actual_glyph_count = 0;
-
     if (!context.u.subst.glyphs || !context.u.subst.glyph_props || !context.glyph_infos)
     {
         hr = E_OUTOFMEMORY;
@@ -1581,6 +1598,10 @@ static HRESULT WINAPI dwritetextanalyzer_GetGlyphs(IDWriteTextAnalyzer2 *iface,
         *actual_glyph_count = context.glyph_count;
         memcpy(glyphs, context.u.subst.glyphs, context.glyph_count * sizeof(*glyphs));
         memcpy(glyph_props, context.u.subst.glyph_props, context.glyph_count * sizeof(*glyph_props));
+
+        if (!features)
+            fontface_cache_shaped_run(font_obj, &run_desc, context.glyph_count, clustermap, text_props,
+                    glyphs, glyph_props);
     }
 
 failed:
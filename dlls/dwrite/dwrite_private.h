@@ -275,6 +275,8 @@ struct dwrite_fontface
         struct list mru;
         size_t max_size;
         size_t size;
+        struct list shaped_mru;
+        size_t shaped_count;
     } cache;
     CRITICAL_SECTION cs;
 
@@ -815,6 +817,27 @@ extern struct scriptshaping_cache *create_scriptshaping_cache(void *context,
 extern void release_scriptshaping_cache(struct scriptshaping_cache*);
 extern struct scriptshaping_cache *fontface_get_shaping_cache(struct dwrite_fontface *fontface);
 
+#define NATIVE_DIGITS_LEN 11
+
+/* Everything shaping results depend on, apart from the font face itself. */
+struct shaped_run_desc
+{
+    const WCHAR *text;
+    unsigned int length;
+    unsigned int script;
+    UINT32 language_tag;
+    BOOL is_rtl;
+    BOOL is_sideways;
+    const WCHAR *digits;
+};
+
+extern HRESULT fontface_get_shaped_run(struct dwrite_fontface *fontface, const struct shaped_run_desc *desc,
+        unsigned int max_glyph_count, UINT16 *clustermap, DWRITE_SHAPING_TEXT_PROPERTIES *text_props,
+        UINT16 *glyphs, DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props, UINT32 *glyph_count);
+extern void fontface_cache_shaped_run(struct dwrite_fontface *fontface, const struct shaped_run_desc *desc,
+        unsigned int glyph_count, const UINT16 *clustermap, const DWRITE_SHAPING_TEXT_PROPERTIES *text_props,
+        const UINT16 *glyphs, const DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props);
+
 extern void opentype_layout_scriptshaping_cache_init(struct scriptshaping_cache *cache);
 extern unsigned int opentype_layout_find_script(const struct scriptshaping_cache *cache, unsigned int kind,
         DWORD tag, unsigned int *script_index);
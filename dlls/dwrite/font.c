@@ -260,22 +260,154 @@ static int fontface_cache_compare(const void *k, const struct wine_rb_entry *e)
     return 0;
 }
 
+#define SHAPED_RUN_CACHE_SIZE 64
+#define SHAPED_RUN_MAX_LENGTH 64
+
+struct shaped_run
+{
+    struct list entry;
+    unsigned int script;
+    UINT32 language_tag;
+    BOOL is_rtl;
+    BOOL is_sideways;
+    WCHAR digits[NATIVE_DIGITS_LEN];
+    unsigned int length;
+    unsigned int glyph_count;
+    /* All arrays point into the same allocation. */
+    WCHAR *text;
+    UINT16 *clustermap;
+    DWRITE_SHAPING_TEXT_PROPERTIES *text_props;
+    UINT16 *glyphs;
+    DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props;
+};
+
+static struct shaped_run *fontface_find_shaped_run(struct dwrite_fontface *fontface,
+        const struct shaped_run_desc *desc)
+{
+    struct shaped_run *run;
+
+    LIST_FOR_EACH_ENTRY(run, &fontface->cache.shaped_mru, struct shaped_run, entry)
+    {
+        if (run->script == desc->script && run->language_tag == desc->language_tag &&
+                !run->is_rtl == !desc->is_rtl && !run->is_sideways == !desc->is_sideways &&
+                run->length == desc->length && !wcscmp(run->digits, desc->digits) &&
+                !memcmp(run->text, desc->text, desc->length * sizeof(*desc->text)))
+            return run;
+    }
+
+    return NULL;
+}
+
+/* Returns S_FALSE when the run is not cached and has to be shaped. */
+HRESULT fontface_get_shaped_run(struct dwrite_fontface *fontface, const struct shaped_run_desc *desc,
+        unsigned int max_glyph_count, UINT16 *clustermap, DWRITE_SHAPING_TEXT_PROPERTIES *text_props,
+        UINT16 *glyphs, DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props, UINT32 *glyph_count)
+{
+    HRESULT hr = S_FALSE;
+    struct shaped_run *run;
+
+    if (desc->length > SHAPED_RUN_MAX_LENGTH)
+        return S_FALSE;
+
+    EnterCriticalSection(&fontface->cs);
+    if ((run = fontface_find_shaped_run(fontface, desc)))
+    {
+        if (run->glyph_count > max_glyph_count)
+            hr = E_NOT_SUFFICIENT_BUFFER;
+        else
+        {
+            memcpy(clustermap, run->clustermap, run->length * sizeof(*clustermap));
+            memcpy(text_props, run->text_props, run->length * sizeof(*text_props));
+            memcpy(glyphs, run->glyphs, run->glyph_count * sizeof(*glyphs));
+            memcpy(glyph_props, run->glyph_props, run->glyph_count * sizeof(*glyph_props));
+            *glyph_count = run->glyph_count;
+            hr = S_OK;
+        }
+        list_remove(&run->entry);
+        list_add_head(&fontface->cache.shaped_mru, &run->entry);
+    }
+    LeaveCriticalSection(&fontface->cs);
+
+    return hr;
+}
+
+void fontface_cache_shaped_run(struct dwrite_fontface *fontface, const struct shaped_run_desc *desc,
+        unsigned int glyph_count, const UINT16 *clustermap, const DWRITE_SHAPING_TEXT_PROPERTIES *text_props,
+        const UINT16 *glyphs, const DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props)
+{
+    struct shaped_run *run, *old;
+    BYTE *ptr;
+
+    if (desc->length > SHAPED_RUN_MAX_LENGTH)
+        return;
+
+    if (!(run = malloc(sizeof(*run) + desc->length * (sizeof(*run->text) + sizeof(*clustermap) + sizeof(*text_props)) +
+            glyph_count * (sizeof(*glyphs) + sizeof(*glyph_props)))))
+        return;
+
+    run->script = desc->script;
+    run->language_tag = desc->language_tag;
+    run->is_rtl = desc->is_rtl;
+    run->is_sideways = desc->is_sideways;
+    lstrcpynW(run->digits, desc->digits, NATIVE_DIGITS_LEN);
+    run->length = desc->length;
+    run->glyph_count = glyph_count;
+
+    ptr = (BYTE *)(run + 1);
+    run->text = memcpy(ptr, desc->text, desc->length * sizeof(*run->text));
+    ptr += desc->length * sizeof(*run->text);
+    run->clustermap = memcpy(ptr, clustermap, desc->length * sizeof(*clustermap));
+    ptr += desc->length * sizeof(*clustermap);
+    run->text_props = memcpy(ptr, text_props, desc->length * sizeof(*text_props));
+    ptr += desc->length * sizeof(*text_props);
+    run->glyphs = memcpy(ptr, glyphs, glyph_count * sizeof(*glyphs));
+    ptr += glyph_count * sizeof(*glyphs);
+    run->glyph_props = memcpy(ptr, glyph_props, glyph_count * sizeof(*glyph_props));
+
+    EnterCriticalSection(&fontface->cs);
+    if (fontface_find_shaped_run(fontface, desc))
+    {
+        /* Another thread shaped the same run in the meantime. */
+        free(run);
+    }
+    else
+    {
+        if (fontface->cache.shaped_count >= SHAPED_RUN_CACHE_SIZE)
+        {
+            old = LIST_ENTRY(list_tail(&fontface->cache.shaped_mru), struct shaped_run, entry);
+            list_remove(&old->entry);
+            free(old);
+            fontface->cache.shaped_count--;
+        }
+        list_add_head(&fontface->cache.shaped_mru, &run->entry);
+        fontface->cache.shaped_count++;
+    }
+    LeaveCriticalSection(&fontface->cs);
+}
+
 static void fontface_cache_init(struct dwrite_fontface *fontface)
 {
     wine_rb_init(&fontface->cache.tree, fontface_cache_compare);
     list_init(&fontface->cache.mru);
+    list_init(&fontface->cache.shaped_mru);
     fontface->cache.max_size = 0x8000;
 }
 
 static void fontface_cache_clear(struct dwrite_fontface *fontface)
 {
     struct cache_entry *entry, *entry2;
+    struct shaped_run *run, *run2;
 
     LIST_FOR_EACH_ENTRY_SAFE(entry, entry2, &fontface->cache.mru, struct cache_entry, mru)
     {
         list_remove(&entry->mru);
         fontface_release_cache_entry(entry);
     }
+    LIST_FOR_EACH_ENTRY_SAFE(run, run2, &fontface->cache.shaped_mru, struct shaped_run, entry)
+    {
+        list_remove(&run->entry);
+        free(run);
+    }
     memset(&fontface->cache, 0, sizeof(fontface->cache));
 }
 
@@ -4324,8 +4456,7 @@ static BOOL font_apply_differentiation_rules(struct dwrite_font_data *font, WCHA
     return TRUE;
 }
 
-static HRESULT init_font_data(const struct fontface_desc *desc, DWRITE_FONT_FAMILY_MODEL family_model,
-        struct dwrite_font_data **ret)
+static void init_font_data_axis(struct dwrite_font_data *data)
 {
     static const float width_axis_values[] =
     {
@@ -4341,6 +4472,19 @@ static HRESULT init_font_data(const struct fontface_desc *desc, DWRITE_FONT_FAMI
         200.0f, /* DWRITE_FONT_STRETCH_ULTRA_EXPANDED */
     };
 
+    init_font_prop_vec(data->weight, data->stretch, data->style, &data->propvec);
+
+    data->axis[0].axisTag = DWRITE_FONT_AXIS_TAG_WEIGHT;
+    data->axis[0].value = data->weight;
+    data->axis[1].axisTag = DWRITE_FONT_AXIS_TAG_WIDTH;
+    data->axis[1].value = width_axis_values[data->stretch];
+    data->axis[2].axisTag = DWRITE_FONT_AXIS_TAG_ITALIC;
+    data->axis[2].value = data->style == DWRITE_FONT_STYLE_ITALIC ? 1.0f : 0.0f;
+}
+
+static HRESULT init_font_data(const struct fontface_desc *desc, DWRITE_FONT_FAMILY_MODEL family_model,
+        struct dwrite_font_data **ret)
+{
     struct file_stream_desc stream_desc;
     struct dwrite_font_props props;
     struct dwrite_font_data *data;
@@ -4390,14 +4534,7 @@ static HRESULT init_font_data(const struct fontface_desc *desc, DWRITE_FONT_FAMI
         set_en_localizedstring(data->names, faceW);
     }
 
-    init_font_prop_vec(data->weight, data->stretch, data->style, &data->propvec);
-
-    data->axis[0].axisTag = DWRITE_FONT_AXIS_TAG_WEIGHT;
-    data->axis[0].value = props.weight;
-    data->axis[1].axisTag = DWRITE_FONT_AXIS_TAG_WIDTH;
-    data->axis[1].value = width_axis_values[props.stretch];
-    data->axis[2].axisTag = DWRITE_FONT_AXIS_TAG_ITALIC;
-    data->axis[2].value = data->style == DWRITE_FONT_STYLE_ITALIC ? 1.0f : 0.0f;
+    init_font_data_axis(data);
 
     *ret = data;
     return S_OK;
@@ -4675,6 +4812,261 @@ static void fontcollection_add_replacements(struct dwrite_fontcollection *collec
     RegCloseKey(hkey);
 }
 
+struct local_refkey
+{
+    FILETIME writetime;
+    WCHAR name[1];
+};
+
+/* Font metadata collected when scanning the system fonts is cached in the registry,
+   keyed by file path and face index, so that later processes can build the system
+   collection without parsing every font file again. Entries are validated against
+   the file write time recorded in the local file reference key. */
+
+#define FONT_DATA_CACHE_VERSION 1
+
+struct cached_font_data
+{
+    DWORD version;
+    FILETIME writetime;
+    DWORD face_type;
+    DWORD flags;
+    DWORD style;
+    DWORD stretch;
+    DWORD weight;
+    DWRITE_PANOSE panose;
+    FONTSIGNATURE fontsig;
+    LOGFONTW lf;
+    DWRITE_FONT_METRICS1 metrics;
+    DWORD family_name_count;
+    DWORD name_count;
+    /* Interleaved null-terminated locale/string pairs, family names first. */
+    WCHAR strings[1];
+};
+
+static HKEY get_font_data_cache_key(void)
+{
+    static HKEY cache_key;
+    HKEY key;
+
+    if (cache_key)
+        return cache_key;
+
+    if (RegCreateKeyExW(HKEY_CURRENT_USER, L"Software\\Wine\\Fonts\\DWriteCache", 0, NULL, 0,
+            KEY_QUERY_VALUE | KEY_SET_VALUE, NULL, &key, NULL))
+        return NULL;
+
+    if (InterlockedCompareExchangePointer((void **)&cache_key, key, NULL))
+        RegCloseKey(key);
+
+    return cache_key;
+}
+
+static const struct local_refkey *get_fontfile_refkey(IDWriteFontFile *file)
+{
+    const void *key;
+    UINT32 size;
+
+    if (FAILED(IDWriteFontFile_GetReferenceKey(file, &key, &size)))
+        return NULL;
+    if (size < FIELD_OFFSET(struct local_refkey, name[1]))
+        return NULL;
+
+    return key;
+}
+
+static WCHAR *get_font_data_cache_name(const struct local_refkey *refkey, unsigned int index)
+{
+    size_t len = wcslen(refkey->name) + 12;
+    WCHAR *name;
+
+    if (!(name = malloc(len * sizeof(*name))))
+        return NULL;
+
+    swprintf(name, len, L"%s,%u", refkey->name, index);
+    return name;
+}
+
+static unsigned int cached_strings_size(IDWriteLocalizedStrings *strings)
+{
+    unsigned int i, count = IDWriteLocalizedStrings_GetCount(strings);
+    unsigned int size = 0;
+    UINT32 length;
+
+    for (i = 0; i < count; ++i)
+    {
+        if (FAILED(IDWriteLocalizedStrings_GetLocaleNameLength(strings, i, &length)))
+            return 0;
+        size += (length + 1) * sizeof(WCHAR);
+        if (FAILED(IDWriteLocalizedStrings_GetStringLength(strings, i, &length)))
+            return 0;
+        size += (length + 1) * sizeof(WCHAR);
+    }
+
+    return size;
+}
+
+static WCHAR *cached_strings_write(IDWriteLocalizedStrings *strings, WCHAR *ptr)
+{
+    unsigned int i, count = IDWriteLocalizedStrings_GetCount(strings);
+    UINT32 length;
+
+    for (i = 0; i < count; ++i)
+    {
+        IDWriteLocalizedStrings_GetLocaleNameLength(strings, i, &length);
+        IDWriteLocalizedStrings_GetLocaleName(strings, i, ptr, length + 1);
+        ptr += length + 1;
+        IDWriteLocalizedStrings_GetStringLength(strings, i, &length);
+        IDWriteLocalizedStrings_GetString(strings, i, ptr, length + 1);
+        ptr += length + 1;
+    }
+
+    return ptr;
+}
+
+static const WCHAR *cached_strings_read(unsigned int count, const WCHAR *ptr, const WCHAR *end,
+        IDWriteLocalizedStrings **ret)
+{
+    const WCHAR *locale, *string;
+    unsigned int i;
+
+    if (FAILED(create_localizedstrings(ret)))
+        return NULL;
+
+    for (i = 0; i < count; ++i)
+    {
+        locale = ptr;
+        while (ptr < end && *ptr) ptr++;
+        if (ptr == end) break;
+        string = ++ptr;
+        while (ptr < end && *ptr) ptr++;
+        if (ptr == end) break;
+        ptr++;
+        if (FAILED(add_localizedstring(*ret, locale, string)))
+            break;
+    }
+
+    if (i < count)
+    {
+        IDWriteLocalizedStrings_Release(*ret);
+        *ret = NULL;
+        return NULL;
+    }
+
+    return ptr;
+}
+
+/* Returns S_FALSE when there is no valid cache entry for this face. */
+static HRESULT create_font_data_from_cache(const struct fontface_desc *desc, struct dwrite_font_data **ret)
+{
+    const struct cached_font_data *cached;
+    const struct local_refkey *refkey;
+    struct dwrite_font_data *data;
+    const WCHAR *ptr, *end;
+    DWORD type, size = 0;
+    HRESULT hr = S_FALSE;
+    BYTE *blob = NULL;
+    WCHAR *name;
+    HKEY key;
+
+    *ret = NULL;
+
+    if (!(key = get_font_data_cache_key()) || !(refkey = get_fontfile_refkey(desc->file)))
+        return S_FALSE;
+    if (!(name = get_font_data_cache_name(refkey, desc->index)))
+        return S_FALSE;
+
+    if (!RegQueryValueExW(key, name, NULL, &type, NULL, &size) && type == REG_BINARY &&
+            size > FIELD_OFFSET(struct cached_font_data, strings) && (blob = malloc(size)) &&
+            !RegQueryValueExW(key, name, NULL, &type, blob, &size))
+    {
+        cached = (const struct cached_font_data *)blob;
+
+        if (cached->version == FONT_DATA_CACHE_VERSION &&
+                !memcmp(&cached->writetime, &refkey->writetime, sizeof(refkey->writetime)) &&
+                cached->face_type == desc->face_type &&
+                cached->stretch <= DWRITE_FONT_STRETCH_ULTRA_EXPANDED &&
+                cached->family_name_count && (data = calloc(1, sizeof(*data))))
+        {
+            data->refcount = 1;
+            data->file = desc->file;
+            data->face_index = desc->index;
+            data->face_type = desc->face_type;
+            IDWriteFontFile_AddRef(data->file);
+
+            data->style = cached->style;
+            data->stretch = cached->stretch;
+            data->weight = cached->weight;
+            data->panose = cached->panose;
+            data->fontsig = cached->fontsig;
+            data->lf = cached->lf;
+            data->flags = cached->flags;
+            data->metrics = cached->metrics;
+
+            ptr = (const WCHAR *)(blob + FIELD_OFFSET(struct cached_font_data, strings));
+            end = (const WCHAR *)(blob + size);
+            if ((ptr = cached_strings_read(cached->family_name_count, ptr, end, &data->family_names)) &&
+                    cached_strings_read(cached->name_count, ptr, end, &data->names))
+            {
+                init_font_data_axis(data);
+                *ret = data;
+                hr = S_OK;
+            }
+            else
+                release_font_data(data);
+        }
+    }
+
+    free(blob);
+    free(name);
+    return hr;
+}
+
+static void add_font_data_to_cache(const struct fontface_desc *desc, struct dwrite_font_data *data)
+{
+    unsigned int family_size, names_size, size;
+    const struct local_refkey *refkey;
+    struct cached_font_data *cached;
+    WCHAR *name, *ptr;
+    HKEY key;
+
+    if (!data->family_names || !data->names)
+        return;
+    if (!(key = get_font_data_cache_key()) || !(refkey = get_fontfile_refkey(desc->file)))
+        return;
+    if (!(name = get_font_data_cache_name(refkey, desc->index)))
+        return;
+
+    family_size = cached_strings_size(data->family_names);
+    names_size = cached_strings_size(data->names);
+    size = FIELD_OFFSET(struct cached_font_data, strings) + family_size + names_size;
+
+    if ((cached = calloc(1, size)))
+    {
+        cached->version = FONT_DATA_CACHE_VERSION;
+        cached->writetime = refkey->writetime;
+        cached->face_type = data->face_type;
+        cached->flags = data->flags;
+        cached->style = data->style;
+        cached->stretch = data->stretch;
+        cached->weight = data->weight;
+        cached->panose = data->panose;
+        cached->fontsig = data->fontsig;
+        cached->lf = data->lf;
+        cached->metrics = data->metrics;
+        cached->family_name_count = IDWriteLocalizedStrings_GetCount(data->family_names);
+        cached->name_count = IDWriteLocalizedStrings_GetCount(data->names);
+
+        ptr = cached_strings_write(data->family_names, cached->strings);
+        cached_strings_write(data->names, ptr);
+
+        RegSetValueExW(key, name, 0, REG_BINARY, (const BYTE *)cached, size);
+        free(cached);
+    }
+
+    free(name);
+}
+
 HRESULT create_font_collection(IDWriteFactory7 *factory, IDWriteFontFileEnumerator *enumerator, BOOL is_system,
     IDWriteFontCollection3 **ret)
 {
@@ -4770,7 +5162,13 @@ HRESULT create_font_collection(IDWriteFactory7 *factory, IDWriteFontFileEnumerat
             desc.font_data = NULL;
 
             /* Allocate an initialize new font data structure. */
-            hr = init_font_data(&desc, DWRITE_FONT_FAMILY_MODEL_WEIGHT_STRETCH_STYLE, &font_data);
+            hr = is_system ? create_font_data_from_cache(&desc, &font_data) : S_FALSE;
+            if (hr == S_FALSE)
+            {
+                hr = init_font_data(&desc, DWRITE_FONT_FAMILY_MODEL_WEIGHT_STRETCH_STYLE, &font_data);
+                if (hr == S_OK && is_system)
+                    add_font_data_to_cache(&desc, font_data);
+            }
             if (FAILED(hr))
             {
                 /* move to next one */
@@ -5597,12 +5995,6 @@ HRESULT create_fontface(const struct fontface_desc *desc, struct list *cached_li
 }
 
 /* IDWriteLocalFontFileLoader and its required IDWriteFontFileStream */
-struct local_refkey
-{
-    FILETIME writetime;
-    WCHAR name[1];
-};
-
 struct local_cached_stream
 {
     struct list entry;
@@ -590,9 +590,23 @@ static HRESULT STDMETHODCALLTYPE d3d11_swapchain_GetContainingOutput(IDXGISwapCh
 static HRESULT STDMETHODCALLTYPE d3d11_swapchain_GetFrameStatistics(IDXGISwapChain4 *iface,
         DXGI_FRAME_STATISTICS *stats)
 {
-    FIXME("iface %p, stats %p stub!\n", iface, stats);
+    struct d3d11_swapchain *swapchain = d3d11_swapchain_from_IDXGISwapChain4(iface);
+    struct wined3d_present_stats wined3d_stats;
 
-    return E_NOTIMPL;
+    TRACE("iface %p, stats %p.\n", iface, stats);
+
+    wined3d_mutex_lock();
+    wined3d_swapchain_get_present_stats(swapchain->wined3d_swapchain, &wined3d_stats);
+    wined3d_mutex_unlock();
+
+    /* We don't have access to the output's vblank counter, so the refresh
+     * counts are left at 0; the QPC time of the most recently executed
+     * present is the best approximation of the presentation time we have. */
+    memset(stats, 0, sizeof(*stats));
+    stats->PresentCount = wined3d_stats.present_count;
+    stats->SyncQPCTime = wined3d_stats.present_time;
+
+    return S_OK;
 }
 
 static HRESULT STDMETHODCALLTYPE d3d11_swapchain_GetLastPresentCount(IDXGISwapChain4 *iface,
@@ -781,23 +795,73 @@ static HRESULT STDMETHODCALLTYPE d3d11_swapchain_GetSourceSize(IDXGISwapChain4 *
 
 static HRESULT STDMETHODCALLTYPE d3d11_swapchain_SetMaximumFrameLatency(IDXGISwapChain4 *iface, UINT max_latency)
 {
-    FIXME("iface %p, max_latency %u stub!\n", iface, max_latency);
+    struct d3d11_swapchain *swapchain = d3d11_swapchain_from_IDXGISwapChain4(iface);
 
-    return E_NOTIMPL;
+    TRACE("iface %p, max_latency %u.\n", iface, max_latency);
+
+    if (!swapchain->frame_latency_semaphore)
+    {
+        WARN("DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT not set for swap chain %p.\n", iface);
+        return DXGI_ERROR_INVALID_CALL;
+    }
+
+    if (!max_latency)
+    {
+        WARN("Invalid maximum frame latency %u.\n", max_latency);
+        return DXGI_ERROR_INVALID_CALL;
+    }
+
+    wined3d_mutex_lock();
+    if (max_latency > swapchain->frame_latency
+            && !ReleaseSemaphore(swapchain->frame_latency_semaphore, max_latency - swapchain->frame_latency, NULL))
+    {
+        ERR("Failed to release frame latency semaphore, last error %lu.\n", GetLastError());
+        wined3d_mutex_unlock();
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
+    swapchain->frame_latency = max_latency;
+    wined3d_mutex_unlock();
+
+    return S_OK;
 }
 
 static HRESULT STDMETHODCALLTYPE d3d11_swapchain_GetMaximumFrameLatency(IDXGISwapChain4 *iface, UINT *max_latency)
 {
-    FIXME("iface %p, max_latency %p stub!\n", iface, max_latency);
+    struct d3d11_swapchain *swapchain = d3d11_swapchain_from_IDXGISwapChain4(iface);
 
-    return E_NOTIMPL;
+    TRACE("iface %p, max_latency %p.\n", iface, max_latency);
+
+    if (!swapchain->frame_latency_semaphore)
+    {
+        WARN("DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT not set for swap chain %p.\n", iface);
+        return DXGI_ERROR_INVALID_CALL;
+    }
+
+    *max_latency = swapchain->frame_latency;
+    return S_OK;
 }
 
 static HANDLE STDMETHODCALLTYPE d3d11_swapchain_GetFrameLatencyWaitableObject(IDXGISwapChain4 *iface)
 {
-    FIXME("iface %p stub!\n", iface);
+    struct d3d11_swapchain *swapchain = d3d11_swapchain_from_IDXGISwapChain4(iface);
+    HANDLE dup;
+
+    TRACE("iface %p.\n", iface);
 
-    return NULL;
+    if (!swapchain->frame_latency_semaphore)
+    {
+        WARN("DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT not set for swap chain %p.\n", iface);
+        return NULL;
+    }
+
+    if (!DuplicateHandle(GetCurrentProcess(), swapchain->frame_latency_semaphore, GetCurrentProcess(),
+            &dup, 0, FALSE, DUPLICATE_SAME_ACCESS))
+    {
+        ERR("Cannot duplicate handle, last error %lu.\n", GetLastError());
+        return NULL;
+    }
+
+    return dup;
 }
 
 static HRESULT STDMETHODCALLTYPE d3d11_swapchain_SetMatrixTransform(IDXGISwapChain4 *iface,
@@ -920,6 +984,8 @@ static void STDMETHODCALLTYPE d3d11_swapchain_wined3d_object_released(void *pare
 {
     struct d3d11_swapchain *swapchain = parent;
 
+    if (swapchain->frame_latency_semaphore)
+        CloseHandle(swapchain->frame_latency_semaphore);
     wined3d_private_store_cleanup(&swapchain->private_store);
     free(parent);
 }
@@ -1035,6 +1101,23 @@ HRESULT d3d11_swapchain_init(struct d3d11_swapchain *swapchain, struct dxgi_devi
         goto cleanup;
     }
 
+    if (desc->flags & WINED3D_SWAPCHAIN_LATENCY_WAITABLE)
+    {
+        swapchain->frame_latency = 1;
+        if (!(swapchain->frame_latency_semaphore = CreateSemaphoreW(NULL,
+                swapchain->frame_latency, LONG_MAX, NULL)))
+        {
+            hr = HRESULT_FROM_WIN32(GetLastError());
+            WARN("Failed to create frame latency semaphore, hr %#lx.\n", hr);
+            wined3d_swapchain_decref(swapchain->wined3d_swapchain);
+            goto cleanup;
+        }
+        /* The CS thread releases the semaphore each time it has executed a
+         * present, i.e. when a queued frame has left the latency queue. */
+        wined3d_swapchain_set_present_semaphore(swapchain->wined3d_swapchain,
+                swapchain->frame_latency_semaphore);
+    }
+
     swapchain->target = NULL;
     if (fullscreen)
     {
@@ -540,6 +540,12 @@ unsigned int dxgi_swapchain_flags_from_wined3d(unsigned int wined3d_flags)
         flags |= DXGI_SWAP_CHAIN_FLAG_GDI_COMPATIBLE;
     }
 
+    if (wined3d_flags & WINED3D_SWAPCHAIN_LATENCY_WAITABLE)
+    {
+        wined3d_flags &= ~WINED3D_SWAPCHAIN_LATENCY_WAITABLE;
+        flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    }
+
     if (wined3d_flags)
         FIXME("Unhandled flags %#x.\n", flags);
 
@@ -562,6 +568,12 @@ static unsigned int wined3d_swapchain_flags_from_dxgi(unsigned int flags)
         wined3d_flags |= WINED3D_SWAPCHAIN_GDI_COMPATIBLE;
     }
 
+    if (flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT)
+    {
+        flags &= ~DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+        wined3d_flags |= WINED3D_SWAPCHAIN_LATENCY_WAITABLE;
+    }
+
     if (flags)
         FIXME("Unhandled flags %#x.\n", flags);
 
@@ -118,10 +118,143 @@ struct spool_handle
     } *devmodes;
 };
 
+/* GDI client-side call batching.
+ *
+ * Cheap repeated drawing calls are recorded in a per-thread buffer and
+ * submitted in a single NtGdiPolyPatBlt call.  The batch is flushed before
+ * any other operation that takes a DC, when it reaches the batch limit,
+ * and explicitly by GdiFlush().  Only memory DCs are batched: display DCs
+ * are released through user32, which never passes through gdi32's flush
+ * points, so pending calls could be replayed into a cache DC entry after
+ * it has been reassigned to another window. */
+
+#define GDI_BATCH_SIZE           0x100  /* capacity of the per-thread batch buffer */
+#define GDI_BATCH_DEFAULT_LIMIT  20
+
+struct gdi_batch
+{
+    HDC        hdc;     /* DC the pending calls draw to */
+    DWORD      rop;     /* raster op shared by the pending calls */
+    UINT       count;   /* number of pending calls */
+    UINT       limit;   /* limit set by GdiSetBatchLimit() */
+    POLYPATBLT blts[GDI_BATCH_SIZE];
+};
+
+static DWORD batch_tls_index = TLS_OUT_OF_INDEXES;
+
+BOOL init_gdi_batch(void)
+{
+    return (batch_tls_index = TlsAlloc()) != TLS_OUT_OF_INDEXES;
+}
+
+static struct gdi_batch *get_gdi_batch(void)
+{
+    struct gdi_batch *batch = TlsGetValue( batch_tls_index );
+
+    if (!batch && (batch = HeapAlloc( GetProcessHeap(), 0, sizeof(*batch) )))
+    {
+        batch->count = 0;
+        batch->limit = GDI_BATCH_DEFAULT_LIMIT;
+        TlsSetValue( batch_tls_index, batch );
+    }
+    return batch;
+}
+
+void flush_gdi_batch(void)
+{
+    struct gdi_batch *batch = TlsGetValue( batch_tls_index );
+    UINT count;
+
+    if (!batch || !(count = batch->count)) return;
+    batch->count = 0;
+    NtGdiPolyPatBlt( batch->hdc, batch->rop, batch->blts, count, 0 );
+}
+
+void free_gdi_batch(void)
+{
+    struct gdi_batch *batch = TlsGetValue( batch_tls_index );
+
+    if (!batch) return;
+    flush_gdi_batch();
+    TlsSetValue( batch_tls_index, NULL );
+    HeapFree( GetProcessHeap(), 0, batch );
+}
+
+static void batch_add_pat_blt( struct gdi_batch *batch, HDC hdc, INT left, INT top,
+                               INT width, INT height, DWORD rop )
+{
+    POLYPATBLT *blt = &batch->blts[batch->count++];
+
+    blt->x = left;
+    blt->y = top;
+    blt->cx = width;
+    blt->cy = height;
+    blt->brush = 0;
+    batch->hdc = hdc;
+    batch->rop = rop;
+    if (batch->count >= min( batch->limit, GDI_BATCH_SIZE )) flush_gdi_batch();
+}
+
+/* continue a pending batch without re-validating the DC; a batch is only
+ * started once the full PatBlt() path has rejected metafile and printer DCs */
+static BOOL batch_continue_pat_blt( HDC hdc, INT left, INT top, INT width, INT height, DWORD rop )
+{
+    struct gdi_batch *batch = TlsGetValue( batch_tls_index );
+
+    if (!batch || !batch->count || batch->hdc != hdc || batch->rop != rop) return FALSE;
+    batch_add_pat_blt( batch, hdc, left, top, width, height, rop );
+    return TRUE;
+}
+
+static BOOL batch_start_pat_blt( HDC hdc, INT left, INT top, INT width, INT height, DWORD rop )
+{
+    struct gdi_batch *batch;
+
+    if (gdi_handle_type( hdc ) != NTGDI_OBJ_MEMDC) return FALSE;
+    if (rop_uses_src( rop )) return FALSE;
+    if (!(batch = get_gdi_batch()) || batch->limit <= 1) return FALSE;
+    batch_add_pat_blt( batch, hdc, left, top, width, height, rop );
+    return TRUE;
+}
+
+/***********************************************************************
+ *           GdiFlush    (GDI32.@)
+ */
+BOOL WINAPI GdiFlush(void)
+{
+    flush_gdi_batch();
+    return NtGdiFlush();
+}
+
+/***********************************************************************
+ *           GdiGetBatchLimit    (GDI32.@)
+ */
+DWORD WINAPI GdiGetBatchLimit(void)
+{
+    struct gdi_batch *batch = TlsGetValue( batch_tls_index );
+    return batch ? batch->limit : GDI_BATCH_DEFAULT_LIMIT;
+}
+
+/***********************************************************************
+ *           GdiSetBatchLimit    (GDI32.@)
+ */
+DWORD WINAPI GdiSetBatchLimit( DWORD limit )
+{
+    DWORD prev = GdiGetBatchLimit();
+    struct gdi_batch *batch;
+
+    flush_gdi_batch();
+    if (!(batch = get_gdi_batch())) return 0;
+    batch->limit = limit ? limit : GDI_BATCH_DEFAULT_LIMIT;
+    return prev;
+}
+
 DC_ATTR *get_dc_attr( HDC hdc )
 {
     DWORD type = gdi_handle_type( hdc );
     DC_ATTR *dc_attr;
+
+    flush_gdi_batch();
     if ((type & 0x1f0000) != NTGDI_OBJ_DC || !(dc_attr = get_gdi_client_ptr( hdc, 0 )))
     {
         SetLastError( ERROR_INVALID_HANDLE );
@@ -1464,6 +1597,15 @@ BOOL WINAPI SetMiterLimit( HDC hdc, FLOAT limit, FLOAT *old_limit )
     return TRUE;
 }
 
+/***********************************************************************
+ *           GetPixel    (GDI32.@)
+ */
+COLORREF WINAPI GetPixel( HDC hdc, INT x, INT y )
+{
+    flush_gdi_batch();
+    return NtGdiGetPixel( hdc, x, y );
+}
+
 /***********************************************************************
  *           SetPixel    (GDI32.@)
  */
@@ -1940,11 +2082,14 @@ BOOL WINAPI PatBlt( HDC hdc, INT left, INT top, INT width, INT height, DWORD rop
 {
     DC_ATTR *dc_attr;
 
+    if (batch_continue_pat_blt( hdc, left, top, width, height, rop )) return TRUE;
     if (is_meta_dc( hdc )) return METADC_PatBlt( hdc, left, top, width, height, rop );
     if (!(dc_attr = get_dc_attr( hdc ))) return FALSE;
     if (dc_attr->print) print_call_start_page( dc_attr );
     if (dc_attr->emf && !EMFDC_PatBlt( dc_attr, left, top, width, height, rop ))
         return FALSE;
+    if (!dc_attr->emf && !dc_attr->print &&
+        batch_start_pat_blt( hdc, left, top, width, height, rop )) return TRUE;
     return NtGdiPatBlt( hdc, left, top, width, height, rop );
 }
 
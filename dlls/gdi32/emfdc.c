@@ -1694,11 +1694,6 @@ BOOL EMFDC_PatBlt( DC_ATTR *dc_attr, INT left, INT top, INT width, INT height, D
     return ret;
 }
 
-static inline BOOL rop_uses_src( DWORD rop )
-{
-    return ((rop >> 2) & 0x330000) != (rop & 0x330000);
-}
-
 BOOL EMFDC_BitBlt( DC_ATTR *dc_attr, INT x_dst, INT y_dst, INT width, INT height,
                    HDC hdc_src, INT x_src, INT y_src, DWORD rop )
 {
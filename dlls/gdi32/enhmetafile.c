@@ -58,10 +58,20 @@ static CRITICAL_SECTION_DEBUG critsect_debug =
 };
 static CRITICAL_SECTION enhmetafile_cs = { &critsect_debug, -1, 0, 0, 0, 0 };
 
+/* cached object created by a pen/brush/font creation record, kept alive for
+ * the lifetime of the metafile so that repeated plays can reuse it */
+struct emf_cached_obj
+{
+    HGDIOBJ obj;       /* created object, deleted with the metafile */
+    DWORD   offset;    /* offset of the record that created it */
+};
+
 typedef struct
 {
     ENHMETAHEADER        *emh;
-    BOOL                  on_disk;   /* true if metafile is on disk */
+    BOOL                  on_disk;       /* true if metafile is on disk */
+    BOOL                  records_valid; /* true if the record stream was fully validated at load time */
+    struct emf_cached_obj *obj_cache;    /* object creation cache, one entry per handle table slot */
 } ENHMETAFILEOBJ;
 
 static const struct emr_name {
@@ -253,6 +263,32 @@ static inline BOOL is_dib_monochrome( const BITMAPINFO* info )
     }
 }
 
+/****************************************************************************
+ *          EMF_ValidateRecords
+ *
+ * Walks the whole record stream once so that playback doesn't have to
+ * re-check every record on every play.
+ */
+static BOOL EMF_ValidateRecords( const ENHMETAHEADER *emh )
+{
+    DWORD offset = 0;
+
+    while (offset < emh->nBytes)
+    {
+        const ENHMETARECORD *emr = (const ENHMETARECORD *)((const char *)emh + offset);
+
+        if (emh->nBytes - offset < 2 * sizeof(DWORD) ||
+            emr->nSize < 2 * sizeof(DWORD) || (emr->nSize & 3) ||
+            emr->nSize > emh->nBytes - offset)
+        {
+            WARN( "invalid record at offset %lu\n", offset );
+            return FALSE;
+        }
+        offset += emr->nSize;
+    }
+    return TRUE;
+}
+
 /****************************************************************************
  *          EMF_Create_HENHMETAFILE
  */
@@ -288,6 +324,8 @@ HENHMETAFILE EMF_Create_HENHMETAFILE(ENHMETAHEADER *emh, DWORD filesize, BOOL on
 
     metaObj->emh = emh;
     metaObj->on_disk = on_disk;
+    metaObj->records_valid = EMF_ValidateRecords( emh );
+    metaObj->obj_cache = NULL;
 
     if ((hmf = NtGdiCreateClientObj( NTGDI_OBJ_ENHMETAFILE )))
         set_gdi_client_ptr( hmf, metaObj );
@@ -312,6 +350,13 @@ static BOOL EMF_Delete_HENHMETAFILE( HENHMETAFILE hmf )
         return FALSE;
     }
 
+    if (metafile->obj_cache)
+    {
+        UINT i;
+        for (i = 0; i < metafile->emh->nHandles; i++)
+            if (metafile->obj_cache[i].obj) DeleteObject( metafile->obj_cache[i].obj );
+        HeapFree( GetProcessHeap(), 0, metafile->obj_cache );
+    }
     if (metafile->on_disk)
         UnmapViewOfFile( metafile->emh );
     else
@@ -342,6 +387,35 @@ static ENHMETAHEADER *EMF_GetEnhMetaHeader( HENHMETAFILE hmf )
     return ret;
 }
 
+/****************************************************************************
+ *         EMF_GetPlayInfo
+ *
+ * Returns whether the record stream was validated at load time; if
+ * alloc_cache is set, also returns the object creation cache of the
+ * metafile, allocating it on first use.
+ */
+static BOOL EMF_GetPlayInfo( HENHMETAFILE hmf, BOOL alloc_cache, struct emf_cached_obj **cache )
+{
+    ENHMETAFILEOBJ *metafile;
+    BOOL ret = FALSE;
+
+    if (cache) *cache = NULL;
+    EnterCriticalSection( &enhmetafile_cs );
+    if ((metafile = get_gdi_client_ptr( hmf, NTGDI_OBJ_ENHMETAFILE )))
+    {
+        ret = metafile->records_valid;
+        if (ret && alloc_cache && cache)
+        {
+            if (!metafile->obj_cache)
+                metafile->obj_cache = HeapAlloc( GetProcessHeap(), HEAP_ZERO_MEMORY,
+                                                 metafile->emh->nHandles * sizeof(*metafile->obj_cache) );
+            *cache = metafile->obj_cache;
+        }
+    }
+    LeaveCriticalSection( &enhmetafile_cs );
+    return ret;
+}
+
 /*****************************************************************************
  *         EMF_GetEnhMetaFile
  *
@@ -556,6 +630,11 @@ typedef struct enum_emh_data
     EMF_dc_state state;
     INT save_level;
     EMF_dc_state *saved_state;
+    const ENHMETAHEADER *emh;          /* metafile being played, set only for internal playback */
+    struct emf_cached_obj *obj_cache;  /* object creation cache of that metafile */
+    UINT cache_size;
+    XFORM cur_xform;                   /* last world transform set on the DC */
+    BOOL cur_xform_valid;
 } enum_emh_data;
 
 #define ENUM_GET_PRIVATE_DATA(ht) \
@@ -566,7 +645,51 @@ typedef struct enum_emh_data
 
 #define IS_WIN9X() (GetVersion()&0x80000000)
 
-static void EMF_Update_MF_Xform(HDC hdc, const enum_emh_data *info)
+/* return the object previously created by this record, if any */
+static HGDIOBJ get_cached_object( const enum_emh_data *info, const ENHMETARECORD *mr, DWORD slot )
+{
+    HGDIOBJ obj = 0;
+
+    if (!info->obj_cache || slot >= info->cache_size) return 0;
+    EnterCriticalSection( &enhmetafile_cs );
+    if (info->obj_cache[slot].obj &&
+        info->obj_cache[slot].offset == (DWORD)((const char *)mr - (const char *)info->emh))
+        obj = info->obj_cache[slot].obj;
+    LeaveCriticalSection( &enhmetafile_cs );
+    return obj;
+}
+
+/* publish an object created by a metafile record; if a concurrent play
+ * cached one for the same record first, use that one instead */
+static HGDIOBJ cache_created_object( const enum_emh_data *info, const ENHMETARECORD *mr,
+                                     DWORD slot, HGDIOBJ obj )
+{
+    struct emf_cached_obj *entry;
+
+    if (!obj || !info->obj_cache || slot >= info->cache_size) return obj;
+    entry = &info->obj_cache[slot];
+    EnterCriticalSection( &enhmetafile_cs );
+    if (!entry->obj)
+    {
+        entry->obj = obj;
+        entry->offset = (DWORD)((const char *)mr - (const char *)info->emh);
+    }
+    else if (entry->offset == (DWORD)((const char *)mr - (const char *)info->emh))
+    {
+        DeleteObject( obj );
+        obj = entry->obj;
+    }
+    LeaveCriticalSection( &enhmetafile_cs );
+    return obj;
+}
+
+/* check whether a handle table entry refers to a cached object that must not be deleted */
+static BOOL is_cached_object( const enum_emh_data *info, DWORD slot, HGDIOBJ obj )
+{
+    return obj && info->obj_cache && slot < info->cache_size && info->obj_cache[slot].obj == obj;
+}
+
+static void EMF_Update_MF_Xform(HDC hdc, enum_emh_data *info)
 {
     XFORM mapping_mode_trans, final_trans;
     double scaleX, scaleY;
@@ -582,10 +705,21 @@ static void EMF_Update_MF_Xform(HDC hdc, const enum_emh_data *info)
 
     CombineTransform(&final_trans, &info->state.world_transform, &mapping_mode_trans);
     CombineTransform(&final_trans, &final_trans, &info->init_transform);
- 
+
+    /* during internal playback nothing else touches the DC transform, so
+     * redundant updates between consecutive state records can be elided */
+    if (info->cur_xform_valid && !memcmp( &final_trans, &info->cur_xform, sizeof(final_trans) ))
+        return;
+
     if (!SetWorldTransform(hdc, &final_trans))
     {
         ERR("World transform failed!\n");
+        return;
+    }
+    if (info->emh)
+    {
+        info->cur_xform = final_trans;
+        info->cur_xform_valid = TRUE;
     }
 }
 
@@ -891,7 +1025,10 @@ BOOL WINAPI PlayEnhMetaFileRecord(
 	const EMRRESTOREDC *pRestoreDC = (const EMRRESTOREDC *)mr;
         TRACE("EMR_RESTORE: %ld\n", pRestoreDC->iRelative);
         if (RestoreDC( hdc, pRestoreDC->iRelative ))
+        {
             EMF_RestoreDC( info, pRestoreDC->iRelative );
+            info->cur_xform_valid = FALSE;  /* RestoreDC changed the DC transform behind our back */
+        }
 	break;
       }
     case EMR_INTERSECTCLIPRECT:
@@ -914,7 +1051,9 @@ BOOL WINAPI PlayEnhMetaFileRecord(
       {
 	const EMRDELETEOBJECT *pDeleteObject = (const EMRDELETEOBJECT *)mr;
 	if (pDeleteObject->ihObject >= handles) break;
-	DeleteObject( (handletable->objectHandle)[pDeleteObject->ihObject]);
+	if (!is_cached_object( info, pDeleteObject->ihObject,
+	                       (handletable->objectHandle)[pDeleteObject->ihObject] ))
+	    DeleteObject( (handletable->objectHandle)[pDeleteObject->ihObject]);
 	(handletable->objectHandle)[pDeleteObject->ihObject] = 0;
 	break;
       }
@@ -984,8 +1123,9 @@ BOOL WINAPI PlayEnhMetaFileRecord(
       {
 	const EMRCREATEPEN *pCreatePen = (const EMRCREATEPEN *)mr;
 	if (pCreatePen->ihPen >= handles) break;
-	(handletable->objectHandle)[pCreatePen->ihPen] =
-	  CreatePenIndirect(&pCreatePen->lopn);
+	if (!((handletable->objectHandle)[pCreatePen->ihPen] = get_cached_object( info, mr, pCreatePen->ihPen )))
+	    (handletable->objectHandle)[pCreatePen->ihPen] =
+	        cache_created_object( info, mr, pCreatePen->ihPen, CreatePenIndirect(&pCreatePen->lopn) );
 	break;
       }
     case EMR_EXTCREATEPEN:
@@ -994,6 +1134,7 @@ BOOL WINAPI PlayEnhMetaFileRecord(
 	LOGBRUSH lb;
 
 	if (pPen->ihPen >= handles) break;
+	if (((handletable->objectHandle)[pPen->ihPen] = get_cached_object( info, mr, pPen->ihPen ))) break;
 
 	lb.lbStyle = pPen->elp.elpBrushStyle;
 	lb.lbColor = pPen->elp.elpColor;
@@ -1003,8 +1144,10 @@ BOOL WINAPI PlayEnhMetaFileRecord(
 	  FIXME("EMR_EXTCREATEPEN: Need to copy brush bitmap\n");
 
 	(handletable->objectHandle)[pPen->ihPen] =
-	  ExtCreatePen(pPen->elp.elpPenStyle, pPen->elp.elpWidth, &lb,
-                       pPen->elp.elpNumEntries, pPen->elp.elpNumEntries ? pPen->elp.elpStyleEntry : NULL);
+	  cache_created_object( info, mr, pPen->ihPen,
+	                        ExtCreatePen(pPen->elp.elpPenStyle, pPen->elp.elpWidth, &lb,
+                                             pPen->elp.elpNumEntries,
+                                             pPen->elp.elpNumEntries ? pPen->elp.elpStyleEntry : NULL) );
 	break;
       }
     case EMR_CREATEBRUSHINDIRECT:
@@ -1013,19 +1156,23 @@ BOOL WINAPI PlayEnhMetaFileRecord(
         LOGBRUSH brush;
 
         if (pBrush->ihBrush >= handles) break;
+        if (((handletable->objectHandle)[pBrush->ihBrush] = get_cached_object( info, mr, pBrush->ihBrush )))
+            break;
 
         brush.lbStyle = pBrush->lb.lbStyle;
         brush.lbColor = pBrush->lb.lbColor;
         brush.lbHatch = pBrush->lb.lbHatch;
-        (handletable->objectHandle)[pBrush->ihBrush] = CreateBrushIndirect(&brush);
+        (handletable->objectHandle)[pBrush->ihBrush] =
+            cache_created_object( info, mr, pBrush->ihBrush, CreateBrushIndirect(&brush) );
 	break;
       }
     case EMR_EXTCREATEFONTINDIRECTW:
       {
 	const EMREXTCREATEFONTINDIRECTW *pFont = (const EMREXTCREATEFONTINDIRECTW *)mr;
 	if (pFont->ihFont >= handles) break;
-	(handletable->objectHandle)[pFont->ihFont] =
-	  CreateFontIndirectW(&pFont->elfw.elfLogFont);
+	if (!((handletable->objectHandle)[pFont->ihFont] = get_cached_object( info, mr, pFont->ihFont )))
+	    (handletable->objectHandle)[pFont->ihFont] =
+	        cache_created_object( info, mr, pFont->ihFont, CreateFontIndirectW(&pFont->elfw.elfLogFont) );
 	break;
       }
     case EMR_MOVETOEX:
@@ -2261,6 +2408,7 @@ BOOL WINAPI PlayEnhMetaFileRecord(
     {
 	const EMRSETLAYOUT *pSetLayout = (const EMRSETLAYOUT *)mr;
 	SetLayout(hdc, pSetLayout->iMode);
+	info->cur_xform_valid = FALSE;  /* an RTL layout mirrors the DC transform */
 	break;
     }
 
@@ -2349,6 +2497,10 @@ BOOL WINAPI PlayEnhMetaFileRecord(
 }
 
 
+static INT CALLBACK EMF_PlayEnhMetaFileCallback(HDC hdc, HANDLETABLE *ht,
+                                                const ENHMETARECORD *emr,
+                                                INT handles, LPARAM data);
+
 /*****************************************************************************
  *
  *        EnumEnhMetaFile  (GDI32.@)
@@ -2404,6 +2556,7 @@ BOOL WINAPI EnumEnhMetaFile(
     HFONT hFont = NULL;
     HRGN hRgn = NULL;
     enum_emh_data *info;
+    BOOL validated;
     SIZE vp_size, win_size;
     POINT vp_org, win_org;
     INT mapMode = MM_TEXT, old_align = 0, old_rop2 = 0, old_arcdir = 0, old_polyfill = 0, old_stretchblt = 0;
@@ -2445,6 +2598,19 @@ BOOL WINAPI EnumEnhMetaFile(
     info->save_level = 0;
     info->saved_state = NULL;
     info->init_transform = info->state.world_transform;
+    info->emh = NULL;
+    info->obj_cache = NULL;
+    info->cache_size = 0;
+    info->cur_xform_valid = FALSE;
+
+    /* the object creation cache is only safe when we drive the playback
+     * ourselves; an application callback may do anything with the handles */
+    validated = EMF_GetPlayInfo( hmf, callback == EMF_PlayEnhMetaFileCallback, &info->obj_cache );
+    if (info->obj_cache)
+    {
+        info->emh = emh;
+        info->cache_size = emh->nHandles;
+    }
 
     ht = (HANDLETABLE*) &info[1];
     ht->objectHandle[0] = hmf;
@@ -2540,9 +2706,11 @@ BOOL WINAPI EnumEnhMetaFile(
     {
 	emr = (ENHMETARECORD *)((char *)emh + offset);
 
-        if (offset + 8 > emh->nBytes ||
-            offset > offset + emr->nSize ||
-            offset + emr->nSize > emh->nBytes)
+        /* the whole stream was checked at load time for validated metafiles */
+        if (!validated &&
+            (offset + 8 > emh->nBytes ||
+             offset > offset + emr->nSize ||
+             offset + emr->nSize > emh->nBytes))
         {
             WARN("record truncated\n");
             break;
@@ -2585,7 +2753,7 @@ BOOL WINAPI EnumEnhMetaFile(
     }
 
     for(i = 1; i < emh->nHandles; i++) /* Don't delete element 0 (hmf) */
-        if( (ht->objectHandle)[i] )
+        if( (ht->objectHandle)[i] && !is_cached_object( info, i, (ht->objectHandle)[i] ))
 	    DeleteObject( (ht->objectHandle)[i] );
 
     while (info->saved_state)
@@ -258,7 +258,7 @@
 # @ stub GdiEntry8
 # @ stub GdiEntry9
 # @ stub GdiFixUpHandle
-@ stdcall GdiFlush() NtGdiFlush
+@ stdcall GdiFlush()
 # @ stub GdiFullscreenControl
 @ stdcall GdiGetBatchLimit()
 # @ stub GdiGetBitmapBitsSize
@@ -421,7 +421,7 @@
 # @ stub GetPhysicalMonitorDescription
 # @ stub GetPhysicalMonitorFromTargetInternal
 # @ stub GetPhysicalMonitors
-@ stdcall GetPixel(long long long) NtGdiGetPixel
+@ stdcall GetPixel(long long long)
 @ stdcall GetPixelFormat(long)
 @ stdcall GetPolyFillMode(long)
 # @ stub GetProcessSessionFonts
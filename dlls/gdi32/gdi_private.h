@@ -32,6 +32,9 @@
 void set_gdi_client_ptr( HGDIOBJ handle, void *ptr );
 void *get_gdi_client_ptr( HGDIOBJ handle, DWORD type );
 DC_ATTR *get_dc_attr( HDC hdc );
+BOOL init_gdi_batch(void);
+void flush_gdi_batch(void);
+void free_gdi_batch(void);
 HGDIOBJ get_full_gdi_handle( HGDIOBJ handle );
 void GDI_hdc_using_object( HGDIOBJ obj, HDC hdc, void (*delete)( HDC hdc, HGDIOBJ handle ));
 void GDI_hdc_not_using_object( HGDIOBJ obj, HDC hdc );
@@ -42,6 +45,11 @@ static inline DWORD gdi_handle_type( HGDIOBJ obj )
     return handle & NTGDI_HANDLE_TYPE_MASK;
 }
 
+static inline BOOL rop_uses_src( DWORD rop )
+{
+    return ((rop >> 2) & 0x330000) != (rop & 0x330000);
+}
+
 /* metafile defines */
 
 #define META_EOF 0x0000
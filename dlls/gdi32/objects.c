@@ -138,10 +138,15 @@ HGDIOBJ get_full_gdi_handle( HGDIOBJ obj )
  */
 BOOL WINAPI DllMain( HINSTANCE inst, DWORD reason, LPVOID reserved )
 {
-    if (reason != DLL_PROCESS_ATTACH) return TRUE;
-
-    DisableThreadLibraryCalls( inst );
-    gdi32_module = inst;
+    switch (reason)
+    {
+    case DLL_PROCESS_ATTACH:
+        gdi32_module = inst;
+        return init_gdi_batch();
+    case DLL_THREAD_DETACH:
+        free_gdi_batch();
+        break;
+    }
     return TRUE;
 }
 
@@ -867,6 +872,7 @@ HBITMAP WINAPI DECLSPEC_HOTPATCH CreateDIBSection( HDC hdc, const BITMAPINFO *bm
 INT WINAPI DECLSPEC_HOTPATCH GetDIBits( HDC hdc, HBITMAP hbitmap, UINT startscan, UINT lines,
                                         void *bits, BITMAPINFO *info, UINT coloruse )
 {
+    flush_gdi_batch();
     return NtGdiGetDIBitsInternal( hdc, hbitmap, startscan, lines, bits, info, coloruse, 0, 0 );
 }
 
@@ -914,22 +920,6 @@ DWORD WINAPI GdiInitializeLanguagePack( DWORD arg )
     return 0;
 }
 
-/***********************************************************************
- *           GdiGetBatchLimit    (GDI32.@)
- */
-DWORD WINAPI GdiGetBatchLimit(void)
-{
-    return 1;  /* FIXME */
-}
-
-/***********************************************************************
- *           GdiSetBatchLimit    (GDI32.@)
- */
-DWORD WINAPI GdiSetBatchLimit( DWORD limit )
-{
-    return 1; /* FIXME */
-}
-
 /* Solid colors to enumerate */
 static const COLORREF solid_colors[] =
 {
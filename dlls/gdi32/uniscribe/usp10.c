@@ -779,6 +779,211 @@ static inline BOOL set_cache_glyph_widths(SCRIPT_CACHE *psc, WORD glyph, ABC *ab
     return TRUE;
 }
 
+/* Cached results of full runs through the shaping and positioning engines.
+ * A ScriptCache can be shared between threads, so the lists are guarded by
+ * cs_script_cache and results are copied out while the lock is held. */
+#define RUN_CACHE_LIMIT (512 * 1024)
+
+struct shaped_run
+{
+    struct list entry;
+    SIZE_T size;
+
+    SCRIPT_ANALYSIS a;
+    OPENTYPE_TAG script_tag;
+    OPENTYPE_TAG lang_tag;
+    int max_glyphs;
+    int char_count;
+    WCHAR *chars;
+
+    int glyph_count;
+    WORD *glyphs;
+    WORD *log_clust;
+    SCRIPT_CHARPROP *char_props;
+    SCRIPT_GLYPHPROP *glyph_props;
+};
+
+struct placed_run
+{
+    struct list entry;
+    SIZE_T size;
+
+    SCRIPT_ANALYSIS a;
+    OPENTYPE_TAG script_tag;
+    OPENTYPE_TAG lang_tag;
+    int glyph_count;
+    WORD *glyphs;
+    SCRIPT_GLYPHPROP *glyph_props;
+
+    int *advances;
+    GOFFSET *goffsets;
+    BOOL has_abc;
+    ABC abc;
+};
+
+static void shaped_run_destroy(struct shaped_run *run)
+{
+    heap_free(run->chars);
+    heap_free(run->glyphs);
+    heap_free(run->log_clust);
+    heap_free(run->char_props);
+    heap_free(run->glyph_props);
+    heap_free(run);
+}
+
+static void placed_run_destroy(struct placed_run *run)
+{
+    heap_free(run->glyphs);
+    heap_free(run->glyph_props);
+    heap_free(run->advances);
+    heap_free(run->goffsets);
+    heap_free(run);
+}
+
+static BOOL get_cached_shaped_run(ScriptCache *sc, const SCRIPT_ANALYSIS *psa, OPENTYPE_TAG script_tag,
+        OPENTYPE_TAG lang_tag, const WCHAR *chars, int char_count, int max_glyphs, WORD *log_clust,
+        SCRIPT_CHARPROP *char_props, WORD *glyphs, SCRIPT_GLYPHPROP *glyph_props, int *glyph_count)
+{
+    struct shaped_run *run;
+
+    EnterCriticalSection(&cs_script_cache);
+    LIST_FOR_EACH_ENTRY(run, &sc->shaped_runs, struct shaped_run, entry)
+    {
+        if (run->char_count != char_count || run->max_glyphs != max_glyphs) continue;
+        if (run->script_tag != script_tag || run->lang_tag != lang_tag) continue;
+        if (memcmp(&run->a, psa, sizeof(*psa))) continue;
+        if (memcmp(run->chars, chars, char_count * sizeof(*chars))) continue;
+
+        list_remove(&run->entry);
+        list_add_head(&sc->shaped_runs, &run->entry);
+
+        memcpy(log_clust, run->log_clust, char_count * sizeof(*log_clust));
+        memcpy(char_props, run->char_props, char_count * sizeof(*char_props));
+        memcpy(glyphs, run->glyphs, run->glyph_count * sizeof(*glyphs));
+        memcpy(glyph_props, run->glyph_props, run->glyph_count * sizeof(*glyph_props));
+        *glyph_count = run->glyph_count;
+        LeaveCriticalSection(&cs_script_cache);
+        return TRUE;
+    }
+    LeaveCriticalSection(&cs_script_cache);
+    return FALSE;
+}
+
+static void cache_shaped_run(ScriptCache *sc, const SCRIPT_ANALYSIS *psa, OPENTYPE_TAG script_tag,
+        OPENTYPE_TAG lang_tag, const WCHAR *chars, int char_count, int max_glyphs, const WORD *log_clust,
+        const SCRIPT_CHARPROP *char_props, const WORD *glyphs, const SCRIPT_GLYPHPROP *glyph_props,
+        int glyph_count)
+{
+    struct shaped_run *run;
+
+    if (!(run = heap_alloc_zero(sizeof(*run)))) return;
+    run->a = *psa;
+    run->script_tag = script_tag;
+    run->lang_tag = lang_tag;
+    run->max_glyphs = max_glyphs;
+    run->char_count = char_count;
+    run->glyph_count = glyph_count;
+    if (!(run->chars = heap_alloc(char_count * sizeof(*run->chars)))
+            || !(run->log_clust = heap_alloc(char_count * sizeof(*run->log_clust)))
+            || !(run->char_props = heap_alloc(char_count * sizeof(*run->char_props)))
+            || !(run->glyphs = heap_alloc(glyph_count * sizeof(*run->glyphs)))
+            || !(run->glyph_props = heap_alloc(glyph_count * sizeof(*run->glyph_props))))
+    {
+        shaped_run_destroy(run);
+        return;
+    }
+    memcpy(run->chars, chars, char_count * sizeof(*run->chars));
+    memcpy(run->log_clust, log_clust, char_count * sizeof(*run->log_clust));
+    memcpy(run->char_props, char_props, char_count * sizeof(*run->char_props));
+    memcpy(run->glyphs, glyphs, glyph_count * sizeof(*run->glyphs));
+    memcpy(run->glyph_props, glyph_props, glyph_count * sizeof(*run->glyph_props));
+    run->size = sizeof(*run) + char_count * (sizeof(*run->chars) + sizeof(*run->log_clust)
+            + sizeof(*run->char_props)) + glyph_count * (sizeof(*run->glyphs) + sizeof(*run->glyph_props));
+
+    EnterCriticalSection(&cs_script_cache);
+    list_add_head(&sc->shaped_runs, &run->entry);
+    sc->shaped_runs_size += run->size;
+    while (sc->shaped_runs_size > RUN_CACHE_LIMIT)
+    {
+        struct shaped_run *tail = LIST_ENTRY(list_tail(&sc->shaped_runs), struct shaped_run, entry);
+        if (tail == run) break;
+        list_remove(&tail->entry);
+        sc->shaped_runs_size -= tail->size;
+        shaped_run_destroy(tail);
+    }
+    LeaveCriticalSection(&cs_script_cache);
+}
+
+static BOOL get_cached_placed_run(ScriptCache *sc, const SCRIPT_ANALYSIS *psa, OPENTYPE_TAG script_tag,
+        OPENTYPE_TAG lang_tag, const WORD *glyphs, const SCRIPT_GLYPHPROP *glyph_props, int glyph_count,
+        int *advances, GOFFSET *goffsets, ABC *abc)
+{
+    struct placed_run *run;
+
+    EnterCriticalSection(&cs_script_cache);
+    LIST_FOR_EACH_ENTRY(run, &sc->placed_runs, struct placed_run, entry)
+    {
+        if (run->glyph_count != glyph_count) continue;
+        if (run->script_tag != script_tag || run->lang_tag != lang_tag) continue;
+        if (abc && !run->has_abc) continue;
+        if (memcmp(&run->a, psa, sizeof(*psa))) continue;
+        if (memcmp(run->glyphs, glyphs, glyph_count * sizeof(*glyphs))) continue;
+        if (memcmp(run->glyph_props, glyph_props, glyph_count * sizeof(*glyph_props))) continue;
+
+        list_remove(&run->entry);
+        list_add_head(&sc->placed_runs, &run->entry);
+
+        memcpy(advances, run->advances, glyph_count * sizeof(*advances));
+        memcpy(goffsets, run->goffsets, glyph_count * sizeof(*goffsets));
+        if (abc) *abc = run->abc;
+        LeaveCriticalSection(&cs_script_cache);
+        return TRUE;
+    }
+    LeaveCriticalSection(&cs_script_cache);
+    return FALSE;
+}
+
+static void cache_placed_run(ScriptCache *sc, const SCRIPT_ANALYSIS *psa, OPENTYPE_TAG script_tag,
+        OPENTYPE_TAG lang_tag, const WORD *glyphs, const SCRIPT_GLYPHPROP *glyph_props, int glyph_count,
+        const int *advances, const GOFFSET *goffsets, const ABC *abc)
+{
+    struct placed_run *run;
+
+    if (!(run = heap_alloc_zero(sizeof(*run)))) return;
+    run->a = *psa;
+    run->script_tag = script_tag;
+    run->lang_tag = lang_tag;
+    run->glyph_count = glyph_count;
+    if (!(run->glyphs = heap_alloc(glyph_count * sizeof(*run->glyphs)))
+            || !(run->glyph_props = heap_alloc(glyph_count * sizeof(*run->glyph_props)))
+            || !(run->advances = heap_alloc(glyph_count * sizeof(*run->advances)))
+            || !(run->goffsets = heap_alloc(glyph_count * sizeof(*run->goffsets))))
+    {
+        placed_run_destroy(run);
+        return;
+    }
+    memcpy(run->glyphs, glyphs, glyph_count * sizeof(*run->glyphs));
+    memcpy(run->glyph_props, glyph_props, glyph_count * sizeof(*run->glyph_props));
+    memcpy(run->advances, advances, glyph_count * sizeof(*run->advances));
+    memcpy(run->goffsets, goffsets, glyph_count * sizeof(*run->goffsets));
+    if ((run->has_abc = !!abc)) run->abc = *abc;
+    run->size = sizeof(*run) + glyph_count * (sizeof(*run->glyphs) + sizeof(*run->glyph_props)
+            + sizeof(*run->advances) + sizeof(*run->goffsets));
+
+    EnterCriticalSection(&cs_script_cache);
+    list_add_head(&sc->placed_runs, &run->entry);
+    sc->placed_runs_size += run->size;
+    while (sc->placed_runs_size > RUN_CACHE_LIMIT)
+    {
+        struct placed_run *tail = LIST_ENTRY(list_tail(&sc->placed_runs), struct placed_run, entry);
+        if (tail == run) break;
+        list_remove(&tail->entry);
+        sc->placed_runs_size -= tail->size;
+        placed_run_destroy(tail);
+    }
+    LeaveCriticalSection(&cs_script_cache);
+}
+
 static HRESULT init_script_cache(const HDC hdc, SCRIPT_CACHE *psc)
 {
     ScriptCache *sc;
@@ -811,6 +1016,8 @@ static HRESULT init_script_cache(const HDC hdc, SCRIPT_CACHE *psc)
     LeaveCriticalSection(&cs_script_cache);
 
     if (!(sc = heap_alloc_zero(sizeof(ScriptCache)))) return E_OUTOFMEMORY;
+    list_init(&sc->shaped_runs);
+    list_init(&sc->placed_runs);
     if (!GetTextMetricsW(hdc, &sc->tm))
     {
         heap_free(sc);
@@ -1044,6 +1251,20 @@ HRESULT WINAPI ScriptFreeCache(SCRIPT_CACHE *psc)
             heap_free(((ScriptCache *)*psc)->scripts[n].languages);
         }
         heap_free(((ScriptCache *)*psc)->scripts);
+        while (!list_empty(&((ScriptCache *)*psc)->shaped_runs))
+        {
+            struct shaped_run *run = LIST_ENTRY(list_head(&((ScriptCache *)*psc)->shaped_runs),
+                                                struct shaped_run, entry);
+            list_remove(&run->entry);
+            shaped_run_destroy(run);
+        }
+        while (!list_empty(&((ScriptCache *)*psc)->placed_runs))
+        {
+            struct placed_run *run = LIST_ENTRY(list_head(&((ScriptCache *)*psc)->placed_runs),
+                                                struct placed_run, entry);
+            list_remove(&run->entry);
+            placed_run_destroy(run);
+        }
         heap_free(((ScriptCache *)*psc)->otm);
         heap_free(*psc);
         *psc = NULL;
@@ -3073,6 +3294,11 @@ HRESULT WINAPI ScriptShapeOpenType( HDC hdc, SCRIPT_CACHE *psc,
     ((ScriptCache *)*psc)->userScript = tagScript;
     ((ScriptCache *)*psc)->userLang = tagLangSys;
 
+    if (psa && !cRanges && !psa->fNoGlyphIndex && ((ScriptCache *)*psc)->sfnt
+            && get_cached_shaped_run((ScriptCache *)*psc, psa, tagScript, tagLangSys, pwcChars, cChars,
+                                     cMaxGlyphs, pwLogClust, pCharProps, pwOutGlyphs, pOutGlyphProps, pcGlyphs))
+        return S_OK;
+
     /* Initialize a SCRIPT_VISATTR and LogClust for each char in this run */
     for (i = 0; i < cChars; i++)
     {
@@ -3168,6 +3394,10 @@ HRESULT WINAPI ScriptShapeOpenType( HDC hdc, SCRIPT_CACHE *psc,
                 pOutGlyphProps[pwLogClust[i]].sva.fZeroWidth = 1;
             }
         }
+
+        if (!cRanges)
+            cache_shaped_run((ScriptCache *)*psc, psa, tagScript, tagLangSys, pwcChars, cChars,
+                             cMaxGlyphs, pwLogClust, pCharProps, pwOutGlyphs, pOutGlyphProps, *pcGlyphs);
         heap_free(rChars);
     }
     else
@@ -3327,6 +3557,11 @@ HRESULT WINAPI ScriptPlaceOpenType( HDC hdc, SCRIPT_CACHE *psc, SCRIPT_ANALYSIS
     ((ScriptCache *)*psc)->userScript = tagScript;
     ((ScriptCache *)*psc)->userLang = tagLangSys;
 
+    if (!cRanges && piAdvance && !psa->fNoGlyphIndex
+            && get_cached_placed_run((ScriptCache *)*psc, psa, tagScript, tagLangSys, pwGlyphs,
+                                     pGlyphProps, cGlyphs, piAdvance, pGoffset, pABC))
+        return S_OK;
+
     if (pABC) memset(pABC, 0, sizeof(ABC));
     for (i = 0; i < cGlyphs; i++)
     {
@@ -3395,6 +3630,10 @@ HRESULT WINAPI ScriptPlaceOpenType( HDC hdc, SCRIPT_CACHE *psc, SCRIPT_ANALYSIS
 
     SHAPE_ApplyOpenTypePositions(hdc, (ScriptCache *)*psc, psa, pwGlyphs, cGlyphs, piAdvance, pGoffset);
 
+    if (!cRanges && piAdvance && !psa->fNoGlyphIndex)
+        cache_placed_run((ScriptCache *)*psc, psa, tagScript, tagLangSys, pwGlyphs, pGlyphProps,
+                         cGlyphs, piAdvance, pGoffset, pABC);
+
     if (pABC) TRACE("Total for run: abcA=%d, abcB=%d, abcC=%d\n", pABC->abcA, pABC->abcB, pABC->abcC);
     return S_OK;
 }
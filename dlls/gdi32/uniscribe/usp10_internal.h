@@ -205,6 +205,11 @@ typedef struct {
     SIZE_T scripts_size;
     SIZE_T script_count;
 
+    struct list shaped_runs;
+    SIZE_T shaped_runs_size;
+    struct list placed_runs;
+    SIZE_T placed_runs_size;
+
     OPENTYPE_TAG userScript;
     OPENTYPE_TAG userLang;
 } ScriptCache;
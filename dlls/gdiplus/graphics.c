@@ -519,6 +519,35 @@ static GpStatus alpha_blend_bmp_pixels(GpGraphics *graphics, INT dst_x, INT dst_
     INT x, y;
     CompositingMode comp_mode = graphics->compmode;
 
+    if (dst_bitmap->format == PixelFormat32bppARGB)
+    {
+        /* Avoid the per-pixel Get/SetPixel format dispatch for the common
+         * destination format; the callers have already clipped the rectangle
+         * to the bitmap bounds. */
+        for (y=0; y<src_height; y++)
+        {
+            const ARGB *src_row = (const ARGB*)(src + src_stride * y);
+            ARGB *dst_row = (ARGB*)(dst_bitmap->bits + dst_bitmap->stride * (y + dst_y)) + dst_x;
+
+            for (x=0; x<src_width; x++)
+            {
+                ARGB src_color = src_row[x];
+
+                if (comp_mode == CompositingModeSourceCopy)
+                    dst_row[x] = (src_color & 0xff000000) ? src_color : 0;
+                else if (src_color & 0xff000000)
+                {
+                    if (fmt & PixelFormatPAlpha)
+                        dst_row[x] = color_over_fgpremult(dst_row[x], src_color);
+                    else
+                        dst_row[x] = color_over(dst_row[x], src_color);
+                }
+            }
+        }
+
+        return Ok;
+    }
+
     for (y=0; y<src_height; y++)
     {
         for (x=0; x<src_width; x++)
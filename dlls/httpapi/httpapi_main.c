@@ -377,6 +377,91 @@ static void format_date(char *buffer)
             date.wYear, date.wHour, date.wMinute, date.wSecond);
 }
 
+/* Compute the size in bytes of a data chunk, reading the file size if
+ * necessary for file handle chunks. */
+static ULONG get_chunk_length(const HTTP_DATA_CHUNK *chunk, ULONG *ret_len)
+{
+    LARGE_INTEGER file_size;
+    ULONGLONG len;
+
+    switch (chunk->DataChunkType)
+    {
+    case HttpDataChunkFromMemory:
+        *ret_len = chunk->FromMemory.BufferLength;
+        return ERROR_SUCCESS;
+
+    case HttpDataChunkFromFileHandle:
+        len = chunk->FromFileHandle.ByteRange.Length.QuadPart;
+        if (len == HTTP_BYTE_RANGE_TO_EOF)
+        {
+            if (!GetFileSizeEx(chunk->FromFileHandle.FileHandle, &file_size))
+                return GetLastError();
+            if (chunk->FromFileHandle.ByteRange.StartingOffset.QuadPart >= file_size.QuadPart)
+                len = 0;
+            else
+                len = file_size.QuadPart - chunk->FromFileHandle.ByteRange.StartingOffset.QuadPart;
+        }
+        if (len > 0xffffffff)
+        {
+            FIXME("File chunk of %s bytes not supported.\n", wine_dbgstr_longlong(len));
+            return ERROR_INVALID_PARAMETER;
+        }
+        *ret_len = len;
+        return ERROR_SUCCESS;
+
+    default:
+        FIXME("Unhandled data chunk type %u.\n", chunk->DataChunkType);
+        return ERROR_CALL_NOT_IMPLEMENTED;
+    }
+}
+
+/* Copy a chunk's data into the response buffer. "len" was returned by
+ * get_chunk_length(). */
+static ULONG copy_chunk_data(char *p, const HTTP_DATA_CHUNK *chunk, ULONG len)
+{
+    OVERLAPPED ovl = {};
+    ULONGLONG offset;
+    ULONG ret = ERROR_SUCCESS;
+    DWORD count;
+
+    if (chunk->DataChunkType == HttpDataChunkFromMemory)
+    {
+        memcpy(p, chunk->FromMemory.pBuffer, len);
+        return ERROR_SUCCESS;
+    }
+
+    /* The file handle may be open for overlapped I/O, so read through an
+     * OVERLAPPED even if it's not; this also avoids moving the file pointer. */
+    offset = chunk->FromFileHandle.ByteRange.StartingOffset.QuadPart;
+    ovl.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+    while (len)
+    {
+        ovl.Offset = offset;
+        ovl.OffsetHigh = offset >> 32;
+        if (!ReadFile(chunk->FromFileHandle.FileHandle, p, len, NULL, &ovl)
+                && GetLastError() != ERROR_IO_PENDING)
+        {
+            ret = GetLastError();
+            break;
+        }
+        if (!GetOverlappedResult(chunk->FromFileHandle.FileHandle, &ovl, &count, TRUE))
+        {
+            ret = GetLastError();
+            break;
+        }
+        if (!count)
+        {
+            ret = ERROR_HANDLE_EOF;
+            break;
+        }
+        p += count;
+        offset += count;
+        len -= count;
+    }
+    CloseHandle(ovl.hEvent);
+    return ret;
+}
+
 /***********************************************************************
  *        HttpSendHttpResponse     (HTTPAPI.@)
  */
@@ -420,6 +505,7 @@ ULONG WINAPI HttpSendHttpResponse(HANDLE queue, HTTP_REQUEST_ID id, ULONG flags,
 
     struct http_response *buffer;
     OVERLAPPED dummy_ovl = {};
+    ULONG *chunk_lens = NULL;
     ULONG ret = ERROR_SUCCESS;
     int len, body_len = 0;
     char *p, dummy[12];
@@ -439,15 +525,19 @@ ULONG WINAPI HttpSendHttpResponse(HANDLE queue, HTTP_REQUEST_ID id, ULONG flags,
     if (log_data)
         WARN("Ignoring log_data.\n");
 
+    if (response->s.EntityChunkCount
+            && !(chunk_lens = malloc(response->s.EntityChunkCount * sizeof(*chunk_lens))))
+        return ERROR_OUTOFMEMORY;
+
     len = 12 + sprintf(dummy, "%hu", response->s.StatusCode) + response->s.ReasonLength;
     for (i = 0; i < response->s.EntityChunkCount; ++i)
     {
-        if (response->s.pEntityChunks[i].DataChunkType != HttpDataChunkFromMemory)
+        if ((ret = get_chunk_length(&response->s.pEntityChunks[i], &chunk_lens[i])))
         {
-            FIXME("Unhandled data chunk type %u.\n", response->s.pEntityChunks[i].DataChunkType);
-            return ERROR_CALL_NOT_IMPLEMENTED;
+            free(chunk_lens);
+            return ret;
         }
-        body_len += response->s.pEntityChunks[i].FromMemory.BufferLength;
+        body_len += chunk_lens[i];
     }
     len += body_len;
     for (i = 0; i < HttpHeaderResponseMaximum; ++i)
@@ -470,40 +560,50 @@ ULONG WINAPI HttpSendHttpResponse(HANDLE queue, HTTP_REQUEST_ID id, ULONG flags,
     len += 2;
 
     if (!(buffer = malloc(offsetof(struct http_response, buffer[len]))))
+    {
+        free(chunk_lens);
         return ERROR_OUTOFMEMORY;
+    }
     buffer->id = id;
     buffer->response_flags = flags;
     buffer->len = len;
-    sprintf(buffer->buffer, "HTTP/1.1 %u %.*s\r\n", response->s.StatusCode,
+    p = buffer->buffer + sprintf(buffer->buffer, "HTTP/1.1 %u %.*s\r\n", response->s.StatusCode,
             response->s.ReasonLength, response->s.pReason);
 
     for (i = 0; i < HttpHeaderResponseMaximum; ++i)
     {
         const HTTP_KNOWN_HEADER *header = &response->s.Headers.KnownHeaders[i];
         if (i == HttpHeaderDate)
-            format_date(buffer->buffer);
+        {
+            format_date(p);
+            p += strlen(p);
+        }
         else if (header->RawValueLength)
-            sprintf(buffer->buffer + strlen(buffer->buffer), "%s: %.*s\r\n",
+            p += sprintf(p, "%s: %.*s\r\n",
                     header_names[i], header->RawValueLength, header->pRawValue);
         else if (i == HttpHeaderContentLength && !(flags & HTTP_SEND_RESPONSE_FLAG_MORE_DATA))
-            sprintf(buffer->buffer + strlen(buffer->buffer), "Content-Length: %d\r\n", body_len);
+            p += sprintf(p, "Content-Length: %d\r\n", body_len);
     }
     for (i = 0; i < response->s.Headers.UnknownHeaderCount; ++i)
     {
         const HTTP_UNKNOWN_HEADER *header = &response->s.Headers.pUnknownHeaders[i];
-        sprintf(buffer->buffer + strlen(buffer->buffer), "%.*s: %.*s\r\n", header->NameLength,
+        p += sprintf(p, "%.*s: %.*s\r\n", header->NameLength,
                 header->pName, header->RawValueLength, header->pRawValue);
     }
-    p = buffer->buffer + strlen(buffer->buffer);
     /* Don't use strcat, because this might be the end of the buffer. */
     memcpy(p, "\r\n", 2);
     p += 2;
     for (i = 0; i < response->s.EntityChunkCount; ++i)
     {
-        const HTTP_DATA_CHUNK *chunk = &response->s.pEntityChunks[i];
-        memcpy(p, chunk->FromMemory.pBuffer, chunk->FromMemory.BufferLength);
-        p += chunk->FromMemory.BufferLength;
+        if ((ret = copy_chunk_data(p, &response->s.pEntityChunks[i], chunk_lens[i])))
+        {
+            free(chunk_lens);
+            free(buffer);
+            return ret;
+        }
+        p += chunk_lens[i];
     }
+    free(chunk_lens);
 
     if (!ovl)
         ovl = &dummy_ovl;
@@ -543,6 +643,7 @@ ULONG WINAPI HttpSendResponseEntityBody(HANDLE queue, HTTP_REQUEST_ID id,
 {
     struct http_response *buffer;
     OVERLAPPED dummy_ovl = {};
+    ULONG *chunk_lens = NULL;
     ULONG ret = NO_ERROR;
     int len = 0;
     char *p;
@@ -561,19 +662,25 @@ ULONG WINAPI HttpSendResponseEntityBody(HANDLE queue, HTTP_REQUEST_ID id,
     if (log_data)
         WARN("Ignoring log_data.\n");
 
+    if (entity_chunk_count && !(chunk_lens = malloc(entity_chunk_count * sizeof(*chunk_lens))))
+        return ERROR_OUTOFMEMORY;
+
     /* Compute the length of the body. */
     for (i = 0; i < entity_chunk_count; ++i)
     {
-        if (entity_chunks[i].DataChunkType != HttpDataChunkFromMemory)
+        if ((ret = get_chunk_length(&entity_chunks[i], &chunk_lens[i])))
         {
-            FIXME("Unhandled data chunk type %u.\n", entity_chunks[i].DataChunkType);
-            return ERROR_CALL_NOT_IMPLEMENTED;
+            free(chunk_lens);
+            return ret;
         }
-        len += entity_chunks[i].FromMemory.BufferLength;
+        len += chunk_lens[i];
     }
 
     if (!(buffer = malloc(offsetof(struct http_response, buffer[len]))))
+    {
+        free(chunk_lens);
         return ERROR_OUTOFMEMORY;
+    }
     buffer->id = id;
     buffer->response_flags = flags;
     buffer->len = len;
@@ -581,10 +688,15 @@ ULONG WINAPI HttpSendResponseEntityBody(HANDLE queue, HTTP_REQUEST_ID id,
     p = buffer->buffer;
     for (i = 0; i < entity_chunk_count; ++i)
     {
-        const HTTP_DATA_CHUNK *chunk = &entity_chunks[i];
-        memcpy(p, chunk->FromMemory.pBuffer, chunk->FromMemory.BufferLength);
-        p += chunk->FromMemory.BufferLength;
+        if ((ret = copy_chunk_data(p, &entity_chunks[i], chunk_lens[i])))
+        {
+            free(chunk_lens);
+            free(buffer);
+            return ret;
+        }
+        p += chunk_lens[i];
     }
+    free(chunk_lens);
 
     if (!ovl)
     {
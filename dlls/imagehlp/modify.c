@@ -138,23 +138,30 @@ BOOL WINAPI BindImageEx(DWORD flags, const char *module, const char *dll_path,
 static WORD CalcCheckSum(
   DWORD StartValue, LPVOID BaseAddress, DWORD WordCount)
 {
-   LPWORD Ptr;
-   DWORD Sum;
-   DWORD i;
-
-   Sum = StartValue;
-   Ptr = (LPWORD)BaseAddress;
-   for (i = 0; i < WordCount; i++)
+   const WORD *Ptr = BaseAddress;
+   ULONG64 Sum = StartValue;
+   DWORD i = 0;
+
+   /* The ones-complement sum doesn't depend on how the words are grouped,
+      so accumulate a dword at a time into a 64-bit value and fold the
+      carries back in at the end.  The accumulator cannot wrap for any
+      mappable file size, and the branch-free loop is easy for the compiler
+      to vectorize. */
+   if (!((ULONG_PTR)Ptr & (sizeof(DWORD) - 1)))
      {
-	Sum += *Ptr;
-	if (HIWORD(Sum) != 0)
-	  {
-	     Sum = LOWORD(Sum) + HIWORD(Sum);
-	  }
-	Ptr++;
+	const DWORD *DwordPtr = (const DWORD *)Ptr;
+
+	for (; i + 2 <= WordCount; i += 2)
+	   Sum += *DwordPtr++;
      }
 
-   return (WORD)(LOWORD(Sum) + HIWORD(Sum));
+   for (; i < WordCount; i++)
+      Sum += Ptr[i];
+
+   while (Sum >> 16)
+      Sum = (Sum & 0xffff) + (Sum >> 16);
+
+   return (WORD)Sum;
 }
 
 
@@ -140,12 +140,92 @@ BOOL WINAPI CancelIPChangeNotify(LPOVERLAPPED overlapped)
 }
 
 
+/* registration created by NotifyIpInterfaceChange, canceled by CancelMibChangeNotify2 */
+struct mib_change_notification
+{
+    HANDLE thread;
+    HANDLE cancel;
+    PIPINTERFACE_CHANGE_CALLBACK callback;
+    void *context;
+    unsigned int count;
+    struct
+    {
+        const NPI_MODULEID *module;
+        DWORD table;
+    } sources[3];
+    OVERLAPPED ovr[3];
+    HANDLE events[3];
+};
+
+static DWORD change_notification_arm( struct mib_change_notification *notif, unsigned int i )
+{
+    HANDLE device;
+    DWORD err;
+
+    ResetEvent( notif->events[i] );
+    memset( &notif->ovr[i], 0, sizeof(notif->ovr[i]) );
+    notif->ovr[i].hEvent = notif->events[i];
+    err = NsiRequestChangeNotification( 0, notif->sources[i].module, notif->sources[i].table,
+                                        &notif->ovr[i], &device );
+    if (err == ERROR_IO_PENDING) return NO_ERROR;
+    SetEvent( notif->events[i] ); /* nothing pending, keep later waits from blocking */
+    return err;
+}
+
+static DWORD WINAPI change_notification_thread( void *arg )
+{
+    struct mib_change_notification *notif = arg;
+    HANDLE handles[1 + ARRAY_SIZE(notif->events)];
+    unsigned int i;
+    DWORD ret;
+
+    SetThreadDescription( GetCurrentThread(), L"wine_iphlpapi_change_notification" );
+
+    handles[0] = notif->cancel;
+    for (i = 0; i < notif->count; i++) handles[1 + i] = notif->events[i];
+
+    for (;;)
+    {
+        ret = WaitForMultipleObjects( 1 + notif->count, handles, FALSE, INFINITE );
+        if (ret <= WAIT_OBJECT_0 || ret > WAIT_OBJECT_0 + notif->count) break;
+        if (change_notification_arm( notif, ret - WAIT_OBJECT_0 - 1 )) break;
+        notif->callback( notif->context, NULL, MibParameterNotification );
+    }
+    return 0;
+}
+
+static void change_notification_free( struct mib_change_notification *notif, unsigned int armed )
+{
+    unsigned int i;
+
+    for (i = 0; i < armed; i++)
+    {
+        NsiCancelChangeNotification( &notif->ovr[i] );
+        /* the canceled request completes asynchronously, wait for it before
+         * releasing the OVERLAPPED it writes to */
+        WaitForSingleObject( notif->events[i], INFINITE );
+    }
+    for (i = 0; i < notif->count; i++)
+        if (notif->events[i]) CloseHandle( notif->events[i] );
+    if (notif->cancel) CloseHandle( notif->cancel );
+    heap_free( notif );
+}
+
 /******************************************************************
  *    CancelMibChangeNotify2 (IPHLPAPI.@)
  */
 DWORD WINAPI CancelMibChangeNotify2(HANDLE handle)
 {
-    FIXME("(handle %p): stub\n", handle);
+    struct mib_change_notification *notif = handle;
+
+    TRACE("(handle %p)\n", handle);
+
+    if (!notif) return NO_ERROR;
+
+    SetEvent( notif->cancel );
+    WaitForSingleObject( notif->thread, INFINITE );
+    CloseHandle( notif->thread );
+    change_notification_free( notif, notif->count );
     return NO_ERROR;
 }
 
@@ -1319,36 +1399,129 @@ err:
     return err;
 }
 
+/* cached snapshot of the last GetAdaptersAddresses result, invalidated by
+ * nsi change notifications */
+static struct
+{
+    IP_ADAPTER_ADDRESSES *info;
+    ULONG count;
+    ULONG family;
+    ULONG flags;
+    BOOL disabled; /* change notifications are unavailable, don't cache */
+    OVERLAPPED ovr[3];
+    HANDLE events[3];
+} addr_cache;
+
+static CRITICAL_SECTION addr_cache_cs;
+static CRITICAL_SECTION_DEBUG addr_cache_cs_debug =
+{
+    0, 0, &addr_cache_cs,
+    { &addr_cache_cs_debug.ProcessLocksList, &addr_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": addr_cache_cs") }
+};
+static CRITICAL_SECTION addr_cache_cs = { &addr_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static DWORD addr_cache_arm( unsigned int i )
+{
+    static const struct
+    {
+        const NPI_MODULEID *module;
+        DWORD table;
+    } sources[] =
+    {
+        { &NPI_MS_IPV4_MODULEID, NSI_IP_UNICAST_TABLE },
+        { &NPI_MS_IPV6_MODULEID, NSI_IP_UNICAST_TABLE },
+        { &NPI_MS_NDIS_MODULEID, NSI_NDIS_IFINFO_TABLE },
+    };
+    HANDLE handle;
+    DWORD err;
+
+    if (!addr_cache.events[i] && !(addr_cache.events[i] = CreateEventW( NULL, TRUE, FALSE, NULL )))
+        return GetLastError();
+    ResetEvent( addr_cache.events[i] );
+    memset( &addr_cache.ovr[i], 0, sizeof(addr_cache.ovr[i]) );
+    addr_cache.ovr[i].hEvent = addr_cache.events[i];
+    err = NsiRequestChangeNotification( 0, sources[i].module, sources[i].table, &addr_cache.ovr[i], &handle );
+    return err == ERROR_IO_PENDING ? ERROR_SUCCESS : err;
+}
+
+/* Caller must hold addr_cache_cs.  Returns TRUE if the cached snapshot can
+ * serve a query with the given parameters, re-arming notifications as needed. */
+static BOOL addr_cache_usable( ULONG family, ULONG flags )
+{
+    unsigned int i;
+    BOOL fresh = TRUE;
+
+    if (addr_cache.disabled) return FALSE;
+
+    for (i = 0; i < ARRAY_SIZE(addr_cache.events); i++)
+    {
+        if (addr_cache.events[i] && WaitForSingleObject( addr_cache.events[i], 0 ) != WAIT_OBJECT_0)
+            continue;
+        /* not armed yet, or a change notification fired */
+        if (addr_cache_arm( i ))
+        {
+            addr_cache.disabled = TRUE;
+            return FALSE;
+        }
+        fresh = FALSE;
+    }
+    return fresh && addr_cache.info && addr_cache.family == family && addr_cache.flags == flags;
+}
+
 ULONG WINAPI DECLSPEC_HOTPATCH GetAdaptersAddresses( ULONG family, ULONG flags, void *reserved,
                                                      IP_ADAPTER_ADDRESSES *aa, ULONG *size )
 {
     IP_ADAPTER_ADDRESSES *info, **sorted;
-    DWORD err, needed, count;
+    DWORD err = ERROR_SUCCESS, needed, count;
 
     TRACE( "(%ld, %08lx, %p, %p, %p)\n", family, flags, reserved, aa, size );
 
     if (!size) return ERROR_INVALID_PARAMETER;
 
-    err = adapters_addresses_alloc( family, flags, &info, &count );
-    if (err) return err;
+    EnterCriticalSection( &addr_cache_cs );
 
-    needed = adapters_addresses_size( info );
-    if (!aa || *size < needed)
+    if (addr_cache_usable( family, flags ))
     {
-        *size = needed;
-        err = ERROR_BUFFER_OVERFLOW;
+        info = addr_cache.info;
+        count = addr_cache.count;
     }
     else
     {
-        if (!(sorted = adapters_addresses_sort( info, count ))) err = ERROR_OUTOFMEMORY;
+        /* notifications are armed before building, so a change racing with
+         * the rebuild invalidates the snapshot on the next query */
+        err = adapters_addresses_alloc( family, flags, &info, &count );
+        if (!err && !addr_cache.disabled)
+        {
+            adapters_addresses_free( addr_cache.info );
+            addr_cache.info = info;
+            addr_cache.count = count;
+            addr_cache.family = family;
+            addr_cache.flags = flags;
+        }
+    }
+
+    if (!err)
+    {
+        needed = adapters_addresses_size( info );
+        if (!aa || *size < needed)
+        {
+            *size = needed;
+            err = ERROR_BUFFER_OVERFLOW;
+        }
         else
         {
-            adapters_addresses_copy( aa, sorted, count );
-            heap_free( sorted );
+            if (!(sorted = adapters_addresses_sort( info, count ))) err = ERROR_OUTOFMEMORY;
+            else
+            {
+                adapters_addresses_copy( aa, sorted, count );
+                heap_free( sorted );
+            }
         }
+        if (info != addr_cache.info) adapters_addresses_free( info );
     }
 
-    adapters_addresses_free( info );
+    LeaveCriticalSection( &addr_cache_cs );
     return err;
 }
 
@@ -3892,9 +4065,57 @@ DWORD WINAPI NotifyAddrChange(PHANDLE Handle, LPOVERLAPPED overlapped)
 DWORD WINAPI NotifyIpInterfaceChange(ADDRESS_FAMILY family, PIPINTERFACE_CHANGE_CALLBACK callback,
                                      PVOID context, BOOLEAN init_notify, PHANDLE handle)
 {
-    FIXME("(family %d, callback %p, context %p, init_notify %d, handle %p): stub\n",
+    struct mib_change_notification *notif;
+    unsigned int i;
+    DWORD err;
+
+    TRACE("(family %d, callback %p, context %p, init_notify %d, handle %p)\n",
           family, callback, context, init_notify, handle);
-    if (handle) *handle = NULL;
+
+    if (!callback || !handle) return ERROR_INVALID_PARAMETER;
+    *handle = NULL;
+    if (family != AF_UNSPEC && family != AF_INET && family != AF_INET6) return ERROR_INVALID_PARAMETER;
+
+    if (!(notif = heap_alloc_zero( sizeof(*notif) ))) return ERROR_NOT_ENOUGH_MEMORY;
+    notif->callback = callback;
+    notif->context = context;
+
+    if (family != AF_INET6)
+    {
+        notif->sources[notif->count].module = &NPI_MS_IPV4_MODULEID;
+        notif->sources[notif->count++].table = NSI_IP_UNICAST_TABLE;
+    }
+    if (family != AF_INET)
+    {
+        notif->sources[notif->count].module = &NPI_MS_IPV6_MODULEID;
+        notif->sources[notif->count++].table = NSI_IP_UNICAST_TABLE;
+    }
+    notif->sources[notif->count].module = &NPI_MS_NDIS_MODULEID;
+    notif->sources[notif->count++].table = NSI_NDIS_IFINFO_TABLE;
+
+    if (!(notif->cancel = CreateEventW( NULL, TRUE, FALSE, NULL )))
+    {
+        err = GetLastError();
+        change_notification_free( notif, 0 );
+        return err;
+    }
+    for (i = 0; i < notif->count; i++)
+    {
+        if (!(notif->events[i] = CreateEventW( NULL, TRUE, FALSE, NULL ))) err = GetLastError();
+        else if (!(err = change_notification_arm( notif, i ))) continue;
+        change_notification_free( notif, i );
+        return err;
+    }
+
+    if (init_notify) callback( context, NULL, MibInitialNotification );
+
+    if (!(notif->thread = CreateThread( NULL, 0, change_notification_thread, notif, 0, NULL )))
+    {
+        err = GetLastError();
+        change_notification_free( notif, notif->count );
+        return err;
+    }
+    *handle = notif;
     return NO_ERROR;
 }
 
@@ -449,7 +449,7 @@ static HRESULT compile_member_expression(compiler_ctx_t *ctx, member_expression_
     if(FAILED(hres))
         return hres;
 
-    return push_instr_bstr(ctx, OP_member, expr->identifier);
+    return push_instr_bstr_uint(ctx, OP_member, expr->identifier, ctx->code->member_cache_cnt++);
 }
 
 #define LABEL_FLAG 0x80000000
@@ -2456,28 +2456,144 @@ unsigned get_location_line(bytecode_t *code, unsigned loc, unsigned *char_pos)
     return line;
 }
 
-void release_bytecode(bytecode_t *code)
+/* Script hosts commonly recompile identical source, e.g. on every reload of a
+ * page. Instead of freeing released bytecode right away, the last few
+ * compilations are kept in a list and handed back to compile_script when the
+ * source and all inputs affecting the compilation match. Cached bytecode is
+ * owned exclusively by the cache, so reusing it is just a matter of resetting
+ * the per-instance state. Interned strings in str_pool use non-atomic
+ * refcounts and may still be referenced by live objects of the thread that
+ * compiled them, so each entry is tagged with the releasing thread id and is
+ * only ever reused or freed on that thread (except at process detach). */
+#define CODE_CACHE_SIZE 8
+
+static struct list code_cache = LIST_INIT(code_cache);
+
+static CRITICAL_SECTION code_cache_cs;
+static CRITICAL_SECTION_DEBUG code_cache_cs_debug =
 {
-    unsigned i;
+    0, 0, &code_cache_cs,
+    { &code_cache_cs_debug.ProcessLocksList, &code_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": code_cache_cs") }
+};
+static CRITICAL_SECTION code_cache_cs = { &code_cache_cs_debug, -1, 0, 0, 0, 0 };
 
-    if(--code->ref)
-        return;
+static unsigned hash_source(const WCHAR *p)
+{
+    unsigned hash = 5381;
+    for(; *p; p++)
+        hash = hash * 33 + *p;
+    return hash;
+}
+
+static void free_bytecode(bytecode_t *code)
+{
+    unsigned i;
 
     for(i=0; i < code->bstr_cnt; i++)
         SysFreeString(code->bstr_pool[i]);
     for(i=0; i < code->str_cnt; i++)
         jsstr_release(code->str_pool[i]);
 
-    if(code->named_item)
-        release_named_item(code->named_item);
     free(code->source);
     heap_pool_free(&code->heap);
     free(code->bstr_pool);
     free(code->str_pool);
+    free(code->member_caches);
+    free(code->compile_delimiter);
     free(code->instrs);
     free(code);
 }
 
+static bytecode_t *find_cached_code(script_ctx_t *ctx, const WCHAR *source, const WCHAR *delimiter)
+{
+    DWORD thread_id = GetCurrentThreadId();
+    unsigned hash;
+    bytecode_t *code;
+
+    /* conditional compilation state may change how the source parses */
+    if(ctx->cc)
+        return NULL;
+
+    hash = hash_source(source);
+
+    EnterCriticalSection(&code_cache_cs);
+
+    LIST_FOR_EACH_ENTRY(code, &code_cache, bytecode_t, entry) {
+        if(code->cache_thread_id != thread_id)
+            continue;
+        if(code->source_hash != hash || code->compile_version != ctx->version
+           || code->compile_html_mode != ctx->html_mode)
+            continue;
+        if(wcscmp(code->source, source))
+            continue;
+        if(!code->compile_delimiter != !delimiter
+           || (delimiter && wcscmp(code->compile_delimiter, delimiter)))
+            continue;
+
+        list_remove(&code->entry);
+        LeaveCriticalSection(&code_cache_cs);
+
+        code->ref = 1;
+        /* object ids are thread-specific */
+        if(code->member_cache_cnt)
+            memset(code->member_caches, 0, code->member_cache_cnt * sizeof(*code->member_caches));
+        TRACE("reusing %p\n", code);
+        return code;
+    }
+
+    LeaveCriticalSection(&code_cache_cs);
+    return NULL;
+}
+
+void release_bytecode(bytecode_t *code)
+{
+    bytecode_t *iter, *evict = NULL;
+    unsigned cnt = 0;
+
+    if(--code->ref)
+        return;
+
+    if(code->named_item) {
+        release_named_item(code->named_item);
+        code->named_item = NULL;
+    }
+
+    if(!code->cacheable) {
+        free_bytecode(code);
+        return;
+    }
+
+    code->is_persistent = FALSE;
+    code->cache_thread_id = GetCurrentThreadId();
+
+    EnterCriticalSection(&code_cache_cs);
+    list_add_head(&code_cache, &code->entry);
+    /* only entries from the current thread count against the quota, and only
+     * those may be evicted; the oldest one is the last match from the head */
+    LIST_FOR_EACH_ENTRY(iter, &code_cache, bytecode_t, entry) {
+        if(iter->cache_thread_id != code->cache_thread_id)
+            continue;
+        if(++cnt > CODE_CACHE_SIZE)
+            evict = iter;
+    }
+    if(evict)
+        list_remove(&evict->entry);
+    LeaveCriticalSection(&code_cache_cs);
+
+    if(evict)
+        free_bytecode(evict);
+}
+
+void free_code_cache(void)
+{
+    bytecode_t *code, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE(code, next, &code_cache, bytecode_t, entry)
+        free_bytecode(code);
+    list_init(&code_cache);
+}
+
 static HRESULT init_code(compiler_ctx_t *compiler, const WCHAR *source, UINT64 source_context, unsigned start_line)
 {
     size_t len = source ? lstrlenW(source) : 0;
@@ -2727,8 +2843,20 @@ HRESULT compile_script(script_ctx_t *ctx, const WCHAR *code, UINT64 source_conte
                        named_item_t *named_item, bytecode_t **ret)
 {
     compiler_ctx_t compiler = {0};
+    bytecode_t *cached;
     HRESULT hres;
 
+    if(code && !args && !use_decode && !from_eval && (cached = find_cached_code(ctx, code, delimiter))) {
+        cached->source_context = source_context;
+        cached->start_line = start_line;
+        if(named_item) {
+            cached->named_item = named_item;
+            named_item->ref++;
+        }
+        *ret = cached;
+        return S_OK;
+    }
+
     hres = init_code(&compiler, code, source_context, start_line);
     if(FAILED(hres))
         return hres;
@@ -2766,6 +2894,19 @@ HRESULT compile_script(script_ctx_t *ctx, const WCHAR *code, UINT64 source_conte
         return DISP_E_EXCEPTION;
     }
 
+    if(compiler.code->member_cache_cnt &&
+       !(compiler.code->member_caches = calloc(compiler.code->member_cache_cnt, sizeof(*compiler.code->member_caches)))) {
+        release_bytecode(compiler.code);
+        return E_OUTOFMEMORY;
+    }
+
+    if(!args && !use_decode && !from_eval && !ctx->cc) {
+        compiler.code->source_hash = hash_source(compiler.code->source);
+        compiler.code->compile_version = ctx->version;
+        compiler.code->compile_html_mode = ctx->html_mode;
+        compiler.code->cacheable = !delimiter || !!(compiler.code->compile_delimiter = wcsdup(delimiter));
+    }
+
     if(named_item) {
         compiler.code->named_item = named_item;
         named_item->ref++;
@@ -2482,6 +2482,7 @@ HRESULT init_dispex(jsdisp_t *dispex, script_ctx_t *ctx, const builtin_info_t *b
     dispex->extensible = TRUE;
     dispex->is_constructor = builtin_info->class == JSCLASS_FUNCTION;
     dispex->prop_cnt = 0;
+    dispex->obj_id = ++ctx->thread_data->next_obj_id;
 
     dispex->props = calloc(1, sizeof(dispex_prop_t)*(dispex->buf_size=4));
     if(!dispex->props)
@@ -2975,6 +2976,45 @@ HRESULT jsdisp_propget_name(jsdisp_t *obj, const WCHAR *name, jsval_t *val)
     return prop_get(obj, to_disp(obj), prop, val);
 }
 
+/* Like jsdisp_propget_name, but for OP_member sites, which keep a cache of the
+ * previously resolved property. Property ids stay valid for the lifetime of an
+ * object, so a cached id may be reused as long as the site still sees the same
+ * object; get_prop() takes care of revalidating deleted properties and
+ * prototype references. External properties may be volatile and always take
+ * the slow path. */
+HRESULT jsdisp_cached_propget(jsdisp_t *obj, const WCHAR *name, struct member_cache *cache, jsval_t *val)
+{
+    dispex_prop_t *prop = NULL;
+    HRESULT hres;
+
+    if(cache->obj_id == obj->obj_id) {
+        prop = get_prop(obj, cache->id);
+        if(prop && prop->type == PROP_EXTERN)
+            prop = NULL;
+    }
+
+    if(!prop) {
+        hres = find_prop_name_prot(obj, string_hash(name), name, FALSE, NULL, &prop);
+        if(FAILED(hres))
+            return hres;
+
+        if(!prop || prop->type == PROP_DELETED) {
+            cache->obj_id = 0;
+            *val = jsval_undefined();
+            return S_OK;
+        }
+
+        if(prop->type == PROP_EXTERN) {
+            cache->obj_id = 0;
+        }else {
+            cache->obj_id = obj->obj_id;
+            cache->id = prop_to_id(obj, prop);
+        }
+    }
+
+    return prop_get(obj, to_disp(obj), prop, val);
+}
+
 HRESULT jsdisp_get_idx(jsdisp_t *obj, DWORD idx, jsval_t *r)
 {
     WCHAR name[12];
@@ -1444,6 +1444,8 @@ static HRESULT interp_array(script_ctx_t *ctx)
 static HRESULT interp_member(script_ctx_t *ctx)
 {
     const BSTR arg = get_op_bstr(ctx, 0);
+    const unsigned cache_off = get_op_uint(ctx, 1);
+    jsdisp_t *jsdisp;
     IDispatch *obj;
     jsval_t v;
     DISPID id;
@@ -1455,6 +1457,14 @@ static HRESULT interp_member(script_ctx_t *ctx)
     if(FAILED(hres))
         return hres;
 
+    if((jsdisp = to_jsdisp(obj)) && jsdisp->ctx == ctx) {
+        hres = jsdisp_cached_propget(jsdisp, arg, ctx->call_ctx->bytecode->member_caches + cache_off, &v);
+        IDispatch_Release(obj);
+        if(FAILED(hres))
+            return hres;
+        return stack_push(ctx, v);
+    }
+
     hres = disp_get_id(ctx, obj, arg, arg, 0, &id);
     if(SUCCEEDED(hres)) {
         hres = disp_propget(ctx, obj, id, &v);
@@ -56,7 +56,7 @@
     X(lshift,     1, 0,0)                  \
     X(lt,         1, 0,0)                  \
     X(lteq,       1, 0,0)                  \
-    X(member,     1, ARG_BSTR,   0)        \
+    X(member,     1, ARG_BSTR,   ARG_UINT) \
     X(memberid,   1, ARG_UINT,   0)        \
     X(minus,      1, 0,0)                  \
     X(mod,        1, 0,0)                  \
@@ -186,6 +186,14 @@ typedef struct _function_code_t {
 IDispatch *lookup_global_host(script_ctx_t*);
 local_ref_t *lookup_local(const function_code_t*,const WCHAR*,unsigned int);
 
+/* Per-call-site cache of the property resolved by the last execution of an
+ * OP_member instruction. Object ids are never reused, so a stale entry can
+ * only cause a cache miss. */
+struct member_cache {
+    UINT64 obj_id;
+    DISPID id;
+};
+
 struct _bytecode_t {
     LONG ref;
     BOOL is_persistent;
@@ -200,6 +208,14 @@ struct _bytecode_t {
     UINT64 source_context;
     unsigned start_line;
 
+    /* reuse cache key, valid when cacheable is set, see find_cached_code() */
+    BOOL cacheable;
+    unsigned source_hash;
+    DWORD compile_version;
+    BOOL compile_html_mode;
+    WCHAR *compile_delimiter;
+    DWORD cache_thread_id;
+
     BSTR *bstr_pool;
     unsigned bstr_pool_size;
     unsigned bstr_cnt;
@@ -208,11 +224,17 @@ struct _bytecode_t {
     unsigned str_pool_size;
     unsigned str_cnt;
 
+    struct member_cache *member_caches;
+    unsigned member_cache_cnt;
+
     struct list entry;
 };
 
 HRESULT compile_script(script_ctx_t*,const WCHAR*,UINT64,unsigned,const WCHAR*,const WCHAR*,BOOL,BOOL,named_item_t*,bytecode_t**);
 void release_bytecode(bytecode_t*);
+void free_code_cache(void);
+
+HRESULT jsdisp_cached_propget(jsdisp_t*,const WCHAR*,struct member_cache*,jsval_t*);
 
 unsigned get_location_line(bytecode_t *code, unsigned loc, unsigned *char_pos);
 
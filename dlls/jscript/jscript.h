@@ -131,6 +131,8 @@ struct thread_data {
     LONG ref;
     LONG thread_id;
 
+    UINT64 next_obj_id;
+
     BOOL gc_is_unlinking;
     DWORD gc_last_tick;
 
@@ -204,6 +206,8 @@ struct jsdisp_t {
     BOOLEAN extensible : 1;
     BOOLEAN gc_marked : 1;
 
+    UINT64 obj_id;
+
     DWORD buf_size;
     DWORD prop_cnt;
     dispex_prop_t *props;
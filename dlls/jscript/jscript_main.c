@@ -19,6 +19,7 @@
 #include "initguid.h"
 
 #include "jscript.h"
+#include "engine.h"
 
 #include "winreg.h"
 #include "advpub.h"
@@ -208,6 +209,7 @@ BOOL WINAPI DllMain(HINSTANCE hInstDLL, DWORD fdwReason, LPVOID lpv)
         if (lpv) break;
         if (dispatch_typeinfo) ITypeInfo_Release(dispatch_typeinfo);
         if(jscript_tls != TLS_OUT_OF_INDEXES) TlsFree(jscript_tls);
+        free_code_cache();
         free_strings();
         break;
     }
@@ -586,6 +586,29 @@ static BOOL copy_file( const WCHAR *source, const WCHAR *dest, COPYFILE2_EXTENDE
         return FALSE;
     }
 
+    /* without a progress routine there is no need to chunk the copy; let the
+     * kernel clone or copy the whole file in one request if it can */
+    if (!progress && !cancel_ptr)
+    {
+        FILE_STANDARD_INFORMATION std;
+
+        if (!NtQueryInformationFile( h1, &io, &std, sizeof(std), FileStandardInformation ))
+        {
+            DUPLICATE_EXTENTS_DATA dup;
+
+            dup.FileHandle = h1;
+            dup.SourceFileOffset.QuadPart = 0;
+            dup.TargetFileOffset.QuadPart = 0;
+            dup.ByteCount = std.EndOfFile;
+            if (!NtFsControlFile( h2, 0, NULL, NULL, &io, FSCTL_DUPLICATE_EXTENTS_TO_FILE,
+                                  &dup, sizeof(dup), NULL, 0 ))
+            {
+                ret = TRUE;
+                goto done;
+            }
+        }
+    }
+
     while (ReadFile( h1, buffer, buffer_size, &count, NULL ) && count)
     {
         char *p = buffer;
@@ -1242,7 +1265,7 @@ HANDLE WINAPI DECLSPEC_HOTPATCH FindFirstFileExW( LPCWSTR filename, FINDEX_INFO_
         has_wildcard = wcspbrk( mask, L"*?<>" ) != NULL;
         if (has_wildcard)
         {
-            size = 8192;
+            size = (flags & FIND_FIRST_EX_LARGE_FETCH) ? 65536 : 8192;
             mask = PathFindFileNameW( filename );
         }
         else size = max_entry_size;
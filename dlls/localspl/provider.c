@@ -3779,9 +3779,9 @@ static BOOL WINAPI fpGetJob(HANDLE hprinter, DWORD job_id, DWORD level,
     return ret;
 }
 
-static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
+static BOOL schedule_job(printer_info_t *info, const WCHAR *printer_name,
+        WCHAR *printer_datatype, const WCHAR *printer_print_proc, DWORD job_id)
 {
-    printer_t *printer = (printer_t *)hprinter;
     WCHAR output[1024], name[1024], *datatype;
     BOOL datatype_valid = FALSE, ret = FALSE;
     PRINTPROCESSOROPENDATA pp_data;
@@ -3791,25 +3791,17 @@ static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
     HANDLE hpp;
     HKEY hkey;
 
-    TRACE("%p %ld\n", hprinter, job_id);
-
-    if (!printer || printer->header.type != HANDLE_PRINTER)
-    {
-        SetLastError(ERROR_INVALID_HANDLE);
-        return FALSE;
-    }
-
-    EnterCriticalSection(&printer->info->jobs_cs);
-    job = get_job(printer->info, job_id);
+    EnterCriticalSection(&info->jobs_cs);
+    job = get_job(info, job_id);
     if (!job)
     {
-        LeaveCriticalSection(&printer->info->jobs_cs);
+        LeaveCriticalSection(&info->jobs_cs);
         return FALSE;
     }
 
     port = job->port;
     if (!port || !*port)
-        port = printer->info->port;
+        port = info->port;
     TRACE("need to schedule job %ld filename %s to port %s\n", job->id,
             debugstr_w(job->filename), debugstr_w(port));
 
@@ -3832,15 +3824,15 @@ static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
 
     if (job->datatype)
         datatype = job->datatype;
-    else if (printer->datatype)
-        datatype = printer->datatype;
+    else if (printer_datatype)
+        datatype = printer_datatype;
     else
-        datatype = printer->info->datatype;
+        datatype = info->datatype;
 
-    pp = print_proc_load(printer->info->print_proc);
+    pp = print_proc_load(info->print_proc);
     if (!pp)
     {
-        WARN("failed to load %s print processor\n", debugstr_w(printer->info->print_proc));
+        WARN("failed to load %s print processor\n", debugstr_w(info->print_proc));
     }
     else
     {
@@ -3851,7 +3843,7 @@ static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
 
     if (!datatype_valid)
     {
-        pp = print_proc_load(printer->print_proc);
+        pp = print_proc_load(printer_print_proc);
         if (!pp) goto cleanup;
 
         datatype_valid = print_proc_check_datatype(pp, datatype);
@@ -3860,7 +3852,7 @@ static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
     if (!datatype_valid)
     {
         WARN("%s datatype not supported by %s\n", debugstr_w(datatype),
-                debugstr_w(printer->info->print_proc));
+                debugstr_w(info->print_proc));
         print_proc_unload(pp);
         goto cleanup;
     }
@@ -3872,7 +3864,7 @@ static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
     pp_data.pDocumentName = job->document_title;
     pp_data.JobId = job->id;
     pp_data.pOutputFile = (WCHAR *)port;
-    pp_data.pPrinterName = printer->name;
+    pp_data.pPrinterName = (WCHAR *)printer_name;
     hpp = pp->open(name, &pp_data);
     if (!hpp)
     {
@@ -3881,21 +3873,152 @@ static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
         goto cleanup;
     }
 
-    swprintf(name, ARRAY_SIZE(name), L"%s, Job %d", printer->name, job->id);
+    swprintf(name, ARRAY_SIZE(name), L"%s, Job %d", printer_name, job->id);
     ret = pp->print(hpp, name);
     if (!ret)
         WARN("PrintDocumentOnPrintProcessor failed %ld\n", GetLastError());
     pp->close(hpp);
     print_proc_unload(pp);
 
-    if (!(printer->info->attributes & PRINTER_ATTRIBUTE_KEEPPRINTEDJOBS))
+    if (!(info->attributes & PRINTER_ATTRIBUTE_KEEPPRINTEDJOBS))
         DeleteFileW(job->filename);
     free_job(job);
 cleanup:
-    LeaveCriticalSection(&printer->info->jobs_cs);
+    LeaveCriticalSection(&info->jobs_cs);
     return ret;
 }
 
+typedef struct {
+    struct list entry;
+    printer_info_t *info;
+    WCHAR *printer_name;
+    WCHAR *datatype;
+    WCHAR *print_proc;
+    DWORD job_id;
+} scheduled_job_t;
+
+static CRITICAL_SECTION scheduler_cs;
+static CRITICAL_SECTION_DEBUG scheduler_cs_debug =
+{
+    0, 0, &scheduler_cs,
+    { &scheduler_cs_debug.ProcessLocksList, &scheduler_cs_debug.ProcessLocksList },
+    0, 0, { (DWORD_PTR)(__FILE__ ": scheduler_cs") }
+};
+static CRITICAL_SECTION scheduler_cs = { &scheduler_cs_debug, -1, 0, 0, 0, 0 };
+
+static struct list scheduled_jobs = LIST_INIT(scheduled_jobs);
+static HANDLE scheduler_sem, scheduler_idle, scheduler_thread;
+static DWORD scheduler_pending;
+
+static DWORD WINAPI scheduler_run(void *arg)
+{
+    scheduled_job_t *job;
+    struct list *entry;
+
+    for (;;)
+    {
+        WaitForSingleObject(scheduler_sem, INFINITE);
+
+        EnterCriticalSection(&scheduler_cs);
+        entry = list_head(&scheduled_jobs);
+        list_remove(entry);
+        LeaveCriticalSection(&scheduler_cs);
+
+        job = LIST_ENTRY(entry, scheduled_job_t, entry);
+        schedule_job(job->info, job->printer_name, job->datatype, job->print_proc, job->job_id);
+
+        release_printer_info(job->info);
+        free(job->printer_name);
+        free(job->datatype);
+        free(job->print_proc);
+        free(job);
+
+        EnterCriticalSection(&scheduler_cs);
+        if (!--scheduler_pending) SetEvent(scheduler_idle);
+        LeaveCriticalSection(&scheduler_cs);
+    }
+    return 0;
+}
+
+/* Queue a job for printing on the scheduler thread so the caller doesn't
+   block while the print processor pushes data to the port. */
+static BOOL schedule_job_async(printer_t *printer, DWORD job_id)
+{
+    scheduled_job_t *job;
+
+    if (!(job = calloc(1, sizeof(*job)))) return FALSE;
+    job->printer_name = wcsdup(printer->name);
+    job->datatype = wcsdup(printer->datatype);
+    job->print_proc = wcsdup(printer->print_proc);
+    job->job_id = job_id;
+
+    EnterCriticalSection(&scheduler_cs);
+    if (!scheduler_thread)
+    {
+        if (!scheduler_sem) scheduler_sem = CreateSemaphoreW(NULL, 0, MAX_JOB_ID, NULL);
+        if (!scheduler_idle) scheduler_idle = CreateEventW(NULL, TRUE, TRUE, NULL);
+        if (scheduler_sem && scheduler_idle)
+            scheduler_thread = CreateThread(NULL, 0, scheduler_run, NULL, 0, NULL);
+        if (!scheduler_thread)
+        {
+            LeaveCriticalSection(&scheduler_cs);
+            free(job->printer_name);
+            free(job->datatype);
+            free(job->print_proc);
+            free(job);
+            return FALSE;
+        }
+    }
+
+    InterlockedIncrement(&printer->info->ref);
+    job->info = printer->info;
+    list_add_tail(&scheduled_jobs, &job->entry);
+    scheduler_pending++;
+    ResetEvent(scheduler_idle);
+    ReleaseSemaphore(scheduler_sem, 1, NULL);
+    LeaveCriticalSection(&scheduler_cs);
+    return TRUE;
+}
+
+/* Wait until all queued jobs have been handed to their ports. */
+static void scheduler_wait(void)
+{
+    HANDLE idle;
+
+    EnterCriticalSection(&scheduler_cs);
+    idle = scheduler_pending ? scheduler_idle : NULL;
+    LeaveCriticalSection(&scheduler_cs);
+
+    if (idle) WaitForSingleObject(idle, INFINITE);
+}
+
+static BOOL WINAPI fpScheduleJob(HANDLE hprinter, DWORD job_id)
+{
+    printer_t *printer = (printer_t *)hprinter;
+    job_info_t *job;
+
+    TRACE("%p %ld\n", hprinter, job_id);
+
+    if (!printer || printer->header.type != HANDLE_PRINTER)
+    {
+        SetLastError(ERROR_INVALID_HANDLE);
+        return FALSE;
+    }
+
+    EnterCriticalSection(&printer->info->jobs_cs);
+    job = get_job(printer->info, job_id);
+    LeaveCriticalSection(&printer->info->jobs_cs);
+    if (!job)
+        return FALSE;
+
+    if (schedule_job_async(printer, job_id))
+        return TRUE;
+
+    /* fall back to printing on the caller's thread */
+    return schedule_job(printer->info, printer->name, printer->datatype,
+            printer->print_proc, job_id);
+}
+
 static BOOL WINAPI fpAbortPrinter(HANDLE hprinter)
 {
     printer_t *printer = (printer_t *)hprinter;
@@ -4046,6 +4169,9 @@ static BOOL WINAPI fpClosePrinter(HANDLE hprinter)
         if(printer->doc)
             fpEndDocPrinter(hprinter);
 
+        /* don't lose jobs still sitting in the scheduler queue */
+        scheduler_wait();
+
         release_printer_info(printer->info);
         free(printer->name);
         free(printer->print_proc);
@@ -88,8 +88,84 @@ struct topoloader_context
 {
     IMFTopology *input_topology;
     IMFTopology *output_topology;
+    struct list mft_enums;
 };
 
+struct mft_enum_result
+{
+    struct list entry;
+    GUID category;
+    MFT_REGISTER_TYPE_INFO input_info;
+    MFT_REGISTER_TYPE_INFO output_info;
+    BOOL has_output_info;
+    IMFActivate **activates;
+    UINT32 count;
+};
+
+static BOOL mft_type_info_equal(const MFT_REGISTER_TYPE_INFO *a, const MFT_REGISTER_TYPE_INFO *b)
+{
+    return IsEqualGUID(&a->guidMajorType, &b->guidMajorType) && IsEqualGUID(&a->guidSubtype, &b->guidSubtype);
+}
+
+/* MFTEnumEx scans the transform registry, and resolving a topology repeats the same
+ * lookup for every branch that needs the same decoder or converter, so cache the
+ * enumeration results for the duration of the resolution */
+static HRESULT topology_loader_enum_transforms(struct topoloader_context *context, GUID category,
+        const MFT_REGISTER_TYPE_INFO *input_info, const MFT_REGISTER_TYPE_INFO *output_info,
+        IMFActivate ***activates, UINT32 *count)
+{
+    struct mft_enum_result *result;
+    HRESULT hr;
+
+    LIST_FOR_EACH_ENTRY(result, &context->mft_enums, struct mft_enum_result, entry)
+    {
+        if (!IsEqualGUID(&result->category, &category)
+                || !mft_type_info_equal(&result->input_info, input_info)
+                || result->has_output_info != !!output_info
+                || (output_info && !mft_type_info_equal(&result->output_info, output_info)))
+            continue;
+
+        *activates = result->activates;
+        *count = result->count;
+        return S_OK;
+    }
+
+    if (!(result = calloc(1, sizeof(*result))))
+        return E_OUTOFMEMORY;
+
+    if (FAILED(hr = MFTEnumEx(category, MFT_ENUM_FLAG_ALL, input_info, output_info,
+            &result->activates, &result->count)))
+    {
+        free(result);
+        return hr;
+    }
+
+    result->category = category;
+    result->input_info = *input_info;
+    if ((result->has_output_info = !!output_info))
+        result->output_info = *output_info;
+    list_add_tail(&context->mft_enums, &result->entry);
+
+    *activates = result->activates;
+    *count = result->count;
+    return S_OK;
+}
+
+static void topology_loader_free_enum_results(struct topoloader_context *context)
+{
+    struct mft_enum_result *result, *next;
+    UINT32 i;
+
+    LIST_FOR_EACH_ENTRY_SAFE(result, next, &context->mft_enums, struct mft_enum_result, entry)
+    {
+        list_remove(&result->entry);
+        for (i = 0; i < result->count; ++i)
+            IMFActivate_Release(result->activates[i]);
+        CoTaskMemFree(result->activates);
+        free(result);
+    }
+}
+
 static HRESULT topology_loader_clone_node(struct topoloader_context *context, IMFTopologyNode *node, IMFTopologyNode **clone)
 {
     MF_TOPOLOGY_TYPE node_type;
@@ -266,20 +342,22 @@ static HRESULT update_media_type_from_upstream(IMFMediaType *media_type, IMFMedi
     return hr;
 }
 
-static HRESULT topology_branch_connect(IMFTopology *topology, MF_CONNECT_METHOD method_mask,
+static HRESULT topology_branch_connect(struct topoloader_context *context, MF_CONNECT_METHOD method_mask,
         struct topology_branch *branch, BOOL enumerate_source_types);
-static HRESULT topology_branch_connect_down(IMFTopology *topology, MF_CONNECT_METHOD method_mask,
+static HRESULT topology_branch_connect_down(struct topoloader_context *context, MF_CONNECT_METHOD method_mask,
         struct topology_branch *branch, IMFMediaType *up_type);
-static HRESULT topology_branch_connect_indirect(IMFTopology *topology, MF_CONNECT_METHOD method_mask,
+static HRESULT topology_branch_connect_indirect(struct topoloader_context *context, MF_CONNECT_METHOD method_mask,
         struct topology_branch *branch, IMFMediaType *up_type, IMFMediaType *down_type)
 {
     BOOL decoder = (method_mask & MF_CONNECT_ALLOW_DECODER) == MF_CONNECT_ALLOW_DECODER;
+    IMFTopology *topology = context->output_topology;
     MFT_REGISTER_TYPE_INFO input_info, output_info;
     IMFTransform *transform;
     IMFActivate **activates;
     IMFTopologyNode *node;
-    unsigned int i, count;
+    unsigned int i;
     GUID category, guid;
+    UINT32 count;
     HRESULT hr;
 
     TRACE("topology %p, method_mask %#x, branch %s, up_type %p, down_type %p.\n",
@@ -316,8 +394,12 @@ static HRESULT topology_branch_connect_indirect(IMFTopology *topology, MF_CONNEC
         method_mask = MF_CONNECT_ALLOW_CONVERTER;
     }
 
-    if (FAILED(hr = MFTEnumEx(category, MFT_ENUM_FLAG_ALL, &input_info, decoder ? NULL : &output_info, &activates, &count)))
+    if (FAILED(hr = topology_loader_enum_transforms(context, category, &input_info,
+            decoder ? NULL : &output_info, &activates, &count)))
+    {
+        IMFTopologyNode_Release(node);
         return hr;
+    }
 
     for (i = 0, hr = MF_E_TRANSFORM_NOT_POSSIBLE_FOR_CURRENT_MEDIATYPE_COMBINATION; i < count; ++i)
     {
@@ -334,7 +416,7 @@ static HRESULT topology_branch_connect_indirect(IMFTopology *topology, MF_CONNEC
         if (SUCCEEDED(IMFActivate_GetGUID(activates[i], &MFT_TRANSFORM_CLSID_Attribute, &guid)))
             IMFTopologyNode_SetGUID(node, &MF_TOPONODE_TRANSFORM_OBJECTID, &guid);
 
-        hr = topology_branch_connect_down(topology, MF_CONNECT_DIRECT, &up_branch, up_type);
+        hr = topology_branch_connect_down(context, MF_CONNECT_DIRECT, &up_branch, up_type);
         if (down_type && SUCCEEDED(MFCreateMediaType(&media_type)))
         {
             if (SUCCEEDED(IMFMediaType_CopyAllItems(down_type, (IMFAttributes *)media_type))
@@ -354,17 +436,20 @@ static HRESULT topology_branch_connect_indirect(IMFTopology *topology, MF_CONNEC
         }
 
         if (SUCCEEDED(hr))
-            hr = topology_branch_connect(topology, method, &down_branch, !down_type);
+            hr = topology_branch_connect(context, method, &down_branch, !down_type);
         if (SUCCEEDED(hr))
             hr = IMFTopology_AddNode(topology, node);
+
+        /* detach the transform from the activate, so that another branch reusing the
+         * cached enumeration results gets a fresh instance; the node keeps its own
+         * reference on the transform */
+        IMFActivate_ShutdownObject(activates[i]);
+
         if (SUCCEEDED(hr))
             break;
     }
 
     IMFTopologyNode_Release(node);
-    for (i = 0; i < count; ++i)
-        IMFActivate_Release(activates[i]);
-    CoTaskMemFree(activates);
 
     if (!count)
         return MF_E_TOPO_CODEC_NOT_FOUND;
@@ -410,7 +495,7 @@ HRESULT topology_node_init_media_type(IMFTopologyNode *node, DWORD stream, BOOL
     return hr;
 }
 
-static HRESULT topology_branch_connect_down(IMFTopology *topology, MF_CONNECT_METHOD method_mask,
+static HRESULT topology_branch_connect_down(struct topoloader_context *context, MF_CONNECT_METHOD method_mask,
         struct topology_branch *branch, IMFMediaType *up_type)
 {
     IMFMediaTypeHandler *down_handler;
@@ -421,7 +506,7 @@ static HRESULT topology_branch_connect_down(IMFTopology *topology, MF_CONNECT_ME
     HRESULT hr;
 
     TRACE("topology %p, method_mask %#x, branch %s, up_type %p.\n",
-            topology, method_mask, debugstr_topology_branch(branch), up_type);
+            context->output_topology, method_mask, debugstr_topology_branch(branch), up_type);
 
     if (FAILED(IMFTopologyNode_GetUINT32(branch->down.node, &MF_TOPONODE_CONNECT_METHOD, &method)))
         method = MF_CONNECT_ALLOW_DECODER;
@@ -451,11 +536,11 @@ static HRESULT topology_branch_connect_down(IMFTopology *topology, MF_CONNECT_ME
     }
 
     if (FAILED(hr) && (method & method_mask & MF_CONNECT_ALLOW_CONVERTER) == MF_CONNECT_ALLOW_CONVERTER)
-        hr = topology_branch_connect_indirect(topology, MF_CONNECT_ALLOW_CONVERTER,
+        hr = topology_branch_connect_indirect(context, MF_CONNECT_ALLOW_CONVERTER,
                 branch, up_type, down_type);
 
     if (FAILED(hr) && (method & method_mask & MF_CONNECT_ALLOW_DECODER) == MF_CONNECT_ALLOW_DECODER)
-        hr = topology_branch_connect_indirect(topology, MF_CONNECT_ALLOW_DECODER,
+        hr = topology_branch_connect_indirect(context, MF_CONNECT_ALLOW_DECODER,
                 branch, up_type, down_type);
 
 done:
@@ -466,7 +551,7 @@ done:
     return hr;
 }
 
-static HRESULT topology_branch_foreach_up_types(IMFTopology *topology, MF_CONNECT_METHOD method_mask,
+static HRESULT topology_branch_foreach_up_types(struct topoloader_context *context, MF_CONNECT_METHOD method_mask,
         struct topology_branch *branch)
 {
     IMFMediaTypeHandler *handler;
@@ -479,7 +564,7 @@ static HRESULT topology_branch_foreach_up_types(IMFTopology *topology, MF_CONNEC
 
     while (SUCCEEDED(hr = IMFMediaTypeHandler_GetMediaTypeByIndex(handler, index++, &type)))
     {
-        hr = topology_branch_connect_down(topology, method_mask, branch, type);
+        hr = topology_branch_connect_down(context, method_mask, branch, type);
         if (SUCCEEDED(hr))
             hr = IMFMediaTypeHandler_SetCurrentMediaType(handler, type);
         IMFMediaType_Release(type);
@@ -491,13 +576,14 @@ static HRESULT topology_branch_foreach_up_types(IMFTopology *topology, MF_CONNEC
     return hr;
 }
 
-static HRESULT topology_branch_connect(IMFTopology *topology, MF_CONNECT_METHOD method_mask,
+static HRESULT topology_branch_connect(struct topoloader_context *context, MF_CONNECT_METHOD method_mask,
         struct topology_branch *branch, BOOL enumerate_source_types)
 {
     UINT32 method;
     HRESULT hr;
 
-    TRACE("topology %p, method_mask %#x, branch %s.\n", topology, method_mask, debugstr_topology_branch(branch));
+    TRACE("topology %p, method_mask %#x, branch %s.\n", context->output_topology,
+            method_mask, debugstr_topology_branch(branch));
 
     if (FAILED(IMFTopologyNode_GetUINT32(branch->up.node, &MF_TOPONODE_CONNECT_METHOD, &method)))
         method = MF_CONNECT_DIRECT;
@@ -505,14 +591,14 @@ static HRESULT topology_branch_connect(IMFTopology *topology, MF_CONNECT_METHOD
     if (enumerate_source_types)
     {
         if (method & MF_CONNECT_RESOLVE_INDEPENDENT_OUTPUTTYPES)
-            hr = topology_branch_foreach_up_types(topology, method_mask & MF_CONNECT_ALLOW_DECODER, branch);
+            hr = topology_branch_foreach_up_types(context, method_mask & MF_CONNECT_ALLOW_DECODER, branch);
         else
         {
-            hr = topology_branch_foreach_up_types(topology, method_mask & MF_CONNECT_DIRECT, branch);
+            hr = topology_branch_foreach_up_types(context, method_mask & MF_CONNECT_DIRECT, branch);
             if (FAILED(hr))
-                hr = topology_branch_foreach_up_types(topology, method_mask & MF_CONNECT_ALLOW_CONVERTER, branch);
+                hr = topology_branch_foreach_up_types(context, method_mask & MF_CONNECT_ALLOW_CONVERTER, branch);
             if (FAILED(hr))
-                hr = topology_branch_foreach_up_types(topology, method_mask & MF_CONNECT_ALLOW_DECODER, branch);
+                hr = topology_branch_foreach_up_types(context, method_mask & MF_CONNECT_ALLOW_DECODER, branch);
         }
     }
     else
@@ -525,7 +611,7 @@ static HRESULT topology_branch_connect(IMFTopology *topology, MF_CONNECT_METHOD
         if (SUCCEEDED(hr = IMFMediaTypeHandler_GetCurrentMediaType(up_handler, &up_type))
                 || SUCCEEDED(hr = IMFMediaTypeHandler_GetMediaTypeByIndex(up_handler, 0, &up_type)))
         {
-            hr = topology_branch_connect_down(topology, method_mask, branch, up_type);
+            hr = topology_branch_connect_down(context, method_mask, branch, up_type);
             IMFMediaType_Release(up_type);
         }
         IMFMediaTypeHandler_Release(up_handler);
@@ -555,9 +641,9 @@ static HRESULT topology_loader_resolve_branches(struct topoloader_context *conte
             WARN("Failed to clone nodes for branch %s\n", debugstr_topology_branch(branch));
         else
         {
-            hr = topology_branch_connect(context->output_topology, MF_CONNECT_ALLOW_DECODER, branch, enumerate_source_types);
+            hr = topology_branch_connect(context, MF_CONNECT_ALLOW_DECODER, branch, enumerate_source_types);
             if (hr == MF_E_INVALIDMEDIATYPE && !enumerate_source_types && node_type == MF_TOPOLOGY_TRANSFORM_NODE)
-                hr = topology_branch_connect(context->output_topology, MF_CONNECT_ALLOW_DECODER, branch, TRUE);
+                hr = topology_branch_connect(context, MF_CONNECT_ALLOW_DECODER, branch, TRUE);
         }
 
         topology_branch_destroy(branch);
@@ -856,6 +942,7 @@ static HRESULT WINAPI topology_loader_Load(IMFTopoLoader *iface, IMFTopology *in
 
     context.input_topology = input_topology;
     context.output_topology = output_topology;
+    list_init(&context.mft_enums);
 
     for (i = 0; SUCCEEDED(IMFTopology_GetNode(input_topology, i, &node)); i++)
     {
@@ -874,6 +961,8 @@ static HRESULT WINAPI topology_loader_Load(IMFTopoLoader *iface, IMFTopology *in
     while (SUCCEEDED(hr) && !list_empty(&branches))
         hr = topology_loader_resolve_branches(&context, &branches, enumerate_source_types);
 
+    topology_loader_free_enum_results(&context);
+
     LIST_FOR_EACH_ENTRY_SAFE(branch, next, &branches, struct topology_branch, entry)
     {
         WARN("Failed to resolve branch %s\n", debugstr_topology_branch(branch));
@@ -516,6 +516,21 @@ static HRESULT source_reader_request_sample(struct source_reader *reader, struct
     return hr;
 }
 
+/* Number of decoded samples to keep queued ahead of the consumer per stream. */
+#define SOURCE_READER_PREFETCH_DEPTH 2
+
+/* Keep the source and the decoder transforms working ahead of the consumer,
+ * so that synchronous ReadSample() calls can usually be served from already
+ * decoded samples instead of stalling for the whole demux+decode latency.
+ * Such requests don't count as consumer demand, arrived samples simply sit
+ * in the response queue until they're read.
+ */
+static void source_reader_request_sample_ahead(struct source_reader *reader, struct media_stream *stream)
+{
+    if (stream->state != STREAM_STATE_EOS && stream->responses < SOURCE_READER_PREFETCH_DEPTH)
+        source_reader_request_sample(reader, stream);
+}
+
 static HRESULT source_reader_new_stream_handler(struct source_reader *reader, IMFMediaEvent *event)
 {
     IMFMediaStream *stream;
@@ -991,13 +1006,25 @@ static HRESULT source_reader_process_sample(struct source_reader *reader, struct
     HRESULT hr;
 
     if (!(ptr = list_head(&stream->transforms)))
-        return source_reader_queue_sample(reader, stream, 0, sample);
+    {
+        hr = source_reader_queue_sample(reader, stream, 0, sample);
+        source_reader_request_sample_ahead(reader, stream);
+        return hr;
+    }
     entry = LIST_ENTRY(ptr, struct transform_entry, entry);
 
     /* It's assumed that decoder has 1 input and 1 output, both id's are 0. */
     if (SUCCEEDED(hr = source_reader_push_transform_samples(reader, stream, entry, sample))
             || hr == MF_E_TRANSFORM_NEED_MORE_INPUT)
-        hr = stream->requests ? source_reader_request_sample(reader, stream) : S_OK;
+    {
+        if (stream->requests)
+            hr = source_reader_request_sample(reader, stream);
+        else
+        {
+            source_reader_request_sample_ahead(reader, stream);
+            hr = S_OK;
+        }
+    }
     else
         WARN("Transform failed to process output, hr %#lx.\n", hr);
 
@@ -2386,6 +2413,9 @@ static HRESULT source_reader_read_sample(struct source_reader *reader, DWORD ind
                     source_reader_get_read_result(reader, stream, flags, &hr, actual_index, stream_flags,
                        timestamp, sample);
             }
+
+            if (SUCCEEDED(hr) && !(flags & MF_SOURCE_READER_CONTROLF_DRAIN))
+                source_reader_request_sample_ahead(reader, stream);
         }
         else
         {
@@ -119,20 +119,70 @@ static const GUID *get_default_uuid( int letter )
     return &guid;
 }
 
-/* send notification about a change to a given drive */
-static void send_notify( int drive, int code )
+#define NOTIFY_DEBOUNCE_MS 100  /* how long to keep coalescing before broadcasting */
+
+static UINT pending_arrival_mask;
+static UINT pending_removal_mask;
+static TP_TIMER *notify_timer;
+
+static void broadcast_notify( UINT unitmask, int code )
 {
     DEV_BROADCAST_VOLUME info;
 
     info.dbcv_size       = sizeof(info);
     info.dbcv_devicetype = DBT_DEVTYP_VOLUME;
     info.dbcv_reserved   = 0;
-    info.dbcv_unitmask   = 1 << drive;
+    info.dbcv_unitmask   = unitmask;
     info.dbcv_flags      = DBTF_MEDIA;
     BroadcastSystemMessageW( BSF_FORCEIFHUNG|BSF_QUERY, NULL,
                              WM_DEVICECHANGE, code, (LPARAM)&info );
 }
 
+static void CALLBACK notify_timer_callback( TP_CALLBACK_INSTANCE *instance, void *context, TP_TIMER *timer )
+{
+    UINT arrival_mask, removal_mask;
+
+    EnterCriticalSection( &device_section );
+    arrival_mask = pending_arrival_mask;
+    removal_mask = pending_removal_mask;
+    pending_arrival_mask = pending_removal_mask = 0;
+    LeaveCriticalSection( &device_section );
+
+    if (removal_mask) broadcast_notify( removal_mask, DBT_DEVICEREMOVECOMPLETE );
+    if (arrival_mask) broadcast_notify( arrival_mask, DBT_DEVICEARRIVAL );
+}
+
+/* send notification about a change to a given drive; the broadcasts are
+ * debounced and sent with a combined unit mask, so that a storm of device
+ * events (plugging a USB hub) doesn't trigger a synchronous broadcast to
+ * every window per drive */
+static void send_notify( int drive, int code )
+{
+    LARGE_INTEGER timeout;
+
+    EnterCriticalSection( &device_section );
+    if (!notify_timer && !(notify_timer = CreateThreadpoolTimer( notify_timer_callback, NULL, NULL )))
+    {
+        LeaveCriticalSection( &device_section );
+        broadcast_notify( 1 << drive, code );
+        return;
+    }
+    /* a removal supersedes a pending arrival of the same drive and vice versa */
+    if (code == DBT_DEVICEARRIVAL)
+    {
+        pending_arrival_mask |= 1 << drive;
+        pending_removal_mask &= ~(1 << drive);
+    }
+    else
+    {
+        pending_removal_mask |= 1 << drive;
+        pending_arrival_mask &= ~(1 << drive);
+    }
+    timeout.QuadPart = (LONGLONG)NOTIFY_DEBOUNCE_MS * -10000;
+    SetThreadpoolTimer( notify_timer, (FILETIME *)&timeout, 0, 0 );
+    LeaveCriticalSection( &device_section );
+}
+
 #define BLOCK_SIZE 2048
 #define SUPERBLOCK_SIZE BLOCK_SIZE
 
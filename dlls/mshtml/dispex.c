@@ -17,6 +17,7 @@
  */
 
 #include <stdarg.h>
+#include <wctype.h>
 
 #define COBJMACROS
 #include "windef.h"
@@ -83,6 +84,11 @@ struct dispex_data_t {
     func_info_t **name_table;
     DWORD func_disp_cnt;
 
+    /* Direct-mapped caches of recent lookups. The tables above are immutable
+     * once the object type is initialized, so entries never need invalidation. */
+    func_info_t *name_cache[32];
+    func_info_t *id_cache[32];
+
     struct list entry;
 };
 
@@ -586,6 +592,8 @@ static dispex_data_t *preprocess_dispex_data(dispex_static_data_t *desc, compat_
     data->func_disp_cnt = 0;
     data->func_size = 16;
     data->name_cnt = 0;
+    memset(data->name_cache, 0, sizeof(data->name_cache));
+    memset(data->id_cache, 0, sizeof(data->id_cache));
     data->funcs = calloc(data->func_size, sizeof(func_info_t));
     if (!data->funcs) {
         free(data);
@@ -1330,8 +1338,14 @@ static HRESULT get_func_obj_entry(DispatchEx *This, func_info_t *func, func_obj_
 
 static HRESULT get_builtin_func(dispex_data_t *data, DISPID id, func_info_t **ret)
 {
+    func_info_t **cache_entry = data->id_cache + ((ULONG)id % ARRAY_SIZE(data->id_cache));
     int min, max, n;
 
+    if(*cache_entry && (*cache_entry)->id == id) {
+        *ret = *cache_entry;
+        return S_OK;
+    }
+
     min = 0;
     max = data->func_cnt-1;
 
@@ -1339,6 +1353,7 @@ static HRESULT get_builtin_func(dispex_data_t *data, DISPID id, func_info_t **re
         n = (min+max)/2;
 
         if(data->funcs[n].id == id) {
+            *cache_entry = data->funcs+n;
             *ret = data->funcs+n;
             return S_OK;
         }
@@ -1353,10 +1368,28 @@ static HRESULT get_builtin_func(dispex_data_t *data, DISPID id, func_info_t **re
     return DISP_E_MEMBERNOTFOUND;
 }
 
-static HRESULT get_builtin_id(const dispex_data_t *info, const WCHAR *name, DWORD grfdex, DISPID *ret)
+static ULONG name_hash(const WCHAR *name)
 {
+    ULONG hash = 5381;
+
+    while(*name)
+        hash = hash * 33 + towlower(*name++);
+    return hash;
+}
+
+static HRESULT get_builtin_id(dispex_data_t *info, const WCHAR *name, DWORD grfdex, DISPID *ret)
+{
+    func_info_t **cache_entry = info->name_cache + (name_hash(name) % ARRAY_SIZE(info->name_cache));
     int min = 0, max = info->name_cnt - 1, n, c;
 
+    if(*cache_entry && !wcsicmp((*cache_entry)->name, name)) {
+        if((grfdex & fdexNameCaseSensitive) && wcscmp((*cache_entry)->name, name))
+            return DISP_E_UNKNOWNNAME;
+
+        *ret = (*cache_entry)->id;
+        return S_OK;
+    }
+
     while(min <= max) {
         n = (min+max)/2;
 
@@ -1365,6 +1398,7 @@ static HRESULT get_builtin_id(const dispex_data_t *info, const WCHAR *name, DWOR
             if((grfdex & fdexNameCaseSensitive) && wcscmp(info->name_table[n]->name, name))
                 break;
 
+            *cache_entry = info->name_table[n];
             *ret = info->name_table[n]->id;
             return S_OK;
         }
@@ -1381,7 +1415,7 @@ static HRESULT get_builtin_id(const dispex_data_t *info, const WCHAR *name, DWOR
 HRESULT dispex_get_chain_builtin_id(DispatchEx *dispex, const WCHAR *name, DWORD flags, DISPID *pid)
 {
     compat_mode_t compat_mode = dispex->info->compat_mode;
-    const dispex_data_t *info = dispex->info;
+    dispex_data_t *info = dispex->info;
     HRESULT hres;
 
     assert(compat_mode >= COMPAT_MODE_IE9);
@@ -46,6 +46,7 @@ struct msistring
     USHORT nonpersistent_refcount;
     WCHAR *data;
     int    len;
+    UINT   hash_next;      /* chains strings hashing to the same bucket, 0 terminated */
 };
 
 struct string_table
@@ -53,9 +54,9 @@ struct string_table
     UINT maxcount;         /* the number of strings */
     UINT freeslot;
     UINT codepage;
-    UINT sortcount;
+    UINT bucketcount;      /* the number of hash buckets, always a power of two */
     struct msistring *strings; /* an array of strings */
-    UINT *sorted;              /* index */
+    UINT *buckets;             /* string id of the first string in each bucket */
 };
 
 static BOOL validate_codepage( UINT codepage )
@@ -88,8 +89,12 @@ static string_table *init_stringtable( int entries, UINT codepage )
         return NULL;
     }
 
-    st->sorted = malloc( sizeof(UINT) * entries );
-    if( !st->sorted )
+    st->bucketcount = 64;
+    while (st->bucketcount < entries)
+        st->bucketcount *= 2;
+
+    st->buckets = calloc( st->bucketcount, sizeof(UINT) );
+    if( !st->buckets )
     {
         free( st->strings );
         free( st );
@@ -99,7 +104,6 @@ static string_table *init_stringtable( int entries, UINT codepage )
     st->maxcount = entries;
     st->freeslot = 1;
     st->codepage = codepage;
-    st->sortcount = 0;
 
     return st;
 }
@@ -115,13 +119,15 @@ VOID msi_destroy_stringtable( string_table *st )
             free( st->strings[i].data );
     }
     free( st->strings );
-    free( st->sorted );
+    free( st->buckets );
     free( st );
 }
 
+static void grow_buckets( string_table *st, UINT entries );
+
 static int st_find_free_entry( string_table *st )
 {
-    UINT i, sz, *s;
+    UINT i, sz;
     struct msistring *p;
 
     TRACE("%p\n", st);
@@ -143,17 +149,11 @@ static int st_find_free_entry( string_table *st )
     if (!(p = realloc( st->strings, sz * sizeof(*p) ))) return -1;
     memset( p + st->maxcount, 0, (sz - st->maxcount) * sizeof(*p) );
 
-    if (!(s = realloc( st->sorted, sz * sizeof(*s) )))
-    {
-        free( p );
-        return -1;
-    }
-
     st->strings = p;
-    st->sorted = s;
 
     st->freeslot = st->maxcount;
     st->maxcount = sz;
+    grow_buckets( st, sz );
     if( st->strings[st->freeslot].persistent_refcount ||
         st->strings[st->freeslot].nonpersistent_refcount )
         ERR("oops. expected freeslot to be free...\n");
@@ -173,36 +173,52 @@ static inline int cmp_string( const WCHAR *str1, int len1, const WCHAR *str2, in
     return 0;
 }
 
-static int find_insert_index( const string_table *st, UINT string_id )
+static UINT string_hash( const string_table *st, const WCHAR *data, int len )
+{
+    UINT hash = 5381;
+
+    while (len--)
+        hash = hash * 33 ^ *data++;
+    return hash & (st->bucketcount - 1);
+}
+
+static void insert_string_hashed( string_table *st, UINT string_id )
 {
-    int i, c, low = 0, high = st->sortcount - 1;
+    UINT n, hash = string_hash( st, st->strings[string_id].data, st->strings[string_id].len );
 
-    while (low <= high)
+    for (n = st->buckets[hash]; n; n = st->strings[n].hash_next)
     {
-        i = (low + high) / 2;
-        c = cmp_string( st->strings[string_id].data, st->strings[string_id].len,
-                        st->strings[st->sorted[i]].data, st->strings[st->sorted[i]].len );
-        if (c < 0)
-            high = i - 1;
-        else if (c > 0)
-            low = i + 1;
-        else
-            return -1; /* already exists */
+        if (!cmp_string( st->strings[string_id].data, st->strings[string_id].len,
+                         st->strings[n].data, st->strings[n].len ))
+            return; /* already exists */
     }
-    return high + 1;
+
+    st->strings[string_id].hash_next = st->buckets[hash];
+    st->buckets[hash] = string_id;
 }
 
-static void insert_string_sorted( string_table *st, UINT string_id )
+/* grow the bucket array to keep chains short, leaving it untouched on failure */
+static void grow_buckets( string_table *st, UINT entries )
 {
-    int i;
+    UINT i, count = st->bucketcount, *buckets;
 
-    i = find_insert_index( st, string_id );
-    if (i == -1)
+    while (count < entries)
+        count *= 2;
+    if (count == st->bucketcount)
+        return;
+    if (!(buckets = calloc( count, sizeof(UINT) )))
         return;
 
-    memmove( &st->sorted[i] + 1, &st->sorted[i], (st->sortcount - i) * sizeof(UINT) );
-    st->sorted[i] = string_id;
-    st->sortcount++;
+    free( st->buckets );
+    st->buckets = buckets;
+    st->bucketcount = count;
+
+    for (i = 1; i < st->maxcount; i++)
+    {
+        if (!st->strings[i].persistent_refcount && !st->strings[i].nonpersistent_refcount)
+            continue;
+        insert_string_hashed( st, i );
+    }
 }
 
 static void set_st_entry( string_table *st, UINT n, WCHAR *str, int len, USHORT refcount,
@@ -222,7 +238,7 @@ static void set_st_entry( string_table *st, UINT n, WCHAR *str, int len, USHORT
     st->strings[n].data = str;
     st->strings[n].len  = len;
 
-    insert_string_sorted( st, n );
+    insert_string_hashed( st, n );
 
     if( n < st->maxcount )
         st->freeslot = n + 1;
@@ -399,22 +415,15 @@ static UINT id2string( const string_table *st, UINT id, char *buffer, UINT *sz )
  */
 UINT msi_string2id( const string_table *st, const WCHAR *str, int len, UINT *id )
 {
-    int i, c, low = 0, high = st->sortcount - 1;
+    UINT n;
 
     if (len < 0) len = lstrlenW( str );
 
-    while (low <= high)
+    for (n = st->buckets[string_hash( st, str, len )]; n; n = st->strings[n].hash_next)
     {
-        i = (low + high) / 2;
-        c = cmp_string( str, len, st->strings[st->sorted[i]].data, st->strings[st->sorted[i]].len );
-
-        if (c < 0)
-            high = i - 1;
-        else if (c > 0)
-            low = i + 1;
-        else
+        if (!cmp_string( str, len, st->strings[n].data, st->strings[n].len ))
         {
-            *id = st->sorted[i];
+            *id = n;
             return ERROR_SUCCESS;
         }
     }
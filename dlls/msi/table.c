@@ -38,7 +38,7 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(msidb);
 
-#define MSITABLE_HASH_TABLE_SIZE 37
+#define MSITABLE_HASH_TABLE_SIZE 4093
 
 struct column_hash_entry
 {
@@ -1742,6 +1742,13 @@ static UINT TABLE_insert_row( struct tagMSIVIEW *view, MSIRECORD *rec, UINT row,
     if( r != ERROR_SUCCESS )
         return r;
 
+    /* reset the hash tables, the rows following the new one are renumbered */
+    for (i = 0; i < tv->num_cols; i++)
+    {
+        free(tv->columns[i].hash_table);
+        tv->columns[i].hash_table = NULL;
+    }
+
     /* shift the rows to make room for the new row */
     for (i = tv->table->row_count - 1; i > row; i--)
     {
@@ -1964,6 +1971,7 @@ static UINT TABLE_remove_column(struct tagMSIVIEW *view, UINT number)
     if (tv->table->colinfo[number-1].type & MSITYPE_TEMPORARY)
     {
         UINT size = tv->table->colinfo[number-1].offset;
+        free(tv->table->colinfo[number-1].hash_table);
         tv->table->col_count--;
         tv->table->colinfo = realloc(tv->table->colinfo, sizeof(*tv->table->colinfo) * tv->table->col_count);
 
@@ -2788,7 +2796,7 @@ static UINT TransformView_Create( MSIDATABASE *db, string_table *st, LPCWSTR nam
     static const WCHAR query_sfx[] = L"' AND `Row` IS NULL AND `Current` IS NOT NULL AND `new` = 1";
 
     WCHAR buf[256], *query = buf;
-    UINT r, len, name_len, size, add_col;
+    UINT i, r, len, name_len, size, add_col;
     struct column_info *colinfo;
     struct table_view *tv;
     MSIRECORD *rec;
@@ -2894,6 +2902,9 @@ static UINT TransformView_Create( MSIDATABASE *db, string_table *st, LPCWSTR nam
     msiobj_release( &q->hdr );
 
     memcpy( colinfo, tv->columns, tv->num_cols * sizeof(*colinfo) );
+    /* the hash tables stay owned by the original column info */
+    for (i = 0; i < tv->num_cols; i++)
+        colinfo[i].hash_table = NULL;
     tv->columns = colinfo;
     tv->num_cols += add_col;
     *view = (MSIVIEW *)tv;
@@ -3163,22 +3174,86 @@ static UINT row_matches( struct table_view *tv, UINT row, const UINT *data, UINT
     return ret;
 }
 
+/* build the lookup hash over a column's values; the buckets and the chain entries
+ * live in a single allocation so invalidation stays a plain free() */
+static struct column_hash_entry **get_column_hash_table( struct table_view *tv, UINT col )
+{
+    struct column_hash_entry **hash_table, *entry;
+    UINT i, r, val;
+
+    if (tv->columns[col-1].hash_table)
+        return tv->columns[col-1].hash_table;
+
+    hash_table = calloc( 1, MSITABLE_HASH_TABLE_SIZE * sizeof(*hash_table) +
+                            tv->table->row_count * sizeof(struct column_hash_entry) );
+    if (!hash_table)
+        return NULL;
+    entry = (struct column_hash_entry *)(hash_table + MSITABLE_HASH_TABLE_SIZE);
+
+    for (i = 0; i < tv->table->row_count; i++, entry++)
+    {
+        r = TABLE_fetch_int( &tv->view, i, col, &val );
+        if (r != ERROR_SUCCESS)
+        {
+            ERR("TABLE_fetch_int shouldn't fail here\n");
+            free( hash_table );
+            return NULL;
+        }
+        entry->value = val;
+        entry->row = i;
+        entry->next = hash_table[val % MSITABLE_HASH_TABLE_SIZE];
+        hash_table[val % MSITABLE_HASH_TABLE_SIZE] = entry;
+    }
+
+    tv->columns[col-1].hash_table = hash_table;
+    return hash_table;
+}
+
 static UINT table_find_row( struct table_view *tv, MSIRECORD *rec, UINT *row, UINT *column )
 {
-    UINT i, r = ERROR_FUNCTION_FAILED, *data;
+    struct column_hash_entry **hash_table, *entry;
+    UINT i, key = 0, r = ERROR_FUNCTION_FAILED, *data;
 
     data = record_to_row( tv, rec );
     if( !data )
         return r;
-    for( i = 0; i < tv->table->row_count; i++ )
+
+    for( i = 0; i < tv->num_cols; i++ )
     {
-        r = row_matches( tv, i, data, column );
-        if( r == ERROR_SUCCESS )
+        if( tv->columns[i].type & MSITYPE_KEY )
         {
-            *row = i;
+            key = i + 1;
             break;
         }
     }
+
+    /* filter on the first primary key column to avoid scanning the whole table */
+    if( key && (hash_table = get_column_hash_table( tv, key )) )
+    {
+        for( entry = hash_table[data[key-1] % MSITABLE_HASH_TABLE_SIZE]; entry; entry = entry->next )
+        {
+            if( entry->value != data[key-1] )
+                continue;
+            r = row_matches( tv, entry->row, data, column );
+            if( r == ERROR_SUCCESS )
+            {
+                *row = entry->row;
+                break;
+            }
+        }
+    }
+    else
+    {
+        for( i = 0; i < tv->table->row_count; i++ )
+        {
+            r = row_matches( tv, i, data, column );
+            if( r == ERROR_SUCCESS )
+            {
+                *row = i;
+                break;
+            }
+        }
+    }
     free( data );
     return r;
 }
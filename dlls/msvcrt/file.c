@@ -3902,27 +3902,50 @@ int CDECL _fgetchar(void)
  */
 char * CDECL fgets(char *s, int size, FILE* file)
 {
-  int    cc = EOF;
   char * buf_start = s;
+  BOOL eof = (size <= 1);  /* preserve the NULL return for undersized buffers */
 
   TRACE(":file(%p) fd (%d) str (%p) len (%d)\n",
 	file,file->_file,s,size);
 
   _lock_file(file);
 
-  while ((size >1) && (cc = _fgetc_nolock(file)) != EOF && cc != '\n')
+  while (size > 1)
     {
-      *s++ = (char)cc;
-      size --;
+      if (file->_cnt > 0)
+        {
+          /* copy buffered data in one go instead of char by char */
+          int len = min( file->_cnt, size - 1 );
+          char *nl = memchr( file->_ptr, '\n', len );
+
+          if (nl) len = nl - file->_ptr + 1;
+          memcpy( s, file->_ptr, len );
+          file->_ptr += len;
+          file->_cnt -= len;
+          s += len;
+          size -= len;
+          if (nl) break;
+        }
+      else
+        {
+          int cc = _filbuf(file);
+
+          if (cc == EOF)
+            {
+              eof = TRUE;
+              break;
+            }
+          *s++ = (char)cc;
+          size--;
+          if (cc == '\n') break;
+        }
     }
-  if ((cc == EOF) && (s == buf_start)) /* If nothing read, return 0*/
+  if (eof && (s == buf_start)) /* If nothing read, return 0*/
   {
     TRACE(":nothing read\n");
     _unlock_file(file);
     return NULL;
   }
-  if ((cc != EOF) && (size > 1))
-    *s++ = cc;
   *s = '\0';
   TRACE(":got %s\n", debugstr_a(buf_start));
   _unlock_file(file);
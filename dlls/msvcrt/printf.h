@@ -619,24 +619,61 @@ static inline int FUNC_NAME(pf_output_fp)(FUNC_NAME(puts_clbk) pf_puts, void *pu
 
     v = frexp(v, &e2);
     if(v) {
+        ULONGLONG d;
+        int e5, ed, dexp = 0;
+        BOOL exact = TRUE;
+
         m = (ULONGLONG)1 << (MANT_BITS - 1);
         m |= (*(ULONGLONG*)&v & (((ULONGLONG)1 << (MANT_BITS - 1)) - 1));
         b->b = 0;
-        b->e = 2;
         b->size = BNUM_PREC64;
-        b->data[0] = m % LIMB_MAX;
-        b->data[1] = m / LIMB_MAX;
         e2 -= MANT_BITS;
 
-        while(e2 > 0) {
-            int shift = e2 > 29 ? 29 : e2;
-            if(bnum_lshift(b, shift)) e10 += LIMB_DIGITS;
-            e2 -= shift;
+        /* fast path: fill the limbs directly when the value is exactly
+         * representable as d*10^dexp with 64-bit d and dexp aligned to a limb
+         * boundary, skipping the decimal point shifting loops below */
+        d = m;
+        ed = e2;
+        while(!(d & 1) && ed < 0) {
+            d >>= 1;
+            ed++;
+        }
+        if(ed > 0) {
+            if(ed < 64 && !(d >> (64 - ed))) d <<= ed;
+            else exact = FALSE;
+        } else if(ed < 0) {
+            for(e5 = -ed; e5 && d <= ~(ULONGLONG)0 / 5; e5--)
+                d *= 5;
+            /* align the decimal exponent to a multiple of LIMB_DIGITS */
+            for(dexp = ed; exact && dexp % LIMB_DIGITS; dexp--) {
+                if(e5 || d > ~(ULONGLONG)0 / 10) exact = FALSE;
+                else d *= 10;
+            }
+            if(e5) exact = FALSE;
         }
-        while(e2 < 0) {
-            int shift = -e2 > 9 ? 9 : -e2;
-            if(bnum_rshift(b, shift)) e10 -= LIMB_DIGITS;
-            e2 += shift;
+
+        if(exact) {
+            b->e = 0;
+            do {
+                b->data[b->e++] = d % LIMB_MAX;
+                d /= LIMB_MAX;
+            } while(d);
+            e10 = dexp + LIMB_DIGITS * (b->e - 2);
+        } else {
+            b->e = 2;
+            b->data[0] = m % LIMB_MAX;
+            b->data[1] = m / LIMB_MAX;
+
+            while(e2 > 0) {
+                int shift = e2 > 29 ? 29 : e2;
+                if(bnum_lshift(b, shift)) e10 += LIMB_DIGITS;
+                e2 -= shift;
+            }
+            while(e2 < 0) {
+                int shift = -e2 > 9 ? 9 : -e2;
+                if(bnum_rshift(b, shift)) e10 -= LIMB_DIGITS;
+                e2 += shift;
+            }
         }
     } else {
         b->b = 0;
@@ -915,6 +915,33 @@ static struct fpnum fpnum_parse_bnum(wchar_t (*get)(void *ctx), void (*unget)(vo
     if(!b->data[bnum_idx(b, b->e-1)])
         return fpnum(sign, 0, 0, 0);
 
+    /* integer values that fit in the 64-bit mantissa don't need the
+     * decimal point shifting below */
+    if(b->e - b->b <= 3) {
+        int rem = dp - LIMB_DIGITS*(b->e - b->b - 1) - limb_digits;
+
+        m = b->data[bnum_idx(b, b->e-1)];
+        for(i = b->e-2; i >= b->b; i--) {
+            int len = (i == b->b) ? limb_digits : LIMB_DIGITS;
+            if(m > (~(ULONGLONG)0 - b->data[bnum_idx(b, i)]) / p10s[len]) break;
+            m = m * p10s[len] + b->data[bnum_idx(b, i)];
+        }
+        while(i < b->b && rem > 0) {
+            int len = rem > LIMB_DIGITS ? LIMB_DIGITS : rem;
+            if(m > ~(ULONGLONG)0 / p10s[len]) break;
+            m *= p10s[len];
+            rem -= len;
+        }
+        while(i < b->b && rem < 0) {
+            int len = -rem > LIMB_DIGITS ? LIMB_DIGITS : -rem;
+            if(m % p10s[len]) break;
+            m /= p10s[len];
+            rem += len;
+        }
+        if(i < b->b && !rem)
+            return fpnum(sign, 0, m, FP_ROUND_ZERO);
+    }
+
     /* Fill last limb with 0 if needed */
     if(b->b+1 != b->e) {
         for(; limb_digits != LIMB_DIGITS; limb_digits++)
@@ -925,8 +952,6 @@ static struct fpnum fpnum_parse_bnum(wchar_t (*get)(void *ctx), void (*unget)(vo
     }
 
     /* move decimal point to limb boundary */
-    if(limb_digits==dp && b->b==b->e-1)
-        return fpnum(sign, 0, b->data[bnum_idx(b, b->e-1)], FP_ROUND_ZERO);
     off = (dp - limb_digits) % LIMB_DIGITS;
     if(off < 0) off += LIMB_DIGITS;
     if(off) bnum_mult(b, p10s[off]);
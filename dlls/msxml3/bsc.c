@@ -43,6 +43,8 @@ struct bsc_t {
 
     void *obj;
     HRESULT (*onDataAvailable)(void*,char*,DWORD);
+    HRESULT (*onDataChunk)(void*,const char*,DWORD);
+    HRESULT (*onBindComplete)(void*,HRESULT);
 
     IBinding *binding;
     IStream *memstream;
@@ -116,6 +118,10 @@ static HRESULT WINAPI bsc_OnStartBinding(
     This->binding = pib;
     IBinding_AddRef(pib);
 
+    /* streaming clients get the data passed through chunk by chunk */
+    if(This->onDataChunk)
+        return S_OK;
+
     hr = CreateStreamOnHGlobal(NULL, TRUE, &This->memstream);
     if(FAILED(hr))
         return hr;
@@ -162,7 +168,9 @@ static HRESULT WINAPI bsc_OnStopBinding(
         This->binding = NULL;
     }
 
-    if(This->obj && SUCCEEDED(hresult)) {
+    if(This->obj && This->onDataChunk) {
+        This->hres = This->onBindComplete(This->obj, FAILED(hresult) ? hresult : This->hres);
+    }else if(This->obj && SUCCEEDED(hresult)) {
         HGLOBAL hglobal;
         hr = GetHGlobalFromStream(This->memstream, &hglobal);
         if(SUCCEEDED(hr))
@@ -209,7 +217,14 @@ static HRESULT WINAPI bsc_OnDataAvailable(
         if(FAILED(hr))
             break;
 
-        hr = IStream_Write(bsc->memstream, buf, read, &written);
+        if(bsc->onDataChunk)
+        {
+            if(bsc->obj && SUCCEEDED(bsc->hres) && read)
+                bsc->hres = bsc->onDataChunk(bsc->obj, (char*)buf, read);
+            written = read;
+        }
+        else
+            hr = IStream_Write(bsc->memstream, buf, read, &written);
     } while(SUCCEEDED(hr) && written != 0 && read != 0);
 
     return S_OK;
@@ -296,7 +311,8 @@ HRESULT create_moniker_from_url(LPCWSTR url, IMoniker **mon)
     return hr;
 }
 
-HRESULT bind_url(IMoniker *mon, HRESULT (*onDataAvailable)(void*,char*,DWORD),
+static HRESULT bind_url_internal(IMoniker *mon, HRESULT (*onDataAvailable)(void*,char*,DWORD),
+        HRESULT (*onDataChunk)(void*,const char*,DWORD), HRESULT (*onBindComplete)(void*,HRESULT),
         void *obj, bsc_t **ret)
 {
     bsc_t *bsc;
@@ -315,6 +331,8 @@ HRESULT bind_url(IMoniker *mon, HRESULT (*onDataAvailable)(void*,char*,DWORD),
     bsc->ref = 1;
     bsc->obj = obj;
     bsc->onDataAvailable = onDataAvailable;
+    bsc->onDataChunk = onDataChunk;
+    bsc->onBindComplete = onBindComplete;
     bsc->binding = NULL;
     bsc->memstream = NULL;
     bsc->hres = S_OK;
@@ -339,6 +357,21 @@ HRESULT bind_url(IMoniker *mon, HRESULT (*onDataAvailable)(void*,char*,DWORD),
     return hr;
 }
 
+HRESULT bind_url(IMoniker *mon, HRESULT (*onDataAvailable)(void*,char*,DWORD),
+        void *obj, bsc_t **ret)
+{
+    return bind_url_internal(mon, onDataAvailable, NULL, NULL, obj, ret);
+}
+
+/* Like bind_url, but the data is passed to onDataChunk piece by piece as it
+ * arrives instead of being buffered, and onBindComplete reports the result of
+ * the transfer once it is done. */
+HRESULT bind_url_stream(IMoniker *mon, HRESULT (*onDataChunk)(void*,const char*,DWORD),
+        HRESULT (*onBindComplete)(void*,HRESULT), void *obj, bsc_t **ret)
+{
+    return bind_url_internal(mon, NULL, onDataChunk, onBindComplete, obj, ret);
+}
+
 HRESULT detach_bsc(bsc_t *bsc)
 {
     HRESULT hres;
@@ -182,6 +182,7 @@ static inline ConnectionPoint *impl_from_IConnectionPoint(IConnectionPoint *ifac
 
 typedef struct _xmldoc_priv {
     LONG refs;
+    LONG mod_count;
     struct list orphans;
     domdoc_properties* properties;
 } xmldoc_priv;
@@ -254,6 +255,7 @@ static xmldoc_priv * create_priv(void)
     if (priv)
     {
         priv->refs = 0;
+        priv->mod_count = 0;
         list_init( &priv->orphans );
         priv->properties = NULL;
     }
@@ -486,62 +488,55 @@ static void sax_serror(void* ctx, const xmlError* err)
     LIBXML2_CALLBACK_SERROR(doparse, err);
 }
 
-static xmlDocPtr doparse(domdoc* This, char const* ptr, int len, xmlCharEncoding encoding)
-{
-    char *ctx_encoding;
-    xmlDocPtr doc = NULL;
-    xmlParserCtxtPtr pctx;
-    static xmlSAXHandler sax_handler = {
-        xmlSAX2InternalSubset,          /* internalSubset */
-        xmlSAX2IsStandalone,            /* isStandalone */
-        xmlSAX2HasInternalSubset,       /* hasInternalSubset */
-        xmlSAX2HasExternalSubset,       /* hasExternalSubset */
-        xmlSAX2ResolveEntity,           /* resolveEntity */
-        xmlSAX2GetEntity,               /* getEntity */
-        xmlSAX2EntityDecl,              /* entityDecl */
-        xmlSAX2NotationDecl,            /* notationDecl */
-        xmlSAX2AttributeDecl,           /* attributeDecl */
-        xmlSAX2ElementDecl,             /* elementDecl */
-        xmlSAX2UnparsedEntityDecl,      /* unparsedEntityDecl */
-        xmlSAX2SetDocumentLocator,      /* setDocumentLocator */
-        xmlSAX2StartDocument,           /* startDocument */
-        xmlSAX2EndDocument,             /* endDocument */
-        xmlSAX2StartElement,            /* startElement */
-        xmlSAX2EndElement,              /* endElement */
-        xmlSAX2Reference,               /* reference */
-        sax_characters,                 /* characters */
-        sax_characters,                 /* ignorableWhitespace */
-        xmlSAX2ProcessingInstruction,   /* processingInstruction */
-        xmlSAX2Comment,                 /* comment */
-        sax_warning,                    /* warning */
-        sax_error,                      /* error */
-        sax_error,                      /* fatalError */
-        xmlSAX2GetParameterEntity,      /* getParameterEntity */
-        xmlSAX2CDataBlock,              /* cdataBlock */
-        xmlSAX2ExternalSubset,          /* externalSubset */
-        0,                              /* initialized */
-        NULL,                           /* _private */
-        xmlSAX2StartElementNs,          /* startElementNs */
-        xmlSAX2EndElementNs,            /* endElementNs */
-        sax_serror                      /* serror */
-    };
-
-    pctx = xmlCreateMemoryParserCtxt(ptr, len);
-    if (!pctx)
-    {
-        ERR("Failed to create parser context\n");
-        return NULL;
-    }
+static xmlSAXHandler sax_handler = {
+    xmlSAX2InternalSubset,          /* internalSubset */
+    xmlSAX2IsStandalone,            /* isStandalone */
+    xmlSAX2HasInternalSubset,       /* hasInternalSubset */
+    xmlSAX2HasExternalSubset,       /* hasExternalSubset */
+    xmlSAX2ResolveEntity,           /* resolveEntity */
+    xmlSAX2GetEntity,               /* getEntity */
+    xmlSAX2EntityDecl,              /* entityDecl */
+    xmlSAX2NotationDecl,            /* notationDecl */
+    xmlSAX2AttributeDecl,           /* attributeDecl */
+    xmlSAX2ElementDecl,             /* elementDecl */
+    xmlSAX2UnparsedEntityDecl,      /* unparsedEntityDecl */
+    xmlSAX2SetDocumentLocator,      /* setDocumentLocator */
+    xmlSAX2StartDocument,           /* startDocument */
+    xmlSAX2EndDocument,             /* endDocument */
+    xmlSAX2StartElement,            /* startElement */
+    xmlSAX2EndElement,              /* endElement */
+    xmlSAX2Reference,               /* reference */
+    sax_characters,                 /* characters */
+    sax_characters,                 /* ignorableWhitespace */
+    xmlSAX2ProcessingInstruction,   /* processingInstruction */
+    xmlSAX2Comment,                 /* comment */
+    sax_warning,                    /* warning */
+    sax_error,                      /* error */
+    sax_error,                      /* fatalError */
+    xmlSAX2GetParameterEntity,      /* getParameterEntity */
+    xmlSAX2CDataBlock,              /* cdataBlock */
+    xmlSAX2ExternalSubset,          /* externalSubset */
+    0,                              /* initialized */
+    NULL,                           /* _private */
+    xmlSAX2StartElementNs,          /* startElementNs */
+    xmlSAX2EndElementNs,            /* endElementNs */
+    sax_serror                      /* serror */
+};
 
+static void setup_parser_ctxt(domdoc *This, xmlParserCtxtPtr pctx)
+{
     if (pctx->sax) xmlFree(pctx->sax);
     pctx->sax = &sax_handler;
     pctx->_private = This;
     pctx->recovery = 0;
+}
 
-    if (encoding != XML_CHAR_ENCODING_NONE)
-        xmlSwitchEncoding(pctx, encoding);
-
-    xmlParseDocument(pctx);
+/* Takes ownership of the parser context and returns the parsed document,
+   or NULL if parsing failed. */
+static xmlDocPtr finish_parse(xmlParserCtxtPtr pctx)
+{
+    char *ctx_encoding;
+    xmlDocPtr doc = NULL;
 
     if (pctx->wellFormed)
     {
@@ -590,6 +585,73 @@ static xmlDocPtr doparse(domdoc* This, char const* ptr, int len, xmlCharEncoding
     return doc;
 }
 
+static xmlDocPtr doparse(domdoc* This, char const* ptr, int len, xmlCharEncoding encoding)
+{
+    xmlParserCtxtPtr pctx;
+
+    pctx = xmlCreateMemoryParserCtxt(ptr, len);
+    if (!pctx)
+    {
+        ERR("Failed to create parser context\n");
+        return NULL;
+    }
+
+    setup_parser_ctxt(This, pctx);
+
+    if (encoding != XML_CHAR_ENCODING_NONE)
+        xmlSwitchEncoding(pctx, encoding);
+
+    xmlParseDocument(pctx);
+
+    return finish_parse(pctx);
+}
+
+/* Lazily creates a push parser context on the first chunk of a streamed
+   document. We pass no SAX handler to xmlCreatePushParserCtxt() and install
+   ours afterwards, as the copy it makes of a handler without the SAX2 magic
+   would drop the SAX2 callbacks. */
+static HRESULT parse_chunk(domdoc *This, xmlParserCtxtPtr *pctx, const char *ptr, DWORD len)
+{
+    if (!*pctx)
+    {
+        *pctx = xmlCreatePushParserCtxt(NULL, NULL, NULL, 0, NULL);
+        if (!*pctx)
+        {
+            ERR("Failed to create parser context\n");
+            return E_FAIL;
+        }
+        setup_parser_ctxt(This, *pctx);
+    }
+
+    if (xmlParseChunk(*pctx, ptr, len, 0) || !(*pctx)->wellFormed)
+        return E_FAIL;
+    return S_OK;
+}
+
+/* Terminates a streamed parse and attaches the document. */
+static HRESULT finish_stream_load(domdoc *This, xmlParserCtxtPtr pctx, HRESULT hr)
+{
+    xmlDocPtr xmldoc;
+
+    if (!pctx)
+        return FAILED(hr) ? hr : E_FAIL;
+
+    if (SUCCEEDED(hr))
+        xmlParseChunk(pctx, NULL, 0, 1);
+    else
+        pctx->wellFormed = 0;
+
+    xmldoc = finish_parse(pctx);
+    if (!xmldoc)
+    {
+        ERR("Failed to parse xml\n");
+        return FAILED(hr) ? hr : E_FAIL;
+    }
+
+    xmldoc->_private = create_priv();
+    return attach_xmldoc(This, xmldoc);
+}
+
 void xmldoc_init(xmlDocPtr doc, MSXML_VERSION version)
 {
     doc->_private = create_priv();
@@ -608,6 +670,20 @@ LONG xmldoc_add_ref(xmlDocPtr doc)
     return xmldoc_add_refs(doc, 1);
 }
 
+/* bump the document modification count so cached data derived from it gets invalidated */
+void xmldoc_mark_modified(xmlDocPtr doc)
+{
+    /* during parsing the xmlDoc._private stuff is not there */
+    if (priv_from_xmlDocPtr(doc))
+        InterlockedIncrement(&priv_from_xmlDocPtr(doc)->mod_count);
+}
+
+LONG xmldoc_modification_count(xmlDocPtr doc)
+{
+    if (!priv_from_xmlDocPtr(doc)) return 0;
+    return priv_from_xmlDocPtr(doc)->mod_count;
+}
+
 LONG xmldoc_release_refs(xmlDocPtr doc, LONG refs)
 {
     xmldoc_priv *priv = priv_from_xmlDocPtr(doc);
@@ -631,6 +707,7 @@ LONG xmldoc_release_refs(xmlDocPtr doc, LONG refs)
         properties_release(priv->properties);
         free(doc->_private);
 
+        xslt_cache_remove_doc(doc);
         xmlFreeDoc(doc);
     }
 
@@ -784,55 +861,27 @@ static HRESULT WINAPI PersistStreamInit_IsDirty(
 
 static HRESULT domdoc_load_from_stream(domdoc *doc, ISequentialStream *stream)
 {
-    DWORD read, written, len;
-    xmlDocPtr xmldoc = NULL;
-    IStream *hstream;
-    HGLOBAL hglobal;
+    xmlParserCtxtPtr pctx = NULL;
     BYTE buf[4096];
     HRESULT hr;
-    char *ptr;
-
-    hstream = NULL;
-    hr = CreateStreamOnHGlobal(NULL, TRUE, &hstream);
-    if (FAILED(hr))
-        return hr;
+    DWORD read;
 
+    /* Parse the data as it is read instead of buffering the whole document,
+       so that the peak memory use stays proportional to the parsed tree. */
     do
     {
-        ISequentialStream_Read(stream, buf, sizeof(buf), &read);
-        hr = IStream_Write(hstream, buf, read, &written);
-    } while(SUCCEEDED(hr) && written != 0 && read != 0);
-
-    if (FAILED(hr))
-    {
-        ERR("failed to copy stream, hr %#lx.\n", hr);
-        IStream_Release(hstream);
-        return hr;
-    }
-
-    hr = GetHGlobalFromStream(hstream, &hglobal);
-    if (FAILED(hr))
-    {
-        IStream_Release(hstream);
-        return hr;
-    }
-
-    len = GlobalSize(hglobal);
-    ptr = GlobalLock(hglobal);
-    if (len)
-        xmldoc = doparse(doc, ptr, len, XML_CHAR_ENCODING_NONE);
-    GlobalUnlock(hglobal);
-    IStream_Release(hstream);
-
-    if (!xmldoc)
-    {
-        ERR("Failed to parse xml\n");
-        return E_FAIL;
-    }
-
-    xmldoc->_private = create_priv();
+        hr = ISequentialStream_Read(stream, buf, sizeof(buf), &read);
+        if (FAILED(hr))
+        {
+            ERR("failed to read stream, hr %#lx.\n", hr);
+            break;
+        }
+        if (!read)
+            break;
+        hr = parse_chunk(doc, &pctx, (const char *)buf, read);
+    } while (SUCCEEDED(hr));
 
-    return attach_xmldoc(doc, xmldoc);
+    return finish_stream_load(doc, pctx, hr);
 }
 
 static HRESULT WINAPI PersistStreamInit_Load(IPersistStreamInit *iface, IStream *stream)
@@ -2160,30 +2209,45 @@ static HRESULT WINAPI domdoc_nodeFromID(
     return E_NOTIMPL;
 }
 
-static HRESULT domdoc_onDataAvailable(void *obj, char *ptr, DWORD len)
+struct domdoc_stream_load
 {
-    domdoc *This = obj;
-    xmlDocPtr xmldoc;
+    domdoc *doc;
+    xmlParserCtxtPtr pctx;
+};
 
-    xmldoc = doparse(This, ptr, len, XML_CHAR_ENCODING_NONE);
-    if(xmldoc) {
-        xmldoc->_private = create_priv();
-        return attach_xmldoc(This, xmldoc);
-    }
+static HRESULT domdoc_onDataChunk(void *obj, const char *ptr, DWORD len)
+{
+    struct domdoc_stream_load *load = obj;
+    return parse_chunk(load->doc, &load->pctx, ptr, len);
+}
 
-    return E_FAIL;
+static HRESULT domdoc_onBindComplete(void *obj, HRESULT hr)
+{
+    struct domdoc_stream_load *load = obj;
+    xmlParserCtxtPtr pctx = load->pctx;
+
+    load->pctx = NULL;
+    return finish_stream_load(load->doc, pctx, hr);
 }
 
 static HRESULT domdoc_load_moniker(domdoc *This, IMoniker *mon)
 {
+    /* detach_bsc() aborts any binding still in flight, so the load state
+       doesn't outlive this call */
+    struct domdoc_stream_load load = { This, NULL };
     bsc_t *bsc;
     HRESULT hr;
 
-    hr = bind_url(mon, domdoc_onDataAvailable, This, &bsc);
+    hr = bind_url_stream(mon, domdoc_onDataChunk, domdoc_onBindComplete, &load, &bsc);
     if(FAILED(hr))
         return hr;
 
-    return detach_bsc(bsc);
+    hr = detach_bsc(bsc);
+
+    /* aborted before OnStopBinding was delivered */
+    if(load.pctx)
+        return finish_stream_load(This, load.pctx, FAILED(hr) ? hr : E_FAIL);
+    return hr;
 }
 
 static HRESULT WINAPI domdoc_load(
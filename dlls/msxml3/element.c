@@ -1057,6 +1057,7 @@ static HRESULT WINAPI domelem_put_dataType(
                 if (attr)
                 {
                     attr = xmlSetNsProp(get_element(This), attr->ns, DT_prefix, dt_to_str(dt));
+                    xmldoc_mark_modified(get_element(This)->doc);
                     hr = S_OK;
                 }
                 else
@@ -1318,6 +1319,8 @@ static HRESULT WINAPI domelem_setAttribute(
 
     if (!xmlSetNsProp(element, NULL, xml_name, xml_value))
         hr = E_FAIL;
+    else
+        xmldoc_mark_modified(element->doc);
 
     free(xml_value);
     free(xml_name);
@@ -1475,7 +1478,10 @@ static HRESULT WINAPI domelem_setAttributeNode(
 
     attr = xmlSetNsProp(get_element(This), NULL, name, value);
     if (attr)
+    {
         attr_node->parent = (IXMLDOMNode*)iface;
+        xmldoc_mark_modified(get_element(This)->doc);
+    }
 
     SysFreeString(nameW);
     VariantClear(&valueW);
@@ -1735,10 +1741,12 @@ static HRESULT domelem_remove_qualified_item(xmlNodePtr node, BSTR name, BSTR ur
     {
         xmlUnlinkNode( (xmlNodePtr) attr );
         xmldoc_add_orphan( attr->doc, (xmlNodePtr) attr );
+        xmldoc_mark_modified( attr->doc );
         *item = create_node( (xmlNodePtr) attr );
     }
     else
     {
+        xmldoc_mark_modified( attr->doc );
         if (xmlRemoveProp(attr) == -1)
             ERR("xmlRemoveProp failed\n");
     }
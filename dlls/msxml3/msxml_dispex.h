@@ -150,6 +150,8 @@ typedef struct bsc_t bsc_t;
 HRESULT create_moniker_from_url(LPCWSTR, IMoniker**);
 HRESULT create_uri(IUri *base, const WCHAR *, IUri **);
 HRESULT bind_url(IMoniker*, HRESULT (*onDataAvailable)(void*,char*,DWORD), void*, bsc_t**);
+HRESULT bind_url_stream(IMoniker*, HRESULT (*onDataChunk)(void*,const char*,DWORD),
+        HRESULT (*onBindComplete)(void*,HRESULT), void*, bsc_t**);
 HRESULT detach_bsc(bsc_t*);
 IUri *get_base_uri(IUnknown *site);
 
@@ -153,6 +153,9 @@ extern LONG xmldoc_add_ref( xmlDocPtr doc );
 extern LONG xmldoc_release( xmlDocPtr doc );
 extern LONG xmldoc_add_refs( xmlDocPtr doc, LONG refs );
 extern LONG xmldoc_release_refs ( xmlDocPtr doc, LONG refs );
+extern void xmldoc_mark_modified( xmlDocPtr doc );
+extern LONG xmldoc_modification_count( xmlDocPtr doc );
+extern void xslt_cache_remove_doc( xmlDocPtr doc );
 extern void xmlnode_add_ref(xmlNodePtr node);
 extern void xmlnode_release(xmlNodePtr node);
 extern int xmlnode_get_inst_cnt( xmlnode *node );
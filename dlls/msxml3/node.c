@@ -248,6 +248,7 @@ HRESULT node_set_content(xmlnode *This, LPCWSTR value)
         return E_OUTOFMEMORY;
 
     xmlNodeSetContent(This->node, str);
+    xmldoc_mark_modified(This->node->doc);
     free(str);
     return S_OK;
 }
@@ -269,6 +270,7 @@ static HRESULT node_set_content_escaped(xmlnode *This, LPCWSTR value)
     }
 
     xmlNodeSetContent(This->node, escaped);
+    xmldoc_mark_modified(This->node->doc);
 
     free(str);
     xmlFree(escaped);
@@ -530,6 +532,8 @@ HRESULT node_insert_before(xmlnode *This, IXMLDOMNode *new_child, const VARIANT
         node_obj->parent = This->iface;
     }
 
+    xmldoc_mark_modified(This->node->doc);
+
     if(ret)
     {
         IXMLDOMNode_AddRef(new_child);
@@ -595,6 +599,7 @@ HRESULT node_replace_child(xmlnode *This, IXMLDOMNode *newChild, IXMLDOMNode *ol
     old_child->parent = NULL;
 
     xmldoc_add_orphan(old_child->node->doc, old_child->node);
+    xmldoc_mark_modified(This->node->doc);
 
     if(ret)
     {
@@ -626,6 +631,7 @@ HRESULT node_remove_child(xmlnode *This, IXMLDOMNode* child, IXMLDOMNode** oldCh
     xmlUnlinkNode(child_node->node);
     child_node->parent = NULL;
     xmldoc_add_orphan(child_node->node->doc, child_node->node);
+    xmldoc_mark_modified(This->node->doc);
 
     if(oldChild)
     {
@@ -877,6 +883,7 @@ HRESULT node_put_text(xmlnode *This, BSTR text)
     free(str);
 
     xmlNodeSetContent(This->node, str2);
+    xmldoc_mark_modified(This->node->doc);
     xmlFree(str2);
 
     return S_OK;
@@ -1477,11 +1484,143 @@ failed:
     return doc;
 }
 
+/* Compiled stylesheet cache. Reapplying the same stylesheet document is common,
+   so keep the last few compiled stylesheets around, keyed by the stylesheet
+   document pointer and invalidated when the document is modified or freed. */
+
+#define XSLT_CACHE_SIZE 8
+
+struct xslt_cache_entry
+{
+    struct list entry;
+    xmlDocPtr doc;            /* stylesheet document, used as the cache key */
+    LONG mod_count;           /* document modification count at compile time */
+    xsltStylesheetPtr stylesheet;
+    LONG refs;                /* active users, plus one for the cache itself */
+};
+
+static struct list xslt_cache = LIST_INIT(xslt_cache);
+
+static CRITICAL_SECTION xslt_cache_cs;
+static CRITICAL_SECTION_DEBUG xslt_cache_cs_debug =
+{
+    0, 0, &xslt_cache_cs,
+    { &xslt_cache_cs_debug.ProcessLocksList, &xslt_cache_cs_debug.ProcessLocksList },
+    0, 0, { (DWORD_PTR)(__FILE__ ": xslt_cache_cs") }
+};
+static CRITICAL_SECTION xslt_cache_cs = { &xslt_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+/* called with xslt_cache_cs held */
+static void xslt_cache_entry_release(struct xslt_cache_entry *cache_entry)
+{
+    if (!--cache_entry->refs)
+    {
+        xsltFreeStylesheet(cache_entry->stylesheet);
+        free(cache_entry);
+    }
+}
+
+void xslt_cache_remove_doc(xmlDocPtr doc)
+{
+    struct xslt_cache_entry *cache_entry;
+
+    EnterCriticalSection(&xslt_cache_cs);
+    LIST_FOR_EACH_ENTRY(cache_entry, &xslt_cache, struct xslt_cache_entry, entry)
+    {
+        if (cache_entry->doc != doc) continue;
+        list_remove(&cache_entry->entry);
+        xslt_cache_entry_release(cache_entry);
+        break;
+    }
+    LeaveCriticalSection(&xslt_cache_cs);
+}
+
+static xsltStylesheetPtr xslt_cache_get(xmlDocPtr doc, struct xslt_cache_entry **ret_entry)
+{
+    struct xslt_cache_entry *cache_entry, *found = NULL;
+    LONG mod_count = xmldoc_modification_count(doc);
+    xsltStylesheetPtr stylesheet;
+    xmlDocPtr sheet_doc;
+    unsigned int count;
+
+    *ret_entry = NULL;
+
+    EnterCriticalSection(&xslt_cache_cs);
+    LIST_FOR_EACH_ENTRY(cache_entry, &xslt_cache, struct xslt_cache_entry, entry)
+    {
+        if (cache_entry->doc != doc) continue;
+        found = cache_entry;
+        break;
+    }
+    if (found && found->mod_count == mod_count)
+    {
+        list_remove(&found->entry);
+        list_add_head(&xslt_cache, &found->entry);
+        found->refs++;
+        LeaveCriticalSection(&xslt_cache_cs);
+        *ret_entry = found;
+        return found->stylesheet;
+    }
+    if (found)
+    {
+        /* stale, the document was modified since the stylesheet was compiled */
+        list_remove(&found->entry);
+        xslt_cache_entry_release(found);
+    }
+    LeaveCriticalSection(&xslt_cache_cs);
+
+    /* compile outside of the lock; xsltParseStylesheetDoc modifies the
+       document, so it works on a copy that the stylesheet then owns */
+    sheet_doc = xmlCopyDoc(doc, 1);
+    if (!(stylesheet = xsltParseStylesheetDoc(sheet_doc)))
+    {
+        xmlFreeDoc(sheet_doc);
+        return NULL;
+    }
+
+    if (!(cache_entry = malloc(sizeof(*cache_entry))))
+        return stylesheet; /* uncached, the caller frees it */
+    cache_entry->doc = doc;
+    cache_entry->mod_count = mod_count;
+    cache_entry->stylesheet = stylesheet;
+    cache_entry->refs = 2;
+
+    EnterCriticalSection(&xslt_cache_cs);
+    /* another thread may have compiled the same document in the meantime */
+    LIST_FOR_EACH_ENTRY(found, &xslt_cache, struct xslt_cache_entry, entry)
+    {
+        if (found->doc != doc) continue;
+        list_remove(&found->entry);
+        xslt_cache_entry_release(found);
+        break;
+    }
+    list_add_head(&xslt_cache, &cache_entry->entry);
+    count = 0;
+    LIST_FOR_EACH_ENTRY(found, &xslt_cache, struct xslt_cache_entry, entry)
+    {
+        if (++count <= XSLT_CACHE_SIZE) continue;
+        list_remove(&found->entry);
+        xslt_cache_entry_release(found);
+        break;
+    }
+    LeaveCriticalSection(&xslt_cache_cs);
+
+    *ret_entry = cache_entry;
+    return stylesheet;
+}
+
+static void xslt_cache_release(struct xslt_cache_entry *cache_entry)
+{
+    EnterCriticalSection(&xslt_cache_cs);
+    xslt_cache_entry_release(cache_entry);
+    LeaveCriticalSection(&xslt_cache_cs);
+}
+
 HRESULT node_transform_node_params(const xmlnode *This, IXMLDOMNode *stylesheet, BSTR *p,
     ISequentialStream *stream, const struct xslprocessor_params *params)
 {
+    struct xslt_cache_entry *cache_entry;
     xsltStylesheetPtr xsltSS;
-    xmlDocPtr sheet_doc;
     HRESULT hr = S_OK;
     xmlnode *sheet;
 
@@ -1492,8 +1631,7 @@ HRESULT node_transform_node_params(const xmlnode *This, IXMLDOMNode *stylesheet,
     sheet = get_node_obj(stylesheet);
     if(!sheet) return E_FAIL;
 
-    sheet_doc = xmlCopyDoc(sheet->node->doc, 1);
-    xsltSS = xsltParseStylesheetDoc(sheet_doc);
+    xsltSS = xslt_cache_get(sheet->node->doc, &cache_entry);
     if (xsltSS)
     {
         const char **xslparams = NULL;
@@ -1540,10 +1678,11 @@ HRESULT node_transform_node_params(const xmlnode *This, IXMLDOMNode *stylesheet,
             xmlFreeDoc(result);
         }
 
-        xsltFreeStylesheet(xsltSS);
+        if (cache_entry)
+            xslt_cache_release(cache_entry);
+        else
+            xsltFreeStylesheet(xsltSS);
     }
-    else
-        xmlFreeDoc(sheet_doc);
 
     if (p && !*p) *p = SysAllocStringLen(NULL, 0);
 
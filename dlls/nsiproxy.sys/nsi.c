@@ -207,7 +207,7 @@ static NTSTATUS poll_events(void)
 
         memset( &addr, 0, sizeof(addr) );
         addr.nl_family = AF_NETLINK;
-        addr.nl_groups = RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+        addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
         if (bind( netlink_fd, (struct sockaddr *)&addr, sizeof(addr) ) == -1)
         {
             close( netlink_fd );
@@ -243,6 +243,10 @@ static NTSTATUS poll_events(void)
                 }
                 if ((status = add_notification( module, NSI_IP_UNICAST_TABLE))) return status;
             }
+            else if (nlh->nlmsg_type == RTM_NEWLINK || nlh->nlmsg_type == RTM_DELLINK)
+            {
+                if ((status = add_notification( &NPI_MS_NDIS_MODULEID, NSI_NDIS_IFINFO_TABLE ))) return status;
+            }
         }
         if (queued_notification_count) break;
     }
@@ -1095,30 +1095,34 @@ static inline void actctx_addref( ACTIVATION_CONTEXT *actctx )
     InterlockedIncrement( &actctx->ref_count );
 }
 
+static void free_assembly( struct assembly *assembly )
+{
+    unsigned int j;
+
+    for (j = 0; j < assembly->num_dlls; j++)
+    {
+        struct dll_redirect *dll = &assembly->dlls[j];
+        free_entity_array( &dll->entities );
+        RtlFreeHeap( GetProcessHeap(), 0, dll->name );
+        RtlFreeHeap( GetProcessHeap(), 0, dll->load_from );
+        RtlFreeHeap( GetProcessHeap(), 0, dll->hash );
+    }
+    RtlFreeHeap( GetProcessHeap(), 0, assembly->dlls );
+    RtlFreeHeap( GetProcessHeap(), 0, assembly->manifest.info );
+    RtlFreeHeap( GetProcessHeap(), 0, assembly->directory );
+    RtlFreeHeap( GetProcessHeap(), 0, assembly->compat_contexts );
+    free_entity_array( &assembly->entities );
+    free_assembly_identity(&assembly->id);
+}
+
 static void actctx_release( ACTIVATION_CONTEXT *actctx )
 {
     if (!InterlockedDecrement( &actctx->ref_count ))
     {
-        unsigned int i, j;
+        unsigned int i;
 
         for (i = 0; i < actctx->num_assemblies; i++)
-        {
-            struct assembly *assembly = &actctx->assemblies[i];
-            for (j = 0; j < assembly->num_dlls; j++)
-            {
-                struct dll_redirect *dll = &assembly->dlls[j];
-                free_entity_array( &dll->entities );
-                RtlFreeHeap( GetProcessHeap(), 0, dll->name );
-                RtlFreeHeap( GetProcessHeap(), 0, dll->load_from );
-                RtlFreeHeap( GetProcessHeap(), 0, dll->hash );
-            }
-            RtlFreeHeap( GetProcessHeap(), 0, assembly->dlls );
-            RtlFreeHeap( GetProcessHeap(), 0, assembly->manifest.info );
-            RtlFreeHeap( GetProcessHeap(), 0, assembly->directory );
-            RtlFreeHeap( GetProcessHeap(), 0, assembly->compat_contexts );
-            free_entity_array( &assembly->entities );
-            free_assembly_identity(&assembly->id);
-        }
+            free_assembly( &actctx->assemblies[i] );
         RtlFreeHeap( GetProcessHeap(), 0, actctx->config.info );
         RtlFreeHeap( GetProcessHeap(), 0, actctx->appdir.info );
         RtlFreeHeap( GetProcessHeap(), 0, actctx->assemblies );
@@ -2936,6 +2940,518 @@ static NTSTATUS open_nt_file( HANDLE *handle, UNICODE_STRING *name )
                        FILE_SHARE_READ | FILE_SHARE_DELETE, FILE_SYNCHRONOUS_IO_ALERT );
 }
 
+
+/***********************************************************************
+ * Compiled manifest cache
+ *
+ * Shared winsxs manifests are identical for every process in the prefix,
+ * so the result of parsing one is stored next to it as a flat blob that
+ * later processes can load instead of going through the XML parser.  The
+ * blob is keyed on the manifest timestamp and size, and is mapped through
+ * a read-only section so the pages are shared across processes.  Any
+ * validation failure simply falls back to parsing the XML.
+ */
+
+#define MANIFEST_CACHE_MAGIC   0x54434157  /* WACT */
+#define MANIFEST_CACHE_VERSION 1
+
+struct manifest_cache_header
+{
+    ULONG         magic;
+    ULONG         version;
+    ULONG         total_size;      /* including the header */
+    ULONG         checksum;        /* over the payload following the header */
+    LARGE_INTEGER manifest_mtime;  /* of the source manifest */
+    LARGE_INTEGER manifest_size;
+};
+
+struct blob_writer
+{
+    char  *data;
+    SIZE_T size;
+    SIZE_T allocated;
+    BOOL   failed;
+};
+
+struct blob_reader
+{
+    const char *ptr;
+    const char *end;
+};
+
+static ULONG manifest_cache_checksum( const void *data, SIZE_T size )
+{
+    const unsigned char *ptr = data;
+    ULONG hash = 2166136261u;
+    while (size--) hash = (hash ^ *ptr++) * 16777619u;
+    return hash;
+}
+
+static void blob_put( struct blob_writer *blob, const void *data, SIZE_T size )
+{
+    if (blob->failed) return;
+    if (blob->size + size > blob->allocated)
+    {
+        SIZE_T new_size = max( blob->allocated * 2, blob->size + size + 4096 );
+        char *ptr = blob->data ? RtlReAllocateHeap( GetProcessHeap(), 0, blob->data, new_size )
+                               : RtlAllocateHeap( GetProcessHeap(), 0, new_size );
+        if (!ptr)
+        {
+            blob->failed = TRUE;
+            return;
+        }
+        blob->data = ptr;
+        blob->allocated = new_size;
+    }
+    memcpy( blob->data + blob->size, data, size );
+    blob->size += size;
+}
+
+static void blob_put_ulong( struct blob_writer *blob, ULONG val )
+{
+    blob_put( blob, &val, sizeof(val) );
+}
+
+static void blob_put_str( struct blob_writer *blob, const WCHAR *str )
+{
+    ULONG len = str ? wcslen( str ) : ~0u;
+    blob_put_ulong( blob, len );
+    if (str) blob_put( blob, str, len * sizeof(WCHAR) );
+}
+
+static BOOL blob_get( struct blob_reader *blob, void *data, SIZE_T size )
+{
+    if ((SIZE_T)(blob->end - blob->ptr) < size) return FALSE;
+    memcpy( data, blob->ptr, size );
+    blob->ptr += size;
+    return TRUE;
+}
+
+static BOOL blob_get_ulong( struct blob_reader *blob, ULONG *val )
+{
+    return blob_get( blob, val, sizeof(*val) );
+}
+
+static BOOL blob_get_str( struct blob_reader *blob, WCHAR **str )
+{
+    ULONG len;
+
+    *str = NULL;
+    if (!blob_get_ulong( blob, &len )) return FALSE;
+    if (len == ~0u) return TRUE;  /* NULL string */
+    if (len > (SIZE_T)(blob->end - blob->ptr) / sizeof(WCHAR)) return FALSE;
+    if (!(*str = RtlAllocateHeap( GetProcessHeap(), 0, (len + 1) * sizeof(WCHAR) ))) return FALSE;
+    memcpy( *str, blob->ptr, len * sizeof(WCHAR) );
+    (*str)[len] = 0;
+    blob->ptr += len * sizeof(WCHAR);
+    return TRUE;
+}
+
+static void serialize_entity( struct blob_writer *blob, const struct entity *entity )
+{
+    unsigned int i;
+
+    blob_put_ulong( blob, entity->kind );
+    switch (entity->kind)
+    {
+    case ACTIVATION_CONTEXT_SECTION_COM_SERVER_REDIRECTION:
+        blob_put_str( blob, entity->u.comclass.clsid );
+        blob_put_str( blob, entity->u.comclass.tlbid );
+        blob_put_str( blob, entity->u.comclass.progid );
+        blob_put_str( blob, entity->u.comclass.name );
+        blob_put_str( blob, entity->u.comclass.version );
+        blob_put_ulong( blob, entity->u.comclass.model );
+        blob_put_ulong( blob, entity->u.comclass.miscstatus );
+        blob_put_ulong( blob, entity->u.comclass.miscstatuscontent );
+        blob_put_ulong( blob, entity->u.comclass.miscstatusthumbnail );
+        blob_put_ulong( blob, entity->u.comclass.miscstatusicon );
+        blob_put_ulong( blob, entity->u.comclass.miscstatusdocprint );
+        blob_put_ulong( blob, entity->u.comclass.progids.num );
+        for (i = 0; i < entity->u.comclass.progids.num; i++)
+            blob_put_str( blob, entity->u.comclass.progids.progids[i] );
+        break;
+    case ACTIVATION_CONTEXT_SECTION_COM_INTERFACE_REDIRECTION:
+        blob_put_str( blob, entity->u.ifaceps.iid );
+        blob_put_str( blob, entity->u.ifaceps.base );
+        blob_put_str( blob, entity->u.ifaceps.tlib );
+        blob_put_str( blob, entity->u.ifaceps.name );
+        blob_put_str( blob, entity->u.ifaceps.ps32 );
+        blob_put_ulong( blob, entity->u.ifaceps.mask );
+        blob_put_ulong( blob, entity->u.ifaceps.nummethods );
+        break;
+    case ACTIVATION_CONTEXT_SECTION_COM_TYPE_LIBRARY_REDIRECTION:
+        blob_put_str( blob, entity->u.typelib.tlbid );
+        blob_put_str( blob, entity->u.typelib.helpdir );
+        blob_put_ulong( blob, entity->u.typelib.flags );
+        blob_put_ulong( blob, entity->u.typelib.major );
+        blob_put_ulong( blob, entity->u.typelib.minor );
+        break;
+    case ACTIVATION_CONTEXT_SECTION_WINDOW_CLASS_REDIRECTION:
+        blob_put_str( blob, entity->u.class.name );
+        blob_put_ulong( blob, entity->u.class.versioned );
+        break;
+    case ACTIVATION_CONTEXT_SECTION_CLR_SURROGATES:
+        blob_put_str( blob, entity->u.clrsurrogate.name );
+        blob_put_str( blob, entity->u.clrsurrogate.clsid );
+        blob_put_str( blob, entity->u.clrsurrogate.version );
+        break;
+    case ACTIVATION_CONTEXT_SECTION_APPLICATION_SETTINGS:
+        blob_put_str( blob, entity->u.settings.name );
+        blob_put_str( blob, entity->u.settings.value );
+        blob_put_str( blob, entity->u.settings.ns );
+        break;
+    case ACTIVATION_CONTEXT_SECTION_WINRT_ACTIVATABLE_CLASSES:
+        blob_put_str( blob, entity->u.activatable_class.name );
+        blob_put_ulong( blob, entity->u.activatable_class.threading_model );
+        break;
+    default:
+        blob->failed = TRUE;  /* don't cache manifests with unknown entities */
+        break;
+    }
+}
+
+static BOOL deserialize_entity( struct blob_reader *blob, struct entity_array *array )
+{
+    struct entity *entity;
+    ULONG kind, val, i;
+
+    if (!blob_get_ulong( blob, &kind )) return FALSE;
+    if (!(entity = add_entity( array, kind ))) return FALSE;
+    switch (kind)
+    {
+    case ACTIVATION_CONTEXT_SECTION_COM_SERVER_REDIRECTION:
+        if (!blob_get_str( blob, &entity->u.comclass.clsid )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.comclass.tlbid )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.comclass.progid )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.comclass.name )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.comclass.version )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.comclass.model )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.comclass.miscstatus )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.comclass.miscstatuscontent )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.comclass.miscstatusthumbnail )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.comclass.miscstatusicon )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.comclass.miscstatusdocprint )) return FALSE;
+        if (!blob_get_ulong( blob, &val ) || val > (SIZE_T)(blob->end - blob->ptr) / sizeof(ULONG))
+            return FALSE;
+        if (val && !(entity->u.comclass.progids.progids =
+                     RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY, val * sizeof(WCHAR *) )))
+            return FALSE;
+        entity->u.comclass.progids.allocated = val;
+        for (i = 0; i < val; i++)
+        {
+            if (!blob_get_str( blob, &entity->u.comclass.progids.progids[i] )) return FALSE;
+            entity->u.comclass.progids.num++;
+        }
+        break;
+    case ACTIVATION_CONTEXT_SECTION_COM_INTERFACE_REDIRECTION:
+        if (!blob_get_str( blob, &entity->u.ifaceps.iid )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.ifaceps.base )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.ifaceps.tlib )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.ifaceps.name )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.ifaceps.ps32 )) return FALSE;
+        if (!blob_get_ulong( blob, &val )) return FALSE;
+        entity->u.ifaceps.mask = val;
+        if (!blob_get_ulong( blob, &entity->u.ifaceps.nummethods )) return FALSE;
+        break;
+    case ACTIVATION_CONTEXT_SECTION_COM_TYPE_LIBRARY_REDIRECTION:
+        if (!blob_get_str( blob, &entity->u.typelib.tlbid )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.typelib.helpdir )) return FALSE;
+        if (!blob_get_ulong( blob, &val )) return FALSE;
+        entity->u.typelib.flags = val;
+        if (!blob_get_ulong( blob, &val )) return FALSE;
+        entity->u.typelib.major = val;
+        if (!blob_get_ulong( blob, &val )) return FALSE;
+        entity->u.typelib.minor = val;
+        break;
+    case ACTIVATION_CONTEXT_SECTION_WINDOW_CLASS_REDIRECTION:
+        if (!blob_get_str( blob, &entity->u.class.name )) return FALSE;
+        if (!blob_get_ulong( blob, &val )) return FALSE;
+        entity->u.class.versioned = val;
+        break;
+    case ACTIVATION_CONTEXT_SECTION_CLR_SURROGATES:
+        if (!blob_get_str( blob, &entity->u.clrsurrogate.name )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.clrsurrogate.clsid )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.clrsurrogate.version )) return FALSE;
+        break;
+    case ACTIVATION_CONTEXT_SECTION_APPLICATION_SETTINGS:
+        if (!blob_get_str( blob, &entity->u.settings.name )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.settings.value )) return FALSE;
+        if (!blob_get_str( blob, &entity->u.settings.ns )) return FALSE;
+        break;
+    case ACTIVATION_CONTEXT_SECTION_WINRT_ACTIVATABLE_CLASSES:
+        if (!blob_get_str( blob, &entity->u.activatable_class.name )) return FALSE;
+        if (!blob_get_ulong( blob, &entity->u.activatable_class.threading_model )) return FALSE;
+        break;
+    default:
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void serialize_identity( struct blob_writer *blob, const struct assembly_identity *ai )
+{
+    blob_put_str( blob, ai->name );
+    blob_put_str( blob, ai->arch );
+    blob_put_str( blob, ai->public_key );
+    blob_put_str( blob, ai->language );
+    blob_put_str( blob, ai->type );
+    blob_put( blob, &ai->version, sizeof(ai->version) );
+    blob_put_ulong( blob, ai->optional );
+    blob_put_ulong( blob, ai->delayed );
+}
+
+static BOOL deserialize_identity( struct blob_reader *blob, struct assembly_identity *ai )
+{
+    ULONG val;
+
+    if (!blob_get_str( blob, &ai->name )) return FALSE;
+    if (!blob_get_str( blob, &ai->arch )) return FALSE;
+    if (!blob_get_str( blob, &ai->public_key )) return FALSE;
+    if (!blob_get_str( blob, &ai->language )) return FALSE;
+    if (!blob_get_str( blob, &ai->type )) return FALSE;
+    if (!blob_get( blob, &ai->version, sizeof(ai->version) )) return FALSE;
+    if (!blob_get_ulong( blob, &val )) return FALSE;
+    ai->optional = val;
+    if (!blob_get_ulong( blob, &val )) return FALSE;
+    ai->delayed = val;
+    return TRUE;
+}
+
+static void serialize_assembly( struct blob_writer *blob, const struct assembly *assembly )
+{
+    unsigned int i, j;
+
+    blob_put_ulong( blob, assembly->type );
+    serialize_identity( blob, &assembly->id );
+    blob_put_ulong( blob, assembly->manifest.type );
+    blob_put_str( blob, assembly->manifest.info );
+    blob_put_str( blob, assembly->directory );
+    blob_put_ulong( blob, assembly->no_inherit );
+    blob_put_ulong( blob, assembly->num_dlls );
+    for (i = 0; i < assembly->num_dlls; i++)
+    {
+        const struct dll_redirect *dll = &assembly->dlls[i];
+        blob_put_str( blob, dll->name );
+        blob_put_str( blob, dll->load_from );
+        blob_put_str( blob, dll->hash );
+        blob_put_ulong( blob, dll->entities.num );
+        for (j = 0; j < dll->entities.num; j++) serialize_entity( blob, &dll->entities.base[j] );
+    }
+    blob_put_ulong( blob, assembly->entities.num );
+    for (i = 0; i < assembly->entities.num; i++) serialize_entity( blob, &assembly->entities.base[i] );
+    blob_put_ulong( blob, assembly->num_compat_contexts );
+    blob_put( blob, assembly->compat_contexts,
+              assembly->num_compat_contexts * sizeof(*assembly->compat_contexts) );
+    blob_put_ulong( blob, assembly->run_level );
+    blob_put_ulong( blob, assembly->ui_access );
+}
+
+static BOOL deserialize_assembly( struct blob_reader *blob, struct assembly *assembly )
+{
+    ULONG i, j, count, val;
+
+    if (!blob_get_ulong( blob, &val )) return FALSE;
+    assembly->type = val;
+    if (!deserialize_identity( blob, &assembly->id )) return FALSE;
+    if (!blob_get_ulong( blob, &assembly->manifest.type )) return FALSE;
+    if (!blob_get_str( blob, &assembly->manifest.info )) return FALSE;
+    if (!blob_get_str( blob, &assembly->directory )) return FALSE;
+    if (!blob_get_ulong( blob, &val )) return FALSE;
+    assembly->no_inherit = val;
+    if (!blob_get_ulong( blob, &count )) return FALSE;
+    for (i = 0; i < count; i++)
+    {
+        struct dll_redirect *dll = add_dll_redirect( assembly );
+        ULONG num_entities;
+
+        if (!dll) return FALSE;
+        if (!blob_get_str( blob, &dll->name )) return FALSE;
+        if (!blob_get_str( blob, &dll->load_from )) return FALSE;
+        if (!blob_get_str( blob, &dll->hash )) return FALSE;
+        if (!blob_get_ulong( blob, &num_entities )) return FALSE;
+        for (j = 0; j < num_entities; j++)
+            if (!deserialize_entity( blob, &dll->entities )) return FALSE;
+    }
+    if (!blob_get_ulong( blob, &count )) return FALSE;
+    for (i = 0; i < count; i++)
+        if (!deserialize_entity( blob, &assembly->entities )) return FALSE;
+    if (!blob_get_ulong( blob, &count )) return FALSE;
+    if (count > (SIZE_T)(blob->end - blob->ptr) / sizeof(*assembly->compat_contexts)) return FALSE;
+    if (count)
+    {
+        if (!(assembly->compat_contexts = RtlAllocateHeap( GetProcessHeap(), 0,
+                                                           count * sizeof(*assembly->compat_contexts) )))
+            return FALSE;
+        if (!blob_get( blob, assembly->compat_contexts, count * sizeof(*assembly->compat_contexts) ))
+            return FALSE;
+        assembly->num_compat_contexts = count;
+    }
+    if (!blob_get_ulong( blob, &val )) return FALSE;
+    assembly->run_level = val;
+    if (!blob_get_ulong( blob, &assembly->ui_access )) return FALSE;
+    return TRUE;
+}
+
+static NTSTATUS get_manifest_cache_name( LPCWSTR filename, UNICODE_STRING *name )
+{
+    static const WCHAR cache_extW[] = L".cache";
+    SIZE_T len = wcslen( filename );
+
+    if (!(name->Buffer = RtlAllocateHeap( GetProcessHeap(), 0, len * sizeof(WCHAR) + sizeof(cache_extW) )))
+        return STATUS_NO_MEMORY;
+    wcscpy( name->Buffer, filename );
+    wcscpy( name->Buffer + len, cache_extW );
+    name->Length = len * sizeof(WCHAR) + sizeof(cache_extW) - sizeof(WCHAR);
+    name->MaximumLength = name->Length + sizeof(WCHAR);
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS get_manifest_file_info( HANDLE file, LARGE_INTEGER *mtime, LARGE_INTEGER *size )
+{
+    FILE_BASIC_INFORMATION basic;
+    FILE_STANDARD_INFORMATION std;
+    IO_STATUS_BLOCK io;
+    NTSTATUS status;
+
+    if ((status = NtQueryInformationFile( file, &io, &basic, sizeof(basic), FileBasicInformation )))
+        return status;
+    if ((status = NtQueryInformationFile( file, &io, &std, sizeof(std), FileStandardInformation )))
+        return status;
+    *mtime = basic.LastWriteTime;
+    *size = std.EndOfFile;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS load_compiled_manifest( struct actctx_loader *acl, struct assembly_identity *ai,
+                                        LPCWSTR filename, HANDLE file )
+{
+    struct manifest_cache_header header;
+    struct blob_reader blob;
+    struct assembly *assembly;
+    LARGE_INTEGER mtime, manifest_size, offset;
+    unsigned int num_deps = acl->num_dependencies;
+    UNICODE_STRING nameW;
+    NTSTATUS status;
+    OBJECT_ATTRIBUTES attr;
+    HANDLE cache_file, mapping;
+    SIZE_T count;
+    ULONG i, count_deps;
+    void *base;
+
+    if ((status = get_manifest_file_info( file, &mtime, &manifest_size ))) return status;
+    if ((status = get_manifest_cache_name( filename, &nameW ))) return status;
+    status = open_nt_file( &cache_file, &nameW );
+    RtlFreeHeap( GetProcessHeap(), 0, nameW.Buffer );
+    if (status) return status;
+
+    InitializeObjectAttributes( &attr, NULL, OBJ_CASE_INSENSITIVE, 0, NULL );
+    offset.QuadPart = 0;
+    status = NtCreateSection( &mapping, STANDARD_RIGHTS_REQUIRED | SECTION_QUERY | SECTION_MAP_READ,
+                              &attr, &offset, PAGE_READONLY, SEC_COMMIT, cache_file );
+    NtClose( cache_file );
+    if (status != STATUS_SUCCESS) return status;
+
+    offset.QuadPart = 0;
+    count = 0;
+    base = NULL;
+    status = NtMapViewOfSection( mapping, GetCurrentProcess(), &base, 0, 0, &offset,
+                                 &count, ViewShare, 0, PAGE_READONLY );
+    NtClose( mapping );
+    if (status != STATUS_SUCCESS) return status;
+
+    status = STATUS_INVALID_IMAGE_FORMAT;
+    if (count < sizeof(header)) goto done;
+    memcpy( &header, base, sizeof(header) );
+    if (header.magic != MANIFEST_CACHE_MAGIC || header.version != MANIFEST_CACHE_VERSION ||
+        header.total_size < sizeof(header) || header.total_size > count ||
+        header.manifest_mtime.QuadPart != mtime.QuadPart ||
+        header.manifest_size.QuadPart != manifest_size.QuadPart)
+        goto done;
+    if (header.checksum != manifest_cache_checksum( (char *)base + sizeof(header),
+                                                    header.total_size - sizeof(header) ))
+        goto done;
+
+    blob.ptr = (char *)base + sizeof(header);
+    blob.end = (char *)base + header.total_size;
+
+    if (!(assembly = add_assembly( acl->actctx, ASSEMBLY_SHARED_MANIFEST ))) goto done;
+    if (!deserialize_assembly( &blob, assembly ) || !blob_get_ulong( &blob, &count_deps ))
+        goto failed;
+    for (i = 0; i < count_deps; i++)
+    {
+        struct assembly_identity dep = { 0 };
+        if (!deserialize_identity( &blob, &dep ) || !add_dependent_assembly_id( acl, &dep ))
+        {
+            free_assembly_identity( &dep );
+            goto failed;
+        }
+    }
+    /* make sure the cached data is for the assembly we were asked for */
+    if (ai && !is_matching_identity( ai, &assembly->id )) goto failed;
+
+    TRACE( "loaded compiled manifest for %s\n", debugstr_w(filename) );
+    status = STATUS_SUCCESS;
+    goto done;
+
+failed:
+    /* roll the partially loaded data back and fall back to the XML parser */
+    free_assembly( assembly );
+    memset( assembly, 0, sizeof(*assembly) );
+    acl->actctx->num_assemblies--;
+    while (acl->num_dependencies > num_deps)
+        free_assembly_identity( &acl->dependencies[--acl->num_dependencies] );
+    status = STATUS_INVALID_IMAGE_FORMAT;
+done:
+    NtUnmapViewOfSection( GetCurrentProcess(), base );
+    return status;
+}
+
+static void save_compiled_manifest( struct actctx_loader *acl, unsigned int num_deps,
+                                    LPCWSTR filename, HANDLE file )
+{
+    struct manifest_cache_header header;
+    struct blob_writer blob = { NULL };
+    struct assembly *assembly = &acl->actctx->assemblies[acl->actctx->num_assemblies - 1];
+    LARGE_INTEGER mtime, manifest_size;
+    UNICODE_STRING nameW;
+    OBJECT_ATTRIBUTES attr;
+    IO_STATUS_BLOCK io;
+    NTSTATUS status;
+    HANDLE cache_file;
+    unsigned int i;
+
+    if (get_manifest_file_info( file, &mtime, &manifest_size )) return;
+
+    serialize_assembly( &blob, assembly );
+    blob_put_ulong( &blob, acl->num_dependencies - num_deps );
+    for (i = num_deps; i < acl->num_dependencies; i++)
+        serialize_identity( &blob, &acl->dependencies[i] );
+    if (blob.failed) goto done;
+
+    header.magic = MANIFEST_CACHE_MAGIC;
+    header.version = MANIFEST_CACHE_VERSION;
+    header.total_size = sizeof(header) + blob.size;
+    header.checksum = manifest_cache_checksum( blob.data, blob.size );
+    header.manifest_mtime = mtime;
+    header.manifest_size = manifest_size;
+
+    if (get_manifest_cache_name( filename, &nameW )) goto done;
+    InitializeObjectAttributes( &attr, &nameW, OBJ_CASE_INSENSITIVE, 0, NULL );
+    status = NtCreateFile( &cache_file, GENERIC_WRITE | SYNCHRONIZE, &attr, &io, NULL,
+                           FILE_ATTRIBUTE_NORMAL, 0, FILE_OVERWRITE_IF,
+                           FILE_SYNCHRONOUS_IO_NONALERT | FILE_NON_DIRECTORY_FILE, NULL, 0 );
+    RtlFreeHeap( GetProcessHeap(), 0, nameW.Buffer );
+    if (status) goto done;
+
+    status = NtWriteFile( cache_file, 0, NULL, NULL, &io, &header, sizeof(header), NULL, NULL );
+    if (!status) status = NtWriteFile( cache_file, 0, NULL, NULL, &io, blob.data, blob.size, NULL, NULL );
+    NtClose( cache_file );
+    if (!status) TRACE( "saved compiled manifest for %s\n", debugstr_w(filename) );
+
+done:
+    RtlFreeHeap( GetProcessHeap(), 0, blob.data );
+}
+
 static NTSTATUS find_first_manifest_resource_in_module( HANDLE hModule, const WCHAR **resname )
 {
     static const LDR_RESOURCE_INFO manifest_res_info = { RT_MANIFEST };
@@ -3064,10 +3580,15 @@ static NTSTATUS get_manifest_in_manifest_file( struct actctx_loader* acl, struct
     LARGE_INTEGER       offset;
     NTSTATUS            status;
     SIZE_T              count;
+    unsigned int        num_deps = acl->num_dependencies;
     void               *base;
 
     TRACE( "loading manifest file %s\n", debugstr_w(filename) );
 
+    /* shared manifests are the same for every process, try the compiled cache first */
+    if (shared && filename && !load_compiled_manifest( acl, ai, filename, file ))
+        return STATUS_SUCCESS;
+
     InitializeObjectAttributes( &attr, NULL, OBJ_CASE_INSENSITIVE, 0, NULL );
     size.QuadPart = 0;
     status = NtCreateSection( &mapping, STANDARD_RIGHTS_REQUIRED | SECTION_QUERY | SECTION_MAP_READ,
@@ -3086,6 +3607,9 @@ static NTSTATUS get_manifest_in_manifest_file( struct actctx_loader* acl, struct
     if (status == STATUS_SUCCESS)
         status = parse_manifest(acl, ai, filename, NULL, directory, shared, base, info.EndOfFile.QuadPart);
 
+    if (status == STATUS_SUCCESS && shared && filename)
+        save_compiled_manifest( acl, num_deps, filename, file );
+
     NtUnmapViewOfSection( GetCurrentProcess(), base );
     return status;
 }
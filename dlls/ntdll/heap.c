@@ -297,6 +297,10 @@ struct heap
     DWORD            magic;         /* Magic number */
     DWORD            pending_pos;   /* Position in pending free requests ring */
     struct block   **pending_free;  /* Ring buffer for pending free requests */
+    LONG             sample_rate;   /* Sample one in sample_rate allocations, 0 when disabled */
+    LONG             sample_left;   /* Allocations left before the next sample */
+    LONG             sample_count;  /* Samples recorded; next write position in the samples ring */
+    HEAP_ALLOCATION_SAMPLE *samples; /* Ring buffer of sampled allocations */
     RTL_CRITICAL_SECTION cs;
     struct entry     free_lists[FREE_LIST_COUNT];
     struct bin      *bins;
@@ -318,6 +322,10 @@ C_ASSERT( HEAP_MIN_LARGE_BLOCK_SIZE <= HEAP_INITIAL_GROW_SIZE );
 
 #define MAX_FREE_PENDING     1024    /* max number of free requests to delay */
 
+#define SAMPLE_RING_SIZE      256    /* number of retained allocation samples */
+
+C_ASSERT( !(SAMPLE_RING_SIZE & (SAMPLE_RING_SIZE - 1)) );
+
 /* some undocumented flags (names are made up) */
 #define HEAP_PRIVATE          0x00001000
 #define HEAP_ADD_USER_INFO    0x00000100
@@ -1526,6 +1534,10 @@ HANDLE WINAPI RtlCreateHeap( ULONG flags, void *addr, SIZE_T total_size, SIZE_T
     heap->magic         = HEAP_MAGIC;
     heap->grow_size     = HEAP_INITIAL_GROW_SIZE;
     heap->min_size      = commit_size;
+    heap->sample_rate   = 0;
+    heap->sample_left   = 0;
+    heap->sample_count  = 0;
+    heap->samples       = NULL;
     list_init( &heap->subheap_list );
     list_init( &heap->large_list );
 
@@ -1673,6 +1685,11 @@ HANDLE WINAPI RtlDestroyHeap( HANDLE handle )
         size = 0;
         NtFreeVirtualMemory( NtCurrentProcess(), &addr, &size, MEM_RELEASE );
     }
+    if ((addr = heap->samples))
+    {
+        size = 0;
+        NtFreeVirtualMemory( NtCurrentProcess(), &addr, &size, MEM_RELEASE );
+    }
     size = 0;
     addr = heap;
     NtFreeVirtualMemory( NtCurrentProcess(), &addr, &size, MEM_RELEASE );
@@ -1977,7 +1994,11 @@ static void bin_try_enable( struct heap *heap, struct bin *bin )
     SIZE_T block_size = BLOCK_BIN_SIZE( bin - heap->bins );
     BOOL enable = FALSE;
 
-    if (bin == heap->bins && alloc > 0x10) enable = TRUE;
+    /* once the heap is switched to the LFH frontend, enable the other bins as soon as they
+     * show some activity, every allocation going through the backend takes the heap lock.
+     */
+    if (ReadNoFence( &heap->compat_info ) == HEAP_LFH && alloc > 0x10) enable = TRUE;
+    else if (bin == heap->bins && alloc > 0x10) enable = TRUE;
     else if (bin - heap->bins < 0x30 && alloc > 0x800) enable = TRUE;
     else if (bin - heap->bins < 0x30 && alloc - freed > 0x10) enable = TRUE;
     else if (alloc - freed > 0x400000 / block_size) enable = TRUE;
@@ -2029,6 +2050,26 @@ void heap_thread_detach(void)
     RtlLeaveCriticalSection( &process_heap->cs );
 }
 
+/* record the size and call stack of one in every sample_rate allocations into
+ * the samples ring.  The ring is written without locking: concurrent writers
+ * may race on a slot and the sampling period may drift slightly under
+ * contention, which is acceptable for a profiler. */
+static void heap_record_sample( struct heap *heap, SIZE_T size )
+{
+    HEAP_ALLOCATION_SAMPLE *sample;
+    LONG rate, seq;
+
+    if (InterlockedDecrement( &heap->sample_left ) > 0) return;
+    if (!(rate = ReadNoFence( &heap->sample_rate ))) return;
+    InterlockedExchange( &heap->sample_left, rate );
+
+    seq = InterlockedIncrement( &heap->sample_count ) - 1;
+    sample = heap->samples + seq % SAMPLE_RING_SIZE;
+    sample->size = size;
+    sample->sequence = seq;
+    sample->depth = RtlCaptureStackBackTrace( 2, ARRAY_SIZE(sample->stack), sample->stack, NULL );
+}
+
 /***********************************************************************
  *           RtlAllocateHeap   (NTDLL.@)
  */
@@ -2062,6 +2103,7 @@ void *WINAPI DECLSPEC_HOTPATCH RtlAllocateHeap( HANDLE handle, ULONG flags, SIZE
     }
 
     if (!status) valgrind_notify_alloc( ptr, size, flags & HEAP_ZERO_MEMORY );
+    if (!status && ReadNoFence( &heap->sample_rate )) heap_record_sample( heap, size );
 
     TRACE( "handle %p, flags %#lx, size %#Ix, return %p, status %#lx.\n", handle, flags, size, ptr, status );
     heap_set_status( heap, flags, status );
@@ -2569,6 +2611,23 @@ NTSTATUS WINAPI RtlQueryHeapInformation( HANDLE handle, HEAP_INFORMATION_CLASS i
         *(ULONG *)info = ReadNoFence( &heap->compat_info );
         return STATUS_SUCCESS;
 
+    case HeapWineAllocationSampling:
+    {
+        HEAP_ALLOCATION_SAMPLING *sampling = info;
+        ULONG count, total;
+
+        if (!(heap = unsafe_heap_from_handle( handle, 0, &flags ))) return STATUS_ACCESS_VIOLATION;
+        total = ReadNoFence( &heap->sample_count );
+        count = min( total, SAMPLE_RING_SIZE );
+        if (size_out) *size_out = offsetof(HEAP_ALLOCATION_SAMPLING, samples[count]);
+        if (size_in < offsetof(HEAP_ALLOCATION_SAMPLING, samples[count])) return STATUS_BUFFER_TOO_SMALL;
+        sampling->rate = ReadNoFence( &heap->sample_rate );
+        sampling->count = count;
+        sampling->total = total;
+        if (count) memcpy( sampling->samples, heap->samples, count * sizeof(*heap->samples) );
+        return STATUS_SUCCESS;
+    }
+
     default:
         FIXME( "HEAP_INFORMATION_CLASS %u not implemented!\n", info_class );
         return STATUS_INVALID_INFO_CLASS;
@@ -2606,6 +2665,34 @@ NTSTATUS WINAPI RtlSetHeapInformation( HANDLE handle, HEAP_INFORMATION_CLASS inf
         return STATUS_SUCCESS;
     }
 
+    case HeapWineAllocationSampling:
+    {
+        ULONG rate;
+
+        if (size < sizeof(ULONG)) return STATUS_BUFFER_TOO_SMALL;
+        if (!(heap = unsafe_heap_from_handle( handle, 0, &flags ))) return STATUS_INVALID_HANDLE;
+
+        rate = *(ULONG *)info;
+        if (rate && !heap->samples)
+        {
+            SIZE_T ring_size = SAMPLE_RING_SIZE * sizeof(*heap->samples);
+            HEAP_ALLOCATION_SAMPLE *samples = NULL;
+
+            if (NtAllocateVirtualMemory( NtCurrentProcess(), (void **)&samples, 0, &ring_size,
+                                         MEM_COMMIT, PAGE_READWRITE ))
+                return STATUS_NO_MEMORY;
+            if (InterlockedCompareExchangePointer( (void **)&heap->samples, samples, NULL ))
+            {
+                void *addr = samples;
+                ring_size = 0;
+                NtFreeVirtualMemory( NtCurrentProcess(), &addr, &ring_size, MEM_RELEASE );
+            }
+        }
+        InterlockedExchange( &heap->sample_left, rate );
+        InterlockedExchange( &heap->sample_rate, rate );
+        return STATUS_SUCCESS;
+    }
+
     default:
         FIXME( "HEAP_INFORMATION_CLASS %u not implemented!\n", info_class );
         return STATUS_SUCCESS;
@@ -139,6 +139,8 @@ typedef struct _wine_modref
     struct file_id        id;
     ULONG                 CheckSum;
     BOOL                  system;
+    DWORD                *export_name_hash;      /* hash table of export names, built on first named lookup */
+    DWORD                 export_name_hash_size; /* size of the hash table, a power of two */
 } WINE_MODREF;
 
 static UINT tls_module_count = 32;     /* number of modules with TLS directory */
@@ -1069,6 +1071,67 @@ static int find_name_in_exports( HMODULE module, const IMAGE_EXPORT_DIRECTORY *e
 }
 
 
+/*************************************************************************
+ *		hash_export_name
+ *
+ * Helper for find_name_in_hash.
+ */
+static DWORD hash_export_name( const char *name )
+{
+    DWORD hash = 0;
+
+    while (*name) hash = hash * 65599 + (unsigned char)*name++;
+    return hash;
+}
+
+
+/*************************************************************************
+ *		find_name_in_hash
+ *
+ * Find the ordinal of a named export using the module's hash table of
+ * export names, building the table on first use.  Returns -1 if the name
+ * is not exported, -2 if the table is not available.
+ * The loader_section must be locked while calling this function.
+ */
+static int find_name_in_hash( HMODULE module, const IMAGE_EXPORT_DIRECTORY *exports, const char *name )
+{
+    const WORD *ordinals = get_rva( module, exports->AddressOfNameOrdinals );
+    const DWORD *names = get_rva( module, exports->AddressOfNames );
+    WINE_MODREF *wm = get_modref( module );
+    DWORD i, pos, size;
+
+    if (!wm) return -2;
+    if (!wm->export_name_hash)
+    {
+        DWORD *hash;
+
+        size = 16;
+        while (size < 2 * exports->NumberOfNames) size *= 2;
+        if (!(hash = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY, size * sizeof(*hash) )))
+            return -2;
+        /* entries hold the index into the name table plus one, zero meaning a free slot */
+        for (i = 0; i < exports->NumberOfNames; i++)
+        {
+            pos = hash_export_name( get_rva( module, names[i] )) & (size - 1);
+            while (hash[pos]) pos = (pos + 1) & (size - 1);
+            hash[pos] = i + 1;
+        }
+        wm->export_name_hash = hash;
+        wm->export_name_hash_size = size;
+    }
+
+    size = wm->export_name_hash_size;
+    pos = hash_export_name( name ) & (size - 1);
+    while ((i = wm->export_name_hash[pos]))
+    {
+        char *ename = get_rva( module, names[i - 1] );
+        if (!strcmp( ename, name )) return ordinals[i - 1];
+        pos = (pos + 1) & (size - 1);
+    }
+    return -1;
+}
+
+
 /*************************************************************************
  *		find_named_export
  *
@@ -1091,8 +1154,10 @@ static FARPROC find_named_export( HMODULE module, const IMAGE_EXPORT_DIRECTORY *
             return find_ordinal_export( module, exports, exp_size, ordinals[hint], load_path, importer, is_dynamic );
     }
 
-    /* then do a binary search */
-    if ((ordinal = find_name_in_exports( module, exports, name )) == -1) return NULL;
+    /* then search the hash table, falling back to a binary search */
+    if ((ordinal = find_name_in_hash( module, exports, name )) == -2)
+        ordinal = find_name_in_exports( module, exports, name );
+    if (ordinal == -1) return NULL;
     return find_ordinal_export( module, exports, exp_size, ordinal, load_path, importer, is_dynamic );
 
 }
@@ -3993,7 +4058,11 @@ static void free_modref( WINE_MODREF *wm )
                         (wm->ldr.Flags & LDR_WINE_INTERNAL) ? "builtin" : "native" );
 
     free_tls_slot( &wm->ldr );
+    RtlFreeHeap( GetProcessHeap(), 0, wm->export_name_hash );
     RtlReleaseActivationContext( wm->ldr.ActivationContext );
+#ifndef __i386__
+    unwind_invalidate_cache( wm->ldr.DllBase );
+#endif
     NtUnmapViewOfSection( NtCurrentProcess(), wm->ldr.DllBase );
     if (cached_modref == wm) cached_modref = NULL;
     RtlFreeUnicodeString( &wm->ldr.FullDllName );
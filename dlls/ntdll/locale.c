@@ -424,6 +424,15 @@ LONG WINAPI RtlCompareUnicodeStrings( const WCHAR *s1, SIZE_T len1, const WCHAR
     }
     else
     {
+        typedef ULONGLONG DECLSPEC_ALIGN(1) unaligned_ui64;
+
+        /* skip equal prefixes four WCHARs at a time */
+        while (len >= 4 && *(const unaligned_ui64 *)s1 == *(const unaligned_ui64 *)s2)
+        {
+            s1 += 4;
+            s2 += 4;
+            len -= 4;
+        }
         while (!ret && len--) ret = *s1++ - *s2++;
     }
     if (!ret) ret = len1 - len2;
@@ -309,6 +309,8 @@ static inline unsigned int cp_wcstombs_size( const CPTABLEINFO *info, const WCHA
 }
 
 
+typedef ULONGLONG DECLSPEC_ALIGN(1) unaligned_ui64;
+
 static inline NTSTATUS utf8_wcstombs_size( const WCHAR *src, unsigned int srclen, unsigned int *reslen )
 {
     unsigned int val, len;
@@ -316,6 +318,14 @@ static inline NTSTATUS utf8_wcstombs_size( const WCHAR *src, unsigned int srclen
 
     for (len = 0; srclen; srclen--, src++)
     {
+        /* skip over runs of ASCII four chars at a time */
+        while (srclen >= 4 && !(*(const unaligned_ui64 *)src & 0xff80ff80ff80ff80ull))
+        {
+            src += 4;
+            srclen -= 4;
+            len += 4;
+        }
+        if (!srclen) break;
         if (*src < 0x80) len++;  /* 0x00-0x7f: 1 byte */
         else if (*src < 0x800) len += 2;  /* 0x80-0x7ff: 2 bytes */
         else
@@ -347,7 +357,16 @@ static inline NTSTATUS utf8_mbstowcs_size( const char *src, unsigned int srclen,
 
     for (len = 0; src < srcend; len++)
     {
-        unsigned char ch = *src++;
+        unsigned char ch;
+
+        /* skip over runs of ASCII eight bytes at a time */
+        while (srcend - src >= 8 && !(*(const unaligned_ui64 *)src & 0x8080808080808080ull))
+        {
+            src += 8;
+            len += 8;
+        }
+        if (src >= srcend) break;
+        ch = *src++;
         if (ch < 0x80) continue;
         if ((res = decode_utf8_char( ch, &src, srcend )) > 0x10ffff)
             status = STATUS_SOME_NOT_MAPPED;
@@ -429,7 +448,26 @@ static inline NTSTATUS utf8_mbstowcs( WCHAR *dst, unsigned int dstlen, unsigned
 
     while ((dst < dstend) && (src < srcend))
     {
-        unsigned char ch = *src++;
+        unsigned char ch;
+
+        /* bulk-convert runs of ASCII eight bytes at a time */
+        while (srcend - src >= 8 && dstend - dst >= 8 &&
+               !(*(const unaligned_ui64 *)src & 0x8080808080808080ull))
+        {
+            dst[0] = (unsigned char)src[0];
+            dst[1] = (unsigned char)src[1];
+            dst[2] = (unsigned char)src[2];
+            dst[3] = (unsigned char)src[3];
+            dst[4] = (unsigned char)src[4];
+            dst[5] = (unsigned char)src[5];
+            dst[6] = (unsigned char)src[6];
+            dst[7] = (unsigned char)src[7];
+            dst += 8;
+            src += 8;
+        }
+        if (dst >= dstend || src >= srcend) break;
+
+        ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
             *dst++ = ch;
@@ -471,8 +509,23 @@ static inline NTSTATUS utf8_wcstombs( char *dst, unsigned int dstlen, unsigned i
 
     for (end = dst + dstlen; srclen; srclen--, src++)
     {
-        WCHAR ch = *src;
+        WCHAR ch;
+
+        /* bulk-convert runs of ASCII four chars at a time */
+        while (srclen >= 4 && end - dst >= 4 &&
+               !(*(const unaligned_ui64 *)src & 0xff80ff80ff80ff80ull))
+        {
+            dst[0] = (char)src[0];
+            dst[1] = (char)src[1];
+            dst[2] = (char)src[2];
+            dst[3] = (char)src[3];
+            dst += 4;
+            src += 4;
+            srclen -= 4;
+        }
+        if (!srclen) break;
 
+        ch = *src;
         if (ch < 0x80)  /* 0x00-0x7f: 1 byte */
         {
             if (dst > end - 1) break;
@@ -24,6 +24,7 @@
 #include "ntstatus.h"
 #define WIN32_NO_STATUS
 #include "wine/debug.h"
+#include "wine/list.h"
 #include "ntdll_misc.h"
 #include "wmistr.h"
 #include "evntrace.h"
@@ -292,12 +293,33 @@ ULONG WINAPI EtwEventActivityIdControl(ULONG code, GUID *guid)
     return ERROR_SUCCESS;
 }
 
+/* registered event providers; no trace sessions exist, so providers are
+ * never enabled and writing an event is a cheap no-op */
+struct etw_provider
+{
+    struct list entry;
+    GUID guid;
+    PENABLECALLBACK callback;
+    void *context;
+};
+
+static struct list etw_providers = LIST_INIT( etw_providers );
+
+static RTL_CRITICAL_SECTION etw_providers_cs;
+static RTL_CRITICAL_SECTION_DEBUG etw_providers_cs_debug =
+{
+    0, 0, &etw_providers_cs,
+    { &etw_providers_cs_debug.ProcessLocksList, &etw_providers_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": etw_providers_cs") }
+};
+static RTL_CRITICAL_SECTION etw_providers_cs = { &etw_providers_cs_debug, -1, 0, 0, 0, 0 };
+
 /******************************************************************************
  *                  EtwEventProviderEnabled (NTDLL.@)
  */
 BOOLEAN WINAPI EtwEventProviderEnabled( REGHANDLE handle, UCHAR level, ULONGLONG keyword )
 {
-    WARN("%s, %u, %s: stub\n", wine_dbgstr_longlong(handle), level, wine_dbgstr_longlong(keyword));
+    TRACE("%s, %u, %s\n", wine_dbgstr_longlong(handle), level, wine_dbgstr_longlong(keyword));
     return FALSE;
 }
 
@@ -307,11 +329,23 @@ BOOLEAN WINAPI EtwEventProviderEnabled( REGHANDLE handle, UCHAR level, ULONGLONG
 ULONG WINAPI EtwEventRegister( LPCGUID provider, PENABLECALLBACK callback, PVOID context,
                 PREGHANDLE handle )
 {
-    WARN("(%s, %p, %p, %p) stub.\n", debugstr_guid(provider), callback, context, handle);
+    struct etw_provider *prov;
+
+    TRACE("(%s, %p, %p, %p)\n", debugstr_guid(provider), callback, context, handle);
+
+    if (!provider || !handle) return ERROR_INVALID_PARAMETER;
+
+    if (!(prov = RtlAllocateHeap( GetProcessHeap(), 0, sizeof(*prov) )))
+        return ERROR_NOT_ENOUGH_MEMORY;
+    prov->guid     = *provider;
+    prov->callback = callback;
+    prov->context  = context;
 
-    if (!handle) return ERROR_INVALID_PARAMETER;
+    RtlEnterCriticalSection( &etw_providers_cs );
+    list_add_tail( &etw_providers, &prov->entry );
+    RtlLeaveCriticalSection( &etw_providers_cs );
 
-    *handle = 0xdeadbeef;
+    *handle = (REGHANDLE)(ULONG_PTR)prov;
     return ERROR_SUCCESS;
 }
 
@@ -320,7 +354,24 @@ ULONG WINAPI EtwEventRegister( LPCGUID provider, PENABLECALLBACK callback, PVOID
  */
 ULONG WINAPI EtwEventUnregister( REGHANDLE handle )
 {
-    WARN("(%s) stub.\n", wine_dbgstr_longlong(handle));
+    struct etw_provider *iter, *found = NULL;
+
+    TRACE("(%s)\n", wine_dbgstr_longlong(handle));
+
+    RtlEnterCriticalSection( &etw_providers_cs );
+    LIST_FOR_EACH_ENTRY( iter, &etw_providers, struct etw_provider, entry )
+    {
+        if ((REGHANDLE)(ULONG_PTR)iter == handle)
+        {
+            found = iter;
+            list_remove( &iter->entry );
+            break;
+        }
+    }
+    RtlLeaveCriticalSection( &etw_providers_cs );
+
+    if (!found) return ERROR_INVALID_PARAMETER;
+    RtlFreeHeap( GetProcessHeap(), 0, found );
     return ERROR_SUCCESS;
 }
 
@@ -339,8 +390,9 @@ ULONG WINAPI EtwEventSetInformation( REGHANDLE handle, EVENT_INFO_CLASS class, v
  */
 ULONG WINAPI EtwEventWriteString( REGHANDLE handle, UCHAR level, ULONGLONG keyword, PCWSTR string )
 {
-    FIXME("%s, %u, %s, %s: stub\n", wine_dbgstr_longlong(handle), level,
+    TRACE("%s, %u, %s, %s\n", wine_dbgstr_longlong(handle), level,
           wine_dbgstr_longlong(keyword), debugstr_w(string));
+    /* the provider is not enabled by any session, drop the event */
     return ERROR_SUCCESS;
 }
 
@@ -350,8 +402,9 @@ ULONG WINAPI EtwEventWriteString( REGHANDLE handle, UCHAR level, ULONGLONG keywo
 ULONG WINAPI EtwEventWriteTransfer( REGHANDLE handle, PCEVENT_DESCRIPTOR descriptor, LPCGUID activity,
                                     LPCGUID related, ULONG count, PEVENT_DATA_DESCRIPTOR data )
 {
-    FIXME("%s, %p, %s, %s, %lu, %p: stub\n", wine_dbgstr_longlong(handle), descriptor,
+    TRACE("%s, %p, %s, %s, %lu, %p\n", wine_dbgstr_longlong(handle), descriptor,
           debugstr_guid(activity), debugstr_guid(related), count, data);
+    /* the provider is not enabled by any session, drop the event */
     return ERROR_SUCCESS;
 }
 
@@ -428,7 +481,7 @@ ULONG WINAPI EtwUnregisterTraceGuids( TRACEHANDLE RegistrationHandle )
  */
 BOOLEAN WINAPI EtwEventEnabled( REGHANDLE handle, const EVENT_DESCRIPTOR *descriptor )
 {
-    WARN("(%s, %p): stub\n", wine_dbgstr_longlong(handle), descriptor);
+    TRACE("(%s, %p)\n", wine_dbgstr_longlong(handle), descriptor);
     return FALSE;
 }
 
@@ -438,7 +491,8 @@ BOOLEAN WINAPI EtwEventEnabled( REGHANDLE handle, const EVENT_DESCRIPTOR *descri
 ULONG WINAPI EtwEventWrite( REGHANDLE handle, const EVENT_DESCRIPTOR *descriptor, ULONG count,
     EVENT_DATA_DESCRIPTOR *data )
 {
-    FIXME("(%s, %p, %lu, %p): stub\n", wine_dbgstr_longlong(handle), descriptor, count, data);
+    TRACE("(%s, %p, %lu, %p)\n", wine_dbgstr_longlong(handle), descriptor, count, data);
+    /* the provider is not enabled by any session, drop the event */
     return ERROR_SUCCESS;
 }
 
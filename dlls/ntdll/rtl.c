@@ -1069,7 +1069,7 @@ PVOID WINAPI RtlDecodePointer( PVOID ptr )
 NTSTATUS WINAPI RtlGetCompressionWorkSpaceSize(USHORT format, PULONG compress_workspace,
                                                PULONG decompress_workspace)
 {
-    FIXME("0x%04x, %p, %p: semi-stub\n", format, compress_workspace, decompress_workspace);
+    TRACE("0x%04x, %p, %p\n", format, compress_workspace, decompress_workspace);
 
     switch (format & COMPRESSION_FORMAT_MASK)
     {
@@ -1084,6 +1084,16 @@ NTSTATUS WINAPI RtlGetCompressionWorkSpaceSize(USHORT format, PULONG compress_wo
                 *decompress_workspace = 0x1000;
             return STATUS_SUCCESS;
 
+        case COMPRESSION_FORMAT_XPRESS:
+        case COMPRESSION_FORMAT_XPRESS_HUFF:
+            /* the Xpress codecs allocate their state internally, but return
+             * nonzero sizes as applications may expect them */
+            if (compress_workspace)
+                *compress_workspace = 0x10000;
+            if (decompress_workspace)
+                *decompress_workspace = 0x10000;
+            return STATUS_SUCCESS;
+
         case COMPRESSION_FORMAT_NONE:
         case COMPRESSION_FORMAT_DEFAULT:
             return STATUS_INVALID_PARAMETER;
@@ -1125,6 +1135,692 @@ static NTSTATUS lznt1_compress(UCHAR *src, ULONG src_size, UCHAR *dst, ULONG dst
     return STATUS_SUCCESS;
 }
 
+#define XPRESS_HASH_BITS     13
+#define XPRESS_HASH_SIZE     (1 << XPRESS_HASH_BITS)
+#define XPRESS_BLOCK_SIZE    0x10000
+#define XPRESS_HUFF_SYMBOLS  512
+#define XPRESS_HUFF_MAX_BITS 15
+
+static inline ULONG xpress_hash( const UCHAR *p )
+{
+    ULONG val = p[0] | (p[1] << 8) | (p[2] << 16);
+    return (val * 0x9e3779b1u) >> (32 - XPRESS_HASH_BITS);
+}
+
+static inline ULONG xpress_bit_length( ULONG val )
+{
+    ULONG bits = 0;
+    while (val >>= 1) bits++;
+    return bits;
+}
+
+/* greedy single probe match finder shared by both Xpress encoders;
+ * the hash table holds the most recent position of each three byte prefix */
+static ULONG xpress_find_match( const UCHAR *begin, const UCHAR *cur, const UCHAR *end,
+                                ULONG *hash_table, ULONG max_offset, ULONG max_length,
+                                ULONG *ret_offset )
+{
+    const UCHAR *match;
+    ULONG hash, pos, length = 0;
+
+    if (cur + 3 > end) return 0;
+    hash = xpress_hash( cur );
+    pos = hash_table[hash];
+    hash_table[hash] = (cur - begin) + 1;
+    if (!pos--) return 0;
+
+    match = begin + pos;
+    if ((ULONG)(cur - match) > max_offset) return 0;
+    if (max_length > (ULONG)(end - cur)) max_length = end - cur;
+    while (length < max_length && match[length] == cur[length]) length++;
+    if (length < 3) return 0;
+    *ret_offset = cur - match;
+    return length;
+}
+
+/* enter the positions covered by a match into the hash table so that
+ * following data can still reference the bytes inside it */
+static void xpress_update_hash( const UCHAR *begin, const UCHAR *cur, const UCHAR *end,
+                                ULONG *hash_table, ULONG length )
+{
+    const UCHAR *p, *stop = cur + length;
+
+    if (stop > end - 2) stop = (end - begin >= 2) ? end - 2 : cur;
+    for (p = cur + 1; p < stop; p++)
+        hash_table[xpress_hash( p )] = (p - begin) + 1;
+}
+
+/* compress data using the plain Xpress (LZ77) format */
+static NTSTATUS xpress_compress(UCHAR *src, ULONG src_size, UCHAR *dst, ULONG dst_size,
+                                ULONG *final_size)
+{
+    UCHAR *src_cur = src, *src_end = src + src_size;
+    UCHAR *dst_cur = dst, *dst_end = dst + dst_size;
+    UCHAR *flags_ptr = NULL, *nibble_ptr = NULL;
+    ULONG flags = 0, flag_count = 0;
+    NTSTATUS status = STATUS_SUCCESS;
+    ULONG *hash_table;
+
+    if (!(hash_table = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY,
+                                        XPRESS_HASH_SIZE * sizeof(*hash_table) )))
+        return STATUS_NO_MEMORY;
+
+    while (src_cur < src_end)
+    {
+        ULONG offset, length = xpress_find_match( src, src_cur, src_end, hash_table,
+                                                  8192, 65538, &offset );
+
+        if (!flag_count)
+        {
+            if (dst_cur + sizeof(ULONG) > dst_end) goto overflow;
+            flags_ptr = dst_cur;
+            dst_cur += sizeof(ULONG);
+            flag_count = 32;
+        }
+        flag_count--;
+
+        if (length)
+        {
+            ULONG extra = length - 3;
+
+            flags = (flags << 1) | 1;
+            if (dst_cur + sizeof(WORD) > dst_end) goto overflow;
+            *(WORD *)dst_cur = ((offset - 1) << 3) | min( extra, 7 );
+            dst_cur += sizeof(WORD);
+            if (extra >= 7)
+            {
+                /* pairs of matches share a length nibble byte */
+                ULONG nibble = min( extra - 7, 15 );
+                if (nibble_ptr)
+                {
+                    *nibble_ptr |= nibble << 4;
+                    nibble_ptr = NULL;
+                }
+                else
+                {
+                    if (dst_cur >= dst_end) goto overflow;
+                    nibble_ptr = dst_cur;
+                    *dst_cur++ = nibble;
+                }
+                if (nibble == 15)
+                {
+                    if (extra - 22 < 255)
+                    {
+                        if (dst_cur >= dst_end) goto overflow;
+                        *dst_cur++ = extra - 22;
+                    }
+                    else
+                    {
+                        if (dst_cur + 1 + sizeof(WORD) > dst_end) goto overflow;
+                        *dst_cur++ = 255;
+                        *(WORD *)dst_cur = extra;
+                        dst_cur += sizeof(WORD);
+                    }
+                }
+            }
+            xpress_update_hash( src, src_cur, src_end, hash_table, length );
+            src_cur += length;
+        }
+        else
+        {
+            flags <<= 1;
+            if (dst_cur >= dst_end) goto overflow;
+            *dst_cur++ = *src_cur++;
+        }
+
+        if (!flag_count) *(ULONG *)flags_ptr = flags;
+    }
+
+    if (flag_count) *(ULONG *)flags_ptr = flags << flag_count;
+
+    if (final_size)
+        *final_size = dst_cur - dst;
+    goto done;
+
+overflow:
+    status = STATUS_BUFFER_TOO_SMALL;
+done:
+    RtlFreeHeap( GetProcessHeap(), 0, hash_table );
+    return status;
+}
+
+/* decompress data encoded with plain Xpress */
+static NTSTATUS xpress_decompress(UCHAR *dst, ULONG dst_size, UCHAR *src, ULONG src_size,
+                                  ULONG *final_size)
+{
+    UCHAR *src_cur = src, *src_end = src + src_size, *nibble_ptr = NULL;
+    UCHAR *dst_cur = dst, *dst_end = dst + dst_size;
+    ULONG flags = 0, flag_count = 0;
+
+    while (dst_cur < dst_end)
+    {
+        if (!flag_count)
+        {
+            if (src_cur + sizeof(ULONG) > src_end) break;
+            flags = *(ULONG *)src_cur;
+            src_cur += sizeof(ULONG);
+            flag_count = 32;
+        }
+        flag_count--;
+
+        if (!(flags & (1u << flag_count)))
+        {
+            /* literal */
+            if (src_cur >= src_end) break;
+            *dst_cur++ = *src_cur++;
+        }
+        else
+        {
+            /* backwards reference */
+            ULONG length, offset;
+            WORD code;
+
+            if (src_cur + sizeof(WORD) > src_end)
+                return STATUS_BAD_COMPRESSION_BUFFER;
+            code = *(WORD *)src_cur;
+            src_cur += sizeof(WORD);
+            offset = (code >> 3) + 1;
+            length = code & 7;
+            if (length == 7)
+            {
+                if (nibble_ptr)
+                {
+                    length = *nibble_ptr >> 4;
+                    nibble_ptr = NULL;
+                }
+                else
+                {
+                    if (src_cur >= src_end) return STATUS_BAD_COMPRESSION_BUFFER;
+                    nibble_ptr = src_cur;
+                    length = *src_cur++ & 15;
+                }
+                if (length == 15)
+                {
+                    if (src_cur >= src_end) return STATUS_BAD_COMPRESSION_BUFFER;
+                    length = *src_cur++;
+                    if (length == 255)
+                    {
+                        if (src_cur + sizeof(WORD) > src_end)
+                            return STATUS_BAD_COMPRESSION_BUFFER;
+                        length = *(WORD *)src_cur;
+                        src_cur += sizeof(WORD);
+                        if (length < 15 + 7) return STATUS_BAD_COMPRESSION_BUFFER;
+                        length -= 15 + 7;
+                    }
+                    length += 15;
+                }
+                length += 7;
+            }
+            length += 3;
+
+            if ((ULONG)(dst_cur - dst) < offset)
+                return STATUS_BAD_COMPRESSION_BUFFER;
+            while (length--)
+            {
+                if (dst_cur >= dst_end) break;
+                *dst_cur = *(dst_cur - offset);
+                dst_cur++;
+            }
+        }
+    }
+
+    if (final_size)
+        *final_size = dst_cur - dst;
+
+    return STATUS_SUCCESS;
+}
+
+/* build the canonical codeword for every symbol from the code length table */
+static BOOL xpress_huff_build_codes( const UCHAR *lens, USHORT *codes )
+{
+    ULONG i, len, code = 0;
+
+    for (len = 1; len <= XPRESS_HUFF_MAX_BITS; len++)
+    {
+        for (i = 0; i < XPRESS_HUFF_SYMBOLS; i++)
+            if (lens[i] == len) codes[i] = code++;
+        if (code > (1u << len)) return FALSE;
+        code <<= 1;
+    }
+    return TRUE;
+}
+
+/* fill a direct lookup table indexed by the next XPRESS_HUFF_MAX_BITS input
+ * bits; each entry holds (symbol << 4) | code length, zero entries mark
+ * invalid prefixes */
+static BOOL xpress_huff_build_table( const UCHAR *lens, USHORT *table )
+{
+    USHORT codes[XPRESS_HUFF_SYMBOLS];
+    ULONG i, j, first, count;
+
+    if (!xpress_huff_build_codes( lens, codes )) return FALSE;
+    memset( table, 0, (1 << XPRESS_HUFF_MAX_BITS) * sizeof(*table) );
+    for (i = 0; i < XPRESS_HUFF_SYMBOLS; i++)
+    {
+        if (!lens[i]) continue;
+        first = codes[i] << (XPRESS_HUFF_MAX_BITS - lens[i]);
+        count = 1 << (XPRESS_HUFF_MAX_BITS - lens[i]);
+        for (j = 0; j < count; j++) table[first + j] = (i << 4) | lens[i];
+    }
+    return TRUE;
+}
+
+/* input bitstream for the Xpress Huffman format; bits are buffered from
+ * little-endian 16-bit words and kept left-aligned in a 32-bit accumulator */
+struct xpress_huff_input
+{
+    UCHAR *ptr;
+    UCHAR *end;
+    ULONG  bits;
+    ULONG  count;
+};
+
+static USHORT xpress_huff_input_word( struct xpress_huff_input *in )
+{
+    USHORT ret;
+
+    if (in->ptr + sizeof(USHORT) > in->end)
+    {
+        in->ptr = in->end;
+        return 0;
+    }
+    ret = *(USHORT *)in->ptr;
+    in->ptr += sizeof(USHORT);
+    return ret;
+}
+
+static UCHAR xpress_huff_input_byte( struct xpress_huff_input *in )
+{
+    if (in->ptr >= in->end) return 0;
+    return *in->ptr++;
+}
+
+static void xpress_huff_input_init( struct xpress_huff_input *in, UCHAR *ptr, UCHAR *end )
+{
+    in->ptr = ptr;
+    in->end = end;
+    in->bits = (ULONG)xpress_huff_input_word( in ) << 16;
+    in->bits |= xpress_huff_input_word( in );
+    in->count = 32;
+}
+
+static inline ULONG xpress_huff_input_bits( const struct xpress_huff_input *in, ULONG n )
+{
+    return n ? in->bits >> (32 - n) : 0;
+}
+
+static void xpress_huff_input_consume( struct xpress_huff_input *in, ULONG n )
+{
+    in->bits <<= n;
+    in->count -= n;
+    if (in->count < 16)
+    {
+        in->bits |= (ULONG)xpress_huff_input_word( in ) << (16 - in->count);
+        in->count += 16;
+    }
+}
+
+/* decompress data encoded with Xpress Huffman */
+static NTSTATUS xpress_huff_decompress(UCHAR *dst, ULONG dst_size, UCHAR *src, ULONG src_size,
+                                       ULONG *final_size)
+{
+    UCHAR *dst_cur = dst, *dst_end = dst + dst_size;
+    UCHAR *src_cur = src, *src_end = src + src_size;
+    UCHAR lens[XPRESS_HUFF_SYMBOLS];
+    NTSTATUS status = STATUS_SUCCESS;
+    USHORT *table;
+    ULONG i;
+
+    if (!(table = RtlAllocateHeap( GetProcessHeap(), 0,
+                                   (1 << XPRESS_HUFF_MAX_BITS) * sizeof(*table) )))
+        return STATUS_NO_MEMORY;
+
+    /* each 64k of output starts with a fresh code length table and bitstream */
+    while (dst_cur < dst_end)
+    {
+        struct xpress_huff_input in;
+        UCHAR *block_end = dst_cur + min( XPRESS_BLOCK_SIZE, (ULONG)(dst_end - dst_cur) );
+
+        if (src_cur + XPRESS_HUFF_SYMBOLS / 2 > src_end)
+        {
+            status = STATUS_BAD_COMPRESSION_BUFFER;
+            break;
+        }
+        for (i = 0; i < XPRESS_HUFF_SYMBOLS / 2; i++)
+        {
+            lens[2 * i] = src_cur[i] & 15;
+            lens[2 * i + 1] = src_cur[i] >> 4;
+        }
+        src_cur += XPRESS_HUFF_SYMBOLS / 2;
+        if (!xpress_huff_build_table( lens, table ))
+        {
+            status = STATUS_BAD_COMPRESSION_BUFFER;
+            break;
+        }
+        xpress_huff_input_init( &in, src_cur, src_end );
+
+        while (dst_cur < block_end)
+        {
+            USHORT entry = table[xpress_huff_input_bits( &in, XPRESS_HUFF_MAX_BITS )];
+            ULONG sym = entry >> 4;
+            ULONG length, offset, offset_bits;
+
+            if (!entry)
+            {
+                status = STATUS_BAD_COMPRESSION_BUFFER;
+                goto done;
+            }
+            xpress_huff_input_consume( &in, entry & 15 );
+            if (sym < 256)
+            {
+                *dst_cur++ = sym;
+                continue;
+            }
+
+            offset_bits = (sym - 256) >> 4;
+            length = sym & 15;
+            offset = (1 << offset_bits) | xpress_huff_input_bits( &in, offset_bits );
+            xpress_huff_input_consume( &in, offset_bits );
+            if (length == 15)
+            {
+                length += xpress_huff_input_byte( &in );
+                if (length == 15 + 255)
+                {
+                    length = xpress_huff_input_byte( &in );
+                    length |= xpress_huff_input_byte( &in ) << 8;
+                }
+            }
+            length += 3;
+
+            if ((ULONG)(dst_cur - dst) < offset)
+            {
+                status = STATUS_BAD_COMPRESSION_BUFFER;
+                goto done;
+            }
+            while (length--)
+            {
+                if (dst_cur >= dst_end) break;
+                *dst_cur = *(dst_cur - offset);
+                dst_cur++;
+            }
+        }
+
+        src_cur = in.ptr;
+    }
+
+done:
+    RtlFreeHeap( GetProcessHeap(), 0, table );
+    if (!status && final_size)
+        *final_size = dst_cur - dst;
+    return status;
+}
+
+struct xpress_huff_node
+{
+    ULONG freq;
+    short parent;
+};
+
+static void xpress_huff_sift_down( const struct xpress_huff_node *nodes, USHORT *heap,
+                                   ULONG heap_size, ULONG i )
+{
+    for (;;)
+    {
+        ULONG child = 2 * i, smallest = i;
+        USHORT tmp;
+
+        if (child <= heap_size && nodes[heap[child]].freq < nodes[heap[smallest]].freq)
+            smallest = child;
+        if (child + 1 <= heap_size && nodes[heap[child + 1]].freq < nodes[heap[smallest]].freq)
+            smallest = child + 1;
+        if (smallest == i) break;
+        tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+/* build length-limited Huffman code lengths from the symbol frequencies;
+ * when the tree gets deeper than the format allows the frequencies are
+ * flattened and the tree is rebuilt */
+static void xpress_huff_build_lengths( ULONG *freq, UCHAR *lens )
+{
+    struct xpress_huff_node nodes[2 * XPRESS_HUFF_SYMBOLS - 1];
+    USHORT heap[XPRESS_HUFF_SYMBOLS + 1];
+    ULONG i, heap_size, node_count, max_len, used = 0, last = 0;
+
+    memset( lens, 0, XPRESS_HUFF_SYMBOLS );
+    for (i = 0; i < XPRESS_HUFF_SYMBOLS; i++)
+        if (freq[i]) { used++; last = i; }
+    if (!used) return;
+    if (used == 1)
+    {
+        lens[last] = 1;
+        return;
+    }
+
+    for (;;)
+    {
+        heap_size = 0;
+        for (i = 0; i < XPRESS_HUFF_SYMBOLS; i++)
+        {
+            if (!freq[i]) continue;
+            nodes[i].freq = freq[i];
+            nodes[i].parent = -1;
+            heap[++heap_size] = i;
+        }
+        for (i = heap_size / 2; i >= 1; i--)
+            xpress_huff_sift_down( nodes, heap, heap_size, i );
+
+        node_count = XPRESS_HUFF_SYMBOLS;
+        while (heap_size > 1)
+        {
+            ULONG a = heap[1], b;
+
+            heap[1] = heap[heap_size--];
+            xpress_huff_sift_down( nodes, heap, heap_size, 1 );
+            b = heap[1];
+
+            nodes[node_count].freq = nodes[a].freq + nodes[b].freq;
+            nodes[node_count].parent = -1;
+            nodes[a].parent = nodes[b].parent = node_count;
+            heap[1] = node_count++;
+            xpress_huff_sift_down( nodes, heap, heap_size, 1 );
+        }
+
+        max_len = 0;
+        for (i = 0; i < XPRESS_HUFF_SYMBOLS; i++)
+        {
+            ULONG len = 0;
+            int n;
+
+            if (!freq[i]) continue;
+            for (n = nodes[i].parent; n != -1; n = nodes[n].parent) len++;
+            lens[i] = len;
+            if (len > max_len) max_len = len;
+        }
+        if (max_len <= XPRESS_HUFF_MAX_BITS) return;
+
+        for (i = 0; i < XPRESS_HUFF_SYMBOLS; i++)
+            if (freq[i]) freq[i] = (freq[i] + 1) / 2;
+    }
+}
+
+/* output bitstream for the Xpress Huffman format; completed 16-bit words go
+ * into previously reserved slots so that interleaved raw bytes end up at the
+ * positions the decoder expects */
+struct xpress_huff_output
+{
+    UCHAR *out;
+    UCHAR *end;
+    UCHAR *slots[2];
+    ULONG  bits;
+    ULONG  count;
+    BOOL   overflow;
+};
+
+static void xpress_huff_output_reserve( struct xpress_huff_output *out )
+{
+    out->slots[0] = out->slots[1];
+    if (out->out + sizeof(USHORT) <= out->end)
+    {
+        out->slots[1] = out->out;
+        out->out += sizeof(USHORT);
+    }
+    else
+    {
+        out->slots[1] = NULL;
+        out->overflow = TRUE;
+    }
+}
+
+static void xpress_huff_output_start_block( struct xpress_huff_output *out )
+{
+    out->slots[0] = out->slots[1] = NULL;
+    out->bits = 0;
+    out->count = 0;
+    xpress_huff_output_reserve( out );
+    xpress_huff_output_reserve( out );
+}
+
+static void xpress_huff_output_bits( struct xpress_huff_output *out, ULONG n, ULONG val )
+{
+    out->bits = (out->bits << n) | val;
+    out->count += n;
+    if (out->count > 16)
+    {
+        out->count -= 16;
+        if (out->slots[0]) *(USHORT *)out->slots[0] = out->bits >> out->count;
+        xpress_huff_output_reserve( out );
+    }
+}
+
+static void xpress_huff_output_byte( struct xpress_huff_output *out, UCHAR val )
+{
+    if (out->out >= out->end)
+    {
+        out->overflow = TRUE;
+        return;
+    }
+    *out->out++ = val;
+}
+
+static void xpress_huff_output_flush( struct xpress_huff_output *out )
+{
+    if (out->slots[0]) *(USHORT *)out->slots[0] = out->count ? out->bits << (16 - out->count) : 0;
+    if (out->slots[1]) *(USHORT *)out->slots[1] = 0;
+}
+
+/* compress data using the Xpress Huffman format */
+static NTSTATUS xpress_huff_compress(UCHAR *src, ULONG src_size, UCHAR *dst, ULONG dst_size,
+                                     ULONG *final_size)
+{
+    struct xpress_huff_item
+    {
+        ULONG length;  /* zero for literals */
+        ULONG offset;  /* literal byte for literals */
+    };
+    struct xpress_huff_workspace
+    {
+        ULONG hash_table[XPRESS_HASH_SIZE];
+        ULONG freq[XPRESS_HUFF_SYMBOLS];
+        USHORT codes[XPRESS_HUFF_SYMBOLS];
+        UCHAR lens[XPRESS_HUFF_SYMBOLS];
+        struct xpress_huff_item items[XPRESS_BLOCK_SIZE];
+    } *ws;
+    UCHAR *src_cur = src, *src_end = src + src_size;
+    struct xpress_huff_output out;
+    NTSTATUS status = STATUS_SUCCESS;
+    ULONG i, item_count;
+
+    if (!(ws = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*ws) )))
+        return STATUS_NO_MEMORY;
+
+    out.out = dst;
+    out.end = dst + dst_size;
+    out.overflow = FALSE;
+
+    do
+    {
+        UCHAR *block_end = src_cur + min( XPRESS_BLOCK_SIZE, (ULONG)(src_end - src_cur) );
+
+        /* parse the block and gather symbol frequencies */
+        item_count = 0;
+        memset( ws->freq, 0, sizeof(ws->freq) );
+        while (src_cur < block_end)
+        {
+            ULONG offset, length = xpress_find_match( src, src_cur, block_end, ws->hash_table,
+                                                      65535, 65538, &offset );
+            struct xpress_huff_item *item = &ws->items[item_count++];
+
+            if (length)
+            {
+                item->length = length;
+                item->offset = offset;
+                ws->freq[256 + (xpress_bit_length( offset ) << 4) + min( length - 3, 15 )]++;
+                xpress_update_hash( src, src_cur, block_end, ws->hash_table, length );
+                src_cur += length;
+            }
+            else
+            {
+                item->length = 0;
+                item->offset = *src_cur++;
+                ws->freq[item->offset]++;
+            }
+        }
+
+        xpress_huff_build_lengths( ws->freq, ws->lens );
+        xpress_huff_build_codes( ws->lens, ws->codes );
+
+        /* write the code length table followed by the symbol bitstream */
+        for (i = 0; i < XPRESS_HUFF_SYMBOLS / 2; i++)
+            xpress_huff_output_byte( &out, ws->lens[2 * i] | (ws->lens[2 * i + 1] << 4) );
+        xpress_huff_output_start_block( &out );
+
+        for (i = 0; i < item_count; i++)
+        {
+            struct xpress_huff_item *item = &ws->items[i];
+            ULONG sym, extra, offset_bits;
+
+            if (!item->length)
+            {
+                sym = item->offset;
+                xpress_huff_output_bits( &out, ws->lens[sym], ws->codes[sym] );
+                continue;
+            }
+
+            extra = item->length - 3;
+            offset_bits = xpress_bit_length( item->offset );
+            sym = 256 + (offset_bits << 4) + min( extra, 15 );
+            xpress_huff_output_bits( &out, ws->lens[sym], ws->codes[sym] );
+            xpress_huff_output_bits( &out, offset_bits,
+                                     item->offset & ((1 << offset_bits) - 1) );
+            if (extra >= 15)
+            {
+                if (extra - 15 < 255)
+                    xpress_huff_output_byte( &out, extra - 15 );
+                else
+                {
+                    xpress_huff_output_byte( &out, 255 );
+                    xpress_huff_output_byte( &out, extra & 0xff );
+                    xpress_huff_output_byte( &out, extra >> 8 );
+                }
+            }
+        }
+        xpress_huff_output_flush( &out );
+    }
+    while (src_cur < src_end);
+
+    if (out.overflow)
+        status = STATUS_BUFFER_TOO_SMALL;
+    else if (final_size)
+        *final_size = out.out - dst;
+
+    RtlFreeHeap( GetProcessHeap(), 0, ws );
+    return status;
+}
+
 /******************************************************************************
  *  RtlCompressBuffer		[NTDLL.@]
  */
@@ -1132,7 +1828,7 @@ NTSTATUS WINAPI RtlCompressBuffer(USHORT format, PUCHAR uncompressed, ULONG unco
                                   PUCHAR compressed, ULONG compressed_size, ULONG chunk_size,
                                   PULONG final_size, PVOID workspace)
 {
-    FIXME("0x%04x, %p, %lu, %p, %lu, %lu, %p, %p: semi-stub\n", format, uncompressed,
+    TRACE("0x%04x, %p, %lu, %p, %lu, %lu, %p, %p\n", format, uncompressed,
           uncompressed_size, compressed, compressed_size, chunk_size, final_size, workspace);
 
     switch (format & COMPRESSION_FORMAT_MASK)
@@ -1141,6 +1837,14 @@ NTSTATUS WINAPI RtlCompressBuffer(USHORT format, PUCHAR uncompressed, ULONG unco
             return lznt1_compress(uncompressed, uncompressed_size, compressed,
                                   compressed_size, chunk_size, final_size, workspace);
 
+        case COMPRESSION_FORMAT_XPRESS:
+            return xpress_compress(uncompressed, uncompressed_size, compressed,
+                                   compressed_size, final_size);
+
+        case COMPRESSION_FORMAT_XPRESS_HUFF:
+            return xpress_huff_compress(uncompressed, uncompressed_size, compressed,
+                                        compressed_size, final_size);
+
         case COMPRESSION_FORMAT_NONE:
         case COMPRESSION_FORMAT_DEFAULT:
             return STATUS_INVALID_PARAMETER;
@@ -1364,8 +2068,21 @@ NTSTATUS WINAPI RtlDecompressBuffer(USHORT format, PUCHAR uncompressed, ULONG un
     TRACE("0x%04x, %p, %lu, %p, %lu, %p\n", format, uncompressed,
         uncompressed_size, compressed, compressed_size, final_size);
 
-    return RtlDecompressFragment(format, uncompressed, uncompressed_size,
-                                 compressed, compressed_size, 0, final_size, NULL);
+    switch (format & COMPRESSION_FORMAT_MASK)
+    {
+        case COMPRESSION_FORMAT_XPRESS:
+            return xpress_decompress(uncompressed, uncompressed_size, compressed,
+                                     compressed_size, final_size);
+
+        case COMPRESSION_FORMAT_XPRESS_HUFF:
+            return xpress_huff_decompress(uncompressed, uncompressed_size, compressed,
+                                          compressed_size, final_size);
+
+        default:
+            /* RtlDecompressFragment only handles LZNT1, like on Windows */
+            return RtlDecompressFragment(format, uncompressed, uncompressed_size,
+                                         compressed, compressed_size, 0, final_size, NULL);
+    }
 }
 
 /******************************************************************************
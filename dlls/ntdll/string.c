@@ -72,9 +72,21 @@ static const unsigned short ctypes[257] =
  */
 void * __cdecl memchr( const void *ptr, int c, size_t n )
 {
+    typedef uint64_t DECLSPEC_ALIGN(1) unaligned_ui64;
+
+    uint64_t mask = 0x101010101010101ull * (unsigned char)c;
     const unsigned char *p = ptr;
 
-    for (p = ptr; n; n--, p++) if (*p == (unsigned char)c) return (void *)(ULONG_PTR)p;
+    /* word-at-a-time scan: (v - 0x01..) & ~v & 0x80.. has a bit set iff
+     * one of the bytes of v is zero */
+    while (n >= 8)
+    {
+        uint64_t v = *(const unaligned_ui64 *)p ^ mask;
+        if ((v - 0x0101010101010101ull) & ~v & 0x8080808080808080ull) break;
+        p += 8;
+        n -= 8;
+    }
+    for ( ; n; n--, p++) if (*p == (unsigned char)c) return (void *)(ULONG_PTR)p;
     return NULL;
 }
 
@@ -84,9 +96,17 @@ void * __cdecl memchr( const void *ptr, int c, size_t n )
  */
 int __cdecl memcmp( const void *ptr1, const void *ptr2, size_t n )
 {
-    const unsigned char *p1, *p2;
+    typedef uint64_t DECLSPEC_ALIGN(1) unaligned_ui64;
+
+    const unsigned char *p1 = ptr1, *p2 = ptr2;
 
-    for (p1 = ptr1, p2 = ptr2; n; n--, p1++, p2++)
+    while (n >= 8 && *(const unaligned_ui64 *)p1 == *(const unaligned_ui64 *)p2)
+    {
+        p1 += 8;
+        p2 += 8;
+        n -= 8;
+    }
+    for ( ; n; n--, p1++, p2++)
     {
         if (*p1 < *p2) return -1;
         if (*p1 > *p2) return 1;
@@ -95,50 +115,76 @@ int __cdecl memcmp( const void *ptr1, const void *ptr2, size_t n )
 }
 
 
-/*********************************************************************
- *                  memcpy   (NTDLL.@)
- *
- * NOTES
- *  Behaves like memmove.
- */
-void * __cdecl memcpy( void *dst, const void *src, size_t n )
+static inline void *copy_bytes( void *dst, const void *src, size_t n )
 {
+    typedef uint64_t DECLSPEC_ALIGN(1) unaligned_ui64;
+
     unsigned char *d = dst;
     const unsigned char *s = src;
 
     if ((size_t)dst - (size_t)src >= n)
     {
+        /* loading a whole block before storing it keeps a forward copy
+         * correct for any overlapping layout */
+        while (n >= 32)
+        {
+            uint64_t v0 = *(const unaligned_ui64 *)(s + 0);
+            uint64_t v1 = *(const unaligned_ui64 *)(s + 8);
+            uint64_t v2 = *(const unaligned_ui64 *)(s + 16);
+            uint64_t v3 = *(const unaligned_ui64 *)(s + 24);
+            *(unaligned_ui64 *)(d + 0)  = v0;
+            *(unaligned_ui64 *)(d + 8)  = v1;
+            *(unaligned_ui64 *)(d + 16) = v2;
+            *(unaligned_ui64 *)(d + 24) = v3;
+            d += 32;
+            s += 32;
+            n -= 32;
+        }
         while (n--) *d++ = *s++;
     }
     else
     {
-        d += n - 1;
-        s += n - 1;
-        while (n--) *d-- = *s--;
+        d += n;
+        s += n;
+        while (n >= 32)
+        {
+            uint64_t v0, v1, v2, v3;
+            d -= 32;
+            s -= 32;
+            n -= 32;
+            v0 = *(const unaligned_ui64 *)(s + 0);
+            v1 = *(const unaligned_ui64 *)(s + 8);
+            v2 = *(const unaligned_ui64 *)(s + 16);
+            v3 = *(const unaligned_ui64 *)(s + 24);
+            *(unaligned_ui64 *)(d + 0)  = v0;
+            *(unaligned_ui64 *)(d + 8)  = v1;
+            *(unaligned_ui64 *)(d + 16) = v2;
+            *(unaligned_ui64 *)(d + 24) = v3;
+        }
+        while (n--) *--d = *--s;
     }
     return dst;
 }
 
 
+/*********************************************************************
+ *                  memcpy   (NTDLL.@)
+ *
+ * NOTES
+ *  Behaves like memmove.
+ */
+void * __cdecl memcpy( void *dst, const void *src, size_t n )
+{
+    return copy_bytes( dst, src, n );
+}
+
+
 /*********************************************************************
  *                  memmove   (NTDLL.@)
  */
 void * __cdecl memmove( void *dst, const void *src, size_t n )
 {
-    unsigned char *d = dst;
-    const unsigned char *s = src;
-
-    if ((size_t)dst - (size_t)src >= n)
-    {
-        while (n--) *d++ = *s++;
-    }
-    else
-    {
-        d += n - 1;
-        s += n - 1;
-        while (n--) *d-- = *s--;
-    }
-    return dst;
+    return copy_bytes( dst, src, n );
 }
 
 
@@ -5698,6 +5698,104 @@ static void test_ioctl(void)
     CloseHandle(file);
 }
 
+static void test_sparse_file(void)
+{
+    FILE_ALLOCATED_RANGE_BUFFER query, ranges[16];
+    FILE_ZERO_DATA_INFORMATION zero_info;
+    static char buffer[192 * 1024];
+    BOOL data_start, data_end;
+    IO_STATUS_BLOCK iosb;
+    DWORD bytes, count, i;
+    NTSTATUS status;
+    HANDLE file;
+
+    file = create_temp_file(0);
+    if (!file) return;
+
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_SPARSE, NULL, 0, NULL, 0);
+    if (status != STATUS_SUCCESS)
+    {
+        win_skip("cannot make the file sparse, status %lx\n", status);
+        CloseHandle(file);
+        return;
+    }
+
+    memset(buffer, 'x', sizeof(buffer));
+    SetFilePointer(file, 0, NULL, FILE_BEGIN);
+    WriteFile(file, buffer, sizeof(buffer), &bytes, NULL);
+    ok(bytes == sizeof(buffer), "wrote %lu bytes\n", bytes);
+
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA, NULL, 0, NULL, 0);
+    ok(status == STATUS_INVALID_PARAMETER, "NtFsControlFile returned %lx\n", status);
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zero_info, sizeof(zero_info) - 1, NULL, 0);
+    ok(status == STATUS_INVALID_PARAMETER, "NtFsControlFile returned %lx\n", status);
+
+    zero_info.FileOffset.QuadPart = 128 * 1024;
+    zero_info.BeyondFinalZero.QuadPart = 64 * 1024;
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zero_info, sizeof(zero_info), NULL, 0);
+    ok(status == STATUS_INVALID_PARAMETER, "NtFsControlFile returned %lx\n", status);
+
+    /* punch a hole covering the middle third of the file */
+    zero_info.FileOffset.QuadPart = 64 * 1024;
+    zero_info.BeyondFinalZero.QuadPart = 128 * 1024;
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zero_info, sizeof(zero_info), NULL, 0);
+    ok(status == STATUS_SUCCESS, "NtFsControlFile returned %lx\n", status);
+
+    SetFilePointer(file, 0, NULL, FILE_BEGIN);
+    ReadFile(file, buffer, sizeof(buffer), &bytes, NULL);
+    ok(bytes == sizeof(buffer), "read %lu bytes\n", bytes);
+    for (i = 0; i < sizeof(buffer); i++)
+    {
+        char expect = (i >= 64 * 1024 && i < 128 * 1024) ? 0 : 'x';
+        if (buffer[i] != expect) break;
+    }
+    ok(i == sizeof(buffer), "wrong data at offset %lu\n", i);
+
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_QUERY_ALLOCATED_RANGES,
+                              &query, sizeof(query) - 1, ranges, sizeof(ranges));
+    ok(status == STATUS_INVALID_PARAMETER, "NtFsControlFile returned %lx\n", status);
+
+    query.FileOffset.QuadPart = 0;
+    query.Length.QuadPart = sizeof(buffer);
+    memset(&iosb, 0x55, sizeof(iosb));
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_QUERY_ALLOCATED_RANGES,
+                              &query, sizeof(query), ranges, sizeof(ranges));
+    ok(status == STATUS_SUCCESS, "NtFsControlFile returned %lx\n", status);
+    ok(iosb.Information % sizeof(*ranges) == 0, "Information = %Iu\n", iosb.Information);
+    count = iosb.Information / sizeof(*ranges);
+    ok(count >= 1, "got no allocated ranges\n");
+
+    /* the filesystem is free to report the hole as allocated, but the
+     * returned ranges have to be ascending, stay within the queried range,
+     * and cover both data regions */
+    data_start = data_end = FALSE;
+    for (i = 0; i < count; i++)
+    {
+        LONGLONG start = ranges[i].FileOffset.QuadPart, len = ranges[i].Length.QuadPart;
+        ok(start >= 0 && len > 0 && start + len <= sizeof(buffer),
+           "wrong range %s+%s\n", wine_dbgstr_longlong(start), wine_dbgstr_longlong(len));
+        if (i) ok(start >= ranges[i - 1].FileOffset.QuadPart + ranges[i - 1].Length.QuadPart,
+                  "range %lu is not ascending\n", i);
+        if (start == 0) data_start = TRUE;
+        if (start + len == sizeof(buffer)) data_end = TRUE;
+    }
+    ok(data_start, "first data region is not covered\n");
+    ok(data_end, "last data region is not covered\n");
+
+    if (count > 1)
+    {
+        status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_QUERY_ALLOCATED_RANGES,
+                                  &query, sizeof(query), ranges, sizeof(*ranges));
+        ok(status == STATUS_BUFFER_OVERFLOW, "NtFsControlFile returned %lx\n", status);
+        ok(iosb.Information == sizeof(*ranges), "Information = %Iu\n", iosb.Information);
+    }
+
+    CloseHandle(file);
+}
+
 static void test_flush_buffers_file(void)
 {
     char path[MAX_PATH], buffer[MAX_PATH];
@@ -6133,6 +6231,7 @@ START_TEST(file)
     test_query_volume_information_file();
     test_query_attribute_information_file();
     test_ioctl();
+    test_sparse_file();
     test_query_ea();
     test_flush_buffers_file();
     test_mailslot_name();
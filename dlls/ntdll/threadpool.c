@@ -114,6 +114,7 @@ struct threadpool
     int                     min_workers;
     int                     num_workers;
     int                     num_busy_workers;
+    int                     num_idle_workers;
     HANDLE                  compl_port;
     TP_POOL_STACK_INFORMATION stack_info;
 };
@@ -1993,6 +1994,7 @@ static void tp_object_submit( struct threadpool_object *object, BOOL signaled )
 {
     struct threadpool *pool = object->pool;
     NTSTATUS status = STATUS_UNSUCCESSFUL;
+    BOOL wake = FALSE;
 
     assert( !object->shutdown );
     assert( !pool->shutdown );
@@ -2013,14 +2015,21 @@ static void tp_object_submit( struct threadpool_object *object, BOOL signaled )
     if (object->type == TP_OBJECT_TYPE_WAIT && signaled)
         object->u.wait.signaled++;
 
-    /* No new thread started - wake up one existing thread. */
+    /* No new thread started - wake up one existing thread, but only when one
+     * is actually sleeping: busy workers recheck the queues before sleeping,
+     * so when the pool is saturated the item will be picked up anyway and the
+     * wakeup would be wasted. */
     if (status != STATUS_SUCCESS)
     {
         assert( pool->num_workers > 0 );
-        RtlWakeConditionVariable( &pool->update_event );
+        wake = pool->num_idle_workers != 0;
     }
 
     RtlLeaveCriticalSection( &pool->cs );
+
+    /* Wake after dropping the lock so that the woken worker does not
+     * immediately block on it again. */
+    if (wake) RtlWakeConditionVariable( &pool->update_event );
 }
 
 /***********************************************************************
@@ -2342,6 +2351,7 @@ static void CALLBACK threadpool_worker_proc( void *param )
 {
     struct threadpool *pool = param;
     LARGE_INTEGER timeout;
+    NTSTATUS status;
     struct list *ptr;
 
     TRACE( "starting worker thread for pool %p\n", pool );
@@ -2379,7 +2389,10 @@ static void CALLBACK threadpool_worker_proc( void *param )
          * min_workers == 0, then objcount is used to detect if the last thread
          * can be terminated. */
         timeout.QuadPart = (ULONGLONG)THREADPOOL_WORKER_TIMEOUT * -10000;
-        if (RtlSleepConditionVariableCS( &pool->update_event, &pool->cs, &timeout ) == STATUS_TIMEOUT &&
+        pool->num_idle_workers++;
+        status = RtlSleepConditionVariableCS( &pool->update_event, &pool->cs, &timeout );
+        pool->num_idle_workers--;
+        if (status == STATUS_TIMEOUT &&
             !threadpool_get_next_item( pool ) && (pool->num_workers > max( pool->min_workers, 1 ) ||
             (!pool->min_workers && !pool->objcount)))
         {
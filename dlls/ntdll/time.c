@@ -382,6 +382,17 @@ LONGLONG WINAPI RtlGetSystemTimePrecise( void )
  */
 BOOL WINAPI DECLSPEC_HOTPATCH RtlQueryPerformanceCounter( LARGE_INTEGER *counter )
 {
+#if (defined(__i386__) || defined(__x86_64__)) && !defined(__arm64ec__)
+    if (user_shared_data->QpcBypassEnabled & SHARED_GLOBAL_FLAGS_QPC_BYPASS_ENABLED)
+    {
+        unsigned int aux, lo, hi;
+
+        __asm__ __volatile__( "rdtscp" : "=a" (lo), "=d" (hi), "=c" (aux) );
+        counter->QuadPart = ((((ULONGLONG)hi << 32) | lo) + user_shared_data->QpcBias)
+                            >> user_shared_data->QpcShift;
+        return TRUE;
+    }
+#endif
     NtQueryPerformanceCounter( counter, NULL );
     return TRUE;
 }
@@ -391,6 +402,13 @@ BOOL WINAPI DECLSPEC_HOTPATCH RtlQueryPerformanceCounter( LARGE_INTEGER *counter
  */
 BOOL WINAPI DECLSPEC_HOTPATCH RtlQueryPerformanceFrequency( LARGE_INTEGER *frequency )
 {
+#if (defined(__i386__) || defined(__x86_64__)) && !defined(__arm64ec__)
+    if (user_shared_data->QpcBypassEnabled & SHARED_GLOBAL_FLAGS_QPC_BYPASS_ENABLED)
+    {
+        frequency->QuadPart = user_shared_data->QpcFrequency;
+        return TRUE;
+    }
+#endif
     frequency->QuadPart = TICKSPERSEC;
     return TRUE;
 }
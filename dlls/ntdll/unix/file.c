@@ -84,6 +84,19 @@
 #ifdef HAVE_LINUX_MAJOR_H
 # include <linux/major.h>
 #endif
+#ifdef __linux__
+# include <linux/falloc.h>
+#endif
+#if defined(__linux__) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  define USE_SEGMENT_IO_URING
+# endif
+#endif
+#ifdef HAVE_SYS_UIO_H
+# include <sys/uio.h>
+#endif
 #ifdef HAVE_SYS_PARAM_H
 #include <sys/param.h>
 #endif
@@ -2897,6 +2910,95 @@ NTSTATUS WINAPI NtQueryDirectoryFile( HANDLE handle, HANDLE event, PIO_APC_ROUTI
 }
 
 
+/* cache of case-insensitive directory lookups, mapping a directory identity
+ * and a searched name to the matching on-disk entry, so that repeated lookups
+ * do not have to rescan large directories. Entries are validated against the
+ * directory mtime, which changes whenever a directory entry is created,
+ * removed or renamed, and a hit is additionally confirmed with a stat of the
+ * found name. Negative results are not cached: they cannot be re-verified
+ * short of rescanning, and on filesystems like NFS the directory mtime can
+ * lag behind changes made by other clients, which would make a stale entry
+ * hide a newly created file.
+ */
+#define DIR_CASE_CACHE_SIZE 256  /* must be a power of two */
+
+struct dir_case_cache_entry
+{
+    dev_t dev;                          /* identity of the directory */
+    ino_t ino;
+    struct timespec mtime;              /* directory mtime when the entry was cached */
+    unsigned int name_len;              /* length of the searched name in chars */
+    WCHAR name[MAX_DIR_ENTRY_LEN + 1];  /* searched name */
+    char unix_name[MAX_DIR_ENTRY_LEN * 3 + 1];  /* matching on-disk name, empty if none */
+};
+
+static struct dir_case_cache_entry *dir_case_cache[DIR_CASE_CACHE_SIZE];
+static pthread_mutex_t dir_case_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct timespec get_dir_case_cache_mtime( const struct stat *st )
+{
+    struct timespec ts;
+#ifdef HAVE_STRUCT_STAT_ST_MTIM
+    ts = st->st_mtim;
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC)
+    ts = st->st_mtimespec;
+#else
+    ts.tv_sec = st->st_mtime;
+    ts.tv_nsec = 0;
+#endif
+    return ts;
+}
+
+static unsigned int dir_case_cache_hash( const struct stat *st, const WCHAR *name, int length )
+{
+    unsigned int hash = (unsigned int)st->st_ino ^ (unsigned int)st->st_dev;
+    while (length--) hash = hash * 65599 + ntdll_towlower( *name++ );
+    return hash & (DIR_CASE_CACHE_SIZE - 1);
+}
+
+/* retrieve a cached lookup result; returns FALSE on miss */
+static BOOL find_dir_case_cache( const struct stat *st, const WCHAR *name, int length, char *unix_name )
+{
+    struct timespec mtime = get_dir_case_cache_mtime( st );
+    struct dir_case_cache_entry *entry;
+    BOOL ret = FALSE;
+
+    pthread_mutex_lock( &dir_case_cache_mutex );
+    entry = dir_case_cache[dir_case_cache_hash( st, name, length )];
+    if (entry && entry->dev == st->st_dev && entry->ino == st->st_ino &&
+        entry->mtime.tv_sec == mtime.tv_sec && entry->mtime.tv_nsec == mtime.tv_nsec &&
+        entry->name_len == length && !wcsnicmp( entry->name, name, length ))
+    {
+        strcpy( unix_name, entry->unix_name );
+        ret = TRUE;
+    }
+    pthread_mutex_unlock( &dir_case_cache_mutex );
+    return ret;
+}
+
+static void add_dir_case_cache( const struct stat *st, const WCHAR *name, int length, const char *unix_name )
+{
+    struct dir_case_cache_entry *entry;
+    unsigned int hash = dir_case_cache_hash( st, name, length );
+
+    if (length > MAX_DIR_ENTRY_LEN || strlen( unix_name ) > MAX_DIR_ENTRY_LEN * 3) return;
+
+    pthread_mutex_lock( &dir_case_cache_mutex );
+    if (!(entry = dir_case_cache[hash]) && !(entry = dir_case_cache[hash] = malloc( sizeof(*entry) )))
+    {
+        pthread_mutex_unlock( &dir_case_cache_mutex );
+        return;
+    }
+    entry->dev      = st->st_dev;
+    entry->ino      = st->st_ino;
+    entry->mtime    = get_dir_case_cache_mtime( st );
+    entry->name_len = length;
+    memcpy( entry->name, name, length * sizeof(WCHAR) );
+    strcpy( entry->unix_name, unix_name );
+    pthread_mutex_unlock( &dir_case_cache_mutex );
+}
+
+
 /***********************************************************************
  *           find_file_in_dir
  *
@@ -2908,10 +3010,12 @@ static NTSTATUS find_file_in_dir( int root_fd, char *unix_name, int pos, const W
                                   BOOLEAN check_case )
 {
     WCHAR buffer[MAX_DIR_ENTRY_LEN];
+    char cached_name[MAX_DIR_ENTRY_LEN * 3 + 1];
     BOOLEAN is_name_8_dot_3;
+    BOOL have_dir_st;
     DIR *dir;
     struct dirent *de;
-    struct stat st;
+    struct stat st, dir_st;
     int fd, ret;
 
     /* try a shortcut for this directory */
@@ -2937,6 +3041,19 @@ static NTSTATUS find_file_in_dir( int root_fd, char *unix_name, int pos, const W
 
     if (!is_name_8_dot_3 && !get_dir_case_sensitivity( root_fd, unix_name )) goto not_found;
 
+    /* check the lookup cache before scanning the directory */
+
+    have_dir_st = !fstatat( root_fd, unix_name, &dir_st, 0 );
+    if (have_dir_st && find_dir_case_cache( &dir_st, name, length, cached_name ))
+    {
+        unix_name[pos - 1] = '/';
+        strcpy( unix_name + pos, cached_name );
+        if (!fstatat( root_fd, unix_name, &st, 0 )) return STATUS_SUCCESS;
+        /* cached entry disappeared without a directory mtime change, rescan */
+        if (pos > 1) unix_name[pos - 1] = 0;
+        else unix_name[1] = 0;
+    }
+
     /* now look for it through the directory */
 
 #ifdef VFAT_IOCTL_READDIR_BOTH
@@ -3002,6 +3119,7 @@ static NTSTATUS find_file_in_dir( int root_fd, char *unix_name, int pos, const W
         {
             strcpy( unix_name + pos, de->d_name );
             closedir( dir );
+            if (have_dir_st) add_dir_case_cache( &dir_st, name, length, unix_name + pos );
             return STATUS_SUCCESS;
         }
 
@@ -3015,6 +3133,7 @@ static NTSTATUS find_file_in_dir( int root_fd, char *unix_name, int pos, const W
             {
                 strcpy( unix_name + pos, de->d_name );
                 closedir( dir );
+                if (have_dir_st) add_dir_case_cache( &dir_st, name, length, unix_name + pos );
                 return STATUS_SUCCESS;
             }
         }
@@ -4149,6 +4268,95 @@ NTSTATUS open_unix_file( HANDLE *handle, const char *unix_name, ACCESS_MASK acce
 }
 
 
+/* Cache of recently failed attribute queries. Windows apps probe the same
+ * nonexistent files (DLL search paths, config overrides) over and over, and
+ * each probe costs a full path resolution. Entries expire after a short
+ * timeout to bound the window during which a file created by another process
+ * is missed, and the whole cache is flushed whenever this process itself
+ * creates, deletes or renames anything.
+ */
+#define NEG_ATTR_CACHE_SIZE 64        /* must be a power of two */
+#define NEG_ATTR_CACHE_TIMEOUT 1000   /* in milliseconds */
+
+struct neg_attr_cache_entry
+{
+    WCHAR *name;             /* NT path, NULL if unused */
+    unsigned int name_len;   /* length in chars */
+    unsigned int status;     /* failure status of the query */
+    struct timespec time;    /* when the result was cached */
+};
+
+static struct neg_attr_cache_entry neg_attr_cache[NEG_ATTR_CACHE_SIZE];
+static pthread_mutex_t neg_attr_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static unsigned int neg_attr_cache_hash( const WCHAR *name, unsigned int len )
+{
+    unsigned int hash = 0;
+    while (len--) hash = hash * 65599 + ntdll_towlower( *name++ );
+    return hash & (NEG_ATTR_CACHE_SIZE - 1);
+}
+
+/* retrieve a cached failure status for a path; the attributes must already have
+ * been redirected */
+static BOOL find_neg_attr_cache( const OBJECT_ATTRIBUTES *attr, unsigned int *status )
+{
+    unsigned int len = attr->ObjectName->Length / sizeof(WCHAR);
+    struct neg_attr_cache_entry *entry;
+    struct timespec now;
+    LONGLONG age;
+    BOOL ret = FALSE;
+
+    if (attr->RootDirectory || !len) return FALSE;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    pthread_mutex_lock( &neg_attr_cache_mutex );
+    entry = &neg_attr_cache[neg_attr_cache_hash( attr->ObjectName->Buffer, len )];
+    age = (now.tv_sec - entry->time.tv_sec) * 1000 + (now.tv_nsec - entry->time.tv_nsec) / 1000000;
+    if (entry->name && age < NEG_ATTR_CACHE_TIMEOUT && entry->name_len == len &&
+        !wcsnicmp( entry->name, attr->ObjectName->Buffer, len ))
+    {
+        *status = entry->status;
+        ret = TRUE;
+    }
+    pthread_mutex_unlock( &neg_attr_cache_mutex );
+    return ret;
+}
+
+static void add_neg_attr_cache( const OBJECT_ATTRIBUTES *attr, unsigned int status )
+{
+    unsigned int len = attr->ObjectName->Length / sizeof(WCHAR);
+    struct neg_attr_cache_entry *entry;
+    WCHAR *name;
+
+    if (attr->RootDirectory || !len) return;
+    if (status != STATUS_OBJECT_NAME_NOT_FOUND && status != STATUS_OBJECT_PATH_NOT_FOUND) return;
+    if (!(name = malloc( len * sizeof(WCHAR) ))) return;
+    memcpy( name, attr->ObjectName->Buffer, len * sizeof(WCHAR) );
+
+    pthread_mutex_lock( &neg_attr_cache_mutex );
+    entry = &neg_attr_cache[neg_attr_cache_hash( name, len )];
+    free( entry->name );
+    entry->name     = name;
+    entry->name_len = len;
+    entry->status   = status;
+    clock_gettime( CLOCK_MONOTONIC, &entry->time );
+    pthread_mutex_unlock( &neg_attr_cache_mutex );
+}
+
+/* flush the cache after an operation of this process that may create directory entries */
+static void flush_neg_attr_cache(void)
+{
+    unsigned int i;
+
+    pthread_mutex_lock( &neg_attr_cache_mutex );
+    for (i = 0; i < NEG_ATTR_CACHE_SIZE; i++)
+    {
+        free( neg_attr_cache[i].name );
+        neg_attr_cache[i].name = NULL;
+    }
+    pthread_mutex_unlock( &neg_attr_cache_mutex );
+}
+
+
 /******************************************************************************
  *              NtCreateFile   (NTDLL.@)
  */
@@ -4231,6 +4439,8 @@ NTSTATUS WINAPI NtCreateFile( HANDLE *handle, ACCESS_MASK access, OBJECT_ATTRIBU
             break;
         }
 
+        if (io->Information != FILE_OPENED) flush_neg_attr_cache();
+
         if (io->Information == FILE_CREATED &&
             ((attributes & XATTR_ATTRIBS_MASK) || name_hidden))
         {
@@ -4392,6 +4602,11 @@ NTSTATUS WINAPI NtQueryFullAttributesFile( const OBJECT_ATTRIBUTES *attr,
     OBJECT_ATTRIBUTES new_attr = *attr;
 
     get_redirect( &new_attr, &redir );
+    if (find_neg_attr_cache( &new_attr, &status ))
+    {
+        free( redir.Buffer );
+        return status;
+    }
     if (!(status = nt_to_unix_file_name( &new_attr, &unix_name, FILE_OPEN )))
     {
         ULONG attributes;
@@ -4405,7 +4620,11 @@ NTSTATUS WINAPI NtQueryFullAttributesFile( const OBJECT_ATTRIBUTES *attr,
             fill_file_info( &st, attributes, info, FileNetworkOpenInformation );
         free( unix_name );
     }
-    else WARN( "%s not found (%x)\n", debugstr_us(attr->ObjectName), status );
+    else
+    {
+        add_neg_attr_cache( &new_attr, status );
+        WARN( "%s not found (%x)\n", debugstr_us(attr->ObjectName), status );
+    }
     free( redir.Buffer );
     return status;
 }
@@ -4422,6 +4641,11 @@ NTSTATUS WINAPI NtQueryAttributesFile( const OBJECT_ATTRIBUTES *attr, FILE_BASIC
     OBJECT_ATTRIBUTES new_attr = *attr;
 
     get_redirect( &new_attr, &redir );
+    if (find_neg_attr_cache( &new_attr, &status ))
+    {
+        free( redir.Buffer );
+        return status;
+    }
     if (!(status = nt_to_unix_file_name( &new_attr, &unix_name, FILE_OPEN )))
     {
         ULONG attributes;
@@ -4435,7 +4659,11 @@ NTSTATUS WINAPI NtQueryAttributesFile( const OBJECT_ATTRIBUTES *attr, FILE_BASIC
             status = fill_file_info( &st, attributes, info, FileBasicInformation );
         free( unix_name );
     }
-    else WARN( "%s not found (%x)\n", debugstr_us(attr->ObjectName), status );
+    else
+    {
+        add_neg_attr_cache( &new_attr, status );
+        WARN( "%s not found (%x)\n", debugstr_us(attr->ObjectName), status );
+    }
     free( redir.Buffer );
     return status;
 }
@@ -4959,6 +5187,7 @@ NTSTATUS WINAPI NtSetInformationFile( HANDLE handle, IO_STATUS_BLOCK *io,
                 }
                 SERVER_END_REQ;
 
+                if (status == STATUS_SUCCESS) flush_neg_attr_cache();
                 free( unix_name );
             }
             free( redir.Buffer );
@@ -5006,6 +5235,7 @@ NTSTATUS WINAPI NtSetInformationFile( HANDLE handle, IO_STATUS_BLOCK *io,
                 }
                 SERVER_END_REQ;
 
+                if (status == STATUS_SUCCESS) flush_neg_attr_cache();
                 free( unix_name );
             }
             free( redir.Buffer );
@@ -5528,6 +5758,224 @@ void file_complete_async( HANDLE handle, unsigned int options, HANDLE event, PIO
 }
 
 
+#ifdef USE_SEGMENT_IO_URING
+
+/* io_uring instance for batching scatter/gather page I/O, so that
+ * NtReadFileScatter / NtWriteFileGather submit all their page-sized
+ * requests with a single syscall instead of one pread/pwrite per page.
+ */
+#define SEGMENT_URING_ENTRIES 64
+
+static int segment_uring_fd = -1;          /* -1 = not initialized, -2 = unavailable */
+static struct io_uring_params segment_uring_params;
+static struct io_uring_sqe *segment_uring_sqes;
+static void *segment_uring_ring;
+static unsigned int *segment_uring_sq_array;
+static pthread_mutex_t segment_uring_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* initialize the ring on first use; segment_uring_mutex must be held */
+static BOOL segment_uring_init(void)
+{
+    struct io_uring_params *params = &segment_uring_params;
+    size_t ring_size, sqes_size;
+    int fd;
+
+    if (segment_uring_fd >= 0) return TRUE;
+    if (segment_uring_fd == -2) return FALSE;
+    segment_uring_fd = -2;
+
+    if ((fd = syscall( __NR_io_uring_setup, SEGMENT_URING_ENTRIES, params )) == -1) return FALSE;
+    if (!(params->features & IORING_FEAT_SINGLE_MMAP) || !(params->features & IORING_FEAT_NODROP))
+    {
+        close( fd );
+        return FALSE;
+    }
+    ring_size = max( params->sq_off.array + params->sq_entries * sizeof(unsigned int),
+                     params->cq_off.cqes + params->cq_entries * sizeof(struct io_uring_cqe) );
+    sqes_size = params->sq_entries * sizeof(struct io_uring_sqe);
+    if ((segment_uring_ring = mmap( NULL, ring_size, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING )) == MAP_FAILED)
+    {
+        close( fd );
+        return FALSE;
+    }
+    if ((segment_uring_sqes = mmap( NULL, sqes_size, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES )) == MAP_FAILED)
+    {
+        munmap( segment_uring_ring, ring_size );
+        close( fd );
+        return FALSE;
+    }
+    segment_uring_sq_array = (unsigned int *)((char *)segment_uring_ring + params->sq_off.array);
+    segment_uring_fd = fd;
+    return TRUE;
+}
+
+/* perform scatter/gather I/O at an explicit offset through io_uring, batching
+ * up to SEGMENT_URING_ENTRIES pages per syscall. Returns FALSE when the ring
+ * is unavailable or any request did not complete cleanly; the caller then
+ * falls back to the per-page loop, which is safe to replay since positioned
+ * I/O on a regular file is idempotent.
+ */
+static BOOL segment_uring_io( int unix_fd, BOOL write, FILE_SEGMENT_ELEMENT *segments,
+                              ULONG length, LONGLONG offset, UINT *ret_total )
+{
+    unsigned int page_count = (length + page_size - 1) / page_size;
+    unsigned int i, done, chunk, pending, received;
+    int results[SEGMENT_URING_ENTRIES];
+    BOOL ret = TRUE;
+    UINT total = 0;
+
+    pthread_mutex_lock( &segment_uring_mutex );
+    if (!segment_uring_init())
+    {
+        pthread_mutex_unlock( &segment_uring_mutex );
+        return FALSE;
+    }
+
+    for (done = 0; ret && done < page_count; done += chunk)
+    {
+        unsigned int *sq_tail = (unsigned int *)((char *)segment_uring_ring + segment_uring_params.sq_off.tail);
+        unsigned int *cq_head = (unsigned int *)((char *)segment_uring_ring + segment_uring_params.cq_off.head);
+        unsigned int *cq_tail = (unsigned int *)((char *)segment_uring_ring + segment_uring_params.cq_off.tail);
+        unsigned int sq_mask = *(unsigned int *)((char *)segment_uring_ring + segment_uring_params.sq_off.ring_mask);
+        unsigned int cq_mask = *(unsigned int *)((char *)segment_uring_ring + segment_uring_params.cq_off.ring_mask);
+        struct io_uring_cqe *cqes = (struct io_uring_cqe *)((char *)segment_uring_ring + segment_uring_params.cq_off.cqes);
+        unsigned int tail = *sq_tail;
+
+        chunk = min( page_count - done, SEGMENT_URING_ENTRIES );
+        for (i = 0; i < chunk; i++)
+        {
+            struct io_uring_sqe *sqe = segment_uring_sqes + (tail & sq_mask);
+            unsigned int page = done + i;
+
+            memset( sqe, 0, sizeof(*sqe) );
+            sqe->opcode    = write ? IORING_OP_WRITE : IORING_OP_READ;
+            sqe->fd        = unix_fd;
+            sqe->addr      = (ULONG_PTR)segments[page].Buffer;
+            sqe->len       = min( page_size, length - page * page_size );
+            sqe->off       = offset + (ULONGLONG)page * page_size;
+            sqe->user_data = i;
+            segment_uring_sq_array[tail & sq_mask] = tail & sq_mask;
+            tail++;
+        }
+        __atomic_store_n( sq_tail, tail, __ATOMIC_RELEASE );
+
+        pending = chunk;
+        received = 0;
+        while (received < chunk)
+        {
+            int res = syscall( __NR_io_uring_enter, segment_uring_fd, pending,
+                               chunk - received, IORING_ENTER_GETEVENTS, NULL, 0 );
+            if (res == -1 && errno != EINTR)
+            {
+                /* requests may still be in flight, poison the ring rather
+                 * than risk reaping stale completions on a later call */
+                close( segment_uring_fd );
+                segment_uring_fd = -2;
+                ret = FALSE;
+                break;
+            }
+            if (res >= 0) pending -= res;
+            while (__atomic_load_n( cq_tail, __ATOMIC_ACQUIRE ) != *cq_head)
+            {
+                const struct io_uring_cqe *cqe = cqes + (*cq_head & cq_mask);
+                if (cqe->user_data < chunk) results[cqe->user_data] = cqe->res;
+                __atomic_store_n( cq_head, *cq_head + 1, __ATOMIC_RELEASE );
+                received++;
+            }
+        }
+        if (!ret) break;
+
+        for (i = 0; i < chunk; i++)
+        {
+            unsigned int len = min( page_size, length - (done + i) * page_size );
+
+            if (results[i] < 0)  /* replay through the fallback loop to get exact status handling */
+            {
+                ret = FALSE;
+                break;
+            }
+            total += results[i];
+            if ((unsigned int)results[i] < len)
+            {
+                /* a read may legitimately come up short at end of file, when
+                 * every later page of the batch also came back empty; any
+                 * other short transfer (signal interruption, full disk) is
+                 * replayed through the per-page loop which handles partials.
+                 */
+                unsigned int j;
+                for (j = i + 1; j < chunk && !results[j]; j++);
+                if (write || j < chunk || done + chunk < page_count) ret = FALSE;
+                done = page_count;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock( &segment_uring_mutex );
+
+    if (ret) *ret_total = total;
+    return ret;
+}
+
+#endif  /* USE_SEGMENT_IO_URING */
+
+
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+
+#define SEGMENT_IOV_ENTRIES 64
+
+/* perform scatter/gather I/O at an explicit offset with one vectored syscall
+ * per SEGMENT_IOV_ENTRIES pages; used when io_uring is not available. Returns
+ * FALSE when a request did not complete cleanly; the caller then falls back
+ * to the per-page loop, which is safe to replay since positioned I/O on a
+ * regular file is idempotent.
+ */
+static BOOL segment_vector_io( int unix_fd, BOOL write, FILE_SEGMENT_ELEMENT *segments,
+                               ULONG length, LONGLONG offset, UINT *ret_total )
+{
+    unsigned int page_count = (length + page_size - 1) / page_size;
+    unsigned int i, done, chunk;
+    UINT total = 0;
+
+    for (done = 0; done < page_count; done += chunk)
+    {
+        struct iovec iov[SEGMENT_IOV_ENTRIES];
+        ULONG chunk_len = 0;
+        ssize_t result;
+
+        chunk = min( page_count - done, SEGMENT_IOV_ENTRIES );
+        for (i = 0; i < chunk; i++)
+        {
+            iov[i].iov_base = segments[done + i].Buffer;
+            iov[i].iov_len  = min( page_size, length - (done + i) * page_size );
+            chunk_len += iov[i].iov_len;
+        }
+        do
+        {
+            if (write) result = pwritev( unix_fd, iov, chunk, offset + total );
+            else result = preadv( unix_fd, iov, chunk, offset + total );
+        } while (result == -1 && errno == EINTR);
+
+        if (result == -1) return FALSE;  /* replay through the fallback loop to get exact status handling */
+        total += result;
+        if ((ULONG)result < chunk_len)
+        {
+            /* a read legitimately comes up short at end of file; any short
+             * write (full disk) is replayed through the per-page loop which
+             * handles partials.
+             */
+            if (write) return FALSE;
+            break;
+        }
+    }
+    *ret_total = total;
+    return TRUE;
+}
+
+#endif  /* HAVE_PREADV && HAVE_PWRITEV */
+
+
 static unsigned int set_pending_write( HANDLE device )
 {
     unsigned int status;
@@ -5777,6 +6225,17 @@ NTSTATUS WINAPI NtReadFileScatter( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
         goto error;
     }
 
+#ifdef USE_SEGMENT_IO_URING
+    if (length && offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION &&
+        segment_uring_io( unix_handle, FALSE, segments, length, offset->QuadPart, &total ))
+        length = 0;  /* all pages submitted in one batch, skip the per-page loop */
+#endif
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+    if (length && offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION &&
+        segment_vector_io( unix_handle, FALSE, segments, length, offset->QuadPart, &total ))
+        length = 0;  /* transferred with vectored syscalls, skip the per-page loop */
+#endif
+
     while (length)
     {
         if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
@@ -6077,6 +6536,17 @@ NTSTATUS WINAPI NtWriteFileGather( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
         goto done;
     }
 
+#ifdef USE_SEGMENT_IO_URING
+    if (length && offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION &&
+        segment_uring_io( unix_handle, TRUE, segments, length, offset->QuadPart, &total ))
+        length = 0;  /* all pages submitted in one batch, skip the per-page loop */
+#endif
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+    if (length && offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION &&
+        segment_vector_io( unix_handle, TRUE, segments, length, offset->QuadPart, &total ))
+        length = 0;  /* transferred with vectored syscalls, skip the per-page loop */
+#endif
+
     while (length)
     {
         if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
@@ -6311,9 +6781,173 @@ NTSTATUS WINAPI NtFsControlFile( HANDLE handle, HANDLE event, PIO_APC_ROUTINE ap
     }
 
     case FSCTL_SET_SPARSE:
-        TRACE("FSCTL_SET_SPARSE: Ignoring request\n");
+        /* unix files are sparse by default, nothing to do */
         status = STATUS_SUCCESS;
         break;
+
+    case FSCTL_SET_ZERO_DATA:
+    {
+        const FILE_ZERO_DATA_INFORMATION *info = in_buffer;
+        LONGLONG zero_start, zero_end;
+        int fd, needs_close;
+        struct stat st;
+
+        if (!in_buffer || in_size < sizeof(*info))
+        {
+            status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+        zero_start = info->FileOffset.QuadPart;
+        zero_end   = info->BeyondFinalZero.QuadPart;
+        if (zero_start < 0 || zero_end < zero_start)
+        {
+            status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+        if ((status = server_get_unix_fd( handle, FILE_WRITE_DATA, &fd, &needs_close, NULL, NULL )))
+            break;
+
+        /* the part of the range beyond the end of file stays unallocated */
+        fstat( fd, &st );
+        zero_end = min( zero_end, st.st_size );
+
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+        if (zero_start < zero_end &&
+            !fallocate( fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                        zero_start, zero_end - zero_start ))
+            zero_start = zero_end;
+#endif
+        while (zero_start < zero_end)  /* cannot punch holes, write literal zeros */
+        {
+            static const char zeros[4096];
+            ssize_t result = pwrite( fd, zeros, min( zero_end - zero_start, (LONGLONG)sizeof(zeros) ),
+                                     zero_start );
+            if (result == -1)
+            {
+                if (errno == EINTR) continue;
+                status = errno_to_status( errno );
+                break;
+            }
+            zero_start += result;
+        }
+        if (needs_close) close( fd );
+        break;
+    }
+
+    case FSCTL_QUERY_ALLOCATED_RANGES:
+    {
+        const FILE_ALLOCATED_RANGE_BUFFER *range = in_buffer;
+        FILE_ALLOCATED_RANGE_BUFFER *out = out_buffer;
+        ULONG count = out_size / sizeof(*out), pos = 0;
+        LONGLONG offset, end;
+        int fd, needs_close;
+        struct stat st;
+
+        if (!in_buffer || in_size < sizeof(*range) ||
+            range->FileOffset.QuadPart < 0 || range->Length.QuadPart < 0)
+        {
+            status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+        if ((status = server_get_unix_fd( handle, FILE_READ_DATA, &fd, &needs_close, NULL, NULL )))
+            break;
+
+        fstat( fd, &st );
+        offset = range->FileOffset.QuadPart;
+        end = min( range->FileOffset.QuadPart + range->Length.QuadPart, st.st_size );
+
+        while (offset < end)
+        {
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+            off_t save_pos = lseek( fd, 0, SEEK_CUR );
+            off_t data = lseek( fd, offset, SEEK_DATA );
+            off_t hole = (data != -1) ? lseek( fd, data, SEEK_HOLE ) : -1;
+
+            lseek( fd, save_pos, SEEK_SET );
+            if (data == -1 && errno == ENXIO) break;  /* only a hole remains */
+            if (data != -1 && hole != -1)
+            {
+                if (data >= end) break;
+                if (pos == count)
+                {
+                    status = STATUS_BUFFER_OVERFLOW;
+                    break;
+                }
+                out[pos].FileOffset.QuadPart = data;
+                out[pos].Length.QuadPart = min( (LONGLONG)hole, end ) - data;
+                pos++;
+                offset = hole;
+                continue;
+            }
+#endif
+            /* the filesystem cannot enumerate holes, report the whole range as allocated */
+            if (pos == count)
+            {
+                status = STATUS_BUFFER_OVERFLOW;
+                break;
+            }
+            out[pos].FileOffset.QuadPart = offset;
+            out[pos].Length.QuadPart = end - offset;
+            pos++;
+            break;
+        }
+        if (needs_close) close( fd );
+        size = pos * sizeof(*out);
+        break;
+    }
+
+    case FSCTL_DUPLICATE_EXTENTS_TO_FILE:
+    {
+#if defined(__linux__) && defined(__NR_copy_file_range)
+        const DUPLICATE_EXTENTS_DATA *data = in_buffer;
+        int src_fd, dst_fd, src_needs_close, dst_needs_close;
+        HANDLE src_handle;
+        off_t src_off, dst_off;
+        LONGLONG count;
+
+        if (!in_buffer || in_size < sizeof(*data))
+        {
+            status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+        src_handle = data->FileHandle;
+        if (in_wow64_call()) src_handle = LongToHandle( *(const LONG *)&data->FileHandle );
+
+        if ((status = server_get_unix_fd( handle, FILE_WRITE_DATA, &dst_fd, &dst_needs_close, NULL, NULL )))
+            break;
+        if ((status = server_get_unix_fd( src_handle, FILE_READ_DATA, &src_fd, &src_needs_close, NULL, NULL )))
+        {
+            if (dst_needs_close) close( dst_fd );
+            break;
+        }
+
+        src_off = data->SourceFileOffset.QuadPart;
+        dst_off = data->TargetFileOffset.QuadPart;
+        count = data->ByteCount.QuadPart;
+        while (count > 0)
+        {
+            /* on filesystems that support it (btrfs, XFS) this clones
+             * extents instead of copying the data */
+            ssize_t ret = syscall( __NR_copy_file_range, src_fd, &src_off, dst_fd, &dst_off,
+                                   (size_t)count, 0 );
+            if (ret < 0)
+            {
+                if (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)
+                    status = STATUS_NOT_SUPPORTED;
+                else
+                    status = errno_to_status( errno );
+                break;
+            }
+            if (!ret) break;  /* source is shorter than requested */
+            count -= ret;
+        }
+        if (src_needs_close) close( src_fd );
+        if (dst_needs_close) close( dst_fd );
+#else
+        status = STATUS_NOT_SUPPORTED;
+#endif
+        break;
+    }
     default:
         return server_ioctl_file( handle, event, apc, apc_context, io, code,
                                   in_buffer, in_size, out_buffer, out_size );
@@ -436,6 +436,13 @@ static NTSTATUS spawn_process( const RTL_USER_PROCESS_PARAMETERS *params, int so
         isatty(1) && is_unix_console_handle( params->hStdOutput ))
         stdout_fd = 1;
 
+    /* build the argv before forking, the child of a threaded process cannot safely use the heap */
+    if (!(argv = build_argv( &params->CommandLine, 2 )))
+    {
+        status = STATUS_NO_MEMORY;
+        goto done;
+    }
+
     if (!(pid = fork()))  /* child */
     {
         if (!(pid = fork()))  /* grandchild */
@@ -459,8 +466,6 @@ static NTSTATUS spawn_process( const RTL_USER_PROCESS_PARAMETERS *params, int so
                 fchdir( unixdir );
                 close( unixdir );
             }
-            argv = build_argv( &params->CommandLine, 2 );
-
             exec_wineloader( argv, socketfd, pe_info );
             _exit(1);
         }
@@ -478,6 +483,8 @@ static NTSTATUS spawn_process( const RTL_USER_PROCESS_PARAMETERS *params, int so
     }
     else status = STATUS_NO_MEMORY;
 
+    free( argv );
+done:
     if (stdin_fd != -1 && stdin_fd != 0) close( stdin_fd );
     if (stdout_fd != -1 && stdout_fd != 1) close( stdout_fd );
     return status;
@@ -592,6 +599,16 @@ static NTSTATUS fork_and_exec( OBJECT_ATTRIBUTES *attr, int unixdir,
     status = nt_to_unix_file_name( attr, &unix_name, FILE_OPEN );
     if (status) return status;
 
+    /* build the argv and envp before forking, the child of a threaded process
+     * cannot safely use the heap */
+    argv = build_argv( &params->CommandLine, 0 );
+    envp = build_envp( params->Environment );
+    if (!argv || !envp)
+    {
+        status = STATUS_NO_MEMORY;
+        goto done;
+    }
+
 #ifdef HAVE_PIPE2
     if (pipe2( fd, O_CLOEXEC ) == -1)
 #endif
@@ -635,8 +652,6 @@ static NTSTATUS fork_and_exec( OBJECT_ATTRIBUTES *attr, int unixdir,
             /* Reset signals that we previously set to SIG_IGN */
             signal( SIGPIPE, SIG_DFL );
 
-            argv = build_argv( &params->CommandLine, 0 );
-            envp = build_envp( params->Environment );
             if (unixdir != -1)
             {
                 fchdir( unixdir );
@@ -680,6 +695,8 @@ static NTSTATUS fork_and_exec( OBJECT_ATTRIBUTES *attr, int unixdir,
     if (stdin_fd != -1 && stdin_fd != 0) close( stdin_fd );
     if (stdout_fd != -1 && stdout_fd != 1) close( stdout_fd );
 done:
+    free( argv );
+    free( envp );
     free( unix_name );
     return status;
 }
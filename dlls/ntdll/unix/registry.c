@@ -484,6 +484,96 @@ NTSTATUS WINAPI NtEnumerateValueKey( HANDLE handle, ULONG index, KEY_VALUE_INFOR
 }
 
 
+/***********************************************************************
+ * Cache for NtQueryValueKey results.
+ *
+ * The server bumps a global generation counter in the shared session
+ * header on every registry modification; cached entries are only used
+ * while the generation they were filled at is still current.
+ */
+
+#define REG_CACHE_SIZE      64   /* must be a power of two */
+#define REG_CACHE_NAME_LEN  62   /* max cached value name length in WCHARs */
+#define REG_CACHE_DATA_LEN  512  /* max cached value data size in bytes */
+
+struct reg_value_cache_entry
+{
+    HANDLE        handle;                        /* key handle, 0 if unused */
+    unsigned int  gen;                           /* generation the entry was filled at */
+    unsigned int  status;                        /* status of the original call */
+    unsigned int  type;                          /* value type */
+    data_size_t   total;                         /* value data size */
+    data_size_t   name_len;                      /* value name length in bytes */
+    WCHAR         name[REG_CACHE_NAME_LEN + 1];  /* value name */
+    unsigned char data[REG_CACHE_DATA_LEN];      /* value data */
+};
+
+static struct reg_value_cache_entry reg_value_cache[REG_CACHE_SIZE];
+static pthread_mutex_t reg_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct reg_value_cache_entry *reg_value_cache_entry( HANDLE handle, const UNICODE_STRING *name )
+{
+    UINT_PTR hash = ((UINT_PTR)handle >> 2) ^ name->Length;
+    if (name->Length) hash ^= name->Buffer[0];
+    return &reg_value_cache[hash & (REG_CACHE_SIZE - 1)];
+}
+
+/* drop the cached values for a handle that is being closed */
+void reg_value_cache_close( HANDLE handle )
+{
+    unsigned int i;
+
+    pthread_mutex_lock( &reg_cache_mutex );
+    for (i = 0; i < REG_CACHE_SIZE; i++)
+        if (reg_value_cache[i].handle == handle) reg_value_cache[i].handle = 0;
+    pthread_mutex_unlock( &reg_cache_mutex );
+}
+
+/* look up a cached value, copying at most buffer_len data bytes into buffer */
+static BOOL find_cached_value( HANDLE handle, const UNICODE_STRING *name, unsigned int *status,
+                               unsigned int *type, data_size_t *total,
+                               void *buffer, data_size_t buffer_len )
+{
+    const volatile session_shm_t *session = get_shared_session_header();
+    struct reg_value_cache_entry *entry;
+    BOOL found = FALSE;
+
+    if (!session) return FALSE;
+
+    pthread_mutex_lock( &reg_cache_mutex );
+    entry = reg_value_cache_entry( handle, name );
+    if (entry->handle == handle && entry->gen == session->regs_generation &&
+        entry->name_len == name->Length && !memcmp( entry->name, name->Buffer, name->Length ))
+    {
+        *status = entry->status;
+        *type   = entry->type;
+        *total  = entry->total;
+        if (buffer) memcpy( buffer, entry->data, min( entry->total, buffer_len ) );
+        found = TRUE;
+    }
+    pthread_mutex_unlock( &reg_cache_mutex );
+    return found;
+}
+
+static void add_cached_value( HANDLE handle, const UNICODE_STRING *name, unsigned int gen,
+                              unsigned int status, unsigned int type, data_size_t total,
+                              const void *data )
+{
+    struct reg_value_cache_entry *entry;
+
+    pthread_mutex_lock( &reg_cache_mutex );
+    entry = reg_value_cache_entry( handle, name );
+    entry->handle   = handle;
+    entry->gen      = gen;
+    entry->status   = status;
+    entry->type     = type;
+    entry->total    = total;
+    entry->name_len = name->Length;
+    memcpy( entry->name, name->Buffer, name->Length );
+    if (total) memcpy( entry->data, data, total );
+    pthread_mutex_unlock( &reg_cache_mutex );
+}
+
 /******************************************************************************
  *              NtQueryValueKey  (NTDLL.@)
  */
@@ -491,7 +581,8 @@ NTSTATUS WINAPI NtQueryValueKey( HANDLE handle, const UNICODE_STRING *name,
                                  KEY_VALUE_INFORMATION_CLASS info_class,
                                  void *info, DWORD length, DWORD *result_len )
 {
-    unsigned int ret;
+    const volatile session_shm_t *session;
+    unsigned int ret, gen = 0, type, total;
     UCHAR *data_ptr;
     unsigned int fixed_size, min_size;
 
@@ -539,6 +630,22 @@ NTSTATUS WINAPI NtQueryValueKey( HANDLE handle, const UNICODE_STRING *name,
         return STATUS_INVALID_PARAMETER;
     }
 
+    if (name->Length <= REG_CACHE_NAME_LEN * sizeof(WCHAR) &&
+        find_cached_value( handle, name, &ret, &type, &total, data_ptr,
+                           (length > fixed_size && data_ptr) ? length - fixed_size : 0 ))
+    {
+        if (!ret)
+        {
+            copy_key_value_info( info_class, info, length, type, name->Length, total );
+            *result_len = fixed_size + (info_class == KeyValueBasicInformation ? 0 : total);
+            if (length < min_size) ret = STATUS_BUFFER_TOO_SMALL;
+            else if (length < *result_len) ret = STATUS_BUFFER_OVERFLOW;
+        }
+        return ret;
+    }
+
+    if ((session = get_shared_session_header())) gen = session->regs_generation;
+
     SERVER_START_REQ( get_key_value )
     {
         req->hkey = wine_server_obj_handle( handle );
@@ -549,9 +656,19 @@ NTSTATUS WINAPI NtQueryValueKey( HANDLE handle, const UNICODE_STRING *name,
             copy_key_value_info( info_class, info, length, reply->type,
                                  name->Length, reply->total );
             *result_len = fixed_size + (info_class == KeyValueBasicInformation ? 0 : reply->total);
+
+            /* cache the value if it was returned whole */
+            if (session && name->Length <= REG_CACHE_NAME_LEN * sizeof(WCHAR) &&
+                reply->total <= REG_CACHE_DATA_LEN && wine_server_reply_size(reply) == reply->total)
+                add_cached_value( handle, name, gen, STATUS_SUCCESS, reply->type,
+                                  reply->total, data_ptr );
+
             if (length < min_size) ret = STATUS_BUFFER_TOO_SMALL;
             else if (length < *result_len) ret = STATUS_BUFFER_OVERFLOW;
         }
+        else if (ret == STATUS_OBJECT_NAME_NOT_FOUND && session &&
+                 name->Length <= REG_CACHE_NAME_LEN * sizeof(WCHAR))
+            add_cached_value( handle, name, gen, ret, 0, 0, NULL );
     }
     SERVER_END_REQ;
     return ret;
@@ -631,7 +748,7 @@ NTSTATUS WINAPI NtNotifyChangeMultipleKeys( HANDLE key, ULONG count, OBJECT_ATTR
            key, count, attr, event, apc, apc_context, io,
            filter, async, buffer, length, subtree );
 
-    if (count || attr || apc || apc_context || buffer || length)
+    if (count || attr || apc || apc_context)
         FIXME( "Unimplemented optional parameter\n" );
 
     if (!async)
@@ -648,7 +765,13 @@ NTSTATUS WINAPI NtNotifyChangeMultipleKeys( HANDLE key, ULONG count, OBJECT_ATTR
         req->event   = wine_server_obj_handle( event );
         req->subtree = subtree;
         req->filter  = filter;
+        /* the buffer is reserved on Windows; fill it with the accumulated
+         * registry_event records as a Wine-specific extension, and only ask
+         * the server to journal changes when the caller provides one */
+        req->journal = buffer != NULL;
+        if (buffer) wine_server_set_reply( req, buffer, length );
         ret = wine_server_call( req );
+        if (buffer && io) io->Information = wine_server_reply_size( reply );
     }
     SERVER_END_REQ;
 
@@ -295,6 +295,34 @@ unsigned int server_call_unlocked( void *req_ptr )
 }
 
 
+/***********************************************************************
+ *           server_call_batch
+ *
+ * Execute several independent requests in a single round trip. Only
+ * requests without variable-sized data whose reply is immediate may be
+ * batched; the error field of each reply holds the status of the
+ * corresponding request.
+ */
+unsigned int server_call_batch( const union generic_request *requests,
+                                union generic_reply *replies, unsigned int count )
+{
+    struct __server_request_info call;
+    sigset_t old_set;
+    unsigned int ret;
+
+    memset( &call.u.req, 0, sizeof(call.u.req) );
+    call.u.req.request_header.req = REQ_pipeline_batch;
+    call.data_count = 0;
+    call.reply_data = replies;
+    wine_server_add_data( &call, requests, count * sizeof(*requests) );
+
+    pthread_sigmask( SIG_BLOCK, &server_block_set, &old_set );
+    ret = server_call_unlocked( &call );
+    pthread_sigmask( SIG_SETMASK, &old_set, NULL );
+    return ret;
+}
+
+
 /***********************************************************************
  *           wine_server_call
  *
@@ -799,13 +827,7 @@ unsigned int server_wait( const union select_op *select_op, data_size_t size, UI
     unsigned int ret;
     struct user_apc apc;
 
-    if (abs_timeout < 0)
-    {
-        LARGE_INTEGER now;
-
-        NtQueryPerformanceCounter( &now, NULL );
-        abs_timeout -= now.QuadPart;
-    }
+    if (abs_timeout < 0) abs_timeout -= monotonic_counter();
 
     ret = server_select( select_op, size, flags, abs_timeout, NULL, &apc );
     if (ret == STATUS_USER_APC) return invoke_user_apc( NULL, &apc, ret );
@@ -1185,6 +1207,23 @@ done:
 }
 
 
+/***********************************************************************
+ *           server_get_cached_unix_fd
+ *
+ * Like server_get_unix_fd(), but fails instead of making a server call
+ * if the fd is not already cached. The fd remains owned by the cache.
+ */
+int server_get_cached_unix_fd( HANDLE handle, int *unix_fd, enum server_fd_type *type,
+                               unsigned int *options )
+{
+    int ret, fd = -1;
+
+    *unix_fd = -1;
+    if (!(ret = get_cached_fd( handle, &fd, type, NULL, options ))) *unix_fd = fd;
+    return ret;
+}
+
+
 /***********************************************************************
  *           wine_server_fd_to_handle
  */
@@ -1896,6 +1935,9 @@ NTSTATUS WINAPI NtClose( HANDLE handle )
     if (HandleToLong( handle ) >= ~5 && HandleToLong( handle ) <= ~0)
         return STATUS_SUCCESS;
 
+    shared_event_cache_close( handle );
+    reg_value_cache_close( handle );
+
     server_enter_uninterrupted_section( &fd_cache_mutex, &sigset );
 
     /* always remove the cached fd; if the server request fails we'll just
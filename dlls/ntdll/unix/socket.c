@@ -25,6 +25,7 @@
 #include "config.h"
 #include <assert.h>
 #include <errno.h>
+#include <poll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/ioctl.h>
@@ -1256,6 +1257,96 @@ static NTSTATUS sock_ioctl_send( HANDLE handle, HANDLE event, PIO_APC_ROUTINE ap
 }
 
 
+/* Send a batch of datagrams on a connected socket, using a single sendmmsg()
+ * call per batch where available. Unlike sock_ioctl_send() this is fully
+ * synchronous; partial progress is reported as success. */
+static NTSTATUS sock_send_batch( int fd, const struct afd_batch_buffer *buffers,
+                                 unsigned int count, int unix_flags, ULONG_PTR *total )
+{
+    unsigned int i, msg_count = 0, sent_msgs = 0;
+    NTSTATUS status = STATUS_SUCCESS;
+    struct msghdr *hdrs;
+    struct iovec *iov;
+
+    *total = 0;
+
+    if (!(iov = malloc( count * sizeof(*iov) )))
+        return STATUS_NO_MEMORY;
+
+    for (i = 0; i < count; ++i)
+    {
+        iov[i].iov_base = u64_to_user_ptr( buffers[i].ptr );
+        iov[i].iov_len = buffers[i].len;
+        if (buffers[i].end_of_packet || i == count - 1)
+            ++msg_count;
+    }
+
+    if (!(hdrs = calloc( msg_count, sizeof(*hdrs) )))
+    {
+        free( iov );
+        return STATUS_NO_MEMORY;
+    }
+
+    for (i = 0, msg_count = 0; i < count; ++i)
+    {
+        if (!hdrs[msg_count].msg_iov)
+            hdrs[msg_count].msg_iov = &iov[i];
+        ++hdrs[msg_count].msg_iovlen;
+        if (buffers[i].end_of_packet || i == count - 1)
+            ++msg_count;
+    }
+
+#ifdef __linux__
+    while (sent_msgs < msg_count)
+    {
+        struct mmsghdr msgvec[64];
+        unsigned int batch = min( msg_count - sent_msgs, ARRAY_SIZE(msgvec) );
+        int ret;
+
+        for (i = 0; i < batch; ++i)
+        {
+            msgvec[i].msg_hdr = hdrs[sent_msgs + i];
+            msgvec[i].msg_len = 0;
+        }
+
+        while ((ret = sendmmsg( fd, msgvec, batch, unix_flags )) == -1 && errno == EINTR)
+            ;
+        if (ret <= 0)
+        {
+            if (errno != EWOULDBLOCK) WARN( "sendmmsg: %s\n", strerror( errno ) );
+            status = sock_errno_to_status( errno );
+            break;
+        }
+        for (i = 0; i < ret; ++i)
+            *total += msgvec[i].msg_len;
+        sent_msgs += ret;
+    }
+#else
+    for (; sent_msgs < msg_count; ++sent_msgs)
+    {
+        ssize_t ret;
+
+        while ((ret = sendmsg( fd, &hdrs[sent_msgs], unix_flags )) == -1 && errno == EINTR)
+            ;
+        if (ret < 0)
+        {
+            if (errno != EWOULDBLOCK) WARN( "sendmsg: %s\n", strerror( errno ) );
+            status = sock_errno_to_status( errno );
+            break;
+        }
+        *total += ret;
+    }
+#endif
+
+    if (status && sent_msgs)
+        status = STATUS_SUCCESS;
+
+    free( hdrs );
+    free( iov );
+    return status;
+}
+
+
 NTSTATUS sock_write( HANDLE handle, int fd, HANDLE event, PIO_APC_ROUTINE apc,
                      void *apc_user, IO_STATUS_BLOCK *io, const void *buffer, ULONG length )
 {
@@ -1528,6 +1619,169 @@ static int get_sock_type( HANDLE handle )
 }
 
 
+#define SOCK_FAST_POLL_MAX 64
+
+/* Try to satisfy a zero-timeout IOCTL_AFD_POLL entirely in process, so that
+ * applications which busy-poll ready sockets with select() or WSAPoll() don't
+ * force a server round trip per call. Returns FALSE if the poll has to go to
+ * the server after all: when it would have to wait, when a socket's fd is not
+ * in the local fd cache, or when a condition is signalled whose bookkeeping
+ * lives in the server (hangup, reset, connection errors, out-of-band data). */
+static BOOL sock_poll_in_process( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user,
+                                  IO_STATUS_BLOCK *io, const void *in_buffer, UINT in_size,
+                                  void *out_buffer, UINT out_size, NTSTATUS *ret_status )
+{
+    const struct afd_poll_params_64 *params64 = in_buffer;
+    const struct afd_poll_params_32 *params32 = in_buffer;
+    unsigned int i, j, count, signaled = 0, output_size, options;
+    struct pollfd fds[SOCK_FAST_POLL_MAX];
+    ULONGLONG handles[SOCK_FAST_POLL_MAX];
+    int masks[SOCK_FAST_POLL_MAX];
+    int out_flags[SOCK_FAST_POLL_MAX];
+    enum server_fd_type type;
+    BOOLEAN exclusive;
+    LONGLONG timeout;
+    int fd;
+
+    if (in_wow64_call())
+    {
+        if (in_size < offsetof( struct afd_poll_params_32, sockets[0] )) return FALSE;
+        count = params32->count;
+        timeout = params32->timeout;
+        exclusive = params32->exclusive;
+        if (!count || count > SOCK_FAST_POLL_MAX
+                || in_size < offsetof( struct afd_poll_params_32, sockets[count] ))
+            return FALSE;
+    }
+    else
+    {
+        if (in_size < offsetof( struct afd_poll_params_64, sockets[0] )) return FALSE;
+        count = params64->count;
+        timeout = params64->timeout;
+        exclusive = params64->exclusive;
+        if (!count || count > SOCK_FAST_POLL_MAX
+                || in_size < offsetof( struct afd_poll_params_64, sockets[count] ))
+            return FALSE;
+    }
+
+    /* Only an immediate poll can complete without server-side waiting, and
+     * exclusive polls have to cancel other polls on the same sockets. */
+    if (timeout || exclusive) return FALSE;
+
+    if (server_get_cached_unix_fd( handle, &fd, NULL, &options )) return FALSE;
+
+    for (i = 0; i < count; ++i)
+    {
+        int mask;
+
+        if (in_wow64_call())
+        {
+            handles[i] = params32->sockets[i].socket;
+            mask = params32->sockets[i].flags;
+        }
+        else
+        {
+            handles[i] = params64->sockets[i].socket;
+            mask = params64->sockets[i].flags;
+        }
+
+        /* AFD_POLL_CONNECT depends on connection state only the server tracks. */
+        if (mask & AFD_POLL_CONNECT) return FALSE;
+
+        if (server_get_cached_unix_fd( (HANDLE)(ULONG_PTR)handles[i], &fds[i].fd, &type, NULL ))
+            return FALSE;
+        if (type != FD_TYPE_SOCKET) return FALSE;
+
+        fds[i].events = 0;
+        fds[i].revents = 0;
+        if (mask & (AFD_POLL_READ | AFD_POLL_ACCEPT)) fds[i].events |= POLLIN;
+        if (mask & AFD_POLL_WRITE) fds[i].events |= POLLOUT;
+        if (mask & AFD_POLL_OOB) fds[i].events |= POLLPRI;
+#ifdef POLLRDHUP
+        fds[i].events |= POLLRDHUP;
+#endif
+        masks[i] = mask;
+    }
+
+    if (poll( fds, count, 0 ) < 0) return FALSE;
+
+    for (i = 0; i < count; ++i)
+    {
+        int flags = 0, revents = fds[i].revents;
+
+#ifdef POLLRDHUP
+        if (revents & POLLRDHUP) return FALSE;
+#endif
+        if (revents & (POLLERR | POLLHUP | POLLNVAL | POLLPRI)) return FALSE;
+
+        if (revents & POLLIN)
+        {
+            int value;
+            socklen_t len = sizeof(value);
+
+            if (!getsockopt( fds[i].fd, SOL_SOCKET, SO_ACCEPTCONN, &value, &len ) && value)
+                flags |= AFD_POLL_ACCEPT;
+            else
+            {
+                len = sizeof(value);
+                if (getsockopt( fds[i].fd, SOL_SOCKET, SO_TYPE, &value, &len )) return FALSE;
+                if (value == SOCK_STREAM)
+                {
+                    char dummy;
+                    int ret = recv( fds[i].fd, &dummy, 1, MSG_PEEK );
+
+                    /* EOF or a pending error; the server tracks hangup and
+                     * reset state, so let it see this. */
+                    if (!ret || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) return FALSE;
+                    if (ret > 0) flags |= AFD_POLL_READ;
+                }
+                else flags |= AFD_POLL_READ;
+            }
+        }
+        if (revents & POLLOUT)
+            flags |= AFD_POLL_WRITE;
+
+        if ((out_flags[i] = flags & masks[i])) ++signaled;
+    }
+
+    output_size = in_wow64_call() ? offsetof( struct afd_poll_params_32, sockets[signaled] )
+                                  : offsetof( struct afd_poll_params_64, sockets[signaled] );
+    if (out_size < output_size) return FALSE;
+
+    memset( out_buffer, 0, output_size );
+    if (in_wow64_call())
+    {
+        struct afd_poll_params_32 *output = out_buffer;
+
+        for (i = 0, j = 0; i < count; ++i)
+        {
+            if (!out_flags[i]) continue;
+            output->sockets[j].socket = handles[i];
+            output->sockets[j].flags = out_flags[i];
+            ++j;
+        }
+        output->count = signaled;
+    }
+    else
+    {
+        struct afd_poll_params_64 *output = out_buffer;
+
+        for (i = 0, j = 0; i < count; ++i)
+        {
+            if (!out_flags[i]) continue;
+            output->sockets[j].socket = handles[i];
+            output->sockets[j].flags = out_flags[i];
+            ++j;
+        }
+        output->count = signaled;
+    }
+
+    file_complete_async( handle, options, event, apc, apc_user, io, STATUS_SUCCESS, output_size );
+    *ret_status = STATUS_SUCCESS;
+    return TRUE;
+}
+
+
 NTSTATUS sock_ioctl( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user, IO_STATUS_BLOCK *io,
                      UINT code, void *in_buffer, UINT in_size, void *out_buffer, UINT out_size )
 {
@@ -1617,6 +1871,9 @@ NTSTATUS sock_ioctl( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc
         }
 
         case IOCTL_AFD_POLL:
+            if (sock_poll_in_process( handle, event, apc, apc_user, io, in_buffer, in_size,
+                                      out_buffer, out_size, &status ))
+                return status;
             status = STATUS_BAD_DEVICE_TYPE;
             break;
 
@@ -1736,6 +1993,34 @@ NTSTATUS sock_ioctl( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc
             return status;
         }
 
+        case IOCTL_AFD_WINE_SEND_BATCH:
+        {
+            const struct afd_send_batch_params *params = in_buffer;
+            int unix_flags = 0;
+            ULONG_PTR total;
+
+            if (in_size < sizeof(*params))
+            {
+                status = STATUS_BUFFER_TOO_SMALL;
+                break;
+            }
+
+            if ((status = server_get_unix_fd( handle, 0, &fd, &needs_close, NULL, &options )))
+                return status;
+
+            if (params->ws_flags & WS_MSG_OOB)
+                unix_flags |= MSG_OOB;
+            if (params->ws_flags & ~WS_MSG_OOB)
+                FIXME( "unknown flags %#x\n", params->ws_flags );
+
+            status = sock_send_batch( fd, u64_to_user_ptr( params->buffers_ptr ),
+                                      params->count, unix_flags, &total );
+            if (needs_close) close( fd );
+            if (status) return status;
+            file_complete_async( handle, options, event, apc, apc_user, io, STATUS_SUCCESS, total );
+            return STATUS_SUCCESS;
+        }
+
         case IOCTL_AFD_WINE_TRANSMIT:
         {
             const struct afd_transmit_params *params = in_buffer;
@@ -78,7 +78,7 @@ static const char *debugstr_timeout( const LARGE_INTEGER *timeout )
 }
 
 /* return a monotonic time counter, in Win32 ticks */
-static inline ULONGLONG monotonic_counter(void)
+ULONGLONG monotonic_counter(void)
 {
     struct timeval now;
 #ifdef __APPLE__
@@ -1548,7 +1548,7 @@ NTSTATUS WINAPI NtQueryTimer( HANDLE handle, TIMER_INFORMATION_CLASS class,
         if (basic_info->RemainingTime.QuadPart > 0) NtQuerySystemTime( &now );
         else
         {
-            NtQueryPerformanceCounter( &now, NULL );
+            now.QuadPart = monotonic_counter();
             basic_info->RemainingTime.QuadPart = -basic_info->RemainingTime.QuadPart;
         }
 
@@ -1566,6 +1566,249 @@ NTSTATUS WINAPI NtQueryTimer( HANDLE handle, TIMER_INFORMATION_CLASS class,
 }
 
 
+/***********************************************************************
+ * In-process waits on manual-reset events.
+ *
+ * The server mirrors the state of manual-reset events into the session
+ * shared memory; since satisfying a wait on them has no side effect, the
+ * client can wait with a shared futex on the mirrored state without a
+ * server round trip. Enabled with WINE_SHARED_EVENT_WAIT=1.
+ */
+#ifdef __linux__
+
+static pthread_mutex_t shared_event_lock = PTHREAD_MUTEX_INITIALIZER;
+
+struct shared_event_block  /* mapped block of the session shared mapping */
+{
+    struct shared_event_block *next;
+    UINT64      offset;
+    SIZE_T      size;
+    const char *data;
+};
+static struct shared_event_block *shared_event_blocks;
+
+struct shared_event_entry
+{
+    HANDLE handle;                   /* handle this entry was created for */
+    object_id_t id;                  /* expected object id, 0 for negative entries */
+    const shared_object_t *object;
+};
+/* must be a power of two */
+#define SHARED_EVENT_CACHE_SIZE 64
+static struct shared_event_entry shared_event_cache[SHARED_EVENT_CACHE_SIZE];
+
+static struct shared_event_entry *shared_event_cache_entry( HANDLE handle )
+{
+    return &shared_event_cache[((UINT_PTR)handle >> 2) & (SHARED_EVENT_CACHE_SIZE - 1)];
+}
+
+/* drop the cached shared object for a handle that is being closed */
+void shared_event_cache_close( HANDLE handle )
+{
+    struct shared_event_entry *entry;
+
+    pthread_mutex_lock( &shared_event_lock );
+    entry = shared_event_cache_entry( handle );
+    if (entry->handle == handle) memset( entry, 0, sizeof(*entry) );
+    pthread_mutex_unlock( &shared_event_lock );
+}
+
+static int futex_wait_shared( const volatile unsigned int *addr, unsigned int val,
+                              struct timespec *timeout )
+{
+    /* has to be a non-private futex, the server wakes us from another process */
+    return syscall( __NR_futex, (const void *)addr, FUTEX_WAIT, val, timeout, 0, 0 );
+}
+
+static const char *map_shared_session_block( UINT64 offset, SIZE_T size )
+{
+    static const WCHAR nameW[] =
+    {
+        '\\','K','e','r','n','e','l','O','b','j','e','c','t','s','\\',
+        '_','_','w','i','n','e','_','s','e','s','s','i','o','n',0
+    };
+    UNICODE_STRING name = RTL_CONSTANT_STRING( nameW );
+    LARGE_INTEGER off = {.QuadPart = offset & ~(UINT64)0xffff};
+    struct shared_event_block *block;
+    OBJECT_ATTRIBUTES attr;
+    unsigned int status;
+    HANDLE handle;
+
+    for (block = shared_event_blocks; block; block = block->next)
+        if (block->offset <= offset && offset + size <= block->offset + block->size)
+            return block->data + (offset - block->offset);
+
+    if (!(block = calloc( 1, sizeof(*block) ))) return NULL;
+    block->size = offset + size - off.QuadPart;
+
+    InitializeObjectAttributes( &attr, &name, 0, NULL, NULL );
+    if (!(status = NtOpenSection( &handle, SECTION_MAP_READ, &attr )))
+    {
+        status = NtMapViewOfSection( handle, GetCurrentProcess(), (void **)&block->data, 0, 0,
+                                     &off, &block->size, ViewUnmap, 0, PAGE_READONLY );
+        NtClose( handle );
+    }
+    if (status)
+    {
+        free( block );
+        return NULL;
+    }
+    block->offset = off.QuadPart;
+    block->next = shared_event_blocks;
+    shared_event_blocks = block;
+    return block->data + (offset - block->offset);
+}
+
+/* return the shared session header, mapping it on first use */
+const volatile session_shm_t *get_shared_session_header(void)
+{
+    static const volatile session_shm_t *header;
+
+    if (!header)
+    {
+        pthread_mutex_lock( &shared_event_lock );
+        if (!header)
+            header = (const volatile session_shm_t *)map_shared_session_block( 0, sizeof(session_shm_t) );
+        pthread_mutex_unlock( &shared_event_lock );
+    }
+    return header;
+}
+
+/* read the mirrored event state, returning FALSE if the object is gone */
+static BOOL read_shared_event( const shared_object_t *object, object_id_t id,
+                               unsigned int *signal_seq, int *signaled )
+{
+    UINT64 seq;
+    object_id_t cur_id;
+
+    do
+    {
+        while ((seq = __atomic_load_n( &object->seq, __ATOMIC_ACQUIRE )) & 1) sched_yield();
+        cur_id = object->id;
+        *signal_seq = object->shm.event.signal_seq;
+        *signaled = object->shm.event.signaled;
+        __atomic_thread_fence( __ATOMIC_ACQUIRE );
+    } while (__atomic_load_n( &object->seq, __ATOMIC_ACQUIRE ) != seq);
+
+    return cur_id == id;
+}
+
+/* wait in-process on a manual-reset event mirrored in the session shared
+ * memory; returns STATUS_NOT_IMPLEMENTED when the server wait path is needed */
+static NTSTATUS wait_shared_event( HANDLE handle, const LARGE_INTEGER *timeout )
+{
+    static int enabled = -1;
+    struct shared_event_entry *entry;
+    const shared_object_t *object;
+    object_id_t id;
+    unsigned int signal_seq, start_seq;
+    int signaled, started = 0;
+
+    if (enabled == -1)
+    {
+        const char *env = getenv( "WINE_SHARED_EVENT_WAIT" );
+        enabled = env && atoi( env );
+    }
+    if (!enabled) return STATUS_NOT_IMPLEMENTED;
+
+    pthread_mutex_lock( &shared_event_lock );
+    entry = shared_event_cache_entry( handle );
+    if (entry->handle != handle)
+    {
+        struct obj_locator locator;
+
+        SERVER_START_REQ( get_event_locator )
+        {
+            req->handle = wine_server_obj_handle( handle );
+            if (wine_server_call( req )) memset( &locator, 0, sizeof(locator) );
+            else locator = reply->locator;
+        }
+        SERVER_END_REQ;
+
+        entry->handle = handle;
+        entry->id     = locator.id;
+        entry->object = NULL;
+        if (locator.id)
+            entry->object = (const shared_object_t *)map_shared_session_block( locator.offset,
+                                                                               sizeof(shared_object_t) );
+    }
+    object = entry->object;
+    id     = entry->id;
+    pthread_mutex_unlock( &shared_event_lock );
+
+    if (!object || !id) return STATUS_NOT_IMPLEMENTED;
+
+    for (;;)
+    {
+        struct timespec ts, *ts_ptr = NULL;
+
+        if (!read_shared_event( object, id, &signal_seq, &signaled ))
+        {
+            shared_event_cache_close( handle );  /* handle was reused for another object */
+            return STATUS_NOT_IMPLEMENTED;
+        }
+        if (signaled) return STATUS_WAIT_0;
+        /* set and pulse both bump signal_seq and release every waiter of a
+         * manual-reset event, so a sequence change across the wait is a
+         * release even if the event has already been reset (or was only
+         * pulsed) by the time the state is re-read */
+        if (!started)
+        {
+            start_seq = signal_seq;
+            started = 1;
+        }
+        else if (signal_seq != start_seq) return STATUS_WAIT_0;
+
+        if (timeout)
+        {
+            timeout_t remaining;
+
+            if (timeout->QuadPart == TIMEOUT_INFINITE) remaining = -1;
+            else if (timeout->QuadPart > 0)  /* absolute timeout */
+            {
+                LARGE_INTEGER now;
+                NtQuerySystemTime( &now );
+                if (timeout->QuadPart <= now.QuadPart) return STATUS_TIMEOUT;
+                remaining = timeout->QuadPart - now.QuadPart;
+            }
+            else remaining = -timeout->QuadPart;
+
+            if (!remaining) return STATUS_TIMEOUT;
+            if (remaining != -1)
+            {
+                ts.tv_sec  = remaining / 10000000;
+                ts.tv_nsec = (remaining % 10000000) * 100;
+                ts_ptr = &ts;
+            }
+            /* relative timeouts restart after a spurious wakeup, like the
+             * server wait does when the wait queue is reentered */
+        }
+
+        if (futex_wait_shared( &object->shm.event.signal_seq, signal_seq, ts_ptr ) == -1 &&
+            errno == ETIMEDOUT)
+            return STATUS_TIMEOUT;
+        /* EAGAIN or a wakeup: the state has changed, re-read it */
+    }
+}
+
+#else  /* __linux__ */
+
+const volatile session_shm_t *get_shared_session_header(void)
+{
+    return NULL;
+}
+
+void shared_event_cache_close( HANDLE handle )
+{
+}
+
+static NTSTATUS wait_shared_event( HANDLE handle, const LARGE_INTEGER *timeout )
+{
+    return STATUS_NOT_IMPLEMENTED;
+}
+
+#endif  /* __linux__ */
+
 /******************************************************************
  *		NtWaitForMultipleObjects (NTDLL.@)
  */
@@ -1577,6 +1820,12 @@ NTSTATUS WINAPI NtWaitForMultipleObjects( DWORD count, const HANDLE *handles, BO
 
     if (!count || count > MAXIMUM_WAIT_OBJECTS) return STATUS_INVALID_PARAMETER_1;
 
+    if (count == 1 && !alertable)
+    {
+        NTSTATUS status = wait_shared_event( handles[0], timeout );
+        if (status != STATUS_NOT_IMPLEMENTED) return status;
+    }
+
     if (alertable) flags |= SELECT_ALERTABLE;
     select_op.wait.op = wait_any ? SELECT_WAIT : SELECT_WAIT_ALL;
     for (i = 0; i < count; i++) select_op.wait.handles[i] = wine_server_obj_handle( handles[i] );
@@ -1636,6 +1885,23 @@ NTSTATUS WINAPI NtYieldExecution(void)
 }
 
 
+static ULONG timer_resolution_request;  /* timer resolution requested via NtSetTimerResolution */
+
+/* opt-in precise sleep mode: sleep to an absolute deadline on the monotonic
+ * clock and spin for the last stretch, to absorb the scheduler wakeup latency
+ * for sub-millisecond sleeps */
+static BOOL precise_sleep_enabled(void)
+{
+    static int enabled = -1;
+
+    if (enabled == -1)
+    {
+        const char *env = getenv( "WINE_PRECISE_SLEEP" );
+        enabled = env && atoi( env );
+    }
+    return enabled > 0;
+}
+
 /******************************************************************
  *		NtDelayExecution (NTDLL.@)
  */
@@ -1657,6 +1923,45 @@ NTSTATUS WINAPI NtDelayExecution( BOOLEAN alertable, const LARGE_INTEGER *timeou
     {
         for (;;) select( 0, NULL, NULL, NULL, NULL );
     }
+    else if (timeout->QuadPart <= 0 && precise_sleep_enabled())
+    {
+        /* the spin window is sized by the requested timer resolution, which is
+         * roughly how late the scheduler may wake us up */
+        timeout_t spin = timer_resolution_request ? timer_resolution_request : 10000;
+        timeout_t when = monotonic_counter() - timeout->QuadPart;
+        timeout_t diff;
+
+        status = NtYieldExecution();
+        if (!timeout->QuadPart) return status;
+
+        while ((diff = when - monotonic_counter()) > 0)
+        {
+            if (diff <= spin)
+            {
+                while (monotonic_counter() < when) YieldProcessor();
+                break;
+            }
+#ifdef HAVE_CLOCK_GETTIME
+            {
+                struct timespec ts;
+
+                diff -= spin;
+                ts.tv_sec  = diff / TICKSPERSEC;
+                ts.tv_nsec = (diff % TICKSPERSEC) * 100;
+                nanosleep( &ts, NULL );
+            }
+#else
+            {
+                struct timeval tv;
+
+                diff = (diff - spin + 9) / 10;
+                tv.tv_sec  = diff / 1000000;
+                tv.tv_usec = diff % 1000000;
+                select( 0, NULL, NULL, NULL, &tv );
+            }
+#endif
+        }
+    }
     else
     {
         LARGE_INTEGER now;
@@ -1693,6 +1998,14 @@ NTSTATUS WINAPI NtDelayExecution( BOOLEAN alertable, const LARGE_INTEGER *timeou
  */
 NTSTATUS WINAPI NtQueryPerformanceCounter( LARGE_INTEGER *counter, LARGE_INTEGER *frequency )
 {
+#if defined(__i386__) || defined(__x86_64__)
+    if (user_shared_data->QpcBypassEnabled & SHARED_GLOBAL_FLAGS_QPC_BYPASS_ENABLED)
+    {
+        counter->QuadPart = (read_tsc() + user_shared_data->QpcBias) >> user_shared_data->QpcShift;
+        if (frequency) frequency->QuadPart = user_shared_data->QpcFrequency;
+        return STATUS_SUCCESS;
+    }
+#endif
     counter->QuadPart = monotonic_counter();
     if (frequency) frequency->QuadPart = TICKSPERSEC;
     return STATUS_SUCCESS;
@@ -1771,8 +2084,6 @@ NTSTATUS WINAPI NtQueryTimerResolution( ULONG *min_res, ULONG *max_res, ULONG *c
  */
 NTSTATUS WINAPI NtSetTimerResolution( ULONG res, BOOLEAN set, ULONG *current_res )
 {
-    static BOOL has_request = FALSE;
-
     TRACE( "(%u,%u,%p), semi-stub!\n", res, set, current_res );
 
     /* Wine has no support for anything other that 1 ms and does not keep of
@@ -1783,12 +2094,12 @@ NTSTATUS WINAPI NtSetTimerResolution( ULONG res, BOOLEAN set, ULONG *current_res
      */
     *current_res = 10000;
 
-    /* Just keep track of whether this process requested a specific timer
-     * resolution.
+    /* Just keep track of the resolution this process requested, it also sizes
+     * the spin window of the precise sleep mode.
      */
-    if (!has_request && !set)
+    if (!timer_resolution_request && !set)
         return STATUS_TIMER_RESOLUTION_NOT_SET;
-    has_request = set;
+    timer_resolution_request = set ? min( max( res, 10000 ), 156250 ) : 0;
 
     return STATUS_SUCCESS;
 }
@@ -2095,6 +2406,34 @@ NTSTATUS WINAPI NtRemoveIoCompletionEx( HANDLE handle, FILE_IO_COMPLETION_INFORM
 
     while (i < count)
     {
+        /* once the first entry has been retrieved, drain the rest of the
+         * queue several entries per server round trip */
+        if (i && count - i > 1)
+        {
+            union generic_request requests[16];
+            union generic_reply replies[16];
+            ULONG j, n = min( count - i, ARRAY_SIZE(requests) );
+
+            memset( requests, 0, n * sizeof(*requests) );
+            for (j = 0; j < n; j++)
+            {
+                requests[j].request_header.req = REQ_remove_completion;
+                requests[j].remove_completion_request.handle    = wine_server_obj_handle( handle );
+                requests[j].remove_completion_request.alertable = alertable;
+            }
+            if ((status = server_call_batch( requests, replies, n ))) break;
+            for (j = 0; j < n; j++)
+            {
+                if ((status = replies[j].reply_header.error)) break;
+                info[i].CompletionKey             = replies[j].remove_completion_reply.ckey;
+                info[i].CompletionValue           = replies[j].remove_completion_reply.cvalue;
+                info[i].IoStatusBlock.Information = replies[j].remove_completion_reply.information;
+                info[i].IoStatusBlock.Status      = replies[j].remove_completion_reply.status;
+                ++i;
+            }
+            if (status != STATUS_SUCCESS) break;
+            continue;
+        }
         SERVER_START_REQ( remove_completion )
         {
             req->handle = wine_server_obj_handle( handle );
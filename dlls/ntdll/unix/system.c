@@ -683,6 +683,40 @@ void init_shared_data_cpuinfo( KUSER_SHARED_DATA *data )
 
 #endif /* End architecture specific feature detection for CPUs */
 
+/* set up the TSC-based QueryPerformanceCounter bypass, so that reading the counter
+ * is pure arithmetic on the timestamp counter and doesn't enter the kernel */
+void init_shared_data_qpc( KUSER_SHARED_DATA *data )
+{
+#if defined(__i386__) || defined(__x86_64__)
+    unsigned int regs[4];
+    UINT64 tsc0, tsc1, freq;
+    ULONGLONG count0, count1;
+
+    do_cpuid( 0x80000000, 0, regs );  /* get vendor cpuid level */
+    if (regs[0] < 0x80000007) return;
+    do_cpuid( 0x80000001, 0, regs );
+    if (!(regs[3] & (1 << 27))) return;  /* rdtscp */
+    do_cpuid( 0x80000007, 0, regs );
+    if (!(regs[3] & (1 << 8))) return;   /* invariant TSC */
+
+    /* calibrate the TSC frequency against the monotonic clock */
+    tsc0 = read_tsc();
+    count0 = monotonic_counter();
+    usleep( 20000 );
+    tsc1 = read_tsc();
+    count1 = monotonic_counter();
+    if (count1 <= count0) return;
+    freq = (tsc1 - tsc0) * TICKSPERSEC / (count1 - count0);
+    if (!(freq >> 10)) return;
+
+    data->QpcFrequency     = freq >> 10;
+    data->QpcShift         = 10;
+    data->QpcBias          = -tsc1;
+    data->QpcBypassEnabled = SHARED_GLOBAL_FLAGS_QPC_BYPASS_ENABLED | SHARED_GLOBAL_FLAGS_QPC_BYPASS_USE_RDTSCP;
+    TRACE( "TSC frequency %s Hz\n", wine_dbgstr_longlong(freq) );
+#endif
+}
+
 static BOOL grow_logical_proc_buf(void)
 {
     SYSTEM_LOGICAL_PROCESSOR_INFORMATION *new_data;
@@ -2850,12 +2884,58 @@ static void read_dev_urandom( void *buf, ULONG len )
     else WARN( "can't open /dev/urandom\n" );
 }
 
+static pthread_mutex_t process_snapshot_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct
+{
+    char        *data;          /* raw list_processes reply data */
+    unsigned int size;          /* allocated size of data */
+    unsigned int process_count;
+    unsigned int gen;           /* processes_generation when the data was fetched */
+    BOOL         valid;
+} process_snapshot;
+
+/* refresh the cached process list; must be called with the snapshot mutex held */
+static unsigned int update_process_snapshot(void)
+{
+    const volatile session_shm_t *session = get_shared_session_header();
+    unsigned int ret, gen = 0;
+
+    if (session)
+    {
+        gen = session->processes_generation;
+        if (process_snapshot.valid && process_snapshot.gen == gen) return STATUS_SUCCESS;
+    }
+
+    for (;;)
+    {
+        unsigned int info_size;
+
+        SERVER_START_REQ( list_processes )
+        {
+            wine_server_set_reply( req, process_snapshot.data, process_snapshot.size );
+            ret = wine_server_call( req );
+            process_snapshot.process_count = reply->process_count;
+            info_size = reply->info_size;
+        }
+        SERVER_END_REQ;
+
+        if (ret != STATUS_INFO_LENGTH_MISMATCH) break;
+        free( process_snapshot.data );
+        process_snapshot.size = 0;
+        if (!(process_snapshot.data = malloc( info_size ))) return STATUS_NO_MEMORY;
+        process_snapshot.size = info_size;
+    }
+    process_snapshot.valid = session && !ret;
+    process_snapshot.gen = gen;
+    return ret;
+}
+
 static unsigned int get_system_process_info( SYSTEM_INFORMATION_CLASS class, void *info, ULONG size, ULONG *len )
 {
-    unsigned int process_count, total_thread_count, total_name_len, i, j;
+    unsigned int process_count, i, j;
     unsigned int thread_info_size;
     unsigned int pos = 0;
-    char *buffer = NULL;
+    const char *buffer;
     unsigned int ret;
 
 C_ASSERT( sizeof(struct thread_info) <= sizeof(SYSTEM_THREAD_INFORMATION) );
@@ -2867,28 +2947,15 @@ C_ASSERT( sizeof(struct process_info) <= sizeof(SYSTEM_PROCESS_INFORMATION) );
         thread_info_size = sizeof(SYSTEM_THREAD_INFORMATION);
 
     *len = 0;
-    if (size && !(buffer = malloc( size ))) return STATUS_NO_MEMORY;
 
-    SERVER_START_REQ( list_processes )
+    pthread_mutex_lock( &process_snapshot_mutex );
+    if ((ret = update_process_snapshot()))
     {
-        wine_server_set_reply( req, buffer, size );
-        ret = wine_server_call( req );
-        total_thread_count = reply->total_thread_count;
-        total_name_len = reply->total_name_len;
-        process_count = reply->process_count;
-    }
-    SERVER_END_REQ;
-
-    if (ret)
-    {
-        if (ret == STATUS_INFO_LENGTH_MISMATCH)
-            *len = sizeof(SYSTEM_PROCESS_INFORMATION) * process_count
-                  + (total_name_len + process_count) * sizeof(WCHAR)
-                  + total_thread_count * thread_info_size;
-
-        free( buffer );
+        pthread_mutex_unlock( &process_snapshot_mutex );
         return ret;
     }
+    buffer = process_snapshot.data;
+    process_count = process_snapshot.process_count;
 
     for (i = 0; i < process_count; i++)
     {
@@ -2970,7 +3037,7 @@ C_ASSERT( sizeof(struct process_info) <= sizeof(SYSTEM_PROCESS_INFORMATION) );
     }
 
     if (*len > size) ret = STATUS_INFO_LENGTH_MISMATCH;
-    free( buffer );
+    pthread_mutex_unlock( &process_snapshot_mutex );
     return ret;
 }
 
@@ -223,6 +223,11 @@ extern ULONG_PTR redirect_arm64ec_rva( void *module, ULONG_PTR rva, const IMAGE_
 extern void start_server( BOOL debug );
 
 extern unsigned int server_call_unlocked( void *req_ptr );
+extern unsigned int server_call_batch( const union generic_request *requests,
+                                       union generic_reply *replies, unsigned int count );
+extern void shared_event_cache_close( HANDLE handle );
+extern const volatile session_shm_t *get_shared_session_header(void);
+extern void reg_value_cache_close( HANDLE handle );
 extern void server_enter_uninterrupted_section( pthread_mutex_t *mutex, sigset_t *sigset );
 extern void server_leave_uninterrupted_section( pthread_mutex_t *mutex, sigset_t *sigset );
 extern unsigned int server_select( const union select_op *select_op, data_size_t size, UINT flags,
@@ -233,6 +238,8 @@ extern unsigned int server_queue_process_apc( HANDLE process, const union apc_ca
                                               union apc_result *result );
 extern int server_get_unix_fd( HANDLE handle, unsigned int wanted_access, int *unix_fd,
                                int *needs_close, enum server_fd_type *type, unsigned int *options );
+extern int server_get_cached_unix_fd( HANDLE handle, int *unix_fd, enum server_fd_type *type,
+                                      unsigned int *options );
 extern void wine_server_send_fd( int fd );
 extern void process_exit_wrapper( int status ) DECLSPEC_NORETURN;
 extern size_t server_init_process(void);
@@ -368,6 +375,18 @@ extern NTSTATUS get_device_info( int fd, struct _FILE_FS_DEVICE_INFORMATION *inf
 extern void init_files(void);
 extern void init_cpu_info(void);
 extern void init_shared_data_cpuinfo( struct _KUSER_SHARED_DATA *data );
+extern void init_shared_data_qpc( struct _KUSER_SHARED_DATA *data );
+extern ULONGLONG monotonic_counter(void);
+
+#if defined(__i386__) || defined(__x86_64__)
+/* read the CPU timestamp counter, serialized against earlier instructions */
+static inline UINT64 read_tsc(void)
+{
+    unsigned int aux, lo, hi;
+    __asm__ __volatile__( "rdtscp" : "=a" (lo), "=d" (hi), "=c" (aux) );
+    return ((UINT64)hi << 32) | lo;
+}
+#endif
 extern void file_complete_async( HANDLE handle, unsigned int options, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user,
                                  IO_STATUS_BLOCK *io, NTSTATUS status, ULONG_PTR information );
 extern void set_async_direct_result( HANDLE *async_handle, unsigned int options, IO_STATUS_BLOCK *io,
@@ -76,8 +76,47 @@
 #if defined(HAVE_LINUX_USERFAULTFD_H) && defined(HAVE_LINUX_FS_H)
 # include <linux/userfaultfd.h>
 # include <linux/fs.h>
-#if defined(UFFD_FEATURE_WP_ASYNC) && defined(PM_SCAN_WP_MATCHING)
+#ifdef UFFDIO_WRITEPROTECT
 #define USE_UFFD_WRITEWATCH
+/* added in Linux 5.11 */
+#ifndef UFFD_USER_MODE_ONLY
+#define UFFD_USER_MODE_ONLY 1
+#endif
+/* added in Linux 6.4 */
+#ifndef UFFD_FEATURE_WP_UNPOPULATED
+#define UFFD_FEATURE_WP_UNPOPULATED (1 << 13)
+#endif
+/* added in Linux 6.7 */
+#ifndef UFFD_FEATURE_WP_ASYNC
+#define UFFD_FEATURE_WP_ASYNC (1 << 15)
+#endif
+/* added in Linux 6.7 */
+#ifndef PAGEMAP_SCAN
+struct page_region
+{
+    __u64 start;
+    __u64 end;
+    __u64 categories;
+};
+struct pm_scan_arg
+{
+    __u64 size;
+    __u64 flags;
+    __u64 start;
+    __u64 end;
+    __u64 walk_end;
+    __u64 vec;
+    __u64 vec_len;
+    __u64 max_pages;
+    __u64 category_inverted;
+    __u64 category_mask;
+    __u64 category_anyof_mask;
+    __u64 return_mask;
+};
+#define PAGEMAP_SCAN _IOWR('f', 16, struct pm_scan_arg)
+#define PAGE_IS_WRITTEN (1 << 1)
+#define PM_SCAN_WP_MATCHING (1 << 0)
+#endif
 #endif
 #endif
 
@@ -167,11 +206,21 @@ static const BYTE VIRTUAL_Win32Flags[16] =
 };
 
 static struct wine_rb_tree views_tree;
+/* seqlock protecting lock-free view tree lookups, odd while the tree or a
+ * registered view is being modified. View memory is never released back to the
+ * system, so a lock-free reader can safely dereference stale nodes as long as
+ * it discards the result when the sequence changed.
+ */
+static unsigned int views_tree_seq;
+static unsigned int views_tree_write_depth;
 static pthread_mutex_t virtual_mutex;
 
 static const UINT page_shift = 12;
 static const UINT_PTR page_mask = 0xfff;
 static const UINT_PTR granularity_mask = 0xffff;
+static const UINT_PTR large_page_mask = 0x1fffff;  /* cf. LargePageMinimum in user shared data */
+
+static BOOL huge_page_images;  /* map PE images 2MB-aligned and advise huge pages for them */
 
 #ifdef __aarch64__
 static UINT_PTR host_page_size;
@@ -1455,6 +1504,78 @@ static struct file_view *find_view( const void *addr, size_t size )
 }
 
 
+/***********************************************************************
+ *           views_tree_write_begin
+ *
+ * Enter a view tree write section, making lock-free readers retry or fall
+ * back to the locked path. virtual_mutex must be held by caller. Sections
+ * can be nested so that multi-step updates (e.g. splitting a view) never
+ * expose an intermediate tree to lock-free readers.
+ */
+static void views_tree_write_begin(void)
+{
+    if (!views_tree_write_depth++)
+        __atomic_store_n( &views_tree_seq, views_tree_seq + 1, __ATOMIC_RELEASE );
+}
+
+
+/***********************************************************************
+ *           views_tree_write_end
+ *
+ * Leave a view tree write section. virtual_mutex must be held by caller.
+ */
+static void views_tree_write_end(void)
+{
+    assert( views_tree_seq & 1 );
+    if (!--views_tree_write_depth)
+        __atomic_store_n( &views_tree_seq, views_tree_seq + 1, __ATOMIC_RELEASE );
+}
+
+
+/***********************************************************************
+ *           find_view_lockless
+ *
+ * Lock-free version of find_view, for read-only lookups that cannot afford
+ * taking virtual_mutex. View memory is only ever recycled, never unmapped,
+ * so walking a stale tree cannot fault; the walk is depth-bounded in case
+ * a concurrent rotation produces a transient cycle, and the result is only
+ * valid when the sequence did not change across the walk. On contention
+ * *valid is set to FALSE and the caller must fall back to the locked path.
+ */
+static struct file_view *find_view_lockless( const void *addr, size_t size, BOOL *valid )
+{
+    unsigned int attempt, depth, seq;
+    struct file_view *found;
+    struct wine_rb_entry *ptr;
+
+    *valid = FALSE;
+    if ((const char *)addr + size < (const char *)addr) return NULL; /* overflow */
+
+    for (attempt = 0; attempt < 3; attempt++)
+    {
+        if ((seq = __atomic_load_n( &views_tree_seq, __ATOMIC_ACQUIRE )) & 1) continue;
+        found = NULL;
+        ptr = views_tree.root;
+        for (depth = 0; ptr && !found && depth < 128; depth++)
+        {
+            struct file_view *view = WINE_RB_ENTRY_VALUE( ptr, struct file_view, entry );
+            const char *base = view->base;
+            size_t view_size = view->size;
+
+            if (base > (const char *)addr) ptr = ptr->left;
+            else if (base + view_size <= (const char *)addr) ptr = ptr->right;
+            else if (base + view_size < (const char *)addr + size) break;  /* size too large */
+            else found = view;
+        }
+        if (ptr && !found && depth == 128) break;  /* possible transient cycle, use the locked path */
+        if (__atomic_load_n( &views_tree_seq, __ATOMIC_ACQUIRE ) != seq) continue;
+        *valid = TRUE;
+        return found;
+    }
+    return NULL;
+}
+
+
 /***********************************************************************
  *           is_write_watch_range
  */
@@ -1775,9 +1896,11 @@ static void free_view( struct file_view *view )
  */
 static void unregister_view( struct file_view *view )
 {
+    views_tree_write_begin();
     if (mmap_is_in_reserved_area( view->base, view->size ))
         free_ranges_remove_view( view );
     wine_rb_remove( &views_tree, &view->entry );
+    views_tree_write_end();
 }
 
 
@@ -1803,9 +1926,11 @@ static void delete_view( struct file_view *view ) /* [in] View */
  */
 static void register_view( struct file_view *view )
 {
+    views_tree_write_begin();
     wine_rb_put( &views_tree, view->base, &view->entry );
     if (mmap_is_in_reserved_area( view->base, view->size ))
         free_ranges_insert_view( view );
+    views_tree_write_end();
 }
 
 
@@ -2229,6 +2354,22 @@ failed:
     return status;
 }
 
+/***********************************************************************
+ *           advise_huge_pages
+ *
+ * Ask the kernel to back a 2MB-aligned range with huge pages.  This is
+ * only advisory: transparent huge pages may be disabled system-wide, and
+ * shared sections additionally depend on the tmpfs huge page policy, so
+ * failure is ignored.
+ */
+static void advise_huge_pages( void *base, size_t size )
+{
+#ifdef MADV_HUGEPAGE
+    madvise( base, size, MADV_HUGEPAGE );
+#endif
+}
+
+
 /***********************************************************************
  *           map_view
  *
@@ -2510,16 +2651,19 @@ static NTSTATUS remove_pages_from_view( struct file_view *view, char *base, size
         new_view->size    = (char *)view->base + view->size - (char *)new_view->base;
         new_view->protect = view->protect;
 
+        views_tree_write_begin();
         unregister_view( view );
         view->size = base - (char *)view->base;
         register_view( view );
         register_view( new_view );
+        views_tree_write_end();
 
         VIRTUAL_DEBUG_DUMP_VIEW( view );
         VIRTUAL_DEBUG_DUMP_VIEW( new_view );
     }
     else
     {
+        views_tree_write_begin();
         unregister_view( view );
         if (view->base == base)
         {
@@ -2529,6 +2673,7 @@ static NTSTATUS remove_pages_from_view( struct file_view *view, char *base, size
         else view->size = base - (char *)view->base;
 
         register_view( view );
+        views_tree_write_end();
         VIRTUAL_DEBUG_DUMP_VIEW( view );
     }
     return STATUS_SUCCESS;
@@ -2651,6 +2796,7 @@ static NTSTATUS coalesce_placeholders( struct file_view *view, char *base, size_
 
     if (view_count < 2 || size != views_size) return STATUS_CONFLICTING_ADDRESSES;
 
+    views_tree_write_begin();
     for (i = 1; i < view_count; ++i)
     {
         curr_view = RB_ENTRY_VALUE( rb_next( &view->entry ), struct file_view, entry );
@@ -2661,6 +2807,7 @@ static NTSTATUS coalesce_placeholders( struct file_view *view, char *base, size_
     unregister_view( view );
     view->size = views_size;
     register_view( view );
+    views_tree_write_end();
 
     VIRTUAL_DEBUG_DUMP_VIEW( view );
 
@@ -3192,6 +3339,11 @@ static NTSTATUS map_image_into_view( struct file_view *view, const WCHAR *filena
         }
     }
 
+    /* start readahead for the whole image, so that the relocation and import
+     * fixup passes overlap with the disk reads instead of faulting page by page */
+    madvise( ptr, total_size, MADV_WILLNEED );
+    if (huge_page_images) advise_huge_pages( ptr, total_size );
+
 #ifdef __aarch64__
     if ((dir = get_data_dir( nt, total_size, IMAGE_DIRECTORY_ENTRY_LOAD_CONFIG )))
     {
@@ -3367,13 +3519,15 @@ static NTSTATUS map_image_view( struct file_view **view_ret, struct pe_image_inf
     }
     if (start < end && (start != limit_low || end != limit_high))
     {
-        status = map_view( view_ret, NULL, size, top_down ? MEM_TOP_DOWN : 0, vprot, start, end, 0 );
+        status = map_view( view_ret, NULL, size, top_down ? MEM_TOP_DOWN : 0, vprot, start, end,
+                           huge_page_images ? large_page_mask : 0 );
         if (!status) return status;
     }
 
     /* then any suitable address */
 
-    return map_view( view_ret, NULL, size, top_down ? MEM_TOP_DOWN : 0, vprot, limit_low, limit_high, 0 );
+    return map_view( view_ret, NULL, size, top_down ? MEM_TOP_DOWN : 0, vprot, limit_low, limit_high,
+                     huge_page_images ? large_page_mask : 0 );
 }
 
 
@@ -3553,13 +3707,15 @@ static unsigned int virtual_map_section( HANDLE handle, PVOID *addr_ptr, ULONG_P
 
     server_enter_uninterrupted_section( &virtual_mutex, &sigset );
 
-    res = map_view( &view, base, size, alloc_type, vprot, limit_low, limit_high, 0 );
+    res = map_view( &view, base, size, alloc_type, vprot, limit_low, limit_high,
+                    (sec_flags & SEC_LARGE_PAGES) ? large_page_mask : 0 );
     if (res) goto done;
 
     TRACE( "handle=%p size=%lx offset=%s\n", handle, size, wine_dbgstr_longlong(offset.QuadPart) );
     res = map_file_into_view( view, unix_handle, 0, size, offset.QuadPart, vprot, needs_close );
     if (res == STATUS_SUCCESS)
     {
+        if (sec_flags & SEC_LARGE_PAGES) advise_huge_pages( view->base, view->size );
         /* file mappings must always be accessible */
         mprotect_range( view->base, view->size, VPROT_COMMITTED, 0 );
 
@@ -3660,6 +3816,12 @@ void virtual_init(void)
 
     if (use_kernel_writewatch) TRACE( "Using kernel write watches.\n" );
 
+    {
+        const char *env = getenv( "WINE_HUGE_PAGE_IMAGES" );
+        huge_page_images = env && atoi( env );
+        if (huge_page_images) TRACE( "Using huge pages for PE images.\n" );
+    }
+
     if (preload_info && *preload_info)
         for (i = 0; (*preload_info)[i].size; i++)
             mmap_add_reserved_area( (*preload_info)[i].addr, (*preload_info)[i].size );
@@ -4331,6 +4493,7 @@ void virtual_init_user_shared_data(void)
     }
 
     init_shared_data_cpuinfo( data );
+    init_shared_data_qpc( data );
     munmap( data, sizeof(*data) );
 }
 
@@ -4412,7 +4575,13 @@ NTSTATUS virtual_handle_fault( EXCEPTION_RECORD *rec, void *stack )
     char *page = ROUND_ADDR( addr, host_page_mask );
     BYTE vprot;
 
-    mutex_lock( &virtual_mutex );  /* no need for signal masking inside signal handler */
+    /* First classify the fault without the lock: the per-page prot table is
+     * only ever grown and a single byte read is atomic, and the thread faulted
+     * after the kernel protection change that any concurrent update performs
+     * after updating the table, so the byte cannot be older than the fault.
+     * If it shows neither a guard page nor a write watch to service, this is a
+     * plain access violation and there is nothing to update.
+     */
     vprot = get_host_page_vprot( page );
 
 #ifdef __APPLE__
@@ -4423,6 +4592,21 @@ NTSTATUS virtual_handle_fault( EXCEPTION_RECORD *rec, void *stack )
         err = EXCEPTION_WRITE_FAULT;
     }
 #endif
+    if (!(vprot & VPROT_GUARD) &&
+        (use_kernel_writewatch || !(err & EXCEPTION_WRITE_FAULT) ||
+         !((vprot & VPROT_WRITEWATCH) || (get_unix_prot( vprot ) & PROT_WRITE))))
+    {
+        rec->ExceptionCode = ret;
+        return ret;
+    }
+
+    mutex_lock( &virtual_mutex );  /* no need for signal masking inside signal handler */
+    vprot = get_host_page_vprot( page );
+
+#ifdef __APPLE__
+    if (err == EXCEPTION_READ_FAULT && (get_unix_prot( vprot ) & PROT_READ))
+        err = EXCEPTION_WRITE_FAULT;
+#endif
 
     if (!is_inside_signal_stack( stack ) && (vprot & VPROT_GUARD))
     {
@@ -4652,12 +4836,15 @@ ssize_t virtual_locked_recvmsg( int fd, struct msghdr *hdr, int flags )
 BOOL virtual_is_valid_code_address( const void *addr, SIZE_T size )
 {
     struct file_view *view;
-    BOOL ret = FALSE;
+    BOOL ret = FALSE, valid;
     sigset_t sigset;
 
+    view = find_view_lockless( addr, size, &valid );
+    if (valid) return view && !(view->protect & VPROT_SYSTEM);  /* system views are not visible to the app */
+
     server_enter_uninterrupted_section( &virtual_mutex, &sigset );
     if ((view = find_view( addr, size )))
-        ret = !(view->protect & VPROT_SYSTEM);  /* system views are not visible to the app */
+        ret = !(view->protect & VPROT_SYSTEM);
     server_leave_uninterrupted_section( &virtual_mutex, &sigset );
     return ret;
 }
@@ -4966,6 +5153,14 @@ static NTSTATUS allocate_virtual_memory( void **ret, SIZE_T *size_ptr, ULONG typ
     if (type & MEM_RESERVE_PLACEHOLDER && (protect != PAGE_NOACCESS)) return STATUS_INVALID_PARAMETER;
     if (!arm64ec_view && (attributes & MEM_EXTENDED_PARAMETER_EC_CODE)) return STATUS_INVALID_PARAMETER;
 
+    if (type & MEM_LARGE_PAGES)
+    {
+        /* large pages require a fresh committed allocation in multiples of the large page size */
+        if (!(type & MEM_COMMIT) || !(type & MEM_RESERVE)) return STATUS_INVALID_PARAMETER;
+        if ((size & large_page_mask) || ((UINT_PTR)base & large_page_mask)) return STATUS_INVALID_PARAMETER;
+        if (!align) align = large_page_mask + 1;
+    }
+
     /* Reserve the memory */
 
     server_enter_uninterrupted_section( &virtual_mutex, &sigset );
@@ -5010,6 +5205,8 @@ static NTSTATUS allocate_virtual_memory( void **ret, SIZE_T *size_ptr, ULONG typ
         }
     }
 
+    if (!status && (type & MEM_LARGE_PAGES)) advise_huge_pages( base, size );
+
     if (!status && (attributes & MEM_EXTENDED_PARAMETER_EC_CODE))
     {
         commit_arm64ec_map( view );
@@ -5039,7 +5236,8 @@ static NTSTATUS allocate_virtual_memory( void **ret, SIZE_T *size_ptr, ULONG typ
 NTSTATUS WINAPI NtAllocateVirtualMemory( HANDLE process, PVOID *ret, ULONG_PTR zero_bits,
                                          SIZE_T *size_ptr, ULONG type, ULONG protect )
 {
-    static const ULONG type_mask = MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_WRITE_WATCH | MEM_RESET;
+    static const ULONG type_mask = MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_WRITE_WATCH
+                                   | MEM_RESET | MEM_LARGE_PAGES;
     ULONG_PTR limit;
 
     TRACE("%p %p %08lx %x %08x\n", process, *ret, *size_ptr, type, protect );
@@ -5179,7 +5377,8 @@ NTSTATUS WINAPI NtAllocateVirtualMemoryEx( HANDLE process, PVOID *ret, SIZE_T *s
                                            ULONG count )
 {
     static const ULONG type_mask = MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_WRITE_WATCH
-                                   | MEM_RESET | MEM_RESERVE_PLACEHOLDER | MEM_REPLACE_PLACEHOLDER;
+                                   | MEM_RESET | MEM_RESERVE_PLACEHOLDER | MEM_REPLACE_PLACEHOLDER
+                                   | MEM_LARGE_PAGES;
     ULONG_PTR limit_low = 0;
     ULONG_PTR limit_high = 0;
     ULONG_PTR align = 0;
@@ -255,12 +255,112 @@ BOOLEAN CDECL RtlDeleteFunctionTable( RUNTIME_FUNCTION *table )
 }
 
 
+/***********************************************************************
+ * Module function table cache
+ *
+ * Exception dispatch looks up the same few modules over and over; cache
+ * the result of the loader lookup so that repeated unwinds don't have to
+ * walk the loader data and parse the exception directory every time.
+ * Slots use a sequence counter that is odd while being updated, so that
+ * lookups are lock-free; entries are dropped when a module is unloaded.
+ */
+
+#define FUNC_TABLE_CACHE_SIZE 32  /* power of two */
+
+struct func_table_cache_entry
+{
+    LONG              seq;    /* sequence counter, odd while the slot is being updated */
+    ULONG_PTR         base;
+    ULONG_PTR         end;
+    RUNTIME_FUNCTION *table;
+    ULONG             len;
+#ifdef __arm64ec__
+    BOOLEAN           ec_code;
+#endif
+};
+
+static struct func_table_cache_entry func_table_cache[FUNC_TABLE_CACHE_SIZE];
+static LONG func_table_cache_generation;  /* bumped on every module unload */
+
+static unsigned int func_table_cache_hash( ULONG_PTR pc )
+{
+    /* hash on 64k granularity so that all lookups within a small module hit the same slot */
+    return (pc >> 16) & (FUNC_TABLE_CACHE_SIZE - 1);
+}
+
+static RUNTIME_FUNCTION *func_table_cache_lookup( ULONG_PTR pc, ULONG_PTR *base, ULONG *len )
+{
+    struct func_table_cache_entry *entry = &func_table_cache[func_table_cache_hash( pc )];
+    RUNTIME_FUNCTION *table;
+    LONG seq;
+
+    seq = ReadAcquire( &entry->seq );
+    if ((seq & 1) || pc < entry->base || pc >= entry->end) return NULL;
+#ifdef __arm64ec__
+    if (entry->ec_code != RtlIsEcCode( pc )) return NULL;
+#endif
+    *base = entry->base;
+    *len = entry->len;
+    table = entry->table;
+    MemoryBarrier();  /* finish reading the slot before validating the sequence counter */
+    if (ReadNoFence( &entry->seq ) != seq) return NULL;
+    return table;
+}
+
+static void func_table_cache_insert( ULONG_PTR pc, ULONG_PTR base, ULONG_PTR end,
+                                     RUNTIME_FUNCTION *table, ULONG len, LONG generation )
+{
+    struct func_table_cache_entry *entry = &func_table_cache[func_table_cache_hash( pc )];
+    LONG seq = ReadNoFence( &entry->seq );
+
+    /* don't cache if the module might have been unloaded since we looked it up */
+    if (ReadNoFence( &func_table_cache_generation ) != generation) return;
+    if (seq & 1) return;  /* another thread is already updating the slot */
+    if (InterlockedCompareExchange( &entry->seq, seq + 1, seq ) != seq) return;
+    entry->base  = base;
+    entry->end   = end;
+    entry->table = table;
+    entry->len   = len;
+#ifdef __arm64ec__
+    entry->ec_code = RtlIsEcCode( pc );
+#endif
+    WriteRelease( &entry->seq, seq + 2 );
+}
+
+/***********************************************************************
+ *           unwind_invalidate_cache
+ *
+ * Drop cached function tables for a module that is being unloaded.
+ * Called from the loader with the loader lock held.
+ */
+void unwind_invalidate_cache( const void *module )
+{
+    unsigned int i;
+
+    InterlockedIncrement( &func_table_cache_generation );
+    for (i = 0; i < FUNC_TABLE_CACHE_SIZE; i++)
+    {
+        struct func_table_cache_entry *entry = &func_table_cache[i];
+        LONG seq = ReadNoFence( &entry->seq );
+
+        if ((seq & 1) || entry->base != (ULONG_PTR)module) continue;
+        if (InterlockedCompareExchange( &entry->seq, seq + 1, seq ) != seq) continue;
+        entry->base = entry->end = 0;
+        WriteRelease( &entry->seq, seq + 2 );
+    }
+}
+
+
 /**********************************************************************
  *              RtlLookupFunctionTable   (NTDLL.@)
  */
 PRUNTIME_FUNCTION WINAPI RtlLookupFunctionTable( ULONG_PTR pc, ULONG_PTR *base, ULONG *len )
 {
     LDR_DATA_TABLE_ENTRY *module;
+    RUNTIME_FUNCTION *func;
+    LONG generation = ReadAcquire( &func_table_cache_generation );
+
+    if ((func = func_table_cache_lookup( pc, base, len ))) return func;
 
     if (LdrFindEntryForAddress( (void *)pc, &module )) return NULL;
     *base = (ULONG_PTR)module->DllBase;
@@ -270,10 +370,14 @@ PRUNTIME_FUNCTION WINAPI RtlLookupFunctionTable( ULONG_PTR pc, ULONG_PTR *base,
         IMAGE_ARM64EC_METADATA *metadata = arm64ec_get_module_metadata( module->DllBase );
         if (!metadata) return NULL;
         *len = metadata->ExtraRFETableSize;
-        return (RUNTIME_FUNCTION *)(*base + metadata->ExtraRFETable);
+        func = (RUNTIME_FUNCTION *)(*base + metadata->ExtraRFETable);
     }
+    else
 #endif
-    return RtlImageDirectoryEntryToData( module->DllBase, TRUE, IMAGE_DIRECTORY_ENTRY_EXCEPTION, len );
+    func = RtlImageDirectoryEntryToData( module->DllBase, TRUE, IMAGE_DIRECTORY_ENTRY_EXCEPTION, len );
+    if (func) func_table_cache_insert( pc, *base, (ULONG_PTR)module->DllBase + module->SizeOfImage,
+                                       func, *len, generation );
+    return func;
 }
 
 
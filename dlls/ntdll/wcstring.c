@@ -215,6 +215,26 @@ errno_t __cdecl wcscpy_s( wchar_t *dst, size_t len, const wchar_t *src )
 size_t __cdecl wcslen( LPCWSTR str )
 {
     const WCHAR *s = str;
+
+    if (!((ULONG_PTR)s & 1))
+    {
+        /* word-at-a-time scan: (v - 0x0001..) & ~v & 0x8000.. has a bit set
+         * when one of the WCHARs of v is zero (it can over-detect on borrow
+         * propagation, the final scalar scan sorts that out). Aligned reads
+         * cannot cross a page boundary before the terminating null.
+         */
+        while ((ULONG_PTR)s & 7)
+        {
+            if (!*s) return s - str;
+            s++;
+        }
+        for (;;)
+        {
+            ULONGLONG v = *(const ULONGLONG *)s;
+            if ((v - 0x0001000100010001ull) & ~v & 0x8000800080008000ull) break;
+            s += 4;
+        }
+    }
     while (*s) s++;
     return s - str;
 }
@@ -255,6 +275,26 @@ errno_t __cdecl wcscat_s( wchar_t *dst, size_t len, const wchar_t *src )
  */
 LPWSTR __cdecl wcschr( LPCWSTR str, WCHAR ch )
 {
+    if (!((ULONG_PTR)str & 1))
+    {
+        /* same word-at-a-time scan as wcslen, looking for both ch and the
+         * terminating null */
+        ULONGLONG mask = 0x0001000100010001ull * ch;
+
+        while ((ULONG_PTR)str & 7)
+        {
+            if (*str == ch) return (WCHAR *)(ULONG_PTR)str;
+            if (!*str) return NULL;
+            str++;
+        }
+        for (;;)
+        {
+            ULONGLONG v = *(const ULONGLONG *)str, x = v ^ mask;
+            if ((v - 0x0001000100010001ull) & ~v & 0x8000800080008000ull) break;
+            if ((x - 0x0001000100010001ull) & ~x & 0x8000800080008000ull) break;
+            str += 4;
+        }
+    }
     do { if (*str == ch) return (WCHAR *)(ULONG_PTR)str; } while (*str++);
     return NULL;
 }
@@ -730,11 +730,9 @@ static NTSTATUS dispatch_ioctl( struct dispatch_context *context )
     IO_STACK_LOCATION *irpsp;
     IRP *irp;
     void *out_buff = NULL;
-    void *to_free = NULL;
     DEVICE_OBJECT *device;
     FILE_OBJECT *file = wine_server_get_ptr( context->params.ioctl.file );
     ULONG out_size = context->params.ioctl.out_size;
-    NTSTATUS status;
 
     if (!file) return STATUS_INVALID_HANDLE;
 
@@ -754,9 +752,9 @@ static NTSTATUS dispatch_ioctl( struct dispatch_context *context )
         }
         else if (out_size > context->in_size)
         {
-            if (!(out_buff = HeapAlloc( GetProcessHeap(), 0, out_size ))) return STATUS_NO_MEMORY;
-            memcpy( out_buff, context->in_buff, context->in_size );
-            to_free = context->in_buff;
+            /* grow the input buffer in place instead of copying it around */
+            if (!(out_buff = HeapReAlloc( GetProcessHeap(), 0, context->in_buff, out_size )))
+                return STATUS_NO_MEMORY;
             context->in_buff = out_buff;
         }
         else
@@ -783,10 +781,7 @@ static NTSTATUS dispatch_ioctl( struct dispatch_context *context )
     context->in_buff = NULL;
 
     irp->Flags |= IRP_DEALLOCATE_BUFFER;  /* deallocate in_buff */
-    status = dispatch_irp( device, irp, context );
-
-    HeapFree( GetProcessHeap(), 0, to_free );
-    return status;
+    return dispatch_irp( device, irp, context );
 }
 
 /* process a volume information request for a given device */
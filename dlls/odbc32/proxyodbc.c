@@ -389,6 +389,116 @@ static const struct win32_funcs *load_driver( const WCHAR *filename )
     return &driver->funcs;
 }
 
+static SQLINTEGER connection_pooling = SQL_CP_OFF;
+
+static CRITICAL_SECTION pool_cs;
+static CRITICAL_SECTION_DEBUG pool_cs_debug =
+{
+    0, 0, &pool_cs,
+    { &pool_cs_debug.ProcessLocksList, &pool_cs_debug.ProcessLocksList },
+      0, 0, { (ULONG_PTR)(__FILE__ ": pool_cs") }
+};
+static CRITICAL_SECTION pool_cs = { &pool_cs_debug, -1, 0, 0, 0, 0 };
+
+struct pooled_connection
+{
+    struct list entry;
+    const struct object *env;   /* environment the driver connection was created under */
+    UINT64 unix_handle;
+    void  *win32_handle;
+    const struct win32_funcs *win32_funcs;
+    const WCHAR *connect_string;
+};
+
+static struct list connection_pool = LIST_INIT( connection_pool );
+
+/* Caller must hold the connection lock. Moves the driver connection into the pool instead of
+   disconnecting it; the connection object is left disconnected as usual. */
+static BOOL park_connection( struct connection *con )
+{
+    struct pooled_connection *entry;
+    WCHAR *ptr;
+
+    if (!(entry = malloc( sizeof(*entry) + (wcslen(con->pool_string) + 1) * sizeof(WCHAR) ))) return FALSE;
+    ptr = (WCHAR *)(entry + 1);
+    wcscpy( ptr, con->pool_string );
+    entry->connect_string = ptr;
+    entry->env          = con->hdr.parent;
+    entry->unix_handle  = con->hdr.unix_handle;
+    entry->win32_handle = con->hdr.win32_handle;
+    entry->win32_funcs  = con->hdr.win32_funcs;
+
+    EnterCriticalSection( &pool_cs );
+    list_add_head( &connection_pool, &entry->entry );
+    LeaveCriticalSection( &pool_cs );
+
+    con->hdr.unix_handle  = 0;
+    con->hdr.win32_handle = NULL;
+    return TRUE;
+}
+
+/* Caller must hold the connection lock. A pooled driver connection can only be reused under the
+   environment it was created under since it belongs to that environment's driver handle. */
+static BOOL unpark_connection( struct connection *con, const WCHAR *connect_string )
+{
+    struct pooled_connection *entry, *found = NULL;
+
+    EnterCriticalSection( &pool_cs );
+    LIST_FOR_EACH_ENTRY( entry, &connection_pool, struct pooled_connection, entry )
+    {
+        if (entry->env == con->hdr.parent && !wcsicmp( entry->connect_string, connect_string ))
+        {
+            list_remove( &entry->entry );
+            found = entry;
+            break;
+        }
+    }
+    LeaveCriticalSection( &pool_cs );
+    if (!found) return FALSE;
+
+    con->hdr.unix_handle  = found->unix_handle;
+    con->hdr.win32_handle = found->win32_handle;
+    if (found->win32_handle) con->hdr.win32_funcs = con->hdr.parent->win32_funcs = found->win32_funcs;
+    free( found );
+    return TRUE;
+}
+
+/* Disconnect pooled connections created under an environment that's about to go away,
+   or all of them if env is NULL. */
+static void drain_connection_pool( const struct object *env )
+{
+    struct pooled_connection *entry, *next;
+    struct list drained = LIST_INIT( drained );
+
+    EnterCriticalSection( &pool_cs );
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &connection_pool, struct pooled_connection, entry )
+    {
+        if (env && entry->env != env) continue;
+        list_remove( &entry->entry );
+        list_add_tail( &drained, &entry->entry );
+    }
+    LeaveCriticalSection( &pool_cs );
+
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &drained, struct pooled_connection, entry )
+    {
+        if (entry->unix_handle)
+        {
+            struct SQLDisconnect_params disconnect_params = { entry->unix_handle };
+            struct SQLFreeHandle_params free_params = { SQL_HANDLE_DBC, entry->unix_handle };
+            ODBC_CALL( SQLDisconnect, &disconnect_params );
+            ODBC_CALL( SQLFreeHandle, &free_params );
+        }
+        else if (entry->win32_handle)
+        {
+            if (entry->win32_funcs->SQLDisconnect) entry->win32_funcs->SQLDisconnect( entry->win32_handle );
+            if (entry->win32_funcs->SQLFreeHandle)
+                entry->win32_funcs->SQLFreeHandle( SQL_HANDLE_DBC, entry->win32_handle );
+            else if (entry->win32_funcs->SQLFreeConnect) entry->win32_funcs->SQLFreeConnect( entry->win32_handle );
+        }
+        free( entry );
+    }
+}
+
 static void init_object( struct object *obj, UINT32 type, struct object *parent )
 {
     obj->type = type;
@@ -1643,6 +1753,7 @@ static SQLRETURN disconnect_win32( struct connection *con )
 }
 
 static void cleanup_object( struct object *obj );
+static SQLRETURN free_handle( SQLSMALLINT type, struct object *obj );
 
 static void destroy_dependent_objects( struct connection *con )
 {
@@ -1672,6 +1783,23 @@ SQLRETURN WINAPI SQLDisconnect(SQLHDBC ConnectionHandle)
 
     if (!con) return SQL_INVALID_HANDLE;
 
+    if (connection_pooling != SQL_CP_OFF && con->pool_string &&
+        (con->hdr.unix_handle || con->hdr.win32_handle))
+    {
+        struct object *obj;
+
+        /* Statements don't survive pooling; drop them in the driver before parking. */
+        LIST_FOR_EACH_ENTRY( obj, &con->hdr.children, struct object, entry ) free_handle( obj->type, obj );
+        if (park_connection( con ))
+        {
+            TRACE( "parked connection for %s\n", debugstr_w(con->pool_string) );
+            destroy_dependent_objects( con );
+            TRACE("Returning %d\n", SQL_SUCCESS);
+            unlock_object( &con->hdr );
+            return SQL_SUCCESS;
+        }
+    }
+
     if (con->hdr.unix_handle)
     {
         ret = disconnect_unix( con );
@@ -2107,6 +2235,8 @@ SQLRETURN WINAPI SQLFreeConnect(SQLHDBC ConnectionHandle)
     {
         ret = free_handle( SQL_HANDLE_DBC, &con->hdr );
         con->hdr.closed = TRUE;
+
+        cleanup_object( &con->hdr );
     }
 
     TRACE("Returning %d\n", ret);
@@ -2130,6 +2260,7 @@ SQLRETURN WINAPI SQLFreeEnv(SQLHENV EnvironmentHandle)
     if (!list_empty( &env->hdr.children )) ret = SQL_ERROR;
     else
     {
+        drain_connection_pool( &env->hdr );
         ret = free_handle( SQL_HANDLE_ENV, &env->hdr );
 
         RegCloseKey( env->drivers_key );
@@ -2176,6 +2307,13 @@ static void cleanup_object( struct object *obj )
         env->drivers_idx = env->sources_idx = 0;
         break;
     }
+    case SQL_HANDLE_DBC:
+    {
+        struct connection *con = (struct connection *)obj;
+        free( con->pool_string );
+        con->pool_string = NULL;
+        break;
+    }
     case SQL_HANDLE_STMT:
     {
         struct statement *stmt = (struct statement *)obj;
@@ -2203,6 +2341,7 @@ SQLRETURN WINAPI SQLFreeHandle(SQLSMALLINT HandleType, SQLHANDLE Handle)
     if (!list_empty( &obj->children )) ret = SQL_ERROR;
     else
     {
+        if (HandleType == SQL_HANDLE_ENV) drain_connection_pool( obj );
         ret = free_handle( HandleType, obj );
         obj->closed = TRUE;
 
@@ -2887,7 +3026,7 @@ SQLRETURN WINAPI SQLGetEnvAttr(SQLHENV EnvironmentHandle, SQLINTEGER Attribute,
         switch (Attribute)
         {
         case SQL_ATTR_CONNECTION_POOLING:
-            *(SQLINTEGER *)Value = SQL_CP_OFF;
+            *(SQLINTEGER *)Value = connection_pooling;
             break;
 
         case SQL_ATTR_ODBC_VERSION:
@@ -3804,7 +3943,8 @@ SQLRETURN WINAPI SQLSetEnvAttr(SQLHENV EnvironmentHandle, SQLINTEGER Attribute,
 
     if (!env && Attribute == SQL_ATTR_CONNECTION_POOLING)
     {
-        FIXME("Ignoring SQL_ATTR_CONNECTION_POOLING attribute.\n");
+        connection_pooling = (SQLINTEGER)(ULONG_PTR)Value;
+        if (connection_pooling == SQL_CP_OFF) drain_connection_pool( NULL );
         return SQL_SUCCESS;
     }
 
@@ -3825,7 +3965,8 @@ SQLRETURN WINAPI SQLSetEnvAttr(SQLHENV EnvironmentHandle, SQLINTEGER Attribute,
             break;
 
         case SQL_ATTR_CONNECTION_POOLING:
-            FIXME("Ignore Pooling value\n");
+            connection_pooling = (SQLINTEGER)(ULONG_PTR)Value;
+            if (connection_pooling == SQL_CP_OFF) drain_connection_pool( NULL );
             break;
 
         default:
@@ -5681,6 +5822,23 @@ SQLRETURN WINAPI SQLDriverConnect(SQLHDBC ConnectionHandle, SQLHWND WindowHandle
     if (parse_connect_string( &attrs, strW ) || !(connect_string = build_connect_string( &attrs )) ||
         !(strA = (SQLCHAR *)strdupWA( connect_string ))) goto done;
 
+    if (connection_pooling != SQL_CP_OFF && unpark_connection( con, connect_string ))
+    {
+        TRACE( "reusing pooled connection for %s\n", debugstr_w(connect_string) );
+        if (OutConnectionString && BufferLength > 0)
+        {
+            int len = WideCharToMultiByte( CP_ACP, 0, connect_string, -1, (char *)OutConnectionString, BufferLength,
+                                           NULL, NULL );
+            if (Length2) *Length2 = len ? len - 1 : 0;
+        }
+        else if (Length2) *Length2 = strlen( (const char *)strA );
+
+        free( con->pool_string );
+        con->pool_string = wcsdup( connect_string );
+        ret = SQL_SUCCESS;
+        goto done;
+    }
+
     if (!(datasource = get_attribute( &attrs, L"DSN" )) && !(drivername = get_attribute( &attrs, L"DRIVER" )))
     {
         WARN( "can't find data source or driver name\n" );
@@ -5719,6 +5877,12 @@ SQLRETURN WINAPI SQLDriverConnect(SQLHDBC ConnectionHandle, SQLHWND WindowHandle
                                      DriverCompletion );
     }
 
+    if (SUCCESS( ret ))
+    {
+        free( con->pool_string );
+        con->pool_string = wcsdup( connect_string );
+    }
+
 done:
     free( strA );
     free( strW );
@@ -6886,6 +7050,22 @@ SQLRETURN WINAPI SQLDriverConnectW(SQLHDBC ConnectionHandle, SQLHWND WindowHandl
     if (parse_connect_string( &attrs, InConnectionString ) || !(connect_string = build_connect_string( &attrs )))
         goto done;
 
+    if (connection_pooling != SQL_CP_OFF && unpark_connection( con, connect_string ))
+    {
+        TRACE( "reusing pooled connection for %s\n", debugstr_w(connect_string) );
+        if (OutConnectionString && BufferLength > 0)
+        {
+            lstrcpynW( OutConnectionString, connect_string, BufferLength );
+            if (Length2) *Length2 = wcslen( OutConnectionString );
+        }
+        else if (Length2) *Length2 = wcslen( connect_string );
+
+        free( con->pool_string );
+        con->pool_string = wcsdup( connect_string );
+        ret = SQL_SUCCESS;
+        goto done;
+    }
+
     if (!(datasource = get_attribute( &attrs, L"DSN" )) && !(drivername = get_attribute( &attrs, L"DRIVER" )))
     {
         WARN( "can't find data source or driver name\n" );
@@ -6924,6 +7104,12 @@ SQLRETURN WINAPI SQLDriverConnectW(SQLHDBC ConnectionHandle, SQLHWND WindowHandl
                                      BufferLength, Length2, DriverCompletion );
     }
 
+    if (SUCCESS( ret ))
+    {
+        free( con->pool_string );
+        con->pool_string = wcsdup( connect_string );
+    }
+
 done:
     free( connect_string );
     free_attribute_list( &attrs );
@@ -8009,6 +8195,7 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD reason, LPVOID reserved)
         break;
 
     case DLL_PROCESS_DETACH:
+        if (!reserved) drain_connection_pool( NULL );
         if (__wine_unixlib_handle) WINE_UNIX_CALL( process_detach, NULL );
         if (reserved) break;
     }
@@ -213,6 +213,8 @@ struct connection
     /* attributes */
     UINT32 attr_con_timeout;
     UINT32 attr_login_timeout;
+    /* normalized connection string if the driver connection can be pooled */
+    WCHAR *pool_string;
 };
 
 struct statement
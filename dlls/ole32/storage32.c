@@ -7143,14 +7143,20 @@ static HRESULT BlockChainStream_UpdateIndexCache(BlockChainStream* This)
   return S_OK;
 }
 
-/* Locate the nth block in this stream. */
-static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG offset)
+/* Locate the nth block in this stream.  If contiguous is not NULL, it is set
+ * to the number of blocks from that one on that reside in consecutive sectors
+ * (including the block itself). */
+static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG offset,
+                                                ULONG *contiguous)
 {
   ULONG min_offset = 0, max_offset = This->numBlocks-1;
   ULONG min_run = 0, max_run = This->indexCacheLen-1;
 
   if (offset >= This->numBlocks)
+  {
+    if (contiguous) *contiguous = 0;
     return BLOCK_END_OF_CHAIN;
+  }
 
   while (min_run < max_run)
   {
@@ -7170,11 +7176,15 @@ static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG of
       min_run = max_run = run_to_check;
   }
 
+  if (contiguous)
+    *contiguous = This->indexCache[min_run].lastOffset - offset + 1;
+
   return This->indexCache[min_run].firstSector + offset - This->indexCache[min_run].firstOffset;
 }
 
 static HRESULT BlockChainStream_GetBlockAtOffset(BlockChainStream *This,
-    ULONG index, BlockChainBlock **block, ULONG *sector, BOOL create)
+    ULONG index, BlockChainBlock **block, ULONG *sector, BOOL create,
+    ULONG *contiguous)
 {
   BlockChainBlock *result=NULL;
   int i;
@@ -7187,10 +7197,21 @@ static HRESULT BlockChainStream_GetBlockAtOffset(BlockChainStream *This,
       return S_OK;
     }
 
-  *sector = BlockChainStream_GetSectorOfOffset(This, index);
+  *sector = BlockChainStream_GetSectorOfOffset(This, index, contiguous);
   if (*sector == BLOCK_END_OF_CHAIN)
     return STG_E_DOCFILECORRUPT;
 
+  if (contiguous)
+  {
+    /* Cap a multi-block transfer before the next cached block, whose
+     * contents may be newer than the file's. */
+    for (i=0; i<2; i++)
+      if (This->cachedBlocks[i].index != 0xffffffff &&
+          This->cachedBlocks[i].index > index &&
+          This->cachedBlocks[i].index - index < *contiguous)
+        *contiguous = This->cachedBlocks[i].index - index;
+  }
+
   if (create)
   {
     if (This->cachedBlocks[0].index == 0xffffffff)
@@ -7305,7 +7326,7 @@ static BOOL BlockChainStream_Shrink(BlockChainStream* This,
     /*
      * Go to the new end of chain
      */
-    blockIndex = BlockChainStream_GetSectorOfOffset(This, numBlocks-1);
+    blockIndex = BlockChainStream_GetSectorOfOffset(This, numBlocks-1, NULL);
 
     /* Mark the new end of chain */
     StorageImpl_SetNextBlockInChain(
@@ -7584,7 +7605,7 @@ HRESULT BlockChainStream_ReadAt(BlockChainStream* This,
   /*
    * Find the first block in the stream that contains part of the buffer.
    */
-  blockIndex = BlockChainStream_GetSectorOfOffset(This, blockNoInSequence);
+  blockIndex = BlockChainStream_GetSectorOfOffset(This, blockNoInSequence, NULL);
 
   *bytesRead   = 0;
 
@@ -7603,6 +7624,7 @@ HRESULT BlockChainStream_ReadAt(BlockChainStream* This,
   {
     ULARGE_INTEGER ulOffset;
     DWORD bytesReadAt;
+    ULONG contiguous;
 
     /*
      * Calculate how many bytes we can copy from this big block.
@@ -7610,14 +7632,21 @@ HRESULT BlockChainStream_ReadAt(BlockChainStream* This,
     bytesToReadInBuffer =
       min(This->parentStorage->bigBlockSize - offsetInBlock, size);
 
-    hr = BlockChainStream_GetBlockAtOffset(This, blockNoInSequence, &cachedBlock, &blockIndex, size == bytesToReadInBuffer);
+    hr = BlockChainStream_GetBlockAtOffset(This, blockNoInSequence, &cachedBlock, &blockIndex,
+                                           size == bytesToReadInBuffer, &contiguous);
 
     if (FAILED(hr))
       return hr;
 
     if (!cachedBlock)
     {
-      /* Not in cache, and we're going to read past the end of the block. */
+      /* Not in cache, and we're going to read past the end of the block.
+       * The chain is normally laid out sequentially in the file, so read
+       * across as many contiguous sectors as possible in one call. */
+      if (contiguous > 1)
+        bytesToReadInBuffer =
+          min(size, (ULONGLONG)contiguous * This->parentStorage->bigBlockSize - offsetInBlock);
+
       ulOffset.QuadPart = StorageImpl_GetBigBlockOffset(This->parentStorage, blockIndex) +
                                offsetInBlock;
 
@@ -7642,7 +7671,7 @@ HRESULT BlockChainStream_ReadAt(BlockChainStream* This,
       bytesReadAt = bytesToReadInBuffer;
     }
 
-    blockNoInSequence++;
+    blockNoInSequence += (offsetInBlock + bytesReadAt) / This->parentStorage->bigBlockSize;
     bufferWalker += bytesReadAt;
     size         -= bytesReadAt;
     *bytesRead   += bytesReadAt;
@@ -7682,6 +7711,7 @@ HRESULT BlockChainStream_WriteAt(BlockChainStream* This,
   {
     ULARGE_INTEGER ulOffset;
     DWORD bytesWrittenAt;
+    ULONG contiguous;
 
     /*
      * Calculate how many bytes we can copy to this big block.
@@ -7689,7 +7719,8 @@ HRESULT BlockChainStream_WriteAt(BlockChainStream* This,
     bytesToWrite =
       min(This->parentStorage->bigBlockSize - offsetInBlock, size);
 
-    hr = BlockChainStream_GetBlockAtOffset(This, blockNoInSequence, &cachedBlock, &blockIndex, size == bytesToWrite);
+    hr = BlockChainStream_GetBlockAtOffset(This, blockNoInSequence, &cachedBlock, &blockIndex,
+                                           size == bytesToWrite, &contiguous);
 
     /* BlockChainStream_SetSize should have already been called to ensure we have
      * enough blocks in the chain to write into */
@@ -7701,7 +7732,12 @@ HRESULT BlockChainStream_WriteAt(BlockChainStream* This,
 
     if (!cachedBlock)
     {
-      /* Not in cache, and we're going to write past the end of the block. */
+      /* Not in cache, and we're going to write past the end of the block.
+       * Write across as many contiguous sectors as possible in one call. */
+      if (contiguous > 1)
+        bytesToWrite =
+          min(size, (ULONGLONG)contiguous * This->parentStorage->bigBlockSize - offsetInBlock);
+
       ulOffset.QuadPart = StorageImpl_GetBigBlockOffset(This->parentStorage, blockIndex) +
                                offsetInBlock;
 
@@ -7726,7 +7762,7 @@ HRESULT BlockChainStream_WriteAt(BlockChainStream* This,
       cachedBlock->dirty = TRUE;
     }
 
-    blockNoInSequence++;
+    blockNoInSequence += (offsetInBlock + bytesWrittenAt) / This->parentStorage->bigBlockSize;
     bufferWalker  += bytesWrittenAt;
     size          -= bytesWrittenAt;
     *bytesWritten += bytesWrittenAt;
@@ -1238,6 +1238,10 @@ typedef struct tagITypeInfoImpl
     /* Implemented Interfaces  */
     TLBImplType *impltypes;
 
+    /* lazily built member name lookup table, see TLB_build_namehash() */
+    UINT *namehash;
+    UINT namehash_size;
+
     struct list *pcustdata_list;
     struct list custdata_list;
 } ITypeInfoImpl;
@@ -1692,9 +1696,152 @@ static inline TLBVarDesc *TLB_get_vardesc_by_memberid(ITypeInfoImpl *typeinfo, M
     return NULL;
 }
 
-static inline TLBVarDesc *TLB_get_vardesc_by_name(ITypeInfoImpl *typeinfo, const OLECHAR *name)
+/* The member name lookup table is built lazily on the first name lookup.  It
+ * is open addressed; an entry holds 1 + the function index, or 1 + cFuncs +
+ * the variable index, keeping only the first of several functions sharing a
+ * name.  Hashing has to agree with the lstrcmpiW() comparisons, so only
+ * ASCII names are hashed; a typeinfo with other names keeps the linear
+ * lookup. */
+
+static const TLBString *TLB_get_member_name(ITypeInfoImpl *typeinfo, UINT member)
 {
-    int i;
+    if (member < typeinfo->typeattr.cFuncs)
+        return typeinfo->funcdescs[member].Name;
+    return typeinfo->vardescs[member - typeinfo->typeattr.cFuncs].Name;
+}
+
+static UINT TLB_namehash(const OLECHAR *name, BOOL *hashable)
+{
+    UINT hash = 5381;
+    OLECHAR c;
+
+    while ((c = *name++))
+    {
+        if (c >= 0x80)
+        {
+            *hashable = FALSE;
+            return 0;
+        }
+        if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+        hash = hash * 33 ^ c;
+    }
+    *hashable = TRUE;
+    return hash;
+}
+
+static CRITICAL_SECTION cache_section;
+
+static BOOL TLB_build_namehash(ITypeInfoImpl *typeinfo)
+{
+    UINT total = typeinfo->typeattr.cFuncs + typeinfo->typeattr.cVars;
+    UINT i, pos, size = 16, *table;
+    BOOL hashable;
+
+    if (typeinfo->namehash) return TRUE;
+
+    EnterCriticalSection(&cache_section);
+    if (typeinfo->namehash_size)
+    {
+        /* built by another thread in the meantime, or not hashable */
+        BOOL ret = typeinfo->namehash != NULL;
+        LeaveCriticalSection(&cache_section);
+        return ret;
+    }
+
+    while (size < 2 * total) size *= 2;
+
+    if (!(table = calloc(size, sizeof(*table))))
+    {
+        LeaveCriticalSection(&cache_section);
+        return FALSE; /* try again on the next lookup */
+    }
+
+    for (i = 0; i < total; ++i)
+    {
+        const OLECHAR *name = TLB_get_bstr(TLB_get_member_name(typeinfo, i));
+        BOOL is_var = i >= typeinfo->typeattr.cFuncs;
+        UINT hash, other;
+
+        if (!name) continue;
+        hash = TLB_namehash(name, &hashable);
+        if (!hashable)
+        {
+            free(table);
+            typeinfo->namehash_size = 1; /* keep the linear lookup */
+            LeaveCriticalSection(&cache_section);
+            return FALSE;
+        }
+        for (pos = hash & (size - 1); table[pos]; pos = (pos + 1) & (size - 1))
+        {
+            other = table[pos] - 1;
+            if ((other >= typeinfo->typeattr.cFuncs) == is_var &&
+                !lstrcmpiW(TLB_get_bstr(TLB_get_member_name(typeinfo, other)), name))
+                break;
+        }
+        /* keep the first member of each kind with this name */
+        if (!table[pos]) table[pos] = i + 1;
+    }
+
+    typeinfo->namehash_size = size;
+    typeinfo->namehash = table;
+    LeaveCriticalSection(&cache_section);
+    return TRUE;
+}
+
+/* returns the function index or cFuncs + the variable index, -1 when the name
+ * is not present, or -2 when no lookup table is available */
+static int TLB_namehash_find(ITypeInfoImpl *typeinfo, const OLECHAR *name, BOOL want_var)
+{
+    UINT hash, pos, i;
+    BOOL hashable;
+
+    hash = TLB_namehash(name, &hashable);
+    if (!hashable || !TLB_build_namehash(typeinfo)) return -2;
+
+    for (pos = hash & (typeinfo->namehash_size - 1); typeinfo->namehash[pos];
+         pos = (pos + 1) & (typeinfo->namehash_size - 1))
+    {
+        i = typeinfo->namehash[pos] - 1;
+        if ((i >= typeinfo->typeattr.cFuncs) == want_var &&
+            !lstrcmpiW(TLB_get_bstr(TLB_get_member_name(typeinfo, i)), name))
+            return i;
+    }
+    return -1;
+}
+
+static void TLB_free_namehash(ITypeInfoImpl *typeinfo)
+{
+    free(typeinfo->namehash);
+    typeinfo->namehash = NULL;
+    typeinfo->namehash_size = 0;
+}
+
+static TLBFuncDesc *TLB_get_funcdesc_by_name(ITypeInfoImpl *typeinfo, const OLECHAR *name)
+{
+    int i = TLB_namehash_find(typeinfo, name, FALSE);
+
+    if (i >= 0)
+        return &typeinfo->funcdescs[i];
+    if (i == -1)
+        return NULL;
+
+    for (i = 0; i < typeinfo->typeattr.cFuncs; ++i)
+    {
+        if (!lstrcmpiW(TLB_get_bstr(typeinfo->funcdescs[i].Name), name))
+            return &typeinfo->funcdescs[i];
+    }
+
+    return NULL;
+}
+
+static TLBVarDesc *TLB_get_vardesc_by_name(ITypeInfoImpl *typeinfo, const OLECHAR *name)
+{
+    int i = TLB_namehash_find(typeinfo, name, TRUE);
+
+    if (i >= 0)
+        return &typeinfo->vardescs[i - typeinfo->typeattr.cFuncs];
+    if (i == -1)
+        return NULL;
 
     for (i = 0; i < typeinfo->typeattr.cVars; ++i)
     {
@@ -5702,6 +5849,7 @@ static void ITypeInfoImpl_Destroy(ITypeInfoImpl *This)
     }
 
     TLB_FreeCustData(&This->custdata_list);
+    TLB_free_namehash(This);
 
     free(This);
 }
@@ -5718,7 +5866,10 @@ static ULONG WINAPI ITypeInfo_fnRelease(ITypeInfo2 *iface)
         BOOL not_attached_to_typelib = This->not_attached_to_typelib;
         ITypeLib2_Release(&This->pTypeLib->ITypeLib2_iface);
         if (not_attached_to_typelib)
+        {
+            TLB_free_namehash(This);
             free(This);
+        }
         /* otherwise This will be freed when typelib is freed */
     }
 
@@ -6332,9 +6483,10 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
         LPOLESTR  *rgszNames, UINT cNames, MEMBERID  *pMemId)
 {
     ITypeInfoImpl *This = impl_from_ITypeInfo2(iface);
+    const TLBFuncDesc *pFDesc;
     const TLBVarDesc *pVDesc;
     HRESULT ret=S_OK;
-    UINT i, fdc;
+    UINT i;
 
     TRACE("%p, %s, %d.\n", iface, debugstr_w(*rgszNames), cNames);
 
@@ -6342,23 +6494,21 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
     for (i = 0; i < cNames; i++)
         pMemId[i] = MEMBERID_NIL;
 
-    for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc) {
+    pFDesc = TLB_get_funcdesc_by_name(This, *rgszNames);
+    if(pFDesc) {
         int j;
-        const TLBFuncDesc *pFDesc = &This->funcdescs[fdc];
-        if(!lstrcmpiW(*rgszNames, TLB_get_bstr(pFDesc->Name))) {
-            if(cNames) *pMemId=pFDesc->funcdesc.memid;
-            for(i=1; i < cNames; i++){
-                for(j=0; j<pFDesc->funcdesc.cParams; j++)
-                    if(!lstrcmpiW(rgszNames[i],TLB_get_bstr(pFDesc->pParamDesc[j].Name)))
-                            break;
-                if( j<pFDesc->funcdesc.cParams)
-                    pMemId[i]=j;
-                else
-                   ret=DISP_E_UNKNOWNNAME;
-            };
-            TRACE("-- %#lx.\n", ret);
-            return ret;
-        }
+        if(cNames) *pMemId=pFDesc->funcdesc.memid;
+        for(i=1; i < cNames; i++){
+            for(j=0; j<pFDesc->funcdesc.cParams; j++)
+                if(!lstrcmpiW(rgszNames[i],TLB_get_bstr(pFDesc->pParamDesc[j].Name)))
+                        break;
+            if( j<pFDesc->funcdesc.cParams)
+                pMemId[i]=j;
+            else
+               ret=DISP_E_UNKNOWNNAME;
+        };
+        TRACE("-- %#lx.\n", ret);
+        return ret;
     }
     pVDesc = TLB_get_vardesc_by_name(This, *rgszNames);
     if(pVDesc){
@@ -7844,6 +7994,9 @@ static HRESULT WINAPI ITypeInfo_fnGetRefTypeInfo(
         *pTypeInfoImpl = *This;
         pTypeInfoImpl->ref = 0;
         list_init(&pTypeInfoImpl->custdata_list);
+        /* the name table stays owned by the original typeinfo */
+        pTypeInfoImpl->namehash = NULL;
+        pTypeInfoImpl->namehash_size = 0;
 
         if (This->typeattr.typekind == TKIND_INTERFACE)
             pTypeInfoImpl->typeattr.typekind = TKIND_DISPATCH;
@@ -10729,6 +10882,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnAddFuncDesc(ICreateTypeInfo2 *iface,
 
     ++This->typeattr.cFuncs;
 
+    TLB_free_namehash(This);
     This->needs_layout = TRUE;
 
     return S_OK;
@@ -10888,6 +11042,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnAddVarDesc(ICreateTypeInfo2 *iface,
 
     ++This->typeattr.cVars;
 
+    TLB_free_namehash(This);
     This->needs_layout = TRUE;
 
     return S_OK;
@@ -10927,6 +11082,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnSetFuncAndParamNames(ICreateTypeInfo2 *
     }
 
     func_desc->Name = TLB_append_str(&This->pTypeLib->name_list, *names);
+    TLB_free_namehash(This);
 
     for (i = 1; i < numNames; ++i) {
         TLBParDesc *par_desc = func_desc->pParamDesc + i - 1;
@@ -10950,6 +11106,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnSetVarName(ICreateTypeInfo2 *iface,
         return TYPE_E_ELEMENTNOTFOUND;
 
     This->vardescs[index].Name = TLB_append_str(&This->pTypeLib->name_list, name);
+    TLB_free_namehash(This);
     return S_OK;
 }
 
@@ -11235,6 +11392,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnDeleteFuncDesc(ICreateTypeInfo2 *iface,
             TLB_relink_custdata(&This->funcdescs[i].custdata_list);
     }
 
+    TLB_free_namehash(This);
     This->needs_layout = TRUE;
 
     return S_OK;
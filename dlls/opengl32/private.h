@@ -30,6 +30,8 @@
 
 extern const void *extension_procs[];
 
+extern void flush_gl_batch(void);
+
 extern int WINAPI wglDescribePixelFormat( HDC hdc, int ipfd, UINT cjpfd, PIXELFORMATDESCRIPTOR *ppfd );
 
 #endif /* __WINE_OPENGL32_PRIVATE_H */
@@ -19725,14 +19725,6 @@ static void WINAPI glUniform1dv( GLint location, GLsizei count, const GLdouble *
     if ((status = UNIX_CALL( glUniform1dv, &args ))) WARN( "glUniform1dv returned %#lx\n", status );
 }
 
-static void WINAPI glUniform1f( GLint location, GLfloat v0 )
-{
-    struct glUniform1f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %f\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1f, &args ))) WARN( "glUniform1f returned %#lx\n", status );
-}
-
 static void WINAPI glUniform1fARB( GLint location, GLfloat v0 )
 {
     struct glUniform1fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
@@ -19757,14 +19749,6 @@ static void WINAPI glUniform1fvARB( GLint location, GLsizei count, const GLfloat
     if ((status = UNIX_CALL( glUniform1fvARB, &args ))) WARN( "glUniform1fvARB returned %#lx\n", status );
 }
 
-static void WINAPI glUniform1i( GLint location, GLint v0 )
-{
-    struct glUniform1i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1i, &args ))) WARN( "glUniform1i returned %#lx\n", status );
-}
-
 static void WINAPI glUniform1i64ARB( GLint location, GLint64 x )
 {
     struct glUniform1i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
@@ -19901,14 +19885,6 @@ static void WINAPI glUniform2dv( GLint location, GLsizei count, const GLdouble *
     if ((status = UNIX_CALL( glUniform2dv, &args ))) WARN( "glUniform2dv returned %#lx\n", status );
 }
 
-static void WINAPI glUniform2f( GLint location, GLfloat v0, GLfloat v1 )
-{
-    struct glUniform2f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %f, v1 %f\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2f, &args ))) WARN( "glUniform2f returned %#lx\n", status );
-}
-
 static void WINAPI glUniform2fARB( GLint location, GLfloat v0, GLfloat v1 )
 {
     struct glUniform2fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
@@ -19933,14 +19909,6 @@ static void WINAPI glUniform2fvARB( GLint location, GLsizei count, const GLfloat
     if ((status = UNIX_CALL( glUniform2fvARB, &args ))) WARN( "glUniform2fvARB returned %#lx\n", status );
 }
 
-static void WINAPI glUniform2i( GLint location, GLint v0, GLint v1 )
-{
-    struct glUniform2i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2i, &args ))) WARN( "glUniform2i returned %#lx\n", status );
-}
-
 static void WINAPI glUniform2i64ARB( GLint location, GLint64 x, GLint64 y )
 {
     struct glUniform2i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
@@ -20077,14 +20045,6 @@ static void WINAPI glUniform3dv( GLint location, GLsizei count, const GLdouble *
     if ((status = UNIX_CALL( glUniform3dv, &args ))) WARN( "glUniform3dv returned %#lx\n", status );
 }
 
-static void WINAPI glUniform3f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
-{
-    struct glUniform3f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %f, v1 %f, v2 %f\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3f, &args ))) WARN( "glUniform3f returned %#lx\n", status );
-}
-
 static void WINAPI glUniform3fARB( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
 {
     struct glUniform3fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
@@ -20109,14 +20069,6 @@ static void WINAPI glUniform3fvARB( GLint location, GLsizei count, const GLfloat
     if ((status = UNIX_CALL( glUniform3fvARB, &args ))) WARN( "glUniform3fvARB returned %#lx\n", status );
 }
 
-static void WINAPI glUniform3i( GLint location, GLint v0, GLint v1, GLint v2 )
-{
-    struct glUniform3i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3i, &args ))) WARN( "glUniform3i returned %#lx\n", status );
-}
-
 static void WINAPI glUniform3i64ARB( GLint location, GLint64 x, GLint64 y, GLint64 z )
 {
     struct glUniform3i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
@@ -20253,14 +20205,6 @@ static void WINAPI glUniform4dv( GLint location, GLsizei count, const GLdouble *
     if ((status = UNIX_CALL( glUniform4dv, &args ))) WARN( "glUniform4dv returned %#lx\n", status );
 }
 
-static void WINAPI glUniform4f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
-{
-    struct glUniform4f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4f, &args ))) WARN( "glUniform4f returned %#lx\n", status );
-}
-
 static void WINAPI glUniform4fARB( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
 {
     struct glUniform4fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
@@ -20285,14 +20229,6 @@ static void WINAPI glUniform4fvARB( GLint location, GLsizei count, const GLfloat
     if ((status = UNIX_CALL( glUniform4fvARB, &args ))) WARN( "glUniform4fvARB returned %#lx\n", status );
 }
 
-static void WINAPI glUniform4i( GLint location, GLint v0, GLint v1, GLint v2, GLint v3 )
-{
-    struct glUniform4i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
-    NTSTATUS status;
-    TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4i, &args ))) WARN( "glUniform4i returned %#lx\n", status );
-}
-
 static void WINAPI glUniform4i64ARB( GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w )
 {
     struct glUniform4i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
@@ -21353,14 +21289,6 @@ static void WINAPI glVertexAttrib1dvNV( GLuint index, const GLdouble *v )
     if ((status = UNIX_CALL( glVertexAttrib1dvNV, &args ))) WARN( "glVertexAttrib1dvNV returned %#lx\n", status );
 }
 
-static void WINAPI glVertexAttrib1f( GLuint index, GLfloat x )
-{
-    struct glVertexAttrib1f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
-    NTSTATUS status;
-    TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1f, &args ))) WARN( "glVertexAttrib1f returned %#lx\n", status );
-}
-
 static void WINAPI glVertexAttrib1fARB( GLuint index, GLfloat x )
 {
     struct glVertexAttrib1fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
@@ -21513,14 +21441,6 @@ static void WINAPI glVertexAttrib2dvNV( GLuint index, const GLdouble *v )
     if ((status = UNIX_CALL( glVertexAttrib2dvNV, &args ))) WARN( "glVertexAttrib2dvNV returned %#lx\n", status );
 }
 
-static void WINAPI glVertexAttrib2f( GLuint index, GLfloat x, GLfloat y )
-{
-    struct glVertexAttrib2f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
-    NTSTATUS status;
-    TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2f, &args ))) WARN( "glVertexAttrib2f returned %#lx\n", status );
-}
-
 static void WINAPI glVertexAttrib2fARB( GLuint index, GLfloat x, GLfloat y )
 {
     struct glVertexAttrib2fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
@@ -21673,14 +21593,6 @@ static void WINAPI glVertexAttrib3dvNV( GLuint index, const GLdouble *v )
     if ((status = UNIX_CALL( glVertexAttrib3dvNV, &args ))) WARN( "glVertexAttrib3dvNV returned %#lx\n", status );
 }
 
-static void WINAPI glVertexAttrib3f( GLuint index, GLfloat x, GLfloat y, GLfloat z )
-{
-    struct glVertexAttrib3f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
-    NTSTATUS status;
-    TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3f, &args ))) WARN( "glVertexAttrib3f returned %#lx\n", status );
-}
-
 static void WINAPI glVertexAttrib3fARB( GLuint index, GLfloat x, GLfloat y, GLfloat z )
 {
     struct glVertexAttrib3fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
@@ -21961,14 +21873,6 @@ static void WINAPI glVertexAttrib4dvNV( GLuint index, const GLdouble *v )
     if ((status = UNIX_CALL( glVertexAttrib4dvNV, &args ))) WARN( "glVertexAttrib4dvNV returned %#lx\n", status );
 }
 
-static void WINAPI glVertexAttrib4f( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
-{
-    struct glVertexAttrib4f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
-    NTSTATUS status;
-    TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4f, &args ))) WARN( "glVertexAttrib4f returned %#lx\n", status );
-}
-
 static void WINAPI glVertexAttrib4fARB( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
     struct glVertexAttrib4fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
@@ -24306,10 +24210,22 @@ extern void * WINAPI glMapNamedBuffer( GLuint buffer, GLenum access );
 extern void * WINAPI glMapNamedBufferEXT( GLuint buffer, GLenum access );
 extern void * WINAPI glMapNamedBufferRange( GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access );
 extern void * WINAPI glMapNamedBufferRangeEXT( GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access );
+extern void WINAPI glUniform1f( GLint location, GLfloat v0 );
+extern void WINAPI glUniform1i( GLint location, GLint v0 );
+extern void WINAPI glUniform2f( GLint location, GLfloat v0, GLfloat v1 );
+extern void WINAPI glUniform2i( GLint location, GLint v0, GLint v1 );
+extern void WINAPI glUniform3f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 );
+extern void WINAPI glUniform3i( GLint location, GLint v0, GLint v1, GLint v2 );
+extern void WINAPI glUniform4f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 );
+extern void WINAPI glUniform4i( GLint location, GLint v0, GLint v1, GLint v2, GLint v3 );
 extern GLboolean WINAPI glUnmapBuffer( GLenum target );
 extern GLboolean WINAPI glUnmapBufferARB( GLenum target );
 extern GLboolean WINAPI glUnmapNamedBuffer( GLuint buffer );
 extern GLboolean WINAPI glUnmapNamedBufferEXT( GLuint buffer );
+extern void WINAPI glVertexAttrib1f( GLuint index, GLfloat x );
+extern void WINAPI glVertexAttrib2f( GLuint index, GLfloat x, GLfloat y );
+extern void WINAPI glVertexAttrib3f( GLuint index, GLfloat x, GLfloat y, GLfloat z );
+extern void WINAPI glVertexAttrib4f( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w );
 extern BOOL WINAPI wglChoosePixelFormatARB( HDC hdc, const int *piAttribIList, const FLOAT *pfAttribFList, UINT nMaxFormats, int *piFormats, UINT *nNumFormats );
 extern HDC WINAPI wglGetCurrentReadDCARB(void);
 extern const char * WINAPI wglGetExtensionsStringARB( HDC hdc );
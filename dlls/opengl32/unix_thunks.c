@@ -26860,6 +26860,7 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     thread_attach,
     process_detach,
     get_pixel_formats,
+    gl_batch_execute,
     wgl_wglCopyContext,
     wgl_wglCreateContext,
     wgl_wglDeleteContext,
@@ -29910,6 +29911,7 @@ typedef ULONG PTR32;
 extern NTSTATUS wow64_thread_attach( void *args );
 extern NTSTATUS wow64_process_detach( void *args );
 extern NTSTATUS wow64_get_pixel_formats( void *args );
+extern NTSTATUS wow64_gl_batch_execute( void *args );
 
 static NTSTATUS wow64_wgl_wglCopyContext( void *args )
 {
@@ -94959,6 +94961,7 @@ const unixlib_entry_t __wine_unix_call_wow64_funcs[] =
     wow64_thread_attach,
     wow64_process_detach,
     wow64_get_pixel_formats,
+    wow64_gl_batch_execute,
     wow64_wgl_wglCopyContext,
     wow64_wgl_wglCreateContext,
     wow64_wgl_wglDeleteContext,
@@ -1303,6 +1303,61 @@ NTSTATUS get_pixel_formats( void *args )
     return STATUS_SUCCESS;
 }
 
+NTSTATUS gl_batch_execute( void *args )
+{
+    struct gl_batch_execute_params *params = args;
+    const struct opengl_funcs *funcs = params->teb->glTable;
+    const struct gl_batch_entry *entry = params->entries;
+    UINT32 i;
+
+    for (i = 0; i < params->count; i++, entry++)
+    {
+        switch (entry->cmd)
+        {
+        case gl_batch_cmd_glUniform1f:
+            funcs->p_glUniform1f( entry->args[0].i, entry->args[1].f );
+            break;
+        case gl_batch_cmd_glUniform1i:
+            funcs->p_glUniform1i( entry->args[0].i, entry->args[1].i );
+            break;
+        case gl_batch_cmd_glUniform2f:
+            funcs->p_glUniform2f( entry->args[0].i, entry->args[1].f, entry->args[2].f );
+            break;
+        case gl_batch_cmd_glUniform2i:
+            funcs->p_glUniform2i( entry->args[0].i, entry->args[1].i, entry->args[2].i );
+            break;
+        case gl_batch_cmd_glUniform3f:
+            funcs->p_glUniform3f( entry->args[0].i, entry->args[1].f, entry->args[2].f, entry->args[3].f );
+            break;
+        case gl_batch_cmd_glUniform3i:
+            funcs->p_glUniform3i( entry->args[0].i, entry->args[1].i, entry->args[2].i, entry->args[3].i );
+            break;
+        case gl_batch_cmd_glUniform4f:
+            funcs->p_glUniform4f( entry->args[0].i, entry->args[1].f, entry->args[2].f, entry->args[3].f, entry->args[4].f );
+            break;
+        case gl_batch_cmd_glUniform4i:
+            funcs->p_glUniform4i( entry->args[0].i, entry->args[1].i, entry->args[2].i, entry->args[3].i, entry->args[4].i );
+            break;
+        case gl_batch_cmd_glVertexAttrib1f:
+            funcs->p_glVertexAttrib1f( entry->args[0].u, entry->args[1].f );
+            break;
+        case gl_batch_cmd_glVertexAttrib2f:
+            funcs->p_glVertexAttrib2f( entry->args[0].u, entry->args[1].f, entry->args[2].f );
+            break;
+        case gl_batch_cmd_glVertexAttrib3f:
+            funcs->p_glVertexAttrib3f( entry->args[0].u, entry->args[1].f, entry->args[2].f, entry->args[3].f );
+            break;
+        case gl_batch_cmd_glVertexAttrib4f:
+            funcs->p_glVertexAttrib4f( entry->args[0].u, entry->args[1].f, entry->args[2].f, entry->args[3].f, entry->args[4].f );
+            break;
+        default:
+            return STATUS_INVALID_PARAMETER;
+        }
+    }
+    if (params->count) set_context_attribute( params->teb, -1 /* unsupported */, NULL, 0 );
+    return STATUS_SUCCESS;
+}
+
 #ifdef _WIN64
 
 typedef ULONG PTR32;
@@ -2410,4 +2465,21 @@ NTSTATUS wow64_get_pixel_formats( void *args )
     return status;
 }
 
+NTSTATUS wow64_gl_batch_execute( void *args )
+{
+    struct
+    {
+        PTR32 teb;
+        PTR32 entries;
+        UINT32 count;
+    } *params32 = args;
+    struct gl_batch_execute_params params =
+    {
+        .teb = get_teb64(params32->teb),
+        .entries = ULongToPtr(params32->entries),
+        .count = params32->count,
+    };
+    return gl_batch_execute( &params );
+}
+
 #endif
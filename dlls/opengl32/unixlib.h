@@ -25337,12 +25337,44 @@ struct get_pixel_formats_params
     unsigned int num_onscreen_formats;
 };
 
+enum gl_batch_cmd
+{
+    gl_batch_cmd_glUniform1f,
+    gl_batch_cmd_glUniform1i,
+    gl_batch_cmd_glUniform2f,
+    gl_batch_cmd_glUniform2i,
+    gl_batch_cmd_glUniform3f,
+    gl_batch_cmd_glUniform3i,
+    gl_batch_cmd_glUniform4f,
+    gl_batch_cmd_glUniform4i,
+    gl_batch_cmd_glVertexAttrib1f,
+    gl_batch_cmd_glVertexAttrib2f,
+    gl_batch_cmd_glVertexAttrib3f,
+    gl_batch_cmd_glVertexAttrib4f,
+};
+
+struct gl_batch_entry
+{
+    UINT32 cmd; /* enum gl_batch_cmd */
+    union { INT32 i; UINT32 u; float f; } args[5];
+};
+
+#define GL_BATCH_MAX_ENTRIES 256
+
+struct gl_batch_execute_params
+{
+    TEB *teb;
+    const struct gl_batch_entry *entries;
+    UINT32 count;
+};
+
 enum unix_funcs
 {
     unix_process_attach,
     unix_thread_attach,
     unix_process_detach,
     unix_get_pixel_formats,
+    unix_gl_batch_execute,
     unix_wglCopyContext,
     unix_wglCreateContext,
     unix_wglDeleteContext,
@@ -28398,6 +28430,6 @@ struct gl_debug_message_callback_params
     char message[1];
 };
 
-#define UNIX_CALL( func, params ) WINE_UNIX_CALL( unix_ ## func, params )
+#define UNIX_CALL( func, params ) (flush_gl_batch(), WINE_UNIX_CALL( unix_ ## func, params ))
 
 #endif /* __WINE_OPENGL32_UNIXLIB_H */
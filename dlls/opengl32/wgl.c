@@ -48,6 +48,13 @@ static const MAT2 identity = { {0,1},{0,0},{0,0},{0,1} };
 #define WINE_GL_RESERVED_FORMATS_PTR      3
 #define WINE_GL_RESERVED_FORMATS_NUM      4
 #define WINE_GL_RESERVED_FORMATS_ONSCREEN 5
+#define WINE_GL_RESERVED_BATCH_PTR        6
+
+struct gl_batch
+{
+    UINT32 count;
+    struct gl_batch_entry entries[GL_BATCH_MAX_ENTRIES];
+};
 
 #ifndef _WIN64
 
@@ -309,6 +316,240 @@ INT WINAPI wglChoosePixelFormat(HDC hdc, const PIXELFORMATDESCRIPTOR* ppfd)
     return best_format;
 }
 
+/* Flush GL calls recorded by get_gl_batch_entry() to the unix side. Invoked
+ * through UNIX_CALL before every other unix call to preserve ordering. */
+void flush_gl_batch(void)
+{
+    struct gl_batch *batch = NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_BATCH_PTR];
+    struct gl_batch_execute_params args = { .teb = NtCurrentTeb() };
+    NTSTATUS status;
+
+    if (!batch || !batch->count) return;
+    args.entries = batch->entries;
+    args.count = batch->count;
+    batch->count = 0;
+    if ((status = WINE_UNIX_CALL( unix_gl_batch_execute, &args )))
+        WARN( "gl_batch_execute returned %#lx\n", status );
+}
+
+/* Reserve a batch entry recording a deferred GL call, flushing first if the
+ * batch is full. Returns NULL if no batch could be allocated; the caller then
+ * makes the unix call directly. */
+static struct gl_batch_entry *get_gl_batch_entry( UINT32 cmd )
+{
+    TEB *teb = NtCurrentTeb();
+    struct gl_batch *batch = teb->glReserved1[WINE_GL_RESERVED_BATCH_PTR];
+    struct gl_batch_entry *entry;
+
+    if (!batch)
+    {
+        if (!(batch = calloc( 1, sizeof(*batch) ))) return NULL;
+        teb->glReserved1[WINE_GL_RESERVED_BATCH_PTR] = batch;
+    }
+    if (batch->count == GL_BATCH_MAX_ENTRIES) flush_gl_batch();
+    entry = &batch->entries[batch->count++];
+    entry->cmd = cmd;
+    return entry;
+}
+
+void WINAPI glUniform1f( GLint location, GLfloat v0 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %f\n", location, v0 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform1f )))
+    {
+        struct glUniform1f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform1f, &args ))) WARN( "glUniform1f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].f = v0;
+}
+
+void WINAPI glUniform1i( GLint location, GLint v0 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %d\n", location, v0 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform1i )))
+    {
+        struct glUniform1i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform1i, &args ))) WARN( "glUniform1i returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].i = v0;
+}
+
+void WINAPI glUniform2f( GLint location, GLfloat v0, GLfloat v1 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %f, v1 %f\n", location, v0, v1 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform2f )))
+    {
+        struct glUniform2f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform2f, &args ))) WARN( "glUniform2f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].f = v0;
+    entry->args[2].f = v1;
+}
+
+void WINAPI glUniform2i( GLint location, GLint v0, GLint v1 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform2i )))
+    {
+        struct glUniform2i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform2i, &args ))) WARN( "glUniform2i returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].i = v0;
+    entry->args[2].i = v1;
+}
+
+void WINAPI glUniform3f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %f, v1 %f, v2 %f\n", location, v0, v1, v2 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform3f )))
+    {
+        struct glUniform3f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform3f, &args ))) WARN( "glUniform3f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].f = v0;
+    entry->args[2].f = v1;
+    entry->args[3].f = v2;
+}
+
+void WINAPI glUniform3i( GLint location, GLint v0, GLint v1, GLint v2 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform3i )))
+    {
+        struct glUniform3i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform3i, &args ))) WARN( "glUniform3i returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].i = v0;
+    entry->args[2].i = v1;
+    entry->args[3].i = v2;
+}
+
+void WINAPI glUniform4f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", location, v0, v1, v2, v3 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform4f )))
+    {
+        struct glUniform4f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform4f, &args ))) WARN( "glUniform4f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].f = v0;
+    entry->args[2].f = v1;
+    entry->args[3].f = v2;
+    entry->args[4].f = v3;
+}
+
+void WINAPI glUniform4i( GLint location, GLint v0, GLint v1, GLint v2, GLint v3 )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glUniform4i )))
+    {
+        struct glUniform4i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glUniform4i, &args ))) WARN( "glUniform4i returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].i = location;
+    entry->args[1].i = v0;
+    entry->args[2].i = v1;
+    entry->args[3].i = v2;
+    entry->args[4].i = v3;
+}
+
+void WINAPI glVertexAttrib1f( GLuint index, GLfloat x )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "index %d, x %f\n", index, x );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glVertexAttrib1f )))
+    {
+        struct glVertexAttrib1f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glVertexAttrib1f, &args ))) WARN( "glVertexAttrib1f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].u = index;
+    entry->args[1].f = x;
+}
+
+void WINAPI glVertexAttrib2f( GLuint index, GLfloat x, GLfloat y )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "index %d, x %f, y %f\n", index, x, y );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glVertexAttrib2f )))
+    {
+        struct glVertexAttrib2f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glVertexAttrib2f, &args ))) WARN( "glVertexAttrib2f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].u = index;
+    entry->args[1].f = x;
+    entry->args[2].f = y;
+}
+
+void WINAPI glVertexAttrib3f( GLuint index, GLfloat x, GLfloat y, GLfloat z )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glVertexAttrib3f )))
+    {
+        struct glVertexAttrib3f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glVertexAttrib3f, &args ))) WARN( "glVertexAttrib3f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].u = index;
+    entry->args[1].f = x;
+    entry->args[2].f = y;
+    entry->args[3].f = z;
+}
+
+void WINAPI glVertexAttrib4f( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
+{
+    struct gl_batch_entry *entry;
+    TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
+    if (!(entry = get_gl_batch_entry( gl_batch_cmd_glVertexAttrib4f )))
+    {
+        struct glVertexAttrib4f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
+        NTSTATUS status;
+        if ((status = UNIX_CALL( glVertexAttrib4f, &args ))) WARN( "glVertexAttrib4f returned %#lx\n", status );
+        return;
+    }
+    entry->args[0].u = index;
+    entry->args[1].f = x;
+    entry->args[2].f = y;
+    entry->args[3].f = z;
+    entry->args[4].f = w;
+}
+
 static struct wgl_pixel_format *get_pixel_formats( HDC hdc, UINT *num_formats,
                                                    UINT *num_onscreen_formats )
 {
@@ -1943,6 +2184,8 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
 #endif
         /* fallthrough */
     case DLL_THREAD_DETACH:
+        flush_gl_batch();
+        free( NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_BATCH_PTR] );
         free( NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_FORMATS_PTR] );
         return TRUE;
     }
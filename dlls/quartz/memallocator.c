@@ -37,12 +37,16 @@ typedef struct StdMediaSample2
     LONG ref;
     AM_SAMPLE2_PROPERTIES props;
     IMemAllocator * pParent;
-    struct list listentry;
+    SLIST_ENTRY free_entry;
     LONGLONG tMediaStart;
     LONGLONG tMediaEnd;
     BOOL media_time_valid;
 } StdMediaSample2;
 
+/* The free list is an interlocked SList and the number of outstanding samples
+ * is a counter, so that GetBuffer() and ReleaseBuffer(), which are called for
+ * every sample while streaming, don't take the allocator lock.  The critical
+ * section only guards state changes (commit, decommit, properties). */
 typedef struct BaseMemAllocator
 {
     IMemAllocator IMemAllocator_iface;
@@ -59,8 +63,8 @@ typedef struct BaseMemAllocator
     BOOL bDecommitQueued;
     BOOL bCommitted;
     LONG lWaiting;
-    struct list free_list;
-    struct list used_list;
+    SLIST_HEADER free_list;
+    LONG cOutstanding;
     CRITICAL_SECTION *pCritSect;
 } BaseMemAllocator;
 
@@ -90,8 +94,8 @@ static HRESULT BaseMemAllocator_Init(HRESULT (* fnAlloc)(IMemAllocator *),
 
     pMemAlloc->ref = 1;
     ZeroMemory(&pMemAlloc->props, sizeof(pMemAlloc->props));
-    list_init(&pMemAlloc->free_list);
-    list_init(&pMemAlloc->used_list);
+    InitializeSListHead(&pMemAlloc->free_list);
+    pMemAlloc->cOutstanding = 0;
     pMemAlloc->fnAlloc = fnAlloc;
     pMemAlloc->fnFree = fnFree;
     pMemAlloc->fnVerify = fnVerify;
@@ -171,7 +175,7 @@ static HRESULT WINAPI BaseMemAllocator_SetProperties(IMemAllocator * iface, ALLO
 
     EnterCriticalSection(This->pCritSect);
     {
-        if (!list_empty(&This->used_list))
+        if (This->cOutstanding)
             hr = VFW_E_BUFFERS_OUTSTANDING;
         else if (This->bCommitted)
             hr = VFW_E_ALREADY_COMMITTED;
@@ -267,7 +271,7 @@ static HRESULT WINAPI BaseMemAllocator_Decommit(IMemAllocator * iface)
             hr = S_OK;
         else
         {
-            if (!list_empty(&This->used_list))
+            if (This->cOutstanding)
             {
                 This->bDecommitQueued = TRUE;
                 /* notify ALL waiting threads that they cannot be allocated a buffer any more */
@@ -293,12 +297,33 @@ static HRESULT WINAPI BaseMemAllocator_Decommit(IMemAllocator * iface)
     return hr;
 }
 
+/* Perform the decommit deferred from Decommit() once the last outstanding
+ * sample has come back. */
+static void BaseMemAllocator_DoDeferredDecommit(BaseMemAllocator *This)
+{
+    EnterCriticalSection(This->pCritSect);
+    if (!This->cOutstanding && This->bDecommitQueued && This->bCommitted)
+    {
+        if (This->lWaiting != 0)
+            ERR("Waiting: %ld\n", This->lWaiting);
+
+        This->bCommitted = FALSE;
+        This->bDecommitQueued = FALSE;
+
+        CloseHandle(This->hSemWaiting);
+        This->hSemWaiting = NULL;
+
+        This->fnFree(&This->IMemAllocator_iface);
+    }
+    LeaveCriticalSection(This->pCritSect);
+}
+
 static HRESULT WINAPI BaseMemAllocator_GetBuffer(IMemAllocator * iface, IMediaSample ** pSample, REFERENCE_TIME *pStartTime, REFERENCE_TIME *pEndTime, DWORD dwFlags)
 {
     BaseMemAllocator *This = impl_from_IMemAllocator(iface);
     HRESULT hr = S_OK;
 
-    /* NOTE: The pStartTime and pEndTime parameters are not applied to the sample. 
+    /* NOTE: The pStartTime and pEndTime parameters are not applied to the sample.
      * The allocator might use these values to determine which buffer it retrieves */
 
     TRACE("allocator %p, sample %p, start_time %p, end_time %p, flags %#lx.\n",
@@ -306,46 +331,42 @@ static HRESULT WINAPI BaseMemAllocator_GetBuffer(IMemAllocator * iface, IMediaSa
 
     *pSample = NULL;
 
-    EnterCriticalSection(This->pCritSect);
     if (!This->bCommitted || This->bDecommitQueued)
     {
         WARN("Not committed\n");
-        hr = VFW_E_NOT_COMMITTED;
+        return VFW_E_NOT_COMMITTED;
     }
-    else
-        ++This->lWaiting;
-    LeaveCriticalSection(This->pCritSect);
-    if (FAILED(hr))
-        return hr;
 
+    InterlockedIncrement(&This->lWaiting);
     if (WaitForSingleObject(This->hSemWaiting, (dwFlags & AM_GBF_NOWAIT) ? 0 : INFINITE) != WAIT_OBJECT_0)
     {
-        EnterCriticalSection(This->pCritSect);
-        --This->lWaiting;
-        LeaveCriticalSection(This->pCritSect);
+        InterlockedDecrement(&This->lWaiting);
         WARN("Timed out\n");
         return VFW_E_TIMEOUT;
     }
+    InterlockedDecrement(&This->lWaiting);
 
+    /* Decommit() frees the pool as soon as it observes no outstanding
+     * samples under the lock, so the state re-check, the accounting and
+     * the pop all have to happen under the same lock; otherwise a thread
+     * that passed the wait could pop from an already freed pool. */
     EnterCriticalSection(This->pCritSect);
+    if (!This->bCommitted)
+        hr = VFW_E_NOT_COMMITTED;
+    else if (This->bDecommitQueued)
+        hr = VFW_E_TIMEOUT;
+    else
     {
-        --This->lWaiting;
-        if (!This->bCommitted)
-            hr = VFW_E_NOT_COMMITTED;
-        else if (This->bDecommitQueued)
-            hr = VFW_E_TIMEOUT;
-        else
-        {
-            StdMediaSample2 *ms;
-            struct list * free = list_head(&This->free_list);
-            list_remove(free);
-            list_add_head(&This->used_list, free);
-
-            ms = LIST_ENTRY(free, StdMediaSample2, listentry);
-            assert(ms->ref == 0);
-            *pSample = (IMediaSample *)&ms->IMediaSample2_iface;
-            IMediaSample_AddRef(*pSample);
-        }
+        SLIST_ENTRY *entry = InterlockedPopEntrySList(&This->free_list);
+        StdMediaSample2 *ms;
+
+        /* The semaphore guarantees a free sample for every token. */
+        assert(entry);
+        InterlockedIncrement(&This->cOutstanding);
+        ms = CONTAINING_RECORD(entry, StdMediaSample2, free_entry);
+        assert(ms->ref == 0);
+        *pSample = (IMediaSample *)&ms->IMediaSample2_iface;
+        IMediaSample_AddRef(*pSample);
     }
     LeaveCriticalSection(This->pCritSect);
 
@@ -362,42 +383,30 @@ static HRESULT WINAPI BaseMemAllocator_ReleaseBuffer(IMemAllocator * iface, IMed
 
     TRACE("(%p)->(%p)\n", This, pSample);
 
-    /* FIXME: make sure that sample is currently on the used list */
-
     /* FIXME: we should probably check the ref count on the sample before freeing
      * it to make sure that it is not still in use */
-    EnterCriticalSection(This->pCritSect);
-    {
-        if (!This->bCommitted)
-            ERR("Releasing a buffer when the allocator is not committed?!?\n");
+    if (!This->bCommitted)
+        ERR("Releasing a buffer when the allocator is not committed?!?\n");
 
-		/* remove from used_list */
-        list_remove(&pStdSample->listentry);
+    InterlockedPushEntrySList(&This->free_list, &pStdSample->free_entry);
 
-        list_add_head(&This->free_list, &pStdSample->listentry);
-
-        if (list_empty(&This->used_list) && This->bDecommitQueued && This->bCommitted)
-        {
-            if (This->lWaiting != 0)
-                ERR("Waiting: %ld\n", This->lWaiting);
-
-            This->bCommitted = FALSE;
-            This->bDecommitQueued = FALSE;
-
-            CloseHandle(This->hSemWaiting);
-            This->hSemWaiting = NULL;
-            
-            This->fnFree(iface);
-        }
-    }
-    LeaveCriticalSection(This->pCritSect);
+    InterlockedDecrement(&This->cOutstanding);
 
+    /* Decommit() queues the deferred decommit and DoDeferredDecommit()
+     * closes hSemWaiting under pCritSect, so the decommit re-check and the
+     * wakeup have to happen under the same lock; otherwise a decommit
+     * queued between the decrement and the check would be missed, or the
+     * semaphore could be released after it was closed. */
+    EnterCriticalSection(This->pCritSect);
+    if (!This->cOutstanding && This->bDecommitQueued)
+        BaseMemAllocator_DoDeferredDecommit(This);
     /* notify a waiting thread that there is now a free buffer */
-    if (This->hSemWaiting && !ReleaseSemaphore(This->hSemWaiting, 1, NULL))
+    else if (This->hSemWaiting && !ReleaseSemaphore(This->hSemWaiting, 1, NULL))
     {
         ERR("Failed to release semaphore, error %lu.\n", GetLastError());
         hr = HRESULT_FROM_WIN32(GetLastError());
     }
+    LeaveCriticalSection(This->pCritSect);
 
     return hr;
 }
@@ -821,6 +830,8 @@ typedef struct StdMemAllocator
     BaseMemAllocator base;
     CRITICAL_SECTION csState;
     LPVOID pMemory;
+    StdMediaSample2 **samples;
+    LONG sample_count;
 } StdMemAllocator;
 
 static inline StdMemAllocator *StdMemAllocator_from_IMemAllocator(IMemAllocator * iface)
@@ -835,7 +846,7 @@ static HRESULT StdMemAllocator_Alloc(IMemAllocator * iface)
     SYSTEM_INFO si;
     LONG i;
 
-    assert(list_empty(&This->base.free_list));
+    assert(!QueryDepthSList(&This->base.free_list));
 
     /* check alignment */
     GetSystemInfo(&si);
@@ -853,14 +864,23 @@ static HRESULT StdMemAllocator_Alloc(IMemAllocator * iface)
     if (!This->pMemory)
         return E_OUTOFMEMORY;
 
+    if (!(This->samples = CoTaskMemAlloc(This->base.props.cBuffers * sizeof(*This->samples))))
+    {
+        VirtualFree(This->pMemory, 0, MEM_RELEASE);
+        This->pMemory = NULL;
+        return E_OUTOFMEMORY;
+    }
+    This->sample_count = This->base.props.cBuffers;
+
     for (i = This->base.props.cBuffers - 1; i >= 0; i--)
     {
         /* pbBuffer does not start at the base address, it starts at base + cbPrefix */
         BYTE * pbBuffer = (BYTE *)This->pMemory + i * (This->base.props.cbBuffer + This->base.props.cbPrefix) + This->base.props.cbPrefix;
-        
+
         StdMediaSample2_Construct(pbBuffer, This->base.props.cbBuffer, iface, &pSample);
 
-        list_add_head(&This->base.free_list, &pSample->listentry);
+        This->samples[i] = pSample;
+        InterlockedPushEntrySList(&This->base.free_list, &pSample->free_entry);
     }
 
     return S_OK;
@@ -869,26 +889,38 @@ static HRESULT StdMemAllocator_Alloc(IMemAllocator * iface)
 static HRESULT StdMemAllocator_Free(IMemAllocator * iface)
 {
     StdMemAllocator *This = StdMemAllocator_from_IMemAllocator(iface);
-    struct list * cursor;
+    SLIST_ENTRY *entry;
+    LONG i;
 
-    if (!list_empty(&This->base.used_list))
+    while ((entry = InterlockedPopEntrySList(&This->base.free_list)))
     {
-        WARN("Freeing allocator with outstanding samples!\n");
-        while ((cursor = list_head(&This->base.used_list)) != NULL)
+        StdMediaSample2 *pSample = CONTAINING_RECORD(entry, StdMediaSample2, free_entry);
+
+        for (i = 0; i < This->sample_count; i++)
         {
-            StdMediaSample2 *pSample;
-            list_remove(cursor);
-            pSample = LIST_ENTRY(cursor, StdMediaSample2, listentry);
-            pSample->pParent = NULL;
+            if (This->samples[i] == pSample)
+            {
+                This->samples[i] = NULL;
+                break;
+            }
         }
+        StdMediaSample2_Delete(pSample);
     }
 
-    while ((cursor = list_head(&This->base.free_list)) != NULL)
+    /* any samples left in the array are still outstanding; orphan them */
+    for (i = 0; i < This->sample_count; i++)
     {
-        list_remove(cursor);
-        StdMediaSample2_Delete(LIST_ENTRY(cursor, StdMediaSample2, listentry));
+        if (This->samples[i])
+        {
+            WARN("Freeing allocator with outstanding samples!\n");
+            This->samples[i]->pParent = NULL;
+        }
     }
-    
+
+    CoTaskMemFree(This->samples);
+    This->samples = NULL;
+    This->sample_count = 0;
+
     /* free memory */
     if (!VirtualFree(This->pMemory, 0, MEM_RELEASE))
     {
@@ -924,6 +956,8 @@ HRESULT mem_allocator_create(IUnknown *lpUnkOuter, IUnknown **out)
     pMemAlloc->csState.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": StdMemAllocator.csState");
 
     pMemAlloc->pMemory = NULL;
+    pMemAlloc->samples = NULL;
+    pMemAlloc->sample_count = 0;
 
     if (SUCCEEDED(hr = BaseMemAllocator_Init(StdMemAllocator_Alloc, StdMemAllocator_Free, NULL, NULL, NULL, StdMemAllocator_Destroy, &pMemAlloc->csState, &pMemAlloc->base)))
         *out = (IUnknown *)&pMemAlloc->base.IMemAllocator_iface;
@@ -207,6 +207,7 @@ BOOL wrap_marked_paras_dc( ME_TextEditor *editor, HDC hdc, BOOL invalidate );
 void editor_get_selection_paras(ME_TextEditor *editor, ME_Paragraph **para, ME_Paragraph **para_end );
 void editor_get_selection_para_fmt( ME_TextEditor *editor, PARAFORMAT2 *fmt );
 void editor_mark_rewrap_all( ME_TextEditor *editor );
+ME_Paragraph *editor_para_from_char_ofs( ME_TextEditor *editor, int char_ofs );
 void editor_set_default_para_fmt(ME_TextEditor *editor, PARAFORMAT2 *pFmt);
 BOOL editor_set_selection_para_fmt( ME_TextEditor *editor, const PARAFORMAT2 *fmt );
 void ME_MakeFirstParagraph(ME_TextEditor *editor, HDC hdc);
@@ -216,6 +216,7 @@ typedef struct tagME_Paragraph
   ME_Run *eop_run; /* ptr to the end-of-para run */
   struct tagME_DisplayItem *prev_para, *next_para;
   struct wine_rb_entry marked_entry;
+  struct wine_rb_entry ofs_entry;
 } ME_Paragraph;
 
 typedef struct tagME_Cell /* v4.1 */
@@ -450,6 +451,7 @@ typedef struct tagME_TextEditor
   struct list style_list;
   struct list reobj_list;
   struct wine_rb_tree marked_paras;
+  struct wine_rb_tree paras_by_ofs;
 } ME_TextEditor;
 
 typedef struct tagME_Context
@@ -23,6 +23,8 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(richedit);
 
+static void para_ofs_remove( ME_TextEditor *editor, ME_Paragraph *para );
+
 void para_mark_rewrap( ME_TextEditor *editor, ME_Paragraph *para )
 {
     para->nFlags |= MEPF_REWRAP;
@@ -50,6 +52,7 @@ void para_destroy( ME_TextEditor *editor, ME_Paragraph *para )
     ME_DestroyString( para->text );
     para_num_clear( &para->para_num );
     para_mark_remove( editor, para );
+    para_ofs_remove( editor, para );
     ME_DestroyDisplayItem( para_get_di( para ) );
 }
 
@@ -101,6 +104,47 @@ void para_mark_add( ME_TextEditor *editor, ME_Paragraph *para )
     wine_rb_put( &editor->marked_paras, &para->nCharOfs, &para->marked_entry );
 }
 
+static int para_ofs_compare( const void *key, const struct wine_rb_entry *entry )
+{
+    ME_Paragraph *para = WINE_RB_ENTRY_VALUE( entry, ME_Paragraph, ofs_entry );
+
+    return *(int *)key - para->nCharOfs;
+}
+
+/* All paragraphs are kept in a tree ordered by offset, so that looking up the
+ * paragraph containing a given offset doesn't require walking the paragraph
+ * list.  Offset shifts don't change the relative order of the paragraphs, so
+ * entries only need updating when a paragraph is added or removed. */
+static void para_ofs_add( ME_TextEditor *editor, ME_Paragraph *para )
+{
+    wine_rb_put( &editor->paras_by_ofs, &para->nCharOfs, &para->ofs_entry );
+}
+
+static void para_ofs_remove( ME_TextEditor *editor, ME_Paragraph *para )
+{
+    wine_rb_remove( &editor->paras_by_ofs, &para->ofs_entry );
+}
+
+/* Find the last paragraph with a start offset no greater than char_ofs. */
+ME_Paragraph *editor_para_from_char_ofs( ME_TextEditor *editor, int char_ofs )
+{
+    struct wine_rb_entry *entry = editor->paras_by_ofs.root;
+    ME_Paragraph *para = NULL, *candidate;
+
+    while (entry)
+    {
+        candidate = WINE_RB_ENTRY_VALUE( entry, ME_Paragraph, ofs_entry );
+        if (candidate->nCharOfs <= char_ofs)
+        {
+            para = candidate;
+            entry = entry->right;
+        }
+        else entry = entry->left;
+    }
+
+    return para ? para : editor_first_para( editor );
+}
+
 ME_Run *para_first_run( ME_Paragraph *para )
 {
     ME_DisplayItem *di;
@@ -220,6 +264,8 @@ void ME_MakeFirstParagraph(ME_TextEditor *editor, HDC hdc)
 
   wine_rb_init( &editor->marked_paras, para_mark_compare );
   para_mark_add( editor, para );
+  wine_rb_init( &editor->paras_by_ofs, para_ofs_compare );
+  para_ofs_add( editor, para );
   ME_DestroyContext(&c);
 }
 
@@ -671,6 +717,7 @@ ME_Paragraph *para_split( ME_TextEditor *editor, ME_Run *run, ME_Style *style,
 
   /* we've added the end run, so we need to modify nCharOfs in the next paragraphs */
   editor_propagate_char_ofs( editor, next_para, NULL, eol_len );
+  para_ofs_add( editor, new_para );
   editor->nParagraphs++;
 
   return new_para;
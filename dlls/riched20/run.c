@@ -250,10 +250,7 @@ void cursor_from_char_ofs( ME_TextEditor *editor, int char_ofs, ME_Cursor *curso
     char_ofs = min( max( char_ofs, 0 ), ME_GetTextLength( editor ) );
 
     /* Find the paragraph at the offset. */
-    for (para = editor_first_para( editor );
-         para_next( para )->nCharOfs <= char_ofs;
-         para = para_next( para ))
-        ;
+    para = editor_para_from_char_ofs( editor, char_ofs );
 
     char_ofs -= para->nCharOfs;
 
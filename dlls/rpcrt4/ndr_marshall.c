@@ -2830,6 +2830,48 @@ static ULONG EmbeddedComplexMemorySize(PMIDL_STUB_MESSAGE pStubMsg,
 }
 
 
+/* Return the number of bytes covered by the longest run of base types at the
+ * start of a complex type description whose memory and wire representations
+ * are identical, and the run's length in format characters. Such a run can be
+ * transferred with a single copy instead of being interpreted field by
+ * field. */
+static ULONG ComplexPlainFieldRun(PFORMAT_STRING pFormat, ULONG *format_len)
+{
+  PFORMAT_STRING start = pFormat;
+  ULONG size = 0;
+
+  for (;;pFormat++) {
+    switch (*pFormat) {
+    case FC_BYTE:
+    case FC_CHAR:
+    case FC_SMALL:
+    case FC_USMALL:
+      size += 1;
+      break;
+    case FC_WCHAR:
+    case FC_SHORT:
+    case FC_USHORT:
+      size += 2;
+      break;
+    case FC_LONG:
+    case FC_ULONG:
+    case FC_ENUM32:
+    case FC_FLOAT:
+      size += 4;
+      break;
+    case FC_HYPER:
+    case FC_DOUBLE:
+      size += 8;
+      break;
+    case FC_PAD:
+      break;
+    default:
+      *format_len = pFormat - start;
+      return size;
+    }
+  }
+}
+
 static unsigned char * ComplexMarshall(PMIDL_STUB_MESSAGE pStubMsg,
                                        unsigned char *pMemory,
                                        PFORMAT_STRING pFormat,
@@ -2841,6 +2883,15 @@ static unsigned char * ComplexMarshall(PMIDL_STUB_MESSAGE pStubMsg,
   ULONG size;
 
   while (*pFormat != FC_END) {
+    ULONG run_len;
+
+    if (!TRACE_ON(ole) && (size = ComplexPlainFieldRun(pFormat, &run_len)) && run_len > 1)
+    {
+      copy_to_buffer(pStubMsg, pMemory, size);
+      pMemory += size;
+      pFormat += run_len;
+      continue;
+    }
     switch (*pFormat) {
     case FC_BYTE:
     case FC_CHAR:
@@ -3001,6 +3052,15 @@ static unsigned char * ComplexUnmarshall(PMIDL_STUB_MESSAGE pStubMsg,
   ULONG size;
 
   while (*pFormat != FC_END) {
+    ULONG run_len;
+
+    if (!TRACE_ON(ole) && (size = ComplexPlainFieldRun(pFormat, &run_len)) && run_len > 1)
+    {
+      safe_copy_from_buffer(pStubMsg, pMemory, size);
+      pMemory += size;
+      pFormat += run_len;
+      continue;
+    }
     switch (*pFormat) {
     case FC_BYTE:
     case FC_CHAR:
@@ -3177,6 +3237,15 @@ static unsigned char * ComplexBufferSize(PMIDL_STUB_MESSAGE pStubMsg,
   ULONG size;
 
   while (*pFormat != FC_END) {
+    ULONG run_len;
+
+    if ((size = ComplexPlainFieldRun(pFormat, &run_len)) && run_len > 1)
+    {
+      safe_buffer_length_increment(pStubMsg, size);
+      pMemory += size;
+      pFormat += run_len;
+      continue;
+    }
     switch (*pFormat) {
     case FC_BYTE:
     case FC_CHAR:
@@ -3400,6 +3469,15 @@ static ULONG ComplexStructMemorySize(PMIDL_STUB_MESSAGE pStubMsg,
   ULONG size = 0;
 
   while (*pFormat != FC_END) {
+    ULONG run, run_len;
+
+    if ((run = ComplexPlainFieldRun(pFormat, &run_len)) && run_len > 1)
+    {
+      size += run;
+      safe_buffer_increment(pStubMsg, run);
+      pFormat += run_len;
+      continue;
+    }
     switch (*pFormat) {
     case FC_BYTE:
     case FC_CHAR:
@@ -68,6 +68,11 @@ typedef struct _RpcConnection_np
     IO_STATUS_BLOCK io_status;
     HANDLE event_cache;
     BOOL read_closed;
+    /* Receiving a PDU takes several short reads; buffer whole pipe messages
+     * so that each fragment costs one NtReadFile instead of three. */
+    char *read_buf;
+    unsigned int read_buf_len;
+    unsigned int read_buf_pos;
 } RpcConnection_np;
 
 static RpcConnection *rpcrt4_conn_np_alloc(void)
@@ -301,6 +306,11 @@ static void rpcrt4_conn_np_handoff(RpcConnection_np *old_npc, RpcConnection_np *
 
     new_npc->pipe = old_npc->pipe;
     old_npc->pipe = 0;
+    new_npc->read_buf = old_npc->read_buf;
+    new_npc->read_buf_len = old_npc->read_buf_len;
+    new_npc->read_buf_pos = old_npc->read_buf_pos;
+    old_npc->read_buf = NULL;
+    old_npc->read_buf_len = old_npc->read_buf_pos = 0;
     assert(!old_npc->listen_event);
 }
 
@@ -372,15 +382,14 @@ static RPC_STATUS rpcrt4_ncalrpc_handoff(RpcConnection *old_conn, RpcConnection
   return status;
 }
 
-static int rpcrt4_conn_np_read(RpcConnection *conn, void *buffer, unsigned int count)
+static NTSTATUS rpcrt4_conn_np_read_pipe(RpcConnection_np *connection, void *buffer, unsigned int count)
 {
-    RpcConnection_np *connection = (RpcConnection_np *) conn;
     HANDLE event;
     NTSTATUS status;
 
     event = get_np_event(connection);
     if (!event)
-        return -1;
+        return STATUS_NO_MEMORY;
 
     if (connection->read_closed)
         status = STATUS_CANCELLED;
@@ -398,7 +407,48 @@ static int rpcrt4_conn_np_read(RpcConnection *conn, void *buffer, unsigned int c
         status = connection->io_status.Status;
     }
     release_np_event(connection, event);
-    return status && status != STATUS_BUFFER_OVERFLOW ? -1 : connection->io_status.Information;
+    return status;
+}
+
+static int rpcrt4_conn_np_read(RpcConnection *conn, void *buffer, unsigned int count)
+{
+    RpcConnection_np *connection = (RpcConnection_np *) conn;
+    unsigned int total = 0;
+    NTSTATUS status;
+
+    if (!count)
+    {
+        /* A zero-byte read just waits for incoming data. */
+        if (connection->read_buf_pos < connection->read_buf_len)
+            return 0;
+        status = rpcrt4_conn_np_read_pipe(connection, NULL, 0);
+        return status && status != STATUS_BUFFER_OVERFLOW ? -1 : 0;
+    }
+
+    if (!connection->read_buf && !(connection->read_buf = malloc(RPC_MAX_PACKET_SIZE)))
+        return -1;
+
+    for (;;)
+    {
+        if (connection->read_buf_pos < connection->read_buf_len)
+        {
+            unsigned int len = min(count - total, connection->read_buf_len - connection->read_buf_pos);
+
+            memcpy((char *)buffer + total, connection->read_buf + connection->read_buf_pos, len);
+            connection->read_buf_pos += len;
+            total += len;
+            if (total == count)
+                return total;
+        }
+
+        status = rpcrt4_conn_np_read_pipe(connection, connection->read_buf, RPC_MAX_PACKET_SIZE);
+        if (status && status != STATUS_BUFFER_OVERFLOW)
+            return -1;
+        if (!connection->io_status.Information)
+            return total;
+        connection->read_buf_len = connection->io_status.Information;
+        connection->read_buf_pos = 0;
+    }
 }
 
 static int rpcrt4_conn_np_write(RpcConnection *conn, const void *buffer, unsigned int count)
@@ -445,6 +495,9 @@ static int rpcrt4_conn_np_close(RpcConnection *conn)
         CloseHandle(connection->event_cache);
         connection->event_cache = 0;
     }
+    free(connection->read_buf);
+    connection->read_buf = NULL;
+    connection->read_buf_len = connection->read_buf_pos = 0;
     return 0;
 }
 
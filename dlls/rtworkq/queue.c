@@ -354,7 +354,17 @@ static HRESULT pool_queue_init(const struct queue_desc *desc, struct queue *queu
     list_init(&queue->pending_items);
     InitializeCriticalSection(&queue->cs);
 
-    max_thread = (desc->queue_type == RTWQ_STANDARD_WORKQUEUE || desc->queue_type == RTWQ_WINDOW_WORKQUEUE) ? 1 : 4;
+    if (desc->queue_type == RTWQ_STANDARD_WORKQUEUE || desc->queue_type == RTWQ_WINDOW_WORKQUEUE)
+        max_thread = 1;
+    else
+    {
+        SYSTEM_INFO info;
+
+        /* Scale multithreaded queues with the machine, so that topologies with
+           many parallel streams aren't serialized on a few worker threads. */
+        GetSystemInfo(&info);
+        max_thread = max(4, info.dwNumberOfProcessors);
+    }
 
     SetThreadpoolThreadMinimum(queue->pool, 1);
     SetThreadpoolThreadMaximum(queue->pool, max_thread);
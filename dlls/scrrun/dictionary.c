@@ -34,7 +34,6 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(scrrun);
 
-#define BUCKET_COUNT  509
 #define DICT_HASH_MOD 1201
 
 /* Implementation details
@@ -45,6 +44,12 @@ WINE_DEFAULT_DEBUG_CHANNEL(scrrun);
    bucket lists are zeroed and we init them once we about to add
    first pair.
 
+   The bucket table is allocated on first add and grows once the pair
+   count reaches the bucket count, relinking pairs into the new buckets.
+   The hash exposed through get_HashVal() can't be used to pick a bucket
+   at larger sizes - its range is fixed by DICT_HASH_MOD - so every pair
+   also keeps an internal full-range bucket hash next to it.
+
    When pair is removed it's unlinked from both lists; if it was
    a last pair in a bucket list it stays empty in initialized state.
 
@@ -57,6 +62,7 @@ struct keyitem_pair
     struct  list entry;
     struct  list bucket;
     DWORD   hash;
+    DWORD   bucket_hash;
     VARIANT key;
     VARIANT item;
 };
@@ -70,10 +76,19 @@ struct dictionary
     CompareMethod method;
     LONG count;
     struct list pairs;
-    struct list buckets[BUCKET_COUNT];
+    struct list *buckets;
+    DWORD bucket_count;
     struct list notifier;
 };
 
+/* Bucket table sizes, each one roughly doubling the previous prime. */
+static const DWORD bucket_sizes[] =
+{
+    509, 1021, 2053, 4099, 8209, 16411, 32771, 65537, 131101, 262147,
+    524309, 1048583, 2097169, 4194319, 8388617, 16777259, 33554467,
+    67108879, 134217757, 268435459
+};
+
 struct dictionary_enum
 {
     IEnumVARIANT IEnumVARIANT_iface;
@@ -94,9 +109,9 @@ static inline struct dictionary_enum *impl_from_IEnumVARIANT(IEnumVARIANT *iface
     return CONTAINING_RECORD(iface, struct dictionary_enum, IEnumVARIANT_iface);
 }
 
-static inline struct list *get_bucket_head(struct dictionary *dict, DWORD hash)
+static inline struct list *get_bucket_head(struct dictionary *dict, DWORD bucket_hash)
 {
-    return &dict->buckets[hash % BUCKET_COUNT];
+    return &dict->buckets[bucket_hash % dict->bucket_count];
 }
 
 static inline BOOL is_string_key(const VARIANT *key)
@@ -137,6 +152,75 @@ static inline WCHAR *get_key_strptr(const VARIANT *key)
     return NULL;
 }
 
+/* Internal hash used to pick a bucket. Unlike the hash exposed through
+   get_HashVal() it uses the full 32-bit range, so pairs still spread evenly
+   once the bucket table grows past DICT_HASH_MOD entries. Keys considered
+   equal by is_matching_key() always get the same bucket hash. */
+static DWORD get_str_bucket_hash(const WCHAR *str, CompareMethod method)
+{
+    DWORD hash = 2166136261u;
+
+    if (str) {
+        while (*str) {
+            hash ^= method == BinaryCompare ? *str : towlower(*str);
+            hash *= 16777619;
+            str++;
+        }
+    }
+
+    return hash;
+}
+
+static DWORD get_num_bucket_hash(FLOAT num)
+{
+    return *((DWORD*)&num);
+}
+
+static DWORD get_ptr_bucket_hash(void *ptr)
+{
+    DWORD hash = PtrToUlong(ptr);
+#ifdef _WIN64
+    hash ^= (ULONG_PTR)ptr >> 32;
+#endif
+    return hash;
+}
+
+static DWORD get_bucket_hash(const struct dictionary *dict, const VARIANT *key)
+{
+    switch (V_VT(key))
+    {
+    case VT_BSTR|VT_BYREF:
+    case VT_BSTR:
+        return get_str_bucket_hash(get_key_strptr(key), dict->method);
+    case VT_UI1|VT_BYREF:
+    case VT_UI1:
+        return get_num_bucket_hash(V_VT(key) & VT_BYREF ? *V_UI1REF(key) : V_UI1(key));
+    case VT_I2|VT_BYREF:
+    case VT_I2:
+        return get_num_bucket_hash(V_VT(key) & VT_BYREF ? *V_I2REF(key) : V_I2(key));
+    case VT_I4|VT_BYREF:
+    case VT_I4:
+        return get_num_bucket_hash(V_VT(key) & VT_BYREF ? *V_I4REF(key) : V_I4(key));
+    case VT_UNKNOWN|VT_BYREF:
+    case VT_DISPATCH|VT_BYREF:
+    case VT_UNKNOWN:
+    case VT_DISPATCH:
+        return get_ptr_bucket_hash(V_VT(key) & VT_BYREF ? *V_UNKNOWNREF(key) : V_UNKNOWN(key));
+    case VT_DATE|VT_BYREF:
+    case VT_DATE:
+        return get_num_bucket_hash(V_VT(key) & VT_BYREF ? *V_DATEREF(key) : V_DATE(key));
+    case VT_R4|VT_BYREF:
+    case VT_R4:
+        return get_num_bucket_hash(V_VT(key) & VT_BYREF ? *V_R4REF(key) : V_R4(key));
+    case VT_R8|VT_BYREF:
+    case VT_R8:
+        return get_num_bucket_hash(V_VT(key) & VT_BYREF ? *V_R8REF(key) : V_R8(key));
+    default:
+        /* get_HashVal() fails for anything else before pairs are bucketed */
+        return 0;
+    }
+}
+
 /* should be used only when both keys are of string type, it's not checked */
 static inline int strcmp_key(const struct dictionary *dict, const VARIANT *key1, const VARIANT *key2)
 {
@@ -206,11 +290,14 @@ static struct keyitem_pair *get_keyitem_pair(struct dictionary *dict, VARIANT *k
     VARIANT hash, v;
     HRESULT hr;
 
+    if (!dict->buckets)
+        return NULL;
+
     hr = IDictionary_get_HashVal(&dict->IDictionary_iface, key, &hash);
     if (FAILED(hr))
         return NULL;
 
-    head = get_bucket_head(dict, V_I4(&hash));
+    head = get_bucket_head(dict, get_bucket_hash(dict, key));
     if (!head->next || list_empty(head))
         return NULL;
 
@@ -234,6 +321,46 @@ static struct keyitem_pair *get_keyitem_pair(struct dictionary *dict, VARIANT *k
     return NULL;
 }
 
+/* Allocates the bucket table on first use and grows it once the pair count
+   catches up with the bucket count. Failure is not fatal when an old table
+   exists; pairs keep hashing into that one. */
+static void grow_bucket_table(struct dictionary *dict)
+{
+    struct list *buckets, *head;
+    struct keyitem_pair *pair;
+    DWORD new_count = 0;
+    unsigned int i;
+
+    if (dict->buckets && (DWORD)dict->count < dict->bucket_count)
+        return;
+
+    for (i = 0; i < ARRAY_SIZE(bucket_sizes); i++)
+    {
+        if (bucket_sizes[i] > (DWORD)dict->count)
+        {
+            new_count = bucket_sizes[i];
+            break;
+        }
+    }
+    if (!new_count)
+        return;
+
+    if (!(buckets = calloc(new_count, sizeof(*buckets))))
+        return;
+
+    LIST_FOR_EACH_ENTRY(pair, &dict->pairs, struct keyitem_pair, entry)
+    {
+        head = &buckets[pair->bucket_hash % new_count];
+        if (!head->next)
+            list_init(head);
+        list_add_tail(head, &pair->bucket);
+    }
+
+    free(dict->buckets);
+    dict->buckets = buckets;
+    dict->bucket_count = new_count;
+}
+
 static HRESULT add_keyitem_pair(struct dictionary *dict, VARIANT *key, VARIANT *item)
 {
     struct keyitem_pair *pair;
@@ -249,6 +376,7 @@ static HRESULT add_keyitem_pair(struct dictionary *dict, VARIANT *key, VARIANT *
         return E_OUTOFMEMORY;
 
     pair->hash = V_I4(&hash);
+    pair->bucket_hash = get_bucket_hash(dict, key);
     VariantInit(&pair->key);
     VariantInit(&pair->item);
 
@@ -260,7 +388,14 @@ static HRESULT add_keyitem_pair(struct dictionary *dict, VARIANT *key, VARIANT *
     if (FAILED(hr))
         goto failed;
 
-    head = get_bucket_head(dict, pair->hash);
+    grow_bucket_table(dict);
+    if (!dict->buckets)
+    {
+        hr = E_OUTOFMEMORY;
+        goto failed;
+    }
+
+    head = get_bucket_head(dict, pair->bucket_hash);
     if (!head->next)
         /* this only happens once per bucket */
         list_init(head);
@@ -500,6 +635,7 @@ static ULONG WINAPI dictionary_Release(IDictionary *iface)
     if (!ref)
     {
         IDictionary_RemoveAll(iface);
+        free(dictionary->buckets);
         free(dictionary);
     }
 
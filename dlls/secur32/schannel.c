@@ -1491,7 +1491,6 @@ static SECURITY_STATUS SEC_ENTRY schan_DecryptMessage(PCtxtHandle context_handle
     struct recv_params params;
     SecBuffer *buffer;
     SIZE_T data_size;
-    char *data;
     unsigned expected_size;
     ULONG received = 0;
     int idx;
@@ -1530,8 +1529,6 @@ static SECURITY_STATUS SEC_ENTRY schan_DecryptMessage(PCtxtHandle context_handle
     }
 
     data_size = expected_size - ctx->header_size;
-    data = malloc(data_size);
-
     received = data_size;
 
     input_desc.cBuffers = 1;
@@ -1540,22 +1537,20 @@ static SECURITY_STATUS SEC_ENTRY schan_DecryptMessage(PCtxtHandle context_handle
     params.session = ctx->session;
     params.input = &input_desc;
     params.input_size = expected_size;
-    params.buffer = data;
+    /* decrypt in place: the record is pulled into the backend's own buffers
+     * before any plaintext is written back */
+    params.buffer = buf_ptr + ctx->header_size;
     params.length = &received;
     status = GNUTLS_CALL( recv, &params );
 
     if (status != SEC_E_OK && status != SEC_I_RENEGOTIATE)
     {
-        free(data);
         ERR("Returning %lx\n", status);
         return status;
     }
 
     TRACE("Received %lu bytes\n", received);
 
-    memcpy(buf_ptr + ctx->header_size, data, received);
-    free(data);
-
     schan_decrypt_fill_buffer(message, SECBUFFER_DATA,
         buf_ptr + ctx->header_size, received);
 
@@ -35,6 +35,7 @@
 #include "setupapi.h"
 #include "setupapi_private.h"
 
+#include "wine/list.h"
 #include "wine/debug.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(setupapi);
@@ -858,6 +859,152 @@ static void free_inf_file( struct inf_file *file )
 }
 
 
+/* check whether the file carries a known signature */
+static BOOL inf_has_signature( struct inf_file *file )
+{
+    int version_index = find_section( file, L"Version" );
+    if (version_index != -1)
+    {
+        struct line *line = find_line( file, version_index, L"Signature" );
+        if (line && line->nb_fields > 0)
+        {
+            struct field *field = file->fields + line->first_field;
+            if (!wcsicmp( field->text, L"$Chicago$" )) return TRUE;
+            if (!wcsicmp( field->text, L"$Windows NT$" )) return TRUE;
+            if (!wcsicmp( field->text, L"$Windows 95$" )) return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+
+/* cache of parsed files, so that reopening an unchanged INF doesn't reparse it */
+
+struct inf_cache_entry
+{
+    struct list      entry;
+    WCHAR           *path;    /* full path of the INF */
+    FILETIME         mtime;   /* last write time when the file was parsed */
+    DWORD            size;    /* file size when the file was parsed */
+    struct inf_file *file;    /* parsed copy, never handed out directly */
+};
+
+static struct list inf_cache = LIST_INIT( inf_cache );
+static unsigned int inf_cache_count;
+
+#define INF_CACHE_MAX_FILES 16
+
+static CRITICAL_SECTION inf_cache_cs;
+static CRITICAL_SECTION_DEBUG inf_cache_cs_debug =
+{
+    0, 0, &inf_cache_cs,
+    { &inf_cache_cs_debug.ProcessLocksList, &inf_cache_cs_debug.ProcessLocksList },
+    0, 0, { (DWORD_PTR)(__FILE__ ": inf_cache_cs") }
+};
+static CRITICAL_SECTION inf_cache_cs = { &inf_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static void free_inf_cache_entry( struct inf_cache_entry *cache )
+{
+    list_remove( &cache->entry );
+    free_inf_file( cache->file );
+    free( cache->path );
+    free( cache );
+    inf_cache_count--;
+}
+
+/* duplicate a parsed file; all strings live in the strings buffer so the
+ * copy only needs the pointers relocated */
+static struct inf_file *clone_inf_file( const struct inf_file *src )
+{
+    struct inf_file *file;
+    unsigned int i, strings_len = src->string_pos - src->strings;
+
+    if (!(file = calloc( 1, sizeof(*file) ))) return NULL;
+    file->nb_sections = file->alloc_sections = src->nb_sections;
+    file->nb_fields = file->alloc_fields = src->nb_fields;
+    file->strings_section = src->strings_section;
+
+    if (!(file->strings = HeapAlloc( GetProcessHeap(), 0, strings_len * sizeof(WCHAR) )))
+        goto failed;
+    memcpy( file->strings, src->strings, strings_len * sizeof(WCHAR) );
+    file->string_pos = file->strings + strings_len;
+
+    if (src->nb_fields)
+    {
+        if (!(file->fields = malloc( src->nb_fields * sizeof(*file->fields) ))) goto failed;
+        for (i = 0; i < src->nb_fields; i++)
+            file->fields[i].text = file->strings + (src->fields[i].text - src->strings);
+    }
+    if (src->nb_sections)
+    {
+        if (!(file->sections = calloc( src->nb_sections, sizeof(*file->sections) ))) goto failed;
+        for (i = 0; i < src->nb_sections; i++)
+        {
+            const struct section *section = src->sections[i];
+            unsigned int alloc_lines = max( section->nb_lines, ARRAY_SIZE( section->lines ));
+            size_t size = sizeof(*section) - sizeof(section->lines) + alloc_lines * sizeof(struct line);
+
+            if (!(file->sections[i] = malloc( size ))) goto failed;
+            file->sections[i]->name = file->strings + (section->name - src->strings);
+            file->sections[i]->nb_lines = section->nb_lines;
+            file->sections[i]->alloc_lines = alloc_lines;
+            memcpy( file->sections[i]->lines, section->lines, section->nb_lines * sizeof(struct line) );
+        }
+    }
+    return file;
+
+ failed:
+    free_inf_file( file );
+    return NULL;
+}
+
+/* return a private copy of a cached parsed file, or NULL if not cached or changed on disk */
+static struct inf_file *find_cached_inf_file( const WCHAR *path, const FILETIME *mtime, DWORD size )
+{
+    struct inf_file *file = NULL;
+    struct inf_cache_entry *cache;
+
+    EnterCriticalSection( &inf_cache_cs );
+    LIST_FOR_EACH_ENTRY( cache, &inf_cache, struct inf_cache_entry, entry )
+    {
+        if (wcsicmp( cache->path, path )) continue;
+        if (cache->size != size || CompareFileTime( &cache->mtime, mtime ))
+        {
+            free_inf_cache_entry( cache );  /* the file was overwritten */
+            break;
+        }
+        file = clone_inf_file( cache->file );
+        list_remove( &cache->entry );
+        list_add_head( &inf_cache, &cache->entry );
+        break;
+    }
+    LeaveCriticalSection( &inf_cache_cs );
+    return file;
+}
+
+static void cache_inf_file( const WCHAR *path, const FILETIME *mtime, DWORD size,
+                            const struct inf_file *file )
+{
+    struct inf_cache_entry *cache;
+
+    if (!(cache = calloc( 1, sizeof(*cache) ))) return;
+    if (!(cache->path = wcsdup( path )) || !(cache->file = clone_inf_file( file )))
+    {
+        free( cache->path );
+        free( cache );
+        return;
+    }
+    cache->mtime = *mtime;
+    cache->size = size;
+
+    EnterCriticalSection( &inf_cache_cs );
+    list_add_head( &inf_cache, &cache->entry );
+    if (++inf_cache_count > INF_CACHE_MAX_FILES)
+        free_inf_cache_entry( LIST_ENTRY( list_tail( &inf_cache ), struct inf_cache_entry, entry ));
+    LeaveCriticalSection( &inf_cache_cs );
+}
+
+
 /* parse a complete buffer */
 static DWORD parse_buffer( struct inf_file *file, const WCHAR *buffer, const WCHAR *end,
                            UINT *error_line )
@@ -995,20 +1142,8 @@ static struct inf_file *parse_file( HANDLE handle, const WCHAR *class, DWORD sty
         err = parse_buffer( file, new_buff, (WCHAR *)((char *)buffer + size), error_line );
     }
 
-    if (!err)  /* now check signature */
+    if (!err && !inf_has_signature( file ))  /* now check signature */
     {
-        int version_index = find_section( file, L"Version" );
-        if (version_index != -1)
-        {
-            struct line *line = find_line( file, version_index, L"Signature" );
-            if (line && line->nb_fields > 0)
-            {
-                struct field *field = file->fields + line->first_field;
-                if (!wcsicmp( field->text, L"$Chicago$" )) goto done;
-                if (!wcsicmp( field->text, L"$Windows NT$" )) goto done;
-                if (!wcsicmp( field->text, L"$Windows 95$" )) goto done;
-            }
-        }
         if (error_line) *error_line = 0;
         if (style & INF_STYLE_WIN4) err = ERROR_WRONG_INF_STYLE;
     }
@@ -1130,7 +1265,25 @@ HINF WINAPI SetupOpenInfFileW( PCWSTR name, PCWSTR class, DWORD style, UINT *err
 
     if (handle != INVALID_HANDLE_VALUE)
     {
-        file = parse_file( handle, class, style, error );
+        FILETIME mtime;
+        DWORD size = GetFileSize( handle, NULL );
+
+        if (!GetFileTime( handle, NULL, NULL, &mtime ))
+            mtime.dwLowDateTime = mtime.dwHighDateTime = 0;
+
+        if ((file = find_cached_inf_file( path, &mtime, size )))
+        {
+            TRACE( "%s: found in cache\n", debugstr_w(path) );
+            if (!inf_has_signature( file ) && (style & INF_STYLE_WIN4))
+            {
+                if (error) *error = 0;
+                free_inf_file( file );
+                file = NULL;
+                SetLastError( ERROR_WRONG_INF_STYLE );
+            }
+        }
+        else if ((file = parse_file( handle, class, style, error )))
+            cache_inf_file( path, &mtime, size, file );
         CloseHandle( handle );
     }
     if (!file)
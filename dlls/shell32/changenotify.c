@@ -58,6 +58,26 @@ typedef struct _NOTIFICATIONLIST
 static struct list notifications = LIST_INIT( notifications );
 static LONG next_id;
 
+/* Mass file operations (e.g. installers) can emit one notification per file;
+ * sending each of them to every registered window makes such operations grind.
+ * Bursts of item events in the same directory are therefore collapsed into
+ * periodic SHCNE_UPDATEDIR events for that directory, so clients get a bounded
+ * number of messages and re-read the directory once instead. */
+#define NOTIFY_COALESCE_THRESHOLD 16    /* per-directory events delivered per window */
+#define NOTIFY_COALESCE_WINDOW    1000  /* window length in milliseconds */
+
+struct coalesce_entry
+{
+    struct list entry;
+    LPITEMIDLIST pidl;          /* directory the events happened in */
+    DWORD count;                /* events seen in the current window */
+    DWORD window_start;         /* tick count at the start of the window */
+    BOOL pending;               /* absorbed events not yet flushed */
+};
+
+static struct list coalesce_entries = LIST_INIT( coalesce_entries );
+static HANDLE coalesce_timer;
+
 #define SHCNE_NOITEMEVENTS ( \
    SHCNE_ASSOCCHANGED )
 
@@ -72,6 +92,11 @@ static LONG next_id;
 #define SHCNE_TWOITEMEVENTS ( \
    SHCNE_RENAMEFOLDER | SHCNE_RENAMEITEM )
 
+/* item events that are subject to per-directory coalescing */
+#define SHCNE_COALESCEEVENTS ( \
+   SHCNE_ATTRIBUTES | SHCNE_CREATE | SHCNE_DELETE | SHCNE_MKDIR | \
+   SHCNE_RMDIR | SHCNE_RENAMEFOLDER | SHCNE_RENAMEITEM | SHCNE_UPDATEITEM )
+
 /* for dumping events */
 static const char * DumpEvent( LONG event )
 {
@@ -140,14 +165,28 @@ void InitChangeNotifications(void)
 void FreeChangeNotifications(void)
 {
     LPNOTIFICATIONLIST ptr, next;
+    struct coalesce_entry *cur, *cur2;
 
     TRACE("\n");
 
+    if (coalesce_timer)
+    {
+        DeleteTimerQueueTimer( NULL, coalesce_timer, NULL );
+        coalesce_timer = NULL;
+    }
+
     EnterCriticalSection(&SHELL32_ChangenotifyCS);
 
     LIST_FOR_EACH_ENTRY_SAFE( ptr, next, &notifications, NOTIFICATIONLIST, entry )
         DeleteNode( ptr );
 
+    LIST_FOR_EACH_ENTRY_SAFE( cur, cur2, &coalesce_entries, struct coalesce_entry, entry )
+    {
+        list_remove( &cur->entry );
+        SHFree( cur->pidl );
+        SHFree( cur );
+    }
+
     LeaveCriticalSection(&SHELL32_ChangenotifyCS);
 
     DeleteCriticalSection(&SHELL32_ChangenotifyCS);
@@ -255,6 +294,128 @@ static BOOL should_notify( LPCITEMIDLIST changed, LPCITEMIDLIST watched, BOOL su
     return FALSE;
 }
 
+/* send an SHCNE_UPDATEDIR for every directory with absorbed events once the
+ * burst has gone quiet */
+static void CALLBACK coalesce_timer_proc( void *arg, BOOLEAN fired )
+{
+    struct coalesce_entry *cur, *next;
+    struct list flush = LIST_INIT( flush );
+    HANDLE timer;
+
+    EnterCriticalSection(&SHELL32_ChangenotifyCS);
+    timer = coalesce_timer;
+    coalesce_timer = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE( cur, next, &coalesce_entries, struct coalesce_entry, entry )
+    {
+        list_remove( &cur->entry );
+        if (cur->pending)
+            list_add_tail( &flush, &cur->entry );
+        else
+        {
+            SHFree( cur->pidl );
+            SHFree( cur );
+        }
+    }
+    LeaveCriticalSection(&SHELL32_ChangenotifyCS);
+
+    if (timer)
+        DeleteTimerQueueTimer( NULL, timer, NULL );
+
+    LIST_FOR_EACH_ENTRY_SAFE( cur, next, &flush, struct coalesce_entry, entry )
+    {
+        TRACE("flushing coalesced updates for directory %p\n", cur->pidl);
+        SHChangeNotify( SHCNE_UPDATEDIR, SHCNF_IDLIST, cur->pidl, NULL );
+        list_remove( &cur->entry );
+        SHFree( cur->pidl );
+        SHFree( cur );
+    }
+}
+
+/* Account for an item event in the directory containing pidls[0].  When the
+ * directory sees more than NOTIFY_COALESCE_THRESHOLD events in a window, the
+ * event is rewritten into an SHCNE_UPDATEDIR for the directory; after that,
+ * further events in the window are absorbed into a pending update that the
+ * timer flushes.  Returns FALSE if the event was absorbed. */
+static BOOL coalesce_notification( LONG *event, LPITEMIDLIST *pidls )
+{
+    struct coalesce_entry *cur, *next, *found = NULL;
+    LPITEMIDLIST parent;
+    BOOL deliver = TRUE;
+    DWORD now;
+
+    if (!(parent = ILClone( pidls[0] )))
+        return TRUE;
+    if (!ILRemoveLastID( parent ) || !parent->mkid.cb)
+    {
+        /* desktop-level item, not worth tracking */
+        SHFree( parent );
+        return TRUE;
+    }
+
+    now = GetTickCount();
+
+    EnterCriticalSection(&SHELL32_ChangenotifyCS);
+
+    LIST_FOR_EACH_ENTRY_SAFE( cur, next, &coalesce_entries, struct coalesce_entry, entry )
+    {
+        if (ILIsEqual( cur->pidl, parent ))
+            found = cur;
+        else if (!cur->pending && now - cur->window_start > 2 * NOTIFY_COALESCE_WINDOW)
+        {
+            /* directory went quiet without coalescing, stop tracking it */
+            list_remove( &cur->entry );
+            SHFree( cur->pidl );
+            SHFree( cur );
+        }
+    }
+
+    if (!found && (found = SHAlloc( sizeof(*found) )))
+    {
+        found->pidl = parent;
+        parent = NULL;
+        found->count = 0;
+        found->window_start = now;
+        found->pending = FALSE;
+        list_add_tail( &coalesce_entries, &found->entry );
+    }
+
+    if (found)
+    {
+        if (now - found->window_start >= NOTIFY_COALESCE_WINDOW)
+        {
+            found->count = 0;
+            found->window_start = now;
+        }
+
+        if (++found->count == NOTIFY_COALESCE_THRESHOLD + 1)
+        {
+            /* burst detected: have the clients re-read the directory once
+             * instead of handling every item event */
+            TRACE("coalescing %s in directory %p\n", DumpEvent(*event), found->pidl);
+            SHFree( pidls[0] );
+            SHFree( pidls[1] );
+            pidls[1] = NULL;
+            if ((pidls[0] = ILClone( found->pidl )))
+                *event = SHCNE_UPDATEDIR;
+            else
+                deliver = FALSE;
+        }
+        else if (found->count > NOTIFY_COALESCE_THRESHOLD + 1)
+        {
+            found->pending = TRUE;
+            if (!coalesce_timer)
+                CreateTimerQueueTimer( &coalesce_timer, NULL, coalesce_timer_proc, NULL,
+                                       NOTIFY_COALESCE_WINDOW, 0, WT_EXECUTEONLYONCE );
+            deliver = FALSE;
+        }
+    }
+
+    LeaveCriticalSection(&SHELL32_ChangenotifyCS);
+
+    SHFree( parent );
+    return deliver;
+}
+
 /*************************************************************************
  * SHChangeNotify				[SHELL32.@]
  */
@@ -330,6 +491,15 @@ void WINAPI SHChangeNotify(LONG wEventId, UINT uFlags, LPCVOID dwItem1, LPCVOID
         return;
     }
 
+    if ((wEventId & SHCNE_COALESCEEVENTS) && Pidls[0] &&
+        !coalesce_notification( &wEventId, Pidls ))
+    {
+        TRACE("absorbed into a pending directory update\n");
+        SHFree(Pidls[0]);
+        SHFree(Pidls[1]);
+        return;
+    }
+
     list_init(&recipients);
     EnterCriticalSection(&SHELL32_ChangenotifyCS);
     LIST_FOR_EACH_ENTRY( ptr, &notifications, NOTIFICATIONLIST, entry )
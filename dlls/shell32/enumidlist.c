@@ -58,63 +58,78 @@ BOOL AddToEnumList(IEnumIDListImpl *list, LPITEMIDLIST pidl)
     return TRUE;
 }
 
+/* Tests whether a directory entry gets enumerated with the given SHCONTF flags */
+static BOOL ShouldEnumFile(const WIN32_FIND_DATAW *data, DWORD dwFlags)
+{
+    if ((data->dwFileAttributes & FILE_ATTRIBUTE_HIDDEN)
+     && !(dwFlags & SHCONTF_INCLUDEHIDDEN))
+        return FALSE;
+    if (data->dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        return (dwFlags & SHCONTF_FOLDERS) &&
+               wcscmp(data->cFileName, L".") && wcscmp(data->cFileName, L"..");
+    return (dwFlags & SHCONTF_NONFOLDERS) != 0;
+}
+
+/**************************************************************************
+ *  EnumFetchNext()
+ *
+ *  Append the next matching directory entry to the list and point the
+ *  cursor at it.  Returns FALSE once the directory is exhausted.
+ */
+static BOOL EnumFetchNext(IEnumIDListImpl *list)
+{
+    while (list->find_handle != INVALID_HANDLE_VALUE)
+    {
+        LPITEMIDLIST pidl = NULL;
+
+        if (ShouldEnumFile(&list->find_data, list->enum_flags))
+            pidl = _ILCreateFromFindDataW(&list->find_data);
+
+        if (!FindNextFileW(list->find_handle, &list->find_data))
+        {
+            FindClose(list->find_handle);
+            list->find_handle = INVALID_HANDLE_VALUE;
+        }
+
+        if (pidl)
+        {
+            if (!AddToEnumList(list, pidl))
+            {
+                SHFree(pidl);
+                break;
+            }
+            list->current = list_tail(&list->pidls);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
 /**************************************************************************
  *  CreateFolderEnumList()
  */
 BOOL CreateFolderEnumList(IEnumIDListImpl *list, LPCWSTR lpszPath, DWORD dwFlags)
 {
-    LPITEMIDLIST pidl=NULL;
-    WIN32_FIND_DATAW stffile;
-    HANDLE hFile;
     WCHAR  szPath[MAX_PATH];
-    BOOL succeeded = TRUE;
 
     TRACE("(%p)->(path=%s flags=0x%08lx)\n", list, debugstr_w(lpszPath), dwFlags);
 
     if(!lpszPath || !lpszPath[0]) return FALSE;
 
+    /* only one directory handle is kept, finish off anything a previous
+     * call left pending */
+    while (EnumFetchNext(list)) ;
+    list->current = list_head(&list->pidls);
+
     lstrcpyW(szPath, lpszPath);
     PathAddBackslashW(szPath);
     lstrcatW(szPath,L"*");
 
-    hFile = FindFirstFileW(szPath,&stffile);
-    if ( hFile != INVALID_HANDLE_VALUE )
-    {
-        BOOL findFinished = FALSE;
-
-        do
-        {
-            if ( !(stffile.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) 
-             || (dwFlags & SHCONTF_INCLUDEHIDDEN) )
-            {
-                if ( (stffile.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) &&
-                 dwFlags & SHCONTF_FOLDERS &&
-                 wcscmp(stffile.cFileName, L".") && wcscmp(stffile.cFileName, L".."))
-                {
-                    pidl = _ILCreateFromFindDataW(&stffile);
-                    succeeded = succeeded && AddToEnumList(list, pidl);
-                }
-                else if (!(stffile.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
-                 && dwFlags & SHCONTF_NONFOLDERS)
-                {
-                    pidl = _ILCreateFromFindDataW(&stffile);
-                    succeeded = succeeded && AddToEnumList(list, pidl);
-                }
-            }
-            if (succeeded)
-            {
-                if (!FindNextFileW(hFile, &stffile))
-                {
-                    if (GetLastError() == ERROR_NO_MORE_FILES)
-                        findFinished = TRUE;
-                    else
-                        succeeded = FALSE;
-                }
-            }
-        } while (succeeded && !findFinished);
-        FindClose(hFile);
-    }
-    return succeeded;
+    /* The directory is read on demand as the list is iterated, so that the
+     * first entries of a big directory are available right away. */
+    list->find_handle = FindFirstFileW(szPath,&list->find_data);
+    list->enum_flags = dwFlags;
+    return TRUE;
 }
 
 static inline IEnumIDListImpl *impl_from_IEnumIDList(IEnumIDList *iface)
@@ -182,6 +197,8 @@ static ULONG WINAPI IEnumIDList_fnRelease(IEnumIDList *iface)
             SHFree(cur->pidl);
             SHFree(cur);
         }
+        if (This->find_handle != INVALID_HANDLE_VALUE)
+            FindClose(This->find_handle);
         free(This);
     }
 
@@ -212,12 +229,12 @@ static HRESULT WINAPI IEnumIDList_fnNext(IEnumIDList *iface, ULONG celt, LPITEMI
     if (celt > 1 && !fetched)
         return E_INVALIDARG;
 
-    if (celt > 0 && !This->current)
+    if (celt > 0 && !This->current && !EnumFetchNext(This))
         return S_FALSE;
 
     for (i = 0; i < celt; i++)
     {
-        if (!This->current)
+        if (!This->current && !EnumFetchNext(This))
             break;
 
         rgelt[i] = ILClone(LIST_ENTRY(This->current, struct pidl_enum_entry, entry)->pidl);
@@ -243,7 +260,7 @@ static HRESULT WINAPI IEnumIDList_fnSkip(IEnumIDList *iface, ULONG celt)
 
     for (i = 0; i < celt; i++)
     {
-        if (!This->current)
+        if (!This->current && !EnumFetchNext(This))
         {
             hr = S_FALSE;
             break;
@@ -299,6 +316,8 @@ IEnumIDListImpl *IEnumIDList_Constructor(void)
         lpeidl->ref = 1;
         list_init(&lpeidl->pidls);
         lpeidl->current = NULL;
+        lpeidl->find_handle = INVALID_HANDLE_VALUE;
+        lpeidl->enum_flags = 0;
     }
 
     TRACE("-- (%p)->()\n",lpeidl);
@@ -98,6 +98,28 @@ static INT CALLBACK SIC_CompareEntries( LPVOID p1, LPVOID p2, LPARAM lparam)
 	return 0;
 }
 
+/*****************************************************************************
+ * SIC_CompareSorted
+ *
+ * NOTES
+ *  Sort order of the cache: source index, then shortcut overlay flag, then
+ *  source file.  Keeping the cache sorted makes looking an icon up
+ *  logarithmic rather than linear, which matters when a big directory fills
+ *  the cache with thousands of entries.
+ */
+static INT CALLBACK SIC_CompareSorted( LPVOID p1, LPVOID p2, LPARAM lparam )
+{
+        LPSIC_ENTRY e1 = p1, e2 = p2;
+
+	if (e1->dwSourceIndex != e2->dwSourceIndex)
+	  return e1->dwSourceIndex < e2->dwSourceIndex ? -1 : 1;
+
+	if ((e1->dwFlags & GIL_FORSHORTCUT) != (e2->dwFlags & GIL_FORSHORTCUT))
+	  return (e1->dwFlags & GIL_FORSHORTCUT) ? 1 : -1;
+
+	return wcsicmp(e1->sSourceFile,e2->sSourceFile);
+}
+
 /**************************************************************************************
  *                      SIC_get_location
  *
@@ -307,7 +329,8 @@ static INT SIC_IconAppend (const WCHAR *sourcefile, INT src_index, HICON *hicons
 
     EnterCriticalSection(&SHELL32_SicCS);
 
-    index = DPA_InsertPtr(sic_hdpa, 0x7fff, entry);
+    index = DPA_Search(sic_hdpa, entry, 0, SIC_CompareSorted, 0, DPAS_SORTED | DPAS_INSERTAFTER);
+    index = DPA_InsertPtr(sic_hdpa, index, entry);
     if ( INVALID_INDEX == index )
     {
         free(entry->sSourceFile);
@@ -358,12 +381,23 @@ static INT SIC_LoadIcon (const WCHAR *sourcefile, INT index, DWORD flags)
     SIZE size;
     INT ret = -1;
 
-    for (i = 0; i < ARRAY_SIZE(hicons); i++)
+    /* Extract two sizes per pass: every PrivateExtractIconsW() call maps and
+     * parses the source file again, which dominates filling a big directory. */
+    for (i = 0; i < ARRAY_SIZE(hicons); i += 2)
     {
-        if (!get_imagelist_icon_size( i, &size ) ||
-            !PrivateExtractIconsW( sourcefile, index, size.cx, size.cy, &hicons[i], 0, 1, 0 ))
+        SIZE size2;
+
+        if (!get_imagelist_icon_size( i, &size ))
+            WARN("Failed to get icon size, list %d.\n", i);
+        else if (i + 1 < ARRAY_SIZE(hicons) && get_imagelist_icon_size( i + 1, &size2 ))
+        {
+            if (!PrivateExtractIconsW( sourcefile, index, MAKELONG(size.cx, size2.cx),
+                                       MAKELONG(size.cy, size2.cy), &hicons[i], 0, 2, 0 ))
+                WARN("Failed to load icon %d from %s.\n", index, debugstr_w(sourcefile));
+        }
+        else if (!PrivateExtractIconsW( sourcefile, index, size.cx, size.cy, &hicons[i], 0, 1, 0 ))
             WARN("Failed to load icon %d from %s.\n", index, debugstr_w(sourcefile));
-        if (!hicons[i]) goto fail;
+        if (!hicons[i] || (i + 1 < ARRAY_SIZE(hicons) && !hicons[i + 1])) goto fail;
     }
 
     if (flags & GIL_FORSHORTCUT)
@@ -546,8 +580,7 @@ INT SIC_GetIconIndex (LPCWSTR sSourceFile, INT dwSourceIndex, DWORD dwFlags )
 
 	if (NULL != DPA_GetPtr (sic_hdpa, 0))
 	{
-	  /* search linear from position 0*/
-	  index = DPA_Search (sic_hdpa, &sice, 0, SIC_CompareEntries, 0, 0);
+	  index = DPA_Search (sic_hdpa, &sice, 0, SIC_CompareSorted, 0, DPAS_SORTED);
 	}
 
 	if ( INVALID_INDEX == index )
@@ -207,6 +207,10 @@ typedef struct
     LONG         ref;
     struct list  pidls;
     struct list *current;
+    /* directory enumeration still pending behind the end of the list */
+    HANDLE       find_handle;
+    WIN32_FIND_DATAW find_data;
+    DWORD        enum_flags;
 } IEnumIDListImpl;
 
 /* Creates an IEnumIDList; add LPITEMIDLISTs to it with AddToEnumList. */
@@ -214,7 +218,8 @@ IEnumIDListImpl *IEnumIDList_Constructor(void);
 BOOL AddToEnumList(IEnumIDListImpl *list, LPITEMIDLIST pidl);
 
 /* Enumerates the folders and/or files (depending on dwFlags) in lpszPath and
- * adds them to the already-created list.
+ * adds them to the already-created list.  The directory is read on demand as
+ * the list is iterated.
  */
 BOOL CreateFolderEnumList(IEnumIDListImpl *list, LPCWSTR lpszPath, DWORD dwFlags);
 
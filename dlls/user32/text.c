@@ -38,6 +38,7 @@
 #include "user_private.h"
 #include "wine/debug.h"
 #include "wine/heap.h"
+#include "wine/list.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(text);
 
@@ -852,6 +853,197 @@ static void TEXT_DrawUnderscore (HDC hdc, int x, int y, const WCHAR *str, int of
     DeleteObject (hpen);
 }
 
+/* Measured and wrapped DrawText layouts are cached so that repeatedly
+ * painting an unchanged label does not re-measure and re-wrap it every
+ * time.  A layout stays valid as long as everything that the line breaking
+ * depends on matches: the string itself, the font (handle and LOGFONT, the
+ * latter guarding against handle reuse), the format flags, the rectangle
+ * size, the margins and the DC scaling state.
+ */
+struct cached_line
+{
+    unsigned int offset;       /* start of the line in the text buffer */
+    int len;                   /* length of the line in characters */
+    int prefix_offset;         /* offset of the underlined character, or -1 */
+    SIZE size;                 /* extent of the line */
+};
+
+struct cached_layout
+{
+    struct list entry;
+    /* key */
+    HFONT font;
+    LOGFONTW lf;
+    UINT flags;
+    int width, height;         /* size of the destination rectangle */
+    int char_extra;
+    int map_mode;
+    SIZE window_ext, viewport_ext;
+    int lmargin, rmargin;
+    int count;                 /* length of the source string */
+    WCHAR *str;                /* copy of the source string */
+    /* measured lines */
+    WCHAR *text;               /* processed text of all the lines */
+    unsigned int text_len;
+    struct cached_line *lines;
+    int line_count;
+};
+
+#define LAYOUT_CACHE_SIZE 64
+#define LAYOUT_CACHE_MAX_STRING 512
+
+static struct list layout_cache = LIST_INIT(layout_cache);
+static int layout_cache_count;
+
+static CRITICAL_SECTION layout_cs;
+static CRITICAL_SECTION_DEBUG layout_cs_debug =
+{
+    0, 0, &layout_cs,
+    { &layout_cs_debug.ProcessLocksList, &layout_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": layout_cs") }
+};
+static CRITICAL_SECTION layout_cs = { &layout_cs_debug, -1, 0, 0, 0, 0 };
+
+static void TEXT_FreeCachedLayout(struct cached_layout *layout)
+{
+    heap_free(layout->str);
+    heap_free(layout->text);
+    heap_free(layout->lines);
+    heap_free(layout);
+}
+
+/* Find a cached layout matching the key, moving it to the front of the
+ * cache so that eviction drops the least recently used one.  Called with
+ * the layout lock held.
+ */
+static struct cached_layout *TEXT_FindCachedLayout(const struct cached_layout *key, const WCHAR *str)
+{
+    struct cached_layout *layout;
+
+    LIST_FOR_EACH_ENTRY(layout, &layout_cache, struct cached_layout, entry)
+    {
+        if (layout->font != key->font || layout->flags != key->flags) continue;
+        if (layout->width != key->width || layout->height != key->height) continue;
+        if (layout->char_extra != key->char_extra || layout->map_mode != key->map_mode) continue;
+        if (memcmp(&layout->window_ext, &key->window_ext, sizeof(layout->window_ext))) continue;
+        if (memcmp(&layout->viewport_ext, &key->viewport_ext, sizeof(layout->viewport_ext))) continue;
+        if (layout->lmargin != key->lmargin || layout->rmargin != key->rmargin) continue;
+        if (layout->count != key->count || memcmp(layout->str, str, key->count * sizeof(WCHAR))) continue;
+        if (memcmp(&layout->lf, &key->lf, sizeof(layout->lf))) continue;
+        list_remove(&layout->entry);
+        list_add_head(&layout_cache, &layout->entry);
+        return layout;
+    }
+    return NULL;
+}
+
+/* Append a measured line to the layout being built */
+static BOOL TEXT_LayoutAddLine(struct cached_layout *layout, const WCHAR *text, int len,
+                               const SIZE *size, int prefix_offset)
+{
+    struct cached_line *lines;
+    WCHAR *new_text;
+
+    if (!(lines = heap_realloc(layout->lines, (layout->line_count + 1) * sizeof(*lines))))
+        return FALSE;
+    layout->lines = lines;
+    if (len)
+    {
+        if (!(new_text = heap_realloc(layout->text, (layout->text_len + len) * sizeof(WCHAR))))
+            return FALSE;
+        memcpy(new_text + layout->text_len, text, len * sizeof(WCHAR));
+        layout->text = new_text;
+    }
+    lines = &layout->lines[layout->line_count++];
+    lines->offset = layout->text_len;
+    lines->len = len;
+    lines->prefix_offset = prefix_offset;
+    lines->size = *size;
+    layout->text_len += len;
+    return TRUE;
+}
+
+/* Stow a freshly measured layout for later reuse, evicting the least
+ * recently used one once the cache is full.
+ */
+static void TEXT_CacheLayout(struct cached_layout *layout)
+{
+    struct cached_layout *lru = NULL;
+
+    EnterCriticalSection(&layout_cs);
+    list_add_head(&layout_cache, &layout->entry);
+    if (layout_cache_count < LAYOUT_CACHE_SIZE)
+        layout_cache_count++;
+    else
+    {
+        lru = LIST_ENTRY(list_tail(&layout_cache), struct cached_layout, entry);
+        list_remove(&lru->entry);
+    }
+    LeaveCriticalSection(&layout_cs);
+    if (lru) TEXT_FreeCachedLayout(lru);
+}
+
+/* Draw or measure a previously cached layout.  This must mirror the line
+ * loop in DrawTextExW below.  Called with the layout lock held.
+ */
+static int TEXT_DrawCachedLayout(HDC hdc, const struct cached_layout *layout, RECT *rect,
+                                 UINT flags, DRAWTEXTPARAMS *dtp, int x, int y, int lh,
+                                 BOOL invert_y, int ascent)
+{
+    int i, ret, max_width = 0;
+
+    for (i = 0; i < layout->line_count; i++)
+    {
+        const struct cached_line *line = &layout->lines[i];
+        const WCHAR *text = layout->text + line->offset;
+
+        if (flags & DT_CENTER)
+            x = (rect->left + layout->lmargin + rect->right - layout->rmargin - line->size.cx) / 2;
+        else if (flags & DT_RIGHT)
+            x = rect->right - line->size.cx - layout->rmargin;
+
+        if (flags & DT_SINGLELINE)
+        {
+            if (flags & DT_VCENTER) y = rect->top +
+                (rect->bottom - rect->top) / 2 - line->size.cy / 2;
+            else if (flags & DT_BOTTOM) y = rect->bottom - line->size.cy;
+        }
+
+        if (!(flags & DT_CALCRECT))
+        {
+            if (!ExtTextOutW( hdc, x, y,
+                             ((flags & DT_NOCLIP) ? 0 : ETO_CLIPPED) |
+                             ((flags & DT_RTLREADING) ? ETO_RTLREADING : 0),
+                             rect, text, line->len, NULL ))
+                return 0;
+            if (line->prefix_offset != -1 && line->prefix_offset < line->len)
+                TEXT_DrawUnderscore (hdc, x, y + ascent + 1, text, line->prefix_offset,
+                                     (flags & DT_NOCLIP) ? NULL : rect);
+        }
+        else if (line->size.cx > max_width)
+            max_width = line->size.cx;
+
+        if (invert_y)
+            y -= lh;
+        else
+            y += lh;
+        if (dtp && (flags & DT_CALCRECT))
+            dtp->uiLengthDrawn += line->len;
+    }
+
+    if (flags & DT_CALCRECT)
+    {
+        rect->right = rect->left + max_width;
+        rect->bottom = y;
+        if (dtp)
+            rect->right += layout->lmargin + layout->rmargin;
+    }
+
+    ret = y - rect->top;
+    if (ret == 0) ret = 1;
+    return ret;
+}
+
 /***********************************************************************
  *           DrawTextExW    (USER32.@)
  *
@@ -881,6 +1073,8 @@ INT WINAPI DrawTextExW( HDC hdc, LPWSTR str, INT i_count,
     int prefix_offset;
     ellipsis_data ellip;
     BOOL invert_y=FALSE;
+    struct cached_layout layout_key, *layout = NULL;
+    BOOL cacheable = FALSE;
     int ret = 0;
 
     TRACE("%s, %d, [%s] %08x\n", debugstr_wn (str, count), count,
@@ -958,6 +1152,51 @@ INT WINAPI DrawTextExW( HDC hdc, LPWSTR str, INT i_count,
 
     if (flags & DT_CALCRECT) flags |= DT_NOCLIP;
 
+    if (count <= LAYOUT_CACHE_MAX_STRING && !(flags & (DT_MODIFYSTRING | DT_EXPANDTABS))
+        && GetGraphicsMode(hdc) == GM_COMPATIBLE)
+    {
+        memset(&layout_key, 0, sizeof(layout_key));
+        layout_key.font = GetCurrentObject(hdc, OBJ_FONT);
+        layout_key.flags = flags;
+        layout_key.width = rect->right - rect->left;
+        layout_key.height = rect->bottom - rect->top;
+        layout_key.char_extra = GetTextCharacterExtra(hdc);
+        layout_key.map_mode = GetMapMode(hdc);
+        GetWindowExtEx(hdc, &layout_key.window_ext);
+        GetViewportExtEx(hdc, &layout_key.viewport_ext);
+        layout_key.lmargin = lmargin;
+        layout_key.rmargin = rmargin;
+        layout_key.count = count;
+        cacheable = layout_key.font &&
+                    GetObjectW(layout_key.font, sizeof(layout_key.lf), &layout_key.lf);
+    }
+    if (cacheable)
+    {
+        EnterCriticalSection(&layout_cs);
+        if ((layout = TEXT_FindCachedLayout(&layout_key, str)))
+            ret = TEXT_DrawCachedLayout(hdc, layout, rect, flags, dtp, x, y, lh,
+                                        invert_y, tm.tmAscent);
+        LeaveCriticalSection(&layout_cs);
+        if (layout) return ret;
+
+        /* not found: build the layout as the lines are measured */
+        if ((layout = heap_alloc(sizeof(*layout))))
+        {
+            *layout = layout_key;
+            layout->text = NULL;
+            layout->text_len = 0;
+            layout->lines = NULL;
+            layout->line_count = 0;
+            if ((layout->str = heap_alloc(count * sizeof(WCHAR))))
+                memcpy(layout->str, str, count * sizeof(WCHAR));
+            else
+            {
+                heap_free(layout);
+                layout = NULL;
+            }
+        }
+    }
+
     if (flags & DT_MODIFYSTRING)
     {
         size_retstr = (count + 4) * sizeof (WCHAR);
@@ -980,6 +1219,12 @@ INT WINAPI DrawTextExW( HDC hdc, LPWSTR str, INT i_count,
             last_line = !(flags & DT_NOCLIP) && y + ((flags & DT_EDITCONTROL) ? 2*lh-1 : lh) > rect->bottom;
 	strPtr = TEXT_NextLineW(hdc, strPtr, &count, line, &len, width, flags, &size, last_line, retstr, tabwidth, &prefix_offset, &ellip);
 
+        if (layout && !TEXT_LayoutAddLine(layout, line, len, &size, prefix_offset))
+        {
+            TEXT_FreeCachedLayout(layout);
+            layout = NULL;
+        }
+
         if (flags & DT_CENTER)
             x = (rect->left + lmargin + rect->right - rmargin - size.cx) / 2;
         else if (flags & DT_RIGHT)
@@ -1068,7 +1313,14 @@ INT WINAPI DrawTextExW( HDC hdc, LPWSTR str, INT i_count,
 
     ret = y - rect->top;
     if (ret == 0) ret = 1;
+
+    if (layout)
+    {
+        TEXT_CacheLayout(layout);
+        layout = NULL;
+    }
 done:
+    if (layout) TEXT_FreeCachedLayout(layout);
     heap_free(retstr);
     return ret;
 }
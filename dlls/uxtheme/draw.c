@@ -740,6 +740,81 @@ static HRESULT get_image_part_size(HTHEME hTheme, int iPartId, int iStateId, REC
     return hr;
 }
 
+/* Number of pre-rendered part backgrounds kept per theme file */
+#define RENDER_CACHE_SIZE 64
+
+/***********************************************************************
+ *      UXTHEME_FindCachedRender
+ *
+ * Look up a pre-rendered part background in the theme file cache. Found
+ * entries move to the front of the list so that eviction drops the least
+ * recently used one.
+ */
+static PTHEME_RENDER UXTHEME_FindCachedRender(PTHEME_CLASS tc, int iPartId, int iStateId,
+                                              int width, int height)
+{
+    PTHEME_RENDER render, *prev = &tc->tf->renders;
+
+    while ((render = *prev))
+    {
+        if (render->tc == tc && render->iPartId == iPartId && render->iStateId == iStateId
+            && render->width == width && render->height == height && render->dpi == tc->dpi)
+        {
+            *prev = render->next;
+            render->next = tc->tf->renders;
+            tc->tf->renders = render;
+            TRACE ("found %p for part/state %d/%d at %dx%d\n", render, iPartId, iStateId, width, height);
+            return render;
+        }
+        prev = &render->next;
+    }
+    return NULL;
+}
+
+/***********************************************************************
+ *      UXTHEME_CacheRender
+ *
+ * Stow a pre-rendered part background for later reuse, evicting the least
+ * recently used entry once the cache is full.
+ */
+static void UXTHEME_CacheRender(PTHEME_CLASS tc, PTHEME_RENDER render)
+{
+    PTHEME_RENDER *prev = &tc->tf->renders;
+
+    render->next = *prev;
+    *prev = render;
+    if (tc->tf->renderCount < RENDER_CACHE_SIZE)
+    {
+        tc->tf->renderCount++;
+        return;
+    }
+    while ((*prev)->next) prev = &(*prev)->next;
+    DeleteObject ((*prev)->image);
+    free(*prev);
+    *prev = NULL;
+}
+
+/***********************************************************************
+ *      UXTHEME_PresentRender
+ *
+ * Blit a pre-rendered part background to its destination.
+ */
+static BOOL UXTHEME_PresentRender(HDC hdc, const RECT *pRect, PTHEME_RENDER render)
+{
+    HGDIOBJ oldSrc;
+    HDC hdcSrc;
+    BOOL ret;
+
+    hdcSrc = CreateCompatibleDC(hdc);
+    if(!hdcSrc) return FALSE;
+    oldSrc = SelectObject(hdcSrc, render->image);
+    ret = UXTHEME_Blt(hdc, pRect->left, pRect->top, render->width, render->height,
+                      hdcSrc, 0, 0, render->transparent, render->transparentcolor);
+    SelectObject(hdcSrc, oldSrc);
+    DeleteDC(hdcSrc);
+    return ret;
+}
+
 /***********************************************************************
  *      UXTHEME_DrawImageBackground
  *
@@ -763,6 +838,20 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
     INT transparent;
     COLORREF transparentcolor = 0;
     BOOL hasAlpha, hasDefaultTransparentColour;
+    BOOL cacheable, borderonly = FALSE;
+    HBITMAP bmpCache = NULL;
+    PTHEME_RENDER render;
+
+    /* Parts already rendered at this size need nothing but a blit. Mirrored
+     * destinations (negative extents) always take the direct path. */
+    cacheable = pRect->right > pRect->left && pRect->bottom > pRect->top;
+    if (cacheable && (render = UXTHEME_FindCachedRender(hTheme, iPartId, iStateId,
+                                                        pRect->right - pRect->left,
+                                                        pRect->bottom - pRect->top)))
+    {
+        if (UXTHEME_PresentRender(hdc, pRect, render)) return S_OK;
+        return HRESULT_FROM_WIN32(GetLastError());
+    }
 
     hr = UXTHEME_LoadImage(hTheme, iPartId, iStateId, pRect, FALSE, &bmpSrc, &rcSrc, &hasAlpha,
                            &hasDefaultTransparentColour, NULL);
@@ -808,7 +897,9 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
             hr = HRESULT_FROM_WIN32(GetLastError());
     }
     else {
+        HGDIOBJ oldDst = NULL;
         HDC hdcDst = NULL;
+        INT blitTransparent;
         MARGINS sm;
         POINT org;
 
@@ -830,13 +921,57 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
             }
         }
 
-        hdcDst = hdc;
-        OffsetViewportOrgEx(hdcDst, rcDst.left, rcDst.top, &org);
+        GetThemeBool(hTheme, iPartId, iStateId, TMT_BORDERONLY, &borderonly);
+
+        destCenterWidth  = dstSize.x - (sm.cxLeftWidth + sm.cxRightWidth);
+        srcCenterWidth   = srcSize.x - (sm.cxLeftWidth + sm.cxRightWidth);
+        destCenterHeight = dstSize.y - (sm.cyTopHeight + sm.cyBottomHeight);
+        srcCenterHeight  = srcSize.y - (sm.cyTopHeight + sm.cyBottomHeight);
+
+        /* An opaque cached bitmap must end up fully painted, or pixels the
+         * direct path leaves alone would get blitted to the destination.
+         * Colour-keyed parts also stay on the direct path: their key applies
+         * to the source pixels, before any stretching. */
+        if (transparent == ALPHABLEND_BINARY
+            || (transparent == ALPHABLEND_NONE
+                && (borderonly || (destCenterWidth > 0 && srcCenterWidth <= 0)
+                    || (destCenterHeight > 0 && srcCenterHeight <= 0))))
+            cacheable = FALSE;
+
+        if (cacheable)
+        {
+            BITMAPINFO bitmap_info = {{0}};
+
+            bitmap_info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+            bitmap_info.bmiHeader.biWidth = dstSize.x;
+            bitmap_info.bmiHeader.biHeight = -dstSize.y;
+            bitmap_info.bmiHeader.biPlanes = 1;
+            bitmap_info.bmiHeader.biBitCount = 32;
+            bitmap_info.bmiHeader.biCompression = BI_RGB;
+            bmpCache = CreateDIBSection(hdc, &bitmap_info, DIB_RGB_COLORS, NULL, NULL, 0);
+        }
+        if (bmpCache && (hdcDst = CreateCompatibleDC(hdc)))
+        {
+            /* Render raw pixels into the cache bitmap; transparency is
+             * applied when it is blitted to the destination. */
+            oldDst = SelectObject(hdcDst, bmpCache);
+            blitTransparent = ALPHABLEND_NONE;
+        }
+        else
+        {
+            if (bmpCache) {
+                DeleteObject(bmpCache);
+                bmpCache = NULL;
+            }
+            hdcDst = hdc;
+            OffsetViewportOrgEx(hdcDst, rcDst.left, rcDst.top, &org);
+            blitTransparent = transparent;
+        }
 
         /* Upper left corner */
         if(!UXTHEME_Blt(hdcDst, 0, 0, sm.cxLeftWidth, sm.cyTopHeight,
                         hdcSrc, rcSrc.left, rcSrc.top, 
-                        transparent, transparentcolor)) {
+                        blitTransparent, transparentcolor)) {
             hr = HRESULT_FROM_WIN32(GetLastError());
             goto draw_error; 
         }
@@ -844,7 +979,7 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
         if(!UXTHEME_Blt (hdcDst, dstSize.x-sm.cxRightWidth, 0, 
                          sm.cxRightWidth, sm.cyTopHeight,
                          hdcSrc, rcSrc.right-sm.cxRightWidth, rcSrc.top, 
-                         transparent, transparentcolor)) {
+                         blitTransparent, transparentcolor)) {
             hr = HRESULT_FROM_WIN32(GetLastError());
             goto draw_error; 
         }
@@ -852,7 +987,7 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
         if(!UXTHEME_Blt (hdcDst, 0, dstSize.y-sm.cyBottomHeight, 
                          sm.cxLeftWidth, sm.cyBottomHeight,
                          hdcSrc, rcSrc.left, rcSrc.bottom-sm.cyBottomHeight, 
-                         transparent, transparentcolor)) {
+                         blitTransparent, transparentcolor)) {
             hr = HRESULT_FROM_WIN32(GetLastError());
             goto draw_error; 
         }
@@ -860,23 +995,18 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
         if(!UXTHEME_Blt (hdcDst, dstSize.x-sm.cxRightWidth, dstSize.y-sm.cyBottomHeight, 
                          sm.cxRightWidth, sm.cyBottomHeight,
                          hdcSrc, rcSrc.right-sm.cxRightWidth, rcSrc.bottom-sm.cyBottomHeight, 
-                         transparent, transparentcolor)) {
+                         blitTransparent, transparentcolor)) {
             hr = HRESULT_FROM_WIN32(GetLastError());
             goto draw_error; 
         }
 
-        destCenterWidth  = dstSize.x - (sm.cxLeftWidth + sm.cxRightWidth);
-        srcCenterWidth   = srcSize.x - (sm.cxLeftWidth + sm.cxRightWidth);
-        destCenterHeight = dstSize.y - (sm.cyTopHeight + sm.cyBottomHeight);
-        srcCenterHeight  = srcSize.y - (sm.cyTopHeight + sm.cyBottomHeight);
-
         if(destCenterWidth > 0) {
             /* Center top */
             if(!UXTHEME_SizedBlt (hdcDst, sm.cxLeftWidth, 0,
                                   destCenterWidth, sm.cyTopHeight,
                                   hdcSrc, rcSrc.left+sm.cxLeftWidth, rcSrc.top,
                                   srcCenterWidth, sm.cyTopHeight,
-                                  sizingtype, transparent, transparentcolor)) {
+                                  sizingtype, blitTransparent, transparentcolor)) {
                 hr = HRESULT_FROM_WIN32(GetLastError());
                 goto draw_error;
             }
@@ -885,7 +1015,7 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
                                   destCenterWidth, sm.cyBottomHeight,
                                   hdcSrc, rcSrc.left+sm.cxLeftWidth, rcSrc.bottom-sm.cyBottomHeight,
                                   srcCenterWidth, sm.cyBottomHeight,
-                                  sizingtype, transparent, transparentcolor)) {
+                                  sizingtype, blitTransparent, transparentcolor)) {
                 hr = HRESULT_FROM_WIN32(GetLastError());
                 goto draw_error;
             }
@@ -897,7 +1027,7 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
                                   hdcSrc, rcSrc.left, rcSrc.top+sm.cyTopHeight,
                                   sm.cxLeftWidth, srcCenterHeight,
                                   sizingtype,
-                                  transparent, transparentcolor)) {
+                                  blitTransparent, transparentcolor)) {
                 hr = HRESULT_FROM_WIN32(GetLastError());
                 goto draw_error;
             }
@@ -906,21 +1036,19 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
                                   sm.cxRightWidth, destCenterHeight,
                                   hdcSrc, rcSrc.right-sm.cxRightWidth, rcSrc.top+sm.cyTopHeight,
                                   sm.cxRightWidth, srcCenterHeight,
-                                  sizingtype, transparent, transparentcolor)) {
+                                  sizingtype, blitTransparent, transparentcolor)) {
                 hr = HRESULT_FROM_WIN32(GetLastError());
                 goto draw_error;
             }
         }
         if(destCenterHeight > 0 && destCenterWidth > 0) {
-            BOOL borderonly = FALSE;
-            GetThemeBool(hTheme, iPartId, iStateId, TMT_BORDERONLY, &borderonly);
             if(!borderonly) {
                 /* Center */
                 if(!UXTHEME_SizedBlt (hdcDst, sm.cxLeftWidth, sm.cyTopHeight,
                                       destCenterWidth, destCenterHeight,
                                       hdcSrc, rcSrc.left+sm.cxLeftWidth, rcSrc.top+sm.cyTopHeight,
                                       srcCenterWidth, srcCenterHeight,
-                                      sizingtype, transparent, transparentcolor)) {
+                                      sizingtype, blitTransparent, transparentcolor)) {
                     hr = HRESULT_FROM_WIN32(GetLastError());
                     goto draw_error; 
                 }
@@ -928,7 +1056,35 @@ static HRESULT UXTHEME_DrawImageBackground(HTHEME hTheme, HDC hdc, int iPartId,
         }
 
 draw_error:
-        SetViewportOrgEx (hdcDst, org.x, org.y, NULL);
+        if (bmpCache)
+        {
+            SelectObject(hdcDst, oldDst);
+            DeleteDC(hdcDst);
+            if (SUCCEEDED(hr))
+            {
+                if ((render = malloc(sizeof(*render))))
+                {
+                    render->tc = hTheme;
+                    render->iPartId = iPartId;
+                    render->iStateId = iStateId;
+                    render->width = dstSize.x;
+                    render->height = dstSize.y;
+                    render->dpi = MSSTYLES_GetThemeDPI(hTheme);
+                    render->transparent = transparent;
+                    render->transparentcolor = transparentcolor;
+                    render->image = bmpCache;
+                    UXTHEME_CacheRender(hTheme, render);
+                    bmpCache = NULL;
+                    if (!UXTHEME_PresentRender(hdc, &rcDst, render))
+                        hr = HRESULT_FROM_WIN32(GetLastError());
+                }
+                else
+                    hr = E_OUTOFMEMORY;
+            }
+            if (bmpCache) DeleteObject(bmpCache);
+        }
+        else
+            SetViewportOrgEx (hdcDst, org.x, org.y, NULL);
     }
     SelectObject(hdcSrc, oldSrc);
     DeleteDC(hdcSrc);
@@ -220,6 +220,13 @@ void MSSTYLES_CloseThemeFile(PTHEME_FILE tf)
                 DeleteObject (img->image);
                 free(img);
             }
+            while (tf->renders)
+            {
+                PTHEME_RENDER render = tf->renders;
+                tf->renders = render->next;
+                DeleteObject (render->image);
+                free(render);
+            }
             free(tf);
         }
     }
@@ -69,10 +69,25 @@ typedef struct _THEME_IMAGE {
     HBITMAP image;
     unsigned int hasAlpha : 1;
     unsigned int hasDefaultTransparentColour : 1;
-    
+
     struct _THEME_IMAGE *next;
 } THEME_IMAGE, *PTHEME_IMAGE;
 
+/* Part background pre-rendered at its final size, kept in MRU order */
+typedef struct _THEME_RENDER {
+    struct _THEME_CLASS *tc;
+    int iPartId;
+    int iStateId;
+    int width;
+    int height;
+    UINT dpi;
+    INT transparent;
+    COLORREF transparentcolor;
+    HBITMAP image;
+
+    struct _THEME_RENDER *next;
+} THEME_RENDER, *PTHEME_RENDER;
+
 typedef struct _THEME_FILE {
     LONG refcount;
     HMODULE hTheme;
@@ -86,6 +101,8 @@ typedef struct _THEME_FILE {
     PTHEME_CLASS classes;
     PTHEME_PROPERTY metrics;
     PTHEME_IMAGE images;
+    PTHEME_RENDER renders;
+    int renderCount;
 } THEME_FILE, *PTHEME_FILE;
 
 typedef struct _UXINI_FILE *PUXINI_FILE;
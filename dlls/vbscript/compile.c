@@ -1833,10 +1833,10 @@ static HRESULT compile_class(compile_ctx_t *ctx, class_decl_t *class_decl)
     return S_OK;
 }
 
-static BOOL lookup_script_identifier(compile_ctx_t *ctx, script_ctx_t *script, const WCHAR *identifier)
+static BOOL lookup_script_identifier(script_ctx_t *script, vbscode_t *new_code, const WCHAR *identifier)
 {
     ScriptDisp *contexts[] = {
-        ctx->code->named_item ? ctx->code->named_item->script_obj : NULL,
+        new_code->named_item ? new_code->named_item->script_obj : NULL,
         script->script_obj
     };
     class_desc_t *class;
@@ -1867,7 +1867,7 @@ static BOOL lookup_script_identifier(compile_ctx_t *ctx, script_ctx_t *script, c
         var_desc_t *vars = code->main_code.vars;
         function_t *func;
 
-        if(!code->pending_exec || (code->named_item && code->named_item != ctx->code->named_item))
+        if(!code->pending_exec || (code->named_item && code->named_item != new_code->named_item))
             continue;
 
         for(i = 0; i < var_cnt; i++) {
@@ -1889,21 +1889,21 @@ static BOOL lookup_script_identifier(compile_ctx_t *ctx, script_ctx_t *script, c
     return FALSE;
 }
 
-static HRESULT check_script_collisions(compile_ctx_t *ctx, script_ctx_t *script)
+static HRESULT check_script_collisions(script_ctx_t *script, vbscode_t *new_code)
 {
-    unsigned i, var_cnt = ctx->code->main_code.var_cnt;
-    var_desc_t *vars = ctx->code->main_code.vars;
+    unsigned i, var_cnt = new_code->main_code.var_cnt;
+    var_desc_t *vars = new_code->main_code.vars;
     class_desc_t *class;
 
     for(i = 0; i < var_cnt; i++) {
-        if(lookup_script_identifier(ctx, script, vars[i].name)) {
+        if(lookup_script_identifier(script, new_code, vars[i].name)) {
             FIXME("%s: redefined\n", debugstr_w(vars[i].name));
             return E_FAIL;
         }
     }
 
-    for(class = ctx->code->classes; class; class = class->next) {
-        if(lookup_script_identifier(ctx, script, class->name)) {
+    for(class = new_code->classes; class; class = class->next) {
+        if(lookup_script_identifier(script, new_code, class->name)) {
             FIXME("%s: redefined\n", debugstr_w(class->name));
             return E_FAIL;
         }
@@ -1912,26 +1912,137 @@ static HRESULT check_script_collisions(compile_ctx_t *ctx, script_ctx_t *script)
     return S_OK;
 }
 
-void release_vbscode(vbscode_t *code)
+/* Script hosts commonly recompile identical source, e.g. on every reload of a
+ * page. Instead of freeing released code right away, the last few compilations
+ * are kept in a list and handed back to compile_script when the source and all
+ * inputs affecting the compilation match. Cached code is owned exclusively by
+ * the cache, so reusing it is just a matter of resetting the per-instance
+ * state. Objects allocated from the code heap pool may still be referenced by
+ * live objects of the thread that compiled them, so each entry is tagged with
+ * the releasing thread id and is only ever reused or freed on that thread
+ * (except at process detach). */
+#define CODE_CACHE_SIZE 8
+
+static struct list code_cache = LIST_INIT(code_cache);
+
+static CRITICAL_SECTION code_cache_cs;
+static CRITICAL_SECTION_DEBUG code_cache_cs_debug =
 {
-    unsigned i;
+    0, 0, &code_cache_cs,
+    { &code_cache_cs_debug.ProcessLocksList, &code_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": code_cache_cs") }
+};
+static CRITICAL_SECTION code_cache_cs = { &code_cache_cs_debug, -1, 0, 0, 0, 0 };
 
-    if(--code->ref)
-        return;
+static unsigned hash_source(const WCHAR *p)
+{
+    unsigned hash = 5381;
+    for(; *p; p++)
+        hash = hash * 33 + *p;
+    return hash;
+}
+
+static void free_vbscode(vbscode_t *code)
+{
+    unsigned i;
 
     for(i=0; i < code->bstr_cnt; i++)
         SysFreeString(code->bstr_pool[i]);
 
-    if(code->named_item)
-        release_named_item(code->named_item);
     heap_pool_free(&code->heap);
 
     free(code->bstr_pool);
+    free(code->compile_delimiter);
     free(code->source);
     free(code->instrs);
     free(code);
 }
 
+static vbscode_t *find_cached_code(script_ctx_t *script, const WCHAR *src, const WCHAR *delimiter, DWORD flags)
+{
+    DWORD thread_id = GetCurrentThreadId();
+    unsigned hash = hash_source(src);
+    vbscode_t *code;
+
+    EnterCriticalSection(&code_cache_cs);
+
+    LIST_FOR_EACH_ENTRY(code, &code_cache, vbscode_t, entry) {
+        if(code->cache_thread_id != thread_id)
+            continue;
+        if(code->source_hash != hash || code->compile_flags != flags || code->compile_lcid != script->lcid)
+            continue;
+        if(wcscmp(code->source, src))
+            continue;
+        if(!code->compile_delimiter != !delimiter
+           || (delimiter && wcscmp(code->compile_delimiter, delimiter)))
+            continue;
+
+        list_remove(&code->entry);
+        LeaveCriticalSection(&code_cache_cs);
+
+        code->ref = 1;
+        TRACE("reusing %p\n", code);
+        return code;
+    }
+
+    LeaveCriticalSection(&code_cache_cs);
+    return NULL;
+}
+
+void release_vbscode(vbscode_t *code)
+{
+    vbscode_t *iter, *evict = NULL;
+    unsigned cnt = 0;
+
+    if(--code->ref)
+        return;
+
+    if(code->named_item) {
+        release_named_item(code->named_item);
+        code->named_item = NULL;
+    }
+
+    if(!code->cacheable) {
+        free_vbscode(code);
+        return;
+    }
+
+    /* reset the state exec_global_code set up */
+    if(code->last_class) {
+        code->last_class->next = NULL;
+        code->last_class = NULL;
+    }
+    code->pending_exec = FALSE;
+    code->is_persistent = FALSE;
+    code->cache_thread_id = GetCurrentThreadId();
+
+    EnterCriticalSection(&code_cache_cs);
+    list_add_head(&code_cache, &code->entry);
+    /* only entries from the current thread count against the quota, and only
+     * those may be evicted; the oldest one is the last match from the head */
+    LIST_FOR_EACH_ENTRY(iter, &code_cache, vbscode_t, entry) {
+        if(iter->cache_thread_id != code->cache_thread_id)
+            continue;
+        if(++cnt > CODE_CACHE_SIZE)
+            evict = iter;
+    }
+    if(evict)
+        list_remove(&evict->entry);
+    LeaveCriticalSection(&code_cache_cs);
+
+    if(evict)
+        free_vbscode(evict);
+}
+
+void free_vbscode_cache(void)
+{
+    vbscode_t *code, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE(code, next, &code_cache, vbscode_t, entry)
+        free_vbscode(code);
+    list_init(&code_cache);
+}
+
 static vbscode_t *alloc_vbscode(compile_ctx_t *ctx, const WCHAR *source, DWORD_PTR cookie, unsigned start_line)
 {
     vbscode_t *ret;
@@ -2003,6 +2114,24 @@ HRESULT compile_script(script_ctx_t *script, const WCHAR *src, const WCHAR *item
         if(!item->script_obj) item = NULL;
     }
 
+    if(src && (code = find_cached_code(script, src, delimiter, flags & ~SCRIPTTEXT_ISPERSISTENT))) {
+        code->cookie = cookie;
+        code->start_line = start_line;
+        if(item) {
+            code->named_item = item;
+            item->ref++;
+        }
+        hres = check_script_collisions(script, code);
+        if(SUCCEEDED(hres)) {
+            code->is_persistent = (flags & SCRIPTTEXT_ISPERSISTENT) != 0;
+            list_add_tail(&script->code_list, &code->entry);
+            *ret = code;
+            return S_OK;
+        }
+        /* let a full compilation report the error */
+        release_vbscode(code);
+    }
+
     memset(&ctx, 0, sizeof(ctx));
     code = ctx.code = alloc_vbscode(&ctx, src, cookie, start_line);
     if(!ctx.code)
@@ -2055,7 +2184,7 @@ HRESULT compile_script(script_ctx_t *script, const WCHAR *src, const WCHAR *item
         }
     }
 
-    hres = check_script_collisions(&ctx, script);
+    hres = check_script_collisions(script, code);
     if(FAILED(hres)) {
         hres = compile_error(script, &ctx, hres);
         release_compiler(&ctx);
@@ -2070,6 +2199,11 @@ HRESULT compile_script(script_ctx_t *script, const WCHAR *src, const WCHAR *item
     ctx.code = NULL;
     release_compiler(&ctx);
 
+    code->source_hash = hash_source(code->source);
+    code->compile_flags = flags & ~SCRIPTTEXT_ISPERSISTENT;
+    code->compile_lcid = script->lcid;
+    code->cacheable = !delimiter || !!(code->compile_delimiter = wcsdup(delimiter));
+
     list_add_tail(&script->code_list, &code->entry);
     *ret = code;
     return S_OK;
@@ -2087,6 +2221,9 @@ HRESULT compile_procedure(script_ctx_t *script, const WCHAR *src, const WCHAR *i
     if(FAILED(hres))
         return hres;
 
+    /* the class data below is allocated from the code heap, so this code can't be reused */
+    code->cacheable = FALSE;
+
     if(!(desc = compiler_alloc_zero(code, sizeof(*desc))))
         return E_OUTOFMEMORY;
     if(!(desc->funcs = compiler_alloc_zero(code, sizeof(*desc->funcs))))
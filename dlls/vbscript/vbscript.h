@@ -362,6 +362,14 @@ struct _vbscode_t {
     DWORD_PTR cookie;
     unsigned start_line;
 
+    /* reuse cache key, valid when cacheable is set, see find_cached_code() */
+    BOOL cacheable;
+    unsigned source_hash;
+    DWORD compile_flags;
+    LCID compile_lcid;
+    WCHAR *compile_delimiter;
+    DWORD cache_thread_id;
+
     BOOL option_explicit;
 
     BOOL pending_exec;
@@ -387,6 +395,7 @@ static inline void grab_vbscode(vbscode_t *code)
 }
 
 void release_vbscode(vbscode_t*);
+void free_vbscode_cache(void);
 HRESULT compile_script(script_ctx_t*,const WCHAR*,const WCHAR*,const WCHAR*,DWORD_PTR,unsigned,DWORD,vbscode_t**);
 HRESULT compile_procedure(script_ctx_t*,const WCHAR*,const WCHAR*,const WCHAR*,DWORD_PTR,unsigned,DWORD,class_desc_t**);
 HRESULT exec_script(script_ctx_t*,BOOL,function_t*,vbdisp_t*,DISPPARAMS*,VARIANT*);
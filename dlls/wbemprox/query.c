@@ -702,7 +702,17 @@ static HRESULT exec_select_view( struct view *view )
     if (!view->table_count) return S_OK;
 
     table = view->table[0];
-    if (table->fill) status = table->fill( table, view->cond );
+    if (table->fill_time && GetTickCount64() - table->fill_time > SNAPSHOT_TTL)
+    {
+        for (i = 0; i < table->num_rows; i++) free_row_values( table, i );
+        table->num_rows = 0;
+        table->fill_time = 0;
+    }
+    if (table->fill && !table->fill_time)
+    {
+        status = table->fill( table, view->cond );
+        if (status == FILL_STATUS_UNFILTERED) cache_table_snapshot( view->ns, table );
+    }
     if (status == FILL_STATUS_FAILED) return WBEM_E_FAILED;
 
     if (!table->num_rows) return S_OK;
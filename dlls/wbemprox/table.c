@@ -370,9 +370,77 @@ static struct column *dup_columns( const struct column *src, UINT count )
     return dst;
 }
 
+static struct array *dup_array( const struct array *src, CIMTYPE basetype )
+{
+    struct array *dst;
+    UINT i;
+
+    if (!(dst = malloc( sizeof(*dst) ))) return NULL;
+    dst->elem_size = src->elem_size;
+    dst->count     = src->count;
+    if (!(dst->ptr = calloc( src->count, src->elem_size )))
+    {
+        free( dst );
+        return NULL;
+    }
+    if (basetype == CIM_STRING || basetype == CIM_DATETIME || basetype == CIM_REFERENCE)
+    {
+        for (i = 0; i < src->count; i++)
+        {
+            const WCHAR *str = *(const WCHAR **)((char *)src->ptr + i * src->elem_size);
+            if (str && !(*(WCHAR **)((char *)dst->ptr + i * dst->elem_size) = wcsdup( str )))
+            {
+                destroy_array( dst, basetype );
+                return NULL;
+            }
+        }
+    }
+    else memcpy( dst->ptr, src->ptr, src->count * src->elem_size );
+    return dst;
+}
+
+/* replace the dynamic values of a row copied with memcpy by copies it owns;
+ * on failure the row is still safe to pass to free_row_values */
+static BOOL dup_row_values( const struct table *table, UINT row )
+{
+    BYTE *ptr = table->data + row * get_row_size( table );
+    UINT i, j, type;
+
+    for (i = 0; i < table->num_cols; i++)
+    {
+        void **val = (void **)(ptr + get_column_offset( table, i ));
+
+        if (!(table->columns[i].type & COL_FLAG_DYNAMIC)) continue;
+
+        type = table->columns[i].type & COL_TYPE_MASK;
+        if (type == CIM_STRING || type == CIM_DATETIME || type == CIM_REFERENCE)
+        {
+            if (*val && !(*val = wcsdup( *val ))) goto error;
+        }
+        else if (type & CIM_FLAG_ARRAY)
+        {
+            if (*val && !(*val = dup_array( *val, type & CIM_TYPE_MASK ))) goto error;
+        }
+    }
+    return TRUE;
+
+error:
+    /* clear the values still shared with the source row */
+    for (j = i + 1; j < table->num_cols; j++)
+    {
+        if (!(table->columns[j].type & COL_FLAG_DYNAMIC)) continue;
+
+        type = table->columns[j].type & COL_TYPE_MASK;
+        if (type == CIM_STRING || type == CIM_DATETIME || type == CIM_REFERENCE || (type & CIM_FLAG_ARRAY))
+            *(void **)(ptr + get_column_offset( table, j )) = NULL;
+    }
+    return FALSE;
+}
+
 static struct table *dup_table( const struct table *src )
 {
     struct table *dst;
+    UINT i;
 
     if (!(dst = alloc_table())) return NULL;
     if (!(dst->name = wcsdup( src->name )))
@@ -397,12 +465,33 @@ static struct table *dup_table( const struct table *src )
         }
         memcpy( dst->data, src->data, size );
         dst->num_rows = dst->num_rows_allocated = src->num_rows;
+        for (i = 0; i < dst->num_rows; i++)
+        {
+            if (!dup_row_values( dst, i ))
+            {
+                dst->num_rows = i + 1;
+                free_table( dst );
+                return NULL;
+            }
+        }
     }
     dst->fill = src->fill;
+    dst->fill_time = src->fill_time;
 
     return dst;
 }
 
+static void free_snapshot( struct table *table )
+{
+    UINT i;
+
+    for (i = 0; i < table->num_rows; i++) free_row_values( table, i );
+    free( table->data );
+    table->data = NULL;
+    table->num_rows = table->num_rows_allocated = 0;
+    table->fill_time = 0;
+}
+
 struct table *create_table( enum wbm_namespace ns, const WCHAR *name )
 {
     struct table *iter, *table;
@@ -415,6 +504,8 @@ struct table *create_table( enum wbm_namespace ns, const WCHAR *name )
     {
         if (name && !wcsicmp( iter->name, name ))
         {
+            if (iter->fill_time && GetTickCount64() - iter->fill_time > SNAPSHOT_TTL)
+                free_snapshot( iter );
             if ((table = dup_table( iter )))
             {
                 TRACE("returning %p\n", table);
@@ -452,6 +543,36 @@ BOOL add_table( enum wbm_namespace ns, struct table *table )
     return TRUE;
 }
 
+/* store a copy of a freshly filled table's rows so that queries arriving
+ * within the TTL don't have to build the snapshot again */
+void cache_table_snapshot( enum wbm_namespace ns, const struct table *table )
+{
+    struct table *iter, *copy;
+
+    if (ns == WBEMPROX_NAMESPACE_LAST || !table->fill || !table->num_rows) return;
+    if (!(copy = dup_table( table ))) return;
+
+    EnterCriticalSection( &table_list_cs );
+
+    LIST_FOR_EACH_ENTRY( iter, table_list[ns], struct table, entry )
+    {
+        if (iter->fill == table->fill && !wcsicmp( iter->name, table->name ))
+        {
+            free_snapshot( iter );
+            iter->data = copy->data;
+            iter->num_rows = copy->num_rows;
+            iter->num_rows_allocated = copy->num_rows_allocated;
+            iter->fill_time = GetTickCount64();
+            copy->data = NULL;
+            copy->num_rows = copy->num_rows_allocated = 0;
+            break;
+        }
+    }
+
+    LeaveCriticalSection( &table_list_cs );
+    free_table( copy );
+}
+
 BSTR get_method_name( enum wbm_namespace ns, const WCHAR *class, UINT index )
 {
     struct table *table;
@@ -109,6 +109,9 @@ enum fill_status
 
 #define TABLE_FLAG_DYNAMIC 0x00000001
 
+/* how long filled rows stay valid as a snapshot for later queries, in ms */
+#define SNAPSHOT_TTL 1000
+
 struct table
 {
     const WCHAR *name;
@@ -118,6 +121,7 @@ struct table
     UINT num_rows_allocated;
     BYTE *data;
     enum fill_status (*fill)(struct table *, const struct expr *cond);
+    ULONGLONG fill_time; /* tick count when the rows were filled, 0 if they weren't */
     UINT flags;
     struct list entry;
     LONG refs;
@@ -221,6 +225,7 @@ struct table *create_table( enum wbm_namespace, const WCHAR * );
 struct table *grab_table( struct table * );
 void release_table( struct table * );
 BOOL add_table( enum wbm_namespace, struct table * );
+void cache_table_snapshot( enum wbm_namespace, const struct table * );
 void free_columns( struct column *, UINT );
 void free_row_values( const struct table *, UINT );
 UINT get_type_size( CIMTYPE );
@@ -570,6 +570,34 @@ BOOL WINAPI NtGdiPatBlt( HDC hdc, INT left, INT top, INT width, INT height, DWOR
 }
 
 
+/***********************************************************************
+ *           NtGdiPolyPatBlt    (win32u.@)
+ */
+BOOL WINAPI NtGdiPolyPatBlt( HDC hdc, DWORD rop, const POLYPATBLT *blts, UINT count, UINT mode )
+{
+    HBRUSH orig_brush = 0;
+    BOOL ret = TRUE;
+    UINT i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (blts[i].brush)
+        {
+            HBRUSH prev = NtGdiSelectBrush( hdc, blts[i].brush );
+            if (!prev)
+            {
+                ret = FALSE;
+                break;
+            }
+            if (!orig_brush) orig_brush = prev;
+        }
+        if (!NtGdiPatBlt( hdc, blts[i].x, blts[i].y, blts[i].cx, blts[i].cy, rop )) ret = FALSE;
+    }
+    if (orig_brush) NtGdiSelectBrush( hdc, orig_brush );
+    return ret;
+}
+
+
 /***********************************************************************
  *           NtGdiBitBlt    (win32u.@)
  */
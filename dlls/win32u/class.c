@@ -87,6 +87,20 @@ static struct list class_list = LIST_INIT( class_list );
 
 HINSTANCE user32_module = 0;
 
+/* cache of global atom names, invalidated through the session shared memory
+ * when the server adds or deletes an atom */
+struct atom_cache_entry
+{
+    ATOM   atom;                     /* atom value, 0 if the entry is unused */
+    USHORT len;                      /* name length in bytes */
+    WCHAR  name[MAX_ATOM_LEN + 1];
+};
+
+#define ATOM_CACHE_SIZE 64  /* must be a power of two */
+
+static struct atom_cache_entry atom_cache[ATOM_CACHE_SIZE];
+static UINT atom_cache_generation;
+
 /* find an existing winproc for a given function and type */
 /* FIXME: probably should do something more clever than a linear search */
 static WINDOWPROC *find_winproc( WNDPROC func, BOOL ansi )
@@ -364,6 +378,23 @@ static CLASS *find_class( HINSTANCE module, UNICODE_STRING *name )
     return NULL;
 }
 
+/***********************************************************************
+ *           get_local_class_atom
+ *
+ * Resolve a class name to its atom when the class is registered in this
+ * process, saving the server an atom lookup at window creation time.
+ */
+ATOM get_local_class_atom( HINSTANCE module, UNICODE_STRING *name )
+{
+    CLASS *class;
+    ATOM atom;
+
+    if (!(class = find_class( module, name ))) return 0;
+    atom = class->atomName;
+    release_class_ptr( class );
+    return atom;
+}
+
 /***********************************************************************
  *           get_class_winproc
  */
@@ -577,11 +608,47 @@ ULONG WINAPI NtUserGetAtomName( ATOM atom, UNICODE_STRING *name )
 {
     char buf[sizeof(ATOM_BASIC_INFORMATION) + MAX_ATOM_LEN * sizeof(WCHAR)];
     ATOM_BASIC_INFORMATION *abi = (ATOM_BASIC_INFORMATION *)buf;
-    UINT size;
+    struct atom_cache_entry *cache = &atom_cache[atom & (ATOM_CACHE_SIZE - 1)];
+    UINT size, generation = 0;
+    BOOL cached = FALSE;
 
-    if (!set_ntstatus( NtQueryInformationAtom( atom, AtomBasicInformation,
-                                               buf, sizeof(buf), NULL )))
-        return 0;
+    if (shared_session)
+    {
+        generation = shared_session->atoms_generation;
+        user_lock();
+        if (atom_cache_generation != generation)
+        {
+            memset( atom_cache, 0, sizeof(atom_cache) );
+            atom_cache_generation = generation;
+        }
+        else if (atom && cache->atom == atom)
+        {
+            abi->NameLength = cache->len;
+            memcpy( abi->Name, cache->name, cache->len );
+            cached = TRUE;
+        }
+        user_unlock();
+    }
+
+    if (!cached)
+    {
+        if (!set_ntstatus( NtQueryInformationAtom( atom, AtomBasicInformation,
+                                                   buf, sizeof(buf), NULL )))
+            return 0;
+
+        if (shared_session && abi->NameLength <= MAX_ATOM_LEN * sizeof(WCHAR))
+        {
+            user_lock();
+            /* only cache the name if no atom was added or deleted while we retrieved it */
+            if (shared_session->atoms_generation == generation && atom_cache_generation == generation)
+            {
+                cache->atom = atom;
+                cache->len  = abi->NameLength;
+                memcpy( cache->name, abi->Name, abi->NameLength );
+            }
+            user_unlock();
+        }
+    }
 
     if (name->MaximumLength < sizeof(WCHAR))
     {
@@ -40,6 +40,9 @@ WINE_DEFAULT_DEBUG_CHANNEL(clipboard);
 
 static pthread_mutex_t clipboard_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+/* size above which data is passed through a shared section instead of server buffers */
+#define SECTION_DATA_THRESHOLD 0x10000
+
 struct cached_format
 {
     struct list entry;       /* entry in cache list */
@@ -572,6 +575,7 @@ void release_clipboard_owner( HWND hwnd )
 NTSTATUS WINAPI NtUserSetClipboardData( UINT format, HANDLE data, struct set_clipboard_params *params )
 {
     struct cached_format *cache = NULL, *prev = NULL;
+    HANDLE section = 0;
     LCID lcid;
     void *ptr = NULL;
     data_size_t size = 0;
@@ -608,13 +612,42 @@ NTSTATUS WINAPI NtUserSetClipboardData( UINT format, HANDLE data, struct set_cli
     }
     NtQueryDefaultLocale( TRUE, &lcid );
 
+    /* pass large data through a shared section, so that the server only keeps metadata
+     * and getting the data is a map instead of a copy through the server */
+    if (size >= SECTION_DATA_THRESHOLD)
+    {
+        LARGE_INTEGER section_size = { .QuadPart = size };
+        SIZE_T view_size = 0;
+        void *view = NULL;
+
+        if (NtCreateSection( &section, SECTION_ALL_ACCESS, NULL, &section_size,
+                             PAGE_READWRITE, SEC_COMMIT, 0 ))
+            section = 0;
+        else if (NtMapViewOfSection( section, GetCurrentProcess(), &view, 0, 0, NULL,
+                                     &view_size, ViewUnmap, 0, PAGE_READWRITE ))
+        {
+            NtClose( section );
+            section = 0;
+        }
+        else
+        {
+            memcpy( view, ptr, size );
+            NtUnmapViewOfSection( GetCurrentProcess(), view );
+        }
+    }
+
     pthread_mutex_lock( &clipboard_mutex );
 
     SERVER_START_REQ( set_clipboard_data )
     {
         req->format = format;
         req->lcid = lcid;
-        wine_server_add_data( req, ptr, size );
+        if (section)
+        {
+            req->handle = wine_server_obj_handle( section );
+            req->size = size;
+        }
+        else wine_server_add_data( req, ptr, size );
         if (!(status = wine_server_call( req )))
         {
             if (cache) cache->seqno = reply->seqno;
@@ -631,6 +664,7 @@ NTSTATUS WINAPI NtUserSetClipboardData( UINT format, HANDLE data, struct set_cli
     else free( cache );
 
     pthread_mutex_unlock( &clipboard_mutex );
+    if (section) NtClose( section );  /* the server keeps its own reference */
     if (prev) free_cached_data( prev );
 
 done:
@@ -645,6 +679,7 @@ HANDLE WINAPI NtUserGetClipboardData( UINT format, struct get_clipboard_params *
     struct cached_format *cache = NULL;
     unsigned int status;
     UINT from, data_seqno;
+    HANDLE section;
     size_t size;
     HWND owner;
     BOOL render = TRUE;
@@ -669,10 +704,26 @@ HANDLE WINAPI NtUserGetClipboardData( UINT format, struct get_clipboard_params *
             from = reply->from;
             size = reply->total;
             data_seqno = reply->seqno;
+            section = wine_server_ptr_handle( reply->handle );
             owner = wine_server_ptr_handle( reply->owner );
         }
         SERVER_END_REQ;
 
+        if (!status && section)  /* large data is passed through a shared section */
+        {
+            SIZE_T view_size = 0;
+            void *view = NULL;
+
+            if (size > params->size) status = STATUS_BUFFER_OVERFLOW;
+            else if (!(status = NtMapViewOfSection( section, GetCurrentProcess(), &view, 0, 0, NULL,
+                                                    &view_size, ViewUnmap, 0, PAGE_READONLY )))
+            {
+                memcpy( params->data, view, size );
+                NtUnmapViewOfSection( GetCurrentProcess(), view );
+            }
+            NtClose( section );
+        }
+
         params->size = size;
 
         if (!status && size)
@@ -43,6 +43,15 @@ struct dce
     UINT        flags;
     LONG        count;         /* usage count; 0 or 1 for cache DCEs, always 1 for window DCEs,
                                   always >= 1 for class DCEs */
+    /* visible region cache, valid while vis_serial matches the desktop serial */
+    UINT64      vis_serial;    /* desktop visible region serial at the last fetch */
+    HWND        vis_hwnd;      /* window the cached region was fetched for */
+    UINT        vis_flags;     /* DCX flags the cached region was fetched with */
+    HRGN        vis_rgn;       /* cached visible region from the server */
+    HWND        top_win;       /* cached top-level ancestor */
+    RECT        win_rect;      /* cached window rectangle */
+    RECT        top_rect;      /* cached top-level rectangle */
+    DWORD       paint_flags;   /* cached paint flags */
 };
 
 static struct list dce_list = LIST_INIT(dce_list);
@@ -801,6 +810,24 @@ static void dump_rdw_flags(UINT flags)
 #undef RDW_FLAGS
 }
 
+/***********************************************************************
+ *           get_vis_rgn_serial
+ *
+ * Retrieve the desktop visible region serial from the session shared memory.
+ */
+static UINT64 get_vis_rgn_serial(void)
+{
+    struct object_lock lock = OBJECT_LOCK_INIT;
+    const desktop_shm_t *desktop_shm;
+    UINT64 serial = 0;
+    NTSTATUS status;
+
+    while ((status = get_shared_desktop( &lock, &desktop_shm )) == STATUS_PENDING)
+        serial = desktop_shm->vis_rgn_serial;
+
+    return status ? 0 : serial;
+}
+
 /***********************************************************************
  *           update_visible_region
  *
@@ -810,7 +837,8 @@ static void dump_rdw_flags(UINT flags)
 static void update_visible_region( struct dce *dce )
 {
     struct window_surface *surface = NULL;
-    NTSTATUS status;
+    NTSTATUS status = 0;
+    UINT64 serial;
     HRGN vis_rgn = 0;
     HWND top_win = 0;
     DWORD flags = dce->flags;
@@ -822,37 +850,76 @@ static void update_visible_region( struct dce *dce )
     /* don't clip siblings if using parent clip region */
     if (flags & DCX_PARENTCLIP) flags &= ~DCX_CLIPSIBLINGS;
 
-    /* fetch the visible region from the server */
-    do
+    /* read the serial before fetching so that concurrent changes force a refetch */
+    serial = get_vis_rgn_serial();
+
+    if (serial && serial == dce->vis_serial && dce->hwnd == dce->vis_hwnd &&
+        flags == dce->vis_flags && dce->vis_rgn)
     {
-        RGNDATA *data = malloc( sizeof(*data) + size - 1 );
-        if (!data) return;
+        /* window tree unchanged since the last fetch, reuse the cached region */
+        if ((vis_rgn = NtGdiCreateRectRgn( 0, 0, 0, 0 )) &&
+            NtGdiCombineRgn( vis_rgn, dce->vis_rgn, 0, RGN_COPY ) == ERROR)
+        {
+            NtGdiDeleteObjectApp( vis_rgn );
+            vis_rgn = 0;
+        }
+        top_win     = dce->top_win;
+        win_rect    = dce->win_rect;
+        top_rect    = dce->top_rect;
+        paint_flags = dce->paint_flags;
+    }
 
-        SERVER_START_REQ( get_visible_region )
+    if (!vis_rgn)
+    {
+        /* fetch the visible region from the server */
+        do
         {
-            req->window  = wine_server_user_handle( dce->hwnd );
-            req->flags   = flags;
-            wine_server_set_reply( req, data->Buffer, size );
-            if (!(status = wine_server_call( req )))
+            RGNDATA *data = malloc( sizeof(*data) + size - 1 );
+            if (!data) return;
+
+            SERVER_START_REQ( get_visible_region )
             {
-                size_t reply_size = wine_server_reply_size( reply );
-                data->rdh.dwSize   = sizeof(data->rdh);
-                data->rdh.iType    = RDH_RECTANGLES;
-                data->rdh.nCount   = reply_size / sizeof(RECT);
-                data->rdh.nRgnSize = reply_size;
-                vis_rgn = NtGdiExtCreateRegion( NULL, data->rdh.dwSize + data->rdh.nRgnSize, data );
-                top_win     = wine_server_ptr_handle( reply->top_win );
-                win_rect    = wine_server_get_rect( reply->win_rect );
-                top_rect    = wine_server_get_rect( reply->top_rect );
-                paint_flags = reply->paint_flags;
+                req->window  = wine_server_user_handle( dce->hwnd );
+                req->flags   = flags;
+                wine_server_set_reply( req, data->Buffer, size );
+                if (!(status = wine_server_call( req )))
+                {
+                    size_t reply_size = wine_server_reply_size( reply );
+                    data->rdh.dwSize   = sizeof(data->rdh);
+                    data->rdh.iType    = RDH_RECTANGLES;
+                    data->rdh.nCount   = reply_size / sizeof(RECT);
+                    data->rdh.nRgnSize = reply_size;
+                    vis_rgn = NtGdiExtCreateRegion( NULL, data->rdh.dwSize + data->rdh.nRgnSize, data );
+                    top_win     = wine_server_ptr_handle( reply->top_win );
+                    win_rect    = wine_server_get_rect( reply->win_rect );
+                    top_rect    = wine_server_get_rect( reply->top_rect );
+                    paint_flags = reply->paint_flags;
+                }
+                else size = reply->total_size;
             }
-            else size = reply->total_size;
-        }
-        SERVER_END_REQ;
-        free( data );
-    } while (status == STATUS_BUFFER_OVERFLOW);
+            SERVER_END_REQ;
+            free( data );
+        } while (status == STATUS_BUFFER_OVERFLOW);
 
-    if (status || !vis_rgn) return;
+        if (status || !vis_rgn) return;
+
+        /* cache the fetched region for reuse while the window tree stays unchanged */
+        dce->vis_serial = 0;
+        if (serial)
+        {
+            if (!dce->vis_rgn) dce->vis_rgn = NtGdiCreateRectRgn( 0, 0, 0, 0 );
+            if (dce->vis_rgn && NtGdiCombineRgn( dce->vis_rgn, vis_rgn, 0, RGN_COPY ) != ERROR)
+            {
+                dce->vis_serial  = serial;
+                dce->vis_hwnd    = dce->hwnd;
+                dce->vis_flags   = flags;
+                dce->top_win     = top_win;
+                dce->win_rect    = win_rect;
+                dce->top_rect    = top_rect;
+                dce->paint_flags = paint_flags;
+            }
+        }
+    }
 
     user_driver->pGetDC( dce->hdc, dce->hwnd, top_win, &win_rect, &top_rect, flags );
 
@@ -926,6 +993,7 @@ BOOL delete_dce( struct dce *dce )
     {
         list_remove( &dce->entry );
         if (dce->clip_rgn) NtGdiDeleteObjectApp( dce->clip_rgn );
+        if (dce->vis_rgn) NtGdiDeleteObjectApp( dce->vis_rgn );
         free( dce );
     }
     user_unlock();
@@ -970,6 +1038,9 @@ static struct dce *alloc_dce(void)
     dce->clip_rgn  = 0;
     dce->flags     = 0;
     dce->count     = 1;
+    dce->vis_serial = 0;
+    dce->vis_hwnd   = 0;
+    dce->vis_rgn    = 0;
 
     set_dc_dce( dce->hdc, dce );
     return dce;
@@ -1365,7 +1436,9 @@ HDC WINAPI NtUserGetDCEx( HWND hwnd, HRGN clip_rgn, DWORD flags )
     dce->hwnd = hwnd;
     dce->flags = (dce->flags & ~user_flags) | (flags & user_flags);
 
-    /* cross-process invalidation is not supported yet, so always update the vis rgn */
+    /* cross-process invalidation is not supported yet, so always revalidate the
+     * vis rgn; update_visible_region() skips the server call while the desktop
+     * visible region serial is unchanged */
     if (!is_current_process_window( hwnd )) update_vis_rgn = TRUE;
 
     if (set_dce_flags( dce->hdc, DCHF_VALIDATEVISRGN )) update_vis_rgn = TRUE;  /* DC was dirty */
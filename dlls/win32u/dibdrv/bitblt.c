@@ -23,6 +23,9 @@
 #endif
 
 #include <assert.h>
+#include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "ntgdi_private.h"
 #include "dibdrv.h"
@@ -1198,6 +1201,70 @@ static DWORD calc_1d_stretch_params( INT dst_start, INT dst_length, INT dst_vis_
 }
 
 
+struct halftone_band
+{
+    const dib_info *dst_dib;
+    const struct bitblt_coords *dst;
+    const dib_info *src_dib;
+    const struct bitblt_coords *src;
+    int top, bottom;
+};
+
+static void *halftone_band_proc( void *arg )
+{
+    const struct halftone_band *band = arg;
+    band->dst_dib->funcs->halftone( band->dst_dib, band->dst, band->src_dib, band->src,
+                                    band->top, band->bottom );
+    return NULL;
+}
+
+/* don't thread small stretches, spawning workers costs more than the work */
+#define HALFTONE_MIN_PARALLEL_PIXELS (1 << 20)
+#define HALFTONE_MAX_BANDS 8
+
+/* run a halftone stretch, splitting the destination into horizontal bands
+ * processed in parallel when it is large enough; the source is only read
+ * and the bands don't overlap, so the workers are independent */
+static void halftone_blt( const dib_info *dst_dib, struct bitblt_coords *dst,
+                          const dib_info *src_dib, struct bitblt_coords *src )
+{
+    struct halftone_band bands[HALFTONE_MAX_BANDS];
+    pthread_t threads[HALFTONE_MAX_BANDS];
+    int i, started, height, nbands = 1;
+    RECT rect;
+
+    get_bounding_rect( &rect, dst->x, dst->y, dst->width, dst->height );
+    intersect_rect( &rect, &dst->visrect, &rect );
+    height = rect.bottom - rect.top;
+
+    if ((UINT64)(rect.right - rect.left) * height >= HALFTONE_MIN_PARALLEL_PIXELS)
+    {
+        long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+        nbands = min( min( cpus, HALFTONE_MAX_BANDS ), height );
+    }
+
+    if (nbands <= 1)
+    {
+        dst_dib->funcs->halftone( dst_dib, dst, src_dib, src, 0, INT_MAX );
+        return;
+    }
+
+    for (i = 0; i < nbands; i++)
+    {
+        bands[i].dst_dib = dst_dib;
+        bands[i].dst     = dst;
+        bands[i].src_dib = src_dib;
+        bands[i].src     = src;
+        bands[i].top     = height * i / nbands;
+        bands[i].bottom  = height * (i + 1) / nbands;
+    }
+    for (started = 0; started < nbands - 1; started++)
+        if (pthread_create( &threads[started], NULL, halftone_band_proc, &bands[started] )) break;
+    /* process the remaining bands (at least the last one) on this thread */
+    for (i = started; i < nbands; i++) halftone_band_proc( &bands[i] );
+    while (started) pthread_join( threads[--started], NULL );
+}
+
 DWORD stretch_bitmapinfo( const BITMAPINFO *src_info, void *src_bits, struct bitblt_coords *src,
                           const BITMAPINFO *dst_info, void *dst_bits, struct bitblt_coords *dst,
                           INT mode )
@@ -1222,7 +1289,7 @@ DWORD stretch_bitmapinfo( const BITMAPINFO *src_info, void *src_bits, struct bit
 
     if (mode == HALFTONE)
     {
-        dst_dib.funcs->halftone( &dst_dib, dst, &src_dib, src );
+        halftone_blt( &dst_dib, dst, &src_dib, src );
         goto done;
     }
 
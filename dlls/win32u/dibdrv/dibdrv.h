@@ -210,7 +210,8 @@ typedef struct primitive_funcs
                                     const dib_info *src_dib, const POINT *src_start,
                                     const struct stretch_params *params, int mode, BOOL keep_dst);
     void               (* halftone)(const dib_info *dst_dib, const struct bitblt_coords *dst,
-                                    const dib_info *src_dib, const struct bitblt_coords *src);
+                                    const dib_info *src_dib, const struct bitblt_coords *src,
+                                    int band_top, int band_bottom);
 } primitive_funcs;
 
 extern const primitive_funcs funcs_8888;
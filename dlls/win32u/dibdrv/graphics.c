@@ -47,6 +47,19 @@ enum glyph_type
 #define GLYPH_CACHE_PAGE_SIZE  0x100
 #define GLYPH_CACHE_PAGES      (0x10000 / GLYPH_CACHE_PAGE_SIZE)
 
+/* identity of the underlying font data, used to key the cross-process cache */
+struct shared_font_key
+{
+    LOGFONTW lf;               /* normalized: upper-case face name, zeroed padding */
+    XFORM    xform;
+    UINT     aa_flags;
+    WORD     face_index;
+    WORD     simulations;
+    DWORD    file_path_hash;
+    FILETIME file_write_time;
+    UINT64   file_size;
+};
+
 struct cached_font
 {
     struct list           entry;
@@ -55,6 +68,9 @@ struct cached_font
     LOGFONTW              lf;
     XFORM                 xform;
     UINT                  aa_flags;
+    BOOL                  shareable;   /* can glyphs be published to the shared cache? */
+    DWORD                 skey_hash;
+    struct shared_font_key skey;
     struct cached_glyph **glyphs[GLYPH_NBTYPES][GLYPH_CACHE_PAGES];
 };
 
@@ -551,6 +567,8 @@ static int font_cache_cmp( const struct cached_font *p1, const struct cached_fon
     return ret;
 }
 
+static void init_shared_font_key( DC *dc, struct cached_font *font );
+
 static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
 {
     struct cached_font font, *ptr, *last_unused = NULL;
@@ -609,6 +627,7 @@ static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
     *ptr = font;
     ptr->ref = 1;
     memset( ptr->glyphs, 0, sizeof(ptr->glyphs) );
+    init_shared_font_key( dc, ptr );
 done:
     list_add_head( &font_cache, &ptr->entry );
     pthread_mutex_unlock( &font_cache_lock );
@@ -657,6 +676,236 @@ static struct cached_glyph *get_cached_glyph( struct cached_font *font, UINT ind
     return font->glyphs[type][page][index % GLYPH_CACHE_PAGE_SIZE];
 }
 
+static int get_glyph_depth( UINT aa_flags )
+{
+    switch (aa_flags)
+    {
+    case GGO_BITMAP: /* we'll convert non-antialiased 1-bpp bitmaps to 8-bpp */
+    case GGO_GRAY2_BITMAP:
+    case GGO_GRAY4_BITMAP:
+    case GGO_GRAY8_BITMAP:
+    case WINE_GGO_GRAY16_BITMAP: return 8;
+
+    case WINE_GGO_HRGB_BITMAP:
+    case WINE_GGO_HBGR_BITMAP:
+    case WINE_GGO_VRGB_BITMAP:
+    case WINE_GGO_VBGR_BITMAP: return 32;
+
+    default:
+        ERR("Unexpected flags %08x\n", aa_flags);
+        return 0;
+    }
+}
+
+/* Cross-process glyph bitmap cache.
+ *
+ * Glyph bitmaps already converted for the DIB engine are published into a
+ * session-wide named section so that freshly started processes reuse warm
+ * glyphs instead of re-rendering them through the font backend.  The cache
+ * is append-only: entries are immutable once published, readers probe a
+ * fixed open-addressed bucket table without locking, and publication is a
+ * single interlocked store of the entry offset.  When the arena fills up,
+ * insertions simply stop.  Entries are keyed by the logfont, transform and
+ * aa flags (like the process-local cache) plus the identity of the backing
+ * font file, so processes with private fonts of the same name don't poison
+ * each other. */
+
+#define SHARED_GLYPH_CACHE_SIZE     (16 * 1024 * 1024)
+#define SHARED_GLYPH_CACHE_VERSION  1
+#define SHARED_GLYPH_BUCKETS        0x10000  /* power of two */
+#define SHARED_GLYPH_MAX_PROBE      16
+
+struct shared_glyph_entry
+{
+    DWORD                  font_hash;  /* hash of the font key */
+    struct shared_font_key font;
+    UINT                   type;       /* enum glyph_type */
+    UINT                   index;
+    GLYPHMETRICS           metrics;
+    DWORD                  bits_size;
+    BYTE                   bits[1];
+};
+
+struct shared_glyph_cache
+{
+    LONG version;   /* layout version, stamped by the first process */
+    LONG alloc;     /* allocation high-water mark, relative to the end of the header */
+    LONG buckets[SHARED_GLYPH_BUCKETS];  /* offsets of published entries, 0 if free */
+    /* entries follow */
+};
+
+static struct shared_glyph_cache *shared_glyph_cache;
+static pthread_once_t shared_glyph_cache_once = PTHREAD_ONCE_INIT;
+
+static void map_shared_glyph_cache(void)
+{
+    struct shared_glyph_cache *cache = NULL;
+    UNICODE_STRING name;
+    OBJECT_ATTRIBUTES attr;
+    LARGE_INTEGER size;
+    SIZE_T view_size = 0;
+    WCHAR bufferW[64];
+    char buffer[64];
+    HANDLE handle;
+    LONG version;
+
+    snprintf( buffer, sizeof(buffer), "\\Sessions\\%u\\BaseNamedObjects\\__wine_glyph_cache",
+              (UINT)NtCurrentTeb()->Peb->SessionId );
+    name.Buffer = bufferW;
+    name.MaximumLength = asciiz_to_unicode( bufferW, buffer );
+    name.Length = name.MaximumLength - sizeof(WCHAR);
+    InitializeObjectAttributes( &attr, &name, OBJ_OPENIF, NULL, NULL );
+    size.QuadPart = SHARED_GLYPH_CACHE_SIZE;
+    if (NtCreateSection( &handle, SECTION_MAP_READ | SECTION_MAP_WRITE, &attr,
+                         &size, PAGE_READWRITE, SEC_COMMIT, 0 ))
+        return;
+    if (NtMapViewOfSection( handle, NtCurrentProcess(), (void **)&cache, 0, 0, NULL,
+                            &view_size, ViewShare, 0, PAGE_READWRITE ))
+        cache = NULL;
+    NtClose( handle );
+    if (!cache) return;
+
+    /* the section starts out zeroed; the first process stamps the layout
+     * version and everybody else checks it */
+    version = InterlockedCompareExchange( &cache->version, SHARED_GLYPH_CACHE_VERSION, 0 );
+    if (version && version != SHARED_GLYPH_CACHE_VERSION)
+    {
+        NtUnmapViewOfSection( NtCurrentProcess(), cache );
+        return;
+    }
+    shared_glyph_cache = cache;
+}
+
+/* compute the shared cache key for a newly cached font; called under font_cache_lock */
+static void init_shared_font_key( DC *dc, struct cached_font *font )
+{
+    char buffer[FIELD_OFFSET( struct font_fileinfo, path[MAX_PATH] )];
+    struct font_fileinfo *fileinfo = (struct font_fileinfo *)buffer;
+    struct font_realization_info info;
+    struct shared_font_key *key = &font->skey;
+    const DWORD *ptr;
+    const WCHAR *wc;
+    DWORD hash = 0;
+    PHYSDEV dev;
+    UINT i;
+
+    font->shareable = FALSE;
+    pthread_once( &shared_glyph_cache_once, map_shared_glyph_cache );
+    if (!shared_glyph_cache) return;
+
+    info.size = sizeof(info);
+    dev = GET_DC_PHYSDEV( dc, pGetFontRealizationInfo );
+    if (!dev->funcs->pGetFontRealizationInfo( dev, &info )) return;
+    if (!NtGdiGetFontFileInfo( info.instance_id, 0, fileinfo, sizeof(buffer), NULL )) return;
+
+    memset( key, 0, sizeof(*key) );
+    key->lf = font->lf;
+    memset( key->lf.lfFaceName, 0, sizeof(key->lf.lfFaceName) );
+    for (i = 0; i < LF_FACESIZE && font->lf.lfFaceName[i]; i++)
+        key->lf.lfFaceName[i] = towupper( font->lf.lfFaceName[i] );
+    key->xform = font->xform;
+    key->aa_flags = font->aa_flags;
+    key->face_index = info.face_index;
+    key->simulations = info.simulations;
+    for (wc = fileinfo->path; *wc; wc++) hash = hash * 65599 + towupper( *wc );
+    key->file_path_hash = hash;
+    key->file_write_time = fileinfo->writetime;
+    key->file_size = fileinfo->size.QuadPart;
+
+    for (hash = 0, ptr = (const DWORD *)key, i = 0; i < sizeof(*key) / sizeof(DWORD); i++)
+        hash = hash * 65599 + ptr[i];
+    font->skey_hash = hash;
+    font->shareable = TRUE;
+}
+
+static DWORD shared_glyph_hash( const struct cached_font *font, UINT index, enum glyph_type type )
+{
+    return font->skey_hash ^ (type << 16) ^ (index * 65599);
+}
+
+/* look a glyph up in the shared cache and copy it into the process cache */
+static struct cached_glyph *get_shared_glyph( struct cached_font *font, UINT index, UINT flags )
+{
+    enum glyph_type type = (flags & ETO_GLYPH_INDEX) ? GLYPH_INDEX : GLYPH_WCHAR;
+    struct shared_glyph_cache *cache = shared_glyph_cache;
+    const struct shared_glyph_entry *entry;
+    struct shared_glyph_entry hdr;
+    struct cached_glyph *glyph;
+    UINT i, slot, stride, size;
+    DWORD hash;
+    LONG off;
+
+    if (!cache || !font->shareable) return NULL;
+    hash = shared_glyph_hash( font, index, type );
+    for (i = 0; i < SHARED_GLYPH_MAX_PROBE; i++)
+    {
+        slot = (hash + i) & (SHARED_GLYPH_BUCKETS - 1);
+        if (!(off = ReadAcquire( &cache->buckets[slot] ))) return NULL;
+        /* never trust anything read from the shared section */
+        if (off < sizeof(struct shared_glyph_cache) ||
+            off > SHARED_GLYPH_CACHE_SIZE - FIELD_OFFSET( struct shared_glyph_entry, bits ))
+            continue;
+        entry = (const struct shared_glyph_entry *)((const char *)cache + off);
+        /* another process can scribble over the section at any time; snapshot
+         * the header and validate only the snapshot so checked values can't
+         * change before they are used */
+        memcpy( &hdr, entry, FIELD_OFFSET( struct shared_glyph_entry, bits ));
+        if (hdr.font_hash != font->skey_hash) continue;
+        if (hdr.type != type || hdr.index != index) continue;
+        if (memcmp( &hdr.font, &font->skey, sizeof(font->skey) )) continue;
+
+        if (hdr.metrics.gmBlackBoxX >= 0x10000 || hdr.metrics.gmBlackBoxY >= 0x10000) return NULL;
+        stride = get_dib_stride( hdr.metrics.gmBlackBoxX, get_glyph_depth( font->aa_flags ));
+        /* compare in 64 bits: the product can wrap UINT for crafted metrics */
+        if ((UINT64)hdr.metrics.gmBlackBoxY * stride != hdr.bits_size) return NULL;
+        size = hdr.bits_size;
+        if (off + FIELD_OFFSET( struct shared_glyph_entry, bits[size] ) > SHARED_GLYPH_CACHE_SIZE) return NULL;
+
+        if (!(glyph = malloc( FIELD_OFFSET( struct cached_glyph, bits[size] )))) return NULL;
+        glyph->metrics = hdr.metrics;
+        memcpy( glyph->bits, entry->bits, size );
+        return add_cached_glyph( font, index, flags, glyph );
+    }
+    return NULL;
+}
+
+/* publish a freshly rendered glyph to the shared cache */
+static void publish_shared_glyph( struct cached_font *font, UINT index, UINT flags,
+                                  const struct cached_glyph *glyph, UINT bits_size )
+{
+    enum glyph_type type = (flags & ETO_GLYPH_INDEX) ? GLYPH_INDEX : GLYPH_WCHAR;
+    struct shared_glyph_cache *cache = shared_glyph_cache;
+    struct shared_glyph_entry *entry;
+    UINT i, slot, entry_size;
+    DWORD hash;
+    LONG off;
+
+    if (!cache || !font->shareable) return;
+    entry_size = (FIELD_OFFSET( struct shared_glyph_entry, bits[bits_size] ) + 7) & ~7;
+    /* don't let the high-water mark grow without bound once the arena is full */
+    if (ReadNoFence( &cache->alloc ) > SHARED_GLYPH_CACHE_SIZE) return;
+    off = sizeof(struct shared_glyph_cache) + InterlockedExchangeAdd( &cache->alloc, entry_size );
+    if (off < 0 || off + entry_size > SHARED_GLYPH_CACHE_SIZE) return;
+
+    entry = (struct shared_glyph_entry *)((char *)cache + off);
+    entry->font_hash = font->skey_hash;
+    entry->font      = font->skey;
+    entry->type      = type;
+    entry->index     = index;
+    entry->metrics   = glyph->metrics;
+    entry->bits_size = bits_size;
+    memcpy( entry->bits, glyph->bits, bits_size );
+
+    hash = shared_glyph_hash( font, index, type );
+    for (i = 0; i < SHARED_GLYPH_MAX_PROBE; i++)
+    {
+        slot = (hash + i) & (SHARED_GLYPH_BUCKETS - 1);
+        /* the interlocked publication makes the fully written entry visible */
+        if (!InterlockedCompareExchange( &cache->buckets[slot], off, 0 )) return;
+    }
+    /* all nearby buckets are taken; the entry is simply abandoned */
+}
+
 /**********************************************************************
  *                 get_text_bkgnd_masks
  *
@@ -710,27 +959,6 @@ static void draw_glyph( dib_info *dib, int x, int y, const GLYPHMETRICS *metrics
     }
 }
 
-static int get_glyph_depth( UINT aa_flags )
-{
-    switch (aa_flags)
-    {
-    case GGO_BITMAP: /* we'll convert non-antialiased 1-bpp bitmaps to 8-bpp */
-    case GGO_GRAY2_BITMAP:
-    case GGO_GRAY4_BITMAP:
-    case GGO_GRAY8_BITMAP:
-    case WINE_GGO_GRAY16_BITMAP: return 8;
-
-    case WINE_GGO_HRGB_BITMAP:
-    case WINE_GGO_HBGR_BITMAP:
-    case WINE_GGO_VRGB_BITMAP:
-    case WINE_GGO_VBGR_BITMAP: return 32;
-
-    default:
-        ERR("Unexpected flags %08x\n", aa_flags);
-        return 0;
-    }
-}
-
 static const BYTE masks[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
 static const int padding[4] = {0, 3, 2, 1};
 
@@ -783,6 +1011,9 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
         return NULL;
     }
     assert( ret <= size );
+    /* zero whatever the font backend didn't fill in, so that stale heap
+     * contents never end up drawn or published to the shared cache */
+    if (ret < size) memset( glyph->bits + ret, 0, size - ret );
     if (font->aa_flags == GGO_BITMAP)
     {
         for (y = metrics.gmBlackBoxY - 1; y >= 0; y--)
@@ -804,6 +1035,7 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
 
 done:
     glyph->metrics = metrics;
+    publish_shared_glyph( font, index, flags, glyph, size );
     return add_cached_glyph( font, index, flags, glyph );
 }
 
@@ -833,6 +1065,7 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
     for (i = 0; i < count; i++)
     {
         if (!(glyph = get_cached_glyph( font, str[i], flags )) &&
+            !(glyph = get_shared_glyph( font, str[i], flags )) &&
             !(glyph = cache_glyph_bitmap( dc, font, str[i], flags ))) continue;
 
         glyph_dib.width       = glyph->metrics.gmBlackBoxX;
@@ -23,6 +23,9 @@
 #endif
 
 #include <assert.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "ntgdi_private.h"
 #include "dibdrv.h"
@@ -4682,10 +4685,129 @@ static inline DWORD blend_rgb( BYTE dst_r, BYTE dst_g, BYTE dst_b, DWORD src, BL
             blend_color( dst_r, src >> 16, blend.SourceConstantAlpha ) << 16);
 }
 
+#ifdef __SSE2__
+
+/* exact vector equivalent of (v + 127) / 255 on 16-bit lanes, for v <= 255 * 255 */
+static inline __m128i blend_div255_sse2( __m128i v )
+{
+    v = _mm_add_epi16( v, _mm_set1_epi16( 128 ));
+    return _mm_srli_epi16( _mm_add_epi16( v, _mm_srli_epi16( v, 8 )), 8 );
+}
+
+/* blend four premultiplied source pixels over four destination pixels */
+static inline __m128i blend_argb_sse2( __m128i dst, __m128i src )
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16( 255 );
+    __m128i sl = _mm_unpacklo_epi8( src, zero ), sh = _mm_unpackhi_epi8( src, zero );
+    __m128i dl = _mm_unpacklo_epi8( dst, zero ), dh = _mm_unpackhi_epi8( dst, zero );
+    /* replicate each pixel's alpha lane and invert it */
+    __m128i al = _mm_sub_epi16( max, _mm_shufflehi_epi16( _mm_shufflelo_epi16( sl, 0xff ), 0xff ));
+    __m128i ah = _mm_sub_epi16( max, _mm_shufflehi_epi16( _mm_shufflelo_epi16( sh, 0xff ), 0xff ));
+
+    dl = _mm_add_epi16( sl, blend_div255_sse2( _mm_mullo_epi16( dl, al )));
+    dh = _mm_add_epi16( sh, blend_div255_sse2( _mm_mullo_epi16( dh, ah )));
+    return _mm_packus_epi16( dl, dh );
+}
+
+/* multiply all four channels of four pixels by a constant alpha */
+static inline __m128i blend_premultiply_sse2( __m128i src, __m128i alpha )
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sl = _mm_unpacklo_epi8( src, zero ), sh = _mm_unpackhi_epi8( src, zero );
+
+    sl = blend_div255_sse2( _mm_mullo_epi16( sl, alpha ));
+    sh = blend_div255_sse2( _mm_mullo_epi16( sh, alpha ));
+    return _mm_packus_epi16( sl, sh );
+}
+
+/* blend four source pixels over four destination pixels with constant alpha */
+static inline __m128i blend_constant_sse2( __m128i dst, __m128i src, __m128i alpha, __m128i inv_alpha )
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sl = _mm_mullo_epi16( _mm_unpacklo_epi8( src, zero ), alpha );
+    __m128i sh = _mm_mullo_epi16( _mm_unpackhi_epi8( src, zero ), alpha );
+    __m128i dl = _mm_mullo_epi16( _mm_unpacklo_epi8( dst, zero ), inv_alpha );
+    __m128i dh = _mm_mullo_epi16( _mm_unpackhi_epi8( dst, zero ), inv_alpha );
+
+    dl = blend_div255_sse2( _mm_add_epi16( sl, dl ));
+    dh = blend_div255_sse2( _mm_add_epi16( sh, dh ));
+    return _mm_packus_epi16( dl, dh );
+}
+
+#endif /* __SSE2__ */
+
+/* per-row blend helpers, processing four pixels at a time where SSE2 is available */
+
+static inline void blend_row_argb( DWORD *dst, const DWORD *src, int count )
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    for (; x + 4 <= count; x += 4)
+        _mm_storeu_si128( (__m128i *)(dst + x),
+                          blend_argb_sse2( _mm_loadu_si128( (const __m128i *)(dst + x) ),
+                                           _mm_loadu_si128( (const __m128i *)(src + x) )));
+#endif
+    for (; x < count; x++) dst[x] = blend_argb( dst[x], src[x] );
+}
+
+static inline void blend_row_argb_alpha( DWORD *dst, const DWORD *src, int count, DWORD alpha )
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    __m128i a = _mm_set1_epi16( alpha );
+
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128i s = blend_premultiply_sse2( _mm_loadu_si128( (const __m128i *)(src + x) ), a );
+        _mm_storeu_si128( (__m128i *)(dst + x),
+                          blend_argb_sse2( _mm_loadu_si128( (const __m128i *)(dst + x) ), s ));
+    }
+#endif
+    for (; x < count; x++) dst[x] = blend_argb_alpha( dst[x], src[x], alpha );
+}
+
+static inline void blend_row_argb_constant_alpha( DWORD *dst, const DWORD *src, int count, DWORD alpha )
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    __m128i a = _mm_set1_epi16( alpha ), inv_a = _mm_set1_epi16( 255 - alpha );
+
+    for (; x + 4 <= count; x += 4)
+        _mm_storeu_si128( (__m128i *)(dst + x),
+                          blend_constant_sse2( _mm_loadu_si128( (const __m128i *)(dst + x) ),
+                                               _mm_loadu_si128( (const __m128i *)(src + x) ),
+                                               a, inv_a ));
+#endif
+    for (; x < count; x++) dst[x] = blend_argb_constant_alpha( dst[x], src[x], alpha );
+}
+
+static inline void blend_row_argb_no_src_alpha( DWORD *dst, const DWORD *src, int count, DWORD alpha )
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    __m128i a = _mm_set1_epi16( alpha ), inv_a = _mm_set1_epi16( 255 - alpha );
+    __m128i alpha_mask = _mm_set1_epi32( 0xff000000 );
+
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128i s = _mm_or_si128( _mm_loadu_si128( (const __m128i *)(src + x) ), alpha_mask );
+        _mm_storeu_si128( (__m128i *)(dst + x),
+                          blend_constant_sse2( _mm_loadu_si128( (const __m128i *)(dst + x) ),
+                                               s, a, inv_a ));
+    }
+#endif
+    for (; x < count; x++) dst[x] = blend_argb_no_src_alpha( dst[x], src[x], alpha );
+}
+
 static void blend_rects_8888(const dib_info *dst, int num, const RECT *rc,
                              const dib_info *src, const POINT *offset, BLENDFUNCTION blend)
 {
-    int i, x, y;
+    int i, y;
 
     for (i = 0; i < num; i++, rc++)
     {
@@ -4696,21 +4818,17 @@ static void blend_rects_8888(const dib_info *dst, int num, const RECT *rc,
         {
             if (blend.SourceConstantAlpha == 255)
                 for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                    for (x = 0; x < rc->right - rc->left; x++)
-                        dst_ptr[x] = blend_argb( dst_ptr[x], src_ptr[x] );
+                    blend_row_argb( dst_ptr, src_ptr, rc->right - rc->left );
             else
                 for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                    for (x = 0; x < rc->right - rc->left; x++)
-                        dst_ptr[x] = blend_argb_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+                    blend_row_argb_alpha( dst_ptr, src_ptr, rc->right - rc->left, blend.SourceConstantAlpha );
         }
         else if (src->compression == BI_RGB)
             for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                for (x = 0; x < rc->right - rc->left; x++)
-                    dst_ptr[x] = blend_argb_constant_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+                blend_row_argb_constant_alpha( dst_ptr, src_ptr, rc->right - rc->left, blend.SourceConstantAlpha );
         else
             for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                for (x = 0; x < rc->right - rc->left; x++)
-                    dst_ptr[x] = blend_argb_no_src_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+                blend_row_argb_no_src_alpha( dst_ptr, src_ptr, rc->right - rc->left, blend.SourceConstantAlpha );
     }
 }
 
@@ -7482,7 +7600,8 @@ static void calc_halftone_params( const struct bitblt_coords *dst, const struct
 }
 
 static void halftone_888( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                          const dib_info *src_dib, const struct bitblt_coords *src )
+                          const dib_info *src_dib, const struct bitblt_coords *src,
+                          int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
     DWORD *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7496,9 +7615,13 @@ static void halftone_888( const dib_info *dst_dib, const struct bitblt_coords *d
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
-    dst_ptr = get_pixel_ptr_32( dst_dib, dst_rect.left, dst_rect.top );
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
+    dst_ptr = get_pixel_ptr_32( dst_dib, dst_rect.left, dst_rect.top + band_top );
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7545,7 +7668,8 @@ static void halftone_888( const dib_info *dst_dib, const struct bitblt_coords *d
 }
 
 static void halftone_32( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                         const dib_info *src_dib, const struct bitblt_coords *src )
+                         const dib_info *src_dib, const struct bitblt_coords *src,
+                         int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
     DWORD *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7559,9 +7683,13 @@ static void halftone_32( const dib_info *dst_dib, const struct bitblt_coords *ds
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
-    dst_ptr = get_pixel_ptr_32( dst_dib, dst_rect.left, dst_rect.top );
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
+    dst_ptr = get_pixel_ptr_32( dst_dib, dst_rect.left, dst_rect.top + band_top );
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7608,7 +7736,8 @@ static void halftone_32( const dib_info *dst_dib, const struct bitblt_coords *ds
 }
 
 static void halftone_24( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                         const dib_info *src_dib, const struct bitblt_coords *src )
+                         const dib_info *src_dib, const struct bitblt_coords *src,
+                         int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
     BYTE *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7622,9 +7751,13 @@ static void halftone_24( const dib_info *dst_dib, const struct bitblt_coords *ds
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
-    dst_ptr = get_pixel_ptr_24( dst_dib, dst_rect.left, dst_rect.top );
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
+    dst_ptr = get_pixel_ptr_24( dst_dib, dst_rect.left, dst_rect.top + band_top );
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7673,7 +7806,8 @@ static void halftone_24( const dib_info *dst_dib, const struct bitblt_coords *ds
 }
 
 static void halftone_555( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                          const dib_info *src_dib, const struct bitblt_coords *src )
+                          const dib_info *src_dib, const struct bitblt_coords *src,
+                          int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
     WORD *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7687,9 +7821,13 @@ static void halftone_555( const dib_info *dst_dib, const struct bitblt_coords *d
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
-    dst_ptr = get_pixel_ptr_16( dst_dib, dst_rect.left, dst_rect.top );
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
+    dst_ptr = get_pixel_ptr_16( dst_dib, dst_rect.left, dst_rect.top + band_top );
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7736,7 +7874,8 @@ static void halftone_555( const dib_info *dst_dib, const struct bitblt_coords *d
 }
 
 static void halftone_16( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                         const dib_info *src_dib, const struct bitblt_coords *src )
+                         const dib_info *src_dib, const struct bitblt_coords *src,
+                         int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
     WORD *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7750,9 +7889,13 @@ static void halftone_16( const dib_info *dst_dib, const struct bitblt_coords *ds
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
-    dst_ptr = get_pixel_ptr_16( dst_dib, dst_rect.left, dst_rect.top );
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
+    dst_ptr = get_pixel_ptr_16( dst_dib, dst_rect.left, dst_rect.top + band_top );
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7799,7 +7942,8 @@ static void halftone_16( const dib_info *dst_dib, const struct bitblt_coords *ds
 }
 
 static void halftone_8( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                        const dib_info *src_dib, const struct bitblt_coords *src )
+                        const dib_info *src_dib, const struct bitblt_coords *src,
+                        int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
     BYTE *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7812,10 +7956,14 @@ static void halftone_8( const dib_info *dst_dib, const struct bitblt_coords *dst
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
     src_clr_table = get_dib_color_table( src_dib );
-    dst_ptr = get_pixel_ptr_8( dst_dib, dst_rect.left, dst_rect.top );
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    dst_ptr = get_pixel_ptr_8( dst_dib, dst_rect.left, dst_rect.top + band_top );
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7863,7 +8011,8 @@ static void halftone_8( const dib_info *dst_dib, const struct bitblt_coords *dst
 }
 
 static void halftone_4( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                        const dib_info *src_dib, const struct bitblt_coords *src )
+                        const dib_info *src_dib, const struct bitblt_coords *src,
+                        int band_top, int band_bottom )
 {
     BYTE *dst_col_ptr, *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1;
@@ -7876,10 +8025,14 @@ static void halftone_4( const dib_info *dst_dib, const struct bitblt_coords *dst
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
     src_clr_table = get_dib_color_table( src_dib );
-    dst_col_ptr = (BYTE *)dst_dib->bits.ptr + (dst_dib->rect.top + dst_rect.top) * dst_dib->stride;
-    for (dst_y = 0; dst_y < dst_rect.bottom - dst_rect.top; ++dst_y)
+    dst_col_ptr = (BYTE *)dst_dib->bits.ptr + (dst_dib->rect.top + dst_rect.top + band_top) * dst_dib->stride;
+    for (dst_y = band_top; dst_y < band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -7954,7 +8107,8 @@ static void halftone_4( const dib_info *dst_dib, const struct bitblt_coords *dst
 }
 
 static void halftone_1( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                        const dib_info *src_dib, const struct bitblt_coords *src )
+                        const dib_info *src_dib, const struct bitblt_coords *src,
+                        int band_top, int band_bottom )
 {
     int src_start_x, src_start_y, src_ptr_dy, dst_x, dst_y, x0, x1, y0, y1, bit_pos;
     BYTE *dst_col_ptr, *dst_ptr, *src_ptr, *c00_ptr, *c01_ptr, *c10_ptr, *c11_ptr;
@@ -7969,11 +8123,15 @@ static void halftone_1( const dib_info *dst_dib, const struct bitblt_coords *dst
     calc_halftone_params( dst, src, &dst_rect, &src_rect, &src_start_x, &src_start_y, &src_inc_x,
                           &src_inc_y );
 
+    if (band_bottom > dst_rect.bottom - dst_rect.top) band_bottom = dst_rect.bottom - dst_rect.top;
     float_y = src_start_y;
+    /* step the interpolator up to the band start so that a banded pass
+     * remains bit-exact with a full one */
+    for (dst_y = 0; dst_y < band_top; ++dst_y) float_y += src_inc_y;
     bg_entry = *get_dib_color_table( dst_dib );
     src_clr_table = get_dib_color_table( src_dib );
-    dst_col_ptr = (BYTE *)dst_dib->bits.ptr + (dst_dib->rect.top + dst_rect.top) * dst_dib->stride;
-    for (dst_y = dst_rect.top; dst_y < dst_rect.bottom; ++dst_y)
+    dst_col_ptr = (BYTE *)dst_dib->bits.ptr + (dst_dib->rect.top + dst_rect.top + band_top) * dst_dib->stride;
+    for (dst_y = dst_rect.top + band_top; dst_y < dst_rect.top + band_bottom; ++dst_y)
     {
         float_y = clampf( float_y, src_rect.top, src_rect.bottom - 1 );
         y0 = float_y;
@@ -8033,7 +8191,8 @@ static void halftone_1( const dib_info *dst_dib, const struct bitblt_coords *dst
 }
 
 static void halftone_null( const dib_info *dst_dib, const struct bitblt_coords *dst,
-                           const dib_info *src_dib, const struct bitblt_coords *src )
+                           const dib_info *src_dib, const struct bitblt_coords *src,
+                           int band_top, int band_bottom )
 {}
 
 const primitive_funcs funcs_8888 =
@@ -655,13 +655,29 @@ BOOL reg_delete_tree( HKEY parent, const WCHAR *name, ULONG name_len )
 
 struct gdi_font_subst
 {
-    struct list entry;
+    struct wine_rb_entry entry;
     int         from_charset;
     int         to_charset;
     WCHAR       names[1];
 };
 
-static struct list font_subst_list = LIST_INIT(font_subst_list);
+struct gdi_font_subst_key
+{
+    const WCHAR *name;
+    int          charset;
+};
+
+static int font_subst_compare( const void *key, const struct wine_rb_entry *entry )
+{
+    const struct gdi_font_subst *subst = WINE_RB_ENTRY_VALUE( entry, const struct gdi_font_subst, entry );
+    const struct gdi_font_subst_key *subst_key = key;
+    int ret;
+
+    if ((ret = facename_compare( subst_key->name, subst->names, -1 ))) return ret;
+    return subst_key->charset - subst->from_charset;
+}
+
+static struct wine_rb_tree font_subst_tree = { font_subst_compare };
 
 static inline WCHAR *get_subst_to_name( struct gdi_font_subst *subst )
 {
@@ -672,7 +688,7 @@ static void dump_gdi_font_subst(void)
 {
     struct gdi_font_subst *subst;
 
-    LIST_FOR_EACH_ENTRY( subst, &font_subst_list, struct gdi_font_subst, entry )
+    WINE_RB_FOR_EACH_ENTRY( subst, &font_subst_tree, struct gdi_font_subst, entry )
     {
         if (subst->from_charset != -1 || subst->to_charset != -1)
 	    TRACE("%s,%d -> %s,%d\n", debugstr_w(subst->names),
@@ -684,22 +700,24 @@ static void dump_gdi_font_subst(void)
 
 static const WCHAR *get_gdi_font_subst( const WCHAR *from_name, int from_charset, int *to_charset )
 {
+    struct gdi_font_subst_key key = { from_name, from_charset };
+    struct wine_rb_entry *entry;
     struct gdi_font_subst *subst;
 
-    LIST_FOR_EACH_ENTRY( subst, &font_subst_list, struct gdi_font_subst, entry )
+    if (!(entry = wine_rb_get( &font_subst_tree, &key )))
     {
-        if (!facename_compare( subst->names, from_name, -1 ) &&
-           (subst->from_charset == from_charset || subst->from_charset == -1))
-        {
-            if (to_charset) *to_charset = subst->to_charset;
-            return get_subst_to_name( subst );
-        }
+        if (from_charset == -1) return NULL;
+        key.charset = -1;
+        if (!(entry = wine_rb_get( &font_subst_tree, &key ))) return NULL;
     }
-    return NULL;
+    subst = WINE_RB_ENTRY_VALUE( entry, struct gdi_font_subst, entry );
+    if (to_charset) *to_charset = subst->to_charset;
+    return get_subst_to_name( subst );
 }
 
 static BOOL add_gdi_font_subst( const WCHAR *from_name, int from_charset, const WCHAR *to_name, int to_charset )
 {
+    struct gdi_font_subst_key key;
     struct gdi_font_subst *subst;
     int len = lstrlenW( from_name ) + lstrlenW( to_name ) + 2;
 
@@ -711,7 +729,9 @@ static BOOL add_gdi_font_subst( const WCHAR *from_name, int from_charset, const
     lstrcpyW( get_subst_to_name(subst), to_name );
     subst->from_charset = from_charset;
     subst->to_charset = to_charset;
-    list_add_tail( &font_subst_list, &subst->entry );
+    key.name = subst->names;
+    key.charset = subst->from_charset;
+    wine_rb_put( &font_subst_tree, &key, &subst->entry );
     return TRUE;
 }
 
@@ -2794,7 +2814,7 @@ static void create_child_font_list( struct gdi_font *font )
 static struct list gdi_font_list = LIST_INIT( gdi_font_list );
 static struct list unused_gdi_font_list = LIST_INIT( unused_gdi_font_list );
 static unsigned int unused_font_count;
-#define UNUSED_CACHE_SIZE 10
+#define UNUSED_CACHE_SIZE 50
 
 static BOOL fontcmp( const struct gdi_font *font, DWORD hash, const LOGFONTW *lf,
                      const FMAT2 *matrix, BOOL can_use_bitmap )
@@ -843,6 +843,11 @@ BOOL SYSCALL_API NtGdiPolyDraw( HDC hdc, const POINT *points, const BYTE *types,
     SYSCALL_FUNC( NtGdiPolyDraw );
 }
 
+BOOL SYSCALL_API NtGdiPolyPatBlt( HDC hdc, DWORD rop, const POLYPATBLT *blts, UINT count, UINT mode )
+{
+    SYSCALL_FUNC( NtGdiPolyPatBlt );
+}
+
 ULONG SYSCALL_API NtGdiPolyPolyDraw( HDC hdc, const POINT *points, const ULONG *counts,
                                      DWORD count, UINT function )
 {
@@ -2775,6 +2775,51 @@ static BOOL check_queue_bits( UINT wake_mask, UINT changed_mask, UINT signal_bit
     return skip;
 }
 
+/***********************************************************************
+ *           peek_posted_message_shm
+ *
+ * Try to satisfy a PM_NOREMOVE peek for a posted message from the shared
+ * memory mirror, without a server round-trip. The mirror is an exact prefix
+ * of the server-side posted message list, so the first entry matching the
+ * filter is the message the server would have returned. Returns TRUE if a
+ * matching message was copied to *msg.
+ */
+static BOOL peek_posted_message_shm( MSG *msg, UINT first, UINT last )
+{
+    struct object_lock lock = OBJECT_LOCK_INIT;
+    const queue_shm_t *queue_shm;
+    BOOL found = FALSE;
+    UINT status;
+
+    while ((status = get_shared_queue( &lock, &queue_shm )) == STATUS_PENDING)
+    {
+        UINT i, count = queue_shm->posted_count;
+
+        found = FALSE;
+        /* pending sent messages and input (including internal driver messages)
+         * have priority and can only be processed by the server */
+        if (queue_shm->wake_bits & (QS_SENDMESSAGE | QS_SMRESULT | QS_INPUT))
+            count = 0;
+        for (i = 0; i < count; i++)
+        {
+            const volatile struct shared_posted_msg *entry = &queue_shm->posted[i];
+            if (entry->msg < first || entry->msg > last) continue;
+            msg->hwnd    = wine_server_ptr_handle( entry->win );
+            msg->message = entry->msg;
+            msg->wParam  = (WPARAM)entry->wparam;
+            msg->lParam  = (LPARAM)entry->lparam;
+            msg->time    = entry->time;
+            msg->pt.x    = entry->x;
+            msg->pt.y    = entry->y;
+            found = TRUE;
+            break;
+        }
+    }
+
+    if (status) return FALSE;
+    return found;
+}
+
 /***********************************************************************
  *           peek_message
  *
@@ -2822,6 +2867,20 @@ int peek_message( MSG *msg, const struct peek_message_filter *filter )
         thread_info->client_info.msg_source = prev_source;
         wake_mask = filter->mask & (QS_SENDMESSAGE | QS_SMRESULT);
 
+        if (!(flags & PM_REMOVE) && !filter->internal && !hwnd && (signal_bits & QS_POSTMESSAGE) &&
+            NtGetTickCount() - thread_info->last_getmsg_time < 3000 && /* avoid hung queue */
+            peek_posted_message_shm( msg, first, last ))
+        {
+            msg->pt = point_phys_to_win_dpi( msg->hwnd, msg->pt );
+            thread_info->client_info.message_pos   = MAKELONG( msg->pt.x, msg->pt.y );
+            thread_info->client_info.message_time  = msg->time;
+            thread_info->client_info.message_extra = 0;
+            thread_info->client_info.msg_source = msg_source_unavailable;
+            if (buffer != buffer_init) free( buffer );
+            call_hooks( WH_GETMESSAGE, HC_ACTION, 0, (LPARAM)msg, sizeof(*msg) );
+            return 1;
+        }
+
         if (NtGetTickCount() - thread_info->last_getmsg_time < 3000 && /* avoid hung queue */
             check_queue_bits( wake_mask, filter->mask, wake_mask | signal_bits, filter->mask | clear_bits,
                               &wake_bits, &changed_bits ))
@@ -3410,7 +3469,7 @@ BOOL WINAPI NtUserGetMessage( MSG *msg, HWND hwnd, UINT first, UINT last )
  * Put a sent message into the destination queue.
  * For inter-process message, reply_size is set to expected size of reply data.
  */
-static BOOL put_message_in_queue( const struct send_message_info *info, size_t *reply_size )
+static BOOL put_message_in_queue( const struct send_message_info *info, size_t *reply_size, BOOL shm_reply )
 {
     struct packed_message data;
     union message_data msg_data;
@@ -3477,6 +3536,7 @@ static BOOL put_message_in_queue( const struct send_message_info *info, size_t *
         req->timeout = timeout;
 
         if (info->flags & SMTO_ABORTIFHUNG) req->flags |= SEND_MSG_ABORT_IF_HUNG;
+        if (shm_reply) req->flags |= SEND_MSG_SHM_REPLY;
         for (i = 0; i < data.count; i++) wine_server_add_data( req, data.data[i], data.size[i] );
         res = wine_server_call( req );
     }
@@ -3514,6 +3574,87 @@ static NTSTATUS post_dde_message_call( HWND hwnd, UINT msg, WPARAM wparam, LPARA
 }
 
 
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/* wait on a session shared memory word; this has to be a non-private futex
+ * since the server wakes us from another process */
+static int futex_wait_shared( const volatile unsigned int *addr, unsigned int val, struct timespec *timeout )
+{
+    return syscall( __NR_futex, (const void *)addr, FUTEX_WAIT, val, timeout, 0, 0 );
+}
+#endif
+
+/***********************************************************************
+ *           get_shared_reply_seq
+ *
+ * Read the current message reply sequence number from the queue shared memory.
+ * Returns FALSE if the queue shared memory is not available.
+ */
+static BOOL get_shared_reply_seq( UINT *seq )
+{
+    struct object_lock lock = OBJECT_LOCK_INIT;
+    const queue_shm_t *queue_shm = NULL;
+    UINT status;
+
+    *seq = 0;
+    while ((status = get_shared_queue( &lock, &queue_shm )) == STATUS_PENDING)
+        *seq = queue_shm->reply_seq;
+
+    return !status && queue_shm != NULL;
+}
+
+/***********************************************************************
+ *           wait_message_reply_shm
+ *
+ * Wait for a sent message reply through the queue shared memory, without any
+ * server request. Returns TRUE if the reply was delivered through the shared
+ * memory mirror, FALSE to fall back to the server wait and reply retrieval.
+ */
+static BOOL wait_message_reply_shm( UINT flags, UINT reply_seq, LRESULT *result, UINT *error )
+{
+#ifdef __linux__
+    UINT wake_mask = QS_SMRESULT | ((flags & SMTO_BLOCK) ? 0 : QS_SENDMESSAGE);
+
+    for (;;)
+    {
+        struct object_lock lock = OBJECT_LOCK_INIT;
+        const queue_shm_t *queue_shm = NULL;
+        /* wake up periodically to keep processing driver events; the legacy
+         * path waits on the server queue handle which the driver plugs into */
+        struct timespec timeout = { .tv_nsec = 5 * 1000000 };
+        UINT status, bits = 0, seq = 0;
+        BOOL done = FALSE;
+
+        while ((status = get_shared_queue( &lock, &queue_shm )) == STATUS_PENDING)
+        {
+            bits = queue_shm->wake_bits & wake_mask;
+            seq  = queue_shm->wake_seq;
+            if ((done = queue_shm->reply_seq != reply_seq))
+            {
+                *result = queue_shm->reply_result;
+                *error  = queue_shm->reply_error;
+            }
+        }
+        if (status || !queue_shm) return FALSE;  /* no shared queue */
+        if (done) return TRUE;
+        if (bits & QS_SMRESULT) return FALSE;    /* reply comes with data, retrieve it from the server */
+        if (bits & QS_SENDMESSAGE)
+        {
+            /* process the sent message immediately */
+            process_sent_messages();
+            continue;
+        }
+        futex_wait_shared( &queue_shm->wake_seq, seq, &timeout );
+        check_for_driver_events();
+    }
+#else
+    return FALSE;
+#endif
+}
+
 /***********************************************************************
  *           wait_message_reply
  *
@@ -3599,7 +3740,11 @@ static LRESULT retrieve_reply( const struct send_message_info *info,
  */
 static LRESULT send_inter_thread_message( const struct send_message_info *info, LRESULT *res_ptr )
 {
+    struct user_thread_info *thread_info = get_user_thread_info();
     size_t reply_size = 0;
+    UINT reply_seq, error;
+    LRESULT ret;
+    BOOL use_shm;
 
     TRACE( "hwnd %p msg %x (%s) wp %lx lp %lx\n",
            info->hwnd, info->msg, debugstr_msg_name(info->msg, info->hwnd),
@@ -3607,13 +3752,34 @@ static LRESULT send_inter_thread_message( const struct send_message_info *info,
 
     user_check_not_lock();
 
-    if (!put_message_in_queue( info, &reply_size )) return 0;
+    /* Only the outermost send of a thread may use the shared memory reply:
+     * there is a single mirror slot per queue, so a reply mirrored for a send
+     * nested inside another reply wait would overwrite the outer reply before
+     * the outer wait has consumed it.  This also guarantees that no reply to
+     * an earlier send can be mirrored between the sequence snapshot and the
+     * wait, since only sends taken at depth zero are allowed to mirror. */
+    use_shm = !thread_info->message_reply_depth && get_shared_reply_seq( &reply_seq );
+    if (!put_message_in_queue( info, &reply_size, use_shm )) return 0;
 
     /* there's no reply to wait for on notify/callback messages */
     if (info->type == MSG_NOTIFY || info->type == MSG_CALLBACK) return 1;
 
+    thread_info->message_reply_depth++;
+    if (use_shm && wait_message_reply_shm( info->flags, reply_seq, res_ptr, &error ))
+    {
+        thread_info->message_reply_depth--;
+        TRACE( "hwnd %p msg %x (%s) wp %lx lp %lx got shm reply %lx (err=%d)\n",
+               info->hwnd, info->msg, debugstr_msg_name(info->msg, info->hwnd), (long)info->wparam,
+               info->lparam, *res_ptr, error );
+        /* MSDN states that last error is 0 on timeout, but at least NT4 returns ERROR_TIMEOUT */
+        if (error) RtlSetLastWin32Error( RtlNtStatusToDosError(error) );
+        return !error;
+    }
+
     wait_message_reply( info->flags );
-    return retrieve_reply( info, reply_size, res_ptr );
+    ret = retrieve_reply( info, reply_size, res_ptr );
+    thread_info->message_reply_depth--;
+    return ret;
 }
 
 static LRESULT send_inter_thread_callback( HWND hwnd, UINT msg, WPARAM wp, LPARAM lp,
@@ -3673,10 +3839,12 @@ LRESULT send_internal_message_timeout( DWORD dest_pid, DWORD dest_tid,
  */
 NTSTATUS send_hardware_message( HWND hwnd, UINT flags, const INPUT *input, LPARAM lparam )
 {
+    struct user_thread_info *thread_info = get_user_thread_info();
     struct send_message_info info;
     int prev_x, prev_y, new_x, new_y;
     NTSTATUS ret;
-    BOOL wait;
+    BOOL wait, use_shm;
+    UINT reply_seq, error;
 
     info.type     = MSG_HARDWARE;
     info.dest_tid = 0;
@@ -3688,10 +3856,13 @@ NTSTATUS send_hardware_message( HWND hwnd, UINT flags, const INPUT *input, LPARA
     if (input->type == INPUT_MOUSE && (input->mi.dwFlags & (MOUSEEVENTF_LEFTDOWN | MOUSEEVENTF_RIGHTDOWN)))
         clip_fullscreen_window( hwnd, FALSE );
 
+    /* see send_inter_thread_message for why only non-nested sends may mirror */
+    use_shm = !thread_info->message_reply_depth && get_shared_reply_seq( &reply_seq );
     SERVER_START_REQ( send_hardware_message )
     {
         req->win        = wine_server_user_handle( hwnd );
         req->flags      = flags;
+        if (use_shm) req->flags |= SEND_HWMSG_SHM_REPLY;
         req->input.type = input->type;
         switch (input->type)
         {
@@ -3761,8 +3932,13 @@ NTSTATUS send_hardware_message( HWND hwnd, UINT flags, const INPUT *input, LPARA
     if (wait)
     {
         LRESULT ignored;
-        wait_message_reply( 0 );
-        retrieve_reply( &info, 0, &ignored );
+        thread_info->message_reply_depth++;
+        if (!use_shm || !wait_message_reply_shm( 0, reply_seq, &ignored, &error ))
+        {
+            wait_message_reply( 0 );
+            retrieve_reply( &info, 0, &ignored );
+        }
+        thread_info->message_reply_depth--;
     }
     return ret;
 }
@@ -4466,7 +4642,7 @@ BOOL WINAPI NtUserPostMessage( HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam
 
     if (is_exiting_thread( info.dest_tid )) return TRUE;
 
-    return put_message_in_queue( &info, NULL );
+    return put_message_in_queue( &info, NULL, FALSE );
 }
 
 /**********************************************************************
@@ -4491,7 +4667,7 @@ BOOL WINAPI NtUserPostThreadMessage( DWORD thread, UINT msg, WPARAM wparam, LPAR
     info.lparam   = lparam;
     info.flags    = 0;
     info.params   = NULL;
-    return put_message_in_queue( &info, NULL );
+    return put_message_in_queue( &info, NULL, FALSE );
 }
 
 LRESULT WINAPI NtUserMessageCall( HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam,
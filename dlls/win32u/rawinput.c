@@ -454,8 +454,11 @@ UINT WINAPI NtUserGetRawInputDeviceInfo( HANDLE handle, UINT command, void *data
  */
 UINT WINAPI NtUserGetRawInputBuffer( RAWINPUT *data, UINT *data_size, UINT header_size )
 {
+    struct object_lock lock = OBJECT_LOCK_INIT;
     struct user_thread_info *thread_info;
-    UINT count;
+    const input_shm_t *input_shm;
+    UINT count, next_size = 0;
+    NTSTATUS status;
 
     TRACE( "data %p, data_size %p, header_size %u\n", data, data_size, header_size );
 
@@ -474,6 +477,25 @@ UINT WINAPI NtUserGetRawInputBuffer( RAWINPUT *data, UINT *data_size, UINT heade
     /* with old WOW64 mode we didn't go through the WOW64 thunks, patch the header size here */
     if (NtCurrentTeb()->WowTebOffset) header_size = sizeof(RAWINPUTHEADER64);
 
+    /* the size of the next pending WM_INPUT message is mirrored in the shared memory,
+     * so size queries and empty drains don't need a server call */
+    while ((status = get_shared_input( GetCurrentThreadId(), &lock, &input_shm )) == STATUS_PENDING)
+        next_size = input_shm->next_rawinput_size;
+
+    if (!status)
+    {
+        if (!data)
+        {
+            *data_size = next_size ? header_size + next_size : 0;
+            return 0;
+        }
+        if (!next_size)
+        {
+            *data_size = 0;
+            return 0;
+        }
+    }
+
     thread_info = get_user_thread_info();
     SERVER_START_REQ( get_rawinput_buffer )
     {
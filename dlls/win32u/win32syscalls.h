@@ -152,319 +152,320 @@
     SYSCALL_ENTRY( 0x1094, NtGdiPathToRegion, 4 ) \
     SYSCALL_ENTRY( 0x1095, NtGdiPlgBlt, 44 ) \
     SYSCALL_ENTRY( 0x1096, NtGdiPolyDraw, 16 ) \
-    SYSCALL_ENTRY( 0x1097, NtGdiPolyPolyDraw, 20 ) \
-    SYSCALL_ENTRY( 0x1098, NtGdiPtInRegion, 12 ) \
-    SYSCALL_ENTRY( 0x1099, NtGdiPtVisible, 12 ) \
-    SYSCALL_ENTRY( 0x109a, NtGdiRectInRegion, 8 ) \
-    SYSCALL_ENTRY( 0x109b, NtGdiRectVisible, 8 ) \
-    SYSCALL_ENTRY( 0x109c, NtGdiRectangle, 20 ) \
-    SYSCALL_ENTRY( 0x109d, NtGdiRemoveFontMemResourceEx, 4 ) \
-    SYSCALL_ENTRY( 0x109e, NtGdiRemoveFontResourceW, 24 ) \
-    SYSCALL_ENTRY( 0x109f, NtGdiResetDC, 20 ) \
-    SYSCALL_ENTRY( 0x10a0, NtGdiResizePalette, 8 ) \
-    SYSCALL_ENTRY( 0x10a1, NtGdiRestoreDC, 8 ) \
-    SYSCALL_ENTRY( 0x10a2, NtGdiRoundRect, 28 ) \
-    SYSCALL_ENTRY( 0x10a3, NtGdiSaveDC, 4 ) \
-    SYSCALL_ENTRY( 0x10a4, NtGdiScaleViewportExtEx, 24 ) \
-    SYSCALL_ENTRY( 0x10a5, NtGdiScaleWindowExtEx, 24 ) \
-    SYSCALL_ENTRY( 0x10a6, NtGdiSelectBitmap, 8 ) \
-    SYSCALL_ENTRY( 0x10a7, NtGdiSelectBrush, 8 ) \
-    SYSCALL_ENTRY( 0x10a8, NtGdiSelectClipPath, 8 ) \
-    SYSCALL_ENTRY( 0x10a9, NtGdiSelectFont, 8 ) \
-    SYSCALL_ENTRY( 0x10aa, NtGdiSelectPen, 8 ) \
-    SYSCALL_ENTRY( 0x10ab, NtGdiSetBitmapBits, 12 ) \
-    SYSCALL_ENTRY( 0x10ac, NtGdiSetBitmapDimension, 16 ) \
-    SYSCALL_ENTRY( 0x10ad, NtGdiSetBoundsRect, 12 ) \
-    SYSCALL_ENTRY( 0x10ae, NtGdiSetBrushOrg, 16 ) \
-    SYSCALL_ENTRY( 0x10af, NtGdiSetColorAdjustment, 8 ) \
-    SYSCALL_ENTRY( 0x10b0, NtGdiSetDIBitsToDeviceInternal, 64 ) \
-    SYSCALL_ENTRY( 0x10b1, NtGdiSetDeviceGammaRamp, 8 ) \
-    SYSCALL_ENTRY( 0x10b2, NtGdiSetLayout, 12 ) \
-    SYSCALL_ENTRY( 0x10b3, NtGdiSetMagicColors, 12 ) \
-    SYSCALL_ENTRY( 0x10b4, NtGdiSetMetaRgn, 4 ) \
-    SYSCALL_ENTRY( 0x10b5, NtGdiSetPixel, 16 ) \
-    SYSCALL_ENTRY( 0x10b6, NtGdiSetPixelFormat, 8 ) \
-    SYSCALL_ENTRY( 0x10b7, NtGdiSetRectRgn, 20 ) \
-    SYSCALL_ENTRY( 0x10b8, NtGdiSetSystemPaletteUse, 8 ) \
-    SYSCALL_ENTRY( 0x10b9, NtGdiSetTextJustification, 12 ) \
-    SYSCALL_ENTRY( 0x10ba, NtGdiSetVirtualResolution, 20 ) \
-    SYSCALL_ENTRY( 0x10bb, NtGdiStartDoc, 16 ) \
-    SYSCALL_ENTRY( 0x10bc, NtGdiStartPage, 4 ) \
-    SYSCALL_ENTRY( 0x10bd, NtGdiStretchBlt, 48 ) \
-    SYSCALL_ENTRY( 0x10be, NtGdiStretchDIBitsInternal, 64 ) \
-    SYSCALL_ENTRY( 0x10bf, NtGdiStrokeAndFillPath, 4 ) \
-    SYSCALL_ENTRY( 0x10c0, NtGdiStrokePath, 4 ) \
-    SYSCALL_ENTRY( 0x10c1, NtGdiSwapBuffers, 4 ) \
-    SYSCALL_ENTRY( 0x10c2, NtGdiTransformPoints, 20 ) \
-    SYSCALL_ENTRY( 0x10c3, NtGdiTransparentBlt, 44 ) \
-    SYSCALL_ENTRY( 0x10c4, NtGdiUnrealizeObject, 4 ) \
-    SYSCALL_ENTRY( 0x10c5, NtGdiUpdateColors, 4 ) \
-    SYSCALL_ENTRY( 0x10c6, NtGdiWidenPath, 4 ) \
-    SYSCALL_ENTRY( 0x10c7, NtUserActivateKeyboardLayout, 8 ) \
-    SYSCALL_ENTRY( 0x10c8, NtUserAddClipboardFormatListener, 4 ) \
-    SYSCALL_ENTRY( 0x10c9, NtUserAlterWindowStyle, 12 ) \
-    SYSCALL_ENTRY( 0x10ca, NtUserArrangeIconicWindows, 4 ) \
-    SYSCALL_ENTRY( 0x10cb, NtUserAssociateInputContext, 12 ) \
-    SYSCALL_ENTRY( 0x10cc, NtUserAttachThreadInput, 12 ) \
-    SYSCALL_ENTRY( 0x10cd, NtUserBeginDeferWindowPos, 4 ) \
-    SYSCALL_ENTRY( 0x10ce, NtUserBeginPaint, 8 ) \
-    SYSCALL_ENTRY( 0x10cf, NtUserBuildHimcList, 16 ) \
-    SYSCALL_ENTRY( 0x10d0, NtUserBuildHwndList, 32 ) \
-    SYSCALL_ENTRY( 0x10d1, NtUserBuildNameList, 16 ) \
-    SYSCALL_ENTRY( 0x10d2, NtUserBuildPropList, 16 ) \
-    SYSCALL_ENTRY( 0x10d3, NtUserCallHwnd, 8 ) \
-    SYSCALL_ENTRY( 0x10d4, NtUserCallHwndParam, 12 ) \
-    SYSCALL_ENTRY( 0x10d5, NtUserCallMsgFilter, 8 ) \
-    SYSCALL_ENTRY( 0x10d6, NtUserCallNextHookEx, 16 ) \
-    SYSCALL_ENTRY( 0x10d7, NtUserCallNoParam, 4 ) \
-    SYSCALL_ENTRY( 0x10d8, NtUserCallOneParam, 8 ) \
-    SYSCALL_ENTRY( 0x10d9, NtUserCallTwoParam, 12 ) \
-    SYSCALL_ENTRY( 0x10da, NtUserChangeClipboardChain, 8 ) \
-    SYSCALL_ENTRY( 0x10db, NtUserChangeDisplaySettings, 20 ) \
-    SYSCALL_ENTRY( 0x10dc, NtUserCheckMenuItem, 12 ) \
-    SYSCALL_ENTRY( 0x10dd, NtUserChildWindowFromPointEx, 16 ) \
-    SYSCALL_ENTRY( 0x10de, NtUserClipCursor, 4 ) \
-    SYSCALL_ENTRY( 0x10df, NtUserCloseClipboard, 0 ) \
-    SYSCALL_ENTRY( 0x10e0, NtUserCloseDesktop, 4 ) \
-    SYSCALL_ENTRY( 0x10e1, NtUserCloseWindowStation, 4 ) \
-    SYSCALL_ENTRY( 0x10e2, NtUserCopyAcceleratorTable, 12 ) \
-    SYSCALL_ENTRY( 0x10e3, NtUserCountClipboardFormats, 0 ) \
-    SYSCALL_ENTRY( 0x10e4, NtUserCreateAcceleratorTable, 8 ) \
-    SYSCALL_ENTRY( 0x10e5, NtUserCreateCaret, 16 ) \
-    SYSCALL_ENTRY( 0x10e6, NtUserCreateDesktopEx, 24 ) \
-    SYSCALL_ENTRY( 0x10e7, NtUserCreateInputContext, 4 ) \
-    SYSCALL_ENTRY( 0x10e8, NtUserCreateMenu, 0 ) \
-    SYSCALL_ENTRY( 0x10e9, NtUserCreatePopupMenu, 0 ) \
-    SYSCALL_ENTRY( 0x10ea, NtUserCreateWindowEx, 68 ) \
-    SYSCALL_ENTRY( 0x10eb, NtUserCreateWindowStation, 28 ) \
-    SYSCALL_ENTRY( 0x10ec, NtUserDeferWindowPosAndBand, 40 ) \
-    SYSCALL_ENTRY( 0x10ed, NtUserDeleteMenu, 12 ) \
-    SYSCALL_ENTRY( 0x10ee, NtUserDestroyAcceleratorTable, 4 ) \
-    SYSCALL_ENTRY( 0x10ef, NtUserDestroyCaret, 0 ) \
-    SYSCALL_ENTRY( 0x10f0, NtUserDestroyCursor, 8 ) \
-    SYSCALL_ENTRY( 0x10f1, NtUserDestroyInputContext, 4 ) \
-    SYSCALL_ENTRY( 0x10f2, NtUserDestroyMenu, 4 ) \
-    SYSCALL_ENTRY( 0x10f3, NtUserDestroyWindow, 4 ) \
-    SYSCALL_ENTRY( 0x10f4, NtUserDisableThreadIme, 4 ) \
-    SYSCALL_ENTRY( 0x10f5, NtUserDispatchMessage, 4 ) \
-    SYSCALL_ENTRY( 0x10f6, NtUserDisplayConfigGetDeviceInfo, 4 ) \
-    SYSCALL_ENTRY( 0x10f7, NtUserDragDetect, 12 ) \
-    SYSCALL_ENTRY( 0x10f8, NtUserDragObject, 20 ) \
-    SYSCALL_ENTRY( 0x10f9, NtUserDrawCaptionTemp, 28 ) \
-    SYSCALL_ENTRY( 0x10fa, NtUserDrawIconEx, 36 ) \
-    SYSCALL_ENTRY( 0x10fb, NtUserDrawMenuBar, 4 ) \
-    SYSCALL_ENTRY( 0x10fc, NtUserDrawMenuBarTemp, 20 ) \
-    SYSCALL_ENTRY( 0x10fd, NtUserEmptyClipboard, 0 ) \
-    SYSCALL_ENTRY( 0x10fe, NtUserEnableMenuItem, 12 ) \
-    SYSCALL_ENTRY( 0x10ff, NtUserEnableMouseInPointer, 4 ) \
-    SYSCALL_ENTRY( 0x1100, NtUserEnableMouseInPointerForThread, 0 ) \
-    SYSCALL_ENTRY( 0x1101, NtUserEnableScrollBar, 12 ) \
-    SYSCALL_ENTRY( 0x1102, NtUserEnableWindow, 8 ) \
-    SYSCALL_ENTRY( 0x1103, NtUserEndDeferWindowPosEx, 8 ) \
-    SYSCALL_ENTRY( 0x1104, NtUserEndMenu, 0 ) \
-    SYSCALL_ENTRY( 0x1105, NtUserEndPaint, 8 ) \
-    SYSCALL_ENTRY( 0x1106, NtUserEnumClipboardFormats, 4 ) \
-    SYSCALL_ENTRY( 0x1107, NtUserEnumDisplayDevices, 16 ) \
-    SYSCALL_ENTRY( 0x1108, NtUserEnumDisplayMonitors, 16 ) \
-    SYSCALL_ENTRY( 0x1109, NtUserEnumDisplaySettings, 16 ) \
-    SYSCALL_ENTRY( 0x110a, NtUserExcludeUpdateRgn, 8 ) \
-    SYSCALL_ENTRY( 0x110b, NtUserFindExistingCursorIcon, 12 ) \
-    SYSCALL_ENTRY( 0x110c, NtUserFindWindowEx, 20 ) \
-    SYSCALL_ENTRY( 0x110d, NtUserFlashWindowEx, 4 ) \
-    SYSCALL_ENTRY( 0x110e, NtUserGetAncestor, 8 ) \
-    SYSCALL_ENTRY( 0x110f, NtUserGetAsyncKeyState, 4 ) \
-    SYSCALL_ENTRY( 0x1110, NtUserGetAtomName, 8 ) \
-    SYSCALL_ENTRY( 0x1111, NtUserGetCaretBlinkTime, 0 ) \
-    SYSCALL_ENTRY( 0x1112, NtUserGetCaretPos, 4 ) \
-    SYSCALL_ENTRY( 0x1113, NtUserGetClassInfoEx, 20 ) \
-    SYSCALL_ENTRY( 0x1114, NtUserGetClassName, 12 ) \
-    SYSCALL_ENTRY( 0x1115, NtUserGetClipCursor, 4 ) \
-    SYSCALL_ENTRY( 0x1116, NtUserGetClipboardData, 8 ) \
-    SYSCALL_ENTRY( 0x1117, NtUserGetClipboardFormatName, 12 ) \
-    SYSCALL_ENTRY( 0x1118, NtUserGetClipboardOwner, 0 ) \
-    SYSCALL_ENTRY( 0x1119, NtUserGetClipboardSequenceNumber, 0 ) \
-    SYSCALL_ENTRY( 0x111a, NtUserGetClipboardViewer, 0 ) \
-    SYSCALL_ENTRY( 0x111b, NtUserGetCurrentInputMessageSource, 4 ) \
-    SYSCALL_ENTRY( 0x111c, NtUserGetCursor, 0 ) \
-    SYSCALL_ENTRY( 0x111d, NtUserGetCursorFrameInfo, 16 ) \
-    SYSCALL_ENTRY( 0x111e, NtUserGetCursorInfo, 4 ) \
-    SYSCALL_ENTRY( 0x111f, NtUserGetDC, 4 ) \
-    SYSCALL_ENTRY( 0x1120, NtUserGetDCEx, 12 ) \
-    SYSCALL_ENTRY( 0x1121, NtUserGetDisplayConfigBufferSizes, 12 ) \
-    SYSCALL_ENTRY( 0x1122, NtUserGetDoubleClickTime, 0 ) \
-    SYSCALL_ENTRY( 0x1123, NtUserGetDpiForMonitor, 16 ) \
-    SYSCALL_ENTRY( 0x1124, NtUserGetForegroundWindow, 0 ) \
-    SYSCALL_ENTRY( 0x1125, NtUserGetGUIThreadInfo, 8 ) \
-    SYSCALL_ENTRY( 0x1126, NtUserGetIconInfo, 24 ) \
-    SYSCALL_ENTRY( 0x1127, NtUserGetIconSize, 16 ) \
-    SYSCALL_ENTRY( 0x1128, NtUserGetInternalWindowPos, 12 ) \
-    SYSCALL_ENTRY( 0x1129, NtUserGetKeyNameText, 12 ) \
-    SYSCALL_ENTRY( 0x112a, NtUserGetKeyState, 4 ) \
-    SYSCALL_ENTRY( 0x112b, NtUserGetKeyboardLayout, 4 ) \
-    SYSCALL_ENTRY( 0x112c, NtUserGetKeyboardLayoutList, 8 ) \
-    SYSCALL_ENTRY( 0x112d, NtUserGetKeyboardLayoutName, 4 ) \
-    SYSCALL_ENTRY( 0x112e, NtUserGetKeyboardState, 4 ) \
-    SYSCALL_ENTRY( 0x112f, NtUserGetLayeredWindowAttributes, 16 ) \
-    SYSCALL_ENTRY( 0x1130, NtUserGetMenuBarInfo, 16 ) \
-    SYSCALL_ENTRY( 0x1131, NtUserGetMenuItemRect, 16 ) \
-    SYSCALL_ENTRY( 0x1132, NtUserGetMessage, 16 ) \
-    SYSCALL_ENTRY( 0x1133, NtUserGetMouseMovePointsEx, 20 ) \
-    SYSCALL_ENTRY( 0x1134, NtUserGetObjectInformation, 20 ) \
-    SYSCALL_ENTRY( 0x1135, NtUserGetOpenClipboardWindow, 0 ) \
-    SYSCALL_ENTRY( 0x1136, NtUserGetPointerInfoList, 32 ) \
-    SYSCALL_ENTRY( 0x1137, NtUserGetPriorityClipboardFormat, 8 ) \
-    SYSCALL_ENTRY( 0x1138, NtUserGetProcessDefaultLayout, 4 ) \
-    SYSCALL_ENTRY( 0x1139, NtUserGetProcessDpiAwarenessContext, 4 ) \
-    SYSCALL_ENTRY( 0x113a, NtUserGetProcessWindowStation, 0 ) \
-    SYSCALL_ENTRY( 0x113b, NtUserGetProp, 8 ) \
-    SYSCALL_ENTRY( 0x113c, NtUserGetQueueStatus, 4 ) \
-    SYSCALL_ENTRY( 0x113d, NtUserGetRawInputBuffer, 12 ) \
-    SYSCALL_ENTRY( 0x113e, NtUserGetRawInputData, 20 ) \
-    SYSCALL_ENTRY( 0x113f, NtUserGetRawInputDeviceInfo, 16 ) \
-    SYSCALL_ENTRY( 0x1140, NtUserGetRawInputDeviceList, 12 ) \
-    SYSCALL_ENTRY( 0x1141, NtUserGetRegisteredRawInputDevices, 12 ) \
-    SYSCALL_ENTRY( 0x1142, NtUserGetScrollBarInfo, 12 ) \
-    SYSCALL_ENTRY( 0x1143, NtUserGetSystemDpiForProcess, 4 ) \
-    SYSCALL_ENTRY( 0x1144, NtUserGetSystemMenu, 8 ) \
-    SYSCALL_ENTRY( 0x1145, NtUserGetThreadDesktop, 4 ) \
-    SYSCALL_ENTRY( 0x1146, NtUserGetThreadState, 4 ) \
-    SYSCALL_ENTRY( 0x1147, NtUserGetTitleBarInfo, 8 ) \
-    SYSCALL_ENTRY( 0x1148, NtUserGetUpdateRect, 12 ) \
-    SYSCALL_ENTRY( 0x1149, NtUserGetUpdateRgn, 12 ) \
-    SYSCALL_ENTRY( 0x114a, NtUserGetUpdatedClipboardFormats, 12 ) \
-    SYSCALL_ENTRY( 0x114b, NtUserGetWindowContextHelpId, 4 ) \
-    SYSCALL_ENTRY( 0x114c, NtUserGetWindowDC, 4 ) \
-    SYSCALL_ENTRY( 0x114d, NtUserGetWindowPlacement, 8 ) \
-    SYSCALL_ENTRY( 0x114e, NtUserGetWindowRgnEx, 12 ) \
-    SYSCALL_ENTRY( 0x114f, NtUserHideCaret, 4 ) \
-    SYSCALL_ENTRY( 0x1150, NtUserHiliteMenuItem, 16 ) \
-    SYSCALL_ENTRY( 0x1151, NtUserInitializeClientPfnArrays, 16 ) \
-    SYSCALL_ENTRY( 0x1152, NtUserInternalGetWindowIcon, 8 ) \
-    SYSCALL_ENTRY( 0x1153, NtUserInternalGetWindowText, 12 ) \
-    SYSCALL_ENTRY( 0x1154, NtUserInvalidateRect, 12 ) \
-    SYSCALL_ENTRY( 0x1155, NtUserInvalidateRgn, 12 ) \
-    SYSCALL_ENTRY( 0x1156, NtUserIsChildWindowDpiMessageEnabled, 4 ) \
-    SYSCALL_ENTRY( 0x1157, NtUserIsClipboardFormatAvailable, 4 ) \
-    SYSCALL_ENTRY( 0x1158, NtUserIsMouseInPointerEnabled, 0 ) \
-    SYSCALL_ENTRY( 0x1159, NtUserKillSystemTimer, 8 ) \
-    SYSCALL_ENTRY( 0x115a, NtUserKillTimer, 8 ) \
-    SYSCALL_ENTRY( 0x115b, NtUserLockWindowUpdate, 4 ) \
-    SYSCALL_ENTRY( 0x115c, NtUserLogicalToPerMonitorDPIPhysicalPoint, 8 ) \
-    SYSCALL_ENTRY( 0x115d, NtUserMapVirtualKeyEx, 12 ) \
-    SYSCALL_ENTRY( 0x115e, NtUserMenuItemFromPoint, 16 ) \
-    SYSCALL_ENTRY( 0x115f, NtUserMessageBeep, 4 ) \
-    SYSCALL_ENTRY( 0x1160, NtUserMessageCall, 28 ) \
-    SYSCALL_ENTRY( 0x1161, NtUserMoveWindow, 24 ) \
-    SYSCALL_ENTRY( 0x1162, NtUserMsgWaitForMultipleObjectsEx, 20 ) \
-    SYSCALL_ENTRY( 0x1163, NtUserNotifyIMEStatus, 8 ) \
-    SYSCALL_ENTRY( 0x1164, NtUserNotifyWinEvent, 16 ) \
-    SYSCALL_ENTRY( 0x1165, NtUserOpenClipboard, 8 ) \
-    SYSCALL_ENTRY( 0x1166, NtUserOpenDesktop, 12 ) \
-    SYSCALL_ENTRY( 0x1167, NtUserOpenInputDesktop, 12 ) \
-    SYSCALL_ENTRY( 0x1168, NtUserOpenWindowStation, 8 ) \
-    SYSCALL_ENTRY( 0x1169, NtUserPeekMessage, 20 ) \
-    SYSCALL_ENTRY( 0x116a, NtUserPerMonitorDPIPhysicalToLogicalPoint, 8 ) \
-    SYSCALL_ENTRY( 0x116b, NtUserPostMessage, 16 ) \
-    SYSCALL_ENTRY( 0x116c, NtUserPostQuitMessage, 4 ) \
-    SYSCALL_ENTRY( 0x116d, NtUserPostThreadMessage, 16 ) \
-    SYSCALL_ENTRY( 0x116e, NtUserPrintWindow, 12 ) \
-    SYSCALL_ENTRY( 0x116f, NtUserQueryDisplayConfig, 24 ) \
-    SYSCALL_ENTRY( 0x1170, NtUserQueryInputContext, 8 ) \
-    SYSCALL_ENTRY( 0x1171, NtUserQueryWindow, 8 ) \
-    SYSCALL_ENTRY( 0x1172, NtUserRealChildWindowFromPoint, 12 ) \
-    SYSCALL_ENTRY( 0x1173, NtUserRealizePalette, 4 ) \
-    SYSCALL_ENTRY( 0x1174, NtUserRedrawWindow, 16 ) \
-    SYSCALL_ENTRY( 0x1175, NtUserRegisterClassExWOW, 28 ) \
-    SYSCALL_ENTRY( 0x1176, NtUserRegisterHotKey, 16 ) \
-    SYSCALL_ENTRY( 0x1177, NtUserRegisterRawInputDevices, 12 ) \
-    SYSCALL_ENTRY( 0x1178, NtUserRegisterTouchPadCapable, 4 ) \
-    SYSCALL_ENTRY( 0x1179, NtUserRegisterWindowMessage, 4 ) \
-    SYSCALL_ENTRY( 0x117a, NtUserReleaseCapture, 0 ) \
-    SYSCALL_ENTRY( 0x117b, NtUserReleaseDC, 8 ) \
-    SYSCALL_ENTRY( 0x117c, NtUserRemoveClipboardFormatListener, 4 ) \
-    SYSCALL_ENTRY( 0x117d, NtUserRemoveMenu, 12 ) \
-    SYSCALL_ENTRY( 0x117e, NtUserRemoveProp, 8 ) \
-    SYSCALL_ENTRY( 0x117f, NtUserReplyMessage, 4 ) \
-    SYSCALL_ENTRY( 0x1180, NtUserScrollDC, 28 ) \
-    SYSCALL_ENTRY( 0x1181, NtUserScrollWindowEx, 32 ) \
-    SYSCALL_ENTRY( 0x1182, NtUserSelectPalette, 12 ) \
-    SYSCALL_ENTRY( 0x1183, NtUserSendInput, 12 ) \
-    SYSCALL_ENTRY( 0x1184, NtUserSetActiveWindow, 4 ) \
-    SYSCALL_ENTRY( 0x1185, NtUserSetAdditionalForegroundBoostProcesses, 12 ) \
-    SYSCALL_ENTRY( 0x1186, NtUserSetCapture, 4 ) \
-    SYSCALL_ENTRY( 0x1187, NtUserSetCaretBlinkTime, 4 ) \
-    SYSCALL_ENTRY( 0x1188, NtUserSetCaretPos, 8 ) \
-    SYSCALL_ENTRY( 0x1189, NtUserSetClassLong, 16 ) \
-    SYSCALL_ENTRY( 0x118a, NtUserSetClassLongPtr, 16 ) \
-    SYSCALL_ENTRY( 0x118b, NtUserSetClassWord, 12 ) \
-    SYSCALL_ENTRY( 0x118c, NtUserSetClipboardData, 12 ) \
-    SYSCALL_ENTRY( 0x118d, NtUserSetClipboardViewer, 4 ) \
-    SYSCALL_ENTRY( 0x118e, NtUserSetCursor, 4 ) \
-    SYSCALL_ENTRY( 0x118f, NtUserSetCursorIconData, 16 ) \
-    SYSCALL_ENTRY( 0x1190, NtUserSetCursorPos, 8 ) \
-    SYSCALL_ENTRY( 0x1191, NtUserSetFocus, 4 ) \
-    SYSCALL_ENTRY( 0x1192, NtUserSetForegroundWindow, 4 ) \
-    SYSCALL_ENTRY( 0x1193, NtUserSetInternalWindowPos, 16 ) \
-    SYSCALL_ENTRY( 0x1194, NtUserSetKeyboardState, 4 ) \
-    SYSCALL_ENTRY( 0x1195, NtUserSetLayeredWindowAttributes, 16 ) \
-    SYSCALL_ENTRY( 0x1196, NtUserSetMenu, 8 ) \
-    SYSCALL_ENTRY( 0x1197, NtUserSetMenuContextHelpId, 8 ) \
-    SYSCALL_ENTRY( 0x1198, NtUserSetMenuDefaultItem, 12 ) \
-    SYSCALL_ENTRY( 0x1199, NtUserSetObjectInformation, 16 ) \
-    SYSCALL_ENTRY( 0x119a, NtUserSetParent, 8 ) \
-    SYSCALL_ENTRY( 0x119b, NtUserSetProcessDefaultLayout, 4 ) \
-    SYSCALL_ENTRY( 0x119c, NtUserSetProcessDpiAwarenessContext, 8 ) \
-    SYSCALL_ENTRY( 0x119d, NtUserSetProcessWindowStation, 4 ) \
-    SYSCALL_ENTRY( 0x119e, NtUserSetProgmanWindow, 4 ) \
-    SYSCALL_ENTRY( 0x119f, NtUserSetProp, 12 ) \
-    SYSCALL_ENTRY( 0x11a0, NtUserSetScrollInfo, 16 ) \
-    SYSCALL_ENTRY( 0x11a1, NtUserSetShellWindowEx, 8 ) \
-    SYSCALL_ENTRY( 0x11a2, NtUserSetSysColors, 12 ) \
-    SYSCALL_ENTRY( 0x11a3, NtUserSetSystemMenu, 8 ) \
-    SYSCALL_ENTRY( 0x11a4, NtUserSetSystemTimer, 12 ) \
-    SYSCALL_ENTRY( 0x11a5, NtUserSetTaskmanWindow, 4 ) \
-    SYSCALL_ENTRY( 0x11a6, NtUserSetThreadDesktop, 4 ) \
-    SYSCALL_ENTRY( 0x11a7, NtUserSetTimer, 20 ) \
-    SYSCALL_ENTRY( 0x11a8, NtUserSetWinEventHook, 32 ) \
-    SYSCALL_ENTRY( 0x11a9, NtUserSetWindowContextHelpId, 8 ) \
-    SYSCALL_ENTRY( 0x11aa, NtUserSetWindowLong, 16 ) \
-    SYSCALL_ENTRY( 0x11ab, NtUserSetWindowLongPtr, 16 ) \
-    SYSCALL_ENTRY( 0x11ac, NtUserSetWindowPlacement, 8 ) \
-    SYSCALL_ENTRY( 0x11ad, NtUserSetWindowPos, 28 ) \
-    SYSCALL_ENTRY( 0x11ae, NtUserSetWindowRgn, 12 ) \
-    SYSCALL_ENTRY( 0x11af, NtUserSetWindowWord, 12 ) \
-    SYSCALL_ENTRY( 0x11b0, NtUserSetWindowsHookEx, 24 ) \
-    SYSCALL_ENTRY( 0x11b1, NtUserShowCaret, 4 ) \
-    SYSCALL_ENTRY( 0x11b2, NtUserShowCursor, 4 ) \
-    SYSCALL_ENTRY( 0x11b3, NtUserShowOwnedPopups, 8 ) \
-    SYSCALL_ENTRY( 0x11b4, NtUserShowScrollBar, 12 ) \
-    SYSCALL_ENTRY( 0x11b5, NtUserShowWindow, 8 ) \
-    SYSCALL_ENTRY( 0x11b6, NtUserShowWindowAsync, 8 ) \
-    SYSCALL_ENTRY( 0x11b7, NtUserSwitchDesktop, 4 ) \
-    SYSCALL_ENTRY( 0x11b8, NtUserSystemParametersInfo, 16 ) \
-    SYSCALL_ENTRY( 0x11b9, NtUserSystemParametersInfoForDpi, 20 ) \
-    SYSCALL_ENTRY( 0x11ba, NtUserThunkedMenuInfo, 8 ) \
-    SYSCALL_ENTRY( 0x11bb, NtUserThunkedMenuItemInfo, 24 ) \
-    SYSCALL_ENTRY( 0x11bc, NtUserToUnicodeEx, 28 ) \
-    SYSCALL_ENTRY( 0x11bd, NtUserTrackMouseEvent, 4 ) \
-    SYSCALL_ENTRY( 0x11be, NtUserTrackPopupMenuEx, 24 ) \
-    SYSCALL_ENTRY( 0x11bf, NtUserTranslateAccelerator, 12 ) \
-    SYSCALL_ENTRY( 0x11c0, NtUserTranslateMessage, 8 ) \
-    SYSCALL_ENTRY( 0x11c1, NtUserUnhookWinEvent, 4 ) \
-    SYSCALL_ENTRY( 0x11c2, NtUserUnhookWindowsHook, 8 ) \
-    SYSCALL_ENTRY( 0x11c3, NtUserUnhookWindowsHookEx, 4 ) \
-    SYSCALL_ENTRY( 0x11c4, NtUserUnregisterClass, 12 ) \
-    SYSCALL_ENTRY( 0x11c5, NtUserUnregisterHotKey, 8 ) \
-    SYSCALL_ENTRY( 0x11c6, NtUserUpdateInputContext, 12 ) \
-    SYSCALL_ENTRY( 0x11c7, NtUserUpdateLayeredWindow, 40 ) \
-    SYSCALL_ENTRY( 0x11c8, NtUserValidateRect, 8 ) \
-    SYSCALL_ENTRY( 0x11c9, NtUserValidateRgn, 8 ) \
-    SYSCALL_ENTRY( 0x11ca, NtUserVkKeyScanEx, 8 ) \
-    SYSCALL_ENTRY( 0x11cb, NtUserWaitForInputIdle, 12 ) \
-    SYSCALL_ENTRY( 0x11cc, NtUserWaitMessage, 0 ) \
-    SYSCALL_ENTRY( 0x11cd, NtUserWindowFromDC, 4 ) \
-    SYSCALL_ENTRY( 0x11ce, NtUserWindowFromPoint, 8 ) \
-    SYSCALL_ENTRY( 0x11cf, __wine_get_icm_profile, 16 )
+    SYSCALL_ENTRY( 0x1097, NtGdiPolyPatBlt, 20 ) \
+    SYSCALL_ENTRY( 0x1098, NtGdiPolyPolyDraw, 20 ) \
+    SYSCALL_ENTRY( 0x1099, NtGdiPtInRegion, 12 ) \
+    SYSCALL_ENTRY( 0x109a, NtGdiPtVisible, 12 ) \
+    SYSCALL_ENTRY( 0x109b, NtGdiRectInRegion, 8 ) \
+    SYSCALL_ENTRY( 0x109c, NtGdiRectVisible, 8 ) \
+    SYSCALL_ENTRY( 0x109d, NtGdiRectangle, 20 ) \
+    SYSCALL_ENTRY( 0x109e, NtGdiRemoveFontMemResourceEx, 4 ) \
+    SYSCALL_ENTRY( 0x109f, NtGdiRemoveFontResourceW, 24 ) \
+    SYSCALL_ENTRY( 0x10a0, NtGdiResetDC, 20 ) \
+    SYSCALL_ENTRY( 0x10a1, NtGdiResizePalette, 8 ) \
+    SYSCALL_ENTRY( 0x10a2, NtGdiRestoreDC, 8 ) \
+    SYSCALL_ENTRY( 0x10a3, NtGdiRoundRect, 28 ) \
+    SYSCALL_ENTRY( 0x10a4, NtGdiSaveDC, 4 ) \
+    SYSCALL_ENTRY( 0x10a5, NtGdiScaleViewportExtEx, 24 ) \
+    SYSCALL_ENTRY( 0x10a6, NtGdiScaleWindowExtEx, 24 ) \
+    SYSCALL_ENTRY( 0x10a7, NtGdiSelectBitmap, 8 ) \
+    SYSCALL_ENTRY( 0x10a8, NtGdiSelectBrush, 8 ) \
+    SYSCALL_ENTRY( 0x10a9, NtGdiSelectClipPath, 8 ) \
+    SYSCALL_ENTRY( 0x10aa, NtGdiSelectFont, 8 ) \
+    SYSCALL_ENTRY( 0x10ab, NtGdiSelectPen, 8 ) \
+    SYSCALL_ENTRY( 0x10ac, NtGdiSetBitmapBits, 12 ) \
+    SYSCALL_ENTRY( 0x10ad, NtGdiSetBitmapDimension, 16 ) \
+    SYSCALL_ENTRY( 0x10ae, NtGdiSetBoundsRect, 12 ) \
+    SYSCALL_ENTRY( 0x10af, NtGdiSetBrushOrg, 16 ) \
+    SYSCALL_ENTRY( 0x10b0, NtGdiSetColorAdjustment, 8 ) \
+    SYSCALL_ENTRY( 0x10b1, NtGdiSetDIBitsToDeviceInternal, 64 ) \
+    SYSCALL_ENTRY( 0x10b2, NtGdiSetDeviceGammaRamp, 8 ) \
+    SYSCALL_ENTRY( 0x10b3, NtGdiSetLayout, 12 ) \
+    SYSCALL_ENTRY( 0x10b4, NtGdiSetMagicColors, 12 ) \
+    SYSCALL_ENTRY( 0x10b5, NtGdiSetMetaRgn, 4 ) \
+    SYSCALL_ENTRY( 0x10b6, NtGdiSetPixel, 16 ) \
+    SYSCALL_ENTRY( 0x10b7, NtGdiSetPixelFormat, 8 ) \
+    SYSCALL_ENTRY( 0x10b8, NtGdiSetRectRgn, 20 ) \
+    SYSCALL_ENTRY( 0x10b9, NtGdiSetSystemPaletteUse, 8 ) \
+    SYSCALL_ENTRY( 0x10ba, NtGdiSetTextJustification, 12 ) \
+    SYSCALL_ENTRY( 0x10bb, NtGdiSetVirtualResolution, 20 ) \
+    SYSCALL_ENTRY( 0x10bc, NtGdiStartDoc, 16 ) \
+    SYSCALL_ENTRY( 0x10bd, NtGdiStartPage, 4 ) \
+    SYSCALL_ENTRY( 0x10be, NtGdiStretchBlt, 48 ) \
+    SYSCALL_ENTRY( 0x10bf, NtGdiStretchDIBitsInternal, 64 ) \
+    SYSCALL_ENTRY( 0x10c0, NtGdiStrokeAndFillPath, 4 ) \
+    SYSCALL_ENTRY( 0x10c1, NtGdiStrokePath, 4 ) \
+    SYSCALL_ENTRY( 0x10c2, NtGdiSwapBuffers, 4 ) \
+    SYSCALL_ENTRY( 0x10c3, NtGdiTransformPoints, 20 ) \
+    SYSCALL_ENTRY( 0x10c4, NtGdiTransparentBlt, 44 ) \
+    SYSCALL_ENTRY( 0x10c5, NtGdiUnrealizeObject, 4 ) \
+    SYSCALL_ENTRY( 0x10c6, NtGdiUpdateColors, 4 ) \
+    SYSCALL_ENTRY( 0x10c7, NtGdiWidenPath, 4 ) \
+    SYSCALL_ENTRY( 0x10c8, NtUserActivateKeyboardLayout, 8 ) \
+    SYSCALL_ENTRY( 0x10c9, NtUserAddClipboardFormatListener, 4 ) \
+    SYSCALL_ENTRY( 0x10ca, NtUserAlterWindowStyle, 12 ) \
+    SYSCALL_ENTRY( 0x10cb, NtUserArrangeIconicWindows, 4 ) \
+    SYSCALL_ENTRY( 0x10cc, NtUserAssociateInputContext, 12 ) \
+    SYSCALL_ENTRY( 0x10cd, NtUserAttachThreadInput, 12 ) \
+    SYSCALL_ENTRY( 0x10ce, NtUserBeginDeferWindowPos, 4 ) \
+    SYSCALL_ENTRY( 0x10cf, NtUserBeginPaint, 8 ) \
+    SYSCALL_ENTRY( 0x10d0, NtUserBuildHimcList, 16 ) \
+    SYSCALL_ENTRY( 0x10d1, NtUserBuildHwndList, 32 ) \
+    SYSCALL_ENTRY( 0x10d2, NtUserBuildNameList, 16 ) \
+    SYSCALL_ENTRY( 0x10d3, NtUserBuildPropList, 16 ) \
+    SYSCALL_ENTRY( 0x10d4, NtUserCallHwnd, 8 ) \
+    SYSCALL_ENTRY( 0x10d5, NtUserCallHwndParam, 12 ) \
+    SYSCALL_ENTRY( 0x10d6, NtUserCallMsgFilter, 8 ) \
+    SYSCALL_ENTRY( 0x10d7, NtUserCallNextHookEx, 16 ) \
+    SYSCALL_ENTRY( 0x10d8, NtUserCallNoParam, 4 ) \
+    SYSCALL_ENTRY( 0x10d9, NtUserCallOneParam, 8 ) \
+    SYSCALL_ENTRY( 0x10da, NtUserCallTwoParam, 12 ) \
+    SYSCALL_ENTRY( 0x10db, NtUserChangeClipboardChain, 8 ) \
+    SYSCALL_ENTRY( 0x10dc, NtUserChangeDisplaySettings, 20 ) \
+    SYSCALL_ENTRY( 0x10dd, NtUserCheckMenuItem, 12 ) \
+    SYSCALL_ENTRY( 0x10de, NtUserChildWindowFromPointEx, 16 ) \
+    SYSCALL_ENTRY( 0x10df, NtUserClipCursor, 4 ) \
+    SYSCALL_ENTRY( 0x10e0, NtUserCloseClipboard, 0 ) \
+    SYSCALL_ENTRY( 0x10e1, NtUserCloseDesktop, 4 ) \
+    SYSCALL_ENTRY( 0x10e2, NtUserCloseWindowStation, 4 ) \
+    SYSCALL_ENTRY( 0x10e3, NtUserCopyAcceleratorTable, 12 ) \
+    SYSCALL_ENTRY( 0x10e4, NtUserCountClipboardFormats, 0 ) \
+    SYSCALL_ENTRY( 0x10e5, NtUserCreateAcceleratorTable, 8 ) \
+    SYSCALL_ENTRY( 0x10e6, NtUserCreateCaret, 16 ) \
+    SYSCALL_ENTRY( 0x10e7, NtUserCreateDesktopEx, 24 ) \
+    SYSCALL_ENTRY( 0x10e8, NtUserCreateInputContext, 4 ) \
+    SYSCALL_ENTRY( 0x10e9, NtUserCreateMenu, 0 ) \
+    SYSCALL_ENTRY( 0x10ea, NtUserCreatePopupMenu, 0 ) \
+    SYSCALL_ENTRY( 0x10eb, NtUserCreateWindowEx, 68 ) \
+    SYSCALL_ENTRY( 0x10ec, NtUserCreateWindowStation, 28 ) \
+    SYSCALL_ENTRY( 0x10ed, NtUserDeferWindowPosAndBand, 40 ) \
+    SYSCALL_ENTRY( 0x10ee, NtUserDeleteMenu, 12 ) \
+    SYSCALL_ENTRY( 0x10ef, NtUserDestroyAcceleratorTable, 4 ) \
+    SYSCALL_ENTRY( 0x10f0, NtUserDestroyCaret, 0 ) \
+    SYSCALL_ENTRY( 0x10f1, NtUserDestroyCursor, 8 ) \
+    SYSCALL_ENTRY( 0x10f2, NtUserDestroyInputContext, 4 ) \
+    SYSCALL_ENTRY( 0x10f3, NtUserDestroyMenu, 4 ) \
+    SYSCALL_ENTRY( 0x10f4, NtUserDestroyWindow, 4 ) \
+    SYSCALL_ENTRY( 0x10f5, NtUserDisableThreadIme, 4 ) \
+    SYSCALL_ENTRY( 0x10f6, NtUserDispatchMessage, 4 ) \
+    SYSCALL_ENTRY( 0x10f7, NtUserDisplayConfigGetDeviceInfo, 4 ) \
+    SYSCALL_ENTRY( 0x10f8, NtUserDragDetect, 12 ) \
+    SYSCALL_ENTRY( 0x10f9, NtUserDragObject, 20 ) \
+    SYSCALL_ENTRY( 0x10fa, NtUserDrawCaptionTemp, 28 ) \
+    SYSCALL_ENTRY( 0x10fb, NtUserDrawIconEx, 36 ) \
+    SYSCALL_ENTRY( 0x10fc, NtUserDrawMenuBar, 4 ) \
+    SYSCALL_ENTRY( 0x10fd, NtUserDrawMenuBarTemp, 20 ) \
+    SYSCALL_ENTRY( 0x10fe, NtUserEmptyClipboard, 0 ) \
+    SYSCALL_ENTRY( 0x10ff, NtUserEnableMenuItem, 12 ) \
+    SYSCALL_ENTRY( 0x1100, NtUserEnableMouseInPointer, 4 ) \
+    SYSCALL_ENTRY( 0x1101, NtUserEnableMouseInPointerForThread, 0 ) \
+    SYSCALL_ENTRY( 0x1102, NtUserEnableScrollBar, 12 ) \
+    SYSCALL_ENTRY( 0x1103, NtUserEnableWindow, 8 ) \
+    SYSCALL_ENTRY( 0x1104, NtUserEndDeferWindowPosEx, 8 ) \
+    SYSCALL_ENTRY( 0x1105, NtUserEndMenu, 0 ) \
+    SYSCALL_ENTRY( 0x1106, NtUserEndPaint, 8 ) \
+    SYSCALL_ENTRY( 0x1107, NtUserEnumClipboardFormats, 4 ) \
+    SYSCALL_ENTRY( 0x1108, NtUserEnumDisplayDevices, 16 ) \
+    SYSCALL_ENTRY( 0x1109, NtUserEnumDisplayMonitors, 16 ) \
+    SYSCALL_ENTRY( 0x110a, NtUserEnumDisplaySettings, 16 ) \
+    SYSCALL_ENTRY( 0x110b, NtUserExcludeUpdateRgn, 8 ) \
+    SYSCALL_ENTRY( 0x110c, NtUserFindExistingCursorIcon, 12 ) \
+    SYSCALL_ENTRY( 0x110d, NtUserFindWindowEx, 20 ) \
+    SYSCALL_ENTRY( 0x110e, NtUserFlashWindowEx, 4 ) \
+    SYSCALL_ENTRY( 0x110f, NtUserGetAncestor, 8 ) \
+    SYSCALL_ENTRY( 0x1110, NtUserGetAsyncKeyState, 4 ) \
+    SYSCALL_ENTRY( 0x1111, NtUserGetAtomName, 8 ) \
+    SYSCALL_ENTRY( 0x1112, NtUserGetCaretBlinkTime, 0 ) \
+    SYSCALL_ENTRY( 0x1113, NtUserGetCaretPos, 4 ) \
+    SYSCALL_ENTRY( 0x1114, NtUserGetClassInfoEx, 20 ) \
+    SYSCALL_ENTRY( 0x1115, NtUserGetClassName, 12 ) \
+    SYSCALL_ENTRY( 0x1116, NtUserGetClipCursor, 4 ) \
+    SYSCALL_ENTRY( 0x1117, NtUserGetClipboardData, 8 ) \
+    SYSCALL_ENTRY( 0x1118, NtUserGetClipboardFormatName, 12 ) \
+    SYSCALL_ENTRY( 0x1119, NtUserGetClipboardOwner, 0 ) \
+    SYSCALL_ENTRY( 0x111a, NtUserGetClipboardSequenceNumber, 0 ) \
+    SYSCALL_ENTRY( 0x111b, NtUserGetClipboardViewer, 0 ) \
+    SYSCALL_ENTRY( 0x111c, NtUserGetCurrentInputMessageSource, 4 ) \
+    SYSCALL_ENTRY( 0x111d, NtUserGetCursor, 0 ) \
+    SYSCALL_ENTRY( 0x111e, NtUserGetCursorFrameInfo, 16 ) \
+    SYSCALL_ENTRY( 0x111f, NtUserGetCursorInfo, 4 ) \
+    SYSCALL_ENTRY( 0x1120, NtUserGetDC, 4 ) \
+    SYSCALL_ENTRY( 0x1121, NtUserGetDCEx, 12 ) \
+    SYSCALL_ENTRY( 0x1122, NtUserGetDisplayConfigBufferSizes, 12 ) \
+    SYSCALL_ENTRY( 0x1123, NtUserGetDoubleClickTime, 0 ) \
+    SYSCALL_ENTRY( 0x1124, NtUserGetDpiForMonitor, 16 ) \
+    SYSCALL_ENTRY( 0x1125, NtUserGetForegroundWindow, 0 ) \
+    SYSCALL_ENTRY( 0x1126, NtUserGetGUIThreadInfo, 8 ) \
+    SYSCALL_ENTRY( 0x1127, NtUserGetIconInfo, 24 ) \
+    SYSCALL_ENTRY( 0x1128, NtUserGetIconSize, 16 ) \
+    SYSCALL_ENTRY( 0x1129, NtUserGetInternalWindowPos, 12 ) \
+    SYSCALL_ENTRY( 0x112a, NtUserGetKeyNameText, 12 ) \
+    SYSCALL_ENTRY( 0x112b, NtUserGetKeyState, 4 ) \
+    SYSCALL_ENTRY( 0x112c, NtUserGetKeyboardLayout, 4 ) \
+    SYSCALL_ENTRY( 0x112d, NtUserGetKeyboardLayoutList, 8 ) \
+    SYSCALL_ENTRY( 0x112e, NtUserGetKeyboardLayoutName, 4 ) \
+    SYSCALL_ENTRY( 0x112f, NtUserGetKeyboardState, 4 ) \
+    SYSCALL_ENTRY( 0x1130, NtUserGetLayeredWindowAttributes, 16 ) \
+    SYSCALL_ENTRY( 0x1131, NtUserGetMenuBarInfo, 16 ) \
+    SYSCALL_ENTRY( 0x1132, NtUserGetMenuItemRect, 16 ) \
+    SYSCALL_ENTRY( 0x1133, NtUserGetMessage, 16 ) \
+    SYSCALL_ENTRY( 0x1134, NtUserGetMouseMovePointsEx, 20 ) \
+    SYSCALL_ENTRY( 0x1135, NtUserGetObjectInformation, 20 ) \
+    SYSCALL_ENTRY( 0x1136, NtUserGetOpenClipboardWindow, 0 ) \
+    SYSCALL_ENTRY( 0x1137, NtUserGetPointerInfoList, 32 ) \
+    SYSCALL_ENTRY( 0x1138, NtUserGetPriorityClipboardFormat, 8 ) \
+    SYSCALL_ENTRY( 0x1139, NtUserGetProcessDefaultLayout, 4 ) \
+    SYSCALL_ENTRY( 0x113a, NtUserGetProcessDpiAwarenessContext, 4 ) \
+    SYSCALL_ENTRY( 0x113b, NtUserGetProcessWindowStation, 0 ) \
+    SYSCALL_ENTRY( 0x113c, NtUserGetProp, 8 ) \
+    SYSCALL_ENTRY( 0x113d, NtUserGetQueueStatus, 4 ) \
+    SYSCALL_ENTRY( 0x113e, NtUserGetRawInputBuffer, 12 ) \
+    SYSCALL_ENTRY( 0x113f, NtUserGetRawInputData, 20 ) \
+    SYSCALL_ENTRY( 0x1140, NtUserGetRawInputDeviceInfo, 16 ) \
+    SYSCALL_ENTRY( 0x1141, NtUserGetRawInputDeviceList, 12 ) \
+    SYSCALL_ENTRY( 0x1142, NtUserGetRegisteredRawInputDevices, 12 ) \
+    SYSCALL_ENTRY( 0x1143, NtUserGetScrollBarInfo, 12 ) \
+    SYSCALL_ENTRY( 0x1144, NtUserGetSystemDpiForProcess, 4 ) \
+    SYSCALL_ENTRY( 0x1145, NtUserGetSystemMenu, 8 ) \
+    SYSCALL_ENTRY( 0x1146, NtUserGetThreadDesktop, 4 ) \
+    SYSCALL_ENTRY( 0x1147, NtUserGetThreadState, 4 ) \
+    SYSCALL_ENTRY( 0x1148, NtUserGetTitleBarInfo, 8 ) \
+    SYSCALL_ENTRY( 0x1149, NtUserGetUpdateRect, 12 ) \
+    SYSCALL_ENTRY( 0x114a, NtUserGetUpdateRgn, 12 ) \
+    SYSCALL_ENTRY( 0x114b, NtUserGetUpdatedClipboardFormats, 12 ) \
+    SYSCALL_ENTRY( 0x114c, NtUserGetWindowContextHelpId, 4 ) \
+    SYSCALL_ENTRY( 0x114d, NtUserGetWindowDC, 4 ) \
+    SYSCALL_ENTRY( 0x114e, NtUserGetWindowPlacement, 8 ) \
+    SYSCALL_ENTRY( 0x114f, NtUserGetWindowRgnEx, 12 ) \
+    SYSCALL_ENTRY( 0x1150, NtUserHideCaret, 4 ) \
+    SYSCALL_ENTRY( 0x1151, NtUserHiliteMenuItem, 16 ) \
+    SYSCALL_ENTRY( 0x1152, NtUserInitializeClientPfnArrays, 16 ) \
+    SYSCALL_ENTRY( 0x1153, NtUserInternalGetWindowIcon, 8 ) \
+    SYSCALL_ENTRY( 0x1154, NtUserInternalGetWindowText, 12 ) \
+    SYSCALL_ENTRY( 0x1155, NtUserInvalidateRect, 12 ) \
+    SYSCALL_ENTRY( 0x1156, NtUserInvalidateRgn, 12 ) \
+    SYSCALL_ENTRY( 0x1157, NtUserIsChildWindowDpiMessageEnabled, 4 ) \
+    SYSCALL_ENTRY( 0x1158, NtUserIsClipboardFormatAvailable, 4 ) \
+    SYSCALL_ENTRY( 0x1159, NtUserIsMouseInPointerEnabled, 0 ) \
+    SYSCALL_ENTRY( 0x115a, NtUserKillSystemTimer, 8 ) \
+    SYSCALL_ENTRY( 0x115b, NtUserKillTimer, 8 ) \
+    SYSCALL_ENTRY( 0x115c, NtUserLockWindowUpdate, 4 ) \
+    SYSCALL_ENTRY( 0x115d, NtUserLogicalToPerMonitorDPIPhysicalPoint, 8 ) \
+    SYSCALL_ENTRY( 0x115e, NtUserMapVirtualKeyEx, 12 ) \
+    SYSCALL_ENTRY( 0x115f, NtUserMenuItemFromPoint, 16 ) \
+    SYSCALL_ENTRY( 0x1160, NtUserMessageBeep, 4 ) \
+    SYSCALL_ENTRY( 0x1161, NtUserMessageCall, 28 ) \
+    SYSCALL_ENTRY( 0x1162, NtUserMoveWindow, 24 ) \
+    SYSCALL_ENTRY( 0x1163, NtUserMsgWaitForMultipleObjectsEx, 20 ) \
+    SYSCALL_ENTRY( 0x1164, NtUserNotifyIMEStatus, 8 ) \
+    SYSCALL_ENTRY( 0x1165, NtUserNotifyWinEvent, 16 ) \
+    SYSCALL_ENTRY( 0x1166, NtUserOpenClipboard, 8 ) \
+    SYSCALL_ENTRY( 0x1167, NtUserOpenDesktop, 12 ) \
+    SYSCALL_ENTRY( 0x1168, NtUserOpenInputDesktop, 12 ) \
+    SYSCALL_ENTRY( 0x1169, NtUserOpenWindowStation, 8 ) \
+    SYSCALL_ENTRY( 0x116a, NtUserPeekMessage, 20 ) \
+    SYSCALL_ENTRY( 0x116b, NtUserPerMonitorDPIPhysicalToLogicalPoint, 8 ) \
+    SYSCALL_ENTRY( 0x116c, NtUserPostMessage, 16 ) \
+    SYSCALL_ENTRY( 0x116d, NtUserPostQuitMessage, 4 ) \
+    SYSCALL_ENTRY( 0x116e, NtUserPostThreadMessage, 16 ) \
+    SYSCALL_ENTRY( 0x116f, NtUserPrintWindow, 12 ) \
+    SYSCALL_ENTRY( 0x1170, NtUserQueryDisplayConfig, 24 ) \
+    SYSCALL_ENTRY( 0x1171, NtUserQueryInputContext, 8 ) \
+    SYSCALL_ENTRY( 0x1172, NtUserQueryWindow, 8 ) \
+    SYSCALL_ENTRY( 0x1173, NtUserRealChildWindowFromPoint, 12 ) \
+    SYSCALL_ENTRY( 0x1174, NtUserRealizePalette, 4 ) \
+    SYSCALL_ENTRY( 0x1175, NtUserRedrawWindow, 16 ) \
+    SYSCALL_ENTRY( 0x1176, NtUserRegisterClassExWOW, 28 ) \
+    SYSCALL_ENTRY( 0x1177, NtUserRegisterHotKey, 16 ) \
+    SYSCALL_ENTRY( 0x1178, NtUserRegisterRawInputDevices, 12 ) \
+    SYSCALL_ENTRY( 0x1179, NtUserRegisterTouchPadCapable, 4 ) \
+    SYSCALL_ENTRY( 0x117a, NtUserRegisterWindowMessage, 4 ) \
+    SYSCALL_ENTRY( 0x117b, NtUserReleaseCapture, 0 ) \
+    SYSCALL_ENTRY( 0x117c, NtUserReleaseDC, 8 ) \
+    SYSCALL_ENTRY( 0x117d, NtUserRemoveClipboardFormatListener, 4 ) \
+    SYSCALL_ENTRY( 0x117e, NtUserRemoveMenu, 12 ) \
+    SYSCALL_ENTRY( 0x117f, NtUserRemoveProp, 8 ) \
+    SYSCALL_ENTRY( 0x1180, NtUserReplyMessage, 4 ) \
+    SYSCALL_ENTRY( 0x1181, NtUserScrollDC, 28 ) \
+    SYSCALL_ENTRY( 0x1182, NtUserScrollWindowEx, 32 ) \
+    SYSCALL_ENTRY( 0x1183, NtUserSelectPalette, 12 ) \
+    SYSCALL_ENTRY( 0x1184, NtUserSendInput, 12 ) \
+    SYSCALL_ENTRY( 0x1185, NtUserSetActiveWindow, 4 ) \
+    SYSCALL_ENTRY( 0x1186, NtUserSetAdditionalForegroundBoostProcesses, 12 ) \
+    SYSCALL_ENTRY( 0x1187, NtUserSetCapture, 4 ) \
+    SYSCALL_ENTRY( 0x1188, NtUserSetCaretBlinkTime, 4 ) \
+    SYSCALL_ENTRY( 0x1189, NtUserSetCaretPos, 8 ) \
+    SYSCALL_ENTRY( 0x118a, NtUserSetClassLong, 16 ) \
+    SYSCALL_ENTRY( 0x118b, NtUserSetClassLongPtr, 16 ) \
+    SYSCALL_ENTRY( 0x118c, NtUserSetClassWord, 12 ) \
+    SYSCALL_ENTRY( 0x118d, NtUserSetClipboardData, 12 ) \
+    SYSCALL_ENTRY( 0x118e, NtUserSetClipboardViewer, 4 ) \
+    SYSCALL_ENTRY( 0x118f, NtUserSetCursor, 4 ) \
+    SYSCALL_ENTRY( 0x1190, NtUserSetCursorIconData, 16 ) \
+    SYSCALL_ENTRY( 0x1191, NtUserSetCursorPos, 8 ) \
+    SYSCALL_ENTRY( 0x1192, NtUserSetFocus, 4 ) \
+    SYSCALL_ENTRY( 0x1193, NtUserSetForegroundWindow, 4 ) \
+    SYSCALL_ENTRY( 0x1194, NtUserSetInternalWindowPos, 16 ) \
+    SYSCALL_ENTRY( 0x1195, NtUserSetKeyboardState, 4 ) \
+    SYSCALL_ENTRY( 0x1196, NtUserSetLayeredWindowAttributes, 16 ) \
+    SYSCALL_ENTRY( 0x1197, NtUserSetMenu, 8 ) \
+    SYSCALL_ENTRY( 0x1198, NtUserSetMenuContextHelpId, 8 ) \
+    SYSCALL_ENTRY( 0x1199, NtUserSetMenuDefaultItem, 12 ) \
+    SYSCALL_ENTRY( 0x119a, NtUserSetObjectInformation, 16 ) \
+    SYSCALL_ENTRY( 0x119b, NtUserSetParent, 8 ) \
+    SYSCALL_ENTRY( 0x119c, NtUserSetProcessDefaultLayout, 4 ) \
+    SYSCALL_ENTRY( 0x119d, NtUserSetProcessDpiAwarenessContext, 8 ) \
+    SYSCALL_ENTRY( 0x119e, NtUserSetProcessWindowStation, 4 ) \
+    SYSCALL_ENTRY( 0x119f, NtUserSetProgmanWindow, 4 ) \
+    SYSCALL_ENTRY( 0x11a0, NtUserSetProp, 12 ) \
+    SYSCALL_ENTRY( 0x11a1, NtUserSetScrollInfo, 16 ) \
+    SYSCALL_ENTRY( 0x11a2, NtUserSetShellWindowEx, 8 ) \
+    SYSCALL_ENTRY( 0x11a3, NtUserSetSysColors, 12 ) \
+    SYSCALL_ENTRY( 0x11a4, NtUserSetSystemMenu, 8 ) \
+    SYSCALL_ENTRY( 0x11a5, NtUserSetSystemTimer, 12 ) \
+    SYSCALL_ENTRY( 0x11a6, NtUserSetTaskmanWindow, 4 ) \
+    SYSCALL_ENTRY( 0x11a7, NtUserSetThreadDesktop, 4 ) \
+    SYSCALL_ENTRY( 0x11a8, NtUserSetTimer, 20 ) \
+    SYSCALL_ENTRY( 0x11a9, NtUserSetWinEventHook, 32 ) \
+    SYSCALL_ENTRY( 0x11aa, NtUserSetWindowContextHelpId, 8 ) \
+    SYSCALL_ENTRY( 0x11ab, NtUserSetWindowLong, 16 ) \
+    SYSCALL_ENTRY( 0x11ac, NtUserSetWindowLongPtr, 16 ) \
+    SYSCALL_ENTRY( 0x11ad, NtUserSetWindowPlacement, 8 ) \
+    SYSCALL_ENTRY( 0x11ae, NtUserSetWindowPos, 28 ) \
+    SYSCALL_ENTRY( 0x11af, NtUserSetWindowRgn, 12 ) \
+    SYSCALL_ENTRY( 0x11b0, NtUserSetWindowWord, 12 ) \
+    SYSCALL_ENTRY( 0x11b1, NtUserSetWindowsHookEx, 24 ) \
+    SYSCALL_ENTRY( 0x11b2, NtUserShowCaret, 4 ) \
+    SYSCALL_ENTRY( 0x11b3, NtUserShowCursor, 4 ) \
+    SYSCALL_ENTRY( 0x11b4, NtUserShowOwnedPopups, 8 ) \
+    SYSCALL_ENTRY( 0x11b5, NtUserShowScrollBar, 12 ) \
+    SYSCALL_ENTRY( 0x11b6, NtUserShowWindow, 8 ) \
+    SYSCALL_ENTRY( 0x11b7, NtUserShowWindowAsync, 8 ) \
+    SYSCALL_ENTRY( 0x11b8, NtUserSwitchDesktop, 4 ) \
+    SYSCALL_ENTRY( 0x11b9, NtUserSystemParametersInfo, 16 ) \
+    SYSCALL_ENTRY( 0x11ba, NtUserSystemParametersInfoForDpi, 20 ) \
+    SYSCALL_ENTRY( 0x11bb, NtUserThunkedMenuInfo, 8 ) \
+    SYSCALL_ENTRY( 0x11bc, NtUserThunkedMenuItemInfo, 24 ) \
+    SYSCALL_ENTRY( 0x11bd, NtUserToUnicodeEx, 28 ) \
+    SYSCALL_ENTRY( 0x11be, NtUserTrackMouseEvent, 4 ) \
+    SYSCALL_ENTRY( 0x11bf, NtUserTrackPopupMenuEx, 24 ) \
+    SYSCALL_ENTRY( 0x11c0, NtUserTranslateAccelerator, 12 ) \
+    SYSCALL_ENTRY( 0x11c1, NtUserTranslateMessage, 8 ) \
+    SYSCALL_ENTRY( 0x11c2, NtUserUnhookWinEvent, 4 ) \
+    SYSCALL_ENTRY( 0x11c3, NtUserUnhookWindowsHook, 8 ) \
+    SYSCALL_ENTRY( 0x11c4, NtUserUnhookWindowsHookEx, 4 ) \
+    SYSCALL_ENTRY( 0x11c5, NtUserUnregisterClass, 12 ) \
+    SYSCALL_ENTRY( 0x11c6, NtUserUnregisterHotKey, 8 ) \
+    SYSCALL_ENTRY( 0x11c7, NtUserUpdateInputContext, 12 ) \
+    SYSCALL_ENTRY( 0x11c8, NtUserUpdateLayeredWindow, 40 ) \
+    SYSCALL_ENTRY( 0x11c9, NtUserValidateRect, 8 ) \
+    SYSCALL_ENTRY( 0x11ca, NtUserValidateRgn, 8 ) \
+    SYSCALL_ENTRY( 0x11cb, NtUserVkKeyScanEx, 8 ) \
+    SYSCALL_ENTRY( 0x11cc, NtUserWaitForInputIdle, 12 ) \
+    SYSCALL_ENTRY( 0x11cd, NtUserWaitMessage, 0 ) \
+    SYSCALL_ENTRY( 0x11ce, NtUserWindowFromDC, 4 ) \
+    SYSCALL_ENTRY( 0x11cf, NtUserWindowFromPoint, 8 ) \
+    SYSCALL_ENTRY( 0x11d0, __wine_get_icm_profile, 16 )
 #ifdef _WIN64
 #define ALL_SYSCALLS \
     SYSCALL_ENTRY( 0x1000, NtGdiAbortDoc, 8 ) \
@@ -618,319 +619,320 @@
     SYSCALL_ENTRY( 0x1094, NtGdiPathToRegion, 8 ) \
     SYSCALL_ENTRY( 0x1095, NtGdiPlgBlt, 88 ) \
     SYSCALL_ENTRY( 0x1096, NtGdiPolyDraw, 32 ) \
-    SYSCALL_ENTRY( 0x1097, NtGdiPolyPolyDraw, 40 ) \
-    SYSCALL_ENTRY( 0x1098, NtGdiPtInRegion, 24 ) \
-    SYSCALL_ENTRY( 0x1099, NtGdiPtVisible, 24 ) \
-    SYSCALL_ENTRY( 0x109a, NtGdiRectInRegion, 16 ) \
-    SYSCALL_ENTRY( 0x109b, NtGdiRectVisible, 16 ) \
-    SYSCALL_ENTRY( 0x109c, NtGdiRectangle, 40 ) \
-    SYSCALL_ENTRY( 0x109d, NtGdiRemoveFontMemResourceEx, 8 ) \
-    SYSCALL_ENTRY( 0x109e, NtGdiRemoveFontResourceW, 48 ) \
-    SYSCALL_ENTRY( 0x109f, NtGdiResetDC, 40 ) \
-    SYSCALL_ENTRY( 0x10a0, NtGdiResizePalette, 16 ) \
-    SYSCALL_ENTRY( 0x10a1, NtGdiRestoreDC, 16 ) \
-    SYSCALL_ENTRY( 0x10a2, NtGdiRoundRect, 56 ) \
-    SYSCALL_ENTRY( 0x10a3, NtGdiSaveDC, 8 ) \
-    SYSCALL_ENTRY( 0x10a4, NtGdiScaleViewportExtEx, 48 ) \
-    SYSCALL_ENTRY( 0x10a5, NtGdiScaleWindowExtEx, 48 ) \
-    SYSCALL_ENTRY( 0x10a6, NtGdiSelectBitmap, 16 ) \
-    SYSCALL_ENTRY( 0x10a7, NtGdiSelectBrush, 16 ) \
-    SYSCALL_ENTRY( 0x10a8, NtGdiSelectClipPath, 16 ) \
-    SYSCALL_ENTRY( 0x10a9, NtGdiSelectFont, 16 ) \
-    SYSCALL_ENTRY( 0x10aa, NtGdiSelectPen, 16 ) \
-    SYSCALL_ENTRY( 0x10ab, NtGdiSetBitmapBits, 24 ) \
-    SYSCALL_ENTRY( 0x10ac, NtGdiSetBitmapDimension, 32 ) \
-    SYSCALL_ENTRY( 0x10ad, NtGdiSetBoundsRect, 24 ) \
-    SYSCALL_ENTRY( 0x10ae, NtGdiSetBrushOrg, 32 ) \
-    SYSCALL_ENTRY( 0x10af, NtGdiSetColorAdjustment, 16 ) \
-    SYSCALL_ENTRY( 0x10b0, NtGdiSetDIBitsToDeviceInternal, 128 ) \
-    SYSCALL_ENTRY( 0x10b1, NtGdiSetDeviceGammaRamp, 16 ) \
-    SYSCALL_ENTRY( 0x10b2, NtGdiSetLayout, 24 ) \
-    SYSCALL_ENTRY( 0x10b3, NtGdiSetMagicColors, 24 ) \
-    SYSCALL_ENTRY( 0x10b4, NtGdiSetMetaRgn, 8 ) \
-    SYSCALL_ENTRY( 0x10b5, NtGdiSetPixel, 32 ) \
-    SYSCALL_ENTRY( 0x10b6, NtGdiSetPixelFormat, 16 ) \
-    SYSCALL_ENTRY( 0x10b7, NtGdiSetRectRgn, 40 ) \
-    SYSCALL_ENTRY( 0x10b8, NtGdiSetSystemPaletteUse, 16 ) \
-    SYSCALL_ENTRY( 0x10b9, NtGdiSetTextJustification, 24 ) \
-    SYSCALL_ENTRY( 0x10ba, NtGdiSetVirtualResolution, 40 ) \
-    SYSCALL_ENTRY( 0x10bb, NtGdiStartDoc, 32 ) \
-    SYSCALL_ENTRY( 0x10bc, NtGdiStartPage, 8 ) \
-    SYSCALL_ENTRY( 0x10bd, NtGdiStretchBlt, 96 ) \
-    SYSCALL_ENTRY( 0x10be, NtGdiStretchDIBitsInternal, 128 ) \
-    SYSCALL_ENTRY( 0x10bf, NtGdiStrokeAndFillPath, 8 ) \
-    SYSCALL_ENTRY( 0x10c0, NtGdiStrokePath, 8 ) \
-    SYSCALL_ENTRY( 0x10c1, NtGdiSwapBuffers, 8 ) \
-    SYSCALL_ENTRY( 0x10c2, NtGdiTransformPoints, 40 ) \
-    SYSCALL_ENTRY( 0x10c3, NtGdiTransparentBlt, 88 ) \
-    SYSCALL_ENTRY( 0x10c4, NtGdiUnrealizeObject, 8 ) \
-    SYSCALL_ENTRY( 0x10c5, NtGdiUpdateColors, 8 ) \
-    SYSCALL_ENTRY( 0x10c6, NtGdiWidenPath, 8 ) \
-    SYSCALL_ENTRY( 0x10c7, NtUserActivateKeyboardLayout, 16 ) \
-    SYSCALL_ENTRY( 0x10c8, NtUserAddClipboardFormatListener, 8 ) \
-    SYSCALL_ENTRY( 0x10c9, NtUserAlterWindowStyle, 24 ) \
-    SYSCALL_ENTRY( 0x10ca, NtUserArrangeIconicWindows, 8 ) \
-    SYSCALL_ENTRY( 0x10cb, NtUserAssociateInputContext, 24 ) \
-    SYSCALL_ENTRY( 0x10cc, NtUserAttachThreadInput, 24 ) \
-    SYSCALL_ENTRY( 0x10cd, NtUserBeginDeferWindowPos, 8 ) \
-    SYSCALL_ENTRY( 0x10ce, NtUserBeginPaint, 16 ) \
-    SYSCALL_ENTRY( 0x10cf, NtUserBuildHimcList, 32 ) \
-    SYSCALL_ENTRY( 0x10d0, NtUserBuildHwndList, 64 ) \
-    SYSCALL_ENTRY( 0x10d1, NtUserBuildNameList, 32 ) \
-    SYSCALL_ENTRY( 0x10d2, NtUserBuildPropList, 32 ) \
-    SYSCALL_ENTRY( 0x10d3, NtUserCallHwnd, 16 ) \
-    SYSCALL_ENTRY( 0x10d4, NtUserCallHwndParam, 24 ) \
-    SYSCALL_ENTRY( 0x10d5, NtUserCallMsgFilter, 16 ) \
-    SYSCALL_ENTRY( 0x10d6, NtUserCallNextHookEx, 32 ) \
-    SYSCALL_ENTRY( 0x10d7, NtUserCallNoParam, 8 ) \
-    SYSCALL_ENTRY( 0x10d8, NtUserCallOneParam, 16 ) \
-    SYSCALL_ENTRY( 0x10d9, NtUserCallTwoParam, 24 ) \
-    SYSCALL_ENTRY( 0x10da, NtUserChangeClipboardChain, 16 ) \
-    SYSCALL_ENTRY( 0x10db, NtUserChangeDisplaySettings, 40 ) \
-    SYSCALL_ENTRY( 0x10dc, NtUserCheckMenuItem, 24 ) \
-    SYSCALL_ENTRY( 0x10dd, NtUserChildWindowFromPointEx, 32 ) \
-    SYSCALL_ENTRY( 0x10de, NtUserClipCursor, 8 ) \
-    SYSCALL_ENTRY( 0x10df, NtUserCloseClipboard, 0 ) \
-    SYSCALL_ENTRY( 0x10e0, NtUserCloseDesktop, 8 ) \
-    SYSCALL_ENTRY( 0x10e1, NtUserCloseWindowStation, 8 ) \
-    SYSCALL_ENTRY( 0x10e2, NtUserCopyAcceleratorTable, 24 ) \
-    SYSCALL_ENTRY( 0x10e3, NtUserCountClipboardFormats, 0 ) \
-    SYSCALL_ENTRY( 0x10e4, NtUserCreateAcceleratorTable, 16 ) \
-    SYSCALL_ENTRY( 0x10e5, NtUserCreateCaret, 32 ) \
-    SYSCALL_ENTRY( 0x10e6, NtUserCreateDesktopEx, 48 ) \
-    SYSCALL_ENTRY( 0x10e7, NtUserCreateInputContext, 8 ) \
-    SYSCALL_ENTRY( 0x10e8, NtUserCreateMenu, 0 ) \
-    SYSCALL_ENTRY( 0x10e9, NtUserCreatePopupMenu, 0 ) \
-    SYSCALL_ENTRY( 0x10ea, NtUserCreateWindowEx, 136 ) \
-    SYSCALL_ENTRY( 0x10eb, NtUserCreateWindowStation, 56 ) \
-    SYSCALL_ENTRY( 0x10ec, NtUserDeferWindowPosAndBand, 80 ) \
-    SYSCALL_ENTRY( 0x10ed, NtUserDeleteMenu, 24 ) \
-    SYSCALL_ENTRY( 0x10ee, NtUserDestroyAcceleratorTable, 8 ) \
-    SYSCALL_ENTRY( 0x10ef, NtUserDestroyCaret, 0 ) \
-    SYSCALL_ENTRY( 0x10f0, NtUserDestroyCursor, 16 ) \
-    SYSCALL_ENTRY( 0x10f1, NtUserDestroyInputContext, 8 ) \
-    SYSCALL_ENTRY( 0x10f2, NtUserDestroyMenu, 8 ) \
-    SYSCALL_ENTRY( 0x10f3, NtUserDestroyWindow, 8 ) \
-    SYSCALL_ENTRY( 0x10f4, NtUserDisableThreadIme, 8 ) \
-    SYSCALL_ENTRY( 0x10f5, NtUserDispatchMessage, 8 ) \
-    SYSCALL_ENTRY( 0x10f6, NtUserDisplayConfigGetDeviceInfo, 8 ) \
-    SYSCALL_ENTRY( 0x10f7, NtUserDragDetect, 24 ) \
-    SYSCALL_ENTRY( 0x10f8, NtUserDragObject, 40 ) \
-    SYSCALL_ENTRY( 0x10f9, NtUserDrawCaptionTemp, 56 ) \
-    SYSCALL_ENTRY( 0x10fa, NtUserDrawIconEx, 72 ) \
-    SYSCALL_ENTRY( 0x10fb, NtUserDrawMenuBar, 8 ) \
-    SYSCALL_ENTRY( 0x10fc, NtUserDrawMenuBarTemp, 40 ) \
-    SYSCALL_ENTRY( 0x10fd, NtUserEmptyClipboard, 0 ) \
-    SYSCALL_ENTRY( 0x10fe, NtUserEnableMenuItem, 24 ) \
-    SYSCALL_ENTRY( 0x10ff, NtUserEnableMouseInPointer, 8 ) \
-    SYSCALL_ENTRY( 0x1100, NtUserEnableMouseInPointerForThread, 0 ) \
-    SYSCALL_ENTRY( 0x1101, NtUserEnableScrollBar, 24 ) \
-    SYSCALL_ENTRY( 0x1102, NtUserEnableWindow, 16 ) \
-    SYSCALL_ENTRY( 0x1103, NtUserEndDeferWindowPosEx, 16 ) \
-    SYSCALL_ENTRY( 0x1104, NtUserEndMenu, 0 ) \
-    SYSCALL_ENTRY( 0x1105, NtUserEndPaint, 16 ) \
-    SYSCALL_ENTRY( 0x1106, NtUserEnumClipboardFormats, 8 ) \
-    SYSCALL_ENTRY( 0x1107, NtUserEnumDisplayDevices, 32 ) \
-    SYSCALL_ENTRY( 0x1108, NtUserEnumDisplayMonitors, 32 ) \
-    SYSCALL_ENTRY( 0x1109, NtUserEnumDisplaySettings, 32 ) \
-    SYSCALL_ENTRY( 0x110a, NtUserExcludeUpdateRgn, 16 ) \
-    SYSCALL_ENTRY( 0x110b, NtUserFindExistingCursorIcon, 24 ) \
-    SYSCALL_ENTRY( 0x110c, NtUserFindWindowEx, 40 ) \
-    SYSCALL_ENTRY( 0x110d, NtUserFlashWindowEx, 8 ) \
-    SYSCALL_ENTRY( 0x110e, NtUserGetAncestor, 16 ) \
-    SYSCALL_ENTRY( 0x110f, NtUserGetAsyncKeyState, 8 ) \
-    SYSCALL_ENTRY( 0x1110, NtUserGetAtomName, 16 ) \
-    SYSCALL_ENTRY( 0x1111, NtUserGetCaretBlinkTime, 0 ) \
-    SYSCALL_ENTRY( 0x1112, NtUserGetCaretPos, 8 ) \
-    SYSCALL_ENTRY( 0x1113, NtUserGetClassInfoEx, 40 ) \
-    SYSCALL_ENTRY( 0x1114, NtUserGetClassName, 24 ) \
-    SYSCALL_ENTRY( 0x1115, NtUserGetClipCursor, 8 ) \
-    SYSCALL_ENTRY( 0x1116, NtUserGetClipboardData, 16 ) \
-    SYSCALL_ENTRY( 0x1117, NtUserGetClipboardFormatName, 24 ) \
-    SYSCALL_ENTRY( 0x1118, NtUserGetClipboardOwner, 0 ) \
-    SYSCALL_ENTRY( 0x1119, NtUserGetClipboardSequenceNumber, 0 ) \
-    SYSCALL_ENTRY( 0x111a, NtUserGetClipboardViewer, 0 ) \
-    SYSCALL_ENTRY( 0x111b, NtUserGetCurrentInputMessageSource, 8 ) \
-    SYSCALL_ENTRY( 0x111c, NtUserGetCursor, 0 ) \
-    SYSCALL_ENTRY( 0x111d, NtUserGetCursorFrameInfo, 32 ) \
-    SYSCALL_ENTRY( 0x111e, NtUserGetCursorInfo, 8 ) \
-    SYSCALL_ENTRY( 0x111f, NtUserGetDC, 8 ) \
-    SYSCALL_ENTRY( 0x1120, NtUserGetDCEx, 24 ) \
-    SYSCALL_ENTRY( 0x1121, NtUserGetDisplayConfigBufferSizes, 24 ) \
-    SYSCALL_ENTRY( 0x1122, NtUserGetDoubleClickTime, 0 ) \
-    SYSCALL_ENTRY( 0x1123, NtUserGetDpiForMonitor, 32 ) \
-    SYSCALL_ENTRY( 0x1124, NtUserGetForegroundWindow, 0 ) \
-    SYSCALL_ENTRY( 0x1125, NtUserGetGUIThreadInfo, 16 ) \
-    SYSCALL_ENTRY( 0x1126, NtUserGetIconInfo, 48 ) \
-    SYSCALL_ENTRY( 0x1127, NtUserGetIconSize, 32 ) \
-    SYSCALL_ENTRY( 0x1128, NtUserGetInternalWindowPos, 24 ) \
-    SYSCALL_ENTRY( 0x1129, NtUserGetKeyNameText, 24 ) \
-    SYSCALL_ENTRY( 0x112a, NtUserGetKeyState, 8 ) \
-    SYSCALL_ENTRY( 0x112b, NtUserGetKeyboardLayout, 8 ) \
-    SYSCALL_ENTRY( 0x112c, NtUserGetKeyboardLayoutList, 16 ) \
-    SYSCALL_ENTRY( 0x112d, NtUserGetKeyboardLayoutName, 8 ) \
-    SYSCALL_ENTRY( 0x112e, NtUserGetKeyboardState, 8 ) \
-    SYSCALL_ENTRY( 0x112f, NtUserGetLayeredWindowAttributes, 32 ) \
-    SYSCALL_ENTRY( 0x1130, NtUserGetMenuBarInfo, 32 ) \
-    SYSCALL_ENTRY( 0x1131, NtUserGetMenuItemRect, 32 ) \
-    SYSCALL_ENTRY( 0x1132, NtUserGetMessage, 32 ) \
-    SYSCALL_ENTRY( 0x1133, NtUserGetMouseMovePointsEx, 40 ) \
-    SYSCALL_ENTRY( 0x1134, NtUserGetObjectInformation, 40 ) \
-    SYSCALL_ENTRY( 0x1135, NtUserGetOpenClipboardWindow, 0 ) \
-    SYSCALL_ENTRY( 0x1136, NtUserGetPointerInfoList, 64 ) \
-    SYSCALL_ENTRY( 0x1137, NtUserGetPriorityClipboardFormat, 16 ) \
-    SYSCALL_ENTRY( 0x1138, NtUserGetProcessDefaultLayout, 8 ) \
-    SYSCALL_ENTRY( 0x1139, NtUserGetProcessDpiAwarenessContext, 8 ) \
-    SYSCALL_ENTRY( 0x113a, NtUserGetProcessWindowStation, 0 ) \
-    SYSCALL_ENTRY( 0x113b, NtUserGetProp, 16 ) \
-    SYSCALL_ENTRY( 0x113c, NtUserGetQueueStatus, 8 ) \
-    SYSCALL_ENTRY( 0x113d, NtUserGetRawInputBuffer, 24 ) \
-    SYSCALL_ENTRY( 0x113e, NtUserGetRawInputData, 40 ) \
-    SYSCALL_ENTRY( 0x113f, NtUserGetRawInputDeviceInfo, 32 ) \
-    SYSCALL_ENTRY( 0x1140, NtUserGetRawInputDeviceList, 24 ) \
-    SYSCALL_ENTRY( 0x1141, NtUserGetRegisteredRawInputDevices, 24 ) \
-    SYSCALL_ENTRY( 0x1142, NtUserGetScrollBarInfo, 24 ) \
-    SYSCALL_ENTRY( 0x1143, NtUserGetSystemDpiForProcess, 8 ) \
-    SYSCALL_ENTRY( 0x1144, NtUserGetSystemMenu, 16 ) \
-    SYSCALL_ENTRY( 0x1145, NtUserGetThreadDesktop, 8 ) \
-    SYSCALL_ENTRY( 0x1146, NtUserGetThreadState, 8 ) \
-    SYSCALL_ENTRY( 0x1147, NtUserGetTitleBarInfo, 16 ) \
-    SYSCALL_ENTRY( 0x1148, NtUserGetUpdateRect, 24 ) \
-    SYSCALL_ENTRY( 0x1149, NtUserGetUpdateRgn, 24 ) \
-    SYSCALL_ENTRY( 0x114a, NtUserGetUpdatedClipboardFormats, 24 ) \
-    SYSCALL_ENTRY( 0x114b, NtUserGetWindowContextHelpId, 8 ) \
-    SYSCALL_ENTRY( 0x114c, NtUserGetWindowDC, 8 ) \
-    SYSCALL_ENTRY( 0x114d, NtUserGetWindowPlacement, 16 ) \
-    SYSCALL_ENTRY( 0x114e, NtUserGetWindowRgnEx, 24 ) \
-    SYSCALL_ENTRY( 0x114f, NtUserHideCaret, 8 ) \
-    SYSCALL_ENTRY( 0x1150, NtUserHiliteMenuItem, 32 ) \
-    SYSCALL_ENTRY( 0x1151, NtUserInitializeClientPfnArrays, 32 ) \
-    SYSCALL_ENTRY( 0x1152, NtUserInternalGetWindowIcon, 16 ) \
-    SYSCALL_ENTRY( 0x1153, NtUserInternalGetWindowText, 24 ) \
-    SYSCALL_ENTRY( 0x1154, NtUserInvalidateRect, 24 ) \
-    SYSCALL_ENTRY( 0x1155, NtUserInvalidateRgn, 24 ) \
-    SYSCALL_ENTRY( 0x1156, NtUserIsChildWindowDpiMessageEnabled, 8 ) \
-    SYSCALL_ENTRY( 0x1157, NtUserIsClipboardFormatAvailable, 8 ) \
-    SYSCALL_ENTRY( 0x1158, NtUserIsMouseInPointerEnabled, 0 ) \
-    SYSCALL_ENTRY( 0x1159, NtUserKillSystemTimer, 16 ) \
-    SYSCALL_ENTRY( 0x115a, NtUserKillTimer, 16 ) \
-    SYSCALL_ENTRY( 0x115b, NtUserLockWindowUpdate, 8 ) \
-    SYSCALL_ENTRY( 0x115c, NtUserLogicalToPerMonitorDPIPhysicalPoint, 16 ) \
-    SYSCALL_ENTRY( 0x115d, NtUserMapVirtualKeyEx, 24 ) \
-    SYSCALL_ENTRY( 0x115e, NtUserMenuItemFromPoint, 32 ) \
-    SYSCALL_ENTRY( 0x115f, NtUserMessageBeep, 8 ) \
-    SYSCALL_ENTRY( 0x1160, NtUserMessageCall, 56 ) \
-    SYSCALL_ENTRY( 0x1161, NtUserMoveWindow, 48 ) \
-    SYSCALL_ENTRY( 0x1162, NtUserMsgWaitForMultipleObjectsEx, 40 ) \
-    SYSCALL_ENTRY( 0x1163, NtUserNotifyIMEStatus, 16 ) \
-    SYSCALL_ENTRY( 0x1164, NtUserNotifyWinEvent, 32 ) \
-    SYSCALL_ENTRY( 0x1165, NtUserOpenClipboard, 16 ) \
-    SYSCALL_ENTRY( 0x1166, NtUserOpenDesktop, 24 ) \
-    SYSCALL_ENTRY( 0x1167, NtUserOpenInputDesktop, 24 ) \
-    SYSCALL_ENTRY( 0x1168, NtUserOpenWindowStation, 16 ) \
-    SYSCALL_ENTRY( 0x1169, NtUserPeekMessage, 40 ) \
-    SYSCALL_ENTRY( 0x116a, NtUserPerMonitorDPIPhysicalToLogicalPoint, 16 ) \
-    SYSCALL_ENTRY( 0x116b, NtUserPostMessage, 32 ) \
-    SYSCALL_ENTRY( 0x116c, NtUserPostQuitMessage, 8 ) \
-    SYSCALL_ENTRY( 0x116d, NtUserPostThreadMessage, 32 ) \
-    SYSCALL_ENTRY( 0x116e, NtUserPrintWindow, 24 ) \
-    SYSCALL_ENTRY( 0x116f, NtUserQueryDisplayConfig, 48 ) \
-    SYSCALL_ENTRY( 0x1170, NtUserQueryInputContext, 16 ) \
-    SYSCALL_ENTRY( 0x1171, NtUserQueryWindow, 16 ) \
-    SYSCALL_ENTRY( 0x1172, NtUserRealChildWindowFromPoint, 24 ) \
-    SYSCALL_ENTRY( 0x1173, NtUserRealizePalette, 8 ) \
-    SYSCALL_ENTRY( 0x1174, NtUserRedrawWindow, 32 ) \
-    SYSCALL_ENTRY( 0x1175, NtUserRegisterClassExWOW, 56 ) \
-    SYSCALL_ENTRY( 0x1176, NtUserRegisterHotKey, 32 ) \
-    SYSCALL_ENTRY( 0x1177, NtUserRegisterRawInputDevices, 24 ) \
-    SYSCALL_ENTRY( 0x1178, NtUserRegisterTouchPadCapable, 8 ) \
-    SYSCALL_ENTRY( 0x1179, NtUserRegisterWindowMessage, 8 ) \
-    SYSCALL_ENTRY( 0x117a, NtUserReleaseCapture, 0 ) \
-    SYSCALL_ENTRY( 0x117b, NtUserReleaseDC, 16 ) \
-    SYSCALL_ENTRY( 0x117c, NtUserRemoveClipboardFormatListener, 8 ) \
-    SYSCALL_ENTRY( 0x117d, NtUserRemoveMenu, 24 ) \
-    SYSCALL_ENTRY( 0x117e, NtUserRemoveProp, 16 ) \
-    SYSCALL_ENTRY( 0x117f, NtUserReplyMessage, 8 ) \
-    SYSCALL_ENTRY( 0x1180, NtUserScrollDC, 56 ) \
-    SYSCALL_ENTRY( 0x1181, NtUserScrollWindowEx, 64 ) \
-    SYSCALL_ENTRY( 0x1182, NtUserSelectPalette, 24 ) \
-    SYSCALL_ENTRY( 0x1183, NtUserSendInput, 24 ) \
-    SYSCALL_ENTRY( 0x1184, NtUserSetActiveWindow, 8 ) \
-    SYSCALL_ENTRY( 0x1185, NtUserSetAdditionalForegroundBoostProcesses, 24 ) \
-    SYSCALL_ENTRY( 0x1186, NtUserSetCapture, 8 ) \
-    SYSCALL_ENTRY( 0x1187, NtUserSetCaretBlinkTime, 8 ) \
-    SYSCALL_ENTRY( 0x1188, NtUserSetCaretPos, 16 ) \
-    SYSCALL_ENTRY( 0x1189, NtUserSetClassLong, 32 ) \
-    SYSCALL_ENTRY( 0x118a, NtUserSetClassLongPtr, 32 ) \
-    SYSCALL_ENTRY( 0x118b, NtUserSetClassWord, 24 ) \
-    SYSCALL_ENTRY( 0x118c, NtUserSetClipboardData, 24 ) \
-    SYSCALL_ENTRY( 0x118d, NtUserSetClipboardViewer, 8 ) \
-    SYSCALL_ENTRY( 0x118e, NtUserSetCursor, 8 ) \
-    SYSCALL_ENTRY( 0x118f, NtUserSetCursorIconData, 32 ) \
-    SYSCALL_ENTRY( 0x1190, NtUserSetCursorPos, 16 ) \
-    SYSCALL_ENTRY( 0x1191, NtUserSetFocus, 8 ) \
-    SYSCALL_ENTRY( 0x1192, NtUserSetForegroundWindow, 8 ) \
-    SYSCALL_ENTRY( 0x1193, NtUserSetInternalWindowPos, 32 ) \
-    SYSCALL_ENTRY( 0x1194, NtUserSetKeyboardState, 8 ) \
-    SYSCALL_ENTRY( 0x1195, NtUserSetLayeredWindowAttributes, 32 ) \
-    SYSCALL_ENTRY( 0x1196, NtUserSetMenu, 16 ) \
-    SYSCALL_ENTRY( 0x1197, NtUserSetMenuContextHelpId, 16 ) \
-    SYSCALL_ENTRY( 0x1198, NtUserSetMenuDefaultItem, 24 ) \
-    SYSCALL_ENTRY( 0x1199, NtUserSetObjectInformation, 32 ) \
-    SYSCALL_ENTRY( 0x119a, NtUserSetParent, 16 ) \
-    SYSCALL_ENTRY( 0x119b, NtUserSetProcessDefaultLayout, 8 ) \
-    SYSCALL_ENTRY( 0x119c, NtUserSetProcessDpiAwarenessContext, 16 ) \
-    SYSCALL_ENTRY( 0x119d, NtUserSetProcessWindowStation, 8 ) \
-    SYSCALL_ENTRY( 0x119e, NtUserSetProgmanWindow, 8 ) \
-    SYSCALL_ENTRY( 0x119f, NtUserSetProp, 24 ) \
-    SYSCALL_ENTRY( 0x11a0, NtUserSetScrollInfo, 32 ) \
-    SYSCALL_ENTRY( 0x11a1, NtUserSetShellWindowEx, 16 ) \
-    SYSCALL_ENTRY( 0x11a2, NtUserSetSysColors, 24 ) \
-    SYSCALL_ENTRY( 0x11a3, NtUserSetSystemMenu, 16 ) \
-    SYSCALL_ENTRY( 0x11a4, NtUserSetSystemTimer, 24 ) \
-    SYSCALL_ENTRY( 0x11a5, NtUserSetTaskmanWindow, 8 ) \
-    SYSCALL_ENTRY( 0x11a6, NtUserSetThreadDesktop, 8 ) \
-    SYSCALL_ENTRY( 0x11a7, NtUserSetTimer, 40 ) \
-    SYSCALL_ENTRY( 0x11a8, NtUserSetWinEventHook, 64 ) \
-    SYSCALL_ENTRY( 0x11a9, NtUserSetWindowContextHelpId, 16 ) \
-    SYSCALL_ENTRY( 0x11aa, NtUserSetWindowLong, 32 ) \
-    SYSCALL_ENTRY( 0x11ab, NtUserSetWindowLongPtr, 32 ) \
-    SYSCALL_ENTRY( 0x11ac, NtUserSetWindowPlacement, 16 ) \
-    SYSCALL_ENTRY( 0x11ad, NtUserSetWindowPos, 56 ) \
-    SYSCALL_ENTRY( 0x11ae, NtUserSetWindowRgn, 24 ) \
-    SYSCALL_ENTRY( 0x11af, NtUserSetWindowWord, 24 ) \
-    SYSCALL_ENTRY( 0x11b0, NtUserSetWindowsHookEx, 48 ) \
-    SYSCALL_ENTRY( 0x11b1, NtUserShowCaret, 8 ) \
-    SYSCALL_ENTRY( 0x11b2, NtUserShowCursor, 8 ) \
-    SYSCALL_ENTRY( 0x11b3, NtUserShowOwnedPopups, 16 ) \
-    SYSCALL_ENTRY( 0x11b4, NtUserShowScrollBar, 24 ) \
-    SYSCALL_ENTRY( 0x11b5, NtUserShowWindow, 16 ) \
-    SYSCALL_ENTRY( 0x11b6, NtUserShowWindowAsync, 16 ) \
-    SYSCALL_ENTRY( 0x11b7, NtUserSwitchDesktop, 8 ) \
-    SYSCALL_ENTRY( 0x11b8, NtUserSystemParametersInfo, 32 ) \
-    SYSCALL_ENTRY( 0x11b9, NtUserSystemParametersInfoForDpi, 40 ) \
-    SYSCALL_ENTRY( 0x11ba, NtUserThunkedMenuInfo, 16 ) \
-    SYSCALL_ENTRY( 0x11bb, NtUserThunkedMenuItemInfo, 48 ) \
-    SYSCALL_ENTRY( 0x11bc, NtUserToUnicodeEx, 56 ) \
-    SYSCALL_ENTRY( 0x11bd, NtUserTrackMouseEvent, 8 ) \
-    SYSCALL_ENTRY( 0x11be, NtUserTrackPopupMenuEx, 48 ) \
-    SYSCALL_ENTRY( 0x11bf, NtUserTranslateAccelerator, 24 ) \
-    SYSCALL_ENTRY( 0x11c0, NtUserTranslateMessage, 16 ) \
-    SYSCALL_ENTRY( 0x11c1, NtUserUnhookWinEvent, 8 ) \
-    SYSCALL_ENTRY( 0x11c2, NtUserUnhookWindowsHook, 16 ) \
-    SYSCALL_ENTRY( 0x11c3, NtUserUnhookWindowsHookEx, 8 ) \
-    SYSCALL_ENTRY( 0x11c4, NtUserUnregisterClass, 24 ) \
-    SYSCALL_ENTRY( 0x11c5, NtUserUnregisterHotKey, 16 ) \
-    SYSCALL_ENTRY( 0x11c6, NtUserUpdateInputContext, 24 ) \
-    SYSCALL_ENTRY( 0x11c7, NtUserUpdateLayeredWindow, 80 ) \
-    SYSCALL_ENTRY( 0x11c8, NtUserValidateRect, 16 ) \
-    SYSCALL_ENTRY( 0x11c9, NtUserValidateRgn, 16 ) \
-    SYSCALL_ENTRY( 0x11ca, NtUserVkKeyScanEx, 16 ) \
-    SYSCALL_ENTRY( 0x11cb, NtUserWaitForInputIdle, 24 ) \
-    SYSCALL_ENTRY( 0x11cc, NtUserWaitMessage, 0 ) \
-    SYSCALL_ENTRY( 0x11cd, NtUserWindowFromDC, 8 ) \
-    SYSCALL_ENTRY( 0x11ce, NtUserWindowFromPoint, 16 ) \
-    SYSCALL_ENTRY( 0x11cf, __wine_get_icm_profile, 32 )
+    SYSCALL_ENTRY( 0x1097, NtGdiPolyPatBlt, 40 ) \
+    SYSCALL_ENTRY( 0x1098, NtGdiPolyPolyDraw, 40 ) \
+    SYSCALL_ENTRY( 0x1099, NtGdiPtInRegion, 24 ) \
+    SYSCALL_ENTRY( 0x109a, NtGdiPtVisible, 24 ) \
+    SYSCALL_ENTRY( 0x109b, NtGdiRectInRegion, 16 ) \
+    SYSCALL_ENTRY( 0x109c, NtGdiRectVisible, 16 ) \
+    SYSCALL_ENTRY( 0x109d, NtGdiRectangle, 40 ) \
+    SYSCALL_ENTRY( 0x109e, NtGdiRemoveFontMemResourceEx, 8 ) \
+    SYSCALL_ENTRY( 0x109f, NtGdiRemoveFontResourceW, 48 ) \
+    SYSCALL_ENTRY( 0x10a0, NtGdiResetDC, 40 ) \
+    SYSCALL_ENTRY( 0x10a1, NtGdiResizePalette, 16 ) \
+    SYSCALL_ENTRY( 0x10a2, NtGdiRestoreDC, 16 ) \
+    SYSCALL_ENTRY( 0x10a3, NtGdiRoundRect, 56 ) \
+    SYSCALL_ENTRY( 0x10a4, NtGdiSaveDC, 8 ) \
+    SYSCALL_ENTRY( 0x10a5, NtGdiScaleViewportExtEx, 48 ) \
+    SYSCALL_ENTRY( 0x10a6, NtGdiScaleWindowExtEx, 48 ) \
+    SYSCALL_ENTRY( 0x10a7, NtGdiSelectBitmap, 16 ) \
+    SYSCALL_ENTRY( 0x10a8, NtGdiSelectBrush, 16 ) \
+    SYSCALL_ENTRY( 0x10a9, NtGdiSelectClipPath, 16 ) \
+    SYSCALL_ENTRY( 0x10aa, NtGdiSelectFont, 16 ) \
+    SYSCALL_ENTRY( 0x10ab, NtGdiSelectPen, 16 ) \
+    SYSCALL_ENTRY( 0x10ac, NtGdiSetBitmapBits, 24 ) \
+    SYSCALL_ENTRY( 0x10ad, NtGdiSetBitmapDimension, 32 ) \
+    SYSCALL_ENTRY( 0x10ae, NtGdiSetBoundsRect, 24 ) \
+    SYSCALL_ENTRY( 0x10af, NtGdiSetBrushOrg, 32 ) \
+    SYSCALL_ENTRY( 0x10b0, NtGdiSetColorAdjustment, 16 ) \
+    SYSCALL_ENTRY( 0x10b1, NtGdiSetDIBitsToDeviceInternal, 128 ) \
+    SYSCALL_ENTRY( 0x10b2, NtGdiSetDeviceGammaRamp, 16 ) \
+    SYSCALL_ENTRY( 0x10b3, NtGdiSetLayout, 24 ) \
+    SYSCALL_ENTRY( 0x10b4, NtGdiSetMagicColors, 24 ) \
+    SYSCALL_ENTRY( 0x10b5, NtGdiSetMetaRgn, 8 ) \
+    SYSCALL_ENTRY( 0x10b6, NtGdiSetPixel, 32 ) \
+    SYSCALL_ENTRY( 0x10b7, NtGdiSetPixelFormat, 16 ) \
+    SYSCALL_ENTRY( 0x10b8, NtGdiSetRectRgn, 40 ) \
+    SYSCALL_ENTRY( 0x10b9, NtGdiSetSystemPaletteUse, 16 ) \
+    SYSCALL_ENTRY( 0x10ba, NtGdiSetTextJustification, 24 ) \
+    SYSCALL_ENTRY( 0x10bb, NtGdiSetVirtualResolution, 40 ) \
+    SYSCALL_ENTRY( 0x10bc, NtGdiStartDoc, 32 ) \
+    SYSCALL_ENTRY( 0x10bd, NtGdiStartPage, 8 ) \
+    SYSCALL_ENTRY( 0x10be, NtGdiStretchBlt, 96 ) \
+    SYSCALL_ENTRY( 0x10bf, NtGdiStretchDIBitsInternal, 128 ) \
+    SYSCALL_ENTRY( 0x10c0, NtGdiStrokeAndFillPath, 8 ) \
+    SYSCALL_ENTRY( 0x10c1, NtGdiStrokePath, 8 ) \
+    SYSCALL_ENTRY( 0x10c2, NtGdiSwapBuffers, 8 ) \
+    SYSCALL_ENTRY( 0x10c3, NtGdiTransformPoints, 40 ) \
+    SYSCALL_ENTRY( 0x10c4, NtGdiTransparentBlt, 88 ) \
+    SYSCALL_ENTRY( 0x10c5, NtGdiUnrealizeObject, 8 ) \
+    SYSCALL_ENTRY( 0x10c6, NtGdiUpdateColors, 8 ) \
+    SYSCALL_ENTRY( 0x10c7, NtGdiWidenPath, 8 ) \
+    SYSCALL_ENTRY( 0x10c8, NtUserActivateKeyboardLayout, 16 ) \
+    SYSCALL_ENTRY( 0x10c9, NtUserAddClipboardFormatListener, 8 ) \
+    SYSCALL_ENTRY( 0x10ca, NtUserAlterWindowStyle, 24 ) \
+    SYSCALL_ENTRY( 0x10cb, NtUserArrangeIconicWindows, 8 ) \
+    SYSCALL_ENTRY( 0x10cc, NtUserAssociateInputContext, 24 ) \
+    SYSCALL_ENTRY( 0x10cd, NtUserAttachThreadInput, 24 ) \
+    SYSCALL_ENTRY( 0x10ce, NtUserBeginDeferWindowPos, 8 ) \
+    SYSCALL_ENTRY( 0x10cf, NtUserBeginPaint, 16 ) \
+    SYSCALL_ENTRY( 0x10d0, NtUserBuildHimcList, 32 ) \
+    SYSCALL_ENTRY( 0x10d1, NtUserBuildHwndList, 64 ) \
+    SYSCALL_ENTRY( 0x10d2, NtUserBuildNameList, 32 ) \
+    SYSCALL_ENTRY( 0x10d3, NtUserBuildPropList, 32 ) \
+    SYSCALL_ENTRY( 0x10d4, NtUserCallHwnd, 16 ) \
+    SYSCALL_ENTRY( 0x10d5, NtUserCallHwndParam, 24 ) \
+    SYSCALL_ENTRY( 0x10d6, NtUserCallMsgFilter, 16 ) \
+    SYSCALL_ENTRY( 0x10d7, NtUserCallNextHookEx, 32 ) \
+    SYSCALL_ENTRY( 0x10d8, NtUserCallNoParam, 8 ) \
+    SYSCALL_ENTRY( 0x10d9, NtUserCallOneParam, 16 ) \
+    SYSCALL_ENTRY( 0x10da, NtUserCallTwoParam, 24 ) \
+    SYSCALL_ENTRY( 0x10db, NtUserChangeClipboardChain, 16 ) \
+    SYSCALL_ENTRY( 0x10dc, NtUserChangeDisplaySettings, 40 ) \
+    SYSCALL_ENTRY( 0x10dd, NtUserCheckMenuItem, 24 ) \
+    SYSCALL_ENTRY( 0x10de, NtUserChildWindowFromPointEx, 32 ) \
+    SYSCALL_ENTRY( 0x10df, NtUserClipCursor, 8 ) \
+    SYSCALL_ENTRY( 0x10e0, NtUserCloseClipboard, 0 ) \
+    SYSCALL_ENTRY( 0x10e1, NtUserCloseDesktop, 8 ) \
+    SYSCALL_ENTRY( 0x10e2, NtUserCloseWindowStation, 8 ) \
+    SYSCALL_ENTRY( 0x10e3, NtUserCopyAcceleratorTable, 24 ) \
+    SYSCALL_ENTRY( 0x10e4, NtUserCountClipboardFormats, 0 ) \
+    SYSCALL_ENTRY( 0x10e5, NtUserCreateAcceleratorTable, 16 ) \
+    SYSCALL_ENTRY( 0x10e6, NtUserCreateCaret, 32 ) \
+    SYSCALL_ENTRY( 0x10e7, NtUserCreateDesktopEx, 48 ) \
+    SYSCALL_ENTRY( 0x10e8, NtUserCreateInputContext, 8 ) \
+    SYSCALL_ENTRY( 0x10e9, NtUserCreateMenu, 0 ) \
+    SYSCALL_ENTRY( 0x10ea, NtUserCreatePopupMenu, 0 ) \
+    SYSCALL_ENTRY( 0x10eb, NtUserCreateWindowEx, 136 ) \
+    SYSCALL_ENTRY( 0x10ec, NtUserCreateWindowStation, 56 ) \
+    SYSCALL_ENTRY( 0x10ed, NtUserDeferWindowPosAndBand, 80 ) \
+    SYSCALL_ENTRY( 0x10ee, NtUserDeleteMenu, 24 ) \
+    SYSCALL_ENTRY( 0x10ef, NtUserDestroyAcceleratorTable, 8 ) \
+    SYSCALL_ENTRY( 0x10f0, NtUserDestroyCaret, 0 ) \
+    SYSCALL_ENTRY( 0x10f1, NtUserDestroyCursor, 16 ) \
+    SYSCALL_ENTRY( 0x10f2, NtUserDestroyInputContext, 8 ) \
+    SYSCALL_ENTRY( 0x10f3, NtUserDestroyMenu, 8 ) \
+    SYSCALL_ENTRY( 0x10f4, NtUserDestroyWindow, 8 ) \
+    SYSCALL_ENTRY( 0x10f5, NtUserDisableThreadIme, 8 ) \
+    SYSCALL_ENTRY( 0x10f6, NtUserDispatchMessage, 8 ) \
+    SYSCALL_ENTRY( 0x10f7, NtUserDisplayConfigGetDeviceInfo, 8 ) \
+    SYSCALL_ENTRY( 0x10f8, NtUserDragDetect, 24 ) \
+    SYSCALL_ENTRY( 0x10f9, NtUserDragObject, 40 ) \
+    SYSCALL_ENTRY( 0x10fa, NtUserDrawCaptionTemp, 56 ) \
+    SYSCALL_ENTRY( 0x10fb, NtUserDrawIconEx, 72 ) \
+    SYSCALL_ENTRY( 0x10fc, NtUserDrawMenuBar, 8 ) \
+    SYSCALL_ENTRY( 0x10fd, NtUserDrawMenuBarTemp, 40 ) \
+    SYSCALL_ENTRY( 0x10fe, NtUserEmptyClipboard, 0 ) \
+    SYSCALL_ENTRY( 0x10ff, NtUserEnableMenuItem, 24 ) \
+    SYSCALL_ENTRY( 0x1100, NtUserEnableMouseInPointer, 8 ) \
+    SYSCALL_ENTRY( 0x1101, NtUserEnableMouseInPointerForThread, 0 ) \
+    SYSCALL_ENTRY( 0x1102, NtUserEnableScrollBar, 24 ) \
+    SYSCALL_ENTRY( 0x1103, NtUserEnableWindow, 16 ) \
+    SYSCALL_ENTRY( 0x1104, NtUserEndDeferWindowPosEx, 16 ) \
+    SYSCALL_ENTRY( 0x1105, NtUserEndMenu, 0 ) \
+    SYSCALL_ENTRY( 0x1106, NtUserEndPaint, 16 ) \
+    SYSCALL_ENTRY( 0x1107, NtUserEnumClipboardFormats, 8 ) \
+    SYSCALL_ENTRY( 0x1108, NtUserEnumDisplayDevices, 32 ) \
+    SYSCALL_ENTRY( 0x1109, NtUserEnumDisplayMonitors, 32 ) \
+    SYSCALL_ENTRY( 0x110a, NtUserEnumDisplaySettings, 32 ) \
+    SYSCALL_ENTRY( 0x110b, NtUserExcludeUpdateRgn, 16 ) \
+    SYSCALL_ENTRY( 0x110c, NtUserFindExistingCursorIcon, 24 ) \
+    SYSCALL_ENTRY( 0x110d, NtUserFindWindowEx, 40 ) \
+    SYSCALL_ENTRY( 0x110e, NtUserFlashWindowEx, 8 ) \
+    SYSCALL_ENTRY( 0x110f, NtUserGetAncestor, 16 ) \
+    SYSCALL_ENTRY( 0x1110, NtUserGetAsyncKeyState, 8 ) \
+    SYSCALL_ENTRY( 0x1111, NtUserGetAtomName, 16 ) \
+    SYSCALL_ENTRY( 0x1112, NtUserGetCaretBlinkTime, 0 ) \
+    SYSCALL_ENTRY( 0x1113, NtUserGetCaretPos, 8 ) \
+    SYSCALL_ENTRY( 0x1114, NtUserGetClassInfoEx, 40 ) \
+    SYSCALL_ENTRY( 0x1115, NtUserGetClassName, 24 ) \
+    SYSCALL_ENTRY( 0x1116, NtUserGetClipCursor, 8 ) \
+    SYSCALL_ENTRY( 0x1117, NtUserGetClipboardData, 16 ) \
+    SYSCALL_ENTRY( 0x1118, NtUserGetClipboardFormatName, 24 ) \
+    SYSCALL_ENTRY( 0x1119, NtUserGetClipboardOwner, 0 ) \
+    SYSCALL_ENTRY( 0x111a, NtUserGetClipboardSequenceNumber, 0 ) \
+    SYSCALL_ENTRY( 0x111b, NtUserGetClipboardViewer, 0 ) \
+    SYSCALL_ENTRY( 0x111c, NtUserGetCurrentInputMessageSource, 8 ) \
+    SYSCALL_ENTRY( 0x111d, NtUserGetCursor, 0 ) \
+    SYSCALL_ENTRY( 0x111e, NtUserGetCursorFrameInfo, 32 ) \
+    SYSCALL_ENTRY( 0x111f, NtUserGetCursorInfo, 8 ) \
+    SYSCALL_ENTRY( 0x1120, NtUserGetDC, 8 ) \
+    SYSCALL_ENTRY( 0x1121, NtUserGetDCEx, 24 ) \
+    SYSCALL_ENTRY( 0x1122, NtUserGetDisplayConfigBufferSizes, 24 ) \
+    SYSCALL_ENTRY( 0x1123, NtUserGetDoubleClickTime, 0 ) \
+    SYSCALL_ENTRY( 0x1124, NtUserGetDpiForMonitor, 32 ) \
+    SYSCALL_ENTRY( 0x1125, NtUserGetForegroundWindow, 0 ) \
+    SYSCALL_ENTRY( 0x1126, NtUserGetGUIThreadInfo, 16 ) \
+    SYSCALL_ENTRY( 0x1127, NtUserGetIconInfo, 48 ) \
+    SYSCALL_ENTRY( 0x1128, NtUserGetIconSize, 32 ) \
+    SYSCALL_ENTRY( 0x1129, NtUserGetInternalWindowPos, 24 ) \
+    SYSCALL_ENTRY( 0x112a, NtUserGetKeyNameText, 24 ) \
+    SYSCALL_ENTRY( 0x112b, NtUserGetKeyState, 8 ) \
+    SYSCALL_ENTRY( 0x112c, NtUserGetKeyboardLayout, 8 ) \
+    SYSCALL_ENTRY( 0x112d, NtUserGetKeyboardLayoutList, 16 ) \
+    SYSCALL_ENTRY( 0x112e, NtUserGetKeyboardLayoutName, 8 ) \
+    SYSCALL_ENTRY( 0x112f, NtUserGetKeyboardState, 8 ) \
+    SYSCALL_ENTRY( 0x1130, NtUserGetLayeredWindowAttributes, 32 ) \
+    SYSCALL_ENTRY( 0x1131, NtUserGetMenuBarInfo, 32 ) \
+    SYSCALL_ENTRY( 0x1132, NtUserGetMenuItemRect, 32 ) \
+    SYSCALL_ENTRY( 0x1133, NtUserGetMessage, 32 ) \
+    SYSCALL_ENTRY( 0x1134, NtUserGetMouseMovePointsEx, 40 ) \
+    SYSCALL_ENTRY( 0x1135, NtUserGetObjectInformation, 40 ) \
+    SYSCALL_ENTRY( 0x1136, NtUserGetOpenClipboardWindow, 0 ) \
+    SYSCALL_ENTRY( 0x1137, NtUserGetPointerInfoList, 64 ) \
+    SYSCALL_ENTRY( 0x1138, NtUserGetPriorityClipboardFormat, 16 ) \
+    SYSCALL_ENTRY( 0x1139, NtUserGetProcessDefaultLayout, 8 ) \
+    SYSCALL_ENTRY( 0x113a, NtUserGetProcessDpiAwarenessContext, 8 ) \
+    SYSCALL_ENTRY( 0x113b, NtUserGetProcessWindowStation, 0 ) \
+    SYSCALL_ENTRY( 0x113c, NtUserGetProp, 16 ) \
+    SYSCALL_ENTRY( 0x113d, NtUserGetQueueStatus, 8 ) \
+    SYSCALL_ENTRY( 0x113e, NtUserGetRawInputBuffer, 24 ) \
+    SYSCALL_ENTRY( 0x113f, NtUserGetRawInputData, 40 ) \
+    SYSCALL_ENTRY( 0x1140, NtUserGetRawInputDeviceInfo, 32 ) \
+    SYSCALL_ENTRY( 0x1141, NtUserGetRawInputDeviceList, 24 ) \
+    SYSCALL_ENTRY( 0x1142, NtUserGetRegisteredRawInputDevices, 24 ) \
+    SYSCALL_ENTRY( 0x1143, NtUserGetScrollBarInfo, 24 ) \
+    SYSCALL_ENTRY( 0x1144, NtUserGetSystemDpiForProcess, 8 ) \
+    SYSCALL_ENTRY( 0x1145, NtUserGetSystemMenu, 16 ) \
+    SYSCALL_ENTRY( 0x1146, NtUserGetThreadDesktop, 8 ) \
+    SYSCALL_ENTRY( 0x1147, NtUserGetThreadState, 8 ) \
+    SYSCALL_ENTRY( 0x1148, NtUserGetTitleBarInfo, 16 ) \
+    SYSCALL_ENTRY( 0x1149, NtUserGetUpdateRect, 24 ) \
+    SYSCALL_ENTRY( 0x114a, NtUserGetUpdateRgn, 24 ) \
+    SYSCALL_ENTRY( 0x114b, NtUserGetUpdatedClipboardFormats, 24 ) \
+    SYSCALL_ENTRY( 0x114c, NtUserGetWindowContextHelpId, 8 ) \
+    SYSCALL_ENTRY( 0x114d, NtUserGetWindowDC, 8 ) \
+    SYSCALL_ENTRY( 0x114e, NtUserGetWindowPlacement, 16 ) \
+    SYSCALL_ENTRY( 0x114f, NtUserGetWindowRgnEx, 24 ) \
+    SYSCALL_ENTRY( 0x1150, NtUserHideCaret, 8 ) \
+    SYSCALL_ENTRY( 0x1151, NtUserHiliteMenuItem, 32 ) \
+    SYSCALL_ENTRY( 0x1152, NtUserInitializeClientPfnArrays, 32 ) \
+    SYSCALL_ENTRY( 0x1153, NtUserInternalGetWindowIcon, 16 ) \
+    SYSCALL_ENTRY( 0x1154, NtUserInternalGetWindowText, 24 ) \
+    SYSCALL_ENTRY( 0x1155, NtUserInvalidateRect, 24 ) \
+    SYSCALL_ENTRY( 0x1156, NtUserInvalidateRgn, 24 ) \
+    SYSCALL_ENTRY( 0x1157, NtUserIsChildWindowDpiMessageEnabled, 8 ) \
+    SYSCALL_ENTRY( 0x1158, NtUserIsClipboardFormatAvailable, 8 ) \
+    SYSCALL_ENTRY( 0x1159, NtUserIsMouseInPointerEnabled, 0 ) \
+    SYSCALL_ENTRY( 0x115a, NtUserKillSystemTimer, 16 ) \
+    SYSCALL_ENTRY( 0x115b, NtUserKillTimer, 16 ) \
+    SYSCALL_ENTRY( 0x115c, NtUserLockWindowUpdate, 8 ) \
+    SYSCALL_ENTRY( 0x115d, NtUserLogicalToPerMonitorDPIPhysicalPoint, 16 ) \
+    SYSCALL_ENTRY( 0x115e, NtUserMapVirtualKeyEx, 24 ) \
+    SYSCALL_ENTRY( 0x115f, NtUserMenuItemFromPoint, 32 ) \
+    SYSCALL_ENTRY( 0x1160, NtUserMessageBeep, 8 ) \
+    SYSCALL_ENTRY( 0x1161, NtUserMessageCall, 56 ) \
+    SYSCALL_ENTRY( 0x1162, NtUserMoveWindow, 48 ) \
+    SYSCALL_ENTRY( 0x1163, NtUserMsgWaitForMultipleObjectsEx, 40 ) \
+    SYSCALL_ENTRY( 0x1164, NtUserNotifyIMEStatus, 16 ) \
+    SYSCALL_ENTRY( 0x1165, NtUserNotifyWinEvent, 32 ) \
+    SYSCALL_ENTRY( 0x1166, NtUserOpenClipboard, 16 ) \
+    SYSCALL_ENTRY( 0x1167, NtUserOpenDesktop, 24 ) \
+    SYSCALL_ENTRY( 0x1168, NtUserOpenInputDesktop, 24 ) \
+    SYSCALL_ENTRY( 0x1169, NtUserOpenWindowStation, 16 ) \
+    SYSCALL_ENTRY( 0x116a, NtUserPeekMessage, 40 ) \
+    SYSCALL_ENTRY( 0x116b, NtUserPerMonitorDPIPhysicalToLogicalPoint, 16 ) \
+    SYSCALL_ENTRY( 0x116c, NtUserPostMessage, 32 ) \
+    SYSCALL_ENTRY( 0x116d, NtUserPostQuitMessage, 8 ) \
+    SYSCALL_ENTRY( 0x116e, NtUserPostThreadMessage, 32 ) \
+    SYSCALL_ENTRY( 0x116f, NtUserPrintWindow, 24 ) \
+    SYSCALL_ENTRY( 0x1170, NtUserQueryDisplayConfig, 48 ) \
+    SYSCALL_ENTRY( 0x1171, NtUserQueryInputContext, 16 ) \
+    SYSCALL_ENTRY( 0x1172, NtUserQueryWindow, 16 ) \
+    SYSCALL_ENTRY( 0x1173, NtUserRealChildWindowFromPoint, 24 ) \
+    SYSCALL_ENTRY( 0x1174, NtUserRealizePalette, 8 ) \
+    SYSCALL_ENTRY( 0x1175, NtUserRedrawWindow, 32 ) \
+    SYSCALL_ENTRY( 0x1176, NtUserRegisterClassExWOW, 56 ) \
+    SYSCALL_ENTRY( 0x1177, NtUserRegisterHotKey, 32 ) \
+    SYSCALL_ENTRY( 0x1178, NtUserRegisterRawInputDevices, 24 ) \
+    SYSCALL_ENTRY( 0x1179, NtUserRegisterTouchPadCapable, 8 ) \
+    SYSCALL_ENTRY( 0x117a, NtUserRegisterWindowMessage, 8 ) \
+    SYSCALL_ENTRY( 0x117b, NtUserReleaseCapture, 0 ) \
+    SYSCALL_ENTRY( 0x117c, NtUserReleaseDC, 16 ) \
+    SYSCALL_ENTRY( 0x117d, NtUserRemoveClipboardFormatListener, 8 ) \
+    SYSCALL_ENTRY( 0x117e, NtUserRemoveMenu, 24 ) \
+    SYSCALL_ENTRY( 0x117f, NtUserRemoveProp, 16 ) \
+    SYSCALL_ENTRY( 0x1180, NtUserReplyMessage, 8 ) \
+    SYSCALL_ENTRY( 0x1181, NtUserScrollDC, 56 ) \
+    SYSCALL_ENTRY( 0x1182, NtUserScrollWindowEx, 64 ) \
+    SYSCALL_ENTRY( 0x1183, NtUserSelectPalette, 24 ) \
+    SYSCALL_ENTRY( 0x1184, NtUserSendInput, 24 ) \
+    SYSCALL_ENTRY( 0x1185, NtUserSetActiveWindow, 8 ) \
+    SYSCALL_ENTRY( 0x1186, NtUserSetAdditionalForegroundBoostProcesses, 24 ) \
+    SYSCALL_ENTRY( 0x1187, NtUserSetCapture, 8 ) \
+    SYSCALL_ENTRY( 0x1188, NtUserSetCaretBlinkTime, 8 ) \
+    SYSCALL_ENTRY( 0x1189, NtUserSetCaretPos, 16 ) \
+    SYSCALL_ENTRY( 0x118a, NtUserSetClassLong, 32 ) \
+    SYSCALL_ENTRY( 0x118b, NtUserSetClassLongPtr, 32 ) \
+    SYSCALL_ENTRY( 0x118c, NtUserSetClassWord, 24 ) \
+    SYSCALL_ENTRY( 0x118d, NtUserSetClipboardData, 24 ) \
+    SYSCALL_ENTRY( 0x118e, NtUserSetClipboardViewer, 8 ) \
+    SYSCALL_ENTRY( 0x118f, NtUserSetCursor, 8 ) \
+    SYSCALL_ENTRY( 0x1190, NtUserSetCursorIconData, 32 ) \
+    SYSCALL_ENTRY( 0x1191, NtUserSetCursorPos, 16 ) \
+    SYSCALL_ENTRY( 0x1192, NtUserSetFocus, 8 ) \
+    SYSCALL_ENTRY( 0x1193, NtUserSetForegroundWindow, 8 ) \
+    SYSCALL_ENTRY( 0x1194, NtUserSetInternalWindowPos, 32 ) \
+    SYSCALL_ENTRY( 0x1195, NtUserSetKeyboardState, 8 ) \
+    SYSCALL_ENTRY( 0x1196, NtUserSetLayeredWindowAttributes, 32 ) \
+    SYSCALL_ENTRY( 0x1197, NtUserSetMenu, 16 ) \
+    SYSCALL_ENTRY( 0x1198, NtUserSetMenuContextHelpId, 16 ) \
+    SYSCALL_ENTRY( 0x1199, NtUserSetMenuDefaultItem, 24 ) \
+    SYSCALL_ENTRY( 0x119a, NtUserSetObjectInformation, 32 ) \
+    SYSCALL_ENTRY( 0x119b, NtUserSetParent, 16 ) \
+    SYSCALL_ENTRY( 0x119c, NtUserSetProcessDefaultLayout, 8 ) \
+    SYSCALL_ENTRY( 0x119d, NtUserSetProcessDpiAwarenessContext, 16 ) \
+    SYSCALL_ENTRY( 0x119e, NtUserSetProcessWindowStation, 8 ) \
+    SYSCALL_ENTRY( 0x119f, NtUserSetProgmanWindow, 8 ) \
+    SYSCALL_ENTRY( 0x11a0, NtUserSetProp, 24 ) \
+    SYSCALL_ENTRY( 0x11a1, NtUserSetScrollInfo, 32 ) \
+    SYSCALL_ENTRY( 0x11a2, NtUserSetShellWindowEx, 16 ) \
+    SYSCALL_ENTRY( 0x11a3, NtUserSetSysColors, 24 ) \
+    SYSCALL_ENTRY( 0x11a4, NtUserSetSystemMenu, 16 ) \
+    SYSCALL_ENTRY( 0x11a5, NtUserSetSystemTimer, 24 ) \
+    SYSCALL_ENTRY( 0x11a6, NtUserSetTaskmanWindow, 8 ) \
+    SYSCALL_ENTRY( 0x11a7, NtUserSetThreadDesktop, 8 ) \
+    SYSCALL_ENTRY( 0x11a8, NtUserSetTimer, 40 ) \
+    SYSCALL_ENTRY( 0x11a9, NtUserSetWinEventHook, 64 ) \
+    SYSCALL_ENTRY( 0x11aa, NtUserSetWindowContextHelpId, 16 ) \
+    SYSCALL_ENTRY( 0x11ab, NtUserSetWindowLong, 32 ) \
+    SYSCALL_ENTRY( 0x11ac, NtUserSetWindowLongPtr, 32 ) \
+    SYSCALL_ENTRY( 0x11ad, NtUserSetWindowPlacement, 16 ) \
+    SYSCALL_ENTRY( 0x11ae, NtUserSetWindowPos, 56 ) \
+    SYSCALL_ENTRY( 0x11af, NtUserSetWindowRgn, 24 ) \
+    SYSCALL_ENTRY( 0x11b0, NtUserSetWindowWord, 24 ) \
+    SYSCALL_ENTRY( 0x11b1, NtUserSetWindowsHookEx, 48 ) \
+    SYSCALL_ENTRY( 0x11b2, NtUserShowCaret, 8 ) \
+    SYSCALL_ENTRY( 0x11b3, NtUserShowCursor, 8 ) \
+    SYSCALL_ENTRY( 0x11b4, NtUserShowOwnedPopups, 16 ) \
+    SYSCALL_ENTRY( 0x11b5, NtUserShowScrollBar, 24 ) \
+    SYSCALL_ENTRY( 0x11b6, NtUserShowWindow, 16 ) \
+    SYSCALL_ENTRY( 0x11b7, NtUserShowWindowAsync, 16 ) \
+    SYSCALL_ENTRY( 0x11b8, NtUserSwitchDesktop, 8 ) \
+    SYSCALL_ENTRY( 0x11b9, NtUserSystemParametersInfo, 32 ) \
+    SYSCALL_ENTRY( 0x11ba, NtUserSystemParametersInfoForDpi, 40 ) \
+    SYSCALL_ENTRY( 0x11bb, NtUserThunkedMenuInfo, 16 ) \
+    SYSCALL_ENTRY( 0x11bc, NtUserThunkedMenuItemInfo, 48 ) \
+    SYSCALL_ENTRY( 0x11bd, NtUserToUnicodeEx, 56 ) \
+    SYSCALL_ENTRY( 0x11be, NtUserTrackMouseEvent, 8 ) \
+    SYSCALL_ENTRY( 0x11bf, NtUserTrackPopupMenuEx, 48 ) \
+    SYSCALL_ENTRY( 0x11c0, NtUserTranslateAccelerator, 24 ) \
+    SYSCALL_ENTRY( 0x11c1, NtUserTranslateMessage, 16 ) \
+    SYSCALL_ENTRY( 0x11c2, NtUserUnhookWinEvent, 8 ) \
+    SYSCALL_ENTRY( 0x11c3, NtUserUnhookWindowsHook, 16 ) \
+    SYSCALL_ENTRY( 0x11c4, NtUserUnhookWindowsHookEx, 8 ) \
+    SYSCALL_ENTRY( 0x11c5, NtUserUnregisterClass, 24 ) \
+    SYSCALL_ENTRY( 0x11c6, NtUserUnregisterHotKey, 16 ) \
+    SYSCALL_ENTRY( 0x11c7, NtUserUpdateInputContext, 24 ) \
+    SYSCALL_ENTRY( 0x11c8, NtUserUpdateLayeredWindow, 80 ) \
+    SYSCALL_ENTRY( 0x11c9, NtUserValidateRect, 16 ) \
+    SYSCALL_ENTRY( 0x11ca, NtUserValidateRgn, 16 ) \
+    SYSCALL_ENTRY( 0x11cb, NtUserVkKeyScanEx, 16 ) \
+    SYSCALL_ENTRY( 0x11cc, NtUserWaitForInputIdle, 24 ) \
+    SYSCALL_ENTRY( 0x11cd, NtUserWaitMessage, 0 ) \
+    SYSCALL_ENTRY( 0x11ce, NtUserWindowFromDC, 8 ) \
+    SYSCALL_ENTRY( 0x11cf, NtUserWindowFromPoint, 16 ) \
+    SYSCALL_ENTRY( 0x11d0, __wine_get_icm_profile, 32 )
 #else
 #define ALL_SYSCALLS ALL_SYSCALLS32
 #endif
@@ -591,7 +591,7 @@
 @ stdcall -syscall NtGdiPathToRegion(long)
 @ stdcall -syscall NtGdiPlgBlt(long ptr long long long long long long long long long)
 @ stdcall -syscall NtGdiPolyDraw(long ptr ptr long)
-@ stub NtGdiPolyPatBlt
+@ stdcall -syscall NtGdiPolyPatBlt(long long ptr long long)
 @ stdcall -syscall NtGdiPolyPolyDraw(long ptr ptr long long)
 @ stub NtGdiPolyTextOutW
 @ stdcall -syscall NtGdiPtInRegion(long long long)
@@ -5246,7 +5246,11 @@ static WND *create_window_handle( HWND parent, HWND owner, UNICODE_STRING *name,
         req->style           = style;
         req->ex_style        = ex_style;
         if (!(req->atom = get_int_atom_value( name )) && name->Length)
-            wine_server_add_data( req, name->Buffer, name->Length );
+        {
+            /* resolve locally registered classes to their atom client-side */
+            if (!(req->atom = get_local_class_atom( class_instance, name )))
+                wine_server_add_data( req, name->Buffer, name->Length );
+        }
         if (!wine_server_call_err( req ))
         {
             handle      = wine_server_ptr_handle( reply->handle );
@@ -656,7 +656,7 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
             const BYTE *srcrow;
             const BYTE *srcpixel;
             BYTE *dstrow;
-            BYTE *dstpixel;
+            DWORD *dstpixel;
 
             srcstride = 3 * prc->Width;
             srcdatasize = srcstride * prc->Height;
@@ -672,12 +672,10 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
                 dstrow = pbBuffer;
                 for (y=0; y<prc->Height; y++) {
                     srcpixel=srcrow;
-                    dstpixel=dstrow;
+                    dstpixel=(DWORD*)dstrow;
                     for (x=0; x<prc->Width; x++) {
-                        *dstpixel++=*srcpixel++; /* blue */
-                        *dstpixel++=*srcpixel++; /* green */
-                        *dstpixel++=*srcpixel++; /* red */
-                        *dstpixel++=255; /* alpha */
+                        *dstpixel++ = 0xff000000 | srcpixel[2] << 16 | srcpixel[1] << 8 | srcpixel[0];
+                        srcpixel += 3;
                     }
                     srcrow += srcstride;
                     dstrow += cbStride;
@@ -699,8 +697,7 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
             const BYTE *srcrow;
             const BYTE *srcpixel;
             BYTE *dstrow;
-            BYTE *dstpixel;
-            BYTE tmppixel[3];
+            DWORD *dstpixel;
 
             srcstride = 3 * prc->Width;
             srcdatasize = srcstride * prc->Height;
@@ -716,16 +713,10 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
                 dstrow = pbBuffer;
                 for (y=0; y<prc->Height; y++) {
                     srcpixel=srcrow;
-                    dstpixel=dstrow;
+                    dstpixel=(DWORD*)dstrow;
                     for (x=0; x<prc->Width; x++) {
-                        tmppixel[0]=*srcpixel++; /* red */
-                        tmppixel[1]=*srcpixel++; /* green */
-                        tmppixel[2]=*srcpixel++; /* blue */
-
-                        *dstpixel++=tmppixel[2]; /* blue */
-                        *dstpixel++=tmppixel[1]; /* green */
-                        *dstpixel++=tmppixel[0]; /* red */
-                        *dstpixel++=255; /* alpha */
+                        *dstpixel++ = 0xff000000 | srcpixel[0] << 16 | srcpixel[1] << 8 | srcpixel[2];
+                        srcpixel += 3;
                     }
                     srcrow += srcstride;
                     dstrow += cbStride;
@@ -742,14 +733,18 @@ static HRESULT copypixels_to_32bppBGRA(struct FormatConverter *This, const WICRe
         {
             HRESULT res;
             INT x, y;
+            DWORD *pixel;
 
             res = IWICBitmapSource_CopyPixels(This->source, prc, cbStride, cbBufferSize, pbBuffer);
             if (FAILED(res)) return res;
 
             /* set all alpha values to 255 */
             for (y=0; y<prc->Height; y++)
+            {
+                pixel = (DWORD*)(pbBuffer + cbStride*y);
                 for (x=0; x<prc->Width; x++)
-                    pbBuffer[cbStride*y+4*x+3] = 0xff;
+                    *pixel++ |= 0xff000000;
+            }
         }
         return S_OK;
     case format_32bppRGBA:
@@ -63,6 +63,7 @@ struct alsa_stream
     BOOL need_remapping;
     int alsa_channels;
     int alsa_channel_map[32];
+    BOOL mmap; /* access mode is SND_PCM_ACCESS_MMAP_INTERLEAVED */
 
     BOOL started, please_quit;
     REFERENCE_TIME mmdev_period_rt;
@@ -830,12 +831,19 @@ static NTSTATUS alsa_create_stream(void *args)
         goto exit;
     }
 
+    /* Prefer mmap access; periods are then copied straight into the device
+     * ring buffer instead of going through a read/write syscall. Not all
+     * devices and plugins support it, so fall back to plain read/write. */
     if((err = snd_pcm_hw_params_set_access(stream->pcm_handle, stream->hw_params,
+                SND_PCM_ACCESS_MMAP_INTERLEAVED)) >= 0)
+        stream->mmap = TRUE;
+    else if((err = snd_pcm_hw_params_set_access(stream->pcm_handle, stream->hw_params,
                 SND_PCM_ACCESS_RW_INTERLEAVED)) < 0){
         WARN("Unable to set access: %d (%s)\n", err, snd_strerror(err));
         params->result = AUDCLNT_E_ENDPOINT_CREATE_FAILED;
         goto exit;
     }
+    TRACE("Using %s access.\n", stream->mmap ? "mmap" : "read/write");
 
     format = alsa_format(params->fmt);
     if (format == SND_PCM_FORMAT_UNKNOWN){
@@ -1257,6 +1265,23 @@ static void adjust_buffer_volume(const struct alsa_stream *stream, BYTE *buf, sn
     }
 }
 
+/* These have the same semantics as snd_pcm_writei()/snd_pcm_readi()
+ * (including waiting and auto-start), but in mmap mode the samples are copied
+ * directly into (resp. out of) the mapped device ring buffer. */
+static snd_pcm_sframes_t alsa_writei(struct alsa_stream *stream, const void *buf, snd_pcm_uframes_t frames)
+{
+    if(stream->mmap)
+        return snd_pcm_mmap_writei(stream->pcm_handle, buf, frames);
+    return snd_pcm_writei(stream->pcm_handle, buf, frames);
+}
+
+static snd_pcm_sframes_t alsa_readi(struct alsa_stream *stream, void *buf, snd_pcm_uframes_t frames)
+{
+    if(stream->mmap)
+        return snd_pcm_mmap_readi(stream->pcm_handle, buf, frames);
+    return snd_pcm_readi(stream->pcm_handle, buf, frames);
+}
+
 static snd_pcm_sframes_t alsa_write_best_effort(struct alsa_stream *stream, BYTE *buf, snd_pcm_uframes_t frames)
 {
     snd_pcm_sframes_t written;
@@ -1269,7 +1294,7 @@ static snd_pcm_sframes_t alsa_write_best_effort(struct alsa_stream *stream, BYTE
 
     buf = remap_channels(stream, buf, frames);
 
-    written = snd_pcm_writei(stream->pcm_handle, buf, frames);
+    written = alsa_writei(stream, buf, frames);
     if(written < 0){
         int ret;
 
@@ -1286,7 +1311,7 @@ static snd_pcm_sframes_t alsa_write_best_effort(struct alsa_stream *stream, BYTE
             return ret;
         }
 
-        written = snd_pcm_writei(stream->pcm_handle, buf, frames);
+        written = alsa_writei(stream, buf, frames);
     }
 
     if (written > 0)
@@ -1443,7 +1468,7 @@ static void alsa_read_data(struct alsa_stream *stream)
      * How to count overrun frames and report them as position increase? */
     limit = stream->bufsize_frames - max(limit, pos);
 
-    nread = snd_pcm_readi(stream->pcm_handle,
+    nread = alsa_readi(stream,
             stream->local_buffer + pos * stream->fmt->nBlockAlign, limit);
     TRACE("read %ld from %u limit %u\n", nread, pos, limit);
     if(nread < 0){
@@ -1460,7 +1485,7 @@ static void alsa_read_data(struct alsa_stream *stream)
             return;
         }
 
-        nread = snd_pcm_readi(stream->pcm_handle,
+        nread = alsa_readi(stream,
                 stream->local_buffer + pos * stream->fmt->nBlockAlign, limit);
         if(nread < 0){
             WARN("read failed: %ld (%s)\n", nread, snd_strerror(nread));
@@ -1545,8 +1570,7 @@ static NTSTATUS alsa_start(void *args)
 
     if(stream->flow == eCapture){
         /* dump any data that might be leftover in the ALSA capture buffer */
-        snd_pcm_readi(stream->pcm_handle, stream->local_buffer,
-                stream->bufsize_frames);
+        alsa_readi(stream, stream->local_buffer, stream->bufsize_frames);
     }else{
         snd_pcm_sframes_t avail, written;
         snd_pcm_uframes_t offs;
@@ -331,15 +331,23 @@ static NTSTATUS hidraw_device_get_report_descriptor(struct unix_device *iface, B
 static void hidraw_device_read_report(struct unix_device *iface)
 {
     struct hidraw_device *impl = hidraw_impl_from_unix_device(iface);
+    struct pollfd pfd = {.fd = impl->base.device_fd, .events = POLLIN};
     BYTE report_buffer[1024], *buff = report_buffer;
+    int count = 0, size;
 
-    int size = read(impl->base.device_fd, report_buffer, sizeof(report_buffer));
-    if (size == -1)
-        TRACE("Read failed. Likely an unplugged device %d %s\n", errno, strerror(errno));
-    else if (size == 0)
-        TRACE("Failed to read report\n");
-    else
-        bus_event_queue_input_report(&event_queue, iface, buff, size);
+    /* drain reports that have queued up on the device, so that high-rate
+     * devices don't cost a poll of every device fd per report */
+    do
+    {
+        size = read(impl->base.device_fd, report_buffer, sizeof(report_buffer));
+        if (size == -1)
+            TRACE("Read failed. Likely an unplugged device %d %s\n", errno, strerror(errno));
+        else if (size == 0)
+            TRACE("Failed to read report\n");
+        else
+            bus_event_queue_input_report(&event_queue, iface, buff, size);
+    }
+    while (size > 0 && ++count < 8 && poll(&pfd, 1, 0) > 0);
 }
 
 static void hidraw_device_set_output_report(struct unix_device *iface, HID_XFER_PACKET *packet, IO_STATUS_BLOCK *io)
@@ -752,16 +760,21 @@ static void lnxev_device_read_report(struct unix_device *iface)
 {
     struct hid_device_state *state = &iface->hid_device_state;
     struct lnxev_device *impl = lnxev_impl_from_unix_device(iface);
-    struct input_event ie;
-    int size;
+    struct input_event events[64];
+    int i, size;
 
-    size = read(impl->base.device_fd, &ie, sizeof(ie));
+    /* the driver only returns complete events, read all that are ready so
+     * that a report made of several events doesn't cost a syscall each */
+    size = read(impl->base.device_fd, events, sizeof(events));
     if (size == -1)
         TRACE("Read failed. Likely an unplugged device\n");
     else if (size == 0)
         TRACE("Failed to read report\n");
-    else if (set_report_from_event(iface, &ie))
-        bus_event_queue_input_report(&event_queue, iface, state->report_buf, state->report_len);
+    else for (i = 0; i < size / (int)sizeof(*events); ++i)
+    {
+        if (set_report_from_event(iface, &events[i]))
+            bus_event_queue_input_report(&event_queue, iface, state->report_buf, state->report_len);
+    }
 }
 
 static NTSTATUS lnxev_device_haptics_start(struct unix_device *iface, UINT duration_ms,
@@ -352,6 +352,103 @@ static void get_physical_device_info(const struct wined3d_adapter_vk *adapter_vk
         VK_CALL(vkGetPhysicalDeviceFeatures(physical_device, &features2->features));
 }
 
+static BOOL adapter_vk_get_pipeline_cache_path(const struct wined3d_device_vk *device_vk, char *path, size_t size)
+{
+    const struct wined3d_driver_info *driver_info = &device_vk->d.adapter->driver_info;
+    size_t len;
+
+    if (!(len = GetEnvironmentVariableA("LOCALAPPDATA", path, size)) || len + 64 > size)
+        return FALSE;
+    strcat(path, "\\wined3d");
+    /* Failure is ignored; opening the cache file will fail as well. */
+    CreateDirectoryA(path, NULL);
+    sprintf(path + strlen(path), "\\vk_%04x_%04x.cache", driver_info->vendor, driver_info->device);
+    return TRUE;
+}
+
+/* Create the device pipeline cache, primed with the blob saved by a previous
+ * run if there is one. The blob embeds the vendor/device id and the driver's
+ * cache UUID, so the driver discards stale or foreign data for us. */
+static void adapter_vk_init_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    VkPipelineCacheCreateInfo cache_info;
+    char path[MAX_PATH];
+    DWORD size = 0, read;
+    void *data = NULL;
+    HANDLE file;
+    VkResult vr;
+
+    if (adapter_vk_get_pipeline_cache_path(device_vk, path, sizeof(path))
+            && (file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+            OPEN_EXISTING, 0, NULL)) != INVALID_HANDLE_VALUE)
+    {
+        size = GetFileSize(file, NULL);
+        if (size && size != INVALID_FILE_SIZE && (data = malloc(size))
+                && (!ReadFile(file, data, size, &read, NULL) || read != size))
+        {
+            free(data);
+            data = NULL;
+        }
+        CloseHandle(file);
+        TRACE("Loaded %lu bytes of pipeline cache data from \"%s\".\n", data ? size : 0, path);
+    }
+
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = NULL;
+    cache_info.flags = 0;
+    cache_info.initialDataSize = data ? size : 0;
+    cache_info.pInitialData = data;
+    if ((vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device, &cache_info,
+            NULL, &device_vk->vk_pipeline_cache))) < 0)
+    {
+        WARN("Failed to create pipeline cache, vr %s.\n", wined3d_debug_vkresult(vr));
+        device_vk->vk_pipeline_cache = VK_NULL_HANDLE;
+        if (data)
+        {
+            cache_info.initialDataSize = 0;
+            cache_info.pInitialData = NULL;
+            if ((vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device, &cache_info,
+                    NULL, &device_vk->vk_pipeline_cache))) < 0)
+                device_vk->vk_pipeline_cache = VK_NULL_HANDLE;
+        }
+    }
+    free(data);
+}
+
+static void adapter_vk_save_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    char path[MAX_PATH];
+    DWORD written;
+    size_t size;
+    void *data;
+    HANDLE file;
+
+    if (device_vk->vk_pipeline_cache == VK_NULL_HANDLE) return;
+    if (!adapter_vk_get_pipeline_cache_path(device_vk, path, sizeof(path))) return;
+
+    if (VK_CALL(vkGetPipelineCacheData(device_vk->vk_device,
+            device_vk->vk_pipeline_cache, &size, NULL)) < 0 || !size)
+        return;
+    if (!(data = malloc(size)))
+        return;
+    if (VK_CALL(vkGetPipelineCacheData(device_vk->vk_device,
+            device_vk->vk_pipeline_cache, &size, data)) >= 0)
+    {
+        if ((file = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                FILE_ATTRIBUTE_NORMAL, NULL)) != INVALID_HANDLE_VALUE)
+        {
+            if (!WriteFile(file, data, size, &written, NULL) || written != size)
+                WARN("Failed to write pipeline cache data to \"%s\".\n", path);
+            else
+                TRACE("Saved %Iu bytes of pipeline cache data to \"%s\".\n", size, path);
+            CloseHandle(file);
+        }
+    }
+    free(data);
+}
+
 static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wined3d_adapter *adapter,
         enum wined3d_device_type device_type, HWND focus_window, unsigned int flags, BYTE surface_alignment,
         const enum wined3d_feature_level *levels, unsigned int level_count,
@@ -460,6 +557,8 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
 
     wined3d_lock_init(&device_vk->allocator_cs, "wined3d_device_vk.allocator_cs");
 
+    adapter_vk_init_pipeline_cache(device_vk);
+
     *device = &device_vk->d;
 
     return WINED3D_OK;
@@ -480,6 +579,10 @@ static void adapter_vk_destroy_device(struct wined3d_device *device)
 
     wined3d_lock_cleanup(&device_vk->allocator_cs);
 
+    adapter_vk_save_pipeline_cache(device_vk);
+    if (device_vk->vk_pipeline_cache != VK_NULL_HANDLE)
+        VK_CALL(vkDestroyPipelineCache(device_vk->vk_device, device_vk->vk_pipeline_cache, NULL));
+
     VK_CALL(vkDestroyDevice(device_vk->vk_device, NULL));
     free(device_vk);
 }
@@ -1271,12 +1374,53 @@ static void adapter_vk_destroy_swapchain(struct wined3d_swapchain *swapchain)
     free(swapchain_vk);
 }
 
+void wined3d_adapter_vk_update_memory_budget(struct wined3d_adapter_vk *adapter_vk)
+{
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT};
+    VkPhysicalDeviceMemoryProperties2 properties2 = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2};
+    const struct wined3d_vk_info *vk_info = &adapter_vk->vk_info;
+    unsigned int i;
+
+    if (!vk_info->supported[WINED3D_VK_EXT_MEMORY_BUDGET] || !vk_info->vk_ops.vkGetPhysicalDeviceMemoryProperties2)
+        return;
+
+    properties2.pNext = &budget;
+    VK_CALL(vkGetPhysicalDeviceMemoryProperties2(adapter_vk->physical_device, &properties2));
+
+    for (i = 0; i < adapter_vk->memory_properties.memoryHeapCount; ++i)
+    {
+        adapter_vk->heap_usage[i] = budget.heapUsage[i];
+        adapter_vk->heap_budget[i] = budget.heapBudget[i];
+    }
+}
+
 unsigned int wined3d_adapter_vk_get_memory_type_index(const struct wined3d_adapter_vk *adapter_vk,
         uint32_t memory_type_mask, VkMemoryPropertyFlags flags)
 {
     const VkPhysicalDeviceMemoryProperties *memory_info = &adapter_vk->memory_properties;
     unsigned int i;
 
+    /* Prefer memory types from heaps which the driver reports as having
+     * budget left; allocating past the budget tends to cause paging stalls
+     * or allocation failure. */
+    for (i = 0; i < memory_info->memoryTypeCount; ++i)
+    {
+        unsigned int heap = memory_info->memoryTypes[i].heapIndex;
+
+        if (!(memory_type_mask & (1u << i)))
+            continue;
+        if ((memory_info->memoryTypes[i].propertyFlags & flags) != flags)
+            continue;
+        if (adapter_vk->heap_budget[heap] && adapter_vk->heap_usage[heap] >= adapter_vk->heap_budget[heap])
+        {
+            WARN("Heap %u is over budget, usage 0x%s, budget 0x%s.\n", heap,
+                    wine_dbgstr_longlong(adapter_vk->heap_usage[heap]),
+                    wine_dbgstr_longlong(adapter_vk->heap_budget[heap]));
+            continue;
+        }
+        return i;
+    }
+
     for (i = 0; i < memory_info->memoryTypeCount; ++i)
     {
         if (!(memory_type_mask & (1u << i)))
@@ -2087,6 +2231,7 @@ static BOOL wined3d_init_vulkan(struct wined3d_vk_info *vk_info)
         vk_ops->core_pfn = (void *)VK_CALL(vkGetInstanceProcAddr(instance, #ext_pfn));
     MAP_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties2, vkGetPhysicalDeviceProperties2KHR)
     MAP_INSTANCE_FUNCTION(vkGetPhysicalDeviceFeatures2, vkGetPhysicalDeviceFeatures2KHR)
+    MAP_INSTANCE_FUNCTION(vkGetPhysicalDeviceMemoryProperties2, vkGetPhysicalDeviceMemoryProperties2KHR)
 #undef MAP_INSTANCE_FUNCTION
 
     vk_info->instance = instance;
@@ -2406,6 +2551,7 @@ static bool wined3d_adapter_vk_init_device_extensions(struct wined3d_adapter_vk
         {VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,    VK_API_VERSION_1_3},
         {VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME,    ~0u},
         {VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME,            VK_API_VERSION_1_2},
+        {VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,               ~0u},
         {VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME,       ~0u},
         {VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,          ~0u},
         {VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME,    ~0u},
@@ -2433,6 +2579,7 @@ static bool wined3d_adapter_vk_init_device_extensions(struct wined3d_adapter_vk
         {VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE2},
         {VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME,     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE3},
         {VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME,             WINED3D_VK_EXT_HOST_QUERY_RESET},
+        {VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,                WINED3D_VK_EXT_MEMORY_BUDGET},
         {VK_EXT_SHADER_STENCIL_EXPORT_EXTENSION_NAME,        WINED3D_VK_EXT_SHADER_STENCIL_EXPORT},
         {VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,           WINED3D_VK_EXT_TRANSFORM_FEEDBACK},
         {VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME,     WINED3D_VK_EXT_VERTEX_ATTRIBUTE_DIVISOR},
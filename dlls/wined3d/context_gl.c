@@ -2624,6 +2624,8 @@ static void wined3d_context_gl_cleanup_resources(struct wined3d_context_gl *cont
             *r = blocks[count];
     }
     device_gl->retired_block_count = count;
+
+    wined3d_device_gl_service_chunk_request(device_gl, context_gl);
 }
 
 void wined3d_context_gl_wait_command_fence(struct wined3d_context_gl *context_gl, uint64_t id)
@@ -2641,6 +2643,7 @@ void wined3d_context_gl_wait_command_fence(struct wined3d_context_gl *context_gl
         if (context_gl->submitted.fences[i].id != id)
             continue;
 
+        InterlockedIncrement(&wined3d_perf_counters.fence_waits);
         if ((ret = wined3d_fence_wait(context_gl->submitted.fences[i].fence, &device_gl->d)) != WINED3D_FENCE_OK)
             ERR("Failed to wait for command fence with id 0x%s, ret %#x.\n", wine_dbgstr_longlong(id), ret);
         wined3d_context_gl_cleanup_resources(context_gl);
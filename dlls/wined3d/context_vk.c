@@ -1788,6 +1788,48 @@ static void wined3d_shader_descriptor_writes_vk_cleanup(struct wined3d_shader_de
     free(writes->writes);
 }
 
+struct wined3d_descriptor_set_key_vk
+{
+    size_t size;
+    const void *data;
+};
+
+struct wined3d_descriptor_set_vk
+{
+    struct wine_rb_entry entry;
+    struct wined3d_descriptor_set_key_vk key;
+    VkDescriptorSet vk_descriptor_set;
+};
+
+static int wined3d_descriptor_set_vk_compare(const void *key, const struct wine_rb_entry *entry)
+{
+    const struct wined3d_descriptor_set_key_vk *a = key;
+    const struct wined3d_descriptor_set_key_vk *b = &WINE_RB_ENTRY_VALUE(entry,
+            const struct wined3d_descriptor_set_vk, entry)->key;
+
+    if (a->size != b->size)
+        return a->size > b->size ? 1 : -1;
+    return memcmp(a->data, b->data, a->size);
+}
+
+static void wined3d_context_vk_destroy_descriptor_set(struct wine_rb_entry *entry, void *ctx)
+{
+    struct wined3d_descriptor_set_vk *set = WINE_RB_ENTRY_VALUE(entry, struct wined3d_descriptor_set_vk, entry);
+
+    /* The descriptor set itself is freed when its pool is reset. */
+    free((void *)set->key.data);
+    free(set);
+}
+
+/* Cached descriptor sets are valid for the lifetime of the command buffer
+ * they were written for; after that, their pool may be reset, and Vulkan
+ * handles they contain may be destroyed and reused. */
+static void wined3d_context_vk_clear_descriptor_set_cache(struct wined3d_context_vk *context_vk)
+{
+    wine_rb_destroy(&context_vk->descriptor_set_cache, wined3d_context_vk_destroy_descriptor_set, NULL);
+    wine_rb_init(&context_vk->descriptor_set_cache, wined3d_descriptor_set_vk_compare);
+}
+
 static void wined3d_context_vk_destroy_query_pools(struct wined3d_context_vk *context_vk, struct list *free_pools)
 {
     struct wined3d_query_pool_vk *pool_vk, *entry;
@@ -1944,6 +1986,8 @@ void wined3d_context_vk_cleanup(struct wined3d_context_vk *context_vk)
     free(context_vk->retired.objects);
 
     wined3d_shader_descriptor_writes_vk_cleanup(&context_vk->descriptor_writes);
+    wine_rb_destroy(&context_vk->descriptor_set_cache, wined3d_context_vk_destroy_descriptor_set, NULL);
+    free(context_vk->descriptor_set_key);
     wine_rb_destroy(&context_vk->graphics_pipelines, wined3d_context_vk_destroy_graphics_pipeline, context_vk);
     wine_rb_destroy(&context_vk->pipeline_layouts, wined3d_context_vk_destroy_pipeline_layout, context_vk);
     wine_rb_destroy(&context_vk->render_passes, wined3d_context_vk_destroy_render_pass, context_vk);
@@ -2114,6 +2158,8 @@ void wined3d_context_vk_submit_command_buffer(struct wined3d_context_vk *context
         LIST_FOR_EACH_ENTRY(query_vk, &context_vk->active_queries, struct wined3d_query_vk, entry)
             wined3d_query_vk_suspend(query_vk, context_vk);
 
+        wined3d_context_vk_clear_descriptor_set_cache(context_vk);
+
         context_vk->graphics.vk_pipeline = VK_NULL_HANDLE;
         context_vk->update_compute_pipeline = 1;
         context_vk->update_stream_output = 1;
@@ -2191,6 +2237,8 @@ void wined3d_context_vk_submit_command_buffer(struct wined3d_context_vk *context
     }
     context_vk->retired_bo_size = 0;
     wined3d_context_vk_cleanup_resources(context_vk, VK_NULL_HANDLE);
+
+    wined3d_adapter_vk_update_memory_budget(wined3d_adapter_vk(device_vk->d.adapter));
 }
 
 void wined3d_context_vk_wait_command_buffer(struct wined3d_context_vk *context_vk, uint64_t id)
@@ -2216,6 +2264,7 @@ void wined3d_context_vk_wait_command_buffer(struct wined3d_context_vk *context_v
             if (context_vk->submitted.buffers[i].id != id)
                 continue;
 
+            InterlockedIncrement(&wined3d_perf_counters.fence_waits);
             VK_CALL(vkWaitForFences(device_vk->vk_device, 1, &vk_fence, VK_TRUE, UINT64_MAX));
             wined3d_context_vk_remove_command_buffer(context_vk, i);
             return;
@@ -3534,6 +3583,89 @@ static bool wined3d_shader_descriptor_writes_vk_add_sampler_write(struct wined3d
     return true;
 }
 
+/* Serialise the pending descriptor writes into a cache key. Returns the key
+ * size, or 0 if the writes contain a descriptor type we don't handle. */
+static size_t wined3d_context_vk_serialise_descriptor_writes(struct wined3d_context_vk *context_vk,
+        VkDescriptorSetLayout vk_set_layout)
+{
+    const struct wined3d_shader_descriptor_writes_vk *writes = &context_vk->descriptor_writes;
+    size_t i, size;
+    uint8_t *data;
+
+    size = sizeof(vk_set_layout);
+    for (i = 0; i < writes->count; ++i)
+    {
+        const VkWriteDescriptorSet *write = &writes->writes[i];
+
+        size += sizeof(write->dstBinding) + sizeof(write->descriptorType);
+        switch (write->descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                size += sizeof(*write->pBufferInfo);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                size += sizeof(write->pImageInfo->sampler) + sizeof(write->pImageInfo->imageView)
+                        + sizeof(write->pImageInfo->imageLayout);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                size += sizeof(*write->pTexelBufferView);
+                break;
+
+            default:
+                return 0;
+        }
+    }
+
+    if (!wined3d_array_reserve(&context_vk->descriptor_set_key, &context_vk->descriptor_set_key_size, size, 1))
+        return 0;
+
+    data = context_vk->descriptor_set_key;
+    memcpy(data, &vk_set_layout, sizeof(vk_set_layout));
+    data += sizeof(vk_set_layout);
+    for (i = 0; i < writes->count; ++i)
+    {
+        const VkWriteDescriptorSet *write = &writes->writes[i];
+
+        memcpy(data, &write->dstBinding, sizeof(write->dstBinding));
+        data += sizeof(write->dstBinding);
+        memcpy(data, &write->descriptorType, sizeof(write->descriptorType));
+        data += sizeof(write->descriptorType);
+        switch (write->descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                memcpy(data, write->pBufferInfo, sizeof(*write->pBufferInfo));
+                data += sizeof(*write->pBufferInfo);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                /* Copy the fields separately; the struct has padding, which
+                 * would make keys needlessly compare unequal. */
+                memcpy(data, &write->pImageInfo->sampler, sizeof(write->pImageInfo->sampler));
+                data += sizeof(write->pImageInfo->sampler);
+                memcpy(data, &write->pImageInfo->imageView, sizeof(write->pImageInfo->imageView));
+                data += sizeof(write->pImageInfo->imageView);
+                memcpy(data, &write->pImageInfo->imageLayout, sizeof(write->pImageInfo->imageLayout));
+                data += sizeof(write->pImageInfo->imageLayout);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                memcpy(data, write->pTexelBufferView, sizeof(*write->pTexelBufferView));
+                data += sizeof(*write->pTexelBufferView);
+                break;
+        }
+    }
+
+    return size;
+}
+
 static bool wined3d_context_vk_update_descriptors(struct wined3d_context_vk *context_vk,
         VkCommandBuffer vk_command_buffer, const struct wined3d_state *state, enum wined3d_pipeline pipeline)
 {
@@ -3543,10 +3675,13 @@ static bool wined3d_context_vk_update_descriptors(struct wined3d_context_vk *con
     const struct wined3d_vk_info *vk_info = context_vk->vk_info;
     const struct wined3d_shader_resource_binding *binding;
     struct wined3d_shader_resource_bindings *bindings;
+    struct wined3d_descriptor_set_key_vk key;
+    struct wined3d_descriptor_set_vk *set;
     VkDescriptorSetLayout vk_set_layout;
     VkPipelineLayout vk_pipeline_layout;
     VkPipelineBindPoint vk_bind_point;
     VkDescriptorSet vk_descriptor_set;
+    struct wine_rb_entry *entry;
     size_t i;
 
     switch (pipeline)
@@ -3570,12 +3705,6 @@ static bool wined3d_context_vk_update_descriptors(struct wined3d_context_vk *con
             return false;
     }
 
-    if (!(vk_descriptor_set = wined3d_context_vk_create_vk_descriptor_set(context_vk, vk_set_layout)))
-    {
-        WARN("Failed to create descriptor set.\n");
-        return false;
-    }
-
     writes->count = 0;
     for (i = 0; i < bindings->count; ++i)
     {
@@ -3584,32 +3713,32 @@ static bool wined3d_context_vk_update_descriptors(struct wined3d_context_vk *con
         switch (binding->shader_descriptor_type)
         {
             case WINED3D_SHADER_DESCRIPTOR_TYPE_CBV:
-                if (!wined3d_shader_descriptor_writes_vk_add_cbv_write(writes, context_vk, vk_descriptor_set,
+                if (!wined3d_shader_descriptor_writes_vk_add_cbv_write(writes, context_vk, VK_NULL_HANDLE,
                         state, binding, &buffers[binding->shader_type][binding->resource_idx]))
                     return false;
                 break;
 
             case WINED3D_SHADER_DESCRIPTOR_TYPE_SRV:
                 if (!wined3d_shader_descriptor_writes_vk_add_srv_write(writes,
-                        context_vk, vk_descriptor_set, state, binding))
+                        context_vk, VK_NULL_HANDLE, state, binding))
                     return false;
                 break;
 
             case WINED3D_SHADER_DESCRIPTOR_TYPE_UAV:
                 if (!wined3d_shader_descriptor_writes_vk_add_uav_write(writes,
-                        context_vk, pipeline, vk_descriptor_set, state, binding))
+                        context_vk, pipeline, VK_NULL_HANDLE, state, binding))
                     return false;
                 break;
 
             case WINED3D_SHADER_DESCRIPTOR_TYPE_UAV_COUNTER:
                 if (!wined3d_shader_descriptor_writes_vk_add_uav_counter_write(writes,
-                        context_vk, pipeline, vk_descriptor_set, state, binding))
+                        context_vk, pipeline, VK_NULL_HANDLE, state, binding))
                     return false;
                 break;
 
             case WINED3D_SHADER_DESCRIPTOR_TYPE_SAMPLER:
                 if (!wined3d_shader_descriptor_writes_vk_add_sampler_write(writes,
-                        context_vk, vk_descriptor_set, state, binding))
+                        context_vk, VK_NULL_HANDLE, state, binding))
                     return false;
                 break;
 
@@ -3619,7 +3748,51 @@ static bool wined3d_context_vk_update_descriptors(struct wined3d_context_vk *con
         }
     }
 
-    VK_CALL(vkUpdateDescriptorSets(device_vk->vk_device, writes->count, writes->writes, 0, NULL));
+    /* If we wrote an identical descriptor set for an earlier draw in this
+     * command buffer, reuse it instead of writing a new one. */
+    key.data = context_vk->descriptor_set_key;
+    if ((key.size = wined3d_context_vk_serialise_descriptor_writes(context_vk, vk_set_layout))
+            && (entry = wine_rb_get(&context_vk->descriptor_set_cache, &key)))
+    {
+        vk_descriptor_set = WINE_RB_ENTRY_VALUE(entry, struct wined3d_descriptor_set_vk, entry)->vk_descriptor_set;
+    }
+    else
+    {
+        if (!(vk_descriptor_set = wined3d_context_vk_create_vk_descriptor_set(context_vk, vk_set_layout)))
+        {
+            WARN("Failed to create descriptor set.\n");
+            return false;
+        }
+
+        for (i = 0; i < writes->count; ++i)
+            writes->writes[i].dstSet = vk_descriptor_set;
+
+        VK_CALL(vkUpdateDescriptorSets(device_vk->vk_device, writes->count, writes->writes, 0, NULL));
+
+        if (key.size && (set = malloc(sizeof(*set))))
+        {
+            void *data;
+
+            if ((data = malloc(key.size)))
+            {
+                memcpy(data, context_vk->descriptor_set_key, key.size);
+                set->key.size = key.size;
+                set->key.data = data;
+                set->vk_descriptor_set = vk_descriptor_set;
+                if (wine_rb_put(&context_vk->descriptor_set_cache, &set->key, &set->entry) == -1)
+                {
+                    ERR("Failed to insert descriptor set.\n");
+                    free(data);
+                    free(set);
+                }
+            }
+            else
+            {
+                free(set);
+            }
+        }
+    }
+
     VK_CALL(vkCmdBindDescriptorSets(vk_command_buffer, vk_bind_point,
             vk_pipeline_layout, 0, 1, &vk_descriptor_set, 0, NULL));
 
@@ -3728,13 +3901,15 @@ static VkPipeline wined3d_context_vk_get_graphics_pipeline(struct wined3d_contex
     pipeline_vk->key = *key;
 
     if ((vr = VK_CALL(vkCreateGraphicsPipelines(device_vk->vk_device,
-            VK_NULL_HANDLE, 1, &key->pipeline_desc, NULL, &pipeline_vk->vk_pipeline))) < 0)
+            device_vk->vk_pipeline_cache, 1, &key->pipeline_desc, NULL, &pipeline_vk->vk_pipeline))) < 0)
     {
         WARN("Failed to create graphics pipeline, vr %s.\n", wined3d_debug_vkresult(vr));
         free(pipeline_vk);
         return VK_NULL_HANDLE;
     }
 
+    InterlockedIncrement(&wined3d_perf_counters.pipeline_compiles);
+
     if (wine_rb_put(&context_vk->graphics_pipelines, &pipeline_vk->key, &pipeline_vk->entry) == -1)
         ERR("Failed to insert pipeline.\n");
 
@@ -4414,6 +4589,7 @@ HRESULT wined3d_context_vk_init(struct wined3d_context_vk *context_vk, struct wi
     wine_rb_init(&context_vk->pipeline_layouts, wined3d_pipeline_layout_vk_compare);
     wine_rb_init(&context_vk->graphics_pipelines, wined3d_graphics_pipeline_vk_compare);
     wine_rb_init(&context_vk->bo_slab_available, wined3d_bo_slab_vk_compare);
+    wine_rb_init(&context_vk->descriptor_set_cache, wined3d_descriptor_set_vk_compare);
 
     return WINED3D_OK;
 }
@@ -723,9 +723,9 @@ static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
             wined3d_rendertarget_view_validate_location(dsv, WINED3D_LOCATION_DISCARDED);
     }
 
+    QueryPerformanceCounter(&time);
     if (TRACE_ON(frametime))
     {
-        QueryPerformanceCounter(&time);
         if (swapchain->last_present_time.QuadPart)
         {
             elapsed_time = time.QuadPart - swapchain->last_present_time.QuadPart;
@@ -748,6 +748,34 @@ static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
         }
     }
 
+    if (TRACE_ON(d3d_perf))
+    {
+        static struct wined3d_perf_counters prev_counters;
+        static DWORD prev_report_time;
+        DWORD now = GetTickCount();
+
+        /* A poor man's performance HUD; report the counter deltas at present
+         * time, every 1.5 seconds. */
+        if (now - prev_report_time > 1500)
+        {
+            TRACE_(d3d_perf)("CS submits %ld, CS stalls %ld, mapped bytes %s, "
+                    "pipeline compiles %ld, fence waits %ld (over %lu ms).\n",
+                    wined3d_perf_counters.cs_queue_submits - prev_counters.cs_queue_submits,
+                    wined3d_perf_counters.cs_queue_stalls - prev_counters.cs_queue_stalls,
+                    wine_dbgstr_longlong(wined3d_perf_counters.mapped_bytes - prev_counters.mapped_bytes),
+                    wined3d_perf_counters.pipeline_compiles - prev_counters.pipeline_compiles,
+                    wined3d_perf_counters.fence_waits - prev_counters.fence_waits,
+                    now - prev_report_time);
+            prev_counters = wined3d_perf_counters;
+            prev_report_time = now;
+        }
+    }
+
+    InterlockedIncrement(&swapchain->presented_frames);
+    InterlockedExchange64(&swapchain->presented_time, time.QuadPart);
+    if (swapchain->present_semaphore && !ReleaseSemaphore(swapchain->present_semaphore, 1, NULL))
+        ERR("Failed to release the present semaphore, last error %lu.\n", GetLastError());
+
     InterlockedDecrement(&cs->pending_presents);
     if (InterlockedCompareExchange(&cs->waiting_for_present, FALSE, TRUE))
         SetEvent(cs->present_event);
@@ -2754,15 +2782,25 @@ static void wined3d_cs_exec_update_sub_resource(struct wined3d_cs *cs, const voi
         wined3d_texture_update_sub_resource(texture_from_resource(resource),
                 op->sub_resource_idx, context, &op->bo, box, op->row_pitch, op->slice_pitch);
 
-    context_release(context);
-
     if (op->bo.flags & UPLOAD_BO_FREE_ON_UNMAP)
     {
-        if (op->bo.addr.buffer_object)
-            FIXME("Free BO address %s.\n", debug_const_bo_address(&op->bo.addr));
+        struct wined3d_bo *bo = op->bo.addr.buffer_object;
+
+        if (bo)
+        {
+            if (!--bo->refcount)
+            {
+                wined3d_context_destroy_bo(context, bo);
+                free(bo);
+            }
+        }
         else
+        {
             free((void *)op->bo.addr.addr);
+        }
     }
+
+    context_release(context);
 }
 
 void wined3d_device_context_emit_update_sub_resource(struct wined3d_device_context *context,
@@ -3231,6 +3269,8 @@ static bool wined3d_cs_map_upload_bo(struct wined3d_device_context *context, str
             client->mapped_upload.flags |= UPLOAD_BO_UPLOAD_ON_UNMAP | UPLOAD_BO_RENAME_ON_UNMAP;
 
         client->mapped_box = *box;
+        InterlockedExchangeAdd64(&wined3d_perf_counters.mapped_bytes, resource->type == WINED3D_RTYPE_BUFFER
+                ? box->right - box->left : (box->back - box->front) * map_desc->slice_pitch);
 
         TRACE("Returning bo %s, flags %#x.\n", debug_const_bo_address(&client->mapped_upload.addr),
                 client->mapped_upload.flags);
@@ -3239,6 +3279,37 @@ static bool wined3d_cs_map_upload_bo(struct wined3d_device_context *context, str
 
     get_map_pitch(format, box, map_desc, &size);
 
+    /* For texture updates, i.e. wined3d_device_context_update_sub_resource(),
+     * try to allocate a temporary BO and write straight into it; the upload
+     * would otherwise have to bounce the data through a staging BO on the CS
+     * thread. */
+    if (resource->type != WINED3D_RTYPE_BUFFER && !resource->pin_sysmem)
+    {
+        struct wined3d_device *device = context->device;
+        struct wined3d_bo_address addr;
+
+        if (device->adapter->adapter_ops->adapter_alloc_bo(device, resource, sub_resource_idx, &addr))
+        {
+            struct wined3d_bo *bo = addr.buffer_object;
+            uint8_t *map_ptr;
+
+            wined3d_device_bo_map_lock(device);
+            if ((map_ptr = bo->map_ptr))
+                ++bo->client_map_count;
+            wined3d_device_bo_map_unlock(device);
+
+            /* adapter_alloc_bo() should have given us a mapped BO. */
+            assert(map_ptr);
+
+            map_desc->data = map_ptr + bo->memory_offset;
+            client->mapped_upload.addr = *wined3d_const_bo_address(&addr);
+            client->mapped_upload.flags = UPLOAD_BO_UPLOAD_ON_UNMAP | UPLOAD_BO_FREE_ON_UNMAP;
+            client->mapped_box = *box;
+            InterlockedExchangeAdd64(&wined3d_perf_counters.mapped_bytes, size);
+            return true;
+        }
+    }
+
     if (!(map_desc->data = malloc(size)))
     {
         WARN_(d3d_perf)("Failed to allocate a heap memory buffer.\n");
@@ -3248,6 +3319,7 @@ static bool wined3d_cs_map_upload_bo(struct wined3d_device_context *context, str
     client->mapped_upload.addr.addr = map_desc->data;
     client->mapped_upload.flags = UPLOAD_BO_UPLOAD_ON_UNMAP | UPLOAD_BO_FREE_ON_UNMAP;
     client->mapped_box = *box;
+    InterlockedExchangeAdd64(&wined3d_perf_counters.mapped_bytes, size);
     return true;
 }
 
@@ -3308,6 +3380,7 @@ static void wined3d_cs_queue_submit(struct wined3d_cs_queue *queue, struct wined
     TRACE("Queuing op %s at %p.\n", debug_cs_op(*(const enum wined3d_cs_op *)packet->data), packet);
     packet_size = FIELD_OFFSET(struct wined3d_cs_packet, data[packet->size]);
     InterlockedExchange((LONG *)&queue->head, queue->head + packet_size);
+    InterlockedIncrement(&wined3d_perf_counters.cs_queue_submits);
 
     if (InterlockedCompareExchange(&cs->waiting_for_event, FALSE, TRUE))
     {
@@ -3333,6 +3406,8 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
     size_t queue_size = ARRAY_SIZE(queue->data);
     size_t header_size, packet_size, remaining;
     struct wined3d_cs_packet *packet;
+    unsigned int spin_count = 0;
+    bool stalled = false;
     ULONG head = queue->head & WINED3D_CS_QUEUE_MASK;
 
     header_size = FIELD_OFFSET(struct wined3d_cs_packet, data[0]);
@@ -3382,6 +3457,14 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
 
         TRACE_(d3d_perf)("Waiting for free space. Head %lu, tail %lu, packet size %Iu.\n",
                 head, tail, packet_size);
+        if (!stalled)
+        {
+            stalled = true;
+            InterlockedIncrement(&wined3d_perf_counters.cs_queue_stalls);
+        }
+        /* The queue is only full when the CS thread is saturated; don't steal
+         * its CPU time by spinning at full tilt. */
+        wined3d_pause(&spin_count);
     }
 
     packet = (struct wined3d_cs_packet *)&queue->data[head];
@@ -3431,6 +3514,7 @@ static void poll_queries(struct wined3d_cs *cs)
 {
     struct wined3d_query *query, *cursor;
 
+    ++cs->query_poll_id;
     LIST_FOR_EACH_ENTRY_SAFE(query, cursor, &cs->query_poll_list, struct wined3d_query, poll_list_entry)
     {
         if (!query->query_ops->query_poll(query, 0))
@@ -4590,63 +4674,51 @@ HRESULT CDECL wined3d_deferred_context_record_command_list(struct wined3d_device
 {
     struct wined3d_deferred_context *deferred = wined3d_deferred_context_from_context(context);
     struct wined3d_command_list *object;
-    void *memory;
 
     TRACE("context %p, list %p.\n", context, list);
 
     wined3d_device_context_lock(context);
-    memory = malloc(sizeof(*object) + deferred->resource_count * sizeof(*object->resources)
-            + deferred->upload_count * sizeof(*object->uploads)
-            + deferred->command_list_count * sizeof(*object->command_lists)
-            + deferred->query_count * sizeof(*object->queries)
-            + deferred->data_size);
-
-    if (!memory)
+    if (!(object = calloc(1, sizeof(*object))))
     {
         wined3d_device_context_unlock(context);
         return E_OUTOFMEMORY;
     }
 
-    object = memory;
-    memory = &object[1];
-    memset(object, 0, sizeof(*object));
     object->refcount = 1;
     object->device = deferred->c.device;
 
-    object->resources = memory;
-    memory = &object->resources[deferred->resource_count];
+    /* Transfer the recorded data and our references to the resources, command
+     * lists and queries to the command list, so that recording a command list
+     * doesn't cost a copy proportional to its size. */
+    object->resources = deferred->resources;
     object->resource_count = deferred->resource_count;
-    memcpy(object->resources, deferred->resources, deferred->resource_count * sizeof(*object->resources));
-    /* Transfer our references to the resources to the command list. */
+    deferred->resources = NULL;
+    deferred->resources_capacity = 0;
+    deferred->resource_count = 0;
 
-    object->uploads = memory;
-    memory = &object->uploads[deferred->upload_count];
+    object->uploads = deferred->uploads;
     object->upload_count = deferred->upload_count;
-    memcpy(object->uploads, deferred->uploads, deferred->upload_count * sizeof(*object->uploads));
-    /* Transfer our references to the resources to the command list. */
+    deferred->uploads = NULL;
+    deferred->uploads_capacity = 0;
+    deferred->upload_count = 0;
 
-    object->command_lists = memory;
-    memory = &object->command_lists[deferred->command_list_count];
+    object->command_lists = deferred->command_lists;
     object->command_list_count = deferred->command_list_count;
-    memcpy(object->command_lists, deferred->command_lists,
-            deferred->command_list_count * sizeof(*object->command_lists));
-    /* Transfer our references to the command lists to the command list. */
+    deferred->command_lists = NULL;
+    deferred->command_lists_capacity = 0;
+    deferred->command_list_count = 0;
 
-    object->queries = memory;
-    memory = &object->queries[deferred->query_count];
+    object->queries = deferred->queries;
     object->query_count = deferred->query_count;
-    memcpy(object->queries, deferred->queries, deferred->query_count * sizeof(*object->queries));
-    /* Transfer our references to the queries to the command list. */
+    deferred->queries = NULL;
+    deferred->queries_capacity = 0;
+    deferred->query_count = 0;
 
-    object->data = memory;
+    object->data = deferred->data;
     object->data_size = deferred->data_size;
-    memcpy(object->data, deferred->data, deferred->data_size);
-
+    deferred->data = NULL;
+    deferred->data_capacity = 0;
     deferred->data_size = 0;
-    deferred->resource_count = 0;
-    deferred->upload_count = 0;
-    deferred->command_list_count = 0;
-    deferred->query_count = 0;
 
     object->upload_heap = deferred->upload_heap;
     if ((object->upload_heap_refcount = deferred->upload_heap_refcount))
@@ -4704,6 +4776,11 @@ static void wined3d_command_list_destroy_object(void *object)
         }
     }
 
+    free(list->resources);
+    free(list->uploads);
+    free(list->command_lists);
+    free(list->queries);
+    free(list->data);
     free(list);
 }
 
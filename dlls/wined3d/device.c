@@ -1294,6 +1294,15 @@ static struct wined3d_allocator_block *wined3d_device_gl_allocate_memory(struct
 
     if (!(block = wined3d_allocator_allocate(allocator, context_gl ? &context_gl->c : NULL, memory_type, size)))
     {
+        /* New chunks can only be created on a thread with a GL context. Leave
+         * a note for the CS thread to grow the pool, so that subsequent
+         * client thread allocations stop taking the slow path. */
+        if (!context_gl && !device_gl->pending_chunk_request)
+        {
+            device_gl->pending_chunk_request = true;
+            device_gl->pending_chunk_memory_type = memory_type;
+            device_gl->pending_chunk_size = size;
+        }
         wined3d_device_gl_allocator_unlock(device_gl);
         *id = 0;
         return NULL;
@@ -1306,6 +1315,41 @@ static struct wined3d_allocator_block *wined3d_device_gl_allocate_memory(struct
     return block;
 }
 
+/* Called from the CS thread to create a new chunk on behalf of the client
+ * thread, which cannot create GL buffers itself. */
+void wined3d_device_gl_service_chunk_request(struct wined3d_device_gl *device_gl,
+        struct wined3d_context_gl *context_gl)
+{
+    struct wined3d_allocator_block *block;
+    unsigned int memory_type;
+    GLsizeiptr size;
+    GLuint id;
+
+    /* An unsynchronised read, but nothing bad happens if we miss a request
+     * here; it will be serviced on the next fence retirement. */
+    if (!device_gl->pending_chunk_request)
+        return;
+
+    wined3d_device_gl_allocator_lock(device_gl);
+    device_gl->pending_chunk_request = false;
+    memory_type = device_gl->pending_chunk_memory_type;
+    size = device_gl->pending_chunk_size;
+    wined3d_device_gl_allocator_unlock(device_gl);
+
+    /* Allocating and immediately freeing a block creates a new chunk only if
+     * the pool is still exhausted. */
+    if ((block = wined3d_device_gl_allocate_memory(device_gl, context_gl, memory_type, size, &id)))
+    {
+        wined3d_device_gl_allocator_lock(device_gl);
+        wined3d_allocator_block_free(block);
+        wined3d_device_gl_allocator_unlock(device_gl);
+    }
+    else
+    {
+        WARN("Failed to grow the allocator pool for memory type %u.\n", memory_type);
+    }
+}
+
 static bool use_buffer_chunk_suballocation(struct wined3d_device_gl *device_gl,
         const struct wined3d_gl_info *gl_info, GLenum binding)
 {
@@ -618,6 +618,9 @@ void shader_glsl_validate_link(const struct wined3d_gl_info *gl_info, GLuint pro
 {
     GLint tmp;
 
+    /* This is called once after every program link. */
+    InterlockedIncrement(&wined3d_perf_counters.pipeline_compiles);
+
     if (!TRACE_ON(d3d_shader) && !FIXME_ON(d3d_shader))
         return;
 
@@ -1383,6 +1383,7 @@ void wined3d_query_pool_vk_cleanup(struct wined3d_query_pool_vk *pool_vk, struct
     VK_CALL(vkDestroyQueryPool(device_vk->vk_device, pool_vk->vk_query_pool, NULL));
     if (pool_vk->vk_event)
         VK_CALL(vkDestroyEvent(device_vk->vk_device, pool_vk->vk_event, NULL));
+    free(pool_vk->results);
     list_remove(&pool_vk->entry);
     list_remove(&pool_vk->completed_entry);
 }
@@ -1409,11 +1410,13 @@ bool wined3d_query_pool_vk_init(struct wined3d_query_pool_vk *pool_vk,
         case WINED3D_QUERY_TYPE_OCCLUSION:
             pool_info.queryType = VK_QUERY_TYPE_OCCLUSION;
             pool_info.pipelineStatistics = 0;
+            pool_vk->result_stride = 2;
             break;
 
         case WINED3D_QUERY_TYPE_TIMESTAMP:
             pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
             pool_info.pipelineStatistics = 0;
+            pool_vk->result_stride = 2;
             break;
 
         case WINED3D_QUERY_TYPE_PIPELINE_STATISTICS:
@@ -1429,6 +1432,7 @@ bool wined3d_query_pool_vk_init(struct wined3d_query_pool_vk *pool_vk,
                     | VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT
                     | VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT
                     | VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+            pool_vk->result_stride = 12;
             break;
 
         case WINED3D_QUERY_TYPE_SO_STATISTICS:
@@ -1438,6 +1442,7 @@ bool wined3d_query_pool_vk_init(struct wined3d_query_pool_vk *pool_vk,
         case WINED3D_QUERY_TYPE_SO_STATISTICS_STREAM3:
             pool_info.queryType = VK_QUERY_TYPE_TRANSFORM_FEEDBACK_STREAM_EXT;
             pool_info.pipelineStatistics = 0;
+            pool_vk->result_stride = 3;
             break;
 
         default:
@@ -1456,26 +1461,20 @@ bool wined3d_query_pool_vk_init(struct wined3d_query_pool_vk *pool_vk,
     return true;
 }
 
-bool wined3d_query_vk_accumulate_data(struct wined3d_query_vk *query_vk,
-        struct wined3d_device_vk *device_vk, const struct wined3d_query_pool_idx_vk *pool_idx)
+static bool wined3d_query_pool_vk_get_results(struct wined3d_query_pool_vk *pool_vk,
+        struct wined3d_device_vk *device_vk)
 {
-    const struct wined3d_query_data_pipeline_statistics *ps_tmp;
     const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
-    struct wined3d_query_data_pipeline_statistics *ps_result;
+    uint64_t poll_id = device_vk->d.cs->query_poll_id;
     VkResult vr;
-    union
-    {
-        uint64_t occlusion;
-        uint64_t timestamp;
-        struct wined3d_query_data_pipeline_statistics pipeline_statistics;
-        struct wined3d_query_data_so_statistics so_statistics;
-    } tmp, *result;
 
-    if (pool_idx->pool_vk->vk_event)
+    if (pool_vk->results && pool_vk->results_poll_id == poll_id)
+        return true;
+
+    if (pool_vk->vk_event)
     {
         /* Check if the pool's initial reset command executed. */
-        vr = VK_CALL(vkGetEventStatus(device_vk->vk_device,
-                pool_idx->pool_vk->vk_event));
+        vr = VK_CALL(vkGetEventStatus(device_vk->vk_device, pool_vk->vk_event));
         if (vr == VK_EVENT_RESET)
             return false;
         else if (vr != VK_EVENT_SET)
@@ -1485,15 +1484,50 @@ bool wined3d_query_vk_accumulate_data(struct wined3d_query_vk *query_vk,
         }
     }
 
-    if ((vr = VK_CALL(vkGetQueryPoolResults(device_vk->vk_device, pool_idx->pool_vk->vk_query_pool,
-            pool_idx->idx, 1, sizeof(tmp), &tmp, sizeof(tmp), VK_QUERY_RESULT_64_BIT))) < 0)
+    if (!pool_vk->results && !(pool_vk->results = malloc(WINED3D_QUERY_POOL_SIZE
+            * pool_vk->result_stride * sizeof(*pool_vk->results))))
+        return false;
+
+    /* Read back the entire pool in one go; applications polling a large
+     * number of queries every frame would otherwise cost us a driver call
+     * per query per poll pass. */
+    if ((vr = VK_CALL(vkGetQueryPoolResults(device_vk->vk_device, pool_vk->vk_query_pool,
+            0, WINED3D_QUERY_POOL_SIZE, WINED3D_QUERY_POOL_SIZE * pool_vk->result_stride
+            * sizeof(*pool_vk->results), pool_vk->results, pool_vk->result_stride * sizeof(*pool_vk->results),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT))) < 0)
     {
         ERR("Failed to get query results, vr %s.\n", wined3d_debug_vkresult(vr));
         return false;
     }
 
-    if (vr == VK_NOT_READY)
+    pool_vk->results_poll_id = poll_id;
+
+    return true;
+}
+
+bool wined3d_query_vk_accumulate_data(struct wined3d_query_vk *query_vk,
+        struct wined3d_device_vk *device_vk, const struct wined3d_query_pool_idx_vk *pool_idx)
+{
+    const struct wined3d_query_data_pipeline_statistics *ps_tmp;
+    struct wined3d_query_data_pipeline_statistics *ps_result;
+    struct wined3d_query_pool_vk *pool_vk = pool_idx->pool_vk;
+    const uint64_t *res;
+    union
+    {
+        uint64_t occlusion;
+        uint64_t timestamp;
+        struct wined3d_query_data_pipeline_statistics pipeline_statistics;
+        struct wined3d_query_data_so_statistics so_statistics;
+    } tmp, *result;
+
+    if (!wined3d_query_pool_vk_get_results(pool_vk, device_vk))
+        return false;
+
+    res = &pool_vk->results[pool_idx->idx * pool_vk->result_stride];
+    /* The last element of each result is its availability status. */
+    if (!res[pool_vk->result_stride - 1])
         return false;
+    memcpy(&tmp, res, (pool_vk->result_stride - 1) * sizeof(*res));
 
     result = (void *)query_vk->q.data;
     switch (query_vk->q.type)
@@ -1608,6 +1642,11 @@ static BOOL wined3d_query_vk_poll(struct wined3d_query *query, uint32_t flags)
     struct wined3d_query_vk *query_vk = wined3d_query_vk(query);
     unsigned int i;
 
+    /* Without a CS thread we poll straight from the application thread,
+     * bypassing poll_queries(); treat each call as its own poll pass. */
+    if (!query->poll_in_cs)
+        ++query->device->cs->query_poll_id;
+
     memset((void *)query->data, 0, query->data_size);
 
     if (query_vk->pool_idx.pool_vk && !wined3d_query_vk_accumulate_data(query_vk, device_vk, &query_vk->pool_idx))
@@ -504,7 +504,7 @@ static struct shader_spirv_compute_program_vk *shader_spirv_find_compute_program
     pipeline_info.basePipelineHandle = VK_NULL_HANDLE;
     pipeline_info.basePipelineIndex = -1;
     if ((vr = VK_CALL(vkCreateComputePipelines(device_vk->vk_device,
-            VK_NULL_HANDLE, 1, &pipeline_info, NULL, &program->vk_pipeline))) < 0)
+            device_vk->vk_pipeline_cache, 1, &pipeline_info, NULL, &program->vk_pipeline))) < 0)
     {
         ERR("Failed to create Vulkan compute pipeline, vr %s.\n", wined3d_debug_vkresult(vr));
         VK_CALL(vkDestroyShaderModule(device_vk->vk_device, program->vk_module, NULL));
@@ -512,6 +512,8 @@ static struct shader_spirv_compute_program_vk *shader_spirv_find_compute_program
         return NULL;
     }
 
+    InterlockedIncrement(&wined3d_perf_counters.pipeline_compiles);
+
     return program;
 }
 
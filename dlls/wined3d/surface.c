@@ -29,6 +29,10 @@
 #include "wined3d_private.h"
 #include "wined3d_gl.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 WINE_DEFAULT_DEBUG_CHANNEL(d3d);
 WINE_DECLARE_DEBUG_CHANNEL(d3d_perf);
 
@@ -593,6 +597,158 @@ static HRESULT surface_cpu_blt_compressed(const BYTE *src_data, BYTE *dst_data,
     return E_NOTIMPL;
 }
 
+/* Row kernels for the unstretched, unmirrored colour-keyed copy, processing
+ * 16 bytes at a time where SSE2 is available. A pixel is copied when its
+ * source value lies outside the source key range and the destination value
+ * lies inside the destination key range. Key ranges wider than the pixel
+ * type are clamped into its domain first; an empty range is encoded as
+ * low 1, high 0. */
+
+static void keyed_copy_row_8(BYTE *dst, const BYTE *src, unsigned int count,
+        DWORD keylow, DWORD keyhigh, DWORD keymask,
+        DWORD destkeylow, DWORD destkeyhigh, DWORD destkeymask)
+{
+    unsigned int x = 0;
+
+    if (keylow > 0xff)
+    {
+        keylow = 1;
+        keyhigh = 0;
+    }
+    else if (keyhigh > 0xff)
+        keyhigh = 0xff;
+    if (destkeylow > 0xff)
+    {
+        destkeylow = 1;
+        destkeyhigh = 0;
+    }
+    else if (destkeyhigh > 0xff)
+        destkeyhigh = 0xff;
+
+#ifdef __SSE2__
+    {
+        const __m128i bias = _mm_set1_epi8(-0x80);
+        const __m128i km = _mm_set1_epi8(keymask), dkm = _mm_set1_epi8(destkeymask);
+        const __m128i kl = _mm_set1_epi8(keylow - 0x80), kh = _mm_set1_epi8(keyhigh - 0x80);
+        const __m128i dkl = _mm_set1_epi8(destkeylow - 0x80), dkh = _mm_set1_epi8(destkeyhigh - 0x80);
+
+        for (; x + 16 <= count; x += 16)
+        {
+            __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+            __m128i d = _mm_loadu_si128((const __m128i *)(dst + x));
+            __m128i sk = _mm_xor_si128(_mm_and_si128(s, km), bias);
+            __m128i dk = _mm_xor_si128(_mm_and_si128(d, dkm), bias);
+            __m128i mask = _mm_or_si128(_mm_cmpgt_epi8(kl, sk), _mm_cmpgt_epi8(sk, kh));
+
+            mask = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi8(dkl, dk), _mm_cmpgt_epi8(dk, dkh)), mask);
+            _mm_storeu_si128((__m128i *)(dst + x),
+                    _mm_or_si128(_mm_and_si128(mask, s), _mm_andnot_si128(mask, d)));
+        }
+    }
+#endif
+    for (; x < count; ++x)
+    {
+        BYTE tmp = src[x];
+
+        if (((tmp & keymask) < keylow || (tmp & keymask) > keyhigh)
+                && ((dst[x] & destkeymask) >= destkeylow && (dst[x] & destkeymask) <= destkeyhigh))
+            dst[x] = tmp;
+    }
+}
+
+static void keyed_copy_row_16(BYTE *dst, const BYTE *src, unsigned int count,
+        DWORD keylow, DWORD keyhigh, DWORD keymask,
+        DWORD destkeylow, DWORD destkeyhigh, DWORD destkeymask)
+{
+    const WORD *s = (const WORD *)src;
+    WORD *d = (WORD *)dst;
+    unsigned int x = 0;
+
+    if (keylow > 0xffff)
+    {
+        keylow = 1;
+        keyhigh = 0;
+    }
+    else if (keyhigh > 0xffff)
+        keyhigh = 0xffff;
+    if (destkeylow > 0xffff)
+    {
+        destkeylow = 1;
+        destkeyhigh = 0;
+    }
+    else if (destkeyhigh > 0xffff)
+        destkeyhigh = 0xffff;
+
+#ifdef __SSE2__
+    {
+        const __m128i bias = _mm_set1_epi16(-0x8000);
+        const __m128i km = _mm_set1_epi16(keymask), dkm = _mm_set1_epi16(destkeymask);
+        const __m128i kl = _mm_set1_epi16(keylow - 0x8000), kh = _mm_set1_epi16(keyhigh - 0x8000);
+        const __m128i dkl = _mm_set1_epi16(destkeylow - 0x8000), dkh = _mm_set1_epi16(destkeyhigh - 0x8000);
+
+        for (; x + 8 <= count; x += 8)
+        {
+            __m128i sv = _mm_loadu_si128((const __m128i *)(s + x));
+            __m128i dv = _mm_loadu_si128((const __m128i *)(d + x));
+            __m128i sk = _mm_xor_si128(_mm_and_si128(sv, km), bias);
+            __m128i dk = _mm_xor_si128(_mm_and_si128(dv, dkm), bias);
+            __m128i mask = _mm_or_si128(_mm_cmpgt_epi16(kl, sk), _mm_cmpgt_epi16(sk, kh));
+
+            mask = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi16(dkl, dk), _mm_cmpgt_epi16(dk, dkh)), mask);
+            _mm_storeu_si128((__m128i *)(d + x),
+                    _mm_or_si128(_mm_and_si128(mask, sv), _mm_andnot_si128(mask, dv)));
+        }
+    }
+#endif
+    for (; x < count; ++x)
+    {
+        WORD tmp = s[x];
+
+        if (((tmp & keymask) < keylow || (tmp & keymask) > keyhigh)
+                && ((d[x] & destkeymask) >= destkeylow && (d[x] & destkeymask) <= destkeyhigh))
+            d[x] = tmp;
+    }
+}
+
+static void keyed_copy_row_32(BYTE *dst, const BYTE *src, unsigned int count,
+        DWORD keylow, DWORD keyhigh, DWORD keymask,
+        DWORD destkeylow, DWORD destkeyhigh, DWORD destkeymask)
+{
+    const DWORD *s = (const DWORD *)src;
+    DWORD *d = (DWORD *)dst;
+    unsigned int x = 0;
+
+#ifdef __SSE2__
+    {
+        const __m128i bias = _mm_set1_epi32(0x80000000);
+        const __m128i km = _mm_set1_epi32(keymask), dkm = _mm_set1_epi32(destkeymask);
+        const __m128i kl = _mm_set1_epi32(keylow ^ 0x80000000), kh = _mm_set1_epi32(keyhigh ^ 0x80000000);
+        const __m128i dkl = _mm_set1_epi32(destkeylow ^ 0x80000000), dkh = _mm_set1_epi32(destkeyhigh ^ 0x80000000);
+
+        for (; x + 4 <= count; x += 4)
+        {
+            __m128i sv = _mm_loadu_si128((const __m128i *)(s + x));
+            __m128i dv = _mm_loadu_si128((const __m128i *)(d + x));
+            __m128i sk = _mm_xor_si128(_mm_and_si128(sv, km), bias);
+            __m128i dk = _mm_xor_si128(_mm_and_si128(dv, dkm), bias);
+            __m128i mask = _mm_or_si128(_mm_cmpgt_epi32(kl, sk), _mm_cmpgt_epi32(sk, kh));
+
+            mask = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi32(dkl, dk), _mm_cmpgt_epi32(dk, dkh)), mask);
+            _mm_storeu_si128((__m128i *)(d + x),
+                    _mm_or_si128(_mm_and_si128(mask, sv), _mm_andnot_si128(mask, dv)));
+        }
+    }
+#endif
+    for (; x < count; ++x)
+    {
+        DWORD tmp = s[x];
+
+        if (((tmp & keymask) < keylow || (tmp & keymask) > keyhigh)
+                && ((d[x] & destkeymask) >= destkeylow && (d[x] & destkeymask) <= destkeyhigh))
+            d[x] = tmp;
+    }
+}
+
 static HRESULT surface_cpu_blt(struct wined3d_texture *dst_texture, unsigned int dst_sub_resource_idx,
         const struct wined3d_box *dst_box, struct wined3d_texture *src_texture, unsigned int src_sub_resource_idx,
         const struct wined3d_box *src_box, uint32_t flags, const struct wined3d_blt_fx *fx,
@@ -911,6 +1067,9 @@ do { \
     }
     else
     {
+        void (*keyed_copy_row)(BYTE *dst, const BYTE *src, unsigned int count,
+                DWORD keylow, DWORD keyhigh, DWORD keymask,
+                DWORD destkeylow, DWORD destkeyhigh, DWORD destkeymask) = NULL;
         LONG dstyinc = dst_map.row_pitch, dstxinc = bpp;
         DWORD keylow = 0xffffffff, keyhigh = 0, keymask = 0xffffffff;
         DWORD destkeylow = 0x0, destkeyhigh = 0xffffffff, destkeymask = 0xffffffff;
@@ -1038,6 +1197,25 @@ do { \
             flags &= ~(WINED3D_BLT_FX);
         }
 
+        /* Pick a row kernel for the common case: equal sizes, no mirroring or
+         * rotation, and no in-place blit. */
+        if (dst_width == src_width && dst_height == src_height && !same_sub_resource
+                && dstxinc == (LONG)bpp && dstyinc == (LONG)dst_map.row_pitch)
+        {
+            switch (bpp)
+            {
+                case 1:
+                    keyed_copy_row = keyed_copy_row_8;
+                    break;
+                case 2:
+                    keyed_copy_row = keyed_copy_row_16;
+                    break;
+                case 4:
+                    keyed_copy_row = keyed_copy_row_32;
+                    break;
+            }
+        }
+
 #define COPY_COLORKEY_FX(type) \
 do { \
     const type *s; \
@@ -1060,7 +1238,13 @@ do { \
     } \
 } while(0)
 
-        switch (bpp)
+        if (keyed_copy_row)
+        {
+            for (y = 0; y < dst_height; ++y)
+                keyed_copy_row(dbuf + y * dst_map.row_pitch, sbase + y * src_map.row_pitch,
+                        dst_width, keylow, keyhigh, keymask, destkeylow, destkeyhigh, destkeymask);
+        }
+        else switch (bpp)
         {
             case 1:
                 COPY_COLORKEY_FX(BYTE);
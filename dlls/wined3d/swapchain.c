@@ -291,6 +291,22 @@ struct wined3d_output * wined3d_swapchain_get_output(const struct wined3d_swapch
     return swapchain->state.desc.output;
 }
 
+void CDECL wined3d_swapchain_get_present_stats(struct wined3d_swapchain *swapchain,
+        struct wined3d_present_stats *stats)
+{
+    TRACE("swapchain %p, stats %p.\n", swapchain, stats);
+
+    stats->present_count = InterlockedCompareExchange(&swapchain->presented_frames, 0, 0);
+    stats->present_time.QuadPart = InterlockedCompareExchange64(&swapchain->presented_time, 0, 0);
+}
+
+void CDECL wined3d_swapchain_set_present_semaphore(struct wined3d_swapchain *swapchain, HANDLE semaphore)
+{
+    TRACE("swapchain %p, semaphore %p.\n", swapchain, semaphore);
+
+    swapchain->present_semaphore = semaphore;
+}
+
 HRESULT CDECL wined3d_swapchain_get_raster_status(const struct wined3d_swapchain *swapchain,
         struct wined3d_raster_status *raster_status)
 {
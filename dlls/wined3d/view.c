@@ -2015,7 +2015,8 @@ static VkPipeline create_uav_pipeline(struct wined3d_context_vk *context_vk,
 
     vk_device = wined3d_device_vk(context->device)->vk_device;
 
-    if ((vr = VK_CALL(vkCreateComputePipelines(vk_device, VK_NULL_HANDLE, 1, &pipeline_info, NULL, &result))) < 0)
+    if ((vr = VK_CALL(vkCreateComputePipelines(vk_device, wined3d_device_vk(context->device)->vk_pipeline_cache,
+            1, &pipeline_info, NULL, &result))) < 0)
     {
         ERR("Failed to create Vulkan compute pipeline, vr %s.\n", wined3d_debug_vkresult(vr));
         return VK_NULL_HANDLE;
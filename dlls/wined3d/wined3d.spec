@@ -13,6 +13,7 @@
 @ cdecl wined3d_get_adapter_count(ptr)
 @ cdecl wined3d_get_device_caps(ptr long ptr)
 @ cdecl wined3d_get_renderer()
+@ cdecl wined3d_get_statistics(ptr)
 @ cdecl wined3d_incref(ptr)
 @ cdecl wined3d_register_software_device(ptr ptr)
 @ cdecl wined3d_register_window(ptr ptr ptr long)
@@ -303,6 +304,7 @@
 @ cdecl wined3d_swapchain_get_front_buffer_data(ptr ptr long)
 @ cdecl wined3d_swapchain_get_gamma_ramp(ptr ptr)
 @ cdecl wined3d_swapchain_get_parent(ptr)
+@ cdecl wined3d_swapchain_get_present_stats(ptr ptr)
 @ cdecl wined3d_swapchain_get_raster_status(ptr ptr)
 @ cdecl wined3d_swapchain_get_state(ptr)
 @ cdecl wined3d_swapchain_incref(ptr)
@@ -310,6 +312,7 @@
 @ cdecl wined3d_swapchain_resize_buffers(ptr long long long long long long)
 @ cdecl wined3d_swapchain_set_gamma_ramp(ptr long ptr)
 @ cdecl wined3d_swapchain_set_palette(ptr ptr)
+@ cdecl wined3d_swapchain_set_present_semaphore(ptr ptr)
 @ cdecl wined3d_swapchain_set_window(ptr ptr)
 
 @ cdecl wined3d_swapchain_state_create(ptr ptr ptr ptr ptr)
@@ -879,6 +879,13 @@ struct wined3d_device_gl
     SIZE_T retired_blocks_size;
     SIZE_T retired_block_count;
 
+    /* A client thread allocation request which could not be satisfied from
+     * the existing chunks, to be serviced by the CS thread. Protected by
+     * allocator_cs. */
+    GLsizeiptr pending_chunk_size;
+    unsigned int pending_chunk_memory_type;
+    bool pending_chunk_request;
+
     HWND backup_wnd;
     HDC backup_dc;
 };
@@ -916,6 +923,8 @@ static inline void wined3d_allocator_chunk_gl_unlock(struct wined3d_allocator_ch
 bool wined3d_device_gl_create_bo(struct wined3d_device_gl *device_gl,
         struct wined3d_context_gl *context_gl, GLsizeiptr size, GLenum binding,
         GLenum usage, bool coherent, GLbitfield flags, struct wined3d_bo_gl *bo);
+void wined3d_device_gl_service_chunk_request(struct wined3d_device_gl *device_gl,
+        struct wined3d_context_gl *context_gl);
 void wined3d_device_gl_create_primary_opengl_context_cs(void *object);
 void wined3d_device_gl_delete_opengl_contexts_cs(void *object);
 HDC wined3d_device_gl_get_backup_dc(struct wined3d_device_gl *device_gl);
@@ -131,6 +131,8 @@ struct wined3d_settings wined3d_settings =
     .shader_backend = WINED3D_SHADER_BACKEND_AUTO,
 };
 
+struct wined3d_perf_counters wined3d_perf_counters;
+
 enum wined3d_renderer CDECL wined3d_get_renderer(void)
 {
     if (wined3d_settings.renderer == WINED3D_RENDERER_AUTO)
@@ -139,6 +141,17 @@ enum wined3d_renderer CDECL wined3d_get_renderer(void)
     return wined3d_settings.renderer;
 }
 
+void CDECL wined3d_get_statistics(struct wined3d_statistics *stats)
+{
+    TRACE("stats %p.\n", stats);
+
+    stats->cs_queue_submits = InterlockedCompareExchange(&wined3d_perf_counters.cs_queue_submits, 0, 0);
+    stats->cs_queue_stalls = InterlockedCompareExchange(&wined3d_perf_counters.cs_queue_stalls, 0, 0);
+    stats->mapped_bytes = InterlockedCompareExchange64(&wined3d_perf_counters.mapped_bytes, 0, 0);
+    stats->pipeline_compiles = InterlockedCompareExchange(&wined3d_perf_counters.pipeline_compiles, 0, 0);
+    stats->fence_waits = InterlockedCompareExchange(&wined3d_perf_counters.fence_waits, 0, 0);
+}
+
 struct wined3d * CDECL wined3d_create(uint32_t flags)
 {
     struct wined3d *object;
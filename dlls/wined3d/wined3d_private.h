@@ -494,6 +494,19 @@ struct wined3d_settings
 
 extern struct wined3d_settings wined3d_settings;
 
+/* Backing storage for wined3d_get_statistics(), updated with interlocked
+ * operations from the hot paths it instruments. */
+struct wined3d_perf_counters
+{
+    LONG cs_queue_submits;
+    LONG cs_queue_stalls;
+    LONG64 mapped_bytes;
+    LONG pipeline_compiles;
+    LONG fence_waits;
+};
+
+extern struct wined3d_perf_counters wined3d_perf_counters;
+
 enum wined3d_shader_resource_type
 {
     WINED3D_SHADER_RESOURCE_NONE,
@@ -3697,6 +3710,9 @@ struct wined3d_cs
     size_t data_size, start, end;
     void *data;
     struct list query_poll_list;
+    /* Incremented for each pass over "query_poll_list", so that backends can
+     * share result readbacks between queries polled in the same pass. */
+    uint64_t query_poll_id;
     BOOL queries_flushed;
 
     HANDLE event, present_event;
@@ -4108,9 +4124,16 @@ struct wined3d_swapchain
     unsigned int swap_interval;
     unsigned int max_frame_latency;
 
+    /* Released by the CS thread each time a present has been executed, for
+     * the frame latency waitable object in dxgi. */
+    HANDLE present_semaphore;
+
     /* Performance tracking */
     LARGE_INTEGER last_present_time;
     LONG prev_time, frames;
+    /* Present statistics, updated by the CS thread. */
+    LONG presented_frames;
+    LONG64 presented_time;
 
     struct wined3d_swapchain_state state;
     HWND win_handle;
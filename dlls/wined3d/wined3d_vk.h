@@ -46,6 +46,7 @@ struct wined3d_device_vk;
     VK_INSTANCE_PFN(vkGetPhysicalDeviceSparseImageFormatProperties) \
     /* Vulkan 1.1 */ \
     VK_INSTANCE_EXT_PFN(vkGetPhysicalDeviceFeatures2) \
+    VK_INSTANCE_EXT_PFN(vkGetPhysicalDeviceMemoryProperties2) \
     VK_INSTANCE_EXT_PFN(vkGetPhysicalDeviceProperties2) \
     /* VK_KHR_surface */ \
     VK_INSTANCE_PFN(vkDestroySurfaceKHR) \
@@ -255,6 +256,7 @@ enum wined3d_vk_extension
     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE2,
     WINED3D_VK_EXT_EXTENDED_DYNAMIC_STATE3,
     WINED3D_VK_EXT_HOST_QUERY_RESET,
+    WINED3D_VK_EXT_MEMORY_BUDGET,
     WINED3D_VK_EXT_SHADER_STENCIL_EXPORT,
     WINED3D_VK_EXT_TRANSFORM_FEEDBACK,
     WINED3D_VK_EXT_VERTEX_ATTRIBUTE_DIVISOR,
@@ -386,6 +388,14 @@ struct wined3d_query_pool_vk
     VkQueryPool vk_query_pool;
     VkEvent vk_event;
 
+    /* A snapshot of the results of the entire pool, read back in a single
+     * vkGetQueryPoolResults() call per poll pass. Each query occupies
+     * "result_stride" uint64_t elements, the last of which holds the
+     * query's availability status. */
+    uint64_t *results;
+    uint64_t results_poll_id;
+    unsigned int result_stride;
+
     uint32_t allocated[WINED3D_BITMAP_SIZE(WINED3D_QUERY_POOL_SIZE)];
     uint32_t completed[WINED3D_BITMAP_SIZE(WINED3D_QUERY_POOL_SIZE)];
 };
@@ -696,6 +706,9 @@ struct wined3d_context_vk
     struct wined3d_aux_command_pool_vk decode_pool;
 
     struct wined3d_shader_descriptor_writes_vk descriptor_writes;
+    /* Scratch buffer for serialising descriptor writes into a cache key. */
+    void *descriptor_set_key;
+    SIZE_T descriptor_set_key_size;
 
     VkFramebuffer vk_framebuffer;
     VkRenderPass vk_render_pass;
@@ -724,6 +737,9 @@ struct wined3d_context_vk
     struct wine_rb_tree pipeline_layouts;
     struct wine_rb_tree graphics_pipelines;
     struct wine_rb_tree bo_slab_available;
+    /* Descriptor sets written for earlier draws in the current command
+     * buffer, keyed by their serialised writes. */
+    struct wine_rb_tree descriptor_set_cache;
 };
 
 static inline struct wined3d_context_vk *wined3d_context_vk(struct wined3d_context *context)
@@ -806,6 +822,12 @@ struct wined3d_adapter_vk
 
     VkPhysicalDeviceLimits device_limits;
     VkPhysicalDeviceMemoryProperties memory_properties;
+
+    /* Per-heap usage and budget as reported by VK_EXT_memory_budget,
+     * refreshed on command buffer submission. Only used as an allocation
+     * heuristic; torn reads from other threads are harmless. */
+    VkDeviceSize heap_usage[VK_MAX_MEMORY_HEAPS];
+    VkDeviceSize heap_budget[VK_MAX_MEMORY_HEAPS];
 };
 
 static inline struct wined3d_adapter_vk *wined3d_adapter_vk(struct wined3d_adapter *adapter)
@@ -820,6 +842,7 @@ unsigned int wined3d_adapter_vk_get_memory_type_index(const struct wined3d_adapt
         uint32_t memory_type_mask, VkMemoryPropertyFlags flags);
 BOOL wined3d_adapter_vk_init_format_info(struct wined3d_adapter_vk *adapter_vk,
         const struct wined3d_vk_info *vk_info);
+void wined3d_adapter_vk_update_memory_budget(struct wined3d_adapter_vk *adapter_vk);
 
 struct wined3d_null_resources_vk
 {
@@ -897,6 +920,7 @@ struct wined3d_device_vk
     struct wined3d_context_vk context_vk;
 
     VkDevice vk_device;
+    VkPipelineCache vk_pipeline_cache;
 
     struct wined3d_queue_vk
     {
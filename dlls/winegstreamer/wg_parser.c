@@ -96,6 +96,14 @@ struct wg_parser
     gchar *sink_caps;
 
     struct input_cache_chunk input_cache_chunks[4];
+
+    struct
+    {
+        GstBuffer *buffer;
+        guint64 position;
+        void *data;
+        bool pending;
+    } prefetch;
 };
 static const unsigned int input_cache_chunk_size = 512 << 10;
 
@@ -192,6 +200,14 @@ static NTSTATUS wg_parser_push_data(void *args)
 
     pthread_mutex_lock(&parser->mutex);
 
+    if (!parser->read_request.size)
+    {
+        /* The request was an abandoned read-ahead; the parser was disconnected
+         * while the read thread was servicing it. */
+        pthread_mutex_unlock(&parser->mutex);
+        return S_OK;
+    }
+
     if (data)
     {
         if (size)
@@ -1093,19 +1109,21 @@ static void pad_removed_cb(GstElement *element, GstPad *pad, gpointer user)
     g_free(name);
 }
 
-static GstFlowReturn issue_read_request(struct wg_parser *parser, guint64 offset, guint size, GstBuffer **buffer)
+/* Expose a read request to the read thread. Called with the mutex held. */
+static void start_read_request(struct wg_parser *parser, guint64 offset, guint size, GstBuffer *buffer)
 {
-    GstFlowReturn ret;
-
-    pthread_mutex_lock(&parser->mutex);
-
     assert(!parser->read_request.size);
-    parser->read_request.buffer = *buffer;
+    parser->read_request.buffer = buffer;
     parser->read_request.offset = offset;
     parser->read_request.size = size;
     parser->read_request.done = false;
     pthread_cond_signal(&parser->read_cond);
+}
 
+/* Wait for the read thread to service the current request. Called with the
+ * mutex held. */
+static GstFlowReturn finish_read_request(struct wg_parser *parser, GstBuffer **buffer)
+{
     /* Note that we don't unblock this wait on GST_EVENT_FLUSH_START. We expect
      * the upstream pin to flush if necessary. We should never be blocked on
      * read_thread() not running. */
@@ -1114,7 +1132,55 @@ static GstFlowReturn issue_read_request(struct wg_parser *parser, guint64 offset
         pthread_cond_wait(&parser->read_done_cond, &parser->mutex);
 
     *buffer = parser->read_request.buffer;
-    ret = parser->read_request.ret;
+    return parser->read_request.ret;
+}
+
+/* Complete a pending read-ahead request, and move the chunk into the input
+ * cache if the read succeeded. */
+static void complete_prefetch(struct wg_parser *parser)
+{
+    struct input_cache_chunk *chunk;
+    GstFlowReturn ret;
+
+    if (!parser->prefetch.pending)
+        return;
+
+    pthread_mutex_lock(&parser->mutex);
+    ret = finish_read_request(parser, &parser->prefetch.buffer);
+    pthread_mutex_unlock(&parser->mutex);
+
+    parser->prefetch.pending = false;
+    gst_buffer_unref(parser->prefetch.buffer);
+    parser->prefetch.buffer = NULL;
+
+    if (ret != GST_FLOW_OK)
+    {
+        GST_LOG("Read-ahead request returned %s.", gst_flow_get_name(ret));
+        free(parser->prefetch.data);
+        parser->prefetch.data = NULL;
+        return;
+    }
+
+    chunk = &parser->input_cache_chunks[ ARRAY_SIZE(parser->input_cache_chunks) - 1 ];
+    free(chunk->data);
+
+    memmove(&parser->input_cache_chunks[1], &parser->input_cache_chunks[0], (ARRAY_SIZE(parser->input_cache_chunks) - 1) * sizeof(*chunk));
+    parser->input_cache_chunks[0].data = parser->prefetch.data;
+    parser->input_cache_chunks[0].position = parser->prefetch.position;
+    parser->prefetch.data = NULL;
+}
+
+static GstFlowReturn issue_read_request(struct wg_parser *parser, guint64 offset, guint size, GstBuffer **buffer)
+{
+    GstFlowReturn ret;
+
+    /* There is only one request slot; drain any read-ahead first. */
+    complete_prefetch(parser);
+
+    pthread_mutex_lock(&parser->mutex);
+
+    start_read_request(parser, offset, size, *buffer);
+    ret = finish_read_request(parser, buffer);
 
     pthread_mutex_unlock(&parser->mutex);
 
@@ -1123,6 +1189,58 @@ static GstFlowReturn issue_read_request(struct wg_parser *parser, guint64 offset
     return ret;
 }
 
+/* Issue an asynchronous read for the given chunk, so that a sequentially
+ * reading demuxer doesn't stall on a round trip to the read thread for
+ * every chunk. */
+static void start_prefetch(struct wg_parser *parser, guint64 chunk_position)
+{
+    unsigned int i;
+    void *data;
+
+    if (parser->prefetch.pending)
+        return;
+
+    if (chunk_position + input_cache_chunk_size > parser->file_size)
+        return;
+
+    for (i = 0; i < ARRAY_SIZE(parser->input_cache_chunks); i++)
+    {
+        if (parser->input_cache_chunks[i].data && parser->input_cache_chunks[i].position == chunk_position)
+            return;
+    }
+
+    if (!(data = malloc(input_cache_chunk_size)))
+        return;
+
+    parser->prefetch.buffer = gst_buffer_new_wrapped_full(0, data, input_cache_chunk_size, 0, input_cache_chunk_size, NULL, NULL);
+    parser->prefetch.position = chunk_position;
+    parser->prefetch.data = data;
+    parser->prefetch.pending = true;
+
+    pthread_mutex_lock(&parser->mutex);
+    start_read_request(parser, chunk_position, input_cache_chunk_size, parser->prefetch.buffer);
+    pthread_mutex_unlock(&parser->mutex);
+}
+
+/* Discard a pending read-ahead request that the read thread will no longer
+ * service. Called after the parser has been disconnected. */
+static void discard_prefetch(struct wg_parser *parser)
+{
+    if (!parser->prefetch.pending)
+        return;
+
+    pthread_mutex_lock(&parser->mutex);
+    parser->read_request.buffer = NULL;
+    parser->read_request.size = 0;
+    pthread_mutex_unlock(&parser->mutex);
+
+    parser->prefetch.pending = false;
+    gst_buffer_unref(parser->prefetch.buffer);
+    parser->prefetch.buffer = NULL;
+    free(parser->prefetch.data);
+    parser->prefetch.data = NULL;
+}
+
 static struct input_cache_chunk * get_cache_entry(struct wg_parser *parser, guint64 position)
 {
     struct input_cache_chunk chunk;
@@ -1153,15 +1271,28 @@ static GstFlowReturn read_cached_chunk(struct wg_parser *parser, guint64 chunk_p
     GstBuffer *chunk_buffer;
     void *chunk_data;
     GstFlowReturn ret;
+    bool prefetched;
+
+    prefetched = parser->prefetch.pending && parser->prefetch.position == chunk_position;
+    if (prefetched)
+        complete_prefetch(parser);
 
     if ((chunk = get_cache_entry(parser, chunk_position)))
     {
+        /* Keep reading ahead while the demuxer stays sequential. */
+        if (prefetched)
+            start_prefetch(parser, chunk_position + input_cache_chunk_size);
+
         if (!!gst_buffer_fill(buffer, buffer_offset, chunk->data + chunk_offset, input_cache_chunk_size - chunk_offset))
             return GST_FLOW_OK;
         else
             return GST_FLOW_ERROR;
     }
 
+    /* Drain any unrelated read-ahead now; completing it below would reshuffle
+     * the cache after we have claimed the last entry. */
+    complete_prefetch(parser);
+
     chunk = &parser->input_cache_chunks[ ARRAY_SIZE(parser->input_cache_chunks) - 1 ];
 
     if (!(chunk_data = chunk->data))
@@ -1183,6 +1314,8 @@ static GstFlowReturn read_cached_chunk(struct wg_parser *parser, guint64 chunk_p
     parser->input_cache_chunks[0].position = chunk_position;
 
     chunk = &parser->input_cache_chunks[0];
+    start_prefetch(parser, chunk_position + input_cache_chunk_size);
+
     if (!!gst_buffer_fill(buffer, buffer_offset, chunk->data + chunk_offset, input_cache_chunk_size - chunk_offset))
         return GST_FLOW_OK;
     else
@@ -1779,6 +1912,8 @@ out:
     pthread_mutex_unlock(&parser->mutex);
     pthread_cond_signal(&parser->read_cond);
 
+    discard_prefetch(parser);
+
     return E_FAIL;
 }
 
@@ -1805,6 +1940,8 @@ static NTSTATUS wg_parser_disconnect(void *args)
     pthread_mutex_unlock(&parser->mutex);
     pthread_cond_signal(&parser->read_cond);
 
+    discard_prefetch(parser);
+
     for (i = 0; i < parser->stream_count; ++i)
         free_stream(parser->streams[i]);
 
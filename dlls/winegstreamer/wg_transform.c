@@ -290,7 +290,16 @@ static gboolean transform_sink_query_allocation(struct wg_transform *transform,
 
     mime_type = gst_structure_get_name(gst_caps_get_structure(caps, 0));
     if (strcmp(mime_type, "video/x-raw") || !needs_pool)
-        return false;
+    {
+        /* Elements which don't need a pool, and audio elements, allocate their
+         * output memory directly from the proposed allocator, which is enough
+         * to get zero-copy into the next provided output sample.
+         */
+        gst_query_add_allocation_param(query, transform->allocator, NULL);
+
+        GST_INFO("Proposing %"GST_PTR_FORMAT" for %"GST_PTR_FORMAT, transform->allocator, query);
+        return true;
+    }
 
     if (!(pool = wg_video_buffer_pool_create(caps, transform->attrs.output_plane_align,
             transform->allocator, &transform->output_info, &align)))
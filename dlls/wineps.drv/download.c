@@ -131,6 +131,68 @@ done:
         strcat(*str,vertical_suffix);
 }
 
+/****************************************************************************
+ *  Downloaded font data capture
+ *
+ *  The PostScript generated while downloading a font dictionary or glyph is
+ *  captured from the spool writes and kept on the DOWNLOAD entry, so later
+ *  pages can replay the bytes instead of re-running the conversion.
+ */
+void start_download_capture(print_ctx *ctx)
+{
+    assert(!ctx->capture);
+    ctx->capture = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*ctx->capture));
+}
+
+void abort_download_capture(print_ctx *ctx)
+{
+    if(!ctx->capture) return;
+    HeapFree(GetProcessHeap(), 0, ctx->capture->data);
+    HeapFree(GetProcessHeap(), 0, ctx->capture);
+    ctx->capture = NULL;
+}
+
+void end_download_capture(print_ctx *ctx, DOWNLOAD *pdl, DWORD index)
+{
+    DLCACHED *cached = ctx->capture;
+
+    if(!cached) return;
+    ctx->capture = NULL;
+    cached->index = index;
+    cached->next = pdl->cached;
+    pdl->cached = cached;
+}
+
+void capture_download_data(print_ctx *ctx, const void *data, DWORD len)
+{
+    DLCACHED *cached = ctx->capture;
+
+    if(cached->len + len > cached->max) {
+        DWORD max = max(cached->max ? cached->max * 2 : 4096, cached->len + len);
+        char *new_data = cached->data ? HeapReAlloc(GetProcessHeap(), 0, cached->data, max) :
+            HeapAlloc(GetProcessHeap(), 0, max);
+        if(!new_data) {
+            /* Carry on printing without caching this entry */
+            abort_download_capture(ctx);
+            return;
+        }
+        cached->data = new_data;
+        cached->max = max;
+    }
+    memcpy(cached->data + cached->len, data, len);
+    cached->len += len;
+}
+
+DLCACHED *find_cached_download(DOWNLOAD *pdl, DWORD index)
+{
+    DLCACHED *cached;
+
+    for(cached = pdl->cached; cached; cached = cached->next)
+        if(cached->index == index)
+            break;
+    return cached;
+}
+
 /****************************************************************************
  *  is_font_downloaded
  */
@@ -306,6 +368,7 @@ BOOL PSDRV_WriteSetDownloadFont(print_ctx *ctx, BOOL vertical)
 	strcpy(pdl->ps_name, ps_name);
 	pdl->next = NULL;
 
+        start_download_capture(ctx);
         if(ctx->pi->ppd->TTRasterizer == RO_Type42) {
 	    pdl->typeinfo.Type42 = T42_download_header(ctx, ps_name, &bbox, emsize);
 	    pdl->type = Type42;
@@ -314,6 +377,8 @@ BOOL PSDRV_WriteSetDownloadFont(print_ctx *ctx, BOOL vertical)
 	    pdl->typeinfo.Type1 = T1_download_header(ctx, ps_name, &bbox, emsize);
 	    pdl->type = Type1;
 	}
+	end_download_capture(ctx, pdl, DLCACHED_HEADER);
+	pdl->defined = TRUE;
 	pdl->next = ctx->downloaded_fonts;
 	ctx->downloaded_fonts = pdl;
 	ctx->font.fontinfo.Download = pdl;
@@ -324,6 +389,22 @@ BOOL PSDRV_WriteSetDownloadFont(print_ctx *ctx, BOOL vertical)
             T42_download_glyph(ctx, pdl, 0, g_name);
         }
     }
+    else if(!ctx->font.fontinfo.Download->defined) {
+        /* Re-send the cached definition, which the previous page's restore
+           has undone on the printer side */
+        DLCACHED *cached;
+
+        pdl = ctx->font.fontinfo.Download;
+        cached = find_cached_download(pdl, DLCACHED_HEADER);
+        PSDRV_WriteSpool(ctx, cached->data, cached->len);
+        pdl->defined = TRUE;
+
+        if(pdl->type == Type42) {
+            char g_name[MAX_G_NAME + 1];
+            get_glyph_name(ctx->hdc, 0, g_name);
+            T42_download_glyph(ctx, pdl, 0, g_name);
+        }
+    }
 
     if (vertical)
         lf.lfEscapement += 900;
@@ -769,7 +850,9 @@ BOOL PSDRV_EmptyDownloadList(print_ctx *ctx, BOOL write_undef)
     pdl = ctx->downloaded_fonts;
     ctx->downloaded_fonts = NULL;
     while(pdl) {
-        if(write_undef) {
+        DLCACHED *cached, *old_cached;
+
+        if(write_undef && pdl->defined) {
             sprintf(buf, undef, default_font, pdl->ps_name);
             PSDRV_WriteSpool(ctx, buf, strlen(buf));
         }
@@ -788,6 +871,14 @@ BOOL PSDRV_EmptyDownloadList(print_ctx *ctx, BOOL write_undef)
 	    assert(0);
 	}
 
+	cached = pdl->cached;
+	while(cached) {
+	    HeapFree(GetProcessHeap(), 0, cached->data);
+	    old_cached = cached;
+	    cached = cached->next;
+	    HeapFree(GetProcessHeap(), 0, old_cached);
+	}
+
 	HeapFree(GetProcessHeap(), 0, pdl->ps_name);
 	old = pdl;
 	pdl = pdl->next;
@@ -795,3 +886,69 @@ BOOL PSDRV_EmptyDownloadList(print_ctx *ctx, BOOL write_undef)
     }
     return TRUE;
 }
+
+/****************************************************************************
+ *  PSDRV_ResetDownloadList
+ *
+ *  Called at the end of a page.  The page's restore undefines every font on
+ *  the printer side, so mark the downloaded fonts as no longer defined and
+ *  forget which glyphs have been sent; the cached download data is kept so
+ *  that later pages can replay it.
+ */
+void PSDRV_ResetDownloadList(print_ctx *ctx)
+{
+    DOWNLOAD **pdl = &ctx->downloaded_fonts;
+
+    if(ctx->font.fontloc == Download) {
+        ctx->font.set = FALSE;
+	ctx->font.fontinfo.Download = NULL;
+    }
+
+    while(*pdl) {
+        DOWNLOAD *this = *pdl;
+
+        if(!find_cached_download(this, DLCACHED_HEADER)) {
+            DLCACHED *cached, *old_cached;
+
+            /* Caching the header failed, so the font can't be replayed;
+               drop it and download it again if a later page needs it */
+            *pdl = this->next;
+            this->next = NULL;
+            cached = this->cached;
+            while(cached) {
+                HeapFree(GetProcessHeap(), 0, cached->data);
+                old_cached = cached;
+                cached = cached->next;
+                HeapFree(GetProcessHeap(), 0, old_cached);
+            }
+            switch(this->type) {
+            case Type42:
+                T42_free(this->typeinfo.Type42);
+                break;
+            case Type1:
+                T1_free(this->typeinfo.Type1);
+                break;
+            default:
+                ERR("Type = %d\n", this->type);
+                assert(0);
+            }
+            HeapFree(GetProcessHeap(), 0, this->ps_name);
+            HeapFree(GetProcessHeap(), 0, this);
+            continue;
+        }
+
+        this->defined = FALSE;
+        switch(this->type) {
+        case Type42:
+            T42_reset(this->typeinfo.Type42);
+            break;
+        case Type1:
+            T1_reset(this->typeinfo.Type1);
+            break;
+        default:
+            ERR("Type = %d\n", this->type);
+            assert(0);
+        }
+        pdl = &this->next;
+    }
+}
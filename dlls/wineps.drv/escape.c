@@ -211,7 +211,7 @@ INT PSDRV_EndPage( print_ctx *ctx )
     passthrough_leave(ctx);
     if(!PSDRV_WriteEndPage( ctx ))
         return 0;
-    PSDRV_EmptyDownloadList(ctx, FALSE);
+    PSDRV_ResetDownloadList(ctx);
     ctx->job.OutOfPage = TRUE;
     return 1;
 }
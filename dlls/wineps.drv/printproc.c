@@ -3187,6 +3187,7 @@ BOOL WINAPI ClosePrintProcessor(HANDLE pp)
     free(data->port);
     free(data->doc_name);
     free(data->out_file);
+    PSDRV_EmptyDownloadList(data->ctx, FALSE);
     DeleteDC(data->ctx->hdc);
     HeapFree(GetProcessHeap(), 0, data->ctx->Devmode);
     HeapFree(GetProcessHeap(), 0, data->ctx);
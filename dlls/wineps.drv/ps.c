@@ -252,6 +252,9 @@ DWORD PSDRV_WriteSpool(print_ctx *ctx, LPCSTR lpData, DWORD cch)
 	    return 0;
     }
 
+    if(ctx->capture)
+        capture_download_data(ctx, lpData, cch);
+
     do {
         num = min(num_left, 0x8000);
         if(write_spool( ctx, lpData, num ) != num)
@@ -267,6 +267,20 @@ enum downloadtype {
   Type1, Type42
 };
 
+/* Generated download PostScript kept for the whole job.  The printer-side
+   definitions are rolled back by the per-page save/restore, so fonts have to
+   be re-sent on every page that uses them; the generated bytes only depend
+   on the font, so they are captured once and replayed on later pages. */
+#define DLCACHED_HEADER (~0u)
+
+typedef struct _tagDLCACHED {
+  DWORD index;       /* glyph index, or DLCACHED_HEADER for the font dictionary */
+  char *data;
+  DWORD len;
+  DWORD max;
+  struct _tagDLCACHED *next;
+} DLCACHED;
+
 typedef struct _tagDOWNLOAD {
   enum downloadtype type;
   union {
@@ -274,6 +288,8 @@ typedef struct _tagDOWNLOAD {
     TYPE42 *Type42;
   } typeinfo;
   char *ps_name;
+  BOOL defined;      /* definition sent on the current page */
+  DLCACHED *cached;
   struct _tagDOWNLOAD *next;
 } DOWNLOAD;
 
@@ -343,6 +359,7 @@ typedef struct
     HDC                 hdc;
     PSFONT		font;		/* Current PS font */
     DOWNLOAD            *downloaded_fonts;
+    DLCACHED            *capture;       /* download data being captured from spool writes */
     PSPEN		pen;
     PSBRUSH		brush;
     PSCOLOR		bkColor;
@@ -493,6 +510,13 @@ extern BOOL PSDRV_WriteBuiltinGlyphShow(print_ctx *ctx, LPCWSTR str, INT count);
 extern BOOL PSDRV_WriteSetDownloadFont(print_ctx *ctx, BOOL vertical);
 extern BOOL PSDRV_WriteDownloadGlyphShow(print_ctx *ctx, const WORD *glyphs, UINT count);
 extern BOOL PSDRV_EmptyDownloadList(print_ctx *ctx, BOOL write_undef);
+extern void PSDRV_ResetDownloadList(print_ctx *ctx);
+
+extern void start_download_capture(print_ctx *ctx);
+extern void abort_download_capture(print_ctx *ctx);
+extern void end_download_capture(print_ctx *ctx, DOWNLOAD *pdl, DWORD index);
+extern void capture_download_data(print_ctx *ctx, const void *data, DWORD len);
+extern DLCACHED *find_cached_download(DOWNLOAD *pdl, DWORD index);
 
 extern BOOL flush_spool(print_ctx *ctx);
 extern DWORD write_spool(print_ctx *ctx, const void *data, DWORD num);
@@ -504,12 +528,14 @@ extern TYPE1 *T1_download_header(print_ctx *ctx, char *ps_name,
                                  RECT *bbox, UINT emsize);
 extern BOOL T1_download_glyph(print_ctx *ctx, DOWNLOAD *pdl,
 			      DWORD index, char *glyph_name);
+extern void T1_reset(TYPE1 *t1);
 extern void T1_free(TYPE1 *t1);
 
 extern TYPE42 *T42_download_header(print_ctx *ctx, char *ps_name,
                                    RECT *bbox, UINT emsize);
 extern BOOL T42_download_glyph(print_ctx *ctx, DOWNLOAD *pdl,
 			       DWORD index, char *glyph_name);
+extern void T42_reset(TYPE42 *t42);
 extern void T42_free(TYPE42 *t42);
 
 extern DWORD RLE_encode(BYTE *in_buf, DWORD len, BYTE *out_buf);
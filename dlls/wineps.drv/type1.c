@@ -540,6 +540,7 @@ BOOL T1_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index, char *glyph_n
     BYTE *bytes;
     POINT curpos;
     glyph_outline outline;
+    DLCACHED *cached;
 
     static const char glyph_def_begin[] =
       "/%s findfont dup\n"
@@ -564,6 +565,12 @@ BOOL T1_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index, char *glyph_n
 				      t1->glyph_sent_size * sizeof(*(t1->glyph_sent)));
     }
 
+    if((cached = find_cached_download(pdl, index))) {
+        PSDRV_WriteSpool(ctx, cached->data, cached->len);
+        t1->glyph_sent[index] = TRUE;
+        return TRUE;
+    }
+
     outline.num_conts = 0;
     outline.flags = NULL;
     outline.end_pts = NULL;
@@ -649,6 +656,8 @@ BOOL T1_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index, char *glyph_n
     buf = HeapAlloc(GetProcessHeap(), 0, sizeof(glyph_def_begin) +
 		    strlen(pdl->ps_name) + strlen(glyph_name) + 100);
 
+    start_download_capture(ctx);
+
     sprintf(buf, "%%%%glyph %04lx\n", index);
     PSDRV_WriteSpool(ctx, buf, strlen(buf));
 
@@ -660,11 +669,18 @@ BOOL T1_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index, char *glyph_n
     PSDRV_WriteSpool(ctx, buf, strlen(buf));
     str_free(charstring);
 
+    end_download_capture(ctx, pdl, index);
+
     t1->glyph_sent[index] = TRUE;
     HeapFree(GetProcessHeap(), 0, buf);
     return TRUE;
 }
 
+void T1_reset(TYPE1 *t1)
+{
+    memset(t1->glyph_sent, 0, t1->glyph_sent_size * sizeof(*(t1->glyph_sent)));
+}
+
 void T1_free(TYPE1 *t1)
 {
     HeapFree(GetProcessHeap(), 0, t1->glyph_sent);
@@ -285,6 +285,7 @@ BOOL T42_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index,
     DWORD start, end, i;
     char *buf;
     TYPE42 *t42;
+    DLCACHED *cached;
 
     static const char glyph_def[] =
       "/%s findfont exch 1 index\n"
@@ -342,6 +343,14 @@ BOOL T42_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index,
 	} while(sg_flags & MORE_COMPONENTS);
     }
 
+    if((cached = find_cached_download(pdl, index))) {
+        PSDRV_WriteSpool(ctx, cached->data, cached->len);
+        t42->glyph_sent[index] = TRUE;
+        return TRUE;
+    }
+
+    start_download_capture(ctx);
+
     for(i = 1; t42->glyf_blocks[i]; i++)
         if(start < t42->glyf_blocks[i]) break;
 
@@ -364,11 +373,18 @@ BOOL T42_download_glyph(print_ctx *ctx, DOWNLOAD *pdl, DWORD index,
     sprintf(buf, glyph_def, pdl->ps_name, index, glyph_name, index);
     PSDRV_WriteSpool(ctx, buf, strlen(buf));
 
+    end_download_capture(ctx, pdl, index);
+
     t42->glyph_sent[index] = TRUE;
     HeapFree(GetProcessHeap(), 0, buf);
     return TRUE;
 }
 
+void T42_reset(TYPE42 *t42)
+{
+    memset(t42->glyph_sent, 0, t42->glyph_sent_size * sizeof(*(t42->glyph_sent)));
+}
+
 void T42_free(TYPE42 *t42)
 {
     OTTable *table;
@@ -757,7 +757,16 @@ static void pulse_probe_settings(int render, const char *pulse_name, WAVEFORMATE
         pa_stream_unref(stream);
 
     if (length)
-        *def_period = *min_period = pa_bytes_to_usec(10 * length, &ss);
+    {
+        *def_period = pa_bytes_to_usec(10 * length, &ss);
+        /* The server request size reflects its preferred fragment size, not a
+         * hard limit; with PA_STREAM_ADJUST_LATENCY the buffer attributes are
+         * renegotiated from whatever period the stream is created with, and
+         * our timer thread can drive periods well below the preferred size.
+         * Report a minimum of 5 ms so that low-latency clients can negotiate
+         * smaller periods through IAudioClient3. */
+        *min_period = min(*def_period, 50000);
+    }
 
     wfx->wFormatTag = WAVE_FORMAT_EXTENSIBLE;
     wfx->cbSize = sizeof(WAVEFORMATEXTENSIBLE) - sizeof(WAVEFORMATEX);
@@ -168,12 +168,16 @@ struct conversion_context
 {
     char buffer[2048];
     uint32_t used;
+    char *overflow;
+    uint32_t overflow_size, overflow_used;
     struct list alloc_entries;
 };
 
 static inline void init_conversion_context(struct conversion_context *pool)
 {
     pool->used = 0;
+    pool->overflow = NULL;
+    pool->overflow_size = pool->overflow_used = 0;
     list_init(&pool->alloc_entries);
 }
 
@@ -186,20 +190,37 @@ static inline void free_conversion_context(struct conversion_context *pool)
 
 static inline void *conversion_context_alloc(struct conversion_context *pool, size_t size)
 {
+    size_t aligned = (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
+    void *ret;
+
     if (pool->used + size <= sizeof(pool->buffer))
     {
-        void *ret = pool->buffer + pool->used;
-        pool->used += (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
+        ret = pool->buffer + pool->used;
+        pool->used += aligned;
         return ret;
     }
-    else
+
+    /* Grow the pool in exponentially larger blocks rather than making one
+     * allocation per conversion; converting a large struct array would
+     * otherwise cause a heap call for every element. */
+    if (pool->overflow_used + size > pool->overflow_size)
     {
+        size_t block_size = max(pool->overflow_size * 2, sizeof(pool->buffer) * 2);
         struct list *entry;
-        if (!(entry = malloc(sizeof(*entry) + size)))
+
+        while (block_size < size)
+            block_size *= 2;
+        if (!(entry = malloc(sizeof(*entry) + block_size)))
             return NULL;
         list_add_tail(&pool->alloc_entries, entry);
-        return entry + 1;
+        pool->overflow = (char *)(entry + 1);
+        pool->overflow_size = block_size;
+        pool->overflow_used = 0;
     }
+
+    ret = pool->overflow + pool->overflow_used;
+    pool->overflow_used += aligned;
+    return ret;
 }
 
 struct wine_deferred_operation
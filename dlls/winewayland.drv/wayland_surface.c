@@ -1008,7 +1008,7 @@ BOOL wayland_client_surface_release(struct wayland_client_surface *client)
 struct wayland_client_surface *wayland_client_surface_create(HWND hwnd)
 {
     struct wayland_client_surface *client;
-    struct wl_region *empty_region;
+    struct wl_region *empty_region, *opaque_region;
 
     if (!(client = calloc(1, sizeof(*client))))
     {
@@ -1037,6 +1037,20 @@ struct wayland_client_surface *wayland_client_surface_create(HWND hwnd)
     wl_surface_set_input_region(client->wl_surface, empty_region);
     wl_region_destroy(empty_region);
 
+    /* Client area contents are always presented opaque, let the compositor
+     * know so that it can cull occluded surfaces and consider fullscreen
+     * content for direct scanout even with an alpha-capable buffer format.
+     * The opaque region is clipped to the surface extents, so it doesn't
+     * need to track resizes. */
+    opaque_region = wl_compositor_create_region(process_wayland.wl_compositor);
+    if (opaque_region)
+    {
+        wl_region_add(opaque_region, 0, 0, INT32_MAX, INT32_MAX);
+        wl_surface_set_opaque_region(client->wl_surface, opaque_region);
+        wl_region_destroy(opaque_region);
+    }
+    else WARN("Failed to create opaque wl_region\n");
+
     client->wp_viewport =
         wp_viewporter_get_viewport(process_wayland.wp_viewporter,
                                     client->wl_surface);
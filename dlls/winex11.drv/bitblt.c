@@ -1309,6 +1309,131 @@ update_format:
     return ERROR_BAD_FORMAT;
 }
 
+#ifdef HAVE_X11_EXTENSIONS_XSHM_H
+typedef XShmSegmentInfo x11drv_xshm_info_t;
+#else
+typedef struct { int shmid; } x11drv_xshm_info_t;
+#endif
+
+#ifdef HAVE_LIBXXSHM
+static int xshm_error_handler( Display *display, XErrorEvent *event, void *arg )
+{
+    return 1;  /* FIXME: should check event contents */
+}
+
+static XImage *create_shm_image( const XVisualInfo *vis, int width, int height,
+                                 BOOL readonly, x11drv_xshm_info_t *shminfo )
+{
+    XImage *image;
+
+    shminfo->shmid = -1;
+    image = XShmCreateImage( gdi_display, vis->visual, vis->depth, ZPixmap, NULL, shminfo, width, height );
+    if (!image) return NULL;
+    if (image->bytes_per_line & 3) goto failed;  /* we need 32-bit alignment */
+
+    shminfo->shmid = shmget( IPC_PRIVATE, image->bytes_per_line * height, IPC_CREAT | 0700 );
+    if (shminfo->shmid == -1) goto failed;
+
+    shminfo->shmaddr = shmat( shminfo->shmid, 0, 0 );
+    if (shminfo->shmaddr != (char *)-1)
+    {
+        BOOL ok;
+
+        shminfo->readOnly = readonly;
+        X11DRV_expect_error( gdi_display, xshm_error_handler, NULL );
+        ok = (XShmAttach( gdi_display, shminfo ) != 0);
+        XSync( gdi_display, False );
+        if (!X11DRV_check_error() && ok)
+        {
+            image->data = shminfo->shmaddr;
+            shmctl( shminfo->shmid, IPC_RMID, 0 );
+            return image;
+        }
+        shmdt( shminfo->shmaddr );
+    }
+    shmctl( shminfo->shmid, IPC_RMID, 0 );
+    shminfo->shmid = -1;
+
+failed:
+    XDestroyImage( image );
+    return NULL;
+}
+
+static BOOL destroy_shm_image( XImage *image, x11drv_xshm_info_t *shminfo )
+{
+    if (shminfo->shmid == -1) return FALSE;
+
+    XShmDetach( gdi_display, shminfo );
+    shmdt( shminfo->shmaddr );
+
+    return TRUE;
+}
+
+static BOOL put_shm_image( XImage *image, x11drv_xshm_info_t *shminfo, Window window,
+                           GC gc, const RECT *rect, const RECT *dirty )
+{
+    if (shminfo->shmid == -1) return FALSE;
+
+    XShmPutImage( gdi_display, window, gc, image, dirty->left,
+                  dirty->top, rect->left + dirty->left, rect->top + dirty->top,
+                  dirty->right - dirty->left, dirty->bottom - dirty->top, False );
+
+    return TRUE;
+}
+
+/* read a drawable through a shared memory segment, avoiding the X transport copy */
+static XImage *get_shm_image( Drawable drawable, int x, int y, int width, int height,
+                              const XVisualInfo *vis, x11drv_xshm_info_t *shminfo )
+{
+    const XPixmapFormatValues *format = pixmap_formats[vis->depth];
+    XImage *image;
+
+    /* attaching a segment costs server round-trips, only worthwhile for large reads */
+    if (!format || (unsigned int)width * height * format->bits_per_pixel < 8 * 65536)
+        return NULL;
+
+    if (!(image = create_shm_image( vis, width, height, FALSE, shminfo ))) return NULL;
+
+    X11DRV_expect_error( gdi_display, XGetImage_handler, NULL );
+    if (!XShmGetImage( gdi_display, drawable, image, x, y, AllPlanes ) || X11DRV_check_error())
+    {
+        destroy_shm_image( image, shminfo );
+        image->data = NULL;
+        XDestroyImage( image );
+        return NULL;
+    }
+    return image;
+}
+
+#else /* HAVE_LIBXXSHM */
+
+static XImage *create_shm_image( const XVisualInfo *vis, int width, int height,
+                                 BOOL readonly, x11drv_xshm_info_t *shminfo )
+{
+    shminfo->shmid = -1;
+    return NULL;
+}
+
+static BOOL destroy_shm_image( XImage *image, x11drv_xshm_info_t *shminfo )
+{
+    return FALSE;
+}
+
+static BOOL put_shm_image( XImage *image, x11drv_xshm_info_t *shminfo, Window window,
+                           GC gc, const RECT *rect, const RECT *dirty )
+{
+    return FALSE;
+}
+
+static XImage *get_shm_image( Drawable drawable, int x, int y, int width, int height,
+                              const XVisualInfo *vis, x11drv_xshm_info_t *shminfo )
+{
+    shminfo->shmid = -1;
+    return NULL;
+}
+
+#endif /* HAVE_LIBXXSHM */
+
 /***********************************************************************
  *           X11DRV_GetImage
  */
@@ -1323,6 +1448,8 @@ DWORD X11DRV_GetImage( PHYSDEV dev, BITMAPINFO *info,
     struct gdi_image_bits src_bits;
     const XPixmapFormatValues *format;
     const int *mapping = NULL;
+    x11drv_xshm_info_t shminfo;
+    BOOL is_shm;
 
     vis.depth = physdev->depth;
     if (physdev->color_shifts)
@@ -1367,22 +1494,27 @@ DWORD X11DRV_GetImage( PHYSDEV dev, BITMAPINFO *info,
     src->y -= y;
     OffsetRect( &src->visrect, -x, -y );
 
-    X11DRV_expect_error( gdi_display, XGetImage_handler, NULL );
-    image = XGetImage( gdi_display, physdev->drawable,
-                       physdev->dc_rect.left + x, physdev->dc_rect.top + y,
-                       width, height, AllPlanes, ZPixmap );
-    if (X11DRV_check_error())
+    image = get_shm_image( physdev->drawable, physdev->dc_rect.left + x, physdev->dc_rect.top + y,
+                           width, height, &vis, &shminfo );
+    if (!(is_shm = image != NULL))
     {
-        /* use a temporary pixmap to avoid the BadMatch error */
-        Pixmap pixmap = XCreatePixmap( gdi_display, root_window, width, height, vis.depth );
-        GC gc = XCreateGC( gdi_display, pixmap, 0, NULL );
+        X11DRV_expect_error( gdi_display, XGetImage_handler, NULL );
+        image = XGetImage( gdi_display, physdev->drawable,
+                           physdev->dc_rect.left + x, physdev->dc_rect.top + y,
+                           width, height, AllPlanes, ZPixmap );
+        if (X11DRV_check_error())
+        {
+            /* use a temporary pixmap to avoid the BadMatch error */
+            Pixmap pixmap = XCreatePixmap( gdi_display, root_window, width, height, vis.depth );
+            GC gc = XCreateGC( gdi_display, pixmap, 0, NULL );
 
-        XSetGraphicsExposures( gdi_display, gc, False );
-        XCopyArea( gdi_display, physdev->drawable, pixmap, gc,
-                   physdev->dc_rect.left + x, physdev->dc_rect.top + y, width, height, 0, 0 );
-        image = XGetImage( gdi_display, pixmap, 0, 0, width, height, AllPlanes, ZPixmap );
-        XFreePixmap( gdi_display, pixmap );
-        XFreeGC( gdi_display, gc );
+            XSetGraphicsExposures( gdi_display, gc, False );
+            XCopyArea( gdi_display, physdev->drawable, pixmap, gc,
+                       physdev->dc_rect.left + x, physdev->dc_rect.top + y, width, height, 0, 0 );
+            image = XGetImage( gdi_display, pixmap, 0, 0, width, height, AllPlanes, ZPixmap );
+            XFreePixmap( gdi_display, pixmap );
+            XFreeGC( gdi_display, gc );
+        }
     }
 
     if (!image) return ERROR_OUTOFMEMORY;
@@ -1392,15 +1524,30 @@ DWORD X11DRV_GetImage( PHYSDEV dev, BITMAPINFO *info,
     info->bmiHeader.biSizeImage = height * image->bytes_per_line;
 
     src_bits.ptr     = image->data;
-    src_bits.is_copy = TRUE;
+    src_bits.is_copy = !is_shm;  /* shared segment data can't be handed out or modified in place */
     ret = copy_image_bits( info, is_r8g8b8(&vis), image, &src_bits, bits, src, mapping,
                            zeropad_masks[(width * image->bits_per_pixel) & 31] );
 
     if (!ret && bits->ptr == image->data)
     {
-        bits->free = free_ximage_bits;
-        image->data = NULL;
+        if (is_shm)
+        {
+            /* the bits live in the shared segment, hand the caller a copy */
+            if ((bits->ptr = malloc( info->bmiHeader.biSizeImage )))
+            {
+                memcpy( bits->ptr, image->data, info->bmiHeader.biSizeImage );
+                bits->is_copy = TRUE;
+                bits->free = free_heap_bits;
+            }
+            else ret = ERROR_OUTOFMEMORY;
+        }
+        else
+        {
+            bits->free = free_ximage_bits;
+            image->data = NULL;
+        }
     }
+    if (is_shm && destroy_shm_image( image, &shminfo )) image->data = NULL;
     XDestroyImage( image );
     return ret;
 }
@@ -1530,6 +1677,8 @@ DWORD get_pixmap_image( Pixmap pixmap, int width, int height, const XVisualInfo
     struct bitblt_coords coords;
     const XPixmapFormatValues *format = pixmap_formats[vis->depth];
     const int *mapping = NULL;
+    x11drv_xshm_info_t shminfo;
+    BOOL is_shm;
 
     if (!format) return ERROR_INVALID_PARAMETER;
 
@@ -1551,31 +1700,42 @@ DWORD get_pixmap_image( Pixmap pixmap, int width, int height, const XVisualInfo
     coords.height = height;
     SetRect( &coords.visrect, 0, 0, width, height );
 
-    image = XGetImage( gdi_display, pixmap, 0, 0, width, height, AllPlanes, ZPixmap );
+    image = get_shm_image( pixmap, 0, 0, width, height, vis, &shminfo );
+    if (!(is_shm = image != NULL))
+        image = XGetImage( gdi_display, pixmap, 0, 0, width, height, AllPlanes, ZPixmap );
     if (!image) return ERROR_OUTOFMEMORY;
 
     info->bmiHeader.biSizeImage = height * image->bytes_per_line;
 
     src_bits.ptr     = image->data;
-    src_bits.is_copy = TRUE;
+    src_bits.is_copy = !is_shm;  /* shared segment data can't be handed out or modified in place */
     ret = copy_image_bits( info, is_r8g8b8(vis), image, &src_bits, bits, &coords, mapping,
                            zeropad_masks[(width * image->bits_per_pixel) & 31] );
 
     if (!ret && bits->ptr == image->data)
     {
-        bits->free = free_ximage_bits;
-        image->data = NULL;
+        if (is_shm)
+        {
+            /* the bits live in the shared segment, hand the caller a copy */
+            if ((bits->ptr = malloc( info->bmiHeader.biSizeImage )))
+            {
+                memcpy( bits->ptr, image->data, info->bmiHeader.biSizeImage );
+                bits->is_copy = TRUE;
+                bits->free = free_heap_bits;
+            }
+            else ret = ERROR_OUTOFMEMORY;
+        }
+        else
+        {
+            bits->free = free_ximage_bits;
+            image->data = NULL;
+        }
     }
+    if (is_shm && destroy_shm_image( image, &shminfo )) image->data = NULL;
     XDestroyImage( image );
     return ret;
 }
 
-#ifdef HAVE_X11_EXTENSIONS_XSHM_H
-typedef XShmSegmentInfo x11drv_xshm_info_t;
-#else
-typedef struct { int shmid; } x11drv_xshm_info_t;
-#endif
-
 struct x11drv_image
 {
     XImage               *ximage;    /* XImage used for X11 drawing */
@@ -1596,92 +1756,6 @@ static struct x11drv_window_surface *get_x11_surface( struct window_surface *sur
     return (struct x11drv_window_surface *)surface;
 }
 
-#ifdef HAVE_LIBXXSHM
-static int xshm_error_handler( Display *display, XErrorEvent *event, void *arg )
-{
-    return 1;  /* FIXME: should check event contents */
-}
-
-static XImage *create_shm_image( const XVisualInfo *vis, int width, int height, x11drv_xshm_info_t *shminfo )
-{
-    XImage *image;
-
-    shminfo->shmid = -1;
-    image = XShmCreateImage( gdi_display, vis->visual, vis->depth, ZPixmap, NULL, shminfo, width, height );
-    if (!image) return NULL;
-    if (image->bytes_per_line & 3) goto failed;  /* we need 32-bit alignment */
-
-    shminfo->shmid = shmget( IPC_PRIVATE, image->bytes_per_line * height, IPC_CREAT | 0700 );
-    if (shminfo->shmid == -1) goto failed;
-
-    shminfo->shmaddr = shmat( shminfo->shmid, 0, 0 );
-    if (shminfo->shmaddr != (char *)-1)
-    {
-        BOOL ok;
-
-        shminfo->readOnly = True;
-        X11DRV_expect_error( gdi_display, xshm_error_handler, NULL );
-        ok = (XShmAttach( gdi_display, shminfo ) != 0);
-        XSync( gdi_display, False );
-        if (!X11DRV_check_error() && ok)
-        {
-            image->data = shminfo->shmaddr;
-            shmctl( shminfo->shmid, IPC_RMID, 0 );
-            return image;
-        }
-        shmdt( shminfo->shmaddr );
-    }
-    shmctl( shminfo->shmid, IPC_RMID, 0 );
-    shminfo->shmid = -1;
-
-failed:
-    XDestroyImage( image );
-    return NULL;
-}
-
-static BOOL destroy_shm_image( XImage *image, x11drv_xshm_info_t *shminfo )
-{
-    if (shminfo->shmid == -1) return FALSE;
-
-    XShmDetach( gdi_display, shminfo );
-    shmdt( shminfo->shmaddr );
-
-    return TRUE;
-}
-
-static BOOL put_shm_image( XImage *image, x11drv_xshm_info_t *shminfo, Window window,
-                           GC gc, const RECT *rect, const RECT *dirty )
-{
-    if (shminfo->shmid == -1) return FALSE;
-
-    XShmPutImage( gdi_display, window, gc, image, dirty->left,
-                  dirty->top, rect->left + dirty->left, rect->top + dirty->top,
-                  dirty->right - dirty->left, dirty->bottom - dirty->top, False );
-
-    return TRUE;
-}
-
-#else /* HAVE_LIBXXSHM */
-
-static XImage *create_shm_image( const XVisualInfo *vis, int width, int height, x11drv_xshm_info_t *shminfo )
-{
-    shminfo->shmid = -1;
-    return NULL;
-}
-
-static BOOL destroy_shm_image( XImage *image, x11drv_xshm_info_t *shminfo )
-{
-    return FALSE;
-}
-
-static BOOL put_shm_image( XImage *image, x11drv_xshm_info_t *shminfo, Window window,
-                           GC gc, const RECT *rect, const RECT *dirty )
-{
-    return FALSE;
-}
-
-#endif /* HAVE_LIBXXSHM */
-
 static UINT get_dib_d3dddifmt( const BITMAPINFO *info )
 {
     if (info->bmiHeader.biCompression == BI_RGB)
@@ -1734,7 +1808,7 @@ static struct x11drv_image *x11drv_image_create( const BITMAPINFO *info, const X
 
     if (!(image = calloc( 1, sizeof(*image) ))) return NULL;
 
-    if (!(image->ximage = create_shm_image( vis, width, height, &image->shminfo )))
+    if (!(image->ximage = create_shm_image( vis, width, height, TRUE, &image->shminfo )))
     {
         if (!(image->ximage = XCreateImage( gdi_display, vis->visual, vis->depth, ZPixmap,
                                             0, NULL, width, height, 32, 0 ))) goto failed;
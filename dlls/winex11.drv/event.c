@@ -541,6 +541,13 @@ static BOOL process_events( Display *display, Bool (*filter)(Display*, XEvent*,X
 
 /***********************************************************************
  *           ProcessEvents   (X11DRV.@)
+ *
+ * Events are processed on the win32 thread that owns the windows they
+ * target: each thread drains its own X connection, and the handlers call
+ * thread-affine NtUser entry points.  Draining the connection from a
+ * dedicated thread and handing events over would still have to wait for
+ * the owning thread to re-enter the message loop, so it would add a
+ * hand-off without removing the latency.
  */
 BOOL X11DRV_ProcessEvents( DWORD mask )
 {
@@ -225,6 +225,9 @@ struct gl_drawable
     Pixmap                         pixmap;       /* base pixmap if drawable is a GLXPixmap */
     const struct glx_pixel_format *format;       /* pixel format for the drawable */
     int                            swap_interval;
+    INT64                          ust;          /* timing of the last presented frame, from GLX_OML_sync_control */
+    INT64                          msc;
+    INT64                          sbc;
     HDC                            hdc_src;
     HDC                            hdc_dst;
 };
@@ -1894,7 +1897,7 @@ static BOOL x11drv_swap_buffers( void *private, HWND hwnd, HDC hdc, int interval
 {
     struct gl_drawable *gl;
     struct x11drv_context *ctx = private;
-    INT64 ust, msc, sbc, target_sbc = 0;
+    INT64 ust, msc, sbc, target_sbc = 0, target_msc = 0;
     Drawable drawable = 0;
 
     TRACE("(%p)\n", hdc);
@@ -1909,6 +1912,10 @@ static BOOL x11drv_swap_buffers( void *private, HWND hwnd, HDC hdc, int interval
     set_swap_interval( gl, interval );
     pthread_mutex_unlock( &context_mutex );
 
+    /* Offscreen drawables are not throttled by the server, pace them explicitly
+     * from the vblank count of the last frame we know to have been presented. */
+    if (interval > 0 && gl->type != DC_GL_WINDOW && gl->msc) target_msc = gl->msc + interval;
+
     switch (gl->type)
     {
     case DC_GL_PIXMAP_WIN:
@@ -1926,7 +1933,7 @@ static BOOL x11drv_swap_buffers( void *private, HWND hwnd, HDC hdc, int interval
         if (ctx && pglXSwapBuffersMscOML)
         {
             funcs->p_glFlush();
-            target_sbc = pglXSwapBuffersMscOML( gdi_display, gl->drawable, 0, 0, 0 );
+            target_sbc = pglXSwapBuffersMscOML( gdi_display, gl->drawable, target_msc, 0, 0 );
             break;
         }
         pglXSwapBuffers(gdi_display, gl->drawable);
@@ -1940,15 +1947,22 @@ static BOOL x11drv_swap_buffers( void *private, HWND hwnd, HDC hdc, int interval
         if (ctx && drawable && pglXSwapBuffersMscOML)
         {
             funcs->p_glFlush();
-            target_sbc = pglXSwapBuffersMscOML( gdi_display, gl->drawable, 0, 0, 0 );
+            target_sbc = pglXSwapBuffersMscOML( gdi_display, gl->drawable, target_msc, 0, 0 );
             break;
         }
         pglXSwapBuffers(gdi_display, gl->drawable);
         break;
     }
 
-    if (ctx && drawable && pglXWaitForSbcOML)
-        pglXWaitForSbcOML( gdi_display, gl->drawable, target_sbc, &ust, &msc, &sbc );
+    if (ctx && drawable && pglXWaitForSbcOML &&
+        pglXWaitForSbcOML( gdi_display, gl->drawable, target_sbc, &ust, &msc, &sbc ))
+    {
+        TRACE( "drawable %lx sbc %s presented at ust %s msc %s\n", gl->drawable,
+               wine_dbgstr_longlong(sbc), wine_dbgstr_longlong(ust), wine_dbgstr_longlong(msc) );
+        gl->ust = ust;
+        gl->msc = msc;
+        gl->sbc = sbc;
+    }
 
     present_gl_drawable( hwnd, ctx ? ctx->hdc : hdc, gl, !pglXWaitForSbcOML, FALSE );
     update_gl_drawable_size( gl );
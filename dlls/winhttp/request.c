@@ -36,6 +36,8 @@
 #include "ntsecapi.h"
 #include "winternl.h"
 
+#include <zlib.h>
+
 #include "wine/debug.h"
 #include "winhttp_private.h"
 
@@ -1529,29 +1531,21 @@ static DWORD map_secure_protocols( DWORD mask )
     return ret;
 }
 
-static DWORD ensure_cred_handle( struct request *request )
+static DWORD acquire_cred_handle( const CERT_CONTEXT *client_cert, DWORD protocols, CredHandle *cred_handle )
 {
-    SECURITY_STATUS status = SEC_E_OK;
-
-    if (request->cred_handle_initialized) return ERROR_SUCCESS;
+    SECURITY_STATUS status;
+    SCHANNEL_CRED cred;
 
-    if (!request->cred_handle_initialized)
+    memset( &cred, 0, sizeof(cred) );
+    cred.dwVersion             = SCHANNEL_CRED_VERSION;
+    cred.grbitEnabledProtocols = protocols;
+    if (client_cert)
     {
-        SCHANNEL_CRED cred;
-        memset( &cred, 0, sizeof(cred) );
-        cred.dwVersion             = SCHANNEL_CRED_VERSION;
-        cred.grbitEnabledProtocols = map_secure_protocols( request->connect->session->secure_protocols );
-        if (request->client_cert)
-        {
-            cred.paCred = &request->client_cert;
-            cred.cCreds = 1;
-        }
-        status = AcquireCredentialsHandleW( NULL, (WCHAR *)UNISP_NAME_W, SECPKG_CRED_OUTBOUND, NULL,
-                                            &cred, NULL, NULL, &request->cred_handle, NULL );
-        if (status == SEC_E_OK)
-            request->cred_handle_initialized = TRUE;
+        cred.paCred = &client_cert;
+        cred.cCreds = 1;
     }
-
+    status = AcquireCredentialsHandleW( NULL, (WCHAR *)UNISP_NAME_W, SECPKG_CRED_OUTBOUND, NULL,
+                                        &cred, NULL, NULL, cred_handle, NULL );
     if (status != SEC_E_OK)
     {
         WARN( "AcquireCredentialsHandleW failed: %#lx\n", status );
@@ -1560,6 +1554,40 @@ static DWORD ensure_cred_handle( struct request *request )
     return ERROR_SUCCESS;
 }
 
+/* Requests without a client certificate share one credential handle per
+ * session, so schannel can resume TLS sessions across connections instead of
+ * performing a full handshake for each one. */
+static DWORD ensure_cred_handle( struct request *request, CredHandle **cred_handle )
+{
+    struct session *session = request->connect->session;
+    DWORD ret = ERROR_SUCCESS, protocols = map_secure_protocols( session->secure_protocols );
+
+    if (request->client_cert)
+    {
+        if (!request->cred_handle_initialized &&
+            !(ret = acquire_cred_handle( request->client_cert, protocols, &request->cred_handle )))
+            request->cred_handle_initialized = TRUE;
+        *cred_handle = &request->cred_handle;
+        return ret;
+    }
+
+    EnterCriticalSection( &session->cs );
+    if (session->cred_handle_initialized && session->cred_protocols != protocols)
+    {
+        FreeCredentialsHandle( &session->cred_handle );
+        session->cred_handle_initialized = FALSE;
+    }
+    if (!session->cred_handle_initialized &&
+        !(ret = acquire_cred_handle( NULL, protocols, &session->cred_handle )))
+    {
+        session->cred_handle_initialized = TRUE;
+        session->cred_protocols = protocols;
+    }
+    LeaveCriticalSection( &session->cs );
+    *cred_handle = &session->cred_handle;
+    return ret;
+}
+
 static DWORD open_connection( struct request *request )
 {
     BOOL is_secure = request->hdr.flags & WINHTTP_FLAG_SECURE;
@@ -1681,6 +1709,8 @@ static DWORD open_connection( struct request *request )
 
         if (is_secure)
         {
+            CredHandle *cred_handle;
+
             if (connect->session->proxy_server && wcsicmp( connect->hostname, connect->servername ))
             {
                 if ((ret = secure_proxy_connect( request )))
@@ -1695,9 +1725,9 @@ static DWORD open_connection( struct request *request )
             CertFreeCertificateContext( request->server_cert );
             request->server_cert = NULL;
 
-            if ((ret = ensure_cred_handle( request )) ||
+            if ((ret = ensure_cred_handle( request, &cred_handle )) ||
                 (ret = netconn_secure_connect( netconn, connect->hostname, request->security_flags,
-                                               &request->cred_handle, request->check_revocation )))
+                                               cred_handle, request->check_revocation )))
             {
                 request->netconn = NULL;
                 free( addressW );
@@ -2288,6 +2318,8 @@ static DWORD send_request( struct request *request, const WCHAR *headers, DWORD
         process_header( request, L"Upgrade", L"websocket", WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
         process_header( request, L"Connection", L"Upgrade", WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
         process_header( request, L"Sec-WebSocket-Version", L"13", WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
+        process_header( request, L"Sec-WebSocket-Extensions", L"permessage-deflate; client_max_window_bits",
+                        WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
         if ((ret = add_websocket_key_header( request ))) return ret;
     }
     else if (!(request->hdr.disable_flags & WINHTTP_DISABLE_KEEP_ALIVE))
@@ -3410,6 +3442,81 @@ BOOL WINAPI WinHttpWriteData( HINTERNET hrequest, const void *buffer, DWORD to_w
     return !ret;
 }
 
+static voidpf winhttp_zalloc( voidpf opaque, uInt items, uInt size )
+{
+    return malloc( (size_t)items * size );
+}
+
+static void winhttp_zfree( voidpf opaque, voidpf address )
+{
+    free( address );
+}
+
+/* permessage-deflate state (RFC 7692) */
+struct websocket_compression
+{
+    z_stream zout;             /* deflate stream for sent messages */
+    z_stream zin;              /* inflate stream for received messages */
+    BOOL no_context_takeover;  /* reset the deflate context after every message */
+    BOOL receiving;            /* the message currently being received is compressed */
+    BOOL tail_fed;             /* the stripped message tail has been fed to the inflate stream */
+    char buf[4096];            /* staging buffer for compressed input */
+};
+
+/* negotiate permessage-deflate from the server's upgrade response */
+static void websocket_init_compression( struct request *request, struct socket *socket )
+{
+    struct websocket_compression *compression;
+    BOOL no_context_takeover = FALSE;
+    int window_bits = 15;
+    WCHAR buffer[512], *ptr;
+    DWORD size = sizeof(buffer);
+
+    if (query_headers( request, WINHTTP_QUERY_CUSTOM, L"Sec-WebSocket-Extensions", buffer, &size, NULL ))
+        return;
+    if (!(ptr = wcsstr( buffer, L"permessage-deflate" ))) return;
+    ptr += ARRAY_SIZE(L"permessage-deflate") - 1;
+
+    while (*ptr && *ptr != ',')
+    {
+        if (*ptr == ';' || *ptr == ' ') { ptr++; continue; }
+        if (!wcsncmp( ptr, L"client_no_context_takeover", 26 )) no_context_takeover = TRUE;
+        else if (!wcsncmp( ptr, L"client_max_window_bits", 22 ))
+        {
+            const WCHAR *p = ptr + 22;
+            while (*p == ' ') p++;
+            if (*p == '=') window_bits = wcstol( p + 1, NULL, 10 );
+            if (window_bits < 9 || window_bits > 15)
+            {
+                /* zlib can't produce windows smaller than 512 bytes */
+                WARN( "unsupported client_max_window_bits %d, not compressing\n", window_bits );
+                return;
+            }
+        }
+        while (*ptr && *ptr != ';' && *ptr != ',') ptr++;
+    }
+
+    if (!(compression = calloc( 1, sizeof(*compression) ))) return;
+    compression->zout.zalloc = compression->zin.zalloc = winhttp_zalloc;
+    compression->zout.zfree  = compression->zin.zfree  = winhttp_zfree;
+    if (deflateInit2( &compression->zout, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -window_bits, 8,
+                      Z_DEFAULT_STRATEGY ) != Z_OK)
+    {
+        free( compression );
+        return;
+    }
+    if (inflateInit2( &compression->zin, -15 ) != Z_OK)
+    {
+        deflateEnd( &compression->zout );
+        free( compression );
+        return;
+    }
+    compression->no_context_takeover = no_context_takeover;
+    socket->compression = compression;
+    TRACE( "using permessage-deflate, window_bits %d, no_context_takeover %d\n",
+           window_bits, no_context_takeover );
+}
+
 static void socket_handle_closing( struct object_header *hdr )
 {
     struct socket *socket = (struct socket *)hdr;
@@ -3446,6 +3553,12 @@ static void socket_destroy( struct object_header *hdr )
     stop_queue( &socket->recv_q );
 
     netconn_release( socket->netconn );
+    if (socket->compression)
+    {
+        deflateEnd( &socket->compression->zout );
+        inflateEnd( &socket->compression->zin );
+        free( socket->compression );
+    }
     free( socket->read_buffer );
     free( socket->send_frame_buffer );
     free( socket );
@@ -3541,6 +3654,7 @@ HINTERNET WINAPI WinHttpWebSocketCompleteUpgrade( HINTERNET hrequest, DWORD_PTR
     socket->netconn = request->netconn;
 
     netconn_set_timeout( socket->netconn, FALSE, socket->keepalive_interval );
+    websocket_init_compression( request, socket );
 
     if ((hsocket = alloc_handle( &socket->hdr )))
     {
@@ -3565,12 +3679,13 @@ static DWORD send_bytes( struct socket *socket, char *bytes, int len, int *sent,
 }
 
 #define FIN_BIT (1 << 7)
+#define COMPRESSED_BIT (1 << 6)
 #define MASK_BIT (1 << 7)
 #define RESERVED_BIT (7 << 4)
 #define CONTROL_BIT (1 << 3)
 
 static DWORD send_frame( struct socket *socket, enum socket_opcode opcode, USHORT status, const char *buf,
-                         DWORD buflen, BOOL final, WSAOVERLAPPED *ovr )
+                         DWORD buflen, BOOL final, BOOL compressed, WSAOVERLAPPED *ovr )
 {
     DWORD i, offset = 2, len = buflen, buffer_size, ret = 0;
     int sent_size;
@@ -3583,6 +3698,9 @@ static DWORD send_frame( struct socket *socket, enum socket_opcode opcode, USHOR
 
     hdr[0] = final ? (char)FIN_BIT : 0;
     hdr[0] |= opcode;
+    /* the compressed bit is only set on the first frame of a message */
+    if (compressed && (opcode == SOCKET_OPCODE_TEXT || opcode == SOCKET_OPCODE_BINARY))
+        hdr[0] |= COMPRESSED_BIT;
     hdr[1] = (char)MASK_BIT;
     if (len < 126) hdr[1] |= len;
     else if (len < 65536)
@@ -3805,13 +3923,43 @@ static void socket_send_complete( struct socket *socket, DWORD ret, WINHTTP_WEB_
 }
 
 static DWORD socket_send( struct socket *socket, WINHTTP_WEB_SOCKET_BUFFER_TYPE type, const void *buf, DWORD len,
-                          WSAOVERLAPPED *ovr )
+                          BOOL compressed, WSAOVERLAPPED *ovr )
 {
     enum socket_opcode opcode = map_buffer_type( socket, type );
     BOOL final = (type != WINHTTP_WEB_SOCKET_UTF8_FRAGMENT_BUFFER_TYPE &&
                   type != WINHTTP_WEB_SOCKET_BINARY_FRAGMENT_BUFFER_TYPE);
 
-    return send_frame( socket, opcode, 0, buf, len, final, ovr );
+    return send_frame( socket, opcode, 0, buf, len, final, compressed, ovr );
+}
+
+/* compress a message payload for permessage-deflate, stripping the trailing
+ * empty block from the final fragment */
+static DWORD websocket_deflate( struct socket *socket, const char *buf, DWORD len, BOOL final,
+                                char **ret_buf, DWORD *ret_len )
+{
+    z_stream *zout = &socket->compression->zout;
+    DWORD size = deflateBound( zout, len ) + 6;
+    char *out;
+
+    if (!(out = malloc( size ))) return ERROR_OUTOFMEMORY;
+    zout->next_in   = (unsigned char *)buf;
+    zout->avail_in  = len;
+    zout->next_out  = (unsigned char *)out;
+    zout->avail_out = size;
+    if (deflate( zout, Z_SYNC_FLUSH ) != Z_OK || zout->avail_in)
+    {
+        free( out );
+        return ERROR_WINHTTP_INTERNAL_ERROR;
+    }
+    *ret_len = size - zout->avail_out;
+    if (final)
+    {
+        assert( *ret_len >= 4 );  /* Z_SYNC_FLUSH always ends with an empty stored block */
+        *ret_len -= 4;
+        if (socket->compression->no_context_takeover) deflateReset( zout );
+    }
+    *ret_buf = out;
+    return ERROR_SUCCESS;
 }
 
 static void task_socket_send( void *ctx, BOOL abort )
@@ -3820,20 +3968,30 @@ static void task_socket_send( void *ctx, BOOL abort )
     struct socket *socket = (struct socket *)s->task_hdr.obj;
     DWORD ret;
 
-    if (abort) return;
+    if (abort)
+    {
+        free( s->zbuf );
+        return;
+    }
 
     TRACE("running %p\n", ctx);
 
     if (s->complete_async) ret = complete_send_frame( socket, &s->ovr, s->buf );
-    else                   ret = socket_send( socket, s->type, s->buf, s->len, NULL );
+    else                   ret = socket_send( socket, s->type, s->buf, s->len, s->zbuf != NULL, NULL );
 
+    free( s->zbuf );
     send_io_complete( &socket->hdr );
     InterlockedExchange( &socket->pending_noncontrol_send, 0 );
-    socket_send_complete( socket, ret, s->type, s->len );
+    socket_send_complete( socket, ret, s->type, s->raw_len );
 }
 
 DWORD WINAPI WinHttpWebSocketSend( HINTERNET hsocket, WINHTTP_WEB_SOCKET_BUFFER_TYPE type, void *buf, DWORD len )
 {
+    BOOL final = (type != WINHTTP_WEB_SOCKET_UTF8_FRAGMENT_BUFFER_TYPE &&
+                  type != WINHTTP_WEB_SOCKET_BINARY_FRAGMENT_BUFFER_TYPE);
+    const void *send_buf = buf;
+    DWORD send_len = len;
+    char *zbuf = NULL;
     struct socket *socket;
     DWORD ret = 0;
 
@@ -3879,12 +4037,21 @@ DWORD WINAPI WinHttpWebSocketSend( HINTERNET hsocket, WINHTTP_WEB_SOCKET_BUFFER_
             return ERROR_OUTOFMEMORY;
         }
 
+        if (socket->compression && (ret = websocket_deflate( socket, buf, len, final, &zbuf, &send_len )))
+        {
+            free( s );
+            InterlockedExchange( &socket->pending_noncontrol_send, 0 );
+            release_object( &socket->hdr );
+            return ret;
+        }
+        if (zbuf) send_buf = zbuf;
+
         AcquireSRWLockExclusive( &socket->send_lock );
         async_send = InterlockedIncrement( &socket->hdr.pending_sends ) > 1 || socket->hdr.recursion_count >= 3;
         if (!async_send)
         {
             memset( &s->ovr, 0, sizeof(s->ovr) );
-            if ((ret = socket_send( socket, type, buf, len, &s->ovr )) == WSA_IO_PENDING)
+            if ((ret = socket_send( socket, type, send_buf, send_len, zbuf != NULL, &s->ovr )) == WSA_IO_PENDING)
             {
                 async_send = TRUE;
                 complete_async = TRUE;
@@ -3895,12 +4062,17 @@ DWORD WINAPI WinHttpWebSocketSend( HINTERNET hsocket, WINHTTP_WEB_SOCKET_BUFFER_
         {
             s->complete_async = complete_async;
             TRACE("queueing, complete_async %#x.\n", complete_async);
-            s->type   = type;
-            s->buf    = buf;
-            s->len    = len;
+            s->type    = type;
+            s->buf     = send_buf;
+            s->len     = send_len;
+            s->raw_len = len;
+            s->zbuf    = zbuf;
 
             if ((ret = queue_task( &socket->send_q, task_socket_send, &s->task_hdr, &socket->hdr )))
+            {
                 free( s );
+                free( zbuf );
+            }
         }
         if (!async_send || ret)
         {
@@ -3912,6 +4084,7 @@ DWORD WINAPI WinHttpWebSocketSend( HINTERNET hsocket, WINHTTP_WEB_SOCKET_BUFFER_
         {
             TRACE("sent sync.\n");
             free( s );
+            free( zbuf );
             socket_send_complete( socket, ret, type, len );
             ret = ERROR_SUCCESS;
         }
@@ -3920,7 +4093,12 @@ DWORD WINAPI WinHttpWebSocketSend( HINTERNET hsocket, WINHTTP_WEB_SOCKET_BUFFER_
     {
         if (validate_buffer_type( type, socket->sending_fragment_type ))
         {
-            ret = socket_send( socket, type, buf, len, NULL );
+            if (!socket->compression || !(ret = websocket_deflate( socket, buf, len, final, &zbuf, &send_len )))
+            {
+                if (zbuf) send_buf = zbuf;
+                ret = socket_send( socket, type, send_buf, send_len, zbuf != NULL, NULL );
+                free( zbuf );
+            }
         }
         else
         {
@@ -3985,12 +4163,22 @@ static DWORD receive_frame( struct socket *socket, DWORD *ret_len, enum socket_o
     char hdr[2];
 
     if ((ret = receive_bytes( socket, hdr, sizeof(hdr), &count, TRUE ))) return ret;
-    if ((hdr[0] & RESERVED_BIT) || (hdr[1] & MASK_BIT) || !is_supported_opcode( hdr[0] & 0xf ))
+    if ((hdr[0] & RESERVED_BIT) && (!socket->compression || (hdr[0] & RESERVED_BIT) != COMPRESSED_BIT))
+    {
+        return ERROR_WINHTTP_INVALID_SERVER_RESPONSE;
+    }
+    if ((hdr[1] & MASK_BIT) || !is_supported_opcode( hdr[0] & 0xf ))
     {
         return ERROR_WINHTTP_INVALID_SERVER_RESPONSE;
     }
     *opcode = hdr[0] & 0xf;
     *final = hdr[0] & FIN_BIT;
+    if (hdr[0] & COMPRESSED_BIT)
+    {
+        if (*opcode != SOCKET_OPCODE_TEXT && *opcode != SOCKET_OPCODE_BINARY)
+            return ERROR_WINHTTP_INVALID_SERVER_RESPONSE;
+        socket->compression->receiving = TRUE;
+    }
     TRACE("received %02x frame, final %#x\n", *opcode, *final);
 
     len = hdr[1] & ~MASK_BIT;
@@ -4022,7 +4210,7 @@ static void task_socket_send_pong( void *ctx, BOOL abort )
     TRACE("running %p\n", ctx);
 
     if (s->complete_async) complete_send_frame( socket, &s->ovr, NULL );
-    else                   send_frame( socket, SOCKET_OPCODE_PONG, 0, NULL, 0, TRUE, NULL );
+    else                   send_frame( socket, SOCKET_OPCODE_PONG, 0, NULL, 0, TRUE, FALSE, NULL );
 
     send_io_complete( &socket->hdr );
 }
@@ -4042,7 +4230,7 @@ static DWORD socket_send_pong( struct socket *socket )
         if (!async_send)
         {
             memset( &s->ovr, 0, sizeof(s->ovr) );
-            if ((ret = send_frame( socket, SOCKET_OPCODE_PONG, 0, NULL, 0, TRUE, &s->ovr )) == WSA_IO_PENDING)
+            if ((ret = send_frame( socket, SOCKET_OPCODE_PONG, 0, NULL, 0, TRUE, FALSE, &s->ovr )) == WSA_IO_PENDING)
             {
                 async_send = TRUE;
                 complete_async = TRUE;
@@ -4066,7 +4254,7 @@ static DWORD socket_send_pong( struct socket *socket )
         ReleaseSRWLockExclusive( &socket->send_lock );
         return ret;
     }
-    return send_frame( socket, SOCKET_OPCODE_PONG, 0, NULL, 0, TRUE, NULL );
+    return send_frame( socket, SOCKET_OPCODE_PONG, 0, NULL, 0, TRUE, FALSE, NULL );
 }
 
 static DWORD socket_drain( struct socket *socket )
@@ -4187,13 +4375,59 @@ static WINHTTP_WEB_SOCKET_BUFFER_TYPE map_opcode( struct socket *socket, enum so
     }
 }
 
+/* decompress payload bytes of the current message into the caller's buffer */
+static DWORD websocket_inflate( struct socket *socket, char *buf, DWORD len, DWORD *ret_len, BOOL *more )
+{
+    static unsigned char deflate_tail[4] = { 0x00, 0x00, 0xff, 0xff };
+    struct websocket_compression *compression = socket->compression;
+    z_stream *zin = &compression->zin;
+    DWORD ret, count;
+    int zres;
+
+    zin->next_out = (unsigned char *)buf;
+    zin->avail_out = len;
+    for (;;)
+    {
+        if (!zin->avail_in && socket->read_size)
+        {
+            count = min( socket->read_size, sizeof(compression->buf) );
+            if ((ret = receive_bytes( socket, compression->buf, count, &count, TRUE ))) return ret;
+            socket->read_size -= count;
+            zin->next_in = (unsigned char *)compression->buf;
+            zin->avail_in = count;
+        }
+        else if (!zin->avail_in && socket->last_receive_final && !compression->tail_fed)
+        {
+            /* feed the tail stripped from the final fragment to flush the remaining data */
+            zin->next_in = deflate_tail;
+            zin->avail_in = sizeof(deflate_tail);
+            compression->tail_fed = TRUE;
+        }
+        zres = inflate( zin, Z_NO_FLUSH );
+        if (zres != Z_OK && zres != Z_BUF_ERROR && zres != Z_STREAM_END)
+            return ERROR_WINHTTP_INVALID_SERVER_RESPONSE;
+        if (!zin->avail_out || !zin->avail_in) break;
+    }
+
+    *ret_len = len - zin->avail_out;
+    *more = socket->read_size || zin->avail_in || !socket->last_receive_final || !compression->tail_fed;
+    if (!*more)
+    {
+        compression->receiving = FALSE;
+        compression->tail_fed = FALSE;
+    }
+    return ERROR_SUCCESS;
+}
+
 static DWORD socket_receive( struct socket *socket, void *buf, DWORD len, DWORD *ret_len,
                              WINHTTP_WEB_SOCKET_BUFFER_TYPE *ret_type )
 {
     BOOL final = socket->last_receive_final;
     DWORD count, ret = ERROR_SUCCESS;
+    BOOL more;
 
-    if (!socket->read_size)
+    if (!socket->read_size && !(socket->compression && socket->compression->receiving
+                                && (socket->compression->zin.avail_in || socket->last_receive_final)))
     {
         for (;;)
         {
@@ -4209,16 +4443,23 @@ static DWORD socket_receive( struct socket *socket, void *buf, DWORD len, DWORD
     if (!ret)
     {
         socket->last_receive_final = final;
-        ret = receive_bytes( socket, buf, min(len, socket->read_size), &count, FALSE );
+        if (socket->compression && socket->compression->receiving && !(socket->opcode & CONTROL_BIT))
+        {
+            ret = websocket_inflate( socket, buf, len, &count, &more );
+        }
+        else if (!(ret = receive_bytes( socket, buf, min(len, socket->read_size), &count, FALSE )))
+        {
+            if (count < socket->read_size)
+                WARN("Short read.\n");
+
+            socket->read_size -= count;
+            more = !final || socket->read_size != 0;
+        }
     }
     if (!ret)
     {
-        if (count < socket->read_size)
-            WARN("Short read.\n");
-
-        socket->read_size -= count;
         *ret_len = count;
-        *ret_type = map_opcode( socket, socket->opcode, !final || socket->read_size != 0 );
+        *ret_type = map_opcode( socket, socket->opcode, more );
         TRACE( "len %lu, *ret_len %lu, *ret_type %u.\n", len, *ret_len, *ret_type );
         if (*ret_type == ~0u)
         {
@@ -4348,7 +4589,7 @@ static void task_socket_shutdown( void *ctx, BOOL abort )
     TRACE("running %p\n", ctx);
 
     if (s->complete_async) ret = complete_send_frame( socket, &s->ovr, s->reason );
-    else                   ret = send_frame( socket, SOCKET_OPCODE_CLOSE, s->status, s->reason, s->len, TRUE, NULL );
+    else                   ret = send_frame( socket, SOCKET_OPCODE_CLOSE, s->status, s->reason, s->len, TRUE, FALSE, NULL );
 
     send_io_complete( &socket->hdr );
     if (s->send_callback) socket_shutdown_complete( socket, ret );
@@ -4373,7 +4614,7 @@ static DWORD send_socket_shutdown( struct socket *socket, USHORT status, const v
         if (!async_send)
         {
             memset( &s->ovr, 0, sizeof(s->ovr) );
-            if ((ret = send_frame( socket, SOCKET_OPCODE_CLOSE, status, reason, len, TRUE, &s->ovr )) == WSA_IO_PENDING)
+            if ((ret = send_frame( socket, SOCKET_OPCODE_CLOSE, status, reason, len, TRUE, FALSE, &s->ovr )) == WSA_IO_PENDING)
             {
                 async_send = TRUE;
                 complete_async = TRUE;
@@ -4406,7 +4647,7 @@ static DWORD send_socket_shutdown( struct socket *socket, USHORT status, const v
             }
         }
     }
-    else ret = send_frame( socket, SOCKET_OPCODE_CLOSE, status, reason, len, TRUE, NULL );
+    else ret = send_frame( socket, SOCKET_OPCODE_CLOSE, status, reason, len, TRUE, FALSE, NULL );
 
     return ret;
 }
@@ -74,6 +74,8 @@ static void session_destroy( struct object_header *hdr )
     if (session->unload_event) SetEvent( session->unload_event );
     destroy_cookies( session );
 
+    if (session->cred_handle_initialized) FreeCredentialsHandle( &session->cred_handle );
+
     session->cs.DebugInfo->Spare[0] = 0;
     DeleteCriticalSection( &session->cs );
     free( session->agent );
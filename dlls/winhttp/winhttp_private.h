@@ -84,6 +84,9 @@ struct session
     struct list cookie_cache;
     HANDLE unload_event;
     DWORD secure_protocols;
+    CredHandle cred_handle; /* shared by requests without a client certificate */
+    BOOL cred_handle_initialized;
+    DWORD cred_protocols;   /* protocol mask cred_handle was acquired with */
     DWORD passport_flags;
     unsigned int websocket_receive_buffer_size;
     unsigned int websocket_send_buffer_size;
@@ -269,6 +272,8 @@ enum fragment_type
     SOCKET_FRAGMENT_UTF8,
 };
 
+struct websocket_compression;  /* permessage-deflate state, private to request.c */
+
 struct socket
 {
     struct object_header hdr;
@@ -299,6 +304,7 @@ struct socket
     enum fragment_type sending_fragment_type;
     enum fragment_type receiving_fragment_type;
     BOOL last_receive_final;
+    struct websocket_compression *compression;
 };
 
 typedef void (*TASK_CALLBACK)( void *ctx, BOOL abort );
@@ -369,6 +375,8 @@ struct socket_send
     WINHTTP_WEB_SOCKET_BUFFER_TYPE type;
     const void *buf;
     DWORD len;
+    DWORD raw_len;
+    char *zbuf;
     WSAOVERLAPPED ovr;
     BOOL complete_async;
 };
@@ -1872,12 +1872,16 @@ static void http_release_netconn(http_request_t *req, BOOL reuse)
         return;
 
     if(reuse && req->netconn->keep_alive) {
+        DWORD timeout = req->netconn->keep_alive_timeout;
         BOOL run_collector;
 
+        if(!timeout || timeout > COLLECT_TIME)
+            timeout = COLLECT_TIME;
+
         EnterCriticalSection(&connection_pool_cs);
 
         list_add_head(&req->netconn->server->conn_pool, &req->netconn->pool_entry);
-        req->netconn->keep_until = GetTickCount64() + COLLECT_TIME;
+        req->netconn->keep_until = GetTickCount64() + timeout;
         req->netconn = NULL;
 
         run_collector = !collector_running;
@@ -4871,6 +4875,22 @@ static void HTTP_ProcessLastModified(http_request_t *request)
     LeaveCriticalSection( &request->headers_section );
 }
 
+/* Parses the timeout parameter of a Keep-Alive header, e.g. "timeout=5, max=100".
+ * Returns the timeout in milliseconds, or 0 if there is none. */
+static DWORD get_keep_alive_timeout(const WCHAR *value)
+{
+    const WCHAR *next;
+
+    for (; *value; value = next + wcsspn(next, L" ,"))
+    {
+        next = value + wcscspn(value, L" ,");
+        if (next - value > 8 && !wcsnicmp(value, L"timeout=", 8))
+            return wcstol(value + 8, NULL, 10) * 1000;
+    }
+
+    return 0;
+}
+
 static void http_process_keep_alive(http_request_t *req)
 {
     const WCHAR *connection = L"";
@@ -4883,6 +4903,10 @@ static void http_process_keep_alive(http_request_t *req)
         connection = req->custHeaders[index].lpszValue;
     req->netconn->keep_alive = has_keep_alive(req->version, connection);
 
+    req->netconn->keep_alive_timeout = 0;
+    if ((index = HTTP_GetCustomHeaderIndex(req, L"Keep-Alive", 0, FALSE)) != -1)
+        req->netconn->keep_alive_timeout = get_keep_alive_timeout(req->custHeaders[index].lpszValue);
+
     LeaveCriticalSection( &req->headers_section );
 }
 
@@ -4917,7 +4941,8 @@ static DWORD open_http_connection(http_request_t *request, BOOL *reusing)
         netconn = LIST_ENTRY(list_head(&request->server->conn_pool), netconn_t, pool_entry);
         list_remove(&netconn->pool_entry);
 
-        if(is_valid_netconn(netconn) && NETCON_is_alive(netconn))
+        /* don't reuse a connection that outlived the timeout the server advertised */
+        if(netconn->keep_until >= GetTickCount64() && is_valid_netconn(netconn) && NETCON_is_alive(netconn))
             break;
 
         TRACE("connection %p closed during idle\n", netconn);
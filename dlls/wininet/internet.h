@@ -81,6 +81,7 @@ typedef struct
     BOOL mask_errors;
 
     BOOL keep_alive;
+    DWORD keep_alive_timeout; /* advertised by the server in ms, 0 if none */
     DWORD64 keep_until;
     struct list pool_entry;
 } netconn_t;
@@ -179,6 +179,7 @@ typedef struct
     char *cache_prefix; /* string that has to be prefixed for this container to be used */
     LPWSTR path; /* path to url container directory */
     HANDLE mapping; /* handle of file mapping */
+    urlcache_header *header; /* view of the mapping, kept for the life of the mapping */
     DWORD file_size; /* size of file when mapping was opened */
     HANDLE mutex; /* handle of mutex */
     DWORD default_entry_type;
@@ -438,9 +439,11 @@ static DWORD cache_container_set_size(cache_container *container, HANDLE file, D
         header->size = file_size;
         header->capacity_in_blocks = blocks_no;
 
-        UnmapViewOfFile(header);
+        if(container->header)
+            UnmapViewOfFile(container->header);
         CloseHandle(container->mapping);
         container->mapping = mapping;
+        container->header = header;
         container->file_size = file_size;
         return ERROR_SUCCESS;
     }
@@ -527,9 +530,11 @@ static DWORD cache_container_set_size(cache_container *container, HANDLE file, D
         }
     }
 
-    UnmapViewOfFile(header);
+    if(container->header)
+        UnmapViewOfFile(container->header);
     CloseHandle(container->mapping);
     container->mapping = mapping;
+    container->header = header;
     container->file_size = file_size;
     return ERROR_SUCCESS;
 }
@@ -667,6 +672,9 @@ static DWORD cache_container_open_index(cache_container *container, DWORD blocks
  */
 static void cache_container_close_index(cache_container *pContainer)
 {
+    if (pContainer->header)
+        UnmapViewOfFile(pContainer->header);
+    pContainer->header = NULL;
     CloseHandle(pContainer->mapping);
     pContainer->mapping = NULL;
 }
@@ -683,6 +691,7 @@ static BOOL cache_containers_add(const char *cache_prefix, LPCWSTR path,
     }
 
     pContainer->mapping = NULL;
+    pContainer->header = NULL;
     pContainer->file_size = 0;
     pContainer->default_entry_type = default_entry_type;
 
@@ -878,29 +887,29 @@ static BOOL cache_containers_enum(char *search_pattern, DWORD index, cache_conta
 static urlcache_header* cache_container_lock_index(cache_container *pContainer)
 {
     BYTE index;
-    LPVOID pIndexData;
     urlcache_header* pHeader;
     DWORD error;
 
     /* acquire mutex */
     WaitForSingleObject(pContainer->mutex, INFINITE);
 
-    pIndexData = MapViewOfFile(pContainer->mapping, FILE_MAP_WRITE, 0, 0, 0);
-
-    if (!pIndexData)
+    if (!pContainer->header)
     {
-        ReleaseMutex(pContainer->mutex);
-        ERR("Couldn't MapViewOfFile. Error: %ld\n", GetLastError());
-        return NULL;
+        pContainer->header = MapViewOfFile(pContainer->mapping, FILE_MAP_WRITE, 0, 0, 0);
+        if (!pContainer->header)
+        {
+            ReleaseMutex(pContainer->mutex);
+            ERR("Couldn't MapViewOfFile. Error: %ld\n", GetLastError());
+            return NULL;
+        }
     }
-    pHeader = (urlcache_header*)pIndexData;
+    pHeader = pContainer->header;
 
     /* file has grown - we need to remap to prevent us getting
      * access violations when we try and access beyond the end
      * of the memory mapped file */
     if (pHeader->size != pContainer->file_size)
     {
-        UnmapViewOfFile( pHeader );
         cache_container_close_index(pContainer);
         error = cache_container_open_index(pContainer, MIN_BLOCK_NO);
         if (error != ERROR_SUCCESS)
@@ -909,15 +918,14 @@ static urlcache_header* cache_container_lock_index(cache_container *pContainer)
             SetLastError(error);
             return NULL;
         }
-        pIndexData = MapViewOfFile(pContainer->mapping, FILE_MAP_WRITE, 0, 0, 0);
-
-        if (!pIndexData)
+        pContainer->header = MapViewOfFile(pContainer->mapping, FILE_MAP_WRITE, 0, 0, 0);
+        if (!pContainer->header)
         {
             ReleaseMutex(pContainer->mutex);
             ERR("Couldn't MapViewOfFile. Error: %ld\n", GetLastError());
             return NULL;
         }
-        pHeader = (urlcache_header*)pIndexData;
+        pHeader = pContainer->header;
     }
 
     TRACE("Signature: %s, file size: %ld bytes\n", pHeader->signature, pHeader->size);
@@ -936,9 +944,8 @@ static urlcache_header* cache_container_lock_index(cache_container *pContainer)
  */
 static BOOL cache_container_unlock_index(cache_container *pContainer, urlcache_header *pHeader)
 {
-    /* release mutex */
-    ReleaseMutex(pContainer->mutex);
-    return UnmapViewOfFile(pHeader);
+    /* the view stays mapped for the next operation, just release the mutex */
+    return ReleaseMutex(pContainer->mutex);
 }
 
 /***********************************************************************
@@ -1155,7 +1162,7 @@ static BOOL urlcache_clean_leaked_entries(cache_container *container, urlcache_h
 static DWORD cache_container_clean_index(cache_container *container, urlcache_header **file_view)
 {
     urlcache_header *header = *file_view;
-    DWORD ret;
+    DWORD capacity, ret;
 
     TRACE("(%s %s)\n", debugstr_a(container->cache_prefix), debugstr_w(container->path));
 
@@ -1167,15 +1174,16 @@ static DWORD cache_container_clean_index(cache_container *container, urlcache_he
         return ERROR_NOT_ENOUGH_MEMORY;
     }
 
-    cache_container_close_index(container);
-    ret = cache_container_open_index(container, header->capacity_in_blocks*2);
+    capacity = header->capacity_in_blocks;
+    cache_container_close_index(container); /* also unmaps *file_view */
+    ret = cache_container_open_index(container, capacity*2);
     if(ret != ERROR_SUCCESS)
         return ret;
     header = MapViewOfFile(container->mapping, FILE_MAP_WRITE, 0, 0, 0);
     if(!header)
         return GetLastError();
 
-    UnmapViewOfFile(*file_view);
+    container->header = header;
     *file_view = header;
     return ERROR_SUCCESS;
 }
@@ -58,6 +58,7 @@ static CRITICAL_SECTION TIME_cbcrst = { &critsect_debug, -1, 0, 0, 0, 0 };
 
 static    HANDLE                TIME_hMMTimer;
 static    CONDITION_VARIABLE    TIME_cv;
+static    DWORD                 TIME_nextTrigger; /* deadline the timer thread sleeps on */
 
 /*
  * Some observations on the behavior of winmm on Windows.
@@ -136,7 +137,11 @@ static int TIME_MMSysTimeCallback(void)
         }
 
         delta_time = timer->dwTriggerTime - timeGetTime();
-        if (delta_time > 0) break;
+        if (delta_time > 0)
+        {
+            TIME_nextTrigger = timer->dwTriggerTime;
+            break;
+        }
 
         if (timer->wFlags & TIME_PERIODIC)
             timer->dwTriggerTime += timer->wDelay;
@@ -269,6 +274,7 @@ MMRESULT WINAPI timeSetEvent(UINT wDelay, UINT wResol, LPTIMECALLBACK lpFunc,
                             DWORD_PTR dwUser, UINT wFlags)
 {
     WORD new_id = 0;
+    BOOL wake;
     int i;
 
     TRACE("(%u, %u, %p, %08IX, %04X);\n", wDelay, wResol, lpFunc, dwUser, wFlags);
@@ -300,12 +306,15 @@ MMRESULT WINAPI timeSetEvent(UINT wDelay, UINT wResol, LPTIMECALLBACK lpFunc,
     timers[i].wFlags = wFlags;
     timers[i].wTimerID = new_id;
 
+    /* The service thread rescans the timers before sleeping again, so it only
+     * has to be woken up when the new timer expires before the deadline it is
+     * currently sleeping on. A freshly started thread scans on its own. */
+    wake = TIME_hMMTimer && (int)(timers[i].dwTriggerTime - TIME_nextTrigger) < 0;
     TIME_MMTimeStart();
 
     LeaveCriticalSection(&WINMM_cs);
 
-    /* Wake the service thread in case there is work to be done */
-    WakeConditionVariable(&TIME_cv);
+    if (wake) WakeConditionVariable(&TIME_cv);
 
     TRACE("=> %u\n", new_id);
 
@@ -319,6 +328,7 @@ MMRESULT WINAPI timeKillEvent(UINT wID)
 {
     WINE_TIMERENTRY *timer;
     WORD flags;
+    BOOL wake;
 
     TRACE("(%u)\n", wID);
     EnterCriticalSection(&WINMM_cs);
@@ -333,6 +343,9 @@ MMRESULT WINAPI timeKillEvent(UINT wID)
 
     timer->wTimerID = 0;
     flags = timer->wFlags;
+    /* only wake the service thread when this was the timer it sleeps on, so
+     * it can pick the next deadline, or exit if no timers are left */
+    wake = (int)(timer->dwTriggerTime - TIME_nextTrigger) <= 0;
     LeaveCriticalSection(&WINMM_cs);
 
     if (flags & TIME_KILL_SYNCHRONOUS)
@@ -340,7 +353,7 @@ MMRESULT WINAPI timeKillEvent(UINT wID)
         EnterCriticalSection(&TIME_cbcrst);
         LeaveCriticalSection(&TIME_cbcrst);
     }
-    WakeConditionVariable(&TIME_cv);
+    if (wake) WakeConditionVariable(&TIME_cv);
     return TIMERR_NOERROR;
 }
 
@@ -23,6 +23,7 @@
 #include "windef.h"
 #include "winbase.h"
 #include "winnls.h"
+#include "winsock2.h"
 #include "winternl.h"
 #include "schannel.h"
 #include "sspi.h"
@@ -35,6 +36,52 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(wldap32);
 
+/* Cache the DC most recently resolved for a host, so that fanning out
+ * connections from several handles doesn't repeat DC discovery for each. */
+static CRITICAL_SECTION dc_cache_cs;
+static CRITICAL_SECTION_DEBUG dc_cache_cs_debug =
+{
+    0, 0, &dc_cache_cs,
+    { &dc_cache_cs_debug.ProcessLocksList, &dc_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": dc_cache_cs") }
+};
+static CRITICAL_SECTION dc_cache_cs = { &dc_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static WCHAR *dc_cache_host, *dc_cache_name;
+static ULONGLONG dc_cache_ticks;
+
+#define DC_CACHE_TIMEOUT 60000
+
+static WCHAR *get_cached_dc_name( const WCHAR *host )
+{
+    WCHAR *ret = NULL;
+
+    EnterCriticalSection( &dc_cache_cs );
+    if (dc_cache_name && GetTickCount64() - dc_cache_ticks <= DC_CACHE_TIMEOUT
+            && ((!host && !dc_cache_host) || (host && dc_cache_host && !wcsicmp( host, dc_cache_host ))))
+        ret = wcsdup( dc_cache_name );
+    LeaveCriticalSection( &dc_cache_cs );
+    return ret;
+}
+
+static void set_cached_dc_name( const WCHAR *host, const WCHAR *name )
+{
+    WCHAR *hostW = host ? wcsdup( host ) : NULL, *nameW = wcsdup( name );
+
+    if (!nameW)
+    {
+        free( hostW );
+        return;
+    }
+    EnterCriticalSection( &dc_cache_cs );
+    free( dc_cache_host );
+    free( dc_cache_name );
+    dc_cache_host = hostW;
+    dc_cache_name = nameW;
+    dc_cache_ticks = GetTickCount64();
+    LeaveCriticalSection( &dc_cache_cs );
+}
+
 /* Split a space separated string of hostnames into a string array */
 static char **split_hostnames( const char *hostnames )
 {
@@ -261,6 +308,7 @@ ULONG CDECL WLDAP32_ldap_connect( LDAP *ld, struct l_timeval *timeout )
     QUERYCLIENTCERT *client_cert_callback = CLIENT_CERT_CALLBACK(ld);
     VERIFYSERVERCERT *server_cert_callback = SERVER_CERT_CALLBACK(ld);
     DOMAIN_CONTROLLER_INFOW *dcinfo;
+    WCHAR *dc_name;
     int ret;
 
     TRACE( "(%p, %p)\n", ld, timeout );
@@ -271,13 +319,23 @@ ULONG CDECL WLDAP32_ldap_connect( LDAP *ld, struct l_timeval *timeout )
     if (client_cert_callback)
         FIXME( "mTLS is not implemented\n" );
 
-    if (timeout && (timeout->tv_sec || timeout->tv_usec)) FIXME( "ignoring timeout\n" );
+    if (timeout && (timeout->tv_sec || timeout->tv_usec))
+    {
+        struct timeval tv = { timeout->tv_sec, timeout->tv_usec };
+        ldap_set_option( CTX(ld), LDAP_OPT_NETWORK_TIMEOUT, &tv );
+    }
 
-    if (DsGetDcNameW( NULL, ld->ld_host, NULL, NULL, DS_RETURN_DNS_NAME, &dcinfo ) == ERROR_SUCCESS)
+    if ((dc_name = get_cached_dc_name( ld->ld_host )))
+    {
+        TRACE( "ld_host %s cached DC %s\n", debugstr_w( ld->ld_host ), debugstr_w( dc_name ) );
+        ldap_set_optionW( ld, WLDAP32_LDAP_OPT_HOST_NAME, &dc_name );
+        free( dc_name );
+    }
+    else if (DsGetDcNameW( NULL, ld->ld_host, NULL, NULL, DS_RETURN_DNS_NAME, &dcinfo ) == ERROR_SUCCESS)
     {
-        WCHAR *dc_name;
         TRACE( "ld_host %s resolved to DC %s\n", debugstr_w( ld->ld_host ), debugstr_w( dcinfo->DomainControllerName ) );
         dc_name = dcinfo->DomainControllerName + 2;
+        set_cached_dc_name( ld->ld_host, dc_name );
         ldap_set_optionW( ld, WLDAP32_LDAP_OPT_HOST_NAME, &dc_name );
         NetApiBufferFree( dcinfo );
     }
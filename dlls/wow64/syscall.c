@@ -19,6 +19,7 @@
  */
 
 #include <stdarg.h>
+#include <string.h>
 #include <setjmp.h>
 
 #include "ntstatus.h"
@@ -57,6 +58,17 @@ static BYTE syscall_args[ARRAY_SIZE(syscall_thunks)] =
 #undef SYSCALL_ENTRY
 };
 
+static const char * const syscall_names[] =
+{
+#define SYSCALL_ENTRY(id,name,args) #name,
+    ALL_SYSCALLS32
+#undef SYSCALL_ENTRY
+};
+
+/* flags syscalls whose thunk only forwards the argument words, so the
+ * dispatcher can skip the exception-handling frame and temp data cleanup */
+static BYTE syscall_fast_path[ARRAY_SIZE(syscall_thunks)];
+
 static SYSTEM_SERVICE_TABLE syscall_tables[4] =
 {
     { (ULONG_PTR *)syscall_thunks, NULL, ARRAY_SIZE(syscall_thunks), syscall_args }
@@ -802,6 +814,46 @@ static NTSTATUS create_cross_process_work_list( WOW64INFO *wow64info )
 }
 
 
+/**********************************************************************
+ *           init_syscall_fast_path
+ *
+ * Flag the hot syscalls whose thunks copy the 32-bit argument words
+ * straight through: no pointer translation, no temp allocations, and no
+ * exception raised from the thunk itself.  Those can be dispatched
+ * without the unwinding frame set up by wow64_syscall().
+ */
+static void init_syscall_fast_path(void)
+{
+    static const char * const fast_path_names[] =
+    {
+        "NtAlertThread",
+        "NtAlertThreadByThreadId",
+        "NtClose",
+        "NtDelayExecution",
+        "NtGetCurrentProcessorNumber",
+        "NtQueryPerformanceCounter",
+        "NtReleaseMutant",
+        "NtReleaseSemaphore",
+        "NtResetEvent",
+        "NtSetEvent",
+        "NtSignalAndWaitForSingleObject",
+        "NtTestAlert",
+        "NtWaitForAlertByThreadId",
+        "NtWaitForSingleObject",
+        "NtYieldExecution",
+    };
+    unsigned int i, j;
+
+    for (i = 0; i < ARRAY_SIZE(syscall_names); i++)
+        for (j = 0; j < ARRAY_SIZE(fast_path_names); j++)
+            if (!strcmp( syscall_names[i], fast_path_names[j] ))
+            {
+                syscall_fast_path[i] = 1;
+                break;
+            }
+}
+
+
 /**********************************************************************
  *           process_init
  */
@@ -859,6 +911,8 @@ static DWORD WINAPI process_init( RTL_RUN_ONCE *once, void *param, void **contex
     GET_PTR( sdwhwin32 );
     syscall_tables[1] = *psdwhwin32;
 
+    init_syscall_fast_path();
+
     pBTCpuProcessInit();
 
     module = (HMODULE)(ULONG_PTR)pLdrSystemDllInitBlock->ntdll_handle;
@@ -1026,8 +1080,12 @@ NTSTATUS WINAPI Wow64SystemServiceEx( UINT num, UINT *args )
         ERR( "unsupported syscall %04x\n", num );
         return STATUS_INVALID_SYSTEM_SERVICE;
     }
+    /* debuggers rely on the frame to turn invalid handle faults into
+     * user exceptions, so only bypass it when not being debugged */
+    if (!(num >> 12) && syscall_fast_path[id] && !NtCurrentTeb()->Peb->BeingDebugged)
+        return ((syscall_thunk)table->ServiceTable[id])( args );
     status = wow64_syscall( args, table->ServiceTable[id] );
-    free_temp_data();
+    if (NtCurrentTeb()->TlsSlots[WOW64_TLS_TEMPLIST]) free_temp_data();
     return status;
 }
 
@@ -2391,6 +2391,41 @@ NTSTATUS WINAPI wow64_NtGdiPlgBlt( UINT *args )
                         mask, x_mask, y_mask, bk_color );
 }
 
+NTSTATUS WINAPI wow64_NtGdiPolyPatBlt( UINT *args )
+{
+    typedef struct
+    {
+        INT   x;
+        INT   y;
+        INT   cx;
+        INT   cy;
+        ULONG brush;
+    } POLYPATBLT32;
+
+    HDC hdc = get_handle( &args );
+    DWORD rop = get_ulong( &args );
+    const POLYPATBLT32 *blts32 = get_ptr( &args );
+    UINT count = get_ulong( &args );
+    UINT mode = get_ulong( &args );
+
+    POLYPATBLT *blts = NULL;
+    UINT i;
+
+    if (count && blts32)
+    {
+        if (!(blts = Wow64AllocateTemp( count * sizeof(*blts) ))) return FALSE;
+        for (i = 0; i < count; i++)
+        {
+            blts[i].x = blts32[i].x;
+            blts[i].y = blts32[i].y;
+            blts[i].cx = blts32[i].cx;
+            blts[i].cy = blts32[i].cy;
+            blts[i].brush = UlongToHandle( blts32[i].brush );
+        }
+    }
+    return NtGdiPolyPatBlt( hdc, rop, blts, count, mode );
+}
+
 NTSTATUS WINAPI wow64_NtGdiPtInRegion( UINT *args )
 {
     HRGN hrgn = get_handle( &args );
@@ -0,0 +1,533 @@
+/*
+ * Registered I/O (RIO) extension functions
+ *
+ * Copyright 2026 the Wine developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+/* This is an emulation of registered I/O on top of ordinary overlapped
+ * socket I/O. Real RIO completes requests into rings shared with the kernel
+ * so that submission and completion do not require a system call per
+ * packet; we cannot share the unix socket implementation's state with
+ * application memory, so requests are submitted as overlapped WSASend() /
+ * WSARecv() calls and harvested into the completion queue when it is
+ * polled. The API contract—fixed registered buffers, queue capacities,
+ * completion ordering through RIODequeueCompletion()—is preserved, the
+ * syscall-free fast path is not. */
+
+#include "ws2_32_private.h"
+
+#include "wine/list.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(winsock);
+
+struct rio_buffer
+{
+    char *addr;
+    DWORD len;
+};
+
+struct rio_cq
+{
+    CRITICAL_SECTION cs;
+    RIORESULT *results;
+    DWORD size, head, count;
+    DWORD pending_count;
+    struct list pending;
+    RIO_NOTIFICATION_COMPLETION notification;
+    BOOL have_notification;
+};
+
+struct rio_request
+{
+    struct list entry;
+    OVERLAPPED ovl;
+    SOCKET socket;
+    int addr_len;
+    BOOL done;
+    LONG status;
+    ULONG transferred;
+    ULONGLONG socket_context;
+    ULONGLONG request_context;
+};
+
+struct rio_rq
+{
+    SOCKET socket;
+    struct rio_cq *recv_cq, *send_cq;
+    void *socket_context;
+};
+
+static char *rio_resolve_buf( const RIO_BUF *buf, DWORD *len )
+{
+    const struct rio_buffer *buffer = (const struct rio_buffer *)buf->BufferId;
+
+    if (!buffer || buf->BufferId == RIO_INVALID_BUFFERID
+            || (ULONGLONG)buf->Offset + buf->Length > buffer->len)
+        return NULL;
+    *len = buf->Length;
+    return buffer->addr + buf->Offset;
+}
+
+static RIO_BUFFERID WINAPI rio_RIORegisterBuffer( char *buffer, DWORD len )
+{
+    struct rio_buffer *ret;
+
+    TRACE( "buffer %p, len %lu\n", buffer, len );
+
+    if (!buffer || !len)
+    {
+        SetLastError( WSAEINVAL );
+        return RIO_INVALID_BUFFERID;
+    }
+    if (!(ret = malloc( sizeof(*ret) )))
+    {
+        SetLastError( WSAENOBUFS );
+        return RIO_INVALID_BUFFERID;
+    }
+    ret->addr = buffer;
+    ret->len = len;
+    return (RIO_BUFFERID)ret;
+}
+
+static void WINAPI rio_RIODeregisterBuffer( RIO_BUFFERID buffer )
+{
+    TRACE( "buffer %p\n", buffer );
+
+    if (buffer != RIO_INVALID_BUFFERID)
+        free( buffer );
+}
+
+static RIO_CQ WINAPI rio_RIOCreateCompletionQueue( DWORD size, RIO_NOTIFICATION_COMPLETION *notification )
+{
+    struct rio_cq *cq;
+
+    TRACE( "size %lu, notification %p\n", size, notification );
+
+    if (!size || size > RIO_MAX_CQ_SIZE)
+    {
+        SetLastError( WSAEINVAL );
+        return RIO_INVALID_CQ;
+    }
+
+    if (!(cq = calloc( 1, sizeof(*cq) )) || !(cq->results = malloc( size * sizeof(*cq->results) )))
+    {
+        free( cq );
+        SetLastError( WSAENOBUFS );
+        return RIO_INVALID_CQ;
+    }
+    cq->size = size;
+    list_init( &cq->pending );
+    InitializeCriticalSectionEx( &cq->cs, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO );
+    cq->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": rio_cq.cs");
+
+    if (notification)
+    {
+        if (notification->Type == RIO_IOCP_COMPLETION)
+            FIXME( "I/O completion port notification is not supported.\n" );
+        cq->notification = *notification;
+        cq->have_notification = TRUE;
+    }
+    return (RIO_CQ)cq;
+}
+
+static void WINAPI rio_RIOCloseCompletionQueue( RIO_CQ handle )
+{
+    struct rio_cq *cq = (struct rio_cq *)handle;
+    struct rio_request *request, *next;
+
+    TRACE( "cq %p\n", handle );
+
+    if (handle == RIO_INVALID_CQ)
+        return;
+
+    LIST_FOR_EACH_ENTRY_SAFE( request, next, &cq->pending, struct rio_request, entry )
+    {
+        /* The request's overlapped I/O may still be in flight; cancel it and
+         * wait for it to finish before freeing the request. */
+        if (!request->done)
+        {
+            DWORD transferred, flags;
+
+            CancelIoEx( (HANDLE)request->socket, &request->ovl );
+            WSAGetOverlappedResult( request->socket, &request->ovl, &transferred, TRUE, &flags );
+        }
+        list_remove( &request->entry );
+        free( request );
+    }
+    cq->cs.DebugInfo->Spare[0] = 0;
+    DeleteCriticalSection( &cq->cs );
+    free( cq->results );
+    free( cq );
+}
+
+static BOOL WINAPI rio_RIOResizeCompletionQueue( RIO_CQ handle, DWORD size )
+{
+    struct rio_cq *cq = (struct rio_cq *)handle;
+    RIORESULT *results;
+    DWORD i;
+
+    TRACE( "cq %p, size %lu\n", handle, size );
+
+    if (handle == RIO_INVALID_CQ || !size || size > RIO_MAX_CQ_SIZE)
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+
+    EnterCriticalSection( &cq->cs );
+    if (size < cq->count + cq->pending_count)
+    {
+        LeaveCriticalSection( &cq->cs );
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+    if (!(results = malloc( size * sizeof(*results) )))
+    {
+        LeaveCriticalSection( &cq->cs );
+        SetLastError( WSAENOBUFS );
+        return FALSE;
+    }
+    for (i = 0; i < cq->count; ++i)
+        results[i] = cq->results[(cq->head + i) % cq->size];
+    free( cq->results );
+    cq->results = results;
+    cq->size = size;
+    cq->head = 0;
+    LeaveCriticalSection( &cq->cs );
+    return TRUE;
+}
+
+static RIO_RQ WINAPI rio_RIOCreateRequestQueue( SOCKET s, ULONG max_recvs, ULONG max_recv_buffers,
+                                                ULONG max_sends, ULONG max_send_buffers,
+                                                RIO_CQ recv_cq, RIO_CQ send_cq, void *context )
+{
+    struct rio_rq *rq;
+
+    TRACE( "socket %#Ix, max_recvs %lu, max_recv_buffers %lu, max_sends %lu, max_send_buffers %lu, "
+           "recv_cq %p, send_cq %p, context %p\n",
+           s, max_recvs, max_recv_buffers, max_sends, max_send_buffers, recv_cq, send_cq, context );
+
+    if (recv_cq == RIO_INVALID_CQ || send_cq == RIO_INVALID_CQ
+            || max_recv_buffers > 1 || max_send_buffers > 1)
+    {
+        SetLastError( WSAEINVAL );
+        return RIO_INVALID_RQ;
+    }
+
+    if (!(rq = malloc( sizeof(*rq) )))
+    {
+        SetLastError( WSAENOBUFS );
+        return RIO_INVALID_RQ;
+    }
+    rq->socket = s;
+    rq->recv_cq = (struct rio_cq *)recv_cq;
+    rq->send_cq = (struct rio_cq *)send_cq;
+    rq->socket_context = context;
+    return (RIO_RQ)rq;
+}
+
+static BOOL WINAPI rio_RIOResizeRequestQueue( RIO_RQ handle, DWORD max_recvs, DWORD max_sends )
+{
+    TRACE( "rq %p, max_recvs %lu, max_sends %lu\n", handle, max_recvs, max_sends );
+
+    if (handle == RIO_INVALID_RQ)
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+    /* Requests are not preallocated, so there is no queue storage to resize. */
+    return TRUE;
+}
+
+/* Move finished requests from the pending list to the result ring.
+ * Called with the queue lock held. */
+static void rio_cq_harvest( struct rio_cq *cq )
+{
+    struct rio_request *request, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE( request, next, &cq->pending, struct rio_request, entry )
+    {
+        RIORESULT *result;
+
+        if (!request->done)
+        {
+            DWORD transferred, flags;
+
+            if (WSAGetOverlappedResult( request->socket, &request->ovl, &transferred, FALSE, &flags ))
+            {
+                request->status = NO_ERROR;
+                request->transferred = transferred;
+            }
+            else
+            {
+                DWORD error = WSAGetLastError();
+
+                if (error == WSA_IO_INCOMPLETE)
+                    continue;
+                request->status = error;
+                request->transferred = 0;
+            }
+        }
+
+        result = &cq->results[(cq->head + cq->count++) % cq->size];
+        result->Status = request->status;
+        result->BytesTransferred = request->transferred;
+        result->SocketContext = request->socket_context;
+        result->RequestContext = request->request_context;
+        list_remove( &request->entry );
+        free( request );
+        --cq->pending_count;
+    }
+}
+
+static BOOL rio_submit( struct rio_rq *rq, struct rio_cq *cq, BOOL recv, RIO_BUF *data,
+                        RIO_BUF *remote_addr, DWORD flags, void *context )
+{
+    struct rio_request *request;
+    DWORD transferred;
+    WSABUF wsabuf;
+    int ret;
+
+    if (flags & ~RIO_MSG_DONT_NOTIFY)
+        FIXME( "ignoring flags %#lx\n", flags & ~RIO_MSG_DONT_NOTIFY );
+
+    wsabuf.buf = NULL;
+    wsabuf.len = 0;
+    if (data && !(wsabuf.buf = rio_resolve_buf( data, &wsabuf.len )))
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+
+    if (!(request = calloc( 1, sizeof(*request) )))
+    {
+        SetLastError( WSAENOBUFS );
+        return FALSE;
+    }
+    request->socket = rq->socket;
+    request->socket_context = (ULONG_PTR)rq->socket_context;
+    request->request_context = (ULONG_PTR)context;
+
+    EnterCriticalSection( &cq->cs );
+    if (cq->count + cq->pending_count >= cq->size)
+    {
+        LeaveCriticalSection( &cq->cs );
+        free( request );
+        SetLastError( WSAENOBUFS );
+        return FALSE;
+    }
+
+    if (recv)
+    {
+        DWORD recv_flags = 0;
+
+        if (remote_addr)
+        {
+            struct WS(sockaddr) *addr;
+            DWORD addr_size;
+
+            if (!(addr = (struct WS(sockaddr) *)rio_resolve_buf( remote_addr, &addr_size )))
+            {
+                LeaveCriticalSection( &cq->cs );
+                free( request );
+                SetLastError( WSAEINVAL );
+                return FALSE;
+            }
+            request->addr_len = addr_size;
+            ret = WSARecvFrom( rq->socket, &wsabuf, 1, &transferred, &recv_flags,
+                               addr, &request->addr_len, &request->ovl, NULL );
+        }
+        else
+        {
+            ret = WSARecv( rq->socket, &wsabuf, 1, &transferred, &recv_flags, &request->ovl, NULL );
+        }
+    }
+    else
+    {
+        if (remote_addr)
+        {
+            struct WS(sockaddr) *addr;
+            DWORD addr_size;
+
+            if (!(addr = (struct WS(sockaddr) *)rio_resolve_buf( remote_addr, &addr_size )))
+            {
+                LeaveCriticalSection( &cq->cs );
+                free( request );
+                SetLastError( WSAEINVAL );
+                return FALSE;
+            }
+            ret = WSASendTo( rq->socket, &wsabuf, 1, &transferred, 0,
+                             addr, addr_size, &request->ovl, NULL );
+        }
+        else
+        {
+            ret = WSASend( rq->socket, &wsabuf, 1, &transferred, 0, &request->ovl, NULL );
+        }
+    }
+
+    if (ret == SOCKET_ERROR)
+    {
+        DWORD error = WSAGetLastError();
+
+        if (error != WSA_IO_PENDING)
+        {
+            /* The request failed synchronously; it still completes through
+             * the completion queue, like on Windows. */
+            request->done = TRUE;
+            request->status = error;
+        }
+    }
+
+    list_add_tail( &cq->pending, &request->entry );
+    ++cq->pending_count;
+    LeaveCriticalSection( &cq->cs );
+    return TRUE;
+}
+
+static BOOL WINAPI rio_RIOReceive( RIO_RQ handle, RIO_BUF *data, ULONG count, DWORD flags, void *context )
+{
+    struct rio_rq *rq = (struct rio_rq *)handle;
+
+    TRACE( "rq %p, data %p, count %lu, flags %#lx, context %p\n", handle, data, count, flags, context );
+
+    if (handle == RIO_INVALID_RQ || count > 1)
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+    return rio_submit( rq, rq->recv_cq, TRUE, count ? data : NULL, NULL, flags, context );
+}
+
+static int WINAPI rio_RIOReceiveEx( RIO_RQ handle, RIO_BUF *data, ULONG count, RIO_BUF *local_addr,
+                                    RIO_BUF *remote_addr, RIO_BUF *control, RIO_BUF *ret_flags,
+                                    DWORD flags, void *context )
+{
+    struct rio_rq *rq = (struct rio_rq *)handle;
+
+    TRACE( "rq %p, data %p, count %lu, local_addr %p, remote_addr %p, control %p, ret_flags %p, "
+           "flags %#lx, context %p\n",
+           handle, data, count, local_addr, remote_addr, control, ret_flags, flags, context );
+
+    if (handle == RIO_INVALID_RQ || count > 1)
+    {
+        SetLastError( WSAEINVAL );
+        return SOCKET_ERROR;
+    }
+    if (local_addr || control || ret_flags)
+        FIXME( "local address, control and flags buffers are not filled\n" );
+
+    if (!rio_submit( rq, rq->recv_cq, TRUE, count ? data : NULL, remote_addr, flags, context ))
+        return SOCKET_ERROR;
+    return 0;
+}
+
+static BOOL WINAPI rio_RIOSend( RIO_RQ handle, RIO_BUF *data, ULONG count, DWORD flags, void *context )
+{
+    struct rio_rq *rq = (struct rio_rq *)handle;
+
+    TRACE( "rq %p, data %p, count %lu, flags %#lx, context %p\n", handle, data, count, flags, context );
+
+    if (handle == RIO_INVALID_RQ || count > 1)
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+    return rio_submit( rq, rq->send_cq, FALSE, count ? data : NULL, NULL, flags, context );
+}
+
+static int WINAPI rio_RIOSendEx( RIO_RQ handle, RIO_BUF *data, ULONG count, RIO_BUF *local_addr,
+                                 RIO_BUF *remote_addr, RIO_BUF *control, RIO_BUF *ret_flags,
+                                 DWORD flags, void *context )
+{
+    struct rio_rq *rq = (struct rio_rq *)handle;
+
+    TRACE( "rq %p, data %p, count %lu, local_addr %p, remote_addr %p, control %p, ret_flags %p, "
+           "flags %#lx, context %p\n",
+           handle, data, count, local_addr, remote_addr, control, ret_flags, flags, context );
+
+    if (handle == RIO_INVALID_RQ || count > 1)
+    {
+        SetLastError( WSAEINVAL );
+        return SOCKET_ERROR;
+    }
+    if (local_addr || control || ret_flags)
+        FIXME( "local address, control and flags buffers are ignored\n" );
+
+    if (!rio_submit( rq, rq->send_cq, FALSE, count ? data : NULL, remote_addr, flags, context ))
+        return SOCKET_ERROR;
+    return 0;
+}
+
+static ULONG WINAPI rio_RIODequeueCompletion( RIO_CQ handle, RIORESULT *results, ULONG count )
+{
+    struct rio_cq *cq = (struct rio_cq *)handle;
+    ULONG i, ret;
+
+    TRACE( "cq %p, results %p, count %lu\n", handle, results, count );
+
+    if (handle == RIO_INVALID_CQ || (count && !results))
+        return RIO_CORRUPT_CQ;
+
+    EnterCriticalSection( &cq->cs );
+    rio_cq_harvest( cq );
+    ret = min( count, cq->count );
+    for (i = 0; i < ret; ++i)
+        results[i] = cq->results[(cq->head + i) % cq->size];
+    cq->head = (cq->head + ret) % cq->size;
+    cq->count -= ret;
+    LeaveCriticalSection( &cq->cs );
+    return ret;
+}
+
+static int WINAPI rio_RIONotify( RIO_CQ handle )
+{
+    struct rio_cq *cq = (struct rio_cq *)handle;
+
+    TRACE( "cq %p\n", handle );
+
+    if (handle == RIO_INVALID_CQ)
+        return WSAEINVAL;
+
+    /* Without kernel-visible rings the notification cannot be signalled the
+     * moment a request completes; approximate it by harvesting here, so that
+     * a poll loop of RIONotify() + wait + RIODequeueCompletion() makes
+     * progress. */
+    EnterCriticalSection( &cq->cs );
+    rio_cq_harvest( cq );
+    if (cq->count && cq->have_notification && cq->notification.Type == RIO_EVENT_COMPLETION)
+        SetEvent( cq->notification.Event.EventHandle );
+    LeaveCriticalSection( &cq->cs );
+    return ERROR_SUCCESS;
+}
+
+void rio_get_extension_function_table( RIO_EXTENSION_FUNCTION_TABLE *table )
+{
+    table->cbSize = sizeof(*table);
+    table->RIOReceive = rio_RIOReceive;
+    table->RIOReceiveEx = rio_RIOReceiveEx;
+    table->RIOSend = rio_RIOSend;
+    table->RIOSendEx = rio_RIOSendEx;
+    table->RIOCloseCompletionQueue = rio_RIOCloseCompletionQueue;
+    table->RIOCreateCompletionQueue = rio_RIOCreateCompletionQueue;
+    table->RIOCreateRequestQueue = rio_RIOCreateRequestQueue;
+    table->RIODequeueCompletion = rio_RIODequeueCompletion;
+    table->RIODeregisterBuffer = rio_RIODeregisterBuffer;
+    table->RIONotify = rio_RIONotify;
+    table->RIORegisterBuffer = rio_RIORegisterBuffer;
+    table->RIOResizeCompletionQueue = rio_RIOResizeCompletionQueue;
+    table->RIOResizeRequestQueue = rio_RIOResizeRequestQueue;
+}
@@ -942,6 +942,88 @@ static BOOL WINAPI WS2_TransmitFile( SOCKET s, HANDLE file, DWORD file_len, DWOR
 }
 
 
+static BOOL WINAPI WS2_TransmitPackets( SOCKET s, TRANSMIT_PACKETS_ELEMENT *elements, DWORD count,
+                                        DWORD send_size, OVERLAPPED *overlapped, DWORD flags )
+{
+    struct afd_send_batch_params params;
+    IO_STATUS_BLOCK iosb, *piosb = &iosb;
+    struct afd_batch_buffer *buffers;
+    HANDLE event = NULL;
+    void *cvalue = NULL;
+    NTSTATUS status;
+    DWORD i;
+
+    TRACE( "socket %#Ix, elements %p, count %lu, send_size %lu, overlapped %p, flags %#lx\n",
+           s, elements, count, send_size, overlapped, flags );
+
+    if (!elements || !count)
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+
+    if (flags)
+        FIXME( "ignoring flags %#lx\n", flags );
+
+    if (!(buffers = malloc( count * sizeof(*buffers) )))
+    {
+        SetLastError( WSAENOBUFS );
+        return FALSE;
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        if (elements[i].dwElFlags & TP_ELEMENT_FILE)
+        {
+            FIXME( "file elements are not supported\n" );
+            free( buffers );
+            SetLastError( WSAEOPNOTSUPP );
+            return FALSE;
+        }
+        buffers[i].ptr = u64_from_user_ptr( elements[i].pBuffer );
+        buffers[i].len = elements[i].cLength;
+        buffers[i].end_of_packet = !!(elements[i].dwElFlags & TP_ELEMENT_EOP);
+    }
+
+    if (overlapped)
+    {
+        piosb = (IO_STATUS_BLOCK *)overlapped;
+        if (!((ULONG_PTR)overlapped->hEvent & 1)) cvalue = overlapped;
+        event = overlapped->hEvent;
+        overlapped->Internal = STATUS_PENDING;
+        overlapped->InternalHigh = 0;
+    }
+    else
+    {
+        if (!(event = get_sync_event()))
+        {
+            free( buffers );
+            return FALSE;
+        }
+    }
+
+    params.ws_flags = 0;
+    params.count = count;
+    params.buffers_ptr = u64_from_user_ptr( buffers );
+
+    status = NtDeviceIoControlFile( (HANDLE)s, event, NULL, cvalue, piosb,
+                                    IOCTL_AFD_WINE_SEND_BATCH, &params, sizeof(params), NULL, 0 );
+    if (status == STATUS_PENDING && !overlapped)
+    {
+        if (WaitForSingleObject( event, INFINITE ) == WAIT_FAILED)
+        {
+            free( buffers );
+            return FALSE;
+        }
+        status = piosb->Status;
+    }
+    free( buffers );
+    SetLastError( NtStatusToWSAError( status ) );
+    TRACE( "status %#lx.\n", status );
+    return !status;
+}
+
+
 /***********************************************************************
  *     GetAcceptExSockaddrs
  */
@@ -2565,7 +2647,7 @@ INT WINAPI WSAIoctl(SOCKET s, DWORD code, LPVOID in_buff, DWORD in_size, LPVOID
             EXTENSION_FUNCTION(WSAID_ACCEPTEX, WS2_AcceptEx)
             EXTENSION_FUNCTION(WSAID_GETACCEPTEXSOCKADDRS, WS2_GetAcceptExSockaddrs)
             EXTENSION_FUNCTION(WSAID_TRANSMITFILE, WS2_TransmitFile)
-            /* EXTENSION_FUNCTION(WSAID_TRANSMITPACKETS, WS2_TransmitPackets) */
+            EXTENSION_FUNCTION(WSAID_TRANSMITPACKETS, WS2_TransmitPackets)
             EXTENSION_FUNCTION(WSAID_WSARECVMSG, WS2_WSARecvMsg)
             EXTENSION_FUNCTION(WSAID_WSASENDMSG, WSASendMsg)
         };
@@ -2595,6 +2677,31 @@ INT WINAPI WSAIoctl(SOCKET s, DWORD code, LPVOID in_buff, DWORD in_size, LPVOID
         return -1;
     }
 
+    case SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER:
+    {
+        static const GUID rio_guid = WSAID_MULTIPLE_RIO;
+
+        if (in_size == sizeof(GUID) && IsEqualGUID( &rio_guid, in_buff )
+                && out_size >= sizeof(RIO_EXTENSION_FUNCTION_TABLE))
+        {
+            NTSTATUS status = STATUS_SUCCESS;
+            DWORD ret;
+
+            TRACE( "returning RIO extension function table\n" );
+            rio_get_extension_function_table( out_buff );
+
+            ret = server_ioctl_sock( s, IOCTL_AFD_WINE_COMPLETE_ASYNC, &status, sizeof(status),
+                                     NULL, 0, ret_size, overlapped, completion );
+            *ret_size = sizeof(RIO_EXTENSION_FUNCTION_TABLE);
+            SetLastError( ret );
+            return ret ? -1 : 0;
+        }
+
+        FIXME("SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER %s: stub\n", debugstr_guid(in_buff));
+        SetLastError( WSAEINVAL );
+        return -1;
+    }
+
     case SIO_KEEPALIVE_VALS:
     {
         DWORD ret;
@@ -0,0 +1,291 @@
+/*
+ * Unit tests for registered I/O
+ *
+ * Copyright 2026 the Wine developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stdarg.h>
+#include "windef.h"
+#include "winbase.h"
+#include "winsock2.h"
+#include "ws2tcpip.h"
+#include "mswsock.h"
+#include "wine/test.h"
+
+static RIO_EXTENSION_FUNCTION_TABLE rio;
+
+/* connect a pair of UDP sockets to each other through the loopback interface */
+static void udp_socketpair(SOCKET *src, SOCKET *dst)
+{
+    struct sockaddr_in src_addr, dst_addr;
+    int ret, len;
+
+    *src = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(*src != INVALID_SOCKET, "failed to create socket, error %u\n", WSAGetLastError());
+    *dst = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(*dst != INVALID_SOCKET, "failed to create socket, error %u\n", WSAGetLastError());
+
+    memset(&src_addr, 0, sizeof(src_addr));
+    src_addr.sin_family = AF_INET;
+    src_addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    dst_addr = src_addr;
+
+    ret = bind(*src, (struct sockaddr *)&src_addr, sizeof(src_addr));
+    ok(!ret, "failed to bind, error %u\n", WSAGetLastError());
+    ret = bind(*dst, (struct sockaddr *)&dst_addr, sizeof(dst_addr));
+    ok(!ret, "failed to bind, error %u\n", WSAGetLastError());
+
+    len = sizeof(src_addr);
+    ret = getsockname(*src, (struct sockaddr *)&src_addr, &len);
+    ok(!ret, "failed to get address, error %u\n", WSAGetLastError());
+    len = sizeof(dst_addr);
+    ret = getsockname(*dst, (struct sockaddr *)&dst_addr, &len);
+    ok(!ret, "failed to get address, error %u\n", WSAGetLastError());
+
+    ret = connect(*src, (struct sockaddr *)&dst_addr, sizeof(dst_addr));
+    ok(!ret, "failed to connect, error %u\n", WSAGetLastError());
+    ret = connect(*dst, (struct sockaddr *)&src_addr, sizeof(src_addr));
+    ok(!ret, "failed to connect, error %u\n", WSAGetLastError());
+}
+
+/* dequeue completions, polling for up to two seconds */
+static ULONG dequeue_completions(RIO_CQ cq, RIORESULT *results, ULONG count)
+{
+    ULONG ret;
+    DWORD i;
+
+    for (i = 0; i < 200; ++i)
+    {
+        if ((ret = rio.RIODequeueCompletion(cq, results, count))) return ret;
+        Sleep(10);
+    }
+    return 0;
+}
+
+static BOOL init_rio_functions(void)
+{
+    GUID guid = WSAID_MULTIPLE_RIO;
+    DWORD size;
+    SOCKET s;
+    int ret;
+
+    s = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(s != INVALID_SOCKET, "failed to create socket, error %u\n", WSAGetLastError());
+
+    memset(&rio, 0, sizeof(rio));
+    rio.cbSize = sizeof(rio);
+    ret = WSAIoctl(s, SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER, &guid, sizeof(guid),
+                   &rio, sizeof(rio), &size, NULL, NULL);
+    closesocket(s);
+    if (ret)
+    {
+        win_skip("RIO is not supported, error %u\n", WSAGetLastError());
+        return FALSE;
+    }
+
+    ok(rio.cbSize == sizeof(rio), "got size %lu\n", rio.cbSize);
+    ok(!!rio.RIOReceive, "expected RIOReceive\n");
+    ok(!!rio.RIOReceiveEx, "expected RIOReceiveEx\n");
+    ok(!!rio.RIOSend, "expected RIOSend\n");
+    ok(!!rio.RIOSendEx, "expected RIOSendEx\n");
+    ok(!!rio.RIOCloseCompletionQueue, "expected RIOCloseCompletionQueue\n");
+    ok(!!rio.RIOCreateCompletionQueue, "expected RIOCreateCompletionQueue\n");
+    ok(!!rio.RIOCreateRequestQueue, "expected RIOCreateRequestQueue\n");
+    ok(!!rio.RIODequeueCompletion, "expected RIODequeueCompletion\n");
+    ok(!!rio.RIODeregisterBuffer, "expected RIODeregisterBuffer\n");
+    ok(!!rio.RIONotify, "expected RIONotify\n");
+    ok(!!rio.RIORegisterBuffer, "expected RIORegisterBuffer\n");
+    ok(!!rio.RIOResizeCompletionQueue, "expected RIOResizeCompletionQueue\n");
+    ok(!!rio.RIOResizeRequestQueue, "expected RIOResizeRequestQueue\n");
+    return TRUE;
+}
+
+static void test_invalid_parameters(void)
+{
+    RIORESULT results[4];
+    RIO_BUFFERID buffer_id;
+    RIO_CQ cq;
+    ULONG ret;
+
+    buffer_id = rio.RIORegisterBuffer(NULL, 0);
+    ok(buffer_id == RIO_INVALID_BUFFERID, "expected failure\n");
+
+    cq = rio.RIOCreateCompletionQueue(0, NULL);
+    ok(cq == RIO_INVALID_CQ, "expected failure\n");
+
+    ret = rio.RIODequeueCompletion(RIO_INVALID_CQ, results, ARRAY_SIZE(results));
+    ok(ret == RIO_CORRUPT_CQ, "got %lu\n", ret);
+}
+
+static void test_send_and_receive(void)
+{
+    static const char message[] = "registered I/O test message";
+    RIO_CQ recv_cq, send_cq;
+    RIO_RQ recv_rq, send_rq;
+    RIO_BUFFERID buffer_id;
+    RIO_BUF rio_buf;
+    RIORESULT results[4];
+    SOCKET src, dst;
+    char *buffer;
+    ULONG count;
+    BOOL ret;
+
+    udp_socketpair(&src, &dst);
+
+    buffer = VirtualAlloc(NULL, 4096, MEM_COMMIT, PAGE_READWRITE);
+    ok(!!buffer, "failed to allocate buffer\n");
+    buffer_id = rio.RIORegisterBuffer(buffer, 4096);
+    ok(buffer_id != RIO_INVALID_BUFFERID, "failed to register buffer, error %u\n", WSAGetLastError());
+
+    recv_cq = rio.RIOCreateCompletionQueue(4, NULL);
+    ok(recv_cq != RIO_INVALID_CQ, "failed to create completion queue, error %u\n", WSAGetLastError());
+    send_cq = rio.RIOCreateCompletionQueue(4, NULL);
+    ok(send_cq != RIO_INVALID_CQ, "failed to create completion queue, error %u\n", WSAGetLastError());
+
+    recv_rq = rio.RIOCreateRequestQueue(dst, 2, 1, 2, 1, recv_cq, recv_cq, (void *)0xbeef);
+    ok(recv_rq != RIO_INVALID_RQ, "failed to create request queue, error %u\n", WSAGetLastError());
+    send_rq = rio.RIOCreateRequestQueue(src, 2, 1, 2, 1, send_cq, send_cq, (void *)0xcafe);
+    ok(send_rq != RIO_INVALID_RQ, "failed to create request queue, error %u\n", WSAGetLastError());
+
+    /* post a receive into the first kilobyte of the registered buffer */
+    rio_buf.BufferId = buffer_id;
+    rio_buf.Offset = 0;
+    rio_buf.Length = 1024;
+    ret = rio.RIOReceive(recv_rq, &rio_buf, 1, 0, (void *)1);
+    ok(ret, "failed to post receive, error %u\n", WSAGetLastError());
+
+    /* send from a different part of the same registered buffer */
+    memcpy(buffer + 2048, message, sizeof(message));
+    rio_buf.Offset = 2048;
+    rio_buf.Length = sizeof(message);
+    ret = rio.RIOSend(send_rq, &rio_buf, 1, 0, (void *)2);
+    ok(ret, "failed to send, error %u\n", WSAGetLastError());
+
+    count = dequeue_completions(send_cq, results, ARRAY_SIZE(results));
+    ok(count == 1, "got %lu send completions\n", count);
+    ok(!results[0].Status, "got status %ld\n", results[0].Status);
+    ok(results[0].BytesTransferred == sizeof(message), "got %lu bytes\n", results[0].BytesTransferred);
+    ok(results[0].SocketContext == 0xcafe, "got socket context %s\n",
+       wine_dbgstr_longlong(results[0].SocketContext));
+    ok(results[0].RequestContext == 2, "got request context %s\n",
+       wine_dbgstr_longlong(results[0].RequestContext));
+
+    count = dequeue_completions(recv_cq, results, ARRAY_SIZE(results));
+    ok(count == 1, "got %lu receive completions\n", count);
+    ok(!results[0].Status, "got status %ld\n", results[0].Status);
+    ok(results[0].BytesTransferred == sizeof(message), "got %lu bytes\n", results[0].BytesTransferred);
+    ok(results[0].SocketContext == 0xbeef, "got socket context %s\n",
+       wine_dbgstr_longlong(results[0].SocketContext));
+    ok(results[0].RequestContext == 1, "got request context %s\n",
+       wine_dbgstr_longlong(results[0].RequestContext));
+    ok(!memcmp(buffer, message, sizeof(message)), "message did not match\n");
+
+    /* the queues are empty again */
+    count = rio.RIODequeueCompletion(recv_cq, results, ARRAY_SIZE(results));
+    ok(!count, "got %lu completions\n", count);
+
+    rio.RIOCloseCompletionQueue(recv_cq);
+    rio.RIOCloseCompletionQueue(send_cq);
+    rio.RIODeregisterBuffer(buffer_id);
+    VirtualFree(buffer, 0, MEM_RELEASE);
+    closesocket(src);
+    closesocket(dst);
+}
+
+static void test_event_notification(void)
+{
+    static const char message[] = "ping";
+    RIO_NOTIFICATION_COMPLETION notification;
+    RIO_BUFFERID buffer_id;
+    RIORESULT results[4];
+    RIO_BUF rio_buf;
+    SOCKET src, dst;
+    char *buffer;
+    RIO_CQ cq;
+    RIO_RQ rq;
+    ULONG count;
+    DWORD i;
+    int ret;
+
+    udp_socketpair(&src, &dst);
+
+    buffer = VirtualAlloc(NULL, 4096, MEM_COMMIT, PAGE_READWRITE);
+    ok(!!buffer, "failed to allocate buffer\n");
+    buffer_id = rio.RIORegisterBuffer(buffer, 4096);
+    ok(buffer_id != RIO_INVALID_BUFFERID, "failed to register buffer, error %u\n", WSAGetLastError());
+
+    notification.Type = RIO_EVENT_COMPLETION;
+    notification.Event.EventHandle = CreateEventW(NULL, FALSE, FALSE, NULL);
+    notification.Event.NotifyReset = FALSE;
+    cq = rio.RIOCreateCompletionQueue(4, &notification);
+    ok(cq != RIO_INVALID_CQ, "failed to create completion queue, error %u\n", WSAGetLastError());
+
+    rq = rio.RIOCreateRequestQueue(dst, 2, 1, 2, 1, cq, cq, NULL);
+    ok(rq != RIO_INVALID_RQ, "failed to create request queue, error %u\n", WSAGetLastError());
+
+    rio_buf.BufferId = buffer_id;
+    rio_buf.Offset = 0;
+    rio_buf.Length = 1024;
+    ret = rio.RIOReceive(rq, &rio_buf, 1, 0, NULL);
+    ok(ret, "failed to post receive, error %u\n", WSAGetLastError());
+
+    ret = send(src, message, sizeof(message), 0);
+    ok(ret == sizeof(message), "failed to send, error %u\n", WSAGetLastError());
+
+    for (i = 0; i < 200; ++i)
+    {
+        /* rearming an already armed notification fails with WSAEALREADY */
+        ret = rio.RIONotify(cq);
+        ok(!ret || ret == WSAEALREADY, "got error %d\n", ret);
+        if (WaitForSingleObject(notification.Event.EventHandle, 10) == WAIT_OBJECT_0) break;
+    }
+    ok(i < 200, "timed out waiting for completion notification\n");
+
+    count = rio.RIODequeueCompletion(cq, results, ARRAY_SIZE(results));
+    ok(count == 1, "got %lu completions\n", count);
+    ok(!results[0].Status, "got status %ld\n", results[0].Status);
+    ok(results[0].BytesTransferred == sizeof(message), "got %lu bytes\n", results[0].BytesTransferred);
+    ok(!memcmp(buffer, message, sizeof(message)), "message did not match\n");
+
+    rio.RIOCloseCompletionQueue(cq);
+    rio.RIODeregisterBuffer(buffer_id);
+    CloseHandle(notification.Event.EventHandle);
+    VirtualFree(buffer, 0, MEM_RELEASE);
+    closesocket(src);
+    closesocket(dst);
+}
+
+START_TEST(rio)
+{
+    WSADATA data;
+    int ret;
+
+    ret = WSAStartup(MAKEWORD(2, 2), &data);
+    ok(!ret, "got %d\n", ret);
+
+    if (!init_rio_functions())
+    {
+        WSACleanup();
+        return;
+    }
+
+    test_invalid_parameters();
+    test_send_and_receive();
+    test_event_notification();
+
+    WSACleanup();
+}
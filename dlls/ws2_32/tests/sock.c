@@ -10132,6 +10132,97 @@ static void test_TransmitFile(void)
     closesocket(server);
 }
 
+static void test_TransmitPackets(void)
+{
+    GUID transmitPacketsGuid = WSAID_TRANSMITPACKETS;
+    LPFN_TRANSMITPACKETS pTransmitPackets = NULL;
+    char first_msg[] = "first packet", second_msg[] = "the second packet";
+    TRANSMIT_PACKETS_ELEMENT elements[2];
+    struct sockaddr_in addr;
+    SOCKET sender, receiver;
+    DWORD num_bytes, timeout;
+    WSAOVERLAPPED ov;
+    char buf[256];
+    int iret, len;
+    BOOL bret;
+
+    sender = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(sender != INVALID_SOCKET, "failed to create socket, error %lu\n", GetLastError());
+    receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(receiver != INVALID_SOCKET, "failed to create socket, error %lu\n", GetLastError());
+    iret = WSAIoctl(sender, SIO_GET_EXTENSION_FUNCTION_POINTER, &transmitPacketsGuid,
+                    sizeof(transmitPacketsGuid), &pTransmitPackets, sizeof(pTransmitPackets),
+                    &num_bytes, NULL, NULL);
+    ok(!iret, "failed to get TransmitPackets, error %lu\n", GetLastError());
+
+    memset(elements, 0, sizeof(elements));
+    elements[0].dwElFlags = TP_ELEMENT_MEMORY | TP_ELEMENT_EOP;
+    elements[0].cLength = sizeof(first_msg);
+    elements[0].pBuffer = first_msg;
+    elements[1].dwElFlags = TP_ELEMENT_MEMORY | TP_ELEMENT_EOP;
+    elements[1].cLength = sizeof(second_msg);
+    elements[1].pBuffer = second_msg;
+
+    /* Test TransmitPackets with an invalid socket */
+    bret = pTransmitPackets(INVALID_SOCKET, elements, 2, 0, NULL, 0);
+    ok(!bret, "TransmitPackets succeeded unexpectedly.\n");
+    ok(WSAGetLastError() == WSAENOTSOCK, "got error %d\n", WSAGetLastError());
+
+    /* Connect the sockets to each other so that datagram boundaries can be observed */
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    iret = bind(receiver, (struct sockaddr *)&addr, sizeof(addr));
+    ok(!iret, "failed to bind socket, error %lu\n", GetLastError());
+    len = sizeof(addr);
+    iret = getsockname(receiver, (struct sockaddr *)&addr, &len);
+    ok(!iret, "failed to get socket name, error %lu\n", GetLastError());
+    iret = connect(sender, (struct sockaddr *)&addr, sizeof(addr));
+    ok(!iret, "failed to connect, error %lu\n", GetLastError());
+    timeout = 2000;
+    iret = setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout, sizeof(timeout));
+    ok(!iret, "failed to set receive timeout, error %lu\n", GetLastError());
+
+    /* Each element marked with TP_ELEMENT_EOP becomes its own datagram */
+    bret = pTransmitPackets(sender, elements, 2, 0, NULL, 0);
+    ok(bret, "TransmitPackets failed, error %d\n", WSAGetLastError());
+    iret = recv(receiver, buf, sizeof(buf), 0);
+    ok(iret == sizeof(first_msg), "got %d bytes\n", iret);
+    ok(!memcmp(buf, first_msg, sizeof(first_msg)), "first packet did not match\n");
+    iret = recv(receiver, buf, sizeof(buf), 0);
+    ok(iret == sizeof(second_msg), "got %d bytes\n", iret);
+    ok(!memcmp(buf, second_msg, sizeof(second_msg)), "second packet did not match\n");
+
+    /* Elements without TP_ELEMENT_EOP are merged with the following one */
+    elements[0].dwElFlags = TP_ELEMENT_MEMORY;
+    bret = pTransmitPackets(sender, elements, 2, 0, NULL, 0);
+    ok(bret, "TransmitPackets failed, error %d\n", WSAGetLastError());
+    iret = recv(receiver, buf, sizeof(buf), 0);
+    ok(iret == sizeof(first_msg) + sizeof(second_msg), "got %d bytes\n", iret);
+    ok(!memcmp(buf, first_msg, sizeof(first_msg)), "first element did not match\n");
+    ok(!memcmp(buf + sizeof(first_msg), second_msg, sizeof(second_msg)),
+       "second element did not match\n");
+
+    /* Test overlapped TransmitPackets */
+    memset(&ov, 0, sizeof(ov));
+    ov.hEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+    elements[0].dwElFlags = TP_ELEMENT_MEMORY | TP_ELEMENT_EOP;
+    bret = pTransmitPackets(sender, elements, 2, 0, &ov, 0);
+    ok(bret || WSAGetLastError() == ERROR_IO_PENDING,
+       "TransmitPackets failed, error %d\n", WSAGetLastError());
+    bret = WSAGetOverlappedResult(sender, &ov, &num_bytes, TRUE, NULL);
+    ok(bret, "failed to get overlapped result, error %d\n", WSAGetLastError());
+    ok(num_bytes == sizeof(first_msg) + sizeof(second_msg), "got %lu bytes\n", num_bytes);
+    iret = recv(receiver, buf, sizeof(buf), 0);
+    ok(iret == sizeof(first_msg), "got %d bytes\n", iret);
+    iret = recv(receiver, buf, sizeof(buf), 0);
+    ok(iret == sizeof(second_msg), "got %d bytes\n", iret);
+
+    CloseHandle(ov.hEvent);
+    closesocket(sender);
+    closesocket(receiver);
+}
+
 static void test_getpeername(void)
 {
     SOCKET sock;
@@ -14583,6 +14674,7 @@ START_TEST( sock )
 
     test_ipv6only();
     test_TransmitFile();
+    test_TransmitPackets();
     test_AcceptEx();
     test_connect();
     test_shutdown();
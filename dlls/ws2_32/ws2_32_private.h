@@ -95,6 +95,8 @@ extern int num_startup;
 
 struct per_thread_data *get_per_thread_data(void);
 
+void rio_get_extension_function_table( RIO_EXTENSION_FUNCTION_TABLE *table );
+
 struct getaddrinfo_params
 {
     const char *node;
@@ -56,6 +56,7 @@ struct xinput_controller
     CRITICAL_SECTION crit;
     XINPUT_CAPABILITIES caps;
     XINPUT_STATE state;
+    LONG state_seq; /* sequence lock for lock-free state reads, odd while an update is in progress */
     XINPUT_GAMEPAD last_keystroke;
     XINPUT_VIBRATION vibration;
     HANDLE device;
@@ -646,8 +647,15 @@ static void read_controller_state(struct xinput_controller *controller)
     EnterCriticalSection(&controller->crit);
     if (controller->enabled)
     {
+        LONG seq = controller->state_seq;
+
         state.dwPacketNumber = controller->state.dwPacketNumber + 1;
+        /* writers are serialized by the controller lock; flag the update so
+         * lock-free readers retry instead of copying a torn state */
+        WriteNoFence( &controller->state_seq, seq + 1 );
+        MemoryBarrier();
         controller->state = state;
+        WriteRelease( &controller->state_seq, seq + 2 );
         memset(&controller->hid.read_ovl, 0, sizeof(controller->hid.read_ovl));
         controller->hid.read_ovl.hEvent = controller->hid.read_event;
         ret = ReadFile(controller->device, report_buf, report_len, NULL, &controller->hid.read_ovl);
@@ -838,16 +846,27 @@ DWORD WINAPI DECLSPEC_HOTPATCH XInputSetState(DWORD index, XINPUT_VIBRATION *vib
  * XInputGetState() in the hook, so we need a wrapper. */
 static DWORD xinput_get_state(DWORD index, XINPUT_STATE *state)
 {
+    struct xinput_controller *controller;
+    LONG seq;
+
     if (!state) return ERROR_BAD_ARGUMENTS;
 
     start_update_thread();
 
     if (index >= XUSER_MAX_COUNT) return ERROR_BAD_ARGUMENTS;
-    if (!controller_lock(&controllers[index])) return ERROR_DEVICE_NOT_CONNECTED;
+    controller = &controllers[index];
+    if (!controller->device) return ERROR_DEVICE_NOT_CONNECTED;
 
-    *state = controllers[index].state;
-    controller_unlock(&controllers[index]);
+    /* copy the state under the sequence lock rather than the controller lock,
+     * so per-frame polling doesn't block behind the update thread */
+    do
+    {
+        while ((seq = ReadAcquire( &controller->state_seq )) & 1) YieldProcessor();
+        *state = controller->state;
+        MemoryBarrier();
+    } while (ReadNoFence( &controller->state_seq ) != seq);
 
+    if (!controller->device) return ERROR_DEVICE_NOT_CONNECTED;
     return ERROR_SUCCESS;
 }
 
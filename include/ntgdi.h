@@ -248,6 +248,15 @@ struct font_fileinfo
     WCHAR path[1];
 };
 
+typedef struct _POLYPATBLT
+{
+    INT    x;
+    INT    y;
+    INT    cx;
+    INT    cy;
+    HBRUSH brush;  /* brush to use for this rectangle, or 0 for the current one */
+} POLYPATBLT;
+
 #pragma pack(push,1)
 struct fontdir
 {
@@ -444,6 +453,8 @@ W32KAPI BOOL     WINAPI NtGdiPlgBlt( HDC hdc, const POINT *point, HDC hdc_src, I
                                      INT width, INT height, HBITMAP mask, INT x_mask, INT y_mask,
                                      DWORD bk_color );
 W32KAPI BOOL     WINAPI NtGdiPolyDraw(HDC hdc, const POINT *points, const BYTE *types, DWORD count );
+W32KAPI BOOL     WINAPI NtGdiPolyPatBlt( HDC hdc, DWORD rop, const POLYPATBLT *blts, UINT count,
+                                         UINT mode );
 W32KAPI ULONG    WINAPI NtGdiPolyPolyDraw( HDC hdc, const POINT *points, const ULONG *counts,
                                            DWORD count, UINT function );
 W32KAPI BOOL     WINAPI NtGdiPtInRegion( HRGN hrgn, INT x, INT y );
@@ -291,6 +291,7 @@ C_ASSERT( sizeof(struct afd_get_events_params) == 56 );
 #define IOCTL_AFD_WINE_SET_TCP_KEEPCNT                  WINE_AFD_IOC(302)
 #define IOCTL_AFD_WINE_GET_TCP_KEEPINTVL                WINE_AFD_IOC(303)
 #define IOCTL_AFD_WINE_SET_TCP_KEEPINTVL                WINE_AFD_IOC(304)
+#define IOCTL_AFD_WINE_SEND_BATCH                       WINE_AFD_IOC(305)
 
 struct afd_iovec
 {
@@ -344,6 +345,22 @@ struct afd_sendmsg_params
 };
 C_ASSERT( sizeof(struct afd_sendmsg_params) == 32 );
 
+struct afd_batch_buffer
+{
+    ULONGLONG ptr;
+    unsigned int len;
+    unsigned int end_of_packet;
+};
+C_ASSERT( sizeof(struct afd_batch_buffer) == 16 );
+
+struct afd_send_batch_params
+{
+    unsigned int ws_flags;
+    unsigned int count;
+    ULONGLONG buffers_ptr; /* const struct afd_batch_buffer[] */
+};
+C_ASSERT( sizeof(struct afd_send_batch_params) == 16 );
+
 struct afd_transmit_params
 {
     LARGE_INTEGER offset;
@@ -360,6 +360,14 @@ struct filesystem_event
     char        name[1];
 };
 
+
+struct registry_event
+{
+    unsigned int change;
+    data_size_t  len;
+    WCHAR        name[1];
+};
+
 struct luid
 {
     unsigned int low_part;
@@ -966,8 +974,20 @@ typedef volatile struct
     struct shared_cursor cursor;
     unsigned char        keystate[256];
     unsigned __int64     monitor_serial;
+    unsigned __int64     vis_rgn_serial;
 } desktop_shm_t;
 
+struct shared_posted_msg
+{
+    user_handle_t        win;
+    unsigned int         msg;
+    lparam_t             wparam;
+    lparam_t             lparam;
+    unsigned int         time;
+    int                  x;
+    int                  y;
+};
+
 typedef volatile struct
 {
     int                  hooks_count[WH_MAX - WH_MIN + 2];
@@ -975,6 +995,13 @@ typedef volatile struct
     unsigned int         wake_bits;
     unsigned int         changed_mask;
     unsigned int         changed_bits;
+    unsigned int         posted_count;
+    unsigned int         posted_partial;
+    struct shared_posted_msg posted[8];
+    lparam_t             reply_result;
+    unsigned int         reply_error;
+    unsigned int         reply_seq;
+    unsigned int         wake_seq;
 } queue_shm_t;
 
 typedef volatile struct
@@ -991,6 +1018,7 @@ typedef volatile struct
     int                  cursor_count;
     unsigned char        keystate[256];
     int                  keystate_lock;
+    unsigned int         next_rawinput_size;
 } input_shm_t;
 
 typedef volatile struct
@@ -998,12 +1026,19 @@ typedef volatile struct
     unsigned int         dpi_context;
 } window_shm_t;
 
+typedef volatile struct
+{
+    unsigned int         signal_seq;
+    int                  signaled;
+} event_shm_t;
+
 typedef volatile union
 {
     desktop_shm_t        desktop;
     queue_shm_t          queue;
     input_shm_t          input;
     window_shm_t         window;
+    event_shm_t          event;
 } object_shm_t;
 
 typedef volatile struct
@@ -1015,6 +1050,9 @@ typedef volatile struct
 
 typedef volatile struct
 {
+    unsigned int regs_generation;
+    unsigned int atoms_generation;
+    unsigned int processes_generation;
     struct user_entry user_entries[MAX_USER_HANDLES];
 } session_shm_t;
 
@@ -1025,6 +1063,16 @@ struct obj_locator
 };
 
 
+struct request_stats
+{
+    unsigned __int64     calls;
+    unsigned __int64     errors;
+    unsigned __int64     ticks_total;
+    unsigned __int64     ticks_max;
+    unsigned int         histogram[32];
+};
+
+
 
 
 
@@ -1629,6 +1677,18 @@ struct open_event_reply
 };
 
 
+struct get_event_locator_request
+{
+    struct request_header __header;
+    obj_handle_t handle;
+};
+struct get_event_locator_reply
+{
+    struct reply_header __header;
+    struct obj_locator locator;
+};
+
+
 
 struct create_keyed_event_request
 {
@@ -2696,11 +2756,13 @@ struct set_registry_notification_request
     obj_handle_t event;
     int          subtree;
     unsigned int filter;
-    char __pad_28[4];
+    int          journal;
+    /* VARARG(path,unicode_str); */
 };
 struct set_registry_notification_reply
 {
     struct reply_header __header;
+    /* VARARG(changes,bytes); */
 };
 
 
@@ -3036,6 +3098,7 @@ enum message_type
     MSG_HOOK_LL
 };
 #define SEND_MSG_ABORT_IF_HUNG  0x01
+#define SEND_MSG_SHM_REPLY      0x02
 
 
 
@@ -3059,6 +3122,7 @@ struct send_hardware_message_reply
     char __pad_28[4];
 };
 #define SEND_HWMSG_INJECTED    0x01
+#define SEND_HWMSG_SHM_REPLY   0x02
 
 
 
@@ -4540,8 +4604,10 @@ struct set_clipboard_data_request
     struct request_header __header;
     unsigned int   format;
     unsigned int   lcid;
+    obj_handle_t   handle;
+    data_size_t    size;
     /* VARARG(data,bytes); */
-    char __pad_20[4];
+    char __pad_28[4];
 };
 struct set_clipboard_data_reply
 {
@@ -4568,7 +4634,9 @@ struct get_clipboard_data_reply
     user_handle_t  owner;
     unsigned int   seqno;
     data_size_t    total;
+    obj_handle_t   handle;
     /* VARARG(data,bytes); */
+    char __pad_28[4];
 };
 
 
@@ -5912,6 +5980,33 @@ struct set_keyboard_repeat_reply
 };
 
 
+
+struct pipeline_batch_request
+{
+    struct request_header __header;
+    /* VARARG(requests,bytes); */
+    char __pad_12[4];
+};
+struct pipeline_batch_reply
+{
+    struct reply_header __header;
+    /* VARARG(replies,bytes); */
+};
+
+
+
+struct get_request_stats_request
+{
+    struct request_header __header;
+    char __pad_12[4];
+};
+struct get_request_stats_reply
+{
+    struct reply_header __header;
+    /* VARARG(stats,bytes); */
+};
+
+
 enum request
 {
     REQ_new_process,
@@ -5948,6 +6043,7 @@ enum request
     REQ_event_op,
     REQ_query_event,
     REQ_open_event,
+    REQ_get_event_locator,
     REQ_create_keyed_event,
     REQ_open_keyed_event,
     REQ_create_mutex,
@@ -6208,6 +6304,8 @@ enum request
     REQ_get_next_process,
     REQ_get_next_thread,
     REQ_set_keyboard_repeat,
+    REQ_pipeline_batch,
+    REQ_get_request_stats,
     REQ_NB_REQUESTS
 };
 
@@ -6249,6 +6347,7 @@ union generic_request
     struct event_op_request event_op_request;
     struct query_event_request query_event_request;
     struct open_event_request open_event_request;
+    struct get_event_locator_request get_event_locator_request;
     struct create_keyed_event_request create_keyed_event_request;
     struct open_keyed_event_request open_keyed_event_request;
     struct create_mutex_request create_mutex_request;
@@ -6509,6 +6608,8 @@ union generic_request
     struct get_next_process_request get_next_process_request;
     struct get_next_thread_request get_next_thread_request;
     struct set_keyboard_repeat_request set_keyboard_repeat_request;
+    struct pipeline_batch_request pipeline_batch_request;
+    struct get_request_stats_request get_request_stats_request;
 };
 union generic_reply
 {
@@ -6548,6 +6649,7 @@ union generic_reply
     struct event_op_reply event_op_reply;
     struct query_event_reply query_event_reply;
     struct open_event_reply open_event_reply;
+    struct get_event_locator_reply get_event_locator_reply;
     struct create_keyed_event_reply create_keyed_event_reply;
     struct open_keyed_event_reply open_keyed_event_reply;
     struct create_mutex_reply create_mutex_reply;
@@ -6808,8 +6910,10 @@ union generic_reply
     struct get_next_process_reply get_next_process_reply;
     struct get_next_thread_reply get_next_thread_reply;
     struct set_keyboard_repeat_reply set_keyboard_repeat_reply;
+    struct pipeline_batch_reply pipeline_batch_reply;
+    struct get_request_stats_reply get_request_stats_reply;
 };
 
-#define SERVER_PROTOCOL_VERSION 877
+#define SERVER_PROTOCOL_VERSION 891
 
 #endif /* __WINE_WINE_SERVER_PROTOCOL_H */
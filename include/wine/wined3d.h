@@ -912,6 +912,7 @@ enum wined3d_memory_segment_group
 #define WINED3D_SWAPCHAIN_NO_WINDOW_CHANGES                     0x00040000u
 #define WINED3D_SWAPCHAIN_RESTORE_WINDOW_STATE                  0x00080000u
 #define WINED3D_SWAPCHAIN_REGISTER_TOPMOST_TIMER                0x00100000u
+#define WINED3D_SWAPCHAIN_LATENCY_WAITABLE                      0x00200000u
 
 #define WINED3DDP_MAXTEXCOORD                                   8
 
@@ -1866,6 +1867,24 @@ struct wined3d_raster_status
     UINT scan_line;
 };
 
+struct wined3d_present_stats
+{
+    UINT present_count;
+    LARGE_INTEGER present_time;
+};
+
+/* Process-wide performance counters, aggregated over all devices. The
+ * counters increase monotonically; consumers are expected to compute
+ * deltas between snapshots. */
+struct wined3d_statistics
+{
+    UINT cs_queue_submits;
+    UINT cs_queue_stalls;
+    UINT64 mapped_bytes;
+    UINT pipeline_compiles;
+    UINT fence_waits;
+};
+
 struct wined3d_map_desc
 {
     UINT row_pitch;
@@ -2348,6 +2367,7 @@ UINT __cdecl wined3d_get_adapter_count(const struct wined3d *wined3d);
 HRESULT __cdecl wined3d_get_device_caps(const struct wined3d_adapter *adapter,
         enum wined3d_device_type device_type, struct wined3d_caps *caps);
 enum wined3d_renderer __cdecl wined3d_get_renderer(void);
+void __cdecl wined3d_get_statistics(struct wined3d_statistics *stats);
 ULONG __cdecl wined3d_incref(struct wined3d *wined3d);
 HRESULT __cdecl wined3d_register_software_device(struct wined3d *wined3d, void *init_function);
 BOOL __cdecl wined3d_register_window(struct wined3d *wined3d, HWND window,
@@ -2898,6 +2918,8 @@ HRESULT __cdecl wined3d_swapchain_get_gamma_ramp(const struct wined3d_swapchain
 void * __cdecl wined3d_swapchain_get_parent(const struct wined3d_swapchain *swapchain);
 void __cdecl wined3d_swapchain_get_desc(const struct wined3d_swapchain *swapchain,
         struct wined3d_swapchain_desc *desc);
+void __cdecl wined3d_swapchain_get_present_stats(struct wined3d_swapchain *swapchain,
+        struct wined3d_present_stats *stats);
 HRESULT __cdecl wined3d_swapchain_get_raster_status(const struct wined3d_swapchain *swapchain,
         struct wined3d_raster_status *raster_status);
 struct wined3d_swapchain_state * __cdecl wined3d_swapchain_get_state(struct wined3d_swapchain *swapchain);
@@ -2910,6 +2932,7 @@ HRESULT __cdecl wined3d_swapchain_resize_buffers(struct wined3d_swapchain *swapc
 HRESULT __cdecl wined3d_swapchain_set_gamma_ramp(const struct wined3d_swapchain *swapchain,
         uint32_t flags, const struct wined3d_gamma_ramp *ramp);
 void __cdecl wined3d_swapchain_set_palette(struct wined3d_swapchain *swapchain, struct wined3d_palette *palette);
+void __cdecl wined3d_swapchain_set_present_semaphore(struct wined3d_swapchain *swapchain, HANDLE semaphore);
 void __cdecl wined3d_swapchain_set_window(struct wined3d_swapchain *swapchain, HWND window);
 
 HRESULT __cdecl wined3d_swapchain_state_create(const struct wined3d_swapchain_desc *desc,
@@ -2702,6 +2702,29 @@ typedef struct _RTL_HEAP_PARAMETERS
     SIZE_T Reserved[2];
 } RTL_HEAP_PARAMETERS, *PRTL_HEAP_PARAMETERS;
 
+#ifdef __WINESRC__
+
+/* information returned for the Wine-specific HeapWineAllocationSampling
+ * RtlQueryHeapInformation class; RtlSetHeapInformation takes a ULONG rate */
+typedef struct _HEAP_ALLOCATION_SAMPLE
+{
+    ULONG64  size;       /* requested allocation size */
+    ULONG    sequence;   /* running sample count when the sample was taken */
+    USHORT   depth;      /* number of captured return addresses */
+    USHORT   pad;
+    void    *stack[16];  /* call stack of the sampled allocation */
+} HEAP_ALLOCATION_SAMPLE;
+
+typedef struct _HEAP_ALLOCATION_SAMPLING
+{
+    ULONG rate;          /* one in every rate allocations is sampled, 0 disables sampling */
+    ULONG count;         /* number of entries returned in samples */
+    ULONG total;         /* samples recorded since sampling was enabled, including overwritten ones */
+    HEAP_ALLOCATION_SAMPLE samples[1];
+} HEAP_ALLOCATION_SAMPLING;
+
+#endif /* __WINESRC__ */
+
 typedef struct _RTL_RWLOCK {
     RTL_CRITICAL_SECTION rtlCS;
 
@@ -1264,11 +1264,11 @@ uint32_t FAudioVoice_SetOutputVoices(
 		{
 			if (outChannels == 1)
 			{
-				voice->sendMix[i] = FAudio_INTERNAL_Mix_1in_1out_Scalar;
+				voice->sendMix[i] = FAudio_INTERNAL_Mix_1in_1out;
 			}
 			else if (outChannels == 2)
 			{
-				voice->sendMix[i] = FAudio_INTERNAL_Mix_1in_2out_Scalar;
+				voice->sendMix[i] = FAudio_INTERNAL_Mix_1in_2out;
 			}
 			else if (outChannels == 6)
 			{
@@ -1287,11 +1287,11 @@ uint32_t FAudioVoice_SetOutputVoices(
 		{
 			if (outChannels == 1)
 			{
-				voice->sendMix[i] = FAudio_INTERNAL_Mix_2in_1out_Scalar;
+				voice->sendMix[i] = FAudio_INTERNAL_Mix_2in_1out;
 			}
 			else if (outChannels == 2)
 			{
-				voice->sendMix[i] = FAudio_INTERNAL_Mix_2in_2out_Scalar;
+				voice->sendMix[i] = FAudio_INTERNAL_Mix_2in_2out;
 			}
 			else if (outChannels == 6)
 			{
@@ -737,6 +737,10 @@ extern void (*FAudio_INTERNAL_Amplify)(
 );
 
 extern FAudioMixCallback FAudio_INTERNAL_Mix_Generic;
+extern FAudioMixCallback FAudio_INTERNAL_Mix_1in_1out;
+extern FAudioMixCallback FAudio_INTERNAL_Mix_1in_2out;
+extern FAudioMixCallback FAudio_INTERNAL_Mix_2in_1out;
+extern FAudioMixCallback FAudio_INTERNAL_Mix_2in_2out;
 
 #define MIX_FUNC(type) \
 	extern void FAudio_INTERNAL_Mix_##type##_Scalar( \
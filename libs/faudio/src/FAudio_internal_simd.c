@@ -1543,6 +1543,155 @@ void FAudio_INTERNAL_Mix_2in_8out_Scalar(
 	}
 }
 
+#if HAVE_SSE2_INTRINSICS
+void FAudio_INTERNAL_Mix_1in_1out_SSE2(
+	uint32_t toMix,
+	uint32_t UNUSED1,
+	uint32_t UNUSED2,
+	float *restrict src,
+	float *restrict dst,
+	float *restrict coefficients
+) {
+	uint32_t i;
+	const uint32_t tail = toMix % 4;
+	const __m128 vol = _mm_set1_ps(coefficients[0]);
+	for (i = 0; i < toMix - tail; i += 4, src += 4, dst += 4)
+	{
+		_mm_storeu_ps(dst, _mm_add_ps(
+			_mm_loadu_ps(dst),
+			_mm_mul_ps(_mm_loadu_ps(src), vol)
+		));
+	}
+	for (; i < toMix; i += 1, src += 1, dst += 1)
+	{
+		dst[0] += src[0] * coefficients[0];
+	}
+}
+
+void FAudio_INTERNAL_Mix_1in_2out_SSE2(
+	uint32_t toMix,
+	uint32_t UNUSED1,
+	uint32_t UNUSED2,
+	float *restrict src,
+	float *restrict dst,
+	float *restrict coefficients
+) {
+	uint32_t i;
+	const uint32_t tail = toMix % 4;
+	const __m128 vol = _mm_setr_ps(
+		coefficients[0],
+		coefficients[1],
+		coefficients[0],
+		coefficients[1]
+	);
+	for (i = 0; i < toMix - tail; i += 4, src += 4, dst += 8)
+	{
+		const __m128 dat = _mm_loadu_ps(src);
+		/* (s0, s0, s1, s1) and (s2, s2, s3, s3) */
+		const __m128 lo = _mm_unpacklo_ps(dat, dat);
+		const __m128 hi = _mm_unpackhi_ps(dat, dat);
+		_mm_storeu_ps(dst, _mm_add_ps(
+			_mm_loadu_ps(dst),
+			_mm_mul_ps(lo, vol)
+		));
+		_mm_storeu_ps(dst + 4, _mm_add_ps(
+			_mm_loadu_ps(dst + 4),
+			_mm_mul_ps(hi, vol)
+		));
+	}
+	for (; i < toMix; i += 1, src += 1, dst += 2)
+	{
+		dst[0] += src[0] * coefficients[0];
+		dst[1] += src[0] * coefficients[1];
+	}
+}
+
+void FAudio_INTERNAL_Mix_2in_1out_SSE2(
+	uint32_t toMix,
+	uint32_t UNUSED1,
+	uint32_t UNUSED2,
+	float *restrict src,
+	float *restrict dst,
+	float *restrict coefficients
+) {
+	uint32_t i;
+	const uint32_t tail = toMix % 2;
+	const __m128 vol = _mm_setr_ps(
+		coefficients[0],
+		coefficients[1],
+		coefficients[0],
+		coefficients[1]
+	);
+	for (i = 0; i < toMix - tail; i += 2, src += 4, dst += 2)
+	{
+		/* (s0c0, s1c1, s2c0, s3c1) -> pairwise sums in lanes 0 and 2 */
+		const __m128 prod = _mm_mul_ps(_mm_loadu_ps(src), vol);
+		const __m128 sums = _mm_add_ps(
+			prod,
+			_mm_shuffle_ps(prod, prod, _MM_SHUFFLE(2, 3, 0, 1))
+		);
+		dst[0] += _mm_cvtss_f32(sums);
+		dst[1] += _mm_cvtss_f32(_mm_movehl_ps(sums, sums));
+	}
+	for (; i < toMix; i += 1, src += 2, dst += 1)
+	{
+		dst[0] += (
+			(src[0] * coefficients[0]) +
+			(src[1] * coefficients[1])
+		);
+	}
+}
+
+void FAudio_INTERNAL_Mix_2in_2out_SSE2(
+	uint32_t toMix,
+	uint32_t UNUSED1,
+	uint32_t UNUSED2,
+	float *restrict src,
+	float *restrict dst,
+	float *restrict coefficients
+) {
+	uint32_t i;
+	const uint32_t tail = toMix % 2;
+	const __m128 volL = _mm_setr_ps(
+		coefficients[0],
+		coefficients[2],
+		coefficients[0],
+		coefficients[2]
+	);
+	const __m128 volR = _mm_setr_ps(
+		coefficients[1],
+		coefficients[3],
+		coefficients[1],
+		coefficients[3]
+	);
+	for (i = 0; i < toMix - tail; i += 2, src += 4, dst += 4)
+	{
+		const __m128 dat = _mm_loadu_ps(src);
+		/* (s0, s0, s2, s2) and (s1, s1, s3, s3) */
+		const __m128 left = _mm_shuffle_ps(dat, dat, _MM_SHUFFLE(2, 2, 0, 0));
+		const __m128 right = _mm_shuffle_ps(dat, dat, _MM_SHUFFLE(3, 3, 1, 1));
+		_mm_storeu_ps(dst, _mm_add_ps(
+			_mm_loadu_ps(dst),
+			_mm_add_ps(
+				_mm_mul_ps(left, volL),
+				_mm_mul_ps(right, volR)
+			)
+		));
+	}
+	for (; i < toMix; i += 1, src += 2, dst += 2)
+	{
+		dst[0] += (
+			(src[0] * coefficients[0]) +
+			(src[1] * coefficients[1])
+		);
+		dst[1] += (
+			(src[0] * coefficients[2]) +
+			(src[1] * coefficients[3])
+		);
+	}
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
 /* SECTION 5: InitSIMDFunctions. Assigns based on SSE2/NEON support. */
 
 void (*FAudio_INTERNAL_Convert_U8_To_F32)(
@@ -1571,6 +1720,10 @@ void (*FAudio_INTERNAL_Amplify)(
 );
 
 FAudioMixCallback FAudio_INTERNAL_Mix_Generic;
+FAudioMixCallback FAudio_INTERNAL_Mix_1in_1out;
+FAudioMixCallback FAudio_INTERNAL_Mix_1in_2out;
+FAudioMixCallback FAudio_INTERNAL_Mix_2in_1out;
+FAudioMixCallback FAudio_INTERNAL_Mix_2in_2out;
 
 void FAudio_INTERNAL_InitSIMDFunctions(uint8_t hasSSE2, uint8_t hasNEON)
 {
@@ -1584,6 +1737,10 @@ void FAudio_INTERNAL_InitSIMDFunctions(uint8_t hasSSE2, uint8_t hasNEON)
 		FAudio_INTERNAL_ResampleStereo = FAudio_INTERNAL_ResampleStereo_SSE2;
 		FAudio_INTERNAL_Amplify = FAudio_INTERNAL_Amplify_SSE2;
 		FAudio_INTERNAL_Mix_Generic = FAudio_INTERNAL_Mix_Generic_SSE2;
+		FAudio_INTERNAL_Mix_1in_1out = FAudio_INTERNAL_Mix_1in_1out_SSE2;
+		FAudio_INTERNAL_Mix_1in_2out = FAudio_INTERNAL_Mix_1in_2out_SSE2;
+		FAudio_INTERNAL_Mix_2in_1out = FAudio_INTERNAL_Mix_2in_1out_SSE2;
+		FAudio_INTERNAL_Mix_2in_2out = FAudio_INTERNAL_Mix_2in_2out_SSE2;
 		return;
 	}
 #endif
@@ -1597,6 +1754,10 @@ void FAudio_INTERNAL_InitSIMDFunctions(uint8_t hasSSE2, uint8_t hasNEON)
 		FAudio_INTERNAL_ResampleStereo = FAudio_INTERNAL_ResampleStereo_NEON;
 		FAudio_INTERNAL_Amplify = FAudio_INTERNAL_Amplify_NEON;
 		FAudio_INTERNAL_Mix_Generic = FAudio_INTERNAL_Mix_Generic_Scalar;
+		FAudio_INTERNAL_Mix_1in_1out = FAudio_INTERNAL_Mix_1in_1out_Scalar;
+		FAudio_INTERNAL_Mix_1in_2out = FAudio_INTERNAL_Mix_1in_2out_Scalar;
+		FAudio_INTERNAL_Mix_2in_1out = FAudio_INTERNAL_Mix_2in_1out_Scalar;
+		FAudio_INTERNAL_Mix_2in_2out = FAudio_INTERNAL_Mix_2in_2out_Scalar;
 		return;
 	}
 #endif
@@ -1608,6 +1769,10 @@ void FAudio_INTERNAL_InitSIMDFunctions(uint8_t hasSSE2, uint8_t hasNEON)
 	FAudio_INTERNAL_ResampleStereo = FAudio_INTERNAL_ResampleStereo_Scalar;
 	FAudio_INTERNAL_Amplify = FAudio_INTERNAL_Amplify_Scalar;
 	FAudio_INTERNAL_Mix_Generic = FAudio_INTERNAL_Mix_Generic_Scalar;
+	FAudio_INTERNAL_Mix_1in_1out = FAudio_INTERNAL_Mix_1in_1out_Scalar;
+	FAudio_INTERNAL_Mix_1in_2out = FAudio_INTERNAL_Mix_1in_2out_Scalar;
+	FAudio_INTERNAL_Mix_2in_1out = FAudio_INTERNAL_Mix_2in_1out_Scalar;
+	FAudio_INTERNAL_Mix_2in_2out = FAudio_INTERNAL_Mix_2in_2out_Scalar;
 #else
 	FAudio_assert(0 && "Need converter functions!");
 #endif
@@ -2362,26 +2362,143 @@ static HRESULT vkd3d_create_vk_device(struct d3d12_device *device,
     return hr;
 }
 
+/* Path of the on-disk copy of the pipeline cache, keyed by adapter and
+ * driver version. The cache data's own header covers the rest; drivers
+ * ignore data recorded by an incompatible implementation. */
+static char *d3d12_device_pipeline_cache_path(struct d3d12_device *device)
+{
+    const struct vkd3d_vk_instance_procs *vk_procs = &device->vkd3d_instance->vk_procs;
+    VkPhysicalDeviceProperties properties;
+    const char *dir;
+    char *path;
+
+    if (!(dir = getenv("LOCALAPPDATA")) && !(dir = getenv("TEMP")))
+        return NULL;
+
+    VK_CALL(vkGetPhysicalDeviceProperties(device->vk_physical_device, &properties));
+
+    if (!(path = vkd3d_malloc(strlen(dir) + 64)))
+        return NULL;
+    sprintf(path, "%s\\vkd3d-pipeline-cache-%08x-%08x-%08x.bin",
+            dir, properties.vendorID, properties.deviceID, properties.driverVersion);
+    return path;
+}
+
+static void *d3d12_device_load_pipeline_cache_data(struct d3d12_device *device, size_t *size)
+{
+    void *data = NULL;
+    char *path;
+    long file_size;
+    FILE *f;
+
+    if (!(path = d3d12_device_pipeline_cache_path(device)))
+        return NULL;
+
+    if ((f = fopen(path, "rb")))
+    {
+        if (!fseek(f, 0, SEEK_END) && (file_size = ftell(f)) > 0 && !fseek(f, 0, SEEK_SET)
+                && (data = vkd3d_malloc(file_size)))
+        {
+            if (fread(data, 1, file_size, f) == (size_t)file_size)
+            {
+                TRACE("Read %ld bytes of pipeline cache data from %s.\n", file_size, path);
+                *size = file_size;
+            }
+            else
+            {
+                vkd3d_free(data);
+                data = NULL;
+            }
+        }
+        fclose(f);
+    }
+    vkd3d_free(path);
+    return data;
+}
+
+static void d3d12_device_store_pipeline_cache(struct d3d12_device *device)
+{
+    const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
+    char *path, *tmp_path;
+    size_t size;
+    void *data;
+    FILE *f;
+
+    if (!device->vk_pipeline_cache || !(path = d3d12_device_pipeline_cache_path(device)))
+        return;
+
+    if (VK_CALL(vkGetPipelineCacheData(device->vk_device, device->vk_pipeline_cache, &size, NULL)) < 0
+            || !size || !(data = vkd3d_malloc(size)))
+    {
+        vkd3d_free(path);
+        return;
+    }
+
+    if (VK_CALL(vkGetPipelineCacheData(device->vk_device, device->vk_pipeline_cache, &size, data)) >= 0
+            && (tmp_path = vkd3d_malloc(strlen(path) + 5)))
+    {
+        /* Write to a temporary file first, so that a dying process can't
+         * leave a truncated cache behind. */
+        sprintf(tmp_path, "%s.tmp", path);
+        if ((f = fopen(tmp_path, "wb")))
+        {
+            bool ok = fwrite(data, 1, size, f) == size;
+
+            fclose(f);
+            if (ok)
+            {
+                remove(path);
+                if (!rename(tmp_path, path))
+                    TRACE("Wrote %zu bytes of pipeline cache data to %s.\n", size, path);
+                else
+                    WARN("Failed to move pipeline cache into place at %s.\n", path);
+            }
+            else
+            {
+                WARN("Failed to write pipeline cache data to %s.\n", tmp_path);
+                remove(tmp_path);
+            }
+        }
+        vkd3d_free(tmp_path);
+    }
+
+    vkd3d_free(data);
+    vkd3d_free(path);
+}
+
 static HRESULT d3d12_device_init_pipeline_cache(struct d3d12_device *device)
 {
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
     VkPipelineCacheCreateInfo cache_info;
+    size_t initial_data_size = 0;
+    void *initial_data;
     VkResult vr;
 
     vkd3d_mutex_init(&device->pipeline_cache_mutex);
 
+    initial_data = d3d12_device_load_pipeline_cache_data(device, &initial_data_size);
+
     cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
     cache_info.pNext = NULL;
     cache_info.flags = 0;
-    cache_info.initialDataSize = 0;
-    cache_info.pInitialData = NULL;
+    cache_info.initialDataSize = initial_data_size;
+    cache_info.pInitialData = initial_data;
     if ((vr = VK_CALL(vkCreatePipelineCache(device->vk_device, &cache_info, NULL,
-            &device->vk_pipeline_cache))) < 0)
+            &device->vk_pipeline_cache))) < 0 && cache_info.pInitialData)
+    {
+        WARN("Failed to create Vulkan pipeline cache from disk data, vr %d.\n", vr);
+        cache_info.initialDataSize = 0;
+        cache_info.pInitialData = NULL;
+        vr = VK_CALL(vkCreatePipelineCache(device->vk_device, &cache_info, NULL,
+                &device->vk_pipeline_cache));
+    }
+    if (vr < 0)
     {
         ERR("Failed to create Vulkan pipeline cache, vr %d.\n", vr);
         device->vk_pipeline_cache = VK_NULL_HANDLE;
     }
 
+    vkd3d_free(initial_data);
     return S_OK;
 }
 
@@ -2390,7 +2507,10 @@ static void d3d12_device_destroy_pipeline_cache(struct d3d12_device *device)
     const struct vkd3d_vk_device_procs *vk_procs = &device->vk_procs;
 
     if (device->vk_pipeline_cache)
+    {
+        d3d12_device_store_pipeline_cache(device);
         VK_CALL(vkDestroyPipelineCache(device->vk_device, device->vk_pipeline_cache, NULL));
+    }
 
     vkd3d_mutex_destroy(&device->pipeline_cache_mutex);
 }
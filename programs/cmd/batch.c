@@ -81,6 +81,7 @@ RETURN_CODE WCMD_call_batch(const WCHAR *file, WCHAR *command)
     prev_context = context;
     context = malloc(sizeof (BATCH_CONTEXT));
     context->file_position.QuadPart = 0;
+    context->file = INVALID_HANDLE_VALUE;
     context->batchfileW = xstrdupW(file);
     context->command = command;
     memset(context->shift_count, 0x00, sizeof(context->shift_count));
@@ -89,6 +90,7 @@ RETURN_CODE WCMD_call_batch(const WCHAR *file, WCHAR *command)
 
     return_code = WCMD_batch_main_loop();
 
+    if (context->file != INVALID_HANDLE_VALUE) CloseHandle(context->file);
     free(context->batchfileW);
     free(context);
     context = prev_context;
@@ -645,6 +647,7 @@ RETURN_CODE WCMD_call(WCHAR *command)
         prev_context = context;
         context = malloc(sizeof (BATCH_CONTEXT));
         context->file_position = prev_context->file_position; /* will be overwritten by WCMD_GOTO below */
+        context->file = INVALID_HANDLE_VALUE;
         context->batchfileW = prev_context->batchfileW;
         context->command = buffer;
         memset(context->shift_count, 0x00, sizeof(context->shift_count));
@@ -657,6 +660,7 @@ RETURN_CODE WCMD_call(WCHAR *command)
 
         WCMD_batch_main_loop();
 
+        if (context->file != INVALID_HANDLE_VALUE) CloseHandle(context->file);
         free(context);
         context = prev_context;
         return_code = errorlevel;
@@ -679,58 +683,135 @@ void WCMD_set_label_end(WCHAR *string)
     if ((p = wcspbrk(string, labelEndsW))) *p = L'\0';
 }
 
-static BOOL find_next_label(HANDLE h, ULONGLONG end, WCHAR candidate[MAXSTRING], UINT code_page)
+/* if the line is a label, reduces it in place to the label name and returns TRUE */
+static BOOL line_is_label(WCHAR *candidate)
 {
-    while (WCMD_fgets_helper(candidate, MAXSTRING, h, code_page))
-    {
-        WCHAR *str = candidate;
+    WCHAR *str = candidate;
 
-        /* Ignore leading whitespace or no-echo character */
-        while (*str == L'@' || iswspace(*str)) str++;
+    /* Ignore leading whitespace or no-echo character */
+    while (*str == L'@' || iswspace(*str)) str++;
 
-        /* If the first real character is a : then this is a label */
-        if (*str == L':')
-        {
-            /* Skip spaces between : and label */
-            for (str++; iswspace(*str); str++) {}
-            memmove(candidate, str, (wcslen(str) + 1) * sizeof(WCHAR));
-            WCMD_set_label_end(candidate);
+    /* If the first real character is a : then this is a label */
+    if (*str != L':') return FALSE;
 
-            return TRUE;
-        }
-        if (end)
+    /* Skip spaces between : and label */
+    for (str++; iswspace(*str); str++) {}
+    memmove(candidate, str, (wcslen(str) + 1) * sizeof(WCHAR));
+    WCMD_set_label_end(candidate);
+
+    return TRUE;
+}
+
+struct label_entry
+{
+    WCHAR *name;
+    LARGE_INTEGER line_start;   /* file position of the start of the label line */
+    LARGE_INTEGER next_line;    /* file position of the line following the label */
+};
+
+/* index of all the labels in a batch file, so that repeated goto's don't have
+ * to rescan it; a single slot is enough to cover the running batch file, and
+ * the index is rebuilt whenever the file changes */
+static struct
+{
+    BOOL valid;
+    BY_HANDLE_FILE_INFORMATION info;   /* identifies the indexed file and its version */
+    struct label_entry *entries;
+    unsigned int count;
+    unsigned int capacity;
+} label_index;
+
+static BOOL label_index_up_to_date(const BY_HANDLE_FILE_INFORMATION *info)
+{
+    return label_index.valid &&
+        label_index.info.dwVolumeSerialNumber == info->dwVolumeSerialNumber &&
+        label_index.info.nFileIndexHigh == info->nFileIndexHigh &&
+        label_index.info.nFileIndexLow == info->nFileIndexLow &&
+        label_index.info.nFileSizeHigh == info->nFileSizeHigh &&
+        label_index.info.nFileSizeLow == info->nFileSizeLow &&
+        !CompareFileTime(&label_index.info.ftLastWriteTime, &info->ftLastWriteTime);
+}
+
+static BOOL build_label_index(HANDLE h, const BY_HANDLE_FILE_INFORMATION *info, UINT code_page)
+{
+    LARGE_INTEGER zeroli = {.QuadPart = 0}, start, next;
+    WCHAR candidate[MAXSTRING];
+    unsigned int i;
+
+    for (i = 0; i < label_index.count; i++) free(label_index.entries[i].name);
+    label_index.count = 0;
+    label_index.valid = FALSE;
+
+    if (!SetFilePointerEx(h, zeroli, &start, FILE_BEGIN)) return FALSE;
+    while (WCMD_fgets_helper(candidate, MAXSTRING, h, code_page))
+    {
+        if (!SetFilePointerEx(h, zeroli, &next, FILE_CURRENT)) return FALSE;
+        if (line_is_label(candidate))
         {
-            LARGE_INTEGER li = {.QuadPart = 0}, curli;
-            if (!SetFilePointerEx(h, li, &curli, FILE_CURRENT)) return FALSE;
-            if (curli.QuadPart > end) break;
+            struct label_entry *entry;
+
+            if (label_index.count == label_index.capacity)
+            {
+                label_index.capacity = label_index.capacity ? label_index.capacity * 2 : 16;
+                label_index.entries = xrealloc(label_index.entries,
+                                               label_index.capacity * sizeof(*label_index.entries));
+            }
+            entry = &label_index.entries[label_index.count++];
+            entry->name = xstrdupW(candidate);
+            entry->line_start = start;
+            entry->next_line = next;
+            TRACE("indexed label %s\n", wine_dbgstr_w(candidate));
         }
+        start = next;
     }
-    return FALSE;
+    label_index.info = *info;
+    label_index.valid = TRUE;
+    return TRUE;
 }
 
 BOOL WCMD_find_label(HANDLE h, const WCHAR *label, LARGE_INTEGER *pos)
 {
-    LARGE_INTEGER where = *pos, zeroli = {.QuadPart = 0};
-    WCHAR candidate[MAXSTRING];
-    UINT code_page = get_current_code_page();
+    BY_HANDLE_FILE_INFORMATION info;
+    struct label_entry *fallback = NULL;
+    unsigned int i;
 
     if (!*label) return FALSE;
 
-    if (!SetFilePointerEx(h, *pos, NULL, FILE_BEGIN)) return FALSE;
-    while (find_next_label(h, ~(ULONGLONG)0, candidate, code_page))
+    if (!GetFileInformationByHandle(h, &info)) return FALSE;
+    if (!label_index_up_to_date(&info) && !build_label_index(h, &info, get_current_code_page()))
+        return FALSE;
+
+    /* first matching label at or after the current position, wrapping around
+     * to the beginning of the file if there is none */
+    for (i = 0; i < label_index.count; i++)
     {
-        TRACE("comparing found label %s\n", wine_dbgstr_w(candidate));
-        if (!lstrcmpiW(candidate, label))
-            return SetFilePointerEx(h, zeroli, pos, FILE_CURRENT);
+        struct label_entry *entry = &label_index.entries[i];
+
+        if (lstrcmpiW(entry->name, label)) continue;
+        if (entry->line_start.QuadPart >= pos->QuadPart)
+        {
+            *pos = entry->next_line;
+            return TRUE;
+        }
+        if (!fallback) fallback = entry;
     }
-    TRACE("Label not found, trying from beginning of file\n");
-    if (!SetFilePointerEx(h, zeroli, NULL, FILE_BEGIN)) return FALSE;
-    while (find_next_label(h, where.QuadPart, candidate, code_page))
+    if (fallback)
     {
-        TRACE("comparing found label %s\n", wine_dbgstr_w(candidate));
-        if (!lstrcmpiW(candidate, label))
-            return SetFilePointerEx(h, zeroli, pos, FILE_CURRENT);
+        TRACE("Label not found after current position, wrapping around\n");
+        *pos = fallback->next_line;
+        return TRUE;
     }
-    TRACE("Reached wrap point, label not found\n");
+    TRACE("Label not found\n");
     return FALSE;
 }
+
+/* return the open handle for the current batch file, opening it on first use;
+ * it is kept open in the context to save reopening the file for every line */
+HANDLE WCMD_batch_file_handle(void)
+{
+    if (context->file == INVALID_HANDLE_VALUE)
+        context->file = CreateFileW(context->batchfileW, GENERIC_READ,
+                                    FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
+                                    NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    return context->file;
+}
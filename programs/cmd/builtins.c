@@ -1727,8 +1727,7 @@ RETURN_CODE WCMD_goto(void)
             context->skip_rest = TRUE;
             return RETURN_CODE_ABORTED;
         }
-        h = CreateFileW(context->batchfileW, GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
-                        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        h = WCMD_batch_file_handle();
         if (h == INVALID_HANDLE_VALUE)
         {
             SetLastError(ERROR_FILE_NOT_FOUND);
@@ -1742,7 +1741,6 @@ RETURN_CODE WCMD_goto(void)
         TRACE("goto label: '%s'\n", wine_dbgstr_w(paramStart));
 
         ret = WCMD_find_label(h, paramStart, &context->file_position);
-        CloseHandle(h);
         if (ret) return RETURN_CODE_ABORTED;
         WCMD_output_stderr(WCMD_LoadMessage(WCMD_NOTARGET));
         context->skip_rest = TRUE;
@@ -223,6 +223,7 @@ RETURN_CODE WCMD_call_batch(const WCHAR *, WCHAR *);
 RETURN_CODE WCMD_call_command(WCHAR *command);
 RETURN_CODE WCMD_run_builtin_command(int cmd_index, WCHAR *cmd);
 
+HANDLE WCMD_batch_file_handle(void);
 BOOL WCMD_find_label(HANDLE h, const WCHAR*, LARGE_INTEGER *pos);
 void WCMD_set_label_end(WCHAR *string);
 
@@ -264,6 +265,7 @@ typedef struct _BATCH_CONTEXT
 {
     WCHAR *command;	  /* The command which invoked the batch file */
     LARGE_INTEGER file_position;
+    HANDLE file;          /* Open handle on the batch file, INVALID_HANDLE_VALUE until first read */
     WCHAR *batchfileW;    /* Name of same */
     int shift_count[10];  /* Offset in terms of shifts for %0 - %9 */
     struct _BATCH_CONTEXT *prev_context; /* Pointer to the previous context block */
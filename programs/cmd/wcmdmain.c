@@ -3109,8 +3109,7 @@ static WCHAR *fetch_next_line(BOOL feed, BOOL first_line, WCHAR* buffer)
         if (context)
         {
             LARGE_INTEGER zeroli = {.QuadPart = 0};
-            HANDLE h = CreateFileW(context->batchfileW, GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
-                                   NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            HANDLE h = WCMD_batch_file_handle();
             if (h == INVALID_HANDLE_VALUE)
             {
                 SetLastError(ERROR_FILE_NOT_FOUND);
@@ -3122,7 +3121,6 @@ static WCHAR *fetch_next_line(BOOL feed, BOOL first_line, WCHAR* buffer)
                 ret = SetFilePointerEx(h, context->file_position, NULL, FILE_BEGIN) &&
                     !!WCMD_fgets(buffer, MAXSTRING, h) &&
                     SetFilePointerEx(h, zeroli, &context->file_position, FILE_CURRENT);
-                CloseHandle(h);
             }
         }
         else
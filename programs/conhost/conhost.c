@@ -416,7 +416,17 @@ static void new_line( struct screen_buffer *screen_buffer, RECT *update_rect )
     assert( screen_buffer->cursor_y >= screen_buffer->height );
     screen_buffer->cursor_y = screen_buffer->height - 1;
 
-    if (screen_buffer->console->tty_output)
+    if (screen_buffer->console->window)
+    {
+        if (is_active( screen_buffer ))
+        {
+            /* flush pending damage while it still matches the buffer, then
+             * have the window renderer scroll its cached bitmap */
+            update_output( screen_buffer, update_rect );
+            update_window_scroll( screen_buffer->console );
+        }
+    }
+    else if (screen_buffer->console->tty_output)
         update_output( screen_buffer, update_rect );
     else
         SetRect( update_rect, 0, 0, screen_buffer->width - 1, screen_buffer->height - 1 );
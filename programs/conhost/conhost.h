@@ -148,6 +148,7 @@ void update_console_font( struct console *console, const WCHAR *face_name, size_
 BOOL init_window( struct console *console );
 void init_message_window( struct console *console );
 void update_window_region( struct console *console, const RECT *update );
+void update_window_scroll( struct console *console );
 void update_window_config( struct console *console, BOOL delay );
 
 static inline void empty_update_rect( struct screen_buffer *screen_buffer, RECT *rect )
@@ -63,6 +63,7 @@ struct console_window
     COORD             cursor_pos;      /* cursor position */
 
     RECT              update;          /* screen buffer update rect */
+    unsigned int      scrolled;        /* lines scrolled out since the last refresh */
     enum update_state update_state;    /* update state */
 };
 
@@ -566,6 +567,7 @@ static void update_window( struct console *console )
         }
 
         empty_update_rect( console->active, &console->window->update );
+        console->window->scrolled = 0;
         update_all = TRUE;
     }
 
@@ -635,6 +637,25 @@ static void update_window( struct console *console )
     console->window->win_pos.X = console->active->win.left;
     console->window->win_pos.Y = console->active->win.top;
 
+    if (console->window->scrolled)
+    {
+        if (console->window->scrolled < console->window->sb_height && console->window->bitmap)
+        {
+            int dy = console->window->scrolled * console->active->font.height;
+
+            /* scroll the cached rendering; only the damaged rows are re-rendered below */
+            BitBlt( console->window->mem_dc, 0, 0,
+                    console->window->sb_width  * console->active->font.width,
+                    console->window->sb_height * console->active->font.height - dy,
+                    console->window->mem_dc, 0, dy, SRCCOPY );
+        }
+        else
+            SetRect( &console->window->update, 0, 0,
+                     console->active->width - 1, console->active->height - 1 );
+        console->window->scrolled = 0;
+        InvalidateRect( console->win, NULL, FALSE );
+    }
+
     if (console->window->update.top  <= console->window->update.bottom &&
         console->window->update.left <= console->window->update.right)
     {
@@ -2377,6 +2398,27 @@ void update_window_region( struct console *console, const RECT *update )
     update_window_config( console, TRUE );
 }
 
+/* the screen buffer scrolled up a line; shift the cached rendering instead of
+ * redrawing everything */
+void update_window_scroll( struct console *console )
+{
+    RECT *window_rect = &console->window->update;
+    RECT r;
+
+    console->window->scrolled++;
+
+    /* previously damaged cells moved up a line with the rest of the content */
+    if (window_rect->top <= window_rect->bottom && window_rect->left <= window_rect->right)
+    {
+        if (window_rect->top > 0) window_rect->top--;
+        if (window_rect->bottom > 0) window_rect->bottom--;
+    }
+
+    SetRect( &r, 0, console->active->height - 1, console->active->width - 1,
+             console->active->height - 1 );
+    update_window_region( console, &r );
+}
+
 BOOL init_window( struct console *console )
 {
     struct console_config config;
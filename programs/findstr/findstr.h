@@ -25,9 +25,32 @@
 #define STRING_CANNOT_OPEN      103
 #define STRING_IGNORED          104
 
+enum regex_op
+{
+    REGEX_CHAR,              /* match a literal character */
+    REGEX_ANY,               /* match any character */
+    REGEX_STAR,              /* match any number of the following character */
+    REGEX_EOL,               /* match the end of the line */
+    REGEX_END                /* end of the compiled pattern */
+};
+
+struct regex_insn
+{
+    enum regex_op op;
+    char c;
+};
+
+struct regex
+{
+    struct regex_insn *insns;
+    BOOL anchored;
+    char first;              /* literal first byte, for fast scanning */
+};
+
 struct findstr_string
 {
-    const char *string;
+    char *string;
+    struct regex regex;
     struct findstr_string *next;
 };
 
@@ -75,6 +75,8 @@ static BOOL add_file(struct findstr_file **head, const WCHAR *path)
             findstr_error_wprintf(STRING_CANNOT_OPEN, path);
             return FALSE;
         }
+        /* findstr is commonly used on large log files, read them in big chunks */
+        setvbuf(new_file->file, NULL, _IOFBF, 0x10000);
     }
 
     *ptr = new_file;
@@ -118,64 +120,109 @@ static void add_string(struct findstr_string **head, const WCHAR *string)
     *ptr = new_string;
 }
 
-static BOOL match_substring(const char *str, const char *substr, BOOL case_sensitive)
+/* compile a pattern into instructions so that matching doesn't have to
+ * reparse it on every line; characters are folded to lowercase here for
+ * case-insensitive searches, the lines are folded once when read */
+static BOOL regex_compile(struct regex *regex, const char *pattern, BOOL case_sensitive)
 {
-    if (case_sensitive) return !!strstr(str, substr);
+    struct regex_insn *insn;
+    UINT pos = 0;
 
-    while (*str)
+    if (strstr(pattern, "[")) FIXME("character ranges (i.e. [abc], [^a-z]) are not supported\n");
+    if (strstr(pattern, "\\<") || strstr(pattern, "\\>")) FIXME("word position (i.e. \\< and \\>) not supported\n");
+
+    regex->anchored = (pattern[0] == '^');
+    if (regex->anchored) pos++;
+
+    regex->insns = insn = malloc((strlen(pattern) + 1) * sizeof(*insn));
+    if (!regex->insns)
     {
-        const char *p1 = str, *p2 = substr;
+        WINE_ERR("Out of memory.\n");
+        return FALSE;
+    }
 
-        while (*p1 && *p2 && tolower(*p1) == tolower(*p2))
+    while (pattern[pos])
+    {
+        BOOL escaped;
+        char c;
+
+        if (pattern[pos] == '\\' && pattern[pos + 1]) pos++;
+        c = pattern[pos];
+        /* like is_op(), consider a character escaped whenever the previous
+         * one is a backslash, even an escaped one */
+        escaped = pos && pattern[pos - 1] == '\\';
+        if (pattern[pos + 1] == '*' && pattern[pos] != '\\')
         {
-            p1++;
-            p2++;
+            /* an escaped dot still matches any character when repeated */
+            insn->op = REGEX_STAR;
+            insn->c = case_sensitive ? c : tolower(c);
+            pos++;
         }
-        if (!*p2) return TRUE;
-        str++;
+        else if (c == '$' && !escaped && !pattern[pos + 1])
+        {
+            insn->op = REGEX_EOL;
+        }
+        else if (c == '.' && !escaped)
+        {
+            insn->op = REGEX_ANY;
+        }
+        else
+        {
+            insn->op = REGEX_CHAR;
+            insn->c = case_sensitive ? c : tolower(c);
+        }
+        insn++;
+        pos++;
     }
-    return FALSE;
-}
-
-static inline BOOL is_op(char c, const char *regexp, UINT pos)
-{
-    if (!pos) return (*regexp == c);
-    return (regexp[pos] == c && regexp[pos - 1] != '\\');
-}
+    insn->op = REGEX_END;
 
-static inline BOOL match_char(char c1, char c2, BOOL case_sensitive)
-{
-    if (case_sensitive) return c1 == c2;
-    return tolower(c1) == tolower(c2);
-}
-
-static BOOL match_star(char, const char *, const char *, UINT, BOOL);
-
-static BOOL match_here(const char *str, const char *regexp, UINT pos, BOOL case_sensitive)
-{
-    if (regexp[pos] == '\\' && regexp[pos + 1]) pos++;
-    if (!regexp[pos]) return TRUE;
-    if (is_op('*', regexp, pos + 1)) return match_star(regexp[pos], str, regexp, pos + 2, case_sensitive);
-    if (is_op('$', regexp, pos) && !regexp[pos + 1]) return (str[0] == '\n' || (str[0] == '\r' && str[1] == '\n'));
-    if (*str && (is_op('.', regexp, pos) || match_char(*str, regexp[pos], case_sensitive)))
-        return match_here(str + 1, regexp, pos + 1, case_sensitive);
-    return FALSE;
+    if (!regex->anchored && regex->insns[0].op == REGEX_CHAR) regex->first = regex->insns[0].c;
+    else regex->first = 0;
+    return TRUE;
 }
 
-static BOOL match_star(char c, const char *str, const char *regexp, UINT pos, BOOL case_sensitive)
+static BOOL regex_match_here(const char *str, const struct regex_insn *insn)
 {
-    do { if (match_here(str, regexp, pos, case_sensitive)) return TRUE; }
-    while (*str && (match_char(*str++, c, case_sensitive) || c == '.'));
-    return FALSE;
+    for (;;)
+    {
+        switch (insn->op)
+        {
+        case REGEX_CHAR:
+            if (*str != insn->c) return FALSE;
+            str++;
+            insn++;
+            break;
+        case REGEX_ANY:
+            if (!*str) return FALSE;
+            str++;
+            insn++;
+            break;
+        case REGEX_STAR:
+            do { if (regex_match_here(str, insn + 1)) return TRUE; }
+            while (*str && (*str++ == insn->c || insn->c == '.'));
+            return FALSE;
+        case REGEX_EOL:
+            return (str[0] == '\n' || (str[0] == '\r' && str[1] == '\n'));
+        case REGEX_END:
+            return TRUE;
+        }
+    }
 }
 
-static BOOL match_regexp(const char *str, const char *regexp, BOOL case_sensitive)
+static BOOL regex_match(const struct regex *regex, const char *str)
 {
-    if (strstr(regexp, "[")) FIXME("character ranges (i.e. [abc], [^a-z]) are not supported\n");
-    if (strstr(regexp, "\\<") || strstr(regexp, "\\>")) FIXME("word position (i.e. \\< and \\>) not supported\n");
-
-    if (regexp[0] == '^') return match_here(str, regexp, 1, case_sensitive);
-    do { if (match_here(str, regexp, 0, case_sensitive)) return TRUE; } while (*str++);
+    if (regex->anchored) return regex_match_here(str, regex->insns);
+    if (regex->first)
+    {
+        /* the pattern starts with a literal, only try positions where it occurs */
+        while ((str = strchr(str, regex->first)))
+        {
+            if (regex_match_here(str, regex->insns)) return TRUE;
+            str++;
+        }
+        return FALSE;
+    }
+    do { if (regex_match_here(str, regex->insns)) return TRUE; } while (*str++);
     return FALSE;
 }
 
@@ -183,7 +230,7 @@ int __cdecl wmain(int argc, WCHAR *argv[])
 {
     struct findstr_string *string_head = NULL, *current_string, *next_string;
     struct findstr_file *file_head = NULL, *current_file, *next_file;
-    char line[MAXSTRING];
+    char line[MAXSTRING], folded[MAXSTRING];
     WCHAR *string, *ptr, *buffer;
     BOOL has_string = FALSE, has_file = FALSE, case_sensitive = TRUE, regular_expression = TRUE;
     int ret = 1, i, j;
@@ -283,6 +330,18 @@ int __cdecl wmain(int argc, WCHAR *argv[])
     if (!has_file)
         add_file(&file_head, NULL);
 
+    for (current_string = string_head; current_string; current_string = current_string->next)
+    {
+        if (!case_sensitive)
+        {
+            char *p;
+            for (p = current_string->string; *p; p++) *p = tolower(*p);
+        }
+        if (regular_expression &&
+            !regex_compile(&current_string->regex, current_string->string, case_sensitive))
+            goto done;
+    }
+
     _setmode(_fileno(stdout), _O_BINARY);
 
     current_file = file_head;
@@ -290,15 +349,23 @@ int __cdecl wmain(int argc, WCHAR *argv[])
     {
         while (fgets(line, ARRAY_SIZE(line), current_file->file))
         {
+            const char *text = line;
+
+            if (!case_sensitive)
+            {
+                for (i = 0; line[i]; i++) folded[i] = tolower(line[i]);
+                folded[i] = 0;
+                text = folded;
+            }
             current_string = string_head;
             while (current_string)
             {
                 BOOL match;
 
                 if (regular_expression)
-                    match = match_regexp(line, current_string->string, case_sensitive);
+                    match = regex_match(&current_string->regex, text);
                 else
-                    match = match_substring(line, current_string->string, case_sensitive);
+                    match = !!strstr(text, current_string->string);
                 if (match)
                 {
                     printf("%s",line);
@@ -327,6 +394,7 @@ done:
     while (current_string)
     {
         next_string = current_string->next;
+        free(current_string->regex.insns);
         free(current_string);
         current_string = next_string;
     }
@@ -36,24 +36,6 @@ static HKEY reg_class_keys[] = {
             HKEY_CURRENT_CONFIG, HKEY_CURRENT_USER, HKEY_DYN_DATA
         };
 
-/******************************************************************************
- * Allocates memory and converts input from multibyte to wide chars
- * Returned string must be freed by the caller
- */
-static WCHAR* GetWideString(const char* strA)
-{
-    if(strA)
-    {
-        WCHAR* strW;
-        int len = MultiByteToWideChar(CP_ACP, 0, strA, -1, NULL, 0);
-
-        strW = malloc(len * sizeof(WCHAR));
-        MultiByteToWideChar(CP_ACP, 0, strA, -1, strW, len);
-        return strW;
-    }
-    return NULL;
-}
-
 /******************************************************************************
  * Allocates memory and converts input from multibyte to wide chars
  * Returned string must be freed by the caller
@@ -919,61 +901,84 @@ static WCHAR *set_value_state(struct parser *parser, WCHAR *pos)
     return pos;
 }
 
+/* convert the input file to Unicode a chunk at a time rather than one line
+ * at a time, to avoid a buffer allocation and conversion for every line */
 static WCHAR *get_lineA(FILE *fp)
 {
-    static WCHAR *lineW;
-    static size_t size;
-    static char *buf, *next;
-    char *line;
-
-    free(lineW);
+    static size_t sizeA, sizeW, lenA;
+    static char *bufA;
+    static WCHAR *bufW, *next;
+    WCHAR *line;
 
     if (!fp) goto cleanup;
 
-    if (!size)
+    if (!sizeW)
     {
-        size = REG_VAL_BUF_SIZE;
-        buf = malloc(size);
-        *buf = 0;
-        next = buf;
+        sizeA = REG_VAL_BUF_SIZE;
+        bufA = malloc(sizeA);
+        sizeW = REG_VAL_BUF_SIZE;
+        bufW = malloc(sizeW * sizeof(WCHAR));
+        *bufW = 0;
+        next = bufW;
     }
     line = next;
 
     while (next)
     {
-        char *p = strpbrk(line, "\r\n");
-        if (!p)
+        size_t len, count, convert;
+        DWORD lenW;
+        WCHAR *p = wcspbrk(line, L"\r\n");
+
+        if (p)
         {
-            size_t len, count;
-            len = strlen(next);
-            memmove(buf, next, len + 1);
-            if (size - len < 3)
-            {
-                size *= 2;
-                buf = realloc(buf, size);
-            }
-            if (!(count = fread(buf + len, 1, size - len - 1, fp)))
+            next = p + 1;
+            if (*p == '\r' && *(p + 1) == '\n') next++;
+            *p = 0;
+            return line;
+        }
+
+        /* no complete line left; read and convert the next chunk of the file */
+        len = lstrlenW(next);
+        memmove(bufW, next, (len + 1) * sizeof(WCHAR));
+        line = next = bufW;
+        if (!(count = fread(bufA + lenA, 1, sizeA - lenA, fp)) && !lenA)
+        {
+            next = NULL;
+            return bufW;
+        }
+        lenA += count;
+        if (!count) convert = lenA;  /* end of file, convert what is left */
+        else
+        {
+            char *nl = bufA + lenA;
+            while (nl > bufA && nl[-1] != '\r' && nl[-1] != '\n') nl--;
+            if (nl == bufA)  /* no line break in the whole chunk, grow it */
             {
-                next = NULL;
-                lineW = GetWideString(buf);
-                return lineW;
+                if (lenA == sizeA) bufA = realloc(bufA, sizeA *= 2);
+                continue;
             }
-            buf[len + count] = 0;
-            next = buf;
-            line = buf;
-            continue;
+            /* cutting the conversion at a line break keeps DBCS characters intact */
+            convert = nl - bufA;
         }
-        next = p + 1;
-        if (*p == '\r' && *(p + 1) == '\n') next++;
-        *p = 0;
-        lineW = GetWideString(line);
-        return lineW;
+        lenW = MultiByteToWideChar(CP_ACP, 0, bufA, convert, NULL, 0);
+        if (len + lenW + 1 > sizeW)
+        {
+            while (len + lenW + 1 > sizeW) sizeW *= 2;
+            bufW = realloc(bufW, sizeW * sizeof(WCHAR));
+        }
+        MultiByteToWideChar(CP_ACP, 0, bufA, convert, bufW + len, lenW);
+        bufW[len + lenW] = 0;
+        lenA -= convert;
+        memmove(bufA, bufA + convert, lenA);
+        line = next = bufW;
     }
 
 cleanup:
-    lineW = NULL;
-    if (size) free(buf);
-    size = 0;
+    free(bufA);
+    free(bufW);
+    bufA = NULL;
+    bufW = next = NULL;
+    sizeA = sizeW = lenA = 0;
     return NULL;
 }
 
@@ -387,6 +387,170 @@ static BOOL schedule_delayed_autostart(struct service_entry **services, unsigned
     return TRUE;
 }
 
+struct autostart_batch;
+
+struct autostart_service
+{
+    struct autostart_batch *batch;
+    struct service_entry *service;
+    LONG pending_deps;                    /* batch services this one still has to wait for */
+    LONG sim_deps;                        /* scratch counter for the cycle check */
+    BOOL queued;
+    unsigned int dependent_count;
+    struct autostart_service **dependents;
+};
+
+struct autostart_batch
+{
+    LONG remaining;
+    HANDLE done_event;
+    unsigned int count;
+    struct autostart_service services[1];
+};
+
+static void autostart_submit(struct autostart_service *as);
+
+static void CALLBACK autostart_service_callback(TP_CALLBACK_INSTANCE *instance, void *context)
+{
+    struct autostart_service *as = context;
+    struct autostart_batch *batch = as->batch;
+    unsigned int i;
+    DWORD err;
+
+    err = service_start(as->service, 0, NULL);
+    if (err != ERROR_SUCCESS)
+        WINE_FIXME("Auto-start service %s failed to start: %ld\n",
+                   wine_dbgstr_w(as->service->name), err);
+    release_service(as->service);
+
+    for (i = 0; i < as->dependent_count; i++)
+    {
+        struct autostart_service *dependent = as->dependents[i];
+        if (!InterlockedDecrement(&dependent->pending_deps))
+            autostart_submit(dependent);
+    }
+    if (!InterlockedDecrement(&batch->remaining))
+        SetEvent(batch->done_event);
+}
+
+static void autostart_submit(struct autostart_service *as)
+{
+    if (!TrySubmitThreadpoolCallback(autostart_service_callback, as, NULL))
+        autostart_service_callback(NULL, as);
+}
+
+static struct autostart_service *autostart_find_dependency(struct autostart_batch *batch, const WCHAR *name)
+{
+    unsigned int i;
+
+    for (i = 0; i < batch->count; i++)
+        if (!wcsicmp(batch->services[i].service->name, name)) return &batch->services[i];
+    return NULL;
+}
+
+/* start a group of auto-start services concurrently, each one waiting for the
+ * services it depends on within the group; the services it depends on outside
+ * of the group have been started already */
+static void autostart_batch_start(struct service_entry **services, unsigned int count)
+{
+    struct autostart_batch *batch = NULL;
+    unsigned int i, processed = 0;
+    BOOL progress;
+    DWORD err;
+
+    if (count > 1 && (batch = calloc(1, FIELD_OFFSET(struct autostart_batch, services[count]))) &&
+        !(batch->done_event = CreateEventW(NULL, TRUE, FALSE, NULL)))
+    {
+        free(batch);
+        batch = NULL;
+    }
+    if (!batch)
+    {
+        for (i = 0; i < count; i++)
+        {
+            err = service_start(services[i], 0, NULL);
+            if (err != ERROR_SUCCESS)
+                WINE_FIXME("Auto-start service %s failed to start: %ld\n",
+                           wine_dbgstr_w(services[i]->name), err);
+            release_service(services[i]);
+        }
+        return;
+    }
+
+    batch->count = count;
+    batch->remaining = count;
+    for (i = 0; i < count; i++)
+    {
+        batch->services[i].batch = batch;
+        batch->services[i].service = services[i];
+    }
+    for (i = 0; i < count; i++)
+    {
+        struct autostart_service *as = &batch->services[i], *dep;
+        const WCHAR *name;
+
+        for (name = services[i]->dependOnServices; *name; name += lstrlenW(name) + 1)
+        {
+            struct autostart_service **dependents;
+
+            if (!(dep = autostart_find_dependency(batch, name)) || dep == as) continue;
+            if (!(dependents = realloc(dep->dependents,
+                                       (dep->dependent_count + 1) * sizeof(*dependents))))
+                continue;
+            dep->dependents = dependents;
+            dep->dependents[dep->dependent_count++] = as;
+            as->pending_deps++;
+        }
+    }
+
+    /* check for dependency cycles; their members are started without waiting */
+    for (i = 0; i < count; i++) batch->services[i].sim_deps = batch->services[i].pending_deps;
+    do
+    {
+        progress = FALSE;
+        for (i = 0; i < count; i++)
+        {
+            struct autostart_service *as = &batch->services[i];
+            unsigned int j;
+
+            if (as->queued || as->sim_deps) continue;
+            as->queued = TRUE;
+            processed++;
+            progress = TRUE;
+            for (j = 0; j < as->dependent_count; j++) as->dependents[j]->sim_deps--;
+        }
+    } while (progress);
+    if (processed < count)
+    {
+        for (i = 0; i < count; i++)
+        {
+            struct autostart_service *as = &batch->services[i];
+            if (!as->queued && as->pending_deps)
+            {
+                WINE_WARN("Circular dependency involving service %s\n",
+                          wine_dbgstr_w(as->service->name));
+                as->pending_deps = 0;
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++)
+        if (!batch->services[i].pending_deps) autostart_submit(&batch->services[i]);
+
+    WaitForSingleObject(batch->done_event, INFINITE);
+    CloseHandle(batch->done_event);
+    for (i = 0; i < count; i++) free(batch->services[i].dependents);
+    free(batch);
+}
+
+static BOOL can_start_in_parallel(const struct service_entry *service)
+{
+    /* keep drivers and PnP services in strict start order, only regular
+     * auto-start Win32 services are started concurrently */
+    return service->config.dwStartType == SERVICE_AUTO_START &&
+           (service->config.dwServiceType & (SERVICE_WIN32_OWN_PROCESS | SERVICE_WIN32_SHARE_PROCESS));
+}
+
 static BOOL is_root_pnp_service(HDEVINFO set, const struct service_entry *service)
 {
     SP_DEVINFO_DATA device = {sizeof(device)};
@@ -408,10 +572,10 @@ static BOOL is_root_pnp_service(HDEVINFO set, const struct service_entry *servic
 
 static void scmdatabase_autostart_services(struct scmdatabase *db)
 {
-    struct service_entry **services_list;
+    struct service_entry **services_list, **parallel;
     unsigned int i = 0;
     unsigned int size = 32;
-    unsigned int delayed_cnt = 0;
+    unsigned int delayed_cnt = 0, parallel_cnt = 0;
     struct service_entry *service;
     HDEVINFO set;
 
@@ -449,22 +613,38 @@ static void scmdatabase_autostart_services(struct scmdatabase *db)
     qsort(services_list, size, sizeof(services_list[0]), compare_service);
     scmdatabase_lock_startup(db, INFINITE);
 
-    for (i = 0; i < size; i++)
+    parallel = malloc(size * sizeof(parallel[0]));
+
+    for (i = 0; i <= size; i++)
     {
         DWORD err;
-        service = services_list[i];
-        if (service->delayed_autostart)
+        service = i < size ? services_list[i] : NULL;
+        if (service && service->delayed_autostart)
         {
             TRACE("delayed starting %s\n", wine_dbgstr_w(service->name));
             services_list[delayed_cnt++] = service;
             continue;
         }
+        if (service && parallel && can_start_in_parallel(service))
+        {
+            parallel[parallel_cnt++] = service;
+            continue;
+        }
+        /* a service which has to start in order acts as a barrier for the
+         * group of concurrent services collected before it */
+        if (parallel_cnt)
+        {
+            autostart_batch_start(parallel, parallel_cnt);
+            parallel_cnt = 0;
+        }
+        if (!service) break;
         err = service_start(service, 0, NULL);
         if (err != ERROR_SUCCESS)
             WINE_FIXME("Auto-start service %s failed to start: %ld\n",
                        wine_dbgstr_w(service->name), err);
         release_service(service);
     }
+    free(parallel);
 
     scmdatabase_unlock_startup(db);
 
@@ -1523,6 +1523,29 @@ static HANDLE start_rundll32( const WCHAR *inf_path, const WCHAR *install, WORD
     return pi.hProcess;
 }
 
+/* wait for processes to terminate while pumping messages for the wait dialog */
+static void wait_processes( HANDLE *processes, DWORD count )
+{
+    DWORD i, res;
+    MSG msg;
+
+    for (i = 0; i < count; )  /* remove processes that failed to start */
+    {
+        if (!processes[i]) processes[i] = processes[--count];
+        else i++;
+    }
+    while (count)
+    {
+        res = MsgWaitForMultipleObjects( count, processes, FALSE, INFINITE, QS_ALLINPUT );
+        if (res < WAIT_OBJECT_0 + count)
+        {
+            CloseHandle( processes[res - WAIT_OBJECT_0] );
+            processes[res - WAIT_OBJECT_0] = processes[--count];
+        }
+        else while (PeekMessageW( &msg, 0, 0, 0, PM_REMOVE )) DispatchMessageW( &msg );
+    }
+}
+
 static void install_root_pnp_devices(void)
 {
     static const struct
@@ -1636,32 +1659,23 @@ static void update_wineprefix( BOOL force )
 
     if (update_timestamp( config_dir, st.st_mtime ) || force)
     {
-        HANDLE process;
-        DWORD count = 0;
+        HANDLE processes[ARRAY_SIZE(machines)];
+        DWORD count;
 
-        if ((process = start_rundll32( inf_path, L"PreInstall", IMAGE_FILE_MACHINE_TARGET_HOST )))
+        if ((processes[0] = start_rundll32( inf_path, L"PreInstall", IMAGE_FILE_MACHINE_TARGET_HOST )))
         {
             HWND hwnd = show_wait_window();
-            for (;;)
+            wait_processes( processes, 1 );
+            /* the per-machine installs only touch their own system directory and
+             * registry view, so they can run in parallel once PreInstall is done */
+            for (count = 0; machines[count].Machine; count++)
             {
-                if (process)
-                {
-                    MSG msg;
-                    DWORD res = MsgWaitForMultipleObjects( 1, &process, FALSE, INFINITE, QS_ALLINPUT );
-                    if (res != WAIT_OBJECT_0)
-                    {
-                        while (PeekMessageW( &msg, 0, 0, 0, PM_REMOVE )) DispatchMessageW( &msg );
-                        continue;
-                    }
-                    CloseHandle( process );
-                }
-                if (!machines[count].Machine) break;
                 if (machines[count].Native)
-                    process = start_rundll32( inf_path, L"DefaultInstall", IMAGE_FILE_MACHINE_TARGET_HOST );
+                    processes[count] = start_rundll32( inf_path, L"DefaultInstall", IMAGE_FILE_MACHINE_TARGET_HOST );
                 else
-                    process = start_rundll32( inf_path, L"Wow64Install", machines[count].Machine );
-                count++;
+                    processes[count] = start_rundll32( inf_path, L"Wow64Install", machines[count].Machine );
             }
+            wait_processes( processes, count );
             DestroyWindow( hwnd );
         }
         install_root_pnp_devices();
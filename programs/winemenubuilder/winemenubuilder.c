@@ -1072,6 +1072,54 @@ static void refresh_icon_cache(const WCHAR *iconsDir)
     DeleteFileW( buffer );
 }
 
+/* hash of the source icon contents, used together with the registry cache to
+ * skip reconverting icons that have not changed since the last run */
+static DWORD hash_icon_stream(IStream *stream)
+{
+    DWORD hash = 2166136261u;
+    BYTE buffer[4096];
+    LARGE_INTEGER zero;
+    ULONG i, size;
+
+    zero.QuadPart = 0;
+    if (FAILED(IStream_Seek(stream, zero, STREAM_SEEK_SET, NULL))) return 0;
+    while (SUCCEEDED(IStream_Read(stream, buffer, sizeof(buffer), &size)) && size)
+        for (i = 0; i < size; i++) hash = (hash ^ buffer[i]) * 16777619u;
+    return hash;
+}
+
+static HKEY open_icon_cache_reg_key(void)
+{
+    HKEY key;
+
+    if (RegCreateKeyW(HKEY_CURRENT_USER, L"Software\\Wine\\IconCache", &key))
+        return NULL;
+    return key;
+}
+
+static BOOL icon_cache_up_to_date(const WCHAR *identifier, DWORD hash)
+{
+    HKEY key;
+    DWORD value, size = sizeof(value), type;
+    BOOL ret = FALSE;
+
+    if (!(key = open_icon_cache_reg_key())) return FALSE;
+    if (!RegQueryValueExW(key, identifier, NULL, &type, (BYTE *)&value, &size) &&
+        type == REG_DWORD && size == sizeof(value) && value == hash)
+        ret = TRUE;
+    RegCloseKey(key);
+    return ret;
+}
+
+static void icon_cache_update(const WCHAR *identifier, DWORD hash)
+{
+    HKEY key;
+
+    if (!(key = open_icon_cache_reg_key())) return;
+    RegSetValueExW(key, identifier, 0, REG_DWORD, (const BYTE *)&hash, sizeof(hash));
+    RegCloseKey(key);
+}
+
 static HRESULT platform_write_icon(IStream *icoStream, ICONDIRENTRY *iconDirEntries,
                                    int numEntries, int exeIndex, LPCWSTR icoPathW,
                                    const WCHAR *destFilename, WCHAR **nativeIdentifier)
@@ -1080,9 +1128,13 @@ static HRESULT platform_write_icon(IStream *icoStream, ICONDIRENTRY *iconDirEntr
     WCHAR *iconsDir;
     HRESULT hr = S_OK;
     LARGE_INTEGER zero;
+    DWORD hash;
+    BOOL cached, converted = FALSE;
 
     *nativeIdentifier = compute_native_identifier(exeIndex, icoPathW, destFilename);
     iconsDir = heap_wprintf(L"%s\\icons\\hicolor", xdg_data_dir);
+    hash = hash_icon_stream(icoStream);
+    cached = hash && icon_cache_up_to_date(*nativeIdentifier, hash);
 
     for (i = 0; i < numEntries; i++)
     {
@@ -1121,17 +1173,26 @@ static HRESULT platform_write_icon(IStream *icoStream, ICONDIRENTRY *iconDirEntr
         w = iconDirEntries[bestIndex].bWidth ? iconDirEntries[bestIndex].bWidth : 256;
         h = iconDirEntries[bestIndex].bHeight ? iconDirEntries[bestIndex].bHeight : 256;
         iconDir = heap_wprintf(L"%s\\%dx%d\\apps", iconsDir, w, h);
-        create_directories(iconDir);
         pngPath = heap_wprintf(L"%s\\%s.png", iconDir, *nativeIdentifier);
+        if (cached && GetFileAttributesW(pngPath) != INVALID_FILE_ATTRIBUTES)
+        {
+            WINE_TRACE("%s is up to date\n", wine_dbgstr_w(pngPath));
+            free(iconDir);
+            free(pngPath);
+            continue;
+        }
+        create_directories(iconDir);
         zero.QuadPart = 0;
         hr = IStream_Seek(icoStream, zero, STREAM_SEEK_SET, NULL);
         if (SUCCEEDED(hr))
             hr = convert_to_native_icon(icoStream, &bestIndex, 1, &CLSID_WICPngEncoder, pngPath);
+        converted = TRUE;
 
         free(iconDir);
         free(pngPath);
     }
-    refresh_icon_cache(iconsDir);
+    if (converted) refresh_icon_cache(iconsDir);
+    if (SUCCEEDED(hr) && hash) icon_cache_update(*nativeIdentifier, hash);
     free(iconsDir);
     return hr;
 }
@@ -344,6 +344,7 @@ static int XCOPY_DoCopy(WCHAR *srcstem, WCHAR *srcspec,
     BOOL            findres = TRUE;
     WCHAR           *inputpath, *outputpath;
     BOOL            copiedFile = FALSE;
+    WIN32_FILE_ATTRIBUTE_DATA destinfo;
     DWORD           destAttribs, srcAttribs;
     BOOL            skipFile;
     int             ret = 0;
@@ -395,8 +396,9 @@ static int XCOPY_DoCopy(WCHAR *srcstem, WCHAR *srcspec,
                                                       wine_dbgstr_w(copyTo));
             if (!copiedFile && !(flags & OPT_SIMULATE)) XCOPY_CreateDirectory(deststem);
 
-            /* See if allowed to copy it */
-            srcAttribs = GetFileAttributesW(copyFrom);
+            /* See if allowed to copy it; the find data already has the source
+               attributes, so don't query them again                          */
+            srcAttribs = finddata->dwFileAttributes;
             WINE_TRACE("Source attribs: %ld\n", srcAttribs);
 
             if ((srcAttribs & FILE_ATTRIBUTE_HIDDEN) ||
@@ -412,9 +414,12 @@ static int XCOPY_DoCopy(WCHAR *srcstem, WCHAR *srcspec,
                 skipFile = TRUE;
             }
 
-            /* See if file exists */
-            destAttribs = GetFileAttributesW(copyTo);
-            WINE_TRACE("Dest attribs: %ld\n", srcAttribs);
+            /* See if file exists; fetch the write time along with the
+               attributes as /D needs it below                          */
+            if (!GetFileAttributesExW(copyTo, GetFileExInfoStandard, &destinfo))
+                destinfo.dwFileAttributes = INVALID_FILE_ATTRIBUTES;
+            destAttribs = destinfo.dwFileAttributes;
+            WINE_TRACE("Dest attribs: %ld\n", destAttribs);
 
             /* Check date ranges if a destination file already exists */
             if (!skipFile && (flags & OPT_DATERANGE) &&
@@ -426,18 +431,9 @@ static int XCOPY_DoCopy(WCHAR *srcstem, WCHAR *srcspec,
             /* If just /D supplied, only overwrite if src newer than dest */
             if (!skipFile && (flags & OPT_DATENEWER) &&
                (destAttribs != INVALID_FILE_ATTRIBUTES)) {
-                HANDLE h = CreateFileW(copyTo, GENERIC_READ, FILE_SHARE_READ,
-                                      NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
-                                      NULL);
-                if (h != INVALID_HANDLE_VALUE) {
-                    FILETIME writeTime;
-                    GetFileTime(h, NULL, NULL, &writeTime);
-
-                    if (CompareFileTime(&finddata->ftLastWriteTime, &writeTime) <= 0) {
-                        WINE_TRACE("Skipping file as dest newer or same date\n");
-                        skipFile = TRUE;
-                    }
-                    CloseHandle(h);
+                if (CompareFileTime(&finddata->ftLastWriteTime, &destinfo.ftLastWriteTime) <= 0) {
+                    WINE_TRACE("Skipping file as dest newer or same date\n");
+                    skipFile = TRUE;
                 }
             }
 
@@ -563,9 +559,11 @@ static int XCOPY_DoCopy(WCHAR *srcstem, WCHAR *srcspec,
                            otherwise remove the read only attribute                 */
                         if (flags & OPT_KEEPATTRS) {
                             SetFileAttributesW(copyTo, srcAttribs | FILE_ATTRIBUTE_ARCHIVE);
-                        } else {
+                        } else if (srcAttribs & FILE_ATTRIBUTE_READONLY) {
+                            /* the copy inherited the source attributes, so there is
+                               nothing to clear unless the source was read-only     */
                             SetFileAttributesW(copyTo,
-                                     (GetFileAttributesW(copyTo) & ~FILE_ATTRIBUTE_READONLY));
+                                     (srcAttribs | FILE_ATTRIBUTE_ARCHIVE) & ~FILE_ATTRIBUTE_READONLY);
                         }
 
                         /* If /M supplied, remove the archive bit after successful copy */
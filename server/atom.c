@@ -32,6 +32,7 @@
 #include "unicode.h"
 #include "request.h"
 #include "object.h"
+#include "file.h"
 #include "process.h"
 #include "handle.h"
 #include "user.h"
@@ -246,6 +247,8 @@ static atom_t add_atom( struct atom_table *table, const struct unicode_str *str
             entry->hash   = hash;
             entry->len    = str->len;
             memcpy( entry->str, str->str, str->len );
+            /* let the clients drop their cached atom names */
+            if (shared_session) shared_session->atoms_generation++;
         }
         else free( entry );
     }
@@ -266,6 +269,8 @@ static void delete_atom( struct atom_table *table, atom_t atom, int if_pinned )
         else table->entries[entry->hash] = entry->next;
         table->handles[atom - MIN_STR_ATOM] = NULL;
         free( entry );
+        /* let the clients drop their cached atom names */
+        if (shared_session) shared_session->atoms_generation++;
     }
 }
 
@@ -36,6 +36,10 @@
 #ifdef HAVE_SYS_INOTIFY_H
 #include <sys/inotify.h>
 #endif
+#ifdef linux
+#include <sys/vfs.h>
+#include <sys/fanotify.h>
+#endif
 
 #include "ntstatus.h"
 #define WIN32_NO_STATUS
@@ -67,8 +71,10 @@
 /* inotify support */
 
 struct inode;
+struct dir;
 
 static void free_inode( struct inode *inode );
+static void fanotify_remove_watch( struct dir *dir );
 
 static struct fd *inotify_fd;
 
@@ -92,6 +98,7 @@ struct dir
     struct list    change_records;   /* data for the change */
     struct list    in_entry; /* entry in the inode dirs list */
     struct inode  *inode;    /* inode of the associated directory */
+    void          *fan_watch; /* recursive fanotify watch state */
     struct process *client_process;  /* client process that has a cache for this directory */
     int             client_entry;    /* entry in client process cache */
 };
@@ -433,6 +440,8 @@ static void dir_destroy( struct object *obj )
     if (dir->filter)
         remove_change( dir );
 
+    fanotify_remove_watch( dir );
+
     if (dir->inode)
     {
         list_remove( &dir->in_entry );
@@ -1133,6 +1142,330 @@ static void dir_add_to_existing_notify( struct dir *dir )
 
 #endif  /* HAVE_SYS_INOTIFY_H */
 
+/* fanotify support
+ *
+ * Recursive watches are established with a single filesystem mark instead of
+ * one inotify watch per subdirectory, so watching a huge tree is O(1).  This
+ * needs CAP_SYS_ADMIN for FAN_MARK_FILESYSTEM and open_by_handle_at(); when
+ * either is unavailable we silently keep using inotify.
+ */
+
+#if defined(linux) && defined(FAN_REPORT_DFID_NAME)
+
+/* state of a recursive watch established through a fanotify filesystem mark */
+struct fan_watch
+{
+    struct list entry;     /* entry in the fanotify watches list */
+    struct dir *dir;       /* owning directory object */
+    char       *root;      /* resolved watch root path, with a trailing slash */
+    size_t      root_len;
+    fsid_t      fsid;      /* id of the filesystem carrying the mark */
+    int         pending;   /* change records queued during the current event batch */
+};
+
+static struct fd *fanotify_fd;
+static struct list fanotify_watches = LIST_INIT( fanotify_watches );
+static int fanotify_unusable;  /* initialization failed once, don't try again */
+
+static int fanotify_get_poll_events( struct fd *fd );
+static void fanotify_poll_event( struct fd *fd, int event );
+
+static const struct fd_ops fanotify_fd_ops =
+{
+    fanotify_get_poll_events,    /* get_poll_events */
+    fanotify_poll_event,         /* poll_event */
+    NULL,                        /* flush */
+    NULL,                        /* get_fd_type */
+    NULL,                        /* ioctl */
+    NULL,                        /* queue_async */
+    NULL                         /* reselect_async */
+};
+
+static int fanotify_get_poll_events( struct fd *fd )
+{
+    return POLLIN;
+}
+
+/* resolve the real path of an open file descriptor, leaving room to append */
+static char *get_fd_real_path( int fd, size_t extra )
+{
+    char link[64], *path;
+    int r, n = 0x100;
+
+    snprintf( link, sizeof(link), "/proc/self/fd/%u", fd );
+    for (;;)
+    {
+        if (!(path = malloc( n + extra + 2 ))) return NULL;
+        r = readlink( link, path, n );
+        if (r < 0)
+        {
+            free( path );
+            return NULL;
+        }
+        if (r < n)
+        {
+            path[r] = 0;
+            return path;
+        }
+        free( path );
+        n *= 2;
+    }
+}
+
+static uint64_t fanotify_mask_from_filter( unsigned int filter )
+{
+    /* always watch these so renames of whole subtrees are seen */
+    uint64_t mask = FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_ONDIR;
+
+    if (filter & (FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_SECURITY))
+        mask |= FAN_ATTRIB;
+    if (filter & (FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_LAST_ACCESS))
+        mask |= FAN_MODIFY;
+
+    return mask;
+}
+
+static unsigned int filter_from_fan_event( const struct fanotify_event_metadata *meta )
+{
+    unsigned int filter = 0;
+
+    if (meta->mask & (FAN_MOVED_FROM | FAN_MOVED_TO | FAN_DELETE | FAN_CREATE))
+        filter |= FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME;
+    if (meta->mask & FAN_MODIFY)
+        filter |= FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_LAST_ACCESS;
+    if (meta->mask & FAN_ATTRIB)
+        filter |= FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_SECURITY;
+    if (meta->mask & FAN_CREATE)
+        filter |= FILE_NOTIFY_CHANGE_CREATION;
+
+    if (meta->mask & FAN_ONDIR)
+        filter &= ~FILE_NOTIFY_CHANGE_FILE_NAME;
+    else
+        filter &= ~FILE_NOTIFY_CHANGE_DIR_NAME;
+
+    return filter;
+}
+
+/* queue a change record without waking the client; wakeups are batched per read */
+static void fanotify_queue_event( struct fan_watch *watch, unsigned int action, const char *relpath )
+{
+    struct dir *dir = watch->dir;
+
+    if (dir->want_data)
+    {
+        struct change_record *record;
+        size_t len = strlen( relpath );
+
+        if (!(record = malloc( offsetof(struct change_record, event.name[len]) )))
+            return;
+
+        record->cookie = 0;
+        record->event.action = action;
+        memcpy( record->event.name, relpath, len );
+        record->event.len = len;
+
+        list_add_tail( &dir->change_records, &record->entry );
+    }
+    watch->pending = 1;
+}
+
+static void fanotify_notify_event( const struct fanotify_event_metadata *meta )
+{
+    const struct fanotify_event_info_fid *fid = NULL;
+    const struct fanotify_event_info_header *info;
+    const struct file_handle *handle;
+    struct fan_watch *watch;
+    unsigned int filter, action;
+    const char *name;
+    char *path = NULL;
+    int dirfd;
+
+    for (info = (const struct fanotify_event_info_header *)(meta + 1);
+         (const char *)info + sizeof(*info) <= (const char *)meta + meta->event_len && info->len;
+         info = (const struct fanotify_event_info_header *)((const char *)info + info->len))
+    {
+        if (info->info_type != FAN_EVENT_INFO_TYPE_DFID_NAME) continue;
+        fid = (const struct fanotify_event_info_fid *)info;
+        break;
+    }
+    if (!fid) return;
+
+    handle = (const struct file_handle *)fid->handle;
+    name = (const char *)handle->f_handle + handle->handle_bytes;
+
+    filter = filter_from_fan_event( meta );
+
+    if (meta->mask & FAN_CREATE) action = FILE_ACTION_ADDED;
+    else if (meta->mask & FAN_DELETE) action = FILE_ACTION_REMOVED;
+    /* fanotify has no rename cookies, so report moves as remove + add */
+    else if (meta->mask & FAN_MOVED_FROM) action = FILE_ACTION_REMOVED;
+    else if (meta->mask & FAN_MOVED_TO) action = FILE_ACTION_ADDED;
+    else action = FILE_ACTION_MODIFIED;
+
+    LIST_FOR_EACH_ENTRY( watch, &fanotify_watches, struct fan_watch, entry )
+    {
+        const char *relpath;
+
+        if (memcmp( &watch->fsid, &fid->fsid, sizeof(watch->fsid) )) continue;
+        if (!(filter & watch->dir->filter)) continue;
+
+        if (!path)  /* resolve the event directory only if some watch cares */
+        {
+            if ((dirfd = open_by_handle_at( get_unix_fd( watch->dir->fd ),
+                                            (struct file_handle *)handle, O_PATH )) == -1)
+                return;
+            path = get_fd_real_path( dirfd, strlen( name ) );
+            close( dirfd );
+            if (!path) return;
+            if (strcmp( name, "." ))
+            {
+                strcat( path, "/" );
+                strcat( path, name );
+            }
+        }
+
+        if (strncmp( path, watch->root, watch->root_len )) continue;
+        relpath = path + watch->root_len;
+        if (!*relpath) continue;  /* event on the watch root itself */
+
+        fanotify_queue_event( watch, action, relpath );
+    }
+
+    free( path );
+}
+
+static void fanotify_poll_event( struct fd *fd, int event )
+{
+    union
+    {
+        struct fanotify_event_metadata meta;
+        char buffer[16384];
+    } buf;
+    const struct fanotify_event_metadata *meta = &buf.meta;
+    struct fan_watch *watch;
+    int r;
+
+    r = read( get_unix_fd( fd ), &buf, sizeof(buf) );
+    if (r < 0)
+    {
+        if (errno != EAGAIN && errno != EINTR)
+            fprintf( stderr, "fanotify_poll_event(): fanotify read failed!\n" );
+        return;
+    }
+
+    while (FAN_EVENT_OK( meta, r ))
+    {
+        if (meta->fd >= 0) close( meta->fd );  /* shouldn't happen in fid mode */
+        else fanotify_notify_event( meta );
+        meta = FAN_EVENT_NEXT( meta, r );
+    }
+
+    /* wake each directory once per batch, however many records it queued */
+    LIST_FOR_EACH_ENTRY( watch, &fanotify_watches, struct fan_watch, entry )
+    {
+        if (!watch->pending) continue;
+        watch->pending = 0;
+        fd_async_wake_up( watch->dir->fd, ASYNC_TYPE_WAIT, STATUS_ALERTED );
+    }
+}
+
+static int init_fanotify(void)
+{
+    int unix_fd;
+
+    if (fanotify_fd) return 1;
+    if (fanotify_unusable) return 0;
+
+    unix_fd = fanotify_init( FAN_CLASS_NOTIF | FAN_REPORT_DFID_NAME | FAN_CLOEXEC | FAN_NONBLOCK, 0 );
+    if (unix_fd == -1 || !(fanotify_fd = create_anonymous_fd( &fanotify_fd_ops, unix_fd, NULL, 0 )))
+    {
+        /* typically EPERM: filesystem marks need CAP_SYS_ADMIN */
+        fanotify_unusable = 1;
+        return 0;
+    }
+    set_fd_events( fanotify_fd, POLLIN );
+    return 1;
+}
+
+/* set up a recursive watch through a filesystem mark, if possible */
+static int fanotify_adjust_changes( struct dir *dir )
+{
+    struct fan_watch *watch = dir->fan_watch;
+    struct statfs stfs;
+    size_t len;
+    char *root;
+    int unix_fd;
+
+    if (!init_fanotify()) return 0;
+
+    unix_fd = get_unix_fd( dir->fd );
+
+    /* marks accumulate; later filter changes only ever widen the mask */
+    if (fanotify_mark( get_unix_fd( fanotify_fd ), FAN_MARK_ADD | FAN_MARK_FILESYSTEM,
+                       fanotify_mask_from_filter( dir->filter ), unix_fd, NULL ) == -1)
+    {
+        if (!watch && list_empty( &fanotify_watches ))
+        {
+            release_object( fanotify_fd );
+            fanotify_fd = NULL;
+            fanotify_unusable = 1;
+        }
+        return 0;
+    }
+
+    if (watch) return 1;
+
+    if (fstatfs( unix_fd, &stfs ) == -1) return 0;
+    if (!(root = get_fd_real_path( unix_fd, 1 ))) return 0;
+    strcat( root, "/" );
+    len = strlen( root );
+
+    if (!(watch = malloc( sizeof(*watch) )))
+    {
+        free( root );
+        return 0;
+    }
+    watch->dir      = dir;
+    watch->root     = root;
+    watch->root_len = len;
+    watch->fsid     = stfs.f_fsid;
+    watch->pending  = 0;
+    list_add_tail( &fanotify_watches, &watch->entry );
+    dir->fan_watch = watch;
+    return 1;
+}
+
+static void fanotify_remove_watch( struct dir *dir )
+{
+    struct fan_watch *watch = dir->fan_watch;
+
+    if (!watch) return;
+    list_remove( &watch->entry );
+    free( watch->root );
+    free( watch );
+    dir->fan_watch = NULL;
+
+    /* dropping the fd removes all marks at once */
+    if (fanotify_fd && list_empty( &fanotify_watches ))
+    {
+        release_object( fanotify_fd );
+        fanotify_fd = NULL;
+    }
+}
+
+#else
+
+static int fanotify_adjust_changes( struct dir *dir )
+{
+    return 0;
+}
+
+static void fanotify_remove_watch( struct dir *dir )
+{
+}
+
+#endif  /* linux && FAN_REPORT_DFID_NAME */
+
 struct object *create_dir_obj( struct fd *fd, unsigned int access, mode_t mode )
 {
     struct dir *dir;
@@ -1146,6 +1479,7 @@ struct object *create_dir_obj( struct fd *fd, unsigned int access, mode_t mode )
     dir->notified = 0;
     dir->want_data = 0;
     dir->inode = NULL;
+    dir->fan_watch = NULL;
     grab_object( fd );
     dir->fd = fd;
     dir->mode = mode;
@@ -1218,9 +1552,13 @@ DECL_HANDLER(read_directory_changes)
     if (!list_empty( &dir->change_records ))
         fd_async_wake_up( dir->fd, ASYNC_TYPE_WAIT, STATUS_ALERTED );
 
-    /* setup the real notification */
-    if (!inotify_adjust_changes( dir ))
-        dnotify_adjust_changes( dir );
+    /* setup the real notification; recursive watches prefer a single
+     * fanotify filesystem mark over one inotify watch per subdirectory */
+    if (!(dir->subtree && fanotify_adjust_changes( dir )))
+    {
+        if (!inotify_adjust_changes( dir ))
+            dnotify_adjust_changes( dir );
+    }
 
     set_error(STATUS_PENDING);
 
@@ -31,6 +31,7 @@
 #include "request.h"
 #include "object.h"
 #include "file.h"
+#include "handle.h"
 #include "process.h"
 #include "user.h"
 #include "winuser.h"
@@ -44,8 +45,15 @@ struct clip_format
     unsigned int   seqno;            /* sequence number when the data was set */
     data_size_t    size;             /* size of the data block */
     void          *data;             /* data contents, or NULL for delay-rendered */
+    struct mapping *section;         /* mapping containing the data, for large formats */
 };
 
+/* check if a format has data attached, either inline or in a section */
+static inline int format_has_data( const struct clip_format *format )
+{
+    return format->data || format->section;
+}
+
 struct clipboard
 {
     struct object  obj;              /* object header */
@@ -116,6 +124,7 @@ static struct clip_format *add_format( struct clipboard *clipboard, unsigned int
     format->from = 0;
     format->size = 0;
     format->data = NULL;
+    format->section = NULL;
     list_add_tail( &clipboard->formats, &format->entry );
     clipboard->format_count++;
     if (id < CF_MAX) clipboard->format_map |= 1 << id;
@@ -131,6 +140,7 @@ static void free_clipboard_formats( struct clipboard *clipboard )
     {
         list_remove( &format->entry );
         free( format->data );
+        if (format->section) release_object( format->section );
         free( format );
     }
     clipboard->format_count = 0;
@@ -302,7 +312,7 @@ static user_handle_t release_clipboard( struct clipboard *clipboard )
     /* free the delayed-rendered formats, since we no longer have an owner to render them */
     LIST_FOR_EACH_ENTRY_SAFE( format, next, &clipboard->formats, struct clip_format, entry )
     {
-        if (format->data) continue;
+        if (format_has_data( format )) continue;
         /* format->from is earlier in the list and thus has already been
          * removed if not available anymore (it is also < CF_MAX)
          */
@@ -402,6 +412,7 @@ DECL_HANDLER(set_clipboard_data)
 {
     struct clip_format *format;
     struct clipboard *clipboard = get_process_clipboard();
+    struct mapping *section = NULL;
     void *data = NULL;
 
     if (!clipboard) return;
@@ -412,22 +423,35 @@ DECL_HANDLER(set_clipboard_data)
         return;
     }
 
-    if (get_req_data_size() && !(data = memdup( get_req_data(), get_req_data_size() ))) return;
+    if (req->handle)  /* large data is passed through a mapping instead of copied */
+    {
+        if (!(section = get_mapping_obj( current->process, req->handle, SECTION_MAP_READ ))) return;
+        if (req->size > get_mapping_size( section ))
+        {
+            set_error( STATUS_INVALID_PARAMETER );
+            release_object( section );
+            return;
+        }
+    }
+    else if (get_req_data_size() && !(data = memdup( get_req_data(), get_req_data_size() ))) return;
 
     if (!(format = get_format( clipboard, req->format )))
     {
         if (!(format = add_format( clipboard, req->format )))
         {
+            if (section) release_object( section );
             free( data );
             return;
         }
     }
 
     free( format->data );
-    format->from   = 0;
-    format->seqno  = clipboard->seqno;
-    format->size   = get_req_data_size();
-    format->data   = data;
+    if (format->section) release_object( format->section );
+    format->from    = 0;
+    format->seqno   = clipboard->seqno;
+    format->size    = section ? req->size : get_req_data_size();
+    format->data    = data;
+    format->section = section;
     if (!clipboard->rendering) clipboard->seqno++;
 
     if (req->format == CF_TEXT || req->format == CF_OEMTEXT || req->format == CF_UNICODETEXT)
@@ -460,7 +484,7 @@ DECL_HANDLER(get_clipboard_data)
     reply->seqno  = format->seqno;
     reply->owner  = clipboard->owner;
 
-    if (!format->data && req->render)  /* try rendering it client-side */
+    if (!format_has_data( format ) && req->render)  /* try rendering it client-side */
     {
         if (format->from || clipboard->owner) clipboard->rendering++;
         return;
@@ -468,7 +492,12 @@ DECL_HANDLER(get_clipboard_data)
 
     if (req->cached && req->seqno == format->seqno) goto done;  /* client-side cache still valid */
 
-    if (format->data)
+    if (format->section)
+    {
+        reply->handle = alloc_handle( current->process, format->section,
+                                      SECTION_QUERY | SECTION_MAP_READ, 0 );
+    }
+    else if (format->data)
     {
         if (format->size > get_reply_max_size())
         {
@@ -33,9 +33,25 @@
 
 #include "handle.h"
 #include "thread.h"
+#include "file.h"
 #include "request.h"
 #include "security.h"
 
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <limits.h>
+#include <linux/futex.h>
+/* wake clients waiting in-process on a session shared memory word; this has
+ * to be a non-private futex since the waiters are in other processes */
+static void shared_futex_wake( volatile unsigned int *addr )
+{
+    syscall( __NR_futex, (const void *)addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 );
+}
+#else
+static void shared_futex_wake( volatile unsigned int *addr ) { }
+#endif
+
 static const WCHAR event_name[] = {'E','v','e','n','t'};
 
 struct type_descr event_type =
@@ -56,6 +72,7 @@ struct event
     struct list    kernel_object;   /* list of kernel object pointers */
     int            manual_reset;    /* is it a manual reset event? */
     int            signaled;        /* event has been signaled */
+    volatile event_shm_t *shared;   /* event in session shared memory */
 };
 
 static void event_dump( struct object *obj, int verbose );
@@ -63,6 +80,7 @@ static int event_signaled( struct object *obj, struct wait_queue_entry *entry );
 static void event_satisfied( struct object *obj, struct wait_queue_entry *entry );
 static int event_signal( struct object *obj, unsigned int access);
 static struct list *event_get_kernel_obj_list( struct object *obj );
+static void event_destroy( struct object *obj );
 
 static const struct object_ops event_ops =
 {
@@ -85,7 +103,7 @@ static const struct object_ops event_ops =
     no_open_file,              /* open_file */
     event_get_kernel_obj_list, /* get_kernel_obj_list */
     no_close_handle,           /* close_handle */
-    no_destroy                 /* destroy */
+    event_destroy              /* destroy */
 };
 
 
@@ -150,6 +168,18 @@ struct event *create_event( struct object *root, const struct unicode_str *name,
             list_init( &event->kernel_object );
             event->manual_reset = manual_reset;
             event->signaled     = initial_state;
+            event->shared       = NULL;
+            /* only manual-reset events can be waited on from the client
+             * without consuming the signaled state */
+            if (manual_reset && (event->shared = alloc_shared_object()))
+            {
+                SHARED_WRITE_BEGIN( event->shared, event_shm_t )
+                {
+                    shared->signal_seq = 0;
+                    shared->signaled = initial_state;
+                }
+                SHARED_WRITE_END;
+            }
         }
     }
     return event;
@@ -166,6 +196,15 @@ static void pulse_event( struct event *event )
     /* wake up all waiters if manual reset, a single one otherwise */
     wake_up( &event->obj, !event->manual_reset );
     event->signaled = 0;
+    if (event->shared)
+    {
+        SHARED_WRITE_BEGIN( event->shared, event_shm_t )
+        {
+            shared->signal_seq++;
+        }
+        SHARED_WRITE_END;
+        shared_futex_wake( &event->shared->signal_seq );
+    }
 }
 
 void set_event( struct event *event )
@@ -173,11 +212,36 @@ void set_event( struct event *event )
     event->signaled = 1;
     /* wake up all waiters if manual reset, a single one otherwise */
     wake_up( &event->obj, !event->manual_reset );
+    if (event->shared)
+    {
+        SHARED_WRITE_BEGIN( event->shared, event_shm_t )
+        {
+            shared->signal_seq++;
+            shared->signaled = 1;
+        }
+        SHARED_WRITE_END;
+        shared_futex_wake( &event->shared->signal_seq );
+    }
 }
 
 void reset_event( struct event *event )
 {
     event->signaled = 0;
+    if (event->shared)
+    {
+        SHARED_WRITE_BEGIN( event->shared, event_shm_t )
+        {
+            shared->signaled = 0;
+        }
+        SHARED_WRITE_END;
+    }
+}
+
+static void event_destroy( struct object *obj )
+{
+    struct event *event = (struct event *)obj;
+    assert( obj->ops == &event_ops );
+    if (event->shared) free_shared_object( event->shared );
 }
 
 static void event_dump( struct object *obj, int verbose )
@@ -348,6 +412,18 @@ DECL_HANDLER(query_event)
     release_object( event );
 }
 
+/* get the session shared memory locator of a manual-reset event */
+DECL_HANDLER(get_event_locator)
+{
+    struct event *event;
+
+    if (!(event = get_event_obj( current->process, req->handle, SYNCHRONIZE ))) return;
+
+    if (event->shared) reply->locator = get_shared_object_locator( event->shared );
+
+    release_object( event );
+}
+
 /* create a keyed event */
 DECL_HANDLER(create_keyed_event)
 {
@@ -185,6 +185,8 @@ extern const struct pe_image_info *get_view_image_info( const struct memory_view
 extern int get_view_nt_name( const struct memory_view *view, struct unicode_str *name );
 extern void free_mapped_views( struct process *process );
 extern size_t get_page_size(void);
+extern struct mapping *get_mapping_obj( struct process *process, obj_handle_t handle, unsigned int access );
+extern mem_size_t get_mapping_size( struct mapping *mapping );
 extern struct mapping *create_fd_mapping( struct object *root, const struct unicode_str *name, struct fd *fd,
                                           unsigned int attr, const struct security_descriptor *sd );
 extern struct object *create_user_data_mapping( struct object *root, const struct unicode_str *name,
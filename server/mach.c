@@ -27,6 +27,7 @@
 #include <signal.h>
 #include <stdarg.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 #ifdef HAVE_SYS_SYSCTL_H
 #include <sys/sysctl.h>
@@ -53,7 +54,11 @@ static mach_port_t server_mach_port;
 
 void sigchld_callback(void)
 {
-    assert(0);  /* should never be called on MacOS */
+    int pid, status;
+
+    /* only forked registry saves are expected here, we don't use ptrace */
+    while ((pid = waitpid( -1, &status, WNOHANG )) > 0)
+        registry_save_child_exited( pid, status );
 }
 
 static void mach_set_error(kern_return_t mach_error)
@@ -467,6 +467,7 @@ static int add_process_view( struct thread *thread, struct memory_view *view )
             if (get_view_nt_name( view, &name ) && (process->image = memdup( name.str, name.len )))
                 process->imagelen = name.len;
             process->image_info = view->image;
+            if (shared_session) shared_session->processes_generation++;
             list_add_head( &process->views, &view->entry );
             return 1;
         }
@@ -1135,11 +1136,17 @@ struct mapping *create_fd_mapping( struct object *root, const struct unicode_str
     return NULL;
 }
 
-static struct mapping *get_mapping_obj( struct process *process, obj_handle_t handle, unsigned int access )
+struct mapping *get_mapping_obj( struct process *process, obj_handle_t handle, unsigned int access )
 {
     return (struct mapping *)get_handle_obj( process, handle, access, &mapping_ops );
 }
 
+/* retrieve the size of a mapping */
+mem_size_t get_mapping_size( struct mapping *mapping )
+{
+    return mapping->size;
+}
+
 /* open a new file for the file descriptor backing the view */
 struct file *get_view_file( const struct memory_view *view, unsigned int access, unsigned int sharing )
 {
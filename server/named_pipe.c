@@ -1115,6 +1115,11 @@ static void pipe_end_read( struct fd *fd, struct async *async, file_pos_t pos )
     set_error( STATUS_PENDING );
 }
 
+/* Pipe data always travels through the server: pipe ends are pseudo-fds and
+ * each write is buffered here as a message until a read consumes it. A
+ * client-side shared-memory data path would need protocol for negotiating
+ * the mapping and for falling back to this path on impersonation and
+ * overlapped waits, and is not attempted. */
 static void pipe_end_write( struct fd *fd, struct async *async, file_pos_t pos )
 {
     struct pipe_end *pipe_end = get_fd_user( fd );
@@ -1002,6 +1002,7 @@ void add_process_thread( struct process *process, struct thread *thread )
             }
         }
     }
+    if (shared_session) shared_session->processes_generation++;
     grab_object( thread );
 }
 
@@ -1022,6 +1023,7 @@ void remove_process_thread( struct process *process, struct thread *thread )
         process_killed( process );
     }
     else generate_debug_event( thread, DbgExitThreadStateChange, thread );
+    if (shared_session) shared_session->processes_generation++;
     release_object( thread );
 }
 
@@ -1659,6 +1661,7 @@ static void set_process_priority( struct process *process, int priority )
     int base_priority;
 
     process->priority = priority;
+    if (shared_session) shared_session->processes_generation++;
 
     switch (priority)
     {
@@ -27,6 +27,7 @@
 #include <signal.h>
 #include <stdarg.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "ntstatus.h"
@@ -90,7 +91,11 @@ static int open_proc_lwpctl( struct thread *thread )
 /* handle a SIGCHLD signal */
 void sigchld_callback(void)
 {
-    assert( 0 );  /* should only be called when using ptrace */
+    int pid, status;
+
+    /* only forked registry saves are expected here, we don't use ptrace */
+    while ((pid = waitpid( -1, &status, WNOHANG )) > 0)
+        registry_save_child_exited( pid, status );
 }
 
 /* initialize the process tracing mechanism */
@@ -36,6 +36,7 @@
 #include "winuser.h"
 #include "winternl.h"
 #include "ntuser.h"
+#include "dde.h"
 #include "hidusage.h"
 #include "kbd.h"
 
@@ -46,6 +47,19 @@
 #include "request.h"
 #include "user.h"
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/futex.h>
+/* wake clients waiting in-process on a session shared memory word; this has
+ * to be a non-private futex since the waiters are in other processes */
+static void shared_futex_wake( volatile unsigned int *addr )
+{
+    syscall( __NR_futex, (const void *)addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0 );
+}
+#else
+static void shared_futex_wake( volatile unsigned int *addr ) { }
+#endif
+
 #define WM_NCMOUSEFIRST WM_NCMOUSEMOVE
 #define WM_NCMOUSELAST  (WM_NCMOUSEFIRST+(WM_MOUSELAST-WM_MOUSEFIRST))
 
@@ -63,6 +77,7 @@ struct message_result
     struct msg_queue      *sender;        /* sender queue */
     struct msg_queue      *receiver;      /* receiver queue */
     int                    replied;       /* has it been replied to? */
+    int                    shm_reply;     /* may the reply be mirrored into the sender shared memory? */
     unsigned int           error;         /* error code to pass back to sender */
     lparam_t               result;        /* reply result */
     struct message        *hardware_msg;  /* hardware message if low-level hook result */
@@ -726,9 +741,11 @@ static inline void set_queue_bits( struct msg_queue *queue, unsigned int bits )
     {
         shared->wake_bits |= bits;
         shared->changed_bits |= bits;
+        if (bits & (QS_SENDMESSAGE | QS_SMRESULT)) shared->wake_seq++;
     }
     SHARED_WRITE_END;
 
+    if (bits & (QS_SENDMESSAGE | QS_SMRESULT)) shared_futex_wake( &queue_shm->wake_seq );
     if (is_signaled( queue )) wake_up( &queue->obj, 0 );
 }
 
@@ -928,6 +945,38 @@ static inline void remove_result_from_sender( struct message_result *result )
     if (!result->receiver) free_result( result );
 }
 
+/* check if a message result can be passed to the sender through shared memory */
+static int use_shm_reply( struct message_result *res )
+{
+#ifdef __linux__
+    /* Only when the sender allowed it at send time (it only does so for sends
+     * that are not nested inside another reply wait, so at most one mirrorable
+     * send exists per thread and the single mirror slot cannot be overwritten
+     * before it is consumed), only when this is the sender's sole outstanding
+     * send, and only when there is no reply data to retrieve from the server. */
+    return res->shm_reply && !res->data && !list_next( &res->sender->send_result, &res->sender_entry );
+#else
+    return 0;  /* the sender cannot futex-wait on the mirrored reply */
+#endif
+}
+
+/* mirror a message result into the sender queue shared memory and wake the sender */
+static void pass_message_result( struct msg_queue *sender, lparam_t result, unsigned int error )
+{
+    queue_shm_t *queue_shm = sender->shared;
+
+    SHARED_WRITE_BEGIN( queue_shm, queue_shm_t )
+    {
+        shared->reply_result = result;
+        shared->reply_error  = error;
+        shared->reply_seq++;
+        shared->wake_seq++;
+    }
+    SHARED_WRITE_END;
+
+    shared_futex_wake( &queue_shm->wake_seq );
+}
+
 /* store the message result in the appropriate structure */
 static void store_message_result( struct message_result *res, lparam_t result, unsigned int error )
 {
@@ -966,7 +1015,16 @@ static void store_message_result( struct message_result *res, lparam_t result, u
         {
             /* wake sender queue if waiting on this result */
             if (list_head(&res->sender->send_result) == &res->sender_entry)
-                set_queue_bits( res->sender, QS_SMRESULT );
+            {
+                if (use_shm_reply( res ))
+                {
+                    /* pass the result directly through shared memory; the sender
+                     * then doesn't need get_message_reply at all */
+                    pass_message_result( res->sender, result, error );
+                    remove_result_from_sender( res );
+                }
+                else set_queue_bits( res->sender, QS_SMRESULT );
+            }
         }
     }
     else if (!res->receiver) free_result( res );
@@ -986,6 +1044,65 @@ static void free_message( struct message *msg )
     free( msg );
 }
 
+/* mirror the first posted messages into the shared memory ring for client-side peeks */
+static void sync_shared_posted_msgs( struct msg_queue *queue )
+{
+    queue_shm_t *queue_shm = queue->shared;
+    struct message *msg;
+
+    SHARED_WRITE_BEGIN( queue_shm, queue_shm_t )
+    {
+        unsigned int count = 0, partial = 0;
+
+        LIST_FOR_EACH_ENTRY( msg, &queue->msg_list[POST_MESSAGE], struct message, entry )
+        {
+            /* only plain messages can be mirrored; stop at the first one that
+             * cannot, so that the ring is always an exact prefix of the list */
+            if (count == ARRAY_SIZE(shared->posted) || msg->data_size || (msg->msg & 0x80000000) ||
+                (msg->msg >= WM_DDE_FIRST && msg->msg <= WM_DDE_LAST))
+            {
+                partial = 1;
+                break;
+            }
+            shared->posted[count].win    = msg->win;
+            shared->posted[count].msg    = msg->msg;
+            shared->posted[count].wparam = msg->wparam;
+            shared->posted[count].lparam = msg->lparam;
+            shared->posted[count].time   = msg->time;
+            shared->posted[count].x      = msg->x;
+            shared->posted[count].y      = msg->y;
+            count++;
+        }
+        shared->posted_count = count;
+        shared->posted_partial = partial;
+    }
+    SHARED_WRITE_END;
+}
+
+/* mirror the data size of the next pending WM_INPUT message for client-side size queries */
+static void sync_shared_next_rawinput( struct thread_input *input )
+{
+    input_shm_t *input_shm = input->shared;
+    const struct hardware_msg_data *msg_data;
+    struct message *msg;
+    unsigned int size = 0;
+
+    LIST_FOR_EACH_ENTRY( msg, &input->msg_list, struct message, entry )
+    {
+        if (msg->msg != WM_INPUT) continue;
+        msg_data = msg->data;
+        size = msg_data->size - sizeof(*msg_data);
+        break;
+    }
+
+    if (input_shm->next_rawinput_size == size) return;
+    SHARED_WRITE_BEGIN( input_shm, input_shm_t )
+    {
+        shared->next_rawinput_size = size;
+    }
+    SHARED_WRITE_END;
+}
+
 /* remove (and free) a message from a message list */
 static void remove_queue_message( struct msg_queue *queue, struct message *msg,
                                   enum message_kind kind )
@@ -1001,6 +1118,7 @@ static void remove_queue_message( struct msg_queue *queue, struct message *msg,
             clear_queue_bits( queue, QS_POSTMESSAGE|QS_ALLPOSTMESSAGE );
         if (msg->msg == WM_HOTKEY && --queue->hotkey_count == 0)
             clear_queue_bits( queue, QS_HOTKEY );
+        sync_shared_posted_msgs( queue );
         break;
     }
     free_message( msg );
@@ -1039,6 +1157,7 @@ static struct message_result *alloc_message_result( struct msg_queue *send_queue
         result->sender       = send_queue;
         result->receiver     = recv_queue;
         result->replied      = 0;
+        result->shm_reply    = 0;
         result->data         = NULL;
         result->data_size    = 0;
         result->timeout      = NULL;
@@ -1811,6 +1930,7 @@ static void release_hardware_message( struct msg_queue *queue, unsigned int hw_i
 
     update_thread_input_key_state( input, msg->msg, msg->wparam );
     list_remove( &msg->entry );
+    if (msg->msg == WM_INPUT) sync_shared_next_rawinput( input );
     free_message( msg );
 }
 
@@ -1849,6 +1969,7 @@ found:
     list_add_tail( &hotkey->queue->msg_list[POST_MESSAGE], &msg->entry );
     set_queue_bits( hotkey->queue, QS_POSTMESSAGE|QS_ALLPOSTMESSAGE|QS_HOTKEY );
     hotkey->queue->hotkey_count++;
+    sync_shared_posted_msgs( hotkey->queue );
     return 1;
 }
 
@@ -1993,6 +2114,7 @@ static void queue_hardware_message( struct desktop *desktop, struct message *msg
         msg->unique_id = 0;  /* will be set once we return it to the app */
         list_add_tail( &input->msg_list, &msg->entry );
         set_queue_bits( thread->queue, get_hardware_msg_bit( msg->msg ) );
+        if (msg->msg == WM_INPUT) sync_shared_next_rawinput( input );
     }
     release_object( thread );
 }
@@ -2788,6 +2910,7 @@ static int get_hardware_message( struct thread *thread, unsigned int hw_id, user
             /* no window at all, remove it */
             update_thread_input_key_state( input, msg->msg, msg->wparam );
             list_remove( &msg->entry );
+            if (msg->msg == WM_INPUT) sync_shared_next_rawinput( input );
             free_message( msg );
             continue;
         }
@@ -2804,6 +2927,7 @@ static int get_hardware_message( struct thread *thread, unsigned int hw_id, user
                 /* for another thread input, drop it */
                 update_thread_input_key_state( input, msg->msg, msg->wparam );
                 list_remove( &msg->entry );
+                if (msg->msg == WM_INPUT) sync_shared_next_rawinput( input );
                 free_message( msg );
             }
             release_object( win_thread );
@@ -2944,6 +3068,7 @@ void post_message( user_handle_t win, unsigned int message, lparam_t wparam, lpa
             set_queue_bits( thread->queue, QS_HOTKEY );
             thread->queue->hotkey_count++;
         }
+        sync_shared_posted_msgs( thread->queue );
     }
     release_object( thread );
 }
@@ -3245,6 +3370,7 @@ DECL_HANDLER(send_message)
                 free_message( msg );
                 break;
             }
+            msg->result->shm_reply = (req->flags & SEND_MSG_SHM_REPLY) != 0;
             /* fall through */
         case MSG_NOTIFY:
             list_add_tail( &recv_queue->msg_list[SEND_MESSAGE], &msg->entry );
@@ -3258,6 +3384,7 @@ DECL_HANDLER(send_message)
                 set_queue_bits( recv_queue, QS_HOTKEY );
                 recv_queue->hotkey_count++;
             }
+            sync_shared_posted_msgs( recv_queue );
             break;
         case MSG_HARDWARE:  /* should use send_hardware_message instead */
         case MSG_CALLBACK_RESULT:  /* cannot send this one */
@@ -3309,6 +3436,14 @@ DECL_HANDLER(send_hardware_message)
     }
 
     reply->wait = sender ? wait : 0;
+    if (sender && wait && (req->flags & SEND_HWMSG_SHM_REPLY))
+    {
+        /* the hook result the sender will wait on was just pushed onto its
+         * send_result list by send_hook_ll_message() */
+        struct message_result *result = LIST_ENTRY( list_head( &sender->send_result ),
+                                                    struct message_result, sender_entry );
+        result->shm_reply = 1;
+    }
     reply->new_x = desktop_shm->cursor.x;
     reply->new_y = desktop_shm->cursor.y;
     release_object( desktop );
@@ -4157,6 +4292,7 @@ DECL_HANDLER(get_rawinput_buffer)
                 count++;
             }
         }
+        if (count) sync_shared_next_rawinput( input );
 
         if (!next_size)
         {
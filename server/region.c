@@ -855,29 +855,54 @@ struct region *xor_region( struct region *dst, const struct region *src1,
     return dst;
 }
 
+/* binary search over the y-x-banded rectangles for the one that contains */
+/* (x,y); return its index, or the index of the first rectangle after the */
+/* point if no rectangle contains it, and set *hit accordingly */
+static int find_region_pt( const struct region *region, int x, int y, int *hit )
+{
+    int i = 0, start = 0, end = region->num_rects - 1;
+
+    *hit = 0;
+    while (start <= end)
+    {
+        i = (start + end) / 2;
+        if (region->rects[i].bottom <= y ||
+            (region->rects[i].top <= y && region->rects[i].right <= x))
+            start = i + 1;
+        else if (region->rects[i].top > y ||
+                 (region->rects[i].bottom > y && region->rects[i].left > x))
+            end = i - 1;
+        else
+        {
+            *hit = 1;
+            return i;
+        }
+    }
+    return start;
+}
+
 /* check if the given point is inside the region */
 int point_in_region( struct region *region, int x, int y )
 {
-    const struct rectangle *ptr, *end;
+    int hit;
 
-    for (ptr = region->rects, end = region->rects + region->num_rects; ptr < end; ptr++)
-    {
-        if (ptr->top > y) return 0;
-        if (ptr->bottom <= y) continue;
-        /* now we are in the correct band */
-        if (ptr->left > x) return 0;
-        if (ptr->right <= x) continue;
-        return 1;
-    }
-    return 0;
+    if (!region->num_rects || !point_in_rect( &region->extents, x, y )) return 0;
+    find_region_pt( region, x, y, &hit );
+    return hit;
 }
 
 /* check if the given rectangle is (at least partially) inside the region */
 int rect_in_region( struct region *region, const struct rectangle *rect )
 {
     const struct rectangle *ptr, *end;
-
-    for (ptr = region->rects, end = region->rects + region->num_rects; ptr < end; ptr++)
+    int hit;
+
+    if (!region->num_rects || !EXTENTCHECK( &region->extents, rect )) return 0;
+    /* rectangles entirely above the top-left corner, or to its left in the
+     * same band, cannot overlap the rectangle, so skip them all at once */
+    ptr = region->rects + find_region_pt( region, rect->left, rect->top, &hit );
+    if (hit) return 1;
+    for (end = region->rects + region->num_rects; ptr < end; ptr++)
     {
         if (ptr->top >= rect->bottom) return 0;
         if (ptr->bottom <= rect->top) continue;
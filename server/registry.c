@@ -33,8 +33,10 @@
 #include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "ntstatus.h"
@@ -58,8 +60,22 @@ struct notify
     unsigned int      filter;   /* which events to notify on */
     obj_handle_t      hkey;     /* hkey associated with this notification */
     struct process   *process;  /* process in which the hkey is valid */
+    WCHAR            *path;     /* subtree path filter, or NULL to match everything */
+    data_size_t       pathlen;  /* length of the path filter in bytes */
+    int               journal;  /* does the client want change records? */
+    struct list       records;  /* change records not yet retrieved by the client */
+    unsigned int      record_count; /* number of pending change records */
 };
 
+struct notify_record
+{
+    struct list           entry;  /* entry in list of records */
+    struct registry_event event;  /* event data returned to the client */
+};
+
+/* once the journal overflows, drop it entirely and let the client re-enumerate */
+#define MAX_NOTIFY_RECORDS 256
+
 static const WCHAR key_name[] = {'K','e','y'};
 
 struct type_descr key_type =
@@ -153,9 +169,13 @@ struct file_load_info
 {
     const char *filename; /* input file name */
     FILE       *file;     /* input file */
-    char       *buffer;   /* line buffer */
-    int         len;      /* buffer length */
+    char       *buffer;   /* current line */
+    char       *line_buf; /* line buffer for the stdio path */
+    int         len;      /* line buffer length */
     int         line;     /* current input line */
+    char       *data;     /* private mapping of the whole file, if possible */
+    size_t      data_size;/* size of the mapping */
+    size_t      data_pos; /* read position in the mapping */
     WCHAR      *tmp;      /* temp buffer to use while parsing input */
     size_t      tmplen;   /* length of temp buffer */
 };
@@ -384,6 +404,20 @@ static void key_dump( struct object *obj, int verbose )
     fprintf( stderr, "\n" );
 }
 
+/* free the change records accumulated for a notification */
+static void free_notify_records( struct notify *notify )
+{
+    struct list *ptr;
+
+    while ((ptr = list_head( &notify->records )))
+    {
+        struct notify_record *record = LIST_ENTRY( ptr, struct notify_record, entry );
+        list_remove( &record->entry );
+        free( record );
+    }
+    notify->record_count = 0;
+}
+
 /* notify waiter and maybe delete the notification */
 static void do_notification( struct key *key, struct notify *notify, int del )
 {
@@ -401,6 +435,8 @@ static void do_notification( struct key *key, struct notify *notify, int del )
     if (del)
     {
         list_remove( &notify->entry );
+        free_notify_records( notify );
+        free( notify->path );
         free( notify );
     }
 }
@@ -747,28 +783,107 @@ static void make_clean( struct key *key )
     for (i = 0; i <= key->last_subkey; i++) make_clean( key->subkeys[i] );
 }
 
+/* compute the length in bytes of the path of a key relative to a given ancestor */
+static data_size_t get_relative_path_len( const struct key *key, const struct key *base )
+{
+    data_size_t len = 0;
+
+    while (key != base)
+    {
+        len += key->obj.name->len + sizeof(WCHAR);
+        key = get_parent( key );
+    }
+    return len ? len - sizeof(WCHAR) : 0;
+}
+
+/* build the path of a key relative to a given ancestor, the buffer must be large enough */
+static void get_relative_path( const struct key *key, const struct key *base, WCHAR *buffer, data_size_t len )
+{
+    WCHAR *end = buffer + len / sizeof(WCHAR);
+
+    while (key != base)
+    {
+        end -= key->obj.name->len / sizeof(WCHAR);
+        memcpy( end, key->obj.name->name, key->obj.name->len );
+        if (end > buffer) *--end = '\\';
+        key = get_parent( key );
+    }
+}
+
+/* check whether a relative path falls under the subtree path filter of a notification */
+static int match_notify_path( const struct notify *notify, const WCHAR *path, data_size_t len )
+{
+    if (len < notify->pathlen) return 0;
+    if (memicmp_strW( path, notify->path, notify->pathlen )) return 0;
+    return len == notify->pathlen || path[notify->pathlen / sizeof(WCHAR)] == '\\';
+}
+
+/* append a change record to the journal of a notification */
+static void add_notify_record( struct notify *notify, unsigned int change,
+                               const WCHAR *path, data_size_t len )
+{
+    struct notify_record *record;
+
+    if (notify->record_count > MAX_NOTIFY_RECORDS) return;  /* already overflowed */
+    if (notify->record_count == MAX_NOTIFY_RECORDS || (len && !path) ||
+        !(record = malloc( offsetof( struct notify_record, event.name[len / sizeof(WCHAR)] ))))
+    {
+        /* too many changes to keep track of, the client will have to re-enumerate */
+        free_notify_records( notify );
+        notify->record_count = MAX_NOTIFY_RECORDS + 1;
+        return;
+    }
+    record->event.change = change;
+    record->event.len = len;
+    memcpy( record->event.name, path, len );
+    list_add_tail( &notify->records, &record->entry );
+    notify->record_count++;
+}
+
 /* go through all the notifications and send them if necessary */
-static void check_notify( struct key *key, unsigned int change, int not_subtree )
+static void check_notify( struct key *key, struct key *changed, unsigned int change, int not_subtree )
 {
     struct list *ptr, *next;
+    data_size_t len = 0;
+    WCHAR *path = NULL;
+    int got_path = 0;
 
     LIST_FOR_EACH_SAFE( ptr, next, &key->notify_list )
     {
         struct notify *n = LIST_ENTRY( ptr, struct notify, entry );
-        if ( ( not_subtree || n->subtree ) && ( change & n->filter ) )
-            do_notification( key, n, 0 );
+        if (!( not_subtree || n->subtree ) || !( change & n->filter )) continue;
+        if ((n->path || n->journal) && !got_path)
+        {
+            if ((len = get_relative_path_len( changed, key )) && (path = malloc( len )))
+                get_relative_path( changed, key, path, len );
+            got_path = 1;
+        }
+        if (n->path)
+        {
+            if (len && !path) continue;  /* out of memory, not worth a spurious wakeup */
+            if (!match_notify_path( n, path, len )) continue;
+        }
+        if (n->journal) add_notify_record( n, change, path, len );
+        do_notification( key, n, 0 );
     }
+    free( path );
 }
 
 /* update key modification time */
 static void touch_key( struct key *key, unsigned int change )
 {
+    struct key *parent;
+
     key->modif = current_time;
     make_dirty( key );
 
+    /* let the clients drop their cached value reads */
+    if (shared_session) shared_session->regs_generation++;
+
     /* do notifications */
-    check_notify( key, change, 1 );
-    for (key = get_parent( key ); key; key = get_parent( key )) check_notify( key, change, 0 );
+    check_notify( key, key, change, 1 );
+    for (parent = get_parent( key ); parent; parent = get_parent( parent ))
+        check_notify( parent, key, change, 0 );
 }
 
 /* get the wow6432node key if any, grabbing it and releasing the original key */
@@ -1356,6 +1471,25 @@ static struct key *get_hkey_obj( obj_handle_t hkey, unsigned int access )
     return key;
 }
 
+/* try to map the whole input file, to parse it without stdio reads */
+static void map_load_file( struct file_load_info *info )
+{
+    struct stat st;
+    int fd = fileno( info->file );
+    void *ptr;
+
+    info->data = NULL;
+    info->data_size = info->data_pos = 0;
+    if (fd == -1 || fstat( fd, &st ) == -1) return;
+    if (!S_ISREG(st.st_mode) || !st.st_size) return;
+    if ((off_t)(size_t)st.st_size != st.st_size) return;
+    /* private writable mapping, so that lines can be terminated in place */
+    if ((ptr = mmap( NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 )) == MAP_FAILED)
+        return;
+    info->data = ptr;
+    info->data_size = st.st_size;
+}
+
 /* read a line from the input file */
 static int read_next_line( struct file_load_info *info )
 {
@@ -1363,6 +1497,40 @@ static int read_next_line( struct file_load_info *info )
     int newlen, pos = 0;
 
     info->line++;
+
+    if (info->data)  /* read directly from the mapping */
+    {
+        char *start = info->data + info->data_pos, *end;
+        size_t left = info->data_size - info->data_pos;
+
+        if (!left) return 0;  /* EOF */
+        if ((end = memchr( start, '\n', left )))
+        {
+            info->data_pos += end + 1 - start;
+            *end-- = 0;
+            if (end >= start && *end == '\r') *end = 0;
+            info->buffer = start;
+            return 1;
+        }
+        /* last line without a newline, copy it to add the terminating null */
+        if (left >= (size_t)info->len)
+        {
+            if (!(newbuf = realloc( info->line_buf, left + 1 )))
+            {
+                set_error( STATUS_NO_MEMORY );
+                return -1;
+            }
+            info->line_buf = newbuf;
+            info->len = left + 1;
+        }
+        memcpy( info->line_buf, start, left );
+        info->line_buf[left] = 0;
+        info->data_pos = info->data_size;
+        info->buffer = info->line_buf;
+        return 1;
+    }
+
+    info->buffer = info->line_buf;
     for (;;)
     {
         if (!fgets( info->buffer + pos, info->len - pos, info->file ))
@@ -1379,12 +1547,12 @@ static int read_next_line( struct file_load_info *info )
 
         /* need to enlarge the buffer */
         newlen = info->len + info->len / 2;
-        if (!(newbuf = realloc( info->buffer, newlen )))
+        if (!(newbuf = realloc( info->line_buf, newlen )))
         {
             set_error( STATUS_NO_MEMORY );
             return -1;
         }
-        info->buffer = newbuf;
+        info->line_buf = info->buffer = newbuf;
         info->len = newlen;
     }
 }
@@ -1726,12 +1894,14 @@ static void load_keys( struct key *key, const char *filename, FILE *f, int prefi
     info.len    = 4;
     info.tmplen = 4;
     info.line   = 0;
-    if (!(info.buffer = mem_alloc( info.len ))) return;
+    if (!(info.line_buf = mem_alloc( info.len ))) return;
+    info.buffer = info.line_buf;
     if (!(info.tmp = mem_alloc( info.tmplen )))
     {
-        free( info.buffer );
+        free( info.line_buf );
         return;
     }
+    map_load_file( &info );
 
     if ((read_next_line( &info ) != 1) ||
         strcmp( info.buffer, "WINE REGISTRY Version 2" ))
@@ -1780,7 +1950,8 @@ static void load_keys( struct key *key, const char *filename, FILE *f, int prefi
         update_key_time( subkey, modif );
         release_object( subkey );
     }
-    free( info.buffer );
+    if (info.data) munmap( info.data, info.data_size );
+    free( info.line_buf );
     free( info.tmp );
 }
 
@@ -2121,16 +2292,73 @@ done:
     return ret;
 }
 
+static pid_t save_child_pid;          /* pid of the forked background save, if any */
+static unsigned int save_child_dirty; /* branches that were dirty when the child was forked */
+
+/* handle the exit of a forked registry save; returns 0 if the pid is not the save child */
+int registry_save_child_exited( int pid, int status )
+{
+    int i;
+
+    if (!save_child_pid || pid != save_child_pid) return 0;
+    if (WIFSTOPPED( status )) return 1;
+    save_child_pid = 0;
+    if (!WIFEXITED( status ) || WEXITSTATUS( status ))
+    {
+        fprintf( stderr, "wineserver: background registry save failed\n" );
+        /* mark the branches dirty again so that the next save retries them */
+        for (i = 0; i < save_branch_count; i++)
+            if (save_child_dirty & (1u << i)) make_dirty( save_branch_info[i].key );
+    }
+    save_child_dirty = 0;
+    return 1;
+}
+
 /* periodic saving of the registry */
 static void periodic_save( void *arg )
 {
     int i;
+    pid_t pid;
 
-    if (fchdir( config_dir_fd ) == -1) return;
     save_timeout_user = NULL;
-    for (i = 0; i < save_branch_count; i++)
-        save_branch( save_branch_info[i].key, save_branch_info[i].filename );
-    if (fchdir( server_dir_fd ) == -1) fatal_error( "chdir to server dir: %s\n", strerror( errno ));
+
+    if (save_child_pid)  /* previous save still in progress, try again later */
+    {
+        set_periodic_save_timer();
+        return;
+    }
+
+    if (!(pid = fork()))
+    {
+        /* child process: save a copy-on-write snapshot of the registry,
+         * so that serializing large hives doesn't stall the event loop */
+        int failed = 0;
+        if (fchdir( config_dir_fd ) == -1) _exit( 1 );
+        for (i = 0; i < save_branch_count; i++)
+            if (!save_branch( save_branch_info[i].key, save_branch_info[i].filename )) failed = 1;
+        _exit( failed );
+    }
+
+    if (pid != -1)
+    {
+        /* the snapshot is consistent as of the fork; mark the branches clean now
+         * so that later changes are picked up by the next save, and remember them
+         * in case the child fails */
+        save_child_pid = pid;
+        save_child_dirty = 0;
+        for (i = 0; i < save_branch_count; i++)
+        {
+            if (!(save_branch_info[i].key->flags & KEY_DIRTY)) continue;
+            save_child_dirty |= 1u << i;
+            make_clean( save_branch_info[i].key );
+        }
+    }
+    else if (fchdir( config_dir_fd ) != -1)  /* fork failed, save synchronously */
+    {
+        for (i = 0; i < save_branch_count; i++)
+            save_branch( save_branch_info[i].key, save_branch_info[i].filename );
+        if (fchdir( server_dir_fd ) == -1) fatal_error( "chdir to server dir: %s\n", strerror( errno ));
+    }
     set_periodic_save_timer();
 }
 
@@ -2146,6 +2374,19 @@ void flush_registry(void)
 {
     int i;
 
+    if (save_child_pid)
+    {
+        /* wait for an in-progress background save, so that it cannot
+         * overwrite the final state saved below */
+        int status;
+        while (waitpid( save_child_pid, &status, 0 ) == -1 && errno == EINTR) /* nothing */;
+        save_child_pid = 0;
+        /* re-save those branches unconditionally, in case the child failed */
+        for (i = 0; i < save_branch_count; i++)
+            if (save_child_dirty & (1u << i)) make_dirty( save_branch_info[i].key );
+        save_child_dirty = 0;
+    }
+
     if (fchdir( config_dir_fd ) == -1) return;
     for (i = 0; i < save_branch_count; i++)
     {
@@ -2342,6 +2583,9 @@ DECL_HANDLER(load_registry)
     if ((key = create_key( parent, &name, 0, KEY_WOW64_64KEY, 0, sd )))
     {
         load_registry( key, req->file );
+        /* the loaded file may have populated pre-existing keys,
+         * so client-side value caches have to be dropped */
+        if (!get_error() && shared_session) shared_session->regs_generation++;
         release_object( key );
     }
     if (parent) release_object( parent );
@@ -2391,9 +2635,42 @@ DECL_HANDLER(save_registry)
     }
 }
 
+/* return the accumulated change records of a notification and reset its journal */
+static void set_notify_changes_reply( struct notify *notify )
+{
+    struct notify_record *record;
+    data_size_t size = 0;
+    char *data, *event;
+
+    if (notify->record_count <= MAX_NOTIFY_RECORDS)  /* overflowed journals return no data */
+    {
+        LIST_FOR_EACH_ENTRY( record, &notify->records, struct notify_record, entry )
+            size += (offsetof( struct registry_event, name[record->event.len / sizeof(WCHAR)] )
+                     + sizeof(int) - 1) / sizeof(int) * sizeof(int);
+        if (size && size <= get_reply_max_size() && (data = mem_alloc( size )))
+        {
+            event = data;
+            LIST_FOR_EACH_ENTRY( record, &notify->records, struct notify_record, entry )
+            {
+                data_size_t len = offsetof( struct registry_event, name[record->event.len / sizeof(WCHAR)] );
+                memcpy( event, &record->event, len );
+                event += len;
+                if (len % sizeof(int))
+                {
+                    memset( event, 0, sizeof(int) - len % sizeof(int) );
+                    event += sizeof(int) - len % sizeof(int);
+                }
+            }
+            set_reply_data_ptr( data, size );
+        }
+    }
+    free_notify_records( notify );
+}
+
 /* add a registry key change notification */
 DECL_HANDLER(set_registry_notification)
 {
+    struct unicode_str path = get_req_unicode_str();
     struct key *key;
     struct event *event;
     struct notify *notify;
@@ -2416,13 +2693,29 @@ DECL_HANDLER(set_registry_notification)
                     notify->filter  = req->filter;
                     notify->hkey    = req->hkey;
                     notify->process = current->process;
-                    list_add_head( &key->notify_list, &notify->entry );
+                    notify->path    = NULL;
+                    notify->pathlen = 0;
+                    notify->journal = req->journal;
+                    list_init( &notify->records );
+                    notify->record_count = 0;
+                    if (path.len && !(notify->path = memdup( path.str, path.len )))
+                    {
+                        free( notify );
+                        notify = NULL;
+                    }
+                    else
+                    {
+                        notify->pathlen = path.len;
+                        list_add_head( &key->notify_list, &notify->entry );
+                    }
                 }
             }
             if (notify)
             {
                 struct event **new_array;
 
+                set_notify_changes_reply( notify );
+                notify->journal = req->journal;
                 if ((new_array = realloc( notify->events, (notify->event_count + 1) * sizeof(*notify->events) )))
                 {
                     notify->events = new_array;
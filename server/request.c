@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
+#include <time.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -287,6 +288,63 @@ static void send_reply( union generic_reply *reply )
         fatal_protocol_error( current, "reply write: %s\n", strerror( errno ));
 }
 
+/* per-request-type call statistics */
+static struct request_stats request_stats[REQ_NB_REQUESTS];
+
+/* read the cycle counter used to time request handlers */
+static inline unsigned __int64 stats_ticks(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    unsigned int lo, hi;
+    __asm__ __volatile__( "rdtsc" : "=a" (lo), "=d" (hi) );
+    return ((unsigned __int64)hi << 32) | lo;
+#elif defined(__aarch64__)
+    unsigned __int64 ticks;
+    __asm__ __volatile__( "mrs %0, cntvct_el0" : "=r" (ticks) );
+    return ticks;
+#else
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (unsigned __int64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/* call a handler, accounting the time spent into the request statistics */
+static void dispatch_request( enum request req, union generic_request *request, union generic_reply *reply )
+{
+    struct request_stats *stats = &request_stats[req];
+    unsigned __int64 start = stats_ticks(), elapsed;
+    unsigned int bucket = 0;
+
+    req_handlers[req]( request, reply );
+
+    elapsed = stats_ticks() - start;
+    stats->calls++;
+    if (current && current->error) stats->errors++;
+    stats->ticks_total += elapsed;
+    if (elapsed > stats->ticks_max) stats->ticks_max = elapsed;
+    while (elapsed >>= 1) bucket++;
+    if (bucket >= ARRAY_SIZE(stats->histogram)) bucket = ARRAY_SIZE(stats->histogram) - 1;
+    stats->histogram[bucket]++;
+}
+
+/* dump the request statistics to stderr */
+void dump_request_stats(void)
+{
+    unsigned int i;
+
+    fprintf( stderr, "wineserver: request statistics:\n" );
+    for (i = 0; i < REQ_NB_REQUESTS; i++)
+    {
+        const struct request_stats *stats = &request_stats[i];
+        if (!stats->calls) continue;
+        fprintf( stderr, "%10llu calls %8llu errors  avg %8llu max %10llu ticks  %s\n",
+                 (unsigned long long)stats->calls, (unsigned long long)stats->errors,
+                 (unsigned long long)(stats->ticks_total / stats->calls),
+                 (unsigned long long)stats->ticks_max, get_req_name( i ) );
+    }
+}
+
 /* call a request handler */
 static void call_req_handler( struct thread *thread )
 {
@@ -301,7 +359,7 @@ static void call_req_handler( struct thread *thread )
     if (debug_level) trace_request();
 
     if (req < REQ_NB_REQUESTS)
-        req_handlers[req]( &current->req, &reply );
+        dispatch_request( req, &current->req, &reply );
     else
         set_error( STATUS_NOT_IMPLEMENTED );
 
@@ -323,6 +381,85 @@ static void call_req_handler( struct thread *thread )
     current = NULL;
 }
 
+/* execute a batch of independent pipelined requests */
+DECL_HANDLER(pipeline_batch)
+{
+    data_size_t size = get_req_data_size();
+    unsigned int i, count = size / sizeof(union generic_request);
+    union generic_request saved_req, *requests;
+    union generic_reply *replies;
+
+    if (!count || size != count * sizeof(union generic_request))
+    {
+        set_error( STATUS_INVALID_PARAMETER );
+        return;
+    }
+    if (count * sizeof(union generic_reply) > get_reply_max_size())
+    {
+        set_error( STATUS_BUFFER_OVERFLOW );
+        return;
+    }
+    if (!(requests = memdup( get_req_data(), size ))) return;
+    if (!(replies = set_reply_data_size( count * sizeof(union generic_reply) )))
+    {
+        free( requests );
+        return;
+    }
+
+    /* hide the batch request and its reply buffer from the sub-handlers */
+    saved_req = current->req;
+    current->reply_data = NULL;
+    current->reply_size = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        enum request req = requests[i].request_header.req;
+
+        memset( &replies[i], 0, sizeof(replies[i]) );
+        /* only simple requests without variable-sized data and with an
+         * immediate reply can be part of a batch */
+        if (req >= REQ_NB_REQUESTS || req == REQ_pipeline_batch ||
+            requests[i].request_header.request_size)
+        {
+            replies[i].reply_header.error = STATUS_INVALID_PARAMETER;
+            continue;
+        }
+        clear_error();
+        current->req = requests[i];
+        if (debug_level) trace_request();
+        dispatch_request( req, &current->req, &replies[i] );
+        if (!current) break;  /* the handler killed the thread */
+        if (current->reply_data)  /* variable-sized replies cannot be batched */
+        {
+            free( current->reply_data );
+            current->reply_data = NULL;
+            current->reply_size = 0;
+            memset( &replies[i], 0, sizeof(replies[i]) );
+            set_error( STATUS_INVALID_PARAMETER );
+        }
+        replies[i].reply_header.error = current->error;
+        if (debug_level) trace_reply( req, &replies[i] );
+    }
+
+    free( requests );
+    if (!current)  /* the thread is gone, nothing to reply to */
+    {
+        free( replies );
+        return;
+    }
+    current->req = saved_req;
+    current->reply_data = replies;
+    current->reply_size = count * sizeof(*replies);
+    clear_error();
+}
+
+/* retrieve the server call statistics */
+DECL_HANDLER(get_request_stats)
+{
+    data_size_t size = min( sizeof(request_stats), get_reply_max_size() );
+    set_reply_data( request_stats, size );
+}
+
 /* read a request from a thread */
 void read_request( struct thread *thread )
 {
@@ -54,6 +54,7 @@ extern int receive_fd( struct process *process );
 extern int send_client_fd( struct process *process, int fd, obj_handle_t handle );
 extern void read_request( struct thread *thread );
 extern void write_reply( struct thread *thread );
+extern void dump_request_stats(void);
 extern timeout_t monotonic_counter(void);
 extern void open_master_socket(void);
 extern void close_master_socket( timeout_t timeout );
@@ -63,6 +64,7 @@ extern int kill_lock_owner( int sig );
 extern char *server_dir;
 extern int server_dir_fd, config_dir_fd;
 
+extern const char *get_req_name( enum request req );
 extern void trace_request(void);
 extern void trace_reply( enum request req, const union generic_reply *reply );
 
@@ -41,6 +41,7 @@ DECL_HANDLER(create_event);
 DECL_HANDLER(event_op);
 DECL_HANDLER(query_event);
 DECL_HANDLER(open_event);
+DECL_HANDLER(get_event_locator);
 DECL_HANDLER(create_keyed_event);
 DECL_HANDLER(open_keyed_event);
 DECL_HANDLER(create_mutex);
@@ -301,6 +302,8 @@ DECL_HANDLER(resume_process);
 DECL_HANDLER(get_next_process);
 DECL_HANDLER(get_next_thread);
 DECL_HANDLER(set_keyboard_repeat);
+DECL_HANDLER(pipeline_batch);
+DECL_HANDLER(get_request_stats);
 
 typedef void (*req_handler)( const void *req, void *reply );
 static const req_handler req_handlers[REQ_NB_REQUESTS] =
@@ -339,6 +342,7 @@ static const req_handler req_handlers[REQ_NB_REQUESTS] =
     (req_handler)req_event_op,
     (req_handler)req_query_event,
     (req_handler)req_open_event,
+    (req_handler)req_get_event_locator,
     (req_handler)req_create_keyed_event,
     (req_handler)req_open_keyed_event,
     (req_handler)req_create_mutex,
@@ -599,6 +603,8 @@ static const req_handler req_handlers[REQ_NB_REQUESTS] =
     (req_handler)req_get_next_process,
     (req_handler)req_get_next_thread,
     (req_handler)req_set_keyboard_repeat,
+    (req_handler)req_pipeline_batch,
+    (req_handler)req_get_request_stats,
 };
 
 C_ASSERT( sizeof(abstime_t) == 8 );
@@ -879,6 +885,10 @@ C_ASSERT( offsetof(struct open_event_request, rootdir) == 20 );
 C_ASSERT( sizeof(struct open_event_request) == 24 );
 C_ASSERT( offsetof(struct open_event_reply, handle) == 8 );
 C_ASSERT( sizeof(struct open_event_reply) == 16 );
+C_ASSERT( offsetof(struct get_event_locator_request, handle) == 12 );
+C_ASSERT( sizeof(struct get_event_locator_request) == 16 );
+C_ASSERT( offsetof(struct get_event_locator_reply, locator) == 8 );
+C_ASSERT( sizeof(struct get_event_locator_reply) == 24 );
 C_ASSERT( offsetof(struct create_keyed_event_request, access) == 12 );
 C_ASSERT( sizeof(struct create_keyed_event_request) == 16 );
 C_ASSERT( offsetof(struct create_keyed_event_reply, handle) == 8 );
@@ -1214,7 +1224,9 @@ C_ASSERT( offsetof(struct set_registry_notification_request, hkey) == 12 );
 C_ASSERT( offsetof(struct set_registry_notification_request, event) == 16 );
 C_ASSERT( offsetof(struct set_registry_notification_request, subtree) == 20 );
 C_ASSERT( offsetof(struct set_registry_notification_request, filter) == 24 );
+C_ASSERT( offsetof(struct set_registry_notification_request, journal) == 28 );
 C_ASSERT( sizeof(struct set_registry_notification_request) == 32 );
+C_ASSERT( sizeof(struct set_registry_notification_reply) == 8 );
 C_ASSERT( offsetof(struct rename_key_request, hkey) == 12 );
 C_ASSERT( sizeof(struct rename_key_request) == 16 );
 C_ASSERT( offsetof(struct create_timer_request, access) == 12 );
@@ -1842,7 +1854,9 @@ C_ASSERT( sizeof(struct close_clipboard_reply) == 16 );
 C_ASSERT( sizeof(struct empty_clipboard_request) == 16 );
 C_ASSERT( offsetof(struct set_clipboard_data_request, format) == 12 );
 C_ASSERT( offsetof(struct set_clipboard_data_request, lcid) == 16 );
-C_ASSERT( sizeof(struct set_clipboard_data_request) == 24 );
+C_ASSERT( offsetof(struct set_clipboard_data_request, handle) == 20 );
+C_ASSERT( offsetof(struct set_clipboard_data_request, size) == 24 );
+C_ASSERT( sizeof(struct set_clipboard_data_request) == 32 );
 C_ASSERT( offsetof(struct set_clipboard_data_reply, seqno) == 8 );
 C_ASSERT( sizeof(struct set_clipboard_data_reply) == 16 );
 C_ASSERT( offsetof(struct get_clipboard_data_request, format) == 12 );
@@ -1854,7 +1868,8 @@ C_ASSERT( offsetof(struct get_clipboard_data_reply, from) == 8 );
 C_ASSERT( offsetof(struct get_clipboard_data_reply, owner) == 12 );
 C_ASSERT( offsetof(struct get_clipboard_data_reply, seqno) == 16 );
 C_ASSERT( offsetof(struct get_clipboard_data_reply, total) == 20 );
-C_ASSERT( sizeof(struct get_clipboard_data_reply) == 24 );
+C_ASSERT( offsetof(struct get_clipboard_data_reply, handle) == 24 );
+C_ASSERT( sizeof(struct get_clipboard_data_reply) == 32 );
 C_ASSERT( offsetof(struct get_clipboard_formats_request, format) == 12 );
 C_ASSERT( sizeof(struct get_clipboard_formats_request) == 16 );
 C_ASSERT( offsetof(struct get_clipboard_formats_reply, count) == 8 );
@@ -2279,3 +2294,7 @@ C_ASSERT( offsetof(struct set_keyboard_repeat_request, period) == 20 );
 C_ASSERT( sizeof(struct set_keyboard_repeat_request) == 24 );
 C_ASSERT( offsetof(struct set_keyboard_repeat_reply, enable) == 8 );
 C_ASSERT( sizeof(struct set_keyboard_repeat_reply) == 16 );
+C_ASSERT( sizeof(struct pipeline_batch_request) == 16 );
+C_ASSERT( sizeof(struct pipeline_batch_reply) == 8 );
+C_ASSERT( sizeof(struct get_request_stats_request) == 16 );
+C_ASSERT( sizeof(struct get_request_stats_reply) == 8 );
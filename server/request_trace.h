@@ -495,6 +495,16 @@ static void dump_open_event_reply( const struct open_event_reply *req )
     fprintf( stderr, " handle=%04x", req->handle );
 }
 
+static void dump_get_event_locator_request( const struct get_event_locator_request *req )
+{
+    fprintf( stderr, " handle=%04x", req->handle );
+}
+
+static void dump_get_event_locator_reply( const struct get_event_locator_reply *req )
+{
+    dump_obj_locator( " locator=", &req->locator );
+}
+
 static void dump_create_keyed_event_request( const struct create_keyed_event_request *req )
 {
     fprintf( stderr, " access=%08x", req->access );
@@ -1196,6 +1206,13 @@ static void dump_set_registry_notification_request( const struct set_registry_no
     fprintf( stderr, ", event=%04x", req->event );
     fprintf( stderr, ", subtree=%d", req->subtree );
     fprintf( stderr, ", filter=%08x", req->filter );
+    fprintf( stderr, ", journal=%d", req->journal );
+    dump_varargs_unicode_str( ", path=", cur_size );
+}
+
+static void dump_set_registry_notification_reply( const struct set_registry_notification_reply *req )
+{
+    dump_varargs_bytes( " changes=", cur_size );
 }
 
 static void dump_rename_key_request( const struct rename_key_request *req )
@@ -2440,6 +2457,8 @@ static void dump_set_clipboard_data_request( const struct set_clipboard_data_req
 {
     fprintf( stderr, " format=%08x", req->format );
     fprintf( stderr, ", lcid=%08x", req->lcid );
+    fprintf( stderr, ", handle=%04x", req->handle );
+    fprintf( stderr, ", size=%u", req->size );
     dump_varargs_bytes( ", data=", cur_size );
 }
 
@@ -2462,6 +2481,7 @@ static void dump_get_clipboard_data_reply( const struct get_clipboard_data_reply
     fprintf( stderr, ", owner=%08x", req->owner );
     fprintf( stderr, ", seqno=%08x", req->seqno );
     fprintf( stderr, ", total=%u", req->total );
+    fprintf( stderr, ", handle=%04x", req->handle );
     dump_varargs_bytes( ", data=", cur_size );
 }
 
@@ -3357,6 +3377,25 @@ static void dump_set_keyboard_repeat_reply( const struct set_keyboard_repeat_rep
     fprintf( stderr, " enable=%d", req->enable );
 }
 
+static void dump_pipeline_batch_request( const struct pipeline_batch_request *req )
+{
+    dump_varargs_bytes( " requests=", cur_size );
+}
+
+static void dump_pipeline_batch_reply( const struct pipeline_batch_reply *req )
+{
+    dump_varargs_bytes( " replies=", cur_size );
+}
+
+static void dump_get_request_stats_request( const struct get_request_stats_request *req )
+{
+}
+
+static void dump_get_request_stats_reply( const struct get_request_stats_reply *req )
+{
+    dump_varargs_bytes( " stats=", cur_size );
+}
+
 typedef void (*dump_func)( const void *req );
 
 static const dump_func req_dumpers[REQ_NB_REQUESTS] =
@@ -3395,6 +3434,7 @@ static const dump_func req_dumpers[REQ_NB_REQUESTS] =
     (dump_func)dump_event_op_request,
     (dump_func)dump_query_event_request,
     (dump_func)dump_open_event_request,
+    (dump_func)dump_get_event_locator_request,
     (dump_func)dump_create_keyed_event_request,
     (dump_func)dump_open_keyed_event_request,
     (dump_func)dump_create_mutex_request,
@@ -3655,6 +3695,8 @@ static const dump_func req_dumpers[REQ_NB_REQUESTS] =
     (dump_func)dump_get_next_process_request,
     (dump_func)dump_get_next_thread_request,
     (dump_func)dump_set_keyboard_repeat_request,
+    (dump_func)dump_pipeline_batch_request,
+    (dump_func)dump_get_request_stats_request,
 };
 
 static const dump_func reply_dumpers[REQ_NB_REQUESTS] =
@@ -3693,6 +3735,7 @@ static const dump_func reply_dumpers[REQ_NB_REQUESTS] =
     (dump_func)dump_event_op_reply,
     (dump_func)dump_query_event_reply,
     (dump_func)dump_open_event_reply,
+    (dump_func)dump_get_event_locator_reply,
     (dump_func)dump_create_keyed_event_reply,
     (dump_func)dump_open_keyed_event_reply,
     (dump_func)dump_create_mutex_reply,
@@ -3757,7 +3800,7 @@ static const dump_func reply_dumpers[REQ_NB_REQUESTS] =
     NULL,
     NULL,
     NULL,
-    NULL,
+    (dump_func)dump_set_registry_notification_reply,
     NULL,
     (dump_func)dump_create_timer_reply,
     (dump_func)dump_open_timer_reply,
@@ -3953,6 +3996,8 @@ static const dump_func reply_dumpers[REQ_NB_REQUESTS] =
     (dump_func)dump_get_next_process_reply,
     (dump_func)dump_get_next_thread_reply,
     (dump_func)dump_set_keyboard_repeat_reply,
+    (dump_func)dump_pipeline_batch_reply,
+    (dump_func)dump_get_request_stats_reply,
 };
 
 static const char * const req_names[REQ_NB_REQUESTS] =
@@ -3991,6 +4036,7 @@ static const char * const req_names[REQ_NB_REQUESTS] =
     "event_op",
     "query_event",
     "open_event",
+    "get_event_locator",
     "create_keyed_event",
     "open_keyed_event",
     "create_mutex",
@@ -4251,6 +4297,8 @@ static const char * const req_names[REQ_NB_REQUESTS] =
     "get_next_process",
     "get_next_thread",
     "set_keyboard_repeat",
+    "pipeline_batch",
+    "get_request_stats",
 };
 
 static const struct
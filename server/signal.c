@@ -173,6 +173,7 @@ static void handler_poll_event( struct fd *fd, int event )
 /* SIGHUP callback */
 static void sighup_callback(void)
 {
+    dump_request_stats();
 #ifdef DEBUG_OBJECTS
     dump_objects();
 #endif
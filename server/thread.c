@@ -782,6 +782,7 @@ unsigned int set_thread_priority( struct thread *thread, int priority )
     if (priority_class != PROCESS_PRIOCLASS_REALTIME && priority >= LOW_REALTIME_PRIORITY) return STATUS_PRIVILEGE_NOT_HELD;
 
     thread->priority = priority;
+    if (shared_session) shared_session->processes_generation++;
 
     /* if thread is gone or hasn't started yet, this will be called again from init_thread with a unix_tid */
     if (thread->state == RUNNING && thread->unix_tid != -1) apply_thread_priority( thread, priority );
@@ -851,7 +852,10 @@ static void set_thread_info( struct thread *thread,
     if (req->mask & SET_THREAD_INFO_TOKEN)
         security_set_thread_token( thread, req->token );
     if (req->mask & SET_THREAD_INFO_ENTRYPOINT)
+    {
         thread->entry_point = req->entry_point;
+        if (shared_session) shared_session->processes_generation++;
+    }
     if (req->mask & SET_THREAD_INFO_DBG_HIDDEN)
         thread->dbg_hidden = 1;
     if (req->mask & SET_THREAD_INFO_DESCRIPTION)
@@ -1083,10 +1083,45 @@ unsigned int token_get_session_id( struct token *token )
     return token->session_id;
 }
 
+/* Cache for repeated access checks against the same token and descriptor.
+ * Entries are validated against the token's modified_id, which is
+ * reallocated whenever the token is modified, and against a full copy of
+ * the descriptor, so a stale entry or a recycled descriptor allocation can
+ * never produce a wrong result. */
+
+#define ACCESS_CACHE_SIZE    64   /* power of two */
+#define ACCESS_CACHE_MAX_SD 512   /* don't cache larger descriptors */
+
+struct access_cache_entry
+{
+    struct luid        token_id;        /* id of the token checked */
+    struct luid        modified_id;     /* modification id of the token at check time */
+    unsigned int       desired_access;  /* desired access of the check */
+    struct generic_map mapping;         /* generic mapping used */
+    unsigned int       granted_access;  /* resulting granted access */
+    int                allowed;         /* was access granted? */
+    data_size_t        sd_size;         /* size of the copied descriptor, 0 if entry is unused */
+    char               sd[ACCESS_CACHE_MAX_SD]; /* copy of the descriptor */
+};
+
+static struct access_cache_entry access_cache[ACCESS_CACHE_SIZE];
+
+static unsigned int access_cache_hash( const struct token *token, const struct security_descriptor *sd,
+                                       data_size_t sd_size, unsigned int access )
+{
+    const unsigned char *ptr = (const unsigned char *)sd;
+    unsigned int hash = token->token_id.low_part ^ token->modified_id.low_part ^ access;
+
+    while (sd_size--) hash = hash * 65599 + *ptr++;
+    return hash & (ACCESS_CACHE_SIZE - 1);
+}
+
 int check_object_access(struct token *token, struct object *obj, unsigned int *access)
 {
+    struct access_cache_entry *entry = NULL;
     struct generic_map mapping;
-    unsigned int status;
+    unsigned int status, desired_access = *access;
+    data_size_t sd_size;
     int res;
 
     if (!token)
@@ -1104,10 +1139,43 @@ int check_object_access(struct token *token, struct object *obj, unsigned int *a
     mapping.write = obj->ops->map_access( obj, GENERIC_WRITE );
     mapping.exec = obj->ops->map_access( obj, GENERIC_EXECUTE );
 
-    res = token_access_check( token, obj->sd, *access, NULL, NULL,
+    sd_size = sizeof(*obj->sd) + obj->sd->owner_len + obj->sd->group_len +
+              obj->sd->sacl_len + obj->sd->dacl_len;
+    if (sd_size <= ACCESS_CACHE_MAX_SD)
+    {
+        entry = &access_cache[access_cache_hash( token, obj->sd, sd_size, desired_access )];
+        if (entry->sd_size == sd_size &&
+            entry->desired_access == desired_access &&
+            entry->token_id.low_part == token->token_id.low_part &&
+            entry->token_id.high_part == token->token_id.high_part &&
+            entry->modified_id.low_part == token->modified_id.low_part &&
+            entry->modified_id.high_part == token->modified_id.high_part &&
+            entry->mapping.read == mapping.read && entry->mapping.write == mapping.write &&
+            entry->mapping.exec == mapping.exec && entry->mapping.all == mapping.all &&
+            !memcmp( entry->sd, obj->sd, sd_size ))
+        {
+            *access = entry->granted_access;
+            if (!entry->allowed) set_error( STATUS_ACCESS_DENIED );
+            return entry->allowed;
+        }
+    }
+
+    res = token_access_check( token, obj->sd, desired_access, NULL, NULL,
                               &mapping, access, &status ) == STATUS_SUCCESS &&
           status == STATUS_SUCCESS;
 
+    if (entry)
+    {
+        entry->token_id       = token->token_id;
+        entry->modified_id    = token->modified_id;
+        entry->desired_access = desired_access;
+        entry->mapping        = mapping;
+        entry->granted_access = *access;
+        entry->allowed        = res;
+        entry->sd_size        = sd_size;
+        memcpy( entry->sd, obj->sd, sd_size );
+    }
+
     if (!res) set_error( STATUS_ACCESS_DENIED );
     return res;
 }
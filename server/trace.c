@@ -1558,6 +1558,11 @@ static void dump_varargs_monitor_infos( const char *prefix, data_size_t size )
     remove_data( size );
 }
 
+const char *get_req_name( enum request req )
+{
+    return req_names[req];
+}
+
 void trace_request(void)
 {
     enum request req = current->req.request_header.req;
@@ -341,6 +341,16 @@ static unsigned int get_window_dpi( struct window *win )
 }
 
 /* link a window at the right place in the siblings list */
+/* bump the desktop serial that invalidates client-side visible region caches */
+static void invalidate_vis_rgn( struct desktop *desktop )
+{
+    SHARED_WRITE_BEGIN( desktop->shared, desktop_shm_t )
+    {
+        shared->vis_rgn_serial++;
+    }
+    SHARED_WRITE_END;
+}
+
 static int link_window( struct window *win, struct window *previous )
 {
     struct list *old_prev;
@@ -444,6 +454,7 @@ static int set_parent_window( struct window *win, struct window *parent )
         win->is_linked = 0;
         win->is_orphan = 1;
     }
+    if (win->style & WS_VISIBLE) invalidate_vis_rgn( win->desktop );
     return 1;
 }
 
@@ -1964,6 +1975,8 @@ static void set_window_pos( struct window *win, struct window *previous,
     /* if the window is not visible, everything is easy */
     if (!visible) return;
 
+    invalidate_vis_rgn( win->desktop );
+
     /* expose anything revealed by the change */
 
     if (!(swp_flags & SWP_NOREDRAW))
@@ -2096,6 +2109,7 @@ static void set_window_region( struct window *win, struct region *region, int re
 
     if (win->win_region) free_region( win->win_region );
     win->win_region = region;
+    if (win->style & WS_VISIBLE) invalidate_vis_rgn( win->desktop );
 
     /* expose anything revealed by the change */
     if (old_vis_rgn && ((exposed_rgn = expose_window( win, &win->window_rect, old_vis_rgn, 0 ))))
@@ -2121,6 +2135,7 @@ void free_window_handle( struct window *win )
     {
         struct region *vis_rgn = get_visible_region( win, DCX_WINDOW );
         win->style &= ~WS_VISIBLE;
+        invalidate_vis_rgn( win->desktop );
         if (vis_rgn)
         {
             struct region *exposed_rgn = expose_window( win, &win->window_rect, vis_rgn, 0 );
@@ -2421,6 +2436,7 @@ DECL_HANDLER(set_window_info)
         reply->old_info = win->style;
         win->style = req->new_info;
         fix_window_ex_style( win );
+        if ((reply->old_info ^ win->style) & WS_VISIBLE) invalidate_vis_rgn( win->desktop );
         /* changing window style triggers a non-client paint */
         win->paint_flags |= PAINT_NONCLIENT;
         break;
@@ -324,6 +324,7 @@ static struct desktop *create_desktop( const struct unicode_str *name, unsigned
                 shared->cursor.clip.bottom = 0;
                 memset( (void *)shared->keystate, 0, sizeof(shared->keystate) );
                 shared->monitor_serial = winstation->monitor_serial;
+                shared->vis_rgn_serial = 1;
             }
             SHARED_WRITE_END;
         }